@@ -0,0 +1,66 @@
+//  HTMLAtom.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+
+/**
+    Atoms are canonical instances of tag and attribute names. Every known HTML, SVG, and MathML name has exactly one atom per process, so two known names are equal exactly when they are the same object.
+ 
+    Tag names of elements and tag tokens are always atoms when the name is known, which lets the tree builder compare tag names by pointer (see TagNameIsAnyOf).
+ */
+
+/// Returns the atom for a known tag or attribute name, or nil if the name is not known. Names are case-sensitive.
+extern NSString * HTMLKnownAtom(NSString *name);
+
+/**
+    An HTMLAtomTable interns names for a single parse. Known names become their atoms, and each distinct unknown name is copied once and shared thereafter.
+ 
+    Atom tables are not thread-safe.
+ */
+@interface HTMLAtomTable : NSObject
+
+/// Returns the atom for a known name, or the table's own copy of an unknown name.
+- (NSString *)atomForName:(NSString *)name;
+
+@end
+
+/**
+    @return YES if the first parameter, which must be an atom or an unknown name, is equal to any subsequent parameter, otherwise NO. Each subsequent parameter must be a string literal of a known name.
+ 
+    The literals are turned into atoms the first time each use of the macro runs, after which comparisons are by pointer.
+ */
+#define TagNameIsAnyOf(tagName, ...) ({ \
+    NSString *tagName_ = (tagName); \
+    static __unsafe_unretained NSString *atoms_[] = { __VA_ARGS__ }; \
+    static dispatch_once_t onceToken_; \
+    dispatch_once(&onceToken_, ^{ \
+        for (size_t i = 0; i < sizeof(atoms_) / sizeof(atoms_[0]); i++) { \
+            NSString *atom = HTMLKnownAtom(atoms_[i]); \
+            NSCAssert(atom, @"%@ is not a known name", atoms_[i]); \
+            atoms_[i] = atom ?: atoms_[i]; \
+        } \
+    }); \
+    BOOL found_ = NO; \
+    for (size_t i = 0; i < sizeof(atoms_) / sizeof(atoms_[0]); i++) { \
+        if (tagName_ == atoms_[i]) { \
+            found_ = YES; \
+            break; \
+        } \
+    } \
+    found_; \
+})
+
+/**
+    @return The atom for a string literal of a known name. The atom is looked up the first time each use of the macro runs.
+ */
+#define HTMLAtomForLiteral(name) ({ \
+    static __unsafe_unretained NSString *atom_; \
+    static dispatch_once_t onceToken_; \
+    dispatch_once(&onceToken_, ^{ \
+        atom_ = HTMLKnownAtom(name); \
+        NSCAssert(atom_, @"%@ is not a known name", name); \
+        atom_ = atom_ ?: name; \
+    }); \
+    atom_; \
+})
@@ -0,0 +1,103 @@
+//  HTMLAtom.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLAtom.h"
+
+static __unsafe_unretained NSString * const KnownNames[] = {
+    // HTML elements, including obsolete ones the tree builder still knows about.
+    @"a", @"abbr", @"acronym", @"address", @"applet", @"area", @"article", @"aside",
+    @"audio", @"b", @"base", @"basefont", @"bdi", @"bdo", @"bgsound", @"big",
+    @"blink", @"blockquote", @"body", @"br", @"button", @"canvas", @"caption", @"center",
+    @"cite", @"code", @"col", @"colgroup", @"command", @"data", @"datalist", @"dd",
+    @"del", @"details", @"dfn", @"dialog", @"dir", @"div", @"dl", @"dt",
+    @"em", @"embed", @"fieldset", @"figcaption", @"figure", @"font", @"footer", @"form",
+    @"frame", @"frameset", @"h1", @"h2", @"h3", @"h4", @"h5", @"h6",
+    @"head", @"header", @"hgroup", @"hr", @"html", @"i", @"iframe", @"image",
+    @"img", @"input", @"ins", @"isindex", @"kbd", @"keygen", @"label", @"legend",
+    @"li", @"link", @"listing", @"main", @"map", @"mark", @"marquee", @"menu",
+    @"menuitem", @"meta", @"meter", @"nav", @"nobr", @"noembed", @"noframes", @"noscript",
+    @"object", @"ol", @"optgroup", @"option", @"output", @"p", @"param", @"picture",
+    @"plaintext", @"pre", @"progress", @"q", @"rb", @"rp", @"rt", @"rtc",
+    @"ruby", @"s", @"samp", @"script", @"section", @"select", @"small", @"source",
+    @"span", @"strike", @"strong", @"style", @"sub", @"summary", @"sup", @"table",
+    @"tbody", @"td", @"template", @"textarea", @"tfoot", @"th", @"thead", @"time",
+    @"title", @"tr", @"track", @"tt", @"u", @"ul", @"var", @"video",
+    @"wbr", @"xmp",
+    
+    // MathML elements.
+    @"math", @"annotation", @"annotation-xml", @"maction", @"malignmark", @"menclose", @"merror", @"mfenced",
+    @"mfrac", @"mglyph", @"mi", @"mlabeledtr", @"mmultiscripts", @"mn", @"mo", @"mover",
+    @"mpadded", @"mphantom", @"mroot", @"mrow", @"ms", @"mspace", @"msqrt", @"mstyle",
+    @"msub", @"msubsup", @"msup", @"mtable", @"mtd", @"mtext", @"mtr", @"munder",
+    @"munderover", @"semantics",
+    
+    // SVG elements, including the mixed-case names the tree builder gives them.
+    @"svg", @"animate", @"circle", @"cursor", @"defs", @"desc", @"ellipse", @"filter",
+    @"g", @"line", @"marker", @"mask", @"metadata", @"mpath", @"path", @"pattern",
+    @"polygon", @"polyline", @"rect", @"set", @"stop", @"switch", @"symbol", @"text",
+    @"tref", @"tspan", @"use", @"view", @"altGlyph", @"altGlyphDef", @"altGlyphItem", @"animateColor",
+    @"animateMotion", @"animateTransform", @"clipPath", @"feBlend", @"feColorMatrix", @"feComponentTransfer", @"feComposite", @"feConvolveMatrix",
+    @"feDiffuseLighting", @"feDisplacementMap", @"feDistantLight", @"feFlood", @"feFuncA", @"feFuncB", @"feFuncG", @"feFuncR",
+    @"feGaussianBlur", @"feImage", @"feMerge", @"feMergeNode", @"feMorphology", @"feOffset", @"fePointLight", @"feSpecularLighting",
+    @"feSpotLight", @"feTile", @"feTurbulence", @"foreignObject", @"glyphRef", @"linearGradient", @"radialGradient", @"textPath",
+    
+    // Attributes, including the mixed-case names the tree builder gives SVG attributes.
+    @"accept", @"accept-charset", @"accesskey", @"action", @"align", @"alink", @"alt", @"async",
+    @"autocomplete", @"autofocus", @"autoplay", @"background", @"bgcolor", @"border", @"charset", @"checked",
+    @"class", @"clear", @"color", @"cols", @"colspan", @"content", @"contenteditable", @"controls",
+    @"coords", @"crossorigin", @"d", @"datetime", @"defer", @"definitionURL", @"dirname", @"disabled",
+    @"download", @"draggable", @"encoding", @"enctype", @"face", @"fill", @"for", @"frameborder",
+    @"headers", @"height", @"hidden", @"high", @"href", @"hreflang", @"http-equiv", @"id",
+    @"integrity", @"ismap", @"itemprop", @"kind", @"lang", @"language", @"list", @"loop",
+    @"low", @"max", @"maxlength", @"media", @"method", @"min", @"multiple", @"muted",
+    @"name", @"nonce", @"noshade", @"novalidate", @"nowrap", @"onclick", @"onload", @"open",
+    @"optimum", @"placeholder", @"poster", @"preload", @"prompt", @"property", @"readonly", @"rel",
+    @"required", @"rev", @"reversed", @"role", @"rows", @"rowspan", @"sandbox", @"scope",
+    @"scrolling", @"selected", @"shape", @"size", @"sizes", @"spellcheck", @"src", @"srcdoc",
+    @"srclang", @"srcset", @"start", @"step", @"stroke", @"tabindex", @"target", @"transform",
+    @"translate", @"type", @"usemap", @"valign", @"value", @"version", @"viewBox", @"width",
+    @"wrap", @"x", @"y", @"xmlns", @"xmlns:xlink", @"xlink:href", @"xml:lang", @"xml:space",
+    @"attributeName", @"attributeType", @"baseFrequency", @"baseProfile", @"calcMode", @"clipPathUnits", @"diffuseConstant", @"edgeMode",
+    @"filterUnits", @"gradientTransform", @"gradientUnits", @"kernelMatrix", @"kernelUnitLength", @"keyPoints", @"keySplines", @"keyTimes",
+    @"lengthAdjust", @"limitingConeAngle", @"markerHeight", @"markerUnits", @"markerWidth", @"maskContentUnits", @"maskUnits", @"numOctaves",
+    @"pathLength", @"patternContentUnits", @"patternTransform", @"patternUnits", @"pointsAtX", @"pointsAtY", @"pointsAtZ", @"preserveAlpha",
+    @"preserveAspectRatio", @"primitiveUnits", @"refX", @"refY", @"repeatCount", @"repeatDur", @"requiredExtensions", @"requiredFeatures",
+    @"specularConstant", @"specularExponent", @"spreadMethod", @"startOffset", @"stdDeviation", @"stitchTiles", @"surfaceScale", @"systemLanguage",
+    @"tableValues", @"targetX", @"targetY", @"textLength", @"viewTarget", @"xChannelSelector", @"yChannelSelector", @"zoomAndPan",
+};
+
+NSString * HTMLKnownAtom(NSString *name)
+{
+    static NSSet *knownAtoms;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        knownAtoms = [NSSet setWithObjects:KnownNames count:sizeof(KnownNames) / sizeof(KnownNames[0])];
+    });
+    return [knownAtoms member:name];
+}
+
+@implementation HTMLAtomTable
+{
+    NSMutableSet *_unknownNames;
+}
+
+- (instancetype)init
+{
+    if ((self = [super init])) {
+        _unknownNames = [NSMutableSet new];
+    }
+    return self;
+}
+
+- (NSString *)atomForName:(NSString *)name
+{
+    NSString *atom = HTMLKnownAtom(name) ?: [_unknownNames member:name];
+    if (!atom) {
+        atom = [name copy];
+        [_unknownNames addObject:atom];
+    }
+    return atom;
+}
+
+@end
@@ -0,0 +1,64 @@
+//  HTMLAttributeStorage.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+@class HTMLOrderedDictionary;
+
+/// A name and its value, both retained by the storage that holds them.
+typedef struct {
+    CFTypeRef name;
+    CFTypeRef value;
+} HTMLAttribute;
+
+/**
+    HTMLAttributeStorage keeps names and values as pairs in a single array, in the order they were added. It holds the attributes of elements and tag tokens, and backs HTMLOrderedDictionary.
+ 
+    Most elements have two or three attributes, so a name is found by looking through the array: first by pointer, which finds atoms straightaway, then by equality. Once there are more than HTMLAttributeStorageIndexThreshold pairs, a hash table from names to positions takes over.
+ 
+    Zeroed storage is empty and ready to use. Storage is not thread-safe.
+ */
+typedef struct {
+    HTMLAttribute *attributes;
+    uint32_t count;
+    uint32_t capacity;
+    CFMutableDictionaryRef index;
+} HTMLAttributeStorage;
+
+enum { HTMLAttributeStorageIndexThreshold = 8 };
+
+/// Makes room for at least count pairs.
+extern void HTMLAttributeStorageReserve(HTMLAttributeStorage *storage, NSUInteger count);
+
+/// Returns the position of the pair with the name, or NSNotFound if there is none.
+extern NSUInteger HTMLAttributeStorageIndexOfName(const HTMLAttributeStorage *storage, id name);
+
+/// Returns the value paired with the name, or nil if there is none.
+extern id HTMLAttributeStorageValue(const HTMLAttributeStorage *storage, id name);
+
+/// Appends a pair and returns YES, unless the name is already present, in which case nothing changes and NO is returned. The name is copied.
+extern BOOL HTMLAttributeStorageAdd(HTMLAttributeStorage *storage, id name, id value);
+
+/// Changes the value paired with the name, or inserts a new pair at index if the name isn't present. The name is copied. The index must not be beyond the count.
+extern void HTMLAttributeStorageInsert(HTMLAttributeStorage *storage, id name, id value, NSUInteger index);
+
+/// Removes the pair with the name, if there is one.
+extern void HTMLAttributeStorageRemove(HTMLAttributeStorage *storage, id name);
+
+/// Removes every pair, keeping the array around for reuse.
+extern void HTMLAttributeStorageRemoveAll(HTMLAttributeStorage *storage);
+
+/// Removes every pair and frees the array, leaving the storage zeroed.
+extern void HTMLAttributeStorageFree(HTMLAttributeStorage *storage);
+
+/// Replaces the destination's pairs with the source's, in an array of just the right size.
+extern void HTMLAttributeStorageCopy(HTMLAttributeStorage *destination, const HTMLAttributeStorage *source);
+
+/// YES if both have equal pairs, in any order, just like -[NSDictionary isEqual:].
+extern BOOL HTMLAttributeStorageEqual(const HTMLAttributeStorage *storage, const HTMLAttributeStorage *other);
+
+/// The storage behind an ordered dictionary, for reading or changing it without going through NSDictionary methods.
+extern HTMLAttributeStorage * HTMLOrderedDictionaryStorage(HTMLOrderedDictionary *dictionary);
+
+/// Returns a new ordered dictionary holding the storage's pairs.
+extern HTMLOrderedDictionary * HTMLOrderedDictionaryWithStorage(const HTMLAttributeStorage *storage);
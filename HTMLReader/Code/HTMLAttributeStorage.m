@@ -0,0 +1,161 @@
+//  HTMLAttributeStorage.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLAttributeStorage.h"
+
+void HTMLAttributeStorageReserve(HTMLAttributeStorage *storage, NSUInteger count)
+{
+    if (count > storage->capacity) {
+        NSUInteger capacity = MAX(MAX((NSUInteger)storage->capacity * 2, count), (NSUInteger)4);
+        storage->attributes = reallocf(storage->attributes, capacity * sizeof(storage->attributes[0]));
+        storage->capacity = (uint32_t)capacity;
+    }
+}
+
+// Positions are stored off by one, as a pair's position can be zero but a value in the index can't be NULL.
+static void RebuildIndex(HTMLAttributeStorage *storage)
+{
+    if (storage->index) {
+        CFRelease(storage->index);
+        storage->index = NULL;
+    }
+    if (storage->count <= HTMLAttributeStorageIndexThreshold) return;
+    
+    storage->index = CFDictionaryCreateMutable(NULL, storage->count, &kCFTypeDictionaryKeyCallBacks, NULL);
+    for (uint32_t i = 0; i < storage->count; i++) {
+        CFDictionarySetValue(storage->index, storage->attributes[i].name, (const void *)(uintptr_t)(i + 1));
+    }
+}
+
+NSUInteger HTMLAttributeStorageIndexOfName(const HTMLAttributeStorage *storage, id name)
+{
+    if (!name) return NSNotFound;
+    CFTypeRef key = (__bridge CFTypeRef)name;
+    if (storage->index) {
+        const void *position;
+        if (CFDictionaryGetValueIfPresent(storage->index, key, &position)) {
+            return (NSUInteger)(uintptr_t)position - 1;
+        }
+        return NSNotFound;
+    }
+    
+    const HTMLAttribute *attributes = storage->attributes;
+    for (uint32_t i = 0; i < storage->count; i++) {
+        if (attributes[i].name == key) return i;
+    }
+    for (uint32_t i = 0; i < storage->count; i++) {
+        if (CFEqual(attributes[i].name, key)) return i;
+    }
+    return NSNotFound;
+}
+
+id HTMLAttributeStorageValue(const HTMLAttributeStorage *storage, id name)
+{
+    NSUInteger i = HTMLAttributeStorageIndexOfName(storage, name);
+    return i == NSNotFound ? nil : (__bridge id)storage->attributes[i].value;
+}
+
+static void InsertNewPair(HTMLAttributeStorage *storage, id name, id value, NSUInteger index)
+{
+    HTMLAttributeStorageReserve(storage, storage->count + 1);
+    HTMLAttribute *attributes = storage->attributes;
+    memmove(&attributes[index + 1], &attributes[index], (storage->count - index) * sizeof(attributes[0]));
+    attributes[index] = (HTMLAttribute){
+        .name = CFBridgingRetain([name copy]),
+        .value = CFBridgingRetain(value),
+    };
+    storage->count++;
+    
+    if (storage->index && index + 1 == storage->count) {
+        CFDictionarySetValue(storage->index, attributes[index].name, (const void *)(uintptr_t)storage->count);
+    } else if (storage->count > HTMLAttributeStorageIndexThreshold) {
+        RebuildIndex(storage);
+    }
+}
+
+BOOL HTMLAttributeStorageAdd(HTMLAttributeStorage *storage, id name, id value)
+{
+    if (HTMLAttributeStorageIndexOfName(storage, name) != NSNotFound) return NO;
+    InsertNewPair(storage, name, value, storage->count);
+    return YES;
+}
+
+void HTMLAttributeStorageInsert(HTMLAttributeStorage *storage, id name, id value, NSUInteger index)
+{
+    NSUInteger existing = HTMLAttributeStorageIndexOfName(storage, name);
+    if (existing == NSNotFound) {
+        InsertNewPair(storage, name, value, index);
+    } else {
+        CFTypeRef oldValue = storage->attributes[existing].value;
+        storage->attributes[existing].value = CFBridgingRetain(value);
+        CFRelease(oldValue);
+    }
+}
+
+void HTMLAttributeStorageRemove(HTMLAttributeStorage *storage, id name)
+{
+    NSUInteger i = HTMLAttributeStorageIndexOfName(storage, name);
+    if (i == NSNotFound) return;
+    
+    HTMLAttribute removed = storage->attributes[i];
+    storage->count--;
+    memmove(&storage->attributes[i], &storage->attributes[i + 1], (storage->count - i) * sizeof(storage->attributes[0]));
+    if (storage->index) {
+        RebuildIndex(storage);
+    }
+    CFRelease(removed.name);
+    CFRelease(removed.value);
+}
+
+void HTMLAttributeStorageRemoveAll(HTMLAttributeStorage *storage)
+{
+    if (storage->index) {
+        CFRelease(storage->index);
+        storage->index = NULL;
+    }
+    for (uint32_t i = 0; i < storage->count; i++) {
+        CFRelease(storage->attributes[i].name);
+        CFRelease(storage->attributes[i].value);
+    }
+    storage->count = 0;
+}
+
+void HTMLAttributeStorageFree(HTMLAttributeStorage *storage)
+{
+    HTMLAttributeStorageRemoveAll(storage);
+    free(storage->attributes);
+    storage->attributes = NULL;
+    storage->capacity = 0;
+}
+
+void HTMLAttributeStorageCopy(HTMLAttributeStorage *destination, const HTMLAttributeStorage *source)
+{
+    HTMLAttributeStorageFree(destination);
+    if (source->count == 0) return;
+    
+    destination->attributes = malloc(source->count * sizeof(destination->attributes[0]));
+    for (uint32_t i = 0; i < source->count; i++) {
+        destination->attributes[i] = (HTMLAttribute){
+            .name = CFRetain(source->attributes[i].name),
+            .value = CFRetain(source->attributes[i].value),
+        };
+    }
+    destination->count = destination->capacity = source->count;
+    if (source->index) {
+        destination->index = CFDictionaryCreateMutableCopy(NULL, 0, source->index);
+    }
+}
+
+BOOL HTMLAttributeStorageEqual(const HTMLAttributeStorage *storage, const HTMLAttributeStorage *other)
+{
+    if (storage->count != other->count) return NO;
+    for (uint32_t i = 0; i < storage->count; i++) {
+        HTMLAttribute attribute = storage->attributes[i];
+        NSUInteger j = HTMLAttributeStorageIndexOfName(other, (__bridge id)attribute.name);
+        if (j == NSNotFound) return NO;
+        CFTypeRef otherValue = other->attributes[j].value;
+        if (otherValue != attribute.value && !CFEqual(otherValue, attribute.value)) return NO;
+    }
+    return YES;
+}
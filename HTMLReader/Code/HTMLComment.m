@@ -3,6 +3,7 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLComment.h"
+#import "HTMLNode+Private.h"
 
 @implementation HTMLComment
 
@@ -29,6 +30,13 @@
     self.data = textContent;
 }
 
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally
+{
+    [super addToMemoryTally:tally];
+    tally->numberOfComments++;
+    tally->textBytes += HTMLEstimatedStringSize(_data);
+}
+
 #pragma mark NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
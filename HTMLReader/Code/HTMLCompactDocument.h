@@ -0,0 +1,90 @@
+//  HTMLCompactDocument.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+#import "HTMLDocument.h"
+@class HTMLSelector;
+
+/**
+    An HTMLCompactDocument is a read-only copy of a document that stores its nodes in a few contiguous arrays instead of as one object per node.
+ 
+    Nodes are identified by their index in the arrays. The document node is at index 0, and each node's children have consecutive indexes. Tag and attribute names are stored once per document, and all text lives in a single buffer.
+ 
+    HTMLNode objects are only created when asked for, and are discarded when no longer in use. They are read-only, and attempting to change one throws an exception. Use -document for a regular, mutable copy of the whole tree.
+ */
+@interface HTMLCompactDocument : NSObject
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes a compact copy of a document. The original document is not retained.
+- (instancetype)initWithDocument:(HTMLDocument *)document NS_DESIGNATED_INITIALIZER;
+
+/**
+    Parses data of an unknown string encoding into a compact document. The parsed nodes are discarded once copied.
+ 
+    Parsing builds a regular document first, so the peak memory use is that of a regular parse plus the compact copy. The savings come afterwards.
+ 
+    @param contentType The value of the HTTP Content-Type header, if present.
+ */
++ (instancetype)compactDocumentWithData:(NSData *)data contentTypeHeader:(NSString *)contentType;
+
+/// Parses an HTML string into a compact document. The parsed nodes are discarded once copied. As with +compactDocumentWithData:contentTypeHeader:, a regular document is built first.
++ (instancetype)compactDocumentWithString:(NSString *)string;
+
+/// The number of nodes in the document, including the document node itself.
+@property (readonly, assign, nonatomic) NSUInteger numberOfNodes;
+
+/// The number of bytes used to store the document's nodes, names, and text.
+@property (readonly, assign, nonatomic) NSUInteger storageSize;
+
+/// The document's quirks mode.
+@property (readonly, assign, nonatomic) HTMLQuirksMode quirksMode;
+
+/// A read-only HTMLDocument for the document node.
+@property (readonly, strong, nonatomic) HTMLDocument *documentNode;
+
+/**
+    Returns a read-only node. Throws an NSRangeException if index is out of bounds.
+ 
+    The same object is returned for as long as it is in use elsewhere.
+ */
+- (HTMLNode *)nodeAtIndex:(NSUInteger)index;
+
+/// Returns the index of a node returned by this document, or NSNotFound if the node belongs elsewhere.
+- (NSUInteger)indexOfNode:(HTMLNode *)node;
+
+/// Returns the index of a node's parent, or NSNotFound for the document node.
+- (NSUInteger)parentIndexOfNodeAtIndex:(NSUInteger)index;
+
+/// Returns the tag name of an element, or nil if the node is not an element.
+- (NSString *)tagNameOfNodeAtIndex:(NSUInteger)index;
+
+/// Returns the value of an element's attribute, or nil if the node has no such attribute.
+- (NSString *)valueOfAttribute:(NSString *)attributeName ofNodeAtIndex:(NSUInteger)index;
+
+/// Returns the combined text of a node and its descendants without creating any node objects.
+- (NSString *)textContentOfNodeAtIndex:(NSUInteger)index;
+
+/// The combined text of every node in the document.
+@property (readonly, copy, nonatomic) NSString *textContent;
+
+/// Returns the elements matched by selectorString, in tree order. See -nodesMatchingParsedSelector: for the cost.
+- (NSArray *)nodesMatchingSelector:(NSString *)selectorString;
+
+/**
+    Returns the elements matched by selector, in tree order.
+ 
+    The selector's tag, ID, class, and attribute tests of each element are run against the document's arrays. Elements that pass them get a read-only node so the rest of the selector can be matched, as do any ancestors or siblings that the rest of the selector looks at, and these nodes are kept until matching is done. Selectors that only use pseudo-classes on the matched element (like `:not(p)` or `*`) create a node for every element.
+ */
+- (NSArray *)nodesMatchingParsedSelector:(HTMLSelector *)selector;
+
+/**
+    Returns a new, mutable HTMLDocument with the same contents.
+ 
+    Each call returns a separate copy.
+ */
+- (HTMLDocument *)document;
+
+@end
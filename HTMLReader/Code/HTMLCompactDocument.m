@@ -0,0 +1,813 @@
+//  HTMLCompactDocument.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLCompactDocument.h"
+#import "HTMLComment.h"
+#import "HTMLNode+Private.h"
+#import "HTMLOrderedDictionary.h"
+#import "HTMLSelector+Private.h"
+#import "HTMLTextNode.h"
+
+typedef NS_ENUM(uint8_t, CompactNodeKind)
+{
+    CompactDocumentKind,
+    CompactDocumentTypeKind,
+    CompactElementKind,
+    CompactTextKind,
+    CompactCommentKind,
+};
+
+// Marks a missing parent or name.
+static const uint32_t NoIndex = UINT32_MAX;
+
+// A range of characters in the document's character buffer.
+typedef struct {
+    uint32_t location;
+    uint32_t length;
+} TextRange;
+
+typedef struct {
+    uint32_t parent;
+    uint32_t firstChild;
+    uint32_t numberOfChildren;
+    
+    // Index into the string table of an element's tag name or a document type's name.
+    uint32_t name;
+    
+    uint32_t firstAttribute;
+    uint32_t numberOfAttributes;
+    
+    // Text and comment data.
+    TextRange data;
+    
+    CompactNodeKind kind;
+    uint8_t htmlNamespace;
+} CompactNode;
+
+// A document type's public and system identifiers are stored as its first and second attributes, which have no name.
+typedef struct {
+    uint32_t name;
+    TextRange value;
+} CompactAttribute;
+
+/// Implemented by the read-only nodes handed out by an HTMLCompactDocument.
+@protocol HTMLCompactNode <NSObject>
+
+@property (readonly, strong, nonatomic) HTMLCompactDocument *compactDocument;
+
+@property (readonly, assign, nonatomic) NSUInteger compactIndex;
+
+@end
+
+@interface HTMLCompactDocument ()
+
+- (HTMLNode *)parentOfNodeAtIndex:(NSUInteger)index;
+- (NSUInteger)numberOfChildrenOfNodeAtIndex:(NSUInteger)index;
+- (HTMLNode *)childAtIndex:(NSUInteger)childIndex ofNodeAtIndex:(NSUInteger)index;
+- (NSUInteger)indexOfChild:(HTMLNode *)child ofNodeAtIndex:(NSUInteger)index;
+- (NSArray *)childrenOfNodeAtIndex:(NSUInteger)index elementsOnly:(BOOL)elementsOnly;
+- (HTMLNamespace)namespaceOfNodeAtIndex:(NSUInteger)index;
+- (NSString *)nameOfNodeAtIndex:(NSUInteger)index;
+- (NSString *)dataOfNodeAtIndex:(NSUInteger)index;
+- (NSDictionary *)attributesOfNodeAtIndex:(NSUInteger)index;
+- (NSString *)valueOfAttributeAtIndex:(NSUInteger)attributeIndex ofNodeAtIndex:(NSUInteger)index;
+- (HTMLNode *)regularNodeAtIndex:(NSUInteger)index;
+
+@end
+
+static void RaiseReadOnly(id node)
+{
+    [NSException raise:NSInternalInconsistencyException format:@"%@ belongs to an HTMLCompactDocument and cannot be changed", NSStringFromClass([node class])];
+}
+
+// The tree accessors shared by every kind of read-only node. Each class using these methods has the ivars _compactDocument and _index.
+#define HTMLCompactNodeMethods \
+    - (HTMLCompactDocument *)compactDocument { return _compactDocument; } \
+    - (NSUInteger)compactIndex { return _index; } \
+    - (HTMLNode *)parentNode { return [_compactDocument parentOfNodeAtIndex:_index]; } \
+    - (void)setParentNode:(HTMLNode *)parentNode { RaiseReadOnly(self); } \
+    - (NSOrderedSet *)children { return [NSOrderedSet orderedSetWithArray:[_compactDocument childrenOfNodeAtIndex:_index elementsOnly:NO]]; } \
+    - (NSMutableOrderedSet *)mutableChildren { RaiseReadOnly(self); return nil; } \
+    - (void)removeFromParentNode { RaiseReadOnly(self); } \
+    - (void)insertChild:(HTMLNode *)child atIndex:(NSUInteger)childIndex { RaiseReadOnly(self); } \
+    - (void)addChild:(HTMLNode *)child { RaiseReadOnly(self); } \
+    - (void)removeChild:(HTMLNode *)child { RaiseReadOnly(self); } \
+    - (void)addChildrenOfNode:(HTMLNode *)node { RaiseReadOnly(self); } \
+    - (NSUInteger)numberOfChildren { return [_compactDocument numberOfChildrenOfNodeAtIndex:_index]; } \
+    - (HTMLNode *)childAtIndex:(NSUInteger)childIndex { return [_compactDocument childAtIndex:childIndex ofNodeAtIndex:_index]; } \
+    - (NSUInteger)indexOfChild:(HTMLNode *)child { return [_compactDocument indexOfChild:child ofNodeAtIndex:_index]; } \
+    - (NSArray *)childElementNodes { return [_compactDocument childrenOfNodeAtIndex:_index elementsOnly:YES]; } \
+    - (void)insertString:(NSString *)string atChildNodeIndex:(NSUInteger)childNodeIndex { RaiseReadOnly(self); } \
+    - (void)setTextContent:(NSString *)textContent { RaiseReadOnly(self); } \
+    - (id)copyWithZone:(NSZone *)zone { return [_compactDocument regularNodeAtIndex:_index]; }
+
+#pragma mark - Read-only nodes
+
+@interface HTMLCompactDocumentNode : HTMLDocument <HTMLCompactNode>
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index;
+
+@end
+
+@implementation HTMLCompactDocumentNode
+{
+    HTMLCompactDocument *_compactDocument;
+    NSUInteger _index;
+}
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index
+{
+    if ((self = [super init])) {
+        _compactDocument = compactDocument;
+        _index = index;
+    }
+    return self;
+}
+
+HTMLCompactNodeMethods
+
+- (HTMLQuirksMode)quirksMode
+{
+    return _compactDocument.quirksMode;
+}
+
+- (void)setQuirksMode:(HTMLQuirksMode)quirksMode
+{
+    RaiseReadOnly(self);
+}
+
+- (NSString *)textContent
+{
+    return [_compactDocument textContentOfNodeAtIndex:_index];
+}
+
+@end
+
+@interface HTMLCompactDocumentType : HTMLDocumentType <HTMLCompactNode>
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index;
+
+@end
+
+@implementation HTMLCompactDocumentType
+{
+    HTMLCompactDocument *_compactDocument;
+    NSUInteger _index;
+}
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index
+{
+    if ((self = [super initWithName:nil publicIdentifier:nil systemIdentifier:nil])) {
+        _compactDocument = compactDocument;
+        _index = index;
+    }
+    return self;
+}
+
+HTMLCompactNodeMethods
+
+- (NSString *)name
+{
+    return [_compactDocument nameOfNodeAtIndex:_index];
+}
+
+- (NSString *)publicIdentifier
+{
+    return [_compactDocument valueOfAttributeAtIndex:0 ofNodeAtIndex:_index];
+}
+
+- (NSString *)systemIdentifier
+{
+    return [_compactDocument valueOfAttributeAtIndex:1 ofNodeAtIndex:_index];
+}
+
+@end
+
+@interface HTMLCompactElement : HTMLElement <HTMLCompactNode>
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index;
+
+@end
+
+@implementation HTMLCompactElement
+{
+    HTMLCompactDocument *_compactDocument;
+    NSUInteger _index;
+}
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index
+{
+    if ((self = [super initWithTagName:nil attributes:nil])) {
+        _compactDocument = compactDocument;
+        _index = index;
+    }
+    return self;
+}
+
+HTMLCompactNodeMethods
+
+- (NSString *)tagName
+{
+    return [_compactDocument nameOfNodeAtIndex:_index];
+}
+
+- (NSDictionary *)attributes
+{
+    return [_compactDocument attributesOfNodeAtIndex:_index];
+}
+
+- (id)objectForKeyedSubscript:(id)attributeName
+{
+    return [_compactDocument valueOfAttribute:attributeName ofNodeAtIndex:_index];
+}
+
+- (void)setObject:(NSString *)attributeValue forKeyedSubscript:(NSString *)attributeName
+{
+    RaiseReadOnly(self);
+}
+
+- (void)removeAttributeWithName:(NSString *)attributeName
+{
+    RaiseReadOnly(self);
+}
+
+- (void)toggleClass:(NSString *)className
+{
+    RaiseReadOnly(self);
+}
+
+- (HTMLNamespace)htmlNamespace
+{
+    return [_compactDocument namespaceOfNodeAtIndex:_index];
+}
+
+- (void)setHtmlNamespace:(HTMLNamespace)htmlNamespace
+{
+    RaiseReadOnly(self);
+}
+
+- (NSString *)textContent
+{
+    return [_compactDocument textContentOfNodeAtIndex:_index];
+}
+
+@end
+
+@interface HTMLCompactTextNode : HTMLTextNode <HTMLCompactNode>
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index;
+
+@end
+
+@implementation HTMLCompactTextNode
+{
+    HTMLCompactDocument *_compactDocument;
+    NSUInteger _index;
+}
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index
+{
+    if ((self = [super initWithData:@""])) {
+        _compactDocument = compactDocument;
+        _index = index;
+    }
+    return self;
+}
+
+HTMLCompactNodeMethods
+
+- (NSString *)data
+{
+    return [_compactDocument dataOfNodeAtIndex:_index];
+}
+
+- (NSString *)uncopiedData
+{
+    return self.data;
+}
+
+- (void)appendString:(NSString *)string
+{
+    RaiseReadOnly(self);
+}
+
+- (NSString *)textContent
+{
+    return self.data;
+}
+
+@end
+
+@interface HTMLCompactComment : HTMLComment <HTMLCompactNode>
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index;
+
+@end
+
+@implementation HTMLCompactComment
+{
+    HTMLCompactDocument *_compactDocument;
+    NSUInteger _index;
+}
+
+- (instancetype)initWithCompactDocument:(HTMLCompactDocument *)compactDocument index:(NSUInteger)index
+{
+    if ((self = [super initWithData:nil])) {
+        _compactDocument = compactDocument;
+        _index = index;
+    }
+    return self;
+}
+
+HTMLCompactNodeMethods
+
+- (NSString *)data
+{
+    return [_compactDocument dataOfNodeAtIndex:_index];
+}
+
+- (void)setData:(NSString *)data
+{
+    RaiseReadOnly(self);
+}
+
+@end
+
+#pragma mark - Compact document
+
+static void * ShrinkToFit(void *buffer, size_t size)
+{
+    if (size == 0) {
+        free(buffer);
+        return NULL;
+    }
+    return reallocf(buffer, size);
+}
+
+static NSUInteger GrownCapacity(NSUInteger capacity, NSUInteger required)
+{
+    return MAX(MAX(capacity * 2, required), (NSUInteger)16);
+}
+
+static uint32_t IndexOfString(NSString *string, NSMutableArray *strings, NSMutableDictionary *stringIndexes)
+{
+    if (!string) {
+        return NoIndex;
+    }
+    NSNumber *index = stringIndexes[string];
+    if (!index) {
+        index = @(strings.count);
+        [strings addObject:string];
+        stringIndexes[string] = index;
+    }
+    return index.unsignedIntValue;
+}
+
+@implementation HTMLCompactDocument
+{
+    CompactNode *_nodes;
+    NSUInteger _nodeCapacity;
+    
+    CompactAttribute *_attributes;
+    NSUInteger _numberOfAttributes;
+    NSUInteger _attributeCapacity;
+    
+    unichar *_characters;
+    NSUInteger _numberOfCharacters;
+    NSUInteger _characterCapacity;
+    
+    NSArray *_strings;
+    
+    // Only the nodes in use elsewhere are kept.
+    NSMapTable *_views;
+    
+    // While matching selectors, every node created is kept here so that ancestors and siblings aren't recreated for each element.
+    NSMutableArray *_retainedViews;
+}
+
++ (instancetype)compactDocumentWithData:(NSData *)data contentTypeHeader:(NSString *)contentType
+{
+    HTMLCompactDocument *compactDocument;
+    @autoreleasepool {
+        HTMLDocument *document = [HTMLDocument documentWithData:data contentTypeHeader:contentType];
+        compactDocument = [[self alloc] initWithDocument:document];
+    }
+    return compactDocument;
+}
+
++ (instancetype)compactDocumentWithString:(NSString *)string
+{
+    HTMLCompactDocument *compactDocument;
+    @autoreleasepool {
+        HTMLDocument *document = [HTMLDocument documentWithString:string];
+        compactDocument = [[self alloc] initWithDocument:document];
+    }
+    return compactDocument;
+}
+
+- (instancetype)initWithDocument:(HTMLDocument *)document
+{
+    if ((self = [super init])) {
+        _quirksMode = document.quirksMode;
+        NSMutableArray *strings = [NSMutableArray new];
+        NSMutableDictionary *stringIndexes = [NSMutableDictionary new];
+        
+        // Nodes are laid out breadth-first, so each node's children are next to each other.
+        NSMutableArray *queue = [NSMutableArray arrayWithObject:document];
+        [self reserveNodes:1];
+        _nodes[0].parent = NoIndex;
+        for (NSUInteger i = 0; i < queue.count; i++) {
+            HTMLNode *node = queue[i];
+            [self copyNode:node toIndex:i strings:strings stringIndexes:stringIndexes];
+            
+            NSUInteger numberOfChildren = node.numberOfChildren;
+            [self reserveNodes:queue.count + numberOfChildren];
+            _nodes[i].firstChild = (uint32_t)queue.count;
+            _nodes[i].numberOfChildren = (uint32_t)numberOfChildren;
+            for (NSUInteger j = 0; j < numberOfChildren; j++) {
+                _nodes[queue.count].parent = (uint32_t)i;
+                [queue addObject:[node childAtIndex:j]];
+            }
+        }
+        
+        _numberOfNodes = queue.count;
+        _nodes = ShrinkToFit(_nodes, _numberOfNodes * sizeof(_nodes[0]));
+        _nodeCapacity = _numberOfNodes;
+        _attributes = ShrinkToFit(_attributes, _numberOfAttributes * sizeof(_attributes[0]));
+        _attributeCapacity = _numberOfAttributes;
+        _characters = ShrinkToFit(_characters, _numberOfCharacters * sizeof(_characters[0]));
+        _characterCapacity = _numberOfCharacters;
+        _strings = [strings copy];
+        _views = [NSMapTable strongToWeakObjectsMapTable];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_nodes);
+    free(_attributes);
+    free(_characters);
+}
+
+#pragma mark Building
+
+- (void)reserveNodes:(NSUInteger)count
+{
+    if (count > _nodeCapacity) {
+        _nodeCapacity = GrownCapacity(_nodeCapacity, count);
+        _nodes = reallocf(_nodes, _nodeCapacity * sizeof(_nodes[0]));
+    }
+}
+
+- (void)reserveAttributes:(NSUInteger)count
+{
+    if (count > _attributeCapacity) {
+        _attributeCapacity = GrownCapacity(_attributeCapacity, count);
+        _attributes = reallocf(_attributes, _attributeCapacity * sizeof(_attributes[0]));
+    }
+}
+
+- (TextRange)appendCharactersOfString:(NSString *)string
+{
+    NSUInteger length = string.length;
+    if (_numberOfCharacters + length > _characterCapacity) {
+        _characterCapacity = GrownCapacity(_characterCapacity, _numberOfCharacters + length);
+        _characters = reallocf(_characters, _characterCapacity * sizeof(_characters[0]));
+    }
+    [string getCharacters:_characters + _numberOfCharacters range:NSMakeRange(0, length)];
+    TextRange range = { .location = (uint32_t)_numberOfCharacters, .length = (uint32_t)length };
+    _numberOfCharacters += length;
+    return range;
+}
+
+- (void)copyNode:(HTMLNode *)node toIndex:(NSUInteger)index strings:(NSMutableArray *)strings stringIndexes:(NSMutableDictionary *)stringIndexes
+{
+    CompactNode *compact = &_nodes[index];
+    compact->name = NoIndex;
+    compact->firstAttribute = (uint32_t)_numberOfAttributes;
+    compact->numberOfAttributes = 0;
+    compact->data = (TextRange){ 0, 0 };
+    compact->htmlNamespace = HTMLNamespaceHTML;
+    
+    if ([node isKindOfClass:[HTMLElement class]]) {
+        HTMLElement *element = (HTMLElement *)node;
+        compact->kind = CompactElementKind;
+        compact->name = IndexOfString(element.tagName, strings, stringIndexes);
+        compact->htmlNamespace = (uint8_t)element.htmlNamespace;
+        HTMLElementEnumerateAttributes(element, ^(NSString *name, NSString *value, BOOL *stop) {
+            [self reserveAttributes:_numberOfAttributes + 1];
+            _attributes[_numberOfAttributes] = (CompactAttribute){
+                .name = IndexOfString(name, strings, stringIndexes),
+                .value = [self appendCharactersOfString:value],
+            };
+            _numberOfAttributes++;
+        });
+        compact->numberOfAttributes = (uint32_t)_numberOfAttributes - compact->firstAttribute;
+    } else if ([node isKindOfClass:[HTMLTextNode class]]) {
+        compact->kind = CompactTextKind;
+        compact->data = [self appendCharactersOfString:((HTMLTextNode *)node).data];
+    } else if ([node isKindOfClass:[HTMLComment class]]) {
+        compact->kind = CompactCommentKind;
+        compact->data = [self appendCharactersOfString:((HTMLComment *)node).data];
+    } else if ([node isKindOfClass:[HTMLDocumentType class]]) {
+        HTMLDocumentType *doctype = (HTMLDocumentType *)node;
+        compact->kind = CompactDocumentTypeKind;
+        compact->name = IndexOfString(doctype.name, strings, stringIndexes);
+        [self reserveAttributes:_numberOfAttributes + 2];
+        _attributes[_numberOfAttributes++] = (CompactAttribute){ .name = NoIndex, .value = [self appendCharactersOfString:doctype.publicIdentifier] };
+        _attributes[_numberOfAttributes++] = (CompactAttribute){ .name = NoIndex, .value = [self appendCharactersOfString:doctype.systemIdentifier] };
+        compact->numberOfAttributes = 2;
+    } else {
+        NSAssert([node isKindOfClass:[HTMLDocument class]], @"unexpected node %@", node);
+        compact->kind = CompactDocumentKind;
+    }
+}
+
+#pragma mark Nodes
+
+- (HTMLDocument *)documentNode
+{
+    return (HTMLDocument *)[self nodeAtIndex:0];
+}
+
+- (HTMLNode *)nodeAtIndex:(NSUInteger)index
+{
+    if (index >= _numberOfNodes) {
+        [NSException raise:NSRangeException format:@"index %lu beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_numberOfNodes - 1];
+    }
+    NSNumber *key = @(index);
+    HTMLNode *node = [_views objectForKey:key];
+    if (!node) {
+        switch (_nodes[index].kind) {
+            case CompactDocumentKind:
+                node = [[HTMLCompactDocumentNode alloc] initWithCompactDocument:self index:index];
+                break;
+            
+            case CompactDocumentTypeKind:
+                node = [[HTMLCompactDocumentType alloc] initWithCompactDocument:self index:index];
+                break;
+            
+            case CompactElementKind:
+                node = [[HTMLCompactElement alloc] initWithCompactDocument:self index:index];
+                break;
+            
+            case CompactTextKind:
+                node = [[HTMLCompactTextNode alloc] initWithCompactDocument:self index:index];
+                break;
+            
+            case CompactCommentKind:
+                node = [[HTMLCompactComment alloc] initWithCompactDocument:self index:index];
+                break;
+        }
+        [_views setObject:node forKey:key];
+        [_retainedViews addObject:node];
+    }
+    return node;
+}
+
+- (NSUInteger)indexOfNode:(HTMLNode *)node
+{
+    if ([node conformsToProtocol:@protocol(HTMLCompactNode)]) {
+        id <HTMLCompactNode> compactNode = (id <HTMLCompactNode>)node;
+        if (compactNode.compactDocument == self) {
+            return compactNode.compactIndex;
+        }
+    }
+    return NSNotFound;
+}
+
+- (NSUInteger)parentIndexOfNodeAtIndex:(NSUInteger)index
+{
+    NSParameterAssert(index < _numberOfNodes);
+    uint32_t parent = _nodes[index].parent;
+    return parent == NoIndex ? NSNotFound : parent;
+}
+
+- (HTMLNode *)parentOfNodeAtIndex:(NSUInteger)index
+{
+    uint32_t parent = _nodes[index].parent;
+    return parent == NoIndex ? nil : [self nodeAtIndex:parent];
+}
+
+- (NSUInteger)numberOfChildrenOfNodeAtIndex:(NSUInteger)index
+{
+    return _nodes[index].numberOfChildren;
+}
+
+- (HTMLNode *)childAtIndex:(NSUInteger)childIndex ofNodeAtIndex:(NSUInteger)index
+{
+    if (childIndex >= _nodes[index].numberOfChildren) {
+        [NSException raise:NSRangeException format:@"child index %lu beyond bounds for node with %lu children", (unsigned long)childIndex, (unsigned long)_nodes[index].numberOfChildren];
+    }
+    return [self nodeAtIndex:_nodes[index].firstChild + childIndex];
+}
+
+- (NSUInteger)indexOfChild:(HTMLNode *)child ofNodeAtIndex:(NSUInteger)index
+{
+    NSUInteger childIndex = [self indexOfNode:child];
+    if (childIndex == NSNotFound || _nodes[childIndex].parent != index) {
+        return NSNotFound;
+    }
+    return childIndex - _nodes[index].firstChild;
+}
+
+- (NSArray *)childrenOfNodeAtIndex:(NSUInteger)index elementsOnly:(BOOL)elementsOnly
+{
+    CompactNode node = _nodes[index];
+    NSMutableArray *children = [NSMutableArray arrayWithCapacity:node.numberOfChildren];
+    for (uint32_t i = node.firstChild, end = node.firstChild + node.numberOfChildren; i < end; i++) {
+        if (!elementsOnly || _nodes[i].kind == CompactElementKind) {
+            [children addObject:[self nodeAtIndex:i]];
+        }
+    }
+    return children;
+}
+
+- (HTMLNamespace)namespaceOfNodeAtIndex:(NSUInteger)index
+{
+    return (HTMLNamespace)_nodes[index].htmlNamespace;
+}
+
+- (NSString *)nameOfNodeAtIndex:(NSUInteger)index
+{
+    uint32_t name = _nodes[index].name;
+    return name == NoIndex ? nil : _strings[name];
+}
+
+- (NSString *)tagNameOfNodeAtIndex:(NSUInteger)index
+{
+    NSParameterAssert(index < _numberOfNodes);
+    return _nodes[index].kind == CompactElementKind ? [self nameOfNodeAtIndex:index] : nil;
+}
+
+- (NSString *)stringWithRange:(TextRange)range
+{
+    return [[NSString alloc] initWithCharacters:_characters + range.location length:range.length];
+}
+
+- (NSString *)dataOfNodeAtIndex:(NSUInteger)index
+{
+    return [self stringWithRange:_nodes[index].data];
+}
+
+- (NSDictionary *)attributesOfNodeAtIndex:(NSUInteger)index
+{
+    CompactNode node = _nodes[index];
+    HTMLOrderedDictionary *attributes = [[HTMLOrderedDictionary alloc] initWithCapacity:node.numberOfAttributes];
+    for (uint32_t i = node.firstAttribute, end = node.firstAttribute + node.numberOfAttributes; i < end; i++) {
+        attributes[_strings[_attributes[i].name]] = [self stringWithRange:_attributes[i].value];
+    }
+    return attributes;
+}
+
+- (NSString *)valueOfAttributeAtIndex:(NSUInteger)attributeIndex ofNodeAtIndex:(NSUInteger)index
+{
+    return [self stringWithRange:_attributes[_nodes[index].firstAttribute + attributeIndex].value];
+}
+
+- (NSString *)valueOfAttribute:(NSString *)attributeName ofNodeAtIndex:(NSUInteger)index
+{
+    NSParameterAssert(index < _numberOfNodes);
+    CompactNode node = _nodes[index];
+    if (node.kind != CompactElementKind) {
+        return nil;
+    }
+    for (uint32_t i = node.firstAttribute, end = node.firstAttribute + node.numberOfAttributes; i < end; i++) {
+        NSString *name = _strings[_attributes[i].name];
+        if (name == attributeName || [name isEqualToString:attributeName]) {
+            return [self stringWithRange:_attributes[i].value];
+        }
+    }
+    return nil;
+}
+
+- (HTMLNode *)regularNodeAtIndex:(NSUInteger)index
+{
+    switch (_nodes[index].kind) {
+        case CompactDocumentKind: {
+            HTMLDocument *document = [HTMLDocument new];
+            document.quirksMode = _quirksMode;
+            return document;
+        }
+        
+        case CompactDocumentTypeKind:
+            return [[HTMLDocumentType alloc] initWithName:[self nameOfNodeAtIndex:index]
+                                         publicIdentifier:[self valueOfAttributeAtIndex:0 ofNodeAtIndex:index]
+                                         systemIdentifier:[self valueOfAttributeAtIndex:1 ofNodeAtIndex:index]];
+        
+        case CompactElementKind: {
+            HTMLElement *element = [[HTMLElement alloc] initWithTagName:[self nameOfNodeAtIndex:index] attributes:[self attributesOfNodeAtIndex:index]];
+            element.htmlNamespace = [self namespaceOfNodeAtIndex:index];
+            return element;
+        }
+        
+        case CompactTextKind:
+            return [[HTMLTextNode alloc] initWithData:[self dataOfNodeAtIndex:index]];
+        
+        case CompactCommentKind:
+            return [[HTMLComment alloc] initWithData:[self dataOfNodeAtIndex:index]];
+    }
+    return nil;
+}
+
+- (HTMLDocument *)document
+{
+    // Parents always come before their children, so each node's parent has already been created.
+    NSMutableArray *nodes = [NSMutableArray arrayWithCapacity:_numberOfNodes];
+    for (NSUInteger i = 0; i < _numberOfNodes; i++) {
+        HTMLNode *node = [self regularNodeAtIndex:i];
+        if (i > 0) {
+            HTMLNode *parent = nodes[_nodes[i].parent];
+            [parent addChild:node];
+        }
+        [nodes addObject:node];
+    }
+    return nodes.firstObject;
+}
+
+- (NSUInteger)storageSize
+{
+    NSUInteger size = _nodeCapacity * sizeof(_nodes[0]) + _attributeCapacity * sizeof(_attributes[0]) + _characterCapacity * sizeof(_characters[0]);
+    for (NSString *string in _strings) {
+        size += string.length * sizeof(unichar);
+    }
+    return size;
+}
+
+#pragma mark Traversal
+
+// Calls block with each node in the subtree rooted at index, in tree order.
+- (void)enumerateSubtreeOfNodeAtIndex:(NSUInteger)index usingBlock:(void (^)(uint32_t i))block
+{
+    NSUInteger capacity = 64;
+    NSUInteger count = 0;
+    uint32_t *stack = malloc(capacity * sizeof(*stack));
+    stack[count++] = (uint32_t)index;
+    while (count > 0) {
+        uint32_t i = stack[--count];
+        block(i);
+        uint32_t numberOfChildren = _nodes[i].numberOfChildren;
+        if (count + numberOfChildren > capacity) {
+            capacity = GrownCapacity(capacity, count + numberOfChildren);
+            stack = reallocf(stack, capacity * sizeof(*stack));
+        }
+        for (uint32_t j = numberOfChildren; j > 0; j--) {
+            stack[count++] = _nodes[i].firstChild + j - 1;
+        }
+    }
+    free(stack);
+}
+
+- (NSString *)textContentOfNodeAtIndex:(NSUInteger)index
+{
+    NSParameterAssert(index < _numberOfNodes);
+    if (_nodes[index].kind == CompactCommentKind) {
+        return [self dataOfNodeAtIndex:index];
+    }
+    NSMutableString *textContent = [NSMutableString new];
+    [self enumerateSubtreeOfNodeAtIndex:index usingBlock:^(uint32_t i) {
+        if (_nodes[i].kind == CompactTextKind) {
+            CFStringAppendCharacters((__bridge CFMutableStringRef)textContent, _characters + _nodes[i].data.location, _nodes[i].data.length);
+        }
+    }];
+    return textContent;
+}
+
+- (NSString *)textContent
+{
+    return [self textContentOfNodeAtIndex:0];
+}
+
+- (NSArray *)nodesMatchingSelector:(NSString *)selectorString
+{
+    return [self nodesMatchingParsedSelector:[HTMLSelector cachedSelectorForString:selectorString]];
+}
+
+- (NSArray *)nodesMatchingParsedSelector:(HTMLSelector *)selector
+{
+    NSAssert(!selector.error, @"Attempted to use selector with error: %@", selector.error);
+    
+    // The selector's tests of the element itself are run against the arrays. Only elements that pass them get a node, since the rest of the selector only knows how to match HTMLElement objects.
+    NSMutableArray *matches = [NSMutableArray new];
+    _retainedViews = [NSMutableArray new];
+    __block NSUInteger index;
+    NSString * (^attributeValue)(NSString *) = ^(NSString *attributeName) {
+        return [self valueOfAttribute:attributeName ofNodeAtIndex:index];
+    };
+    [self enumerateSubtreeOfNodeAtIndex:0 usingBlock:^(uint32_t i) {
+        if (_nodes[i].kind == CompactElementKind) {
+            index = i;
+            if (![selector mightMatchElementWithTagName:_strings[_nodes[i].name] attributeValue:attributeValue]) return;
+            HTMLElement *element = (HTMLElement *)[self nodeAtIndex:i];
+            if ([selector matchesElement:element]) {
+                [matches addObject:element];
+            }
+        }
+    }];
+    _retainedViews = nil;
+    return matches;
+}
+
+@end
@@ -0,0 +1,33 @@
+//  HTMLDocument+Private.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLDocument.h"
+
+/**
+    A document can keep an index of its elements by ID, class, and tag name, so that selectors can look up candidates instead of walking the whole tree.
+ 
+    The index is built the first time it's needed, and thrown out whenever the document changes (see HTMLDocumentNodeDidChange).
+ */
+@interface HTMLDocument (Private)
+
+/// The elements with the ID, in tree order, or nil if there are none.
+- (NSArray *)indexedElementsWithID:(NSString *)elementID;
+
+/// The elements with the class, in tree order, or nil if there are none.
+- (NSArray *)indexedElementsWithClassName:(NSString *)className;
+
+/// The elements with the tag name, compared case-insensitively, in tree order, or nil if there are none.
+- (NSArray *)indexedElementsWithTagName:(NSString *)tagName;
+
+@end
+
+@interface HTMLElement (Private)
+
+/// The names in the class attribute, in order. Parsed the first time it's needed and again after the attribute changes.
+@property (readonly, copy, nonatomic) NSArray *classNames;
+
+@end
+
+/// Tells the node's document, if there is one, that the node's children, ID, or classes have changed. Cheap for nodes that have never been in a document with an index.
+extern void HTMLDocumentNodeDidChange(HTMLNode *node);
@@ -12,6 +12,8 @@
 /**
     An HTMLDocument is the root of a tree of nodes representing parsed HTML.
  
+    Different documents can be parsed and used on different threads at the same time. The parser shares nothing between documents except constant tables, and the selector cache has its own lock. A single document, along with its nodes, must only be used by one thread at a time, even when only reading it, as reads can fill in caches such as the index used to match selectors.
+ 
     For more information, see http://www.whatwg.org/specs/web-apps/current-work/multipage/syntax.html#writing
  */
 @interface HTMLDocument : HTMLNode
@@ -30,6 +32,18 @@
  */
 - (instancetype)initWithData:(NSData *)data contentTypeHeader:(NSString *)contentType;
 
+/**
+    Parses several pieces of data into documents, in parallel.
+ 
+    The documents are parsed on a global dispatch queue, which uses roughly one thread per active processor. Returns once every document is parsed.
+ 
+    @param dataArray An array of NSData.
+    @param contentTypes An array the same length as dataArray, with each data's HTTP Content-Type header (or NSNull if there is none). Can be nil.
+ 
+    @return An array of documents, in the same order as dataArray.
+ */
++ (NSArray *)documentsWithDataArray:(NSArray *)dataArray contentTypes:(NSArray *)contentTypes;
+
 /// Parses an HTML string into a document.
 + (instancetype)documentWithString:(NSString *)string;
 
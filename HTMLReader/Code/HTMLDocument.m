@@ -2,14 +2,33 @@
 //
 //  Public domain. https://github.com/nolanw/HTMLReader
 
-#import "HTMLDocument.h"
+#import "HTMLDocument+Private.h"
+#import "HTMLNode+Private.h"
 #import "HTMLParser.h"
 
+/// An HTMLDocumentIndex maps IDs, class names, and lowercase tag names to elements in tree order.
+@interface HTMLDocumentIndex : NSObject
+
+- (instancetype)initWithDocument:(HTMLDocument *)document NS_DESIGNATED_INITIALIZER;
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (readonly, strong, nonatomic) NSDictionary *elementsByID;
+@property (readonly, strong, nonatomic) NSDictionary *elementsByClassName;
+@property (readonly, strong, nonatomic) NSDictionary *elementsByTagName;
+
+@end
+
 @implementation HTMLDocument
+{
+    HTMLDocumentIndex *_elementIndex;
+}
 
 + (instancetype)documentWithData:(NSData *)data contentTypeHeader:(NSString *)contentType
 {
-    HTMLParser *parser = ParserWithDataAndContentType(data, contentType);
+    // Nobody gets to see the parser, so there's no point keeping track of its errors.
+    HTMLParser *parser = ParserWithDataContentTypeAndErrorReporting(data, contentType, HTMLParseErrorReportingOff);
     return parser.document;
 }
 
@@ -18,6 +37,30 @@
     return [self.class documentWithData:data contentTypeHeader:contentType];
 }
 
++ (NSArray *)documentsWithDataArray:(NSArray *)dataArray contentTypes:(NSArray *)contentTypes
+{
+    NSParameterAssert(!contentTypes || contentTypes.count == dataArray.count);
+    
+    NSUInteger count = dataArray.count;
+    
+    // Each document is retained into its own slot, so no locking is needed.
+    void **documents = calloc(count, sizeof(*documents));
+    dispatch_apply(count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) { @autoreleasepool {
+        NSString *contentType = contentTypes[i];
+        if ((id)contentType == [NSNull null]) {
+            contentType = nil;
+        }
+        documents[i] = (void *)CFBridgingRetain([self documentWithData:dataArray[i] contentTypeHeader:contentType]);
+    }});
+    
+    NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [result addObject:CFBridgingRelease(documents[i])];
+    }
+    free(documents);
+    return result;
+}
+
 + (instancetype)documentWithString:(NSString *)string
 {
     HTMLStringEncoding defaultEncoding = (HTMLStringEncoding){
@@ -25,6 +68,7 @@
         .confidence = Tentative
     };
     HTMLParser *parser = [[HTMLParser alloc] initWithString:string encoding:defaultEncoding context:nil];
+    parser.errorReporting = HTMLParseErrorReportingOff;
     return parser.document;
 }
 
@@ -75,6 +119,65 @@
     }
 }
 
+#pragma mark Index
+
+- (HTMLDocumentIndex *)elementIndex
+{
+    if (!_elementIndex) {
+        _elementIndex = [[HTMLDocumentIndex alloc] initWithDocument:self];
+    }
+    return _elementIndex;
+}
+
+- (NSArray *)indexedElementsWithID:(NSString *)elementID
+{
+    return self.elementIndex.elementsByID[elementID];
+}
+
+- (NSArray *)indexedElementsWithClassName:(NSString *)className
+{
+    return self.elementIndex.elementsByClassName[className];
+}
+
+- (NSArray *)indexedElementsWithTagName:(NSString *)tagName
+{
+    return self.elementIndex.elementsByTagName[tagName.lowercaseString];
+}
+
+static NSUInteger EstimatedIndexSize(NSDictionary *elementsByKey)
+{
+    NSUInteger size = HTMLEstimatedDictionarySize(elementsByKey.count);
+    for (NSArray *elements in elementsByKey.objectEnumerator) {
+        size += HTMLEstimatedArraySize(elements.count);
+    }
+    return size;
+}
+
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally
+{
+    [super addToMemoryTally:tally];
+    if (_elementIndex) {
+        tally->cacheBytes += (HTMLEstimatedObjectSize(_elementIndex)
+                              + EstimatedIndexSize(_elementIndex.elementsByID)
+                              + EstimatedIndexSize(_elementIndex.elementsByClassName)
+                              + EstimatedIndexSize(_elementIndex.elementsByTagName));
+    }
+}
+
+void HTMLDocumentNodeDidChange(HTMLNode *node)
+{
+    // Only nodes that were around when an index was built need to look for their document. Anything added since then has already thrown that index out.
+    if (!HTMLNodeIsMarkedInIndexedDocument(node)) return;
+    
+    HTMLNode *root = node;
+    for (HTMLNode *parent = root.parentNode; parent; parent = parent.parentNode) {
+        root = parent;
+    }
+    if ([root isKindOfClass:[HTMLDocument class]]) {
+        ((HTMLDocument *)root)->_elementIndex = nil;
+    }
+}
+
 static id FirstNodeOfType(id <NSFastEnumeration> collection, Class type)
 {
     for (id node in collection) {
@@ -86,3 +189,78 @@ static id FirstNodeOfType(id <NSFastEnumeration> collection, Class type)
 }
 
 @end
+
+@implementation HTMLDocumentIndex
+
+static void AddElement(NSMutableDictionary *elementsByKey, NSString *key, HTMLElement *element)
+{
+    NSMutableArray *elements = elementsByKey[key];
+    if (elements) {
+        [elements addObject:element];
+    } else {
+        elementsByKey[key] = [NSMutableArray arrayWithObject:element];
+    }
+}
+
+typedef struct {
+    __unsafe_unretained NSMutableDictionary *elementsByID;
+    __unsafe_unretained NSMutableDictionary *elementsByClassName;
+    __unsafe_unretained NSMutableDictionary *elementsByTagName;
+    
+    // Tag names are shared between elements, so each is only lowercased once.
+    __unsafe_unretained NSMapTable *lowercaseTagNames;
+} IndexBuilder;
+
+static HTMLTreeVisitorResult IndexElement(HTMLNode *node, void *context)
+{
+    IndexBuilder *builder = context;
+    HTMLElement *element = (HTMLElement *)node;
+    HTMLNodeMarkInIndexedDocument(element);
+    
+    NSString *tagName = element.tagName;
+    NSString *lowercaseTagName = [builder->lowercaseTagNames objectForKey:tagName];
+    if (!lowercaseTagName) {
+        lowercaseTagName = tagName.lowercaseString;
+        [builder->lowercaseTagNames setObject:lowercaseTagName forKey:tagName];
+    }
+    AddElement(builder->elementsByTagName, lowercaseTagName, element);
+    
+    NSString *elementID = element[@"id"];
+    if (elementID) {
+        AddElement(builder->elementsByID, elementID, element);
+    }
+    
+    for (NSString *className in element.classNames) {
+        AddElement(builder->elementsByClassName, className, element);
+    }
+    return HTMLTreeVisitorContinue;
+}
+
+- (instancetype)initWithDocument:(HTMLDocument *)document
+{
+    if ((self = [super init])) {
+        NSMutableDictionary *elementsByID = [NSMutableDictionary new];
+        NSMutableDictionary *elementsByClassName = [NSMutableDictionary new];
+        NSMutableDictionary *elementsByTagName = [NSMutableDictionary new];
+        NSMapTable *lowercaseTagNames = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                              valueOptions:NSPointerFunctionsStrongMemory];
+        IndexBuilder builder = {
+            .elementsByID = elementsByID,
+            .elementsByClassName = elementsByClassName,
+            .elementsByTagName = elementsByTagName,
+            .lowercaseTagNames = lowercaseTagNames,
+        };
+        HTMLNodeMarkInIndexedDocument(document);
+        HTMLVisitTree(document, YES, IndexElement, &builder);
+        
+        _elementsByID = elementsByID;
+        _elementsByClassName = elementsByClassName;
+        _elementsByTagName = elementsByTagName;
+    }
+    return self;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+@end
@@ -4,6 +4,7 @@
 
 #import "HTMLDocumentType.h"
 #import "HTMLDocument.h"
+#import "HTMLNode+Private.h"
 
 @implementation HTMLDocumentType
 
@@ -22,6 +23,12 @@
     return [self initWithName:nil publicIdentifier:nil systemIdentifier:nil];
 }
 
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally
+{
+    [super addToMemoryTally:tally];
+    tally->nodeBytes += HTMLEstimatedStringSize(_name) + HTMLEstimatedStringSize(_publicIdentifier) + HTMLEstimatedStringSize(_systemIdentifier);
+}
+
 #pragma mark NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
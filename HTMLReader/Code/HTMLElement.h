@@ -36,7 +36,7 @@
 /// Returns the value of the named attribute, or nil if no such value exists.
 - (id)objectForKeyedSubscript:(id)attributeNameOrString;
 
-/// Sets a named attribute's value, adding it to the element if needed.
+/// Sets a named attribute's value, adding it to the element if needed. A nil value removes the attribute, as with -removeAttributeWithName:.
 - (void)setObject:(NSString *)attributeValue forKeyedSubscript:(NSString *)attributeName;
 
 /// Removes the named attribute from the element.
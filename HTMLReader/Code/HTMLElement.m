@@ -2,21 +2,33 @@
 //
 //  Public domain. https://github.com/nolanw/HTMLReader
 
-#import "HTMLElement.h"
+#import "HTMLDocument+Private.h"
+#import "HTMLAtom.h"
+#import "HTMLNode+Private.h"
 #import "HTMLOrderedDictionary.h"
 #import "HTMLSelector.h"
+#import <objc/runtime.h>
 
 @implementation HTMLElement
 {
-    HTMLOrderedDictionary *_attributes;
+    HTMLAttributeStorage _attributes;
+    
+    // nil until it's first needed, and again whenever the class attribute changes.
+    NSArray *_classNames;
 }
 
 - (instancetype)initWithTagName:(NSString *)tagName attributes:(NSDictionary *)attributes
 {
     if ((self = [super init])) {
-        _tagName = [tagName copy];
-        _attributes = [HTMLOrderedDictionary new];
-        [_attributes addEntriesFromDictionary:attributes];
+        _tagName = HTMLKnownAtom(tagName) ?: [tagName copy];
+        if ([attributes isKindOfClass:[HTMLOrderedDictionary class]]) {
+            HTMLAttributeStorageCopy(&_attributes, HTMLOrderedDictionaryStorage((HTMLOrderedDictionary *)attributes));
+        } else if (attributes.count > 0) {
+            HTMLAttributeStorageReserve(&_attributes, attributes.count);
+            for (NSString *name in attributes) {
+                HTMLAttributeStorageAdd(&_attributes, HTMLKnownAtom(name) ?: name, attributes[name]);
+            }
+        }
     }
     return self;
 }
@@ -26,30 +38,105 @@
     return [self initWithTagName:nil attributes:nil];
 }
 
+- (void)dealloc
+{
+    HTMLAttributeStorageFree(&_attributes);
+}
+
 - (NSDictionary *)attributes
 {
-    return [_attributes copy];
+    return _attributes.count > 0 ? HTMLOrderedDictionaryWithStorage(&_attributes) : @{};
 }
 
 - (id)objectForKeyedSubscript:(id)attributeName
 {
-    return _attributes[attributeName];
+    return HTMLAttributeStorageValue(&_attributes, attributeName);
+}
+
+// Subclasses such as HTMLCompactElement keep their attributes elsewhere, so only plain elements have their storage read directly.
+static BOOL UsesOwnAttributeStorage(HTMLElement *element)
+{
+    static Class ElementClass;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        ElementClass = [HTMLElement class];
+    });
+    return object_getClass(element) == ElementClass;
+}
+
+NSString * HTMLElementAttributeValue(HTMLElement *element, NSString *name)
+{
+    if (UsesOwnAttributeStorage(element)) {
+        return HTMLAttributeStorageValue(&element->_attributes, name);
+    } else {
+        return element[name];
+    }
+}
+
+const HTMLAttributeStorage * HTMLElementAttributeStorage(HTMLElement *element)
+{
+    return UsesOwnAttributeStorage(element) ? &element->_attributes : NULL;
+}
+
+void HTMLElementEnumerateAttributes(HTMLElement *element, void (^block)(NSString *name, NSString *value, BOOL *stop))
+{
+    const HTMLAttributeStorage *storage = HTMLElementAttributeStorage(element);
+    if (storage) {
+        BOOL stop = NO;
+        for (uint32_t i = 0; i < storage->count && !stop; i++) {
+            block((__bridge NSString *)storage->attributes[i].name, (__bridge NSString *)storage->attributes[i].value, &stop);
+        }
+    } else {
+        [element.attributes enumerateKeysAndObjectsUsingBlock:block];
+    }
+}
+
+static void AttributeDidChange(HTMLElement *element, NSString *attributeName)
+{
+    if ([attributeName isEqualToString:@"class"]) {
+        element->_classNames = nil;
+        HTMLDocumentNodeDidChange(element);
+    } else if ([attributeName isEqualToString:@"id"]) {
+        HTMLDocumentNodeDidChange(element);
+    }
 }
 
 - (void)setObject:(NSString *)attributeValue forKeyedSubscript:(NSString *)attributeName
 {
-    _attributes[attributeName] = attributeValue;
+    if (!attributeValue) {
+        [self removeAttributeWithName:attributeName];
+        return;
+    }
+    if (!attributeName) [NSException raise:NSInvalidArgumentException format:@"%@ attribute name cannot be nil", NSStringFromSelector(_cmd)];
+    
+    HTMLAttributeStorageInsert(&_attributes, HTMLKnownAtom(attributeName) ?: attributeName, attributeValue, _attributes.count);
+    AttributeDidChange(self, attributeName);
 }
 
 - (void)removeAttributeWithName:(NSString *)attributeName
 {
-    [_attributes removeObjectForKey:attributeName];
+    HTMLAttributeStorageRemove(&_attributes, attributeName);
+    AttributeDidChange(self, attributeName);
+}
+
+- (NSArray *)classNames
+{
+    if (!_classNames) {
+        NSArray *components = [self[@"class"] componentsSeparatedByCharactersInSet:HTMLSelectorWhitespaceCharacterSet()];
+        NSMutableOrderedSet *classNames = [NSMutableOrderedSet orderedSetWithCapacity:components.count];
+        for (NSString *className in components) {
+            if (className.length > 0) {
+                [classNames addObject:className];
+            }
+        }
+        _classNames = [classNames.array copy];
+    }
+    return _classNames;
 }
 
 - (BOOL)hasClass:(NSString *)className
 {
-    NSArray *classes = [self[@"class"] componentsSeparatedByCharactersInSet:HTMLSelectorWhitespaceCharacterSet()];
-    return [classes containsObject:className];
+    return [self.classNames containsObject:className];
 }
 
 - (void)toggleClass:(NSString *)className
@@ -65,13 +152,40 @@
     self[@"class"] = [classes componentsJoinedByString:@" "];
 }
 
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally
+{
+    [super addToMemoryTally:tally];
+    tally->numberOfElements++;
+    if (HTMLKnownAtom(_tagName) != _tagName) {
+        tally->nodeBytes += HTMLEstimatedStringSize(_tagName);
+    }
+    tally->numberOfAttributes += _attributes.count;
+    tally->attributeContainerBytes += HTMLEstimatedBufferSize(_attributes.capacity * sizeof(_attributes.attributes[0]));
+    if (_attributes.index) {
+        tally->attributeContainerBytes += HTMLEstimatedDictionarySize(_attributes.count);
+    }
+    for (uint32_t i = 0; i < _attributes.count; i++) {
+        NSString *name = (__bridge NSString *)_attributes.attributes[i].name;
+        if (HTMLKnownAtom(name) != name) {
+            tally->attributeBytes += HTMLEstimatedStringSize(name);
+        }
+        tally->attributeBytes += HTMLEstimatedStringSize((__bridge NSString *)_attributes.attributes[i].value);
+    }
+    if (_classNames) {
+        tally->cacheBytes += HTMLEstimatedArraySize(_classNames.count);
+        for (NSString *className in _classNames) {
+            tally->cacheBytes += HTMLEstimatedStringSize(className);
+        }
+    }
+}
+
 #pragma mark NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
 {
     HTMLElement *copy = [super copyWithZone:zone];
     copy->_tagName = self.tagName;
-    copy->_attributes = [_attributes copy];
+    HTMLAttributeStorageCopy(&copy->_attributes, &_attributes);
     return copy;
 }
 
@@ -17,12 +17,17 @@ typedef struct {
 /**
     Returns a string encoding that likely encodes the data.
  
+    Before falling back to a default, the first PrescanByteCount bytes are scanned for a <meta> tag that declares the encoding, so that documents labelled that way are decoded correctly the first time.
+ 
     @param contentType The value of the HTTP Content-Type header, if present.
  
     For more information, see https://html.spec.whatwg.org/multipage/syntax.html#determining-the-character-encoding
  */
 extern HTMLStringEncoding DeterminedStringEncodingForData(NSData *data, NSString *contentType);
 
+/// The number of bytes at the start of a document that are scanned for a <meta> tag declaring the document's encoding.
+extern const NSUInteger PrescanByteCount;
+
 /// Returns the string encoding labeled according to the WHATWG Encoding Standard. Returns InvalidStringEncoding() if the label is unknown.
 extern NSStringEncoding StringEncodingForLabel(NSString *label);
 
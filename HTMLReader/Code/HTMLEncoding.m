@@ -5,16 +5,14 @@
 #import "HTMLEncoding.h"
 
 /**
- * Returns the name of an encoding given by a label, as specified in the WHATWG Encoding standard, or nil if the label has no associated name.
+ * Returns the string encoding declared by a <meta> tag found in the bytes, or the result of InvalidStringEncoding() if there is no such tag.
  *
- * For more information, see https://encoding.spec.whatwg.org/#names-and-labels
+ * For more information, see https://html.spec.whatwg.org/multipage/syntax.html#prescan-a-byte-stream-to-determine-its-encoding
  */
-static NSString * NamedEncodingForLabel(NSString *label);
+static NSStringEncoding PrescannedStringEncodingForBytes(const uint8_t *bytes, NSUInteger length);
 
-/**
- * Returns the string encoding given by a name from the WHATWG Encoding Standard, or the result of InvalidStringEncoding() if there is no known encoding given by name.
- */
-static NSStringEncoding StringEncodingForName(NSString *name);
+enum { PrescanLength = 1024 };
+const NSUInteger PrescanByteCount = PrescanLength;
 
 HTMLStringEncoding DeterminedStringEncodingForData(NSData *data, NSString *contentType)
 {
@@ -56,7 +54,13 @@ HTMLStringEncoding DeterminedStringEncodingForData(NSData *data, NSString *conte
         }
     }
     
-    // TODO Prescan?
+    NSStringEncoding prescannedEncoding = PrescannedStringEncodingForBytes(data.bytes, MIN(data.length, PrescanByteCount));
+    if (prescannedEncoding != InvalidStringEncoding()) {
+        return (HTMLStringEncoding){
+            .encoding = prescannedEncoding,
+            .confidence = Tentative
+        };
+    }
     
     // TODO There's a table down in step 9 of https://html.spec.whatwg.org/multipage/syntax.html#documentEncoding that describes default encodings based on the current locale. Maybe implement that.
     
@@ -76,326 +80,553 @@ HTMLStringEncoding DeterminedStringEncodingForData(NSData *data, NSString *conte
 }
 
 typedef struct {
-    __unsafe_unretained NSString *label;
-    __unsafe_unretained NSString *name;
+    const char *label;
+    CFStringEncoding encoding;
 } EncodingLabelMap;
 
-// This array is generated by the Encoding Labeler utility. Please don't make adjustments here.
-static const EncodingLabelMap EncodingLabels[] = {
-    { @"866", @"ibm866" },
-    { @"ansi_x3.4-1968", @"windows-1252" },
-    { @"arabic", @"iso-8859-6" },
-    { @"ascii", @"windows-1252" },
-    { @"asmo-708", @"iso-8859-6" },
-    { @"big5", @"big5" },
-    { @"big5-hkscs", @"big5" },
-    { @"chinese", @"gbk" },
-    { @"cn-big5", @"big5" },
-    { @"cp1250", @"windows-1250" },
-    { @"cp1251", @"windows-1251" },
-    { @"cp1252", @"windows-1252" },
-    { @"cp1253", @"windows-1253" },
-    { @"cp1254", @"windows-1254" },
-    { @"cp1255", @"windows-1255" },
-    { @"cp1256", @"windows-1256" },
-    { @"cp1257", @"windows-1257" },
-    { @"cp1258", @"windows-1258" },
-    { @"cp819", @"windows-1252" },
-    { @"cp866", @"ibm866" },
-    { @"csbig5", @"big5" },
-    { @"cseuckr", @"euc-kr" },
-    { @"cseucpkdfmtjapanese", @"euc-jp" },
-    { @"csgb2312", @"gbk" },
-    { @"csibm866", @"ibm866" },
-    { @"csiso2022jp", @"iso-2022-jp" },
-    { @"csiso2022kr", @"replacement" },
-    { @"csiso58gb231280", @"gbk" },
-    { @"csiso88596e", @"iso-8859-6" },
-    { @"csiso88596i", @"iso-8859-6" },
-    { @"csiso88598e", @"iso-8859-8" },
-    { @"csiso88598i", @"iso-8859-8-i" },
-    { @"csisolatin1", @"windows-1252" },
-    { @"csisolatin2", @"iso-8859-2" },
-    { @"csisolatin3", @"iso-8859-3" },
-    { @"csisolatin4", @"iso-8859-4" },
-    { @"csisolatin5", @"windows-1254" },
-    { @"csisolatin6", @"iso-8859-10" },
-    { @"csisolatin9", @"iso-8859-15" },
-    { @"csisolatinarabic", @"iso-8859-6" },
-    { @"csisolatincyrillic", @"iso-8859-5" },
-    { @"csisolatingreek", @"iso-8859-7" },
-    { @"csisolatinhebrew", @"iso-8859-8" },
-    { @"cskoi8r", @"koi8-r" },
-    { @"csksc56011987", @"euc-kr" },
-    { @"csmacintosh", @"macintosh" },
-    { @"csshiftjis", @"shift_jis" },
-    { @"cyrillic", @"iso-8859-5" },
-    { @"dos-874", @"windows-874" },
-    { @"ecma-114", @"iso-8859-6" },
-    { @"ecma-118", @"iso-8859-7" },
-    { @"elot_928", @"iso-8859-7" },
-    { @"euc-jp", @"euc-jp" },
-    { @"euc-kr", @"euc-kr" },
-    { @"gb18030", @"gb18030" },
-    { @"gb2312", @"gbk" },
-    { @"gb_2312", @"gbk" },
-    { @"gb_2312-80", @"gbk" },
-    { @"gbk", @"gbk" },
-    { @"greek", @"iso-8859-7" },
-    { @"greek8", @"iso-8859-7" },
-    { @"hebrew", @"iso-8859-8" },
-    { @"hz-gb-2312", @"replacement" },
-    { @"ibm819", @"windows-1252" },
-    { @"ibm866", @"ibm866" },
-    { @"iso-2022-cn", @"replacement" },
-    { @"iso-2022-cn-ext", @"replacement" },
-    { @"iso-2022-jp", @"iso-2022-jp" },
-    { @"iso-2022-kr", @"replacement" },
-    { @"iso-8859-1", @"windows-1252" },
-    { @"iso-8859-10", @"iso-8859-10" },
-    { @"iso-8859-11", @"windows-874" },
-    { @"iso-8859-13", @"iso-8859-13" },
-    { @"iso-8859-14", @"iso-8859-14" },
-    { @"iso-8859-15", @"iso-8859-15" },
-    { @"iso-8859-16", @"iso-8859-16" },
-    { @"iso-8859-2", @"iso-8859-2" },
-    { @"iso-8859-3", @"iso-8859-3" },
-    { @"iso-8859-4", @"iso-8859-4" },
-    { @"iso-8859-5", @"iso-8859-5" },
-    { @"iso-8859-6", @"iso-8859-6" },
-    { @"iso-8859-6-e", @"iso-8859-6" },
-    { @"iso-8859-6-i", @"iso-8859-6" },
-    { @"iso-8859-7", @"iso-8859-7" },
-    { @"iso-8859-8", @"iso-8859-8" },
-    { @"iso-8859-8-e", @"iso-8859-8" },
-    { @"iso-8859-8-i", @"iso-8859-8-i" },
-    { @"iso-8859-9", @"windows-1254" },
-    { @"iso-ir-100", @"windows-1252" },
-    { @"iso-ir-101", @"iso-8859-2" },
-    { @"iso-ir-109", @"iso-8859-3" },
-    { @"iso-ir-110", @"iso-8859-4" },
-    { @"iso-ir-126", @"iso-8859-7" },
-    { @"iso-ir-127", @"iso-8859-6" },
-    { @"iso-ir-138", @"iso-8859-8" },
-    { @"iso-ir-144", @"iso-8859-5" },
-    { @"iso-ir-148", @"windows-1254" },
-    { @"iso-ir-149", @"euc-kr" },
-    { @"iso-ir-157", @"iso-8859-10" },
-    { @"iso-ir-58", @"gbk" },
-    { @"iso8859-1", @"windows-1252" },
-    { @"iso8859-10", @"iso-8859-10" },
-    { @"iso8859-11", @"windows-874" },
-    { @"iso8859-13", @"iso-8859-13" },
-    { @"iso8859-14", @"iso-8859-14" },
-    { @"iso8859-15", @"iso-8859-15" },
-    { @"iso8859-2", @"iso-8859-2" },
-    { @"iso8859-3", @"iso-8859-3" },
-    { @"iso8859-4", @"iso-8859-4" },
-    { @"iso8859-5", @"iso-8859-5" },
-    { @"iso8859-6", @"iso-8859-6" },
-    { @"iso8859-7", @"iso-8859-7" },
-    { @"iso8859-8", @"iso-8859-8" },
-    { @"iso8859-9", @"windows-1254" },
-    { @"iso88591", @"windows-1252" },
-    { @"iso885910", @"iso-8859-10" },
-    { @"iso885911", @"windows-874" },
-    { @"iso885913", @"iso-8859-13" },
-    { @"iso885914", @"iso-8859-14" },
-    { @"iso885915", @"iso-8859-15" },
-    { @"iso88592", @"iso-8859-2" },
-    { @"iso88593", @"iso-8859-3" },
-    { @"iso88594", @"iso-8859-4" },
-    { @"iso88595", @"iso-8859-5" },
-    { @"iso88596", @"iso-8859-6" },
-    { @"iso88597", @"iso-8859-7" },
-    { @"iso88598", @"iso-8859-8" },
-    { @"iso88599", @"windows-1254" },
-    { @"iso_8859-1", @"windows-1252" },
-    { @"iso_8859-15", @"iso-8859-15" },
-    { @"iso_8859-1:1987", @"windows-1252" },
-    { @"iso_8859-2", @"iso-8859-2" },
-    { @"iso_8859-2:1987", @"iso-8859-2" },
-    { @"iso_8859-3", @"iso-8859-3" },
-    { @"iso_8859-3:1988", @"iso-8859-3" },
-    { @"iso_8859-4", @"iso-8859-4" },
-    { @"iso_8859-4:1988", @"iso-8859-4" },
-    { @"iso_8859-5", @"iso-8859-5" },
-    { @"iso_8859-5:1988", @"iso-8859-5" },
-    { @"iso_8859-6", @"iso-8859-6" },
-    { @"iso_8859-6:1987", @"iso-8859-6" },
-    { @"iso_8859-7", @"iso-8859-7" },
-    { @"iso_8859-7:1987", @"iso-8859-7" },
-    { @"iso_8859-8", @"iso-8859-8" },
-    { @"iso_8859-8:1988", @"iso-8859-8" },
-    { @"iso_8859-9", @"windows-1254" },
-    { @"iso_8859-9:1989", @"windows-1254" },
-    { @"koi", @"koi8-r" },
-    { @"koi8", @"koi8-r" },
-    { @"koi8-r", @"koi8-r" },
-    { @"koi8-u", @"koi8-u" },
-    { @"koi8_r", @"koi8-r" },
-    { @"korean", @"euc-kr" },
-    { @"ks_c_5601-1987", @"euc-kr" },
-    { @"ks_c_5601-1989", @"euc-kr" },
-    { @"ksc5601", @"euc-kr" },
-    { @"ksc_5601", @"euc-kr" },
-    { @"l1", @"windows-1252" },
-    { @"l2", @"iso-8859-2" },
-    { @"l3", @"iso-8859-3" },
-    { @"l4", @"iso-8859-4" },
-    { @"l5", @"windows-1254" },
-    { @"l6", @"iso-8859-10" },
-    { @"l9", @"iso-8859-15" },
-    { @"latin1", @"windows-1252" },
-    { @"latin2", @"iso-8859-2" },
-    { @"latin3", @"iso-8859-3" },
-    { @"latin4", @"iso-8859-4" },
-    { @"latin5", @"windows-1254" },
-    { @"latin6", @"iso-8859-10" },
-    { @"logical", @"iso-8859-8-i" },
-    { @"mac", @"macintosh" },
-    { @"macintosh", @"macintosh" },
-    { @"ms_kanji", @"shift_jis" },
-    { @"shift-jis", @"shift_jis" },
-    { @"shift_jis", @"shift_jis" },
-    { @"sjis", @"shift_jis" },
-    { @"sun_eu_greek", @"iso-8859-7" },
-    { @"tis-620", @"windows-874" },
-    { @"unicode-1-1-utf-8", @"utf-8" },
-    { @"us-ascii", @"windows-1252" },
-    { @"utf-16", @"utf-16le" },
-    { @"utf-16be", @"utf-16be" },
-    { @"utf-16le", @"utf-16le" },
-    { @"utf-8", @"utf-8" },
-    { @"utf8", @"utf-8" },
-    { @"visual", @"iso-8859-8" },
-    { @"windows-1250", @"windows-1250" },
-    { @"windows-1251", @"windows-1251" },
-    { @"windows-1252", @"windows-1252" },
-    { @"windows-1253", @"windows-1253" },
-    { @"windows-1254", @"windows-1254" },
-    { @"windows-1255", @"windows-1255" },
-    { @"windows-1256", @"windows-1256" },
-    { @"windows-1257", @"windows-1257" },
-    { @"windows-1258", @"windows-1258" },
-    { @"windows-31j", @"shift_jis" },
-    { @"windows-874", @"windows-874" },
-    { @"windows-949", @"euc-kr" },
-    { @"x-cp1250", @"windows-1250" },
-    { @"x-cp1251", @"windows-1251" },
-    { @"x-cp1252", @"windows-1252" },
-    { @"x-cp1253", @"windows-1253" },
-    { @"x-cp1254", @"windows-1254" },
-    { @"x-cp1255", @"windows-1255" },
-    { @"x-cp1256", @"windows-1256" },
-    { @"x-cp1257", @"windows-1257" },
-    { @"x-cp1258", @"windows-1258" },
-    { @"x-euc-jp", @"euc-jp" },
-    { @"x-gbk", @"gbk" },
-    { @"x-mac-cyrillic", @"x-mac-cyrillic" },
-    { @"x-mac-roman", @"macintosh" },
-    { @"x-mac-ukrainian", @"x-mac-cyrillic" },
-    { @"x-sjis", @"shift_jis" },
-    { @"x-user-defined", @"x-user-defined" },
-    { @"x-x-big5", @"big5" },
-};
-
-static int (^EncodingLabelComparator)(const void *, const void *) = ^int(const void *voidKey, const void *voidItem) {
-    const NSString *key = (__bridge const NSString *)voidKey;
-    const EncodingLabelMap *item = voidItem;
-    return (int) [key caseInsensitiveCompare:item->label];
-};
+/// No encoding labels are longer than this.
+enum { LongestEncodingLabelLength = 19 };
 
-static NSString * NamedEncodingForLabel(NSString *label)
+/**
+    Hashes a lowercase encoding label. Labels are looked up in two steps: hashing with no seed picks one of the EncodingLabelSeeds, and hashing again with that seed picks the only slot in EncodingLabels where the label could be.
+ */
+static uint32_t HashEncodingLabel(const uint8_t *label, NSUInteger length, uint32_t seed)
 {
-    EncodingLabelMap *match = bsearch_b((__bridge const void *)label, EncodingLabels, sizeof(EncodingLabels) / sizeof(EncodingLabels[0]), sizeof(EncodingLabels[0]), EncodingLabelComparator);
-    if (match) {
-        return match->name;
-    } else {
-        return nil;
+    // FNV-1a, finished off so that nearby seeds give unrelated slots.
+    uint32_t hash = 2166136261U ^ seed;
+    for (NSUInteger i = 0; i < length; i++) {
+        hash ^= label[i];
+        hash *= 16777619U;
     }
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    return hash;
 }
 
-typedef struct {
-    __unsafe_unretained NSString *name;
-    CFStringEncoding encoding;
-} NameCFEncodingMap;
-
-// This array is generated by the Encoding Labeler utility. Please make adjustments over there, not over here.
-static const NameCFEncodingMap StringEncodings[] = {
-    { @"big5", kCFStringEncodingBig5 },
-    { @"euc-jp", kCFStringEncodingEUC_JP },
-    { @"euc-kr", kCFStringEncodingEUC_KR },
-    { @"gb18030", kCFStringEncodingGB_18030_2000 },
-    { @"gbk", kCFStringEncodingGBK_95 },
-    { @"ibm866", kCFStringEncodingDOSRussian },
-    { @"iso-2022-jp", kCFStringEncodingISO_2022_JP },
-    { @"iso-8859-10", kCFStringEncodingISOLatin6 },
-    { @"iso-8859-13", kCFStringEncodingISOLatin7 },
-    { @"iso-8859-14", kCFStringEncodingISOLatin8 },
-    { @"iso-8859-15", kCFStringEncodingISOLatin9 },
-    { @"iso-8859-16", kCFStringEncodingISOLatin10 },
-    { @"iso-8859-2", kCFStringEncodingISOLatin2 },
-    { @"iso-8859-3", kCFStringEncodingISOLatin3 },
-    { @"iso-8859-4", kCFStringEncodingISOLatin4 },
-    { @"iso-8859-5", kCFStringEncodingISOLatinCyrillic },
-    { @"iso-8859-6", kCFStringEncodingISOLatinArabic },
-    { @"iso-8859-7", kCFStringEncodingISOLatinGreek },
-    { @"iso-8859-8", kCFStringEncodingISOLatinHebrew },
-    { @"iso-8859-8-i", kCFStringEncodingISOLatinHebrew },
-    { @"koi8-r", kCFStringEncodingKOI8_R },
-    { @"koi8-u", kCFStringEncodingKOI8_U },
-    { @"macintosh", kCFStringEncodingMacRoman },
-    { @"replacement", kCFStringEncodingInvalidId },
-    { @"shift_jis", kCFStringEncodingShiftJIS },
-    { @"utf-16be", kCFStringEncodingUTF16BE },
-    { @"utf-16le", kCFStringEncodingUTF16LE },
-    { @"utf-8", kCFStringEncodingUTF8 },
-    { @"windows-1250", kCFStringEncodingWindowsLatin2 },
-    { @"windows-1251", kCFStringEncodingWindowsCyrillic },
-    { @"windows-1252", kCFStringEncodingWindowsLatin1 },
-    { @"windows-1253", kCFStringEncodingWindowsGreek },
-    { @"windows-1254", kCFStringEncodingWindowsLatin5 },
-    { @"windows-1255", kCFStringEncodingWindowsHebrew },
-    { @"windows-1256", kCFStringEncodingWindowsArabic },
-    { @"windows-1257", kCFStringEncodingWindowsBalticRim },
-    { @"windows-1258", kCFStringEncodingWindowsVietnamese },
-    { @"windows-874", kCFStringEncodingDOSThai },
-    { @"x-mac-cyrillic", kCFStringEncodingMacCyrillic },
-    // SPEC: The HTML standard unilaterally changes x-user-defined to windows-1252, so let's just define it so.
-    { @"x-user-defined", kCFStringEncodingWindowsLatin1 },
+// These arrays are generated by the Encoding Labeler utility. Please make adjustments over there, not over here.
+static const uint8_t EncodingLabelSeeds[] = {
+    7, 27, 19, 9, 1, 9, 8, 7, 8, 2, 1, 17, 1, 2, 18, 1,
+    0, 1, 15, 99, 4, 1, 1, 3, 23, 5, 2, 9, 1, 2, 2, 5,
+    6, 2, 19, 1, 3, 21, 37, 6, 2, 33, 31, 3, 1, 22, 18, 0,
+    4, 6, 1, 8, 1, 96, 22, 69, 17, 88, 33, 24, 13, 16, 3, 86,
 };
 
-static int (^NameCFEncodingComparator)(const void *, const void *) = ^int(const void *voidKey, const void *voidItem) {
-    const NSString *key = (__bridge const NSString *)voidKey;
-    const NameCFEncodingMap *item = voidItem;
-    return (int) [key caseInsensitiveCompare:item->name];
+static const EncodingLabelMap EncodingLabels[256] = {
+    [0] = { "iso_8859-7:1987", kCFStringEncodingISOLatinGreek },
+    [2] = { "greek8", kCFStringEncodingISOLatinGreek },
+    [3] = { "iso8859-9", kCFStringEncodingWindowsLatin5 },
+    [4] = { "iso885914", kCFStringEncodingISOLatin8 },
+    [5] = { "csiso88598e", kCFStringEncodingISOLatinHebrew },
+    [6] = { "csksc56011987", kCFStringEncodingEUC_KR },
+    [7] = { "visual", kCFStringEncodingISOLatinHebrew },
+    [8] = { "utf-16be", kCFStringEncodingUTF16BE },
+    [9] = { "iso-8859-13", kCFStringEncodingISOLatin7 },
+    [11] = { "tis-620", kCFStringEncodingDOSThai },
+    [12] = { "iso-ir-148", kCFStringEncodingWindowsLatin5 },
+    [14] = { "iso-8859-16", kCFStringEncodingISOLatin10 },
+    [15] = { "us-ascii", kCFStringEncodingWindowsLatin1 },
+    [16] = { "windows-1251", kCFStringEncodingWindowsCyrillic },
+    [18] = { "latin3", kCFStringEncodingISOLatin3 },
+    [19] = { "iso88591", kCFStringEncodingWindowsLatin1 },
+    [20] = { "big5-hkscs", kCFStringEncodingBig5 },
+    [21] = { "utf-16le", kCFStringEncodingUTF16LE },
+    [22] = { "iso88592", kCFStringEncodingISOLatin2 },
+    [23] = { "iso_8859-15", kCFStringEncodingISOLatin9 },
+    [24] = { "ks_c_5601-1987", kCFStringEncodingEUC_KR },
+    [25] = { "cp1254", kCFStringEncodingWindowsLatin5 },
+    [26] = { "csbig5", kCFStringEncodingBig5 },
+    [27] = { "cn-big5", kCFStringEncodingBig5 },
+    [28] = { "cp866", kCFStringEncodingDOSRussian },
+    [29] = { "korean", kCFStringEncodingEUC_KR },
+    [30] = { "iso88593", kCFStringEncodingISOLatin3 },
+    [31] = { "iso-8859-15", kCFStringEncodingISOLatin9 },
+    [32] = { "csshiftjis", kCFStringEncodingShiftJIS },
+    [34] = { "x-user-defined", kCFStringEncodingWindowsLatin1 },
+    [36] = { "macintosh", kCFStringEncodingMacRoman },
+    [37] = { "iso885913", kCFStringEncodingISOLatin7 },
+    [38] = { "iso-8859-8-e", kCFStringEncodingISOLatinHebrew },
+    [39] = { "csiso2022jp", kCFStringEncodingISO_2022_JP },
+    [40] = { "latin2", kCFStringEncodingISOLatin2 },
+    [41] = { "iso-8859-6-i", kCFStringEncodingISOLatinArabic },
+    [43] = { "x-cp1250", kCFStringEncodingWindowsLatin2 },
+    [44] = { "utf-16", kCFStringEncodingUTF16LE },
+    [45] = { "iso-ir-149", kCFStringEncodingEUC_KR },
+    [47] = { "koi8_r", kCFStringEncodingKOI8_R },
+    [48] = { "hebrew", kCFStringEncodingISOLatinHebrew },
+    [49] = { "x-x-big5", kCFStringEncodingBig5 },
+    [51] = { "iso-ir-138", kCFStringEncodingISOLatinHebrew },
+    [52] = { "iso_8859-1:1987", kCFStringEncodingWindowsLatin1 },
+    [53] = { "windows-1252", kCFStringEncodingWindowsLatin1 },
+    [54] = { "l1", kCFStringEncodingWindowsLatin1 },
+    [55] = { "iso_8859-6", kCFStringEncodingISOLatinArabic },
+    [56] = { "x-cp1252", kCFStringEncodingWindowsLatin1 },
+    [58] = { "x-mac-cyrillic", kCFStringEncodingMacCyrillic },
+    [59] = { "iso-8859-5", kCFStringEncodingISOLatinCyrillic },
+    [60] = { "x-cp1255", kCFStringEncodingWindowsHebrew },
+    [61] = { "hz-gb-2312", kCFStringEncodingInvalidId },
+    [62] = { "elot_928", kCFStringEncodingISOLatinGreek },
+    [63] = { "ibm819", kCFStringEncodingWindowsLatin1 },
+    [65] = { "cp1251", kCFStringEncodingWindowsCyrillic },
+    [66] = { "sun_eu_greek", kCFStringEncodingISOLatinGreek },
+    [67] = { "ksc_5601", kCFStringEncodingEUC_KR },
+    [68] = { "csisolatincyrillic", kCFStringEncodingISOLatinCyrillic },
+    [69] = { "windows-874", kCFStringEncodingDOSThai },
+    [71] = { "iso88594", kCFStringEncodingISOLatin4 },
+    [73] = { "cseuckr", kCFStringEncodingEUC_KR },
+    [74] = { "cyrillic", kCFStringEncodingISOLatinCyrillic },
+    [75] = { "cp1255", kCFStringEncodingWindowsHebrew },
+    [76] = { "iso88598", kCFStringEncodingISOLatinHebrew },
+    [77] = { "iso-ir-127", kCFStringEncodingISOLatinArabic },
+    [78] = { "iso-2022-cn-ext", kCFStringEncodingInvalidId },
+    [79] = { "x-cp1258", kCFStringEncodingWindowsVietnamese },
+    [80] = { "dos-874", kCFStringEncodingDOSThai },
+    [81] = { "iso_8859-8:1988", kCFStringEncodingISOLatinHebrew },
+    [82] = { "cp1252", kCFStringEncodingWindowsLatin1 },
+    [83] = { "windows-1250", kCFStringEncodingWindowsLatin2 },
+    [85] = { "csmacintosh", kCFStringEncodingMacRoman },
+    [86] = { "latin4", kCFStringEncodingISOLatin4 },
+    [88] = { "iso-8859-1", kCFStringEncodingWindowsLatin1 },
+    [89] = { "l3", kCFStringEncodingISOLatin3 },
+    [91] = { "cp1256", kCFStringEncodingWindowsArabic },
+    [92] = { "csisolatinarabic", kCFStringEncodingISOLatinArabic },
+    [93] = { "x-cp1256", kCFStringEncodingWindowsArabic },
+    [94] = { "ascii", kCFStringEncodingWindowsLatin1 },
+    [95] = { "csiso88596i", kCFStringEncodingISOLatinArabic },
+    [97] = { "koi8-r", kCFStringEncodingKOI8_R },
+    [98] = { "csiso88598i", kCFStringEncodingISOLatinHebrew },
+    [99] = { "iso_8859-5", kCFStringEncodingISOLatinCyrillic },
+    [100] = { "csiso2022kr", kCFStringEncodingInvalidId },
+    [101] = { "iso8859-13", kCFStringEncodingISOLatin7 },
+    [102] = { "windows-31j", kCFStringEncodingShiftJIS },
+    [103] = { "windows-1256", kCFStringEncodingWindowsArabic },
+    [104] = { "latin1", kCFStringEncodingWindowsLatin1 },
+    [105] = { "iso8859-10", kCFStringEncodingISOLatin6 },
+    [106] = { "iso-ir-109", kCFStringEncodingISOLatin3 },
+    [107] = { "cp1257", kCFStringEncodingWindowsBalticRim },
+    [108] = { "ks_c_5601-1989", kCFStringEncodingEUC_KR },
+    [109] = { "x-cp1251", kCFStringEncodingWindowsCyrillic },
+    [110] = { "shift-jis", kCFStringEncodingShiftJIS },
+    [111] = { "iso_8859-1", kCFStringEncodingWindowsLatin1 },
+    [112] = { "l4", kCFStringEncodingISOLatin4 },
+    [113] = { "iso88597", kCFStringEncodingISOLatinGreek },
+    [114] = { "866", kCFStringEncodingDOSRussian },
+    [116] = { "iso_8859-3:1988", kCFStringEncodingISOLatin3 },
+    [117] = { "cseucpkdfmtjapanese", kCFStringEncodingEUC_JP },
+    [118] = { "csisolatinhebrew", kCFStringEncodingISOLatinHebrew },
+    [119] = { "unicode-1-1-utf-8", kCFStringEncodingUTF8 },
+    [120] = { "ecma-114", kCFStringEncodingISOLatinArabic },
+    [121] = { "csisolatin2", kCFStringEncodingISOLatin2 },
+    [122] = { "ms_kanji", kCFStringEncodingShiftJIS },
+    [123] = { "iso8859-6", kCFStringEncodingISOLatinArabic },
+    [125] = { "iso8859-3", kCFStringEncodingISOLatin3 },
+    [126] = { "iso_8859-5:1988", kCFStringEncodingISOLatinCyrillic },
+    [127] = { "euc-jp", kCFStringEncodingEUC_JP },
+    [128] = { "iso-ir-157", kCFStringEncodingISOLatin6 },
+    [129] = { "windows-1258", kCFStringEncodingWindowsVietnamese },
+    [131] = { "csisolatin4", kCFStringEncodingISOLatin4 },
+    [132] = { "iso885915", kCFStringEncodingISOLatin9 },
+    [133] = { "l2", kCFStringEncodingISOLatin2 },
+    [134] = { "iso-2022-cn", kCFStringEncodingInvalidId },
+    [135] = { "gbk", kCFStringEncodingGBK_95 },
+    [136] = { "iso885911", kCFStringEncodingDOSThai },
+    [138] = { "ansi_x3.4-1968", kCFStringEncodingWindowsLatin1 },
+    [139] = { "cp1250", kCFStringEncodingWindowsLatin2 },
+    [140] = { "windows-1257", kCFStringEncodingWindowsBalticRim },
+    [141] = { "cskoi8r", kCFStringEncodingKOI8_R },
+    [142] = { "iso-8859-3", kCFStringEncodingISOLatin3 },
+    [143] = { "asmo-708", kCFStringEncodingISOLatinArabic },
+    [144] = { "iso-8859-6", kCFStringEncodingISOLatinArabic },
+    [145] = { "cp1253", kCFStringEncodingWindowsGreek },
+    [146] = { "windows-1253", kCFStringEncodingWindowsGreek },
+    [147] = { "iso-ir-58", kCFStringEncodingGBK_95 },
+    [148] = { "koi8-u", kCFStringEncodingKOI8_U },
+    [150] = { "iso-2022-kr", kCFStringEncodingInvalidId },
+    [151] = { "iso-8859-11", kCFStringEncodingDOSThai },
+    [152] = { "iso88596", kCFStringEncodingISOLatinArabic },
+    [153] = { "x-mac-ukrainian", kCFStringEncodingMacCyrillic },
+    [154] = { "x-euc-jp", kCFStringEncodingEUC_JP },
+    [155] = { "ibm866", kCFStringEncodingDOSRussian },
+    [157] = { "iso-8859-8-i", kCFStringEncodingISOLatinHebrew },
+    [158] = { "csiso58gb231280", kCFStringEncodingGBK_95 },
+    [159] = { "iso-8859-4", kCFStringEncodingISOLatin4 },
+    [160] = { "iso885910", kCFStringEncodingISOLatin6 },
+    [161] = { "iso8859-4", kCFStringEncodingISOLatin4 },
+    [162] = { "iso-ir-100", kCFStringEncodingWindowsLatin1 },
+    [163] = { "iso8859-14", kCFStringEncodingISOLatin8 },
+    [164] = { "gb_2312", kCFStringEncodingGBK_95 },
+    [165] = { "x-gbk", kCFStringEncodingGBK_95 },
+    [166] = { "windows-1255", kCFStringEncodingWindowsHebrew },
+    [167] = { "arabic", kCFStringEncodingISOLatinArabic },
+    [170] = { "iso8859-8", kCFStringEncodingISOLatinHebrew },
+    [171] = { "csisolatin3", kCFStringEncodingISOLatin3 },
+    [172] = { "iso8859-15", kCFStringEncodingISOLatin9 },
+    [173] = { "windows-949", kCFStringEncodingEUC_KR },
+    [175] = { "iso-2022-jp", kCFStringEncodingISO_2022_JP },
+    [176] = { "greek", kCFStringEncodingISOLatinGreek },
+    [177] = { "iso88595", kCFStringEncodingISOLatinCyrillic },
+    [179] = { "iso8859-2", kCFStringEncodingISOLatin2 },
+    [180] = { "iso8859-5", kCFStringEncodingISOLatinCyrillic },
+    [182] = { "x-cp1254", kCFStringEncodingWindowsLatin5 },
+    [183] = { "koi", kCFStringEncodingKOI8_R },
+    [184] = { "iso8859-1", kCFStringEncodingWindowsLatin1 },
+    [186] = { "latin5", kCFStringEncodingWindowsLatin5 },
+    [187] = { "mac", kCFStringEncodingMacRoman },
+    [188] = { "csisolatin5", kCFStringEncodingWindowsLatin5 },
+    [189] = { "iso_8859-7", kCFStringEncodingISOLatinGreek },
+    [190] = { "cp1258", kCFStringEncodingWindowsVietnamese },
+    [191] = { "iso-8859-6-e", kCFStringEncodingISOLatinArabic },
+    [192] = { "shift_jis", kCFStringEncodingShiftJIS },
+    [193] = { "iso-8859-7", kCFStringEncodingISOLatinGreek },
+    [194] = { "iso_8859-4:1988", kCFStringEncodingISOLatin4 },
+    [196] = { "csgb2312", kCFStringEncodingGBK_95 },
+    [197] = { "euc-kr", kCFStringEncodingEUC_KR },
+    [198] = { "iso_8859-6:1987", kCFStringEncodingISOLatinArabic },
+    [199] = { "gb2312", kCFStringEncodingGBK_95 },
+    [200] = { "csisolatingreek", kCFStringEncodingISOLatinGreek },
+    [202] = { "csibm866", kCFStringEncodingDOSRussian },
+    [203] = { "iso_8859-2:1987", kCFStringEncodingISOLatin2 },
+    [204] = { "l9", kCFStringEncodingISOLatin9 },
+    [205] = { "x-mac-roman", kCFStringEncodingMacRoman },
+    [206] = { "big5", kCFStringEncodingBig5 },
+    [207] = { "iso_8859-9:1989", kCFStringEncodingWindowsLatin5 },
+    [208] = { "x-cp1253", kCFStringEncodingWindowsGreek },
+    [209] = { "l6", kCFStringEncodingISOLatin6 },
+    [210] = { "windows-1254", kCFStringEncodingWindowsLatin5 },
+    [211] = { "logical", kCFStringEncodingISOLatinHebrew },
+    [212] = { "iso-8859-8", kCFStringEncodingISOLatinHebrew },
+    [213] = { "utf8", kCFStringEncodingUTF8 },
+    [214] = { "utf-8", kCFStringEncodingUTF8 },
+    [216] = { "iso_8859-9", kCFStringEncodingWindowsLatin5 },
+    [217] = { "iso-8859-9", kCFStringEncodingWindowsLatin5 },
+    [218] = { "iso-8859-10", kCFStringEncodingISOLatin6 },
+    [220] = { "koi8", kCFStringEncodingKOI8_R },
+    [221] = { "csisolatin1", kCFStringEncodingWindowsLatin1 },
+    [222] = { "chinese", kCFStringEncodingGBK_95 },
+    [223] = { "iso8859-11", kCFStringEncodingDOSThai },
+    [227] = { "cp819", kCFStringEncodingWindowsLatin1 },
+    [228] = { "iso-8859-2", kCFStringEncodingISOLatin2 },
+    [229] = { "latin6", kCFStringEncodingISOLatin6 },
+    [230] = { "ecma-118", kCFStringEncodingISOLatinGreek },
+    [231] = { "iso-ir-144", kCFStringEncodingISOLatinCyrillic },
+    [232] = { "iso_8859-3", kCFStringEncodingISOLatin3 },
+    [233] = { "csisolatin6", kCFStringEncodingISOLatin6 },
+    [234] = { "iso-ir-110", kCFStringEncodingISOLatin4 },
+    [235] = { "csisolatin9", kCFStringEncodingISOLatin9 },
+    [236] = { "iso-ir-126", kCFStringEncodingISOLatinGreek },
+    [237] = { "ksc5601", kCFStringEncodingEUC_KR },
+    [240] = { "iso88599", kCFStringEncodingWindowsLatin5 },
+    [241] = { "iso_8859-4", kCFStringEncodingISOLatin4 },
+    [242] = { "l5", kCFStringEncodingWindowsLatin5 },
+    [243] = { "iso_8859-8", kCFStringEncodingISOLatinHebrew },
+    [245] = { "x-sjis", kCFStringEncodingShiftJIS },
+    [246] = { "iso_8859-2", kCFStringEncodingISOLatin2 },
+    [247] = { "csiso88596e", kCFStringEncodingISOLatinArabic },
+    [249] = { "x-cp1257", kCFStringEncodingWindowsBalticRim },
+    [250] = { "sjis", kCFStringEncodingShiftJIS },
+    [251] = { "iso-ir-101", kCFStringEncodingISOLatin2 },
+    [252] = { "gb_2312-80", kCFStringEncodingGBK_95 },
+    [253] = { "iso-8859-14", kCFStringEncodingISOLatin8 },
+    [254] = { "iso8859-7", kCFStringEncodingISOLatinGreek },
+    [255] = { "gb18030", kCFStringEncodingGB_18030_2000 },
 };
 
-static NSStringEncoding StringEncodingForName(NSString *name)
+/// Returns the string encoding for a label that is already trimmed and lowercased, or InvalidStringEncoding() if the label is unknown.
+static NSStringEncoding StringEncodingForLowercaseLabel(const uint8_t *label, NSUInteger length)
 {
-    NameCFEncodingMap *match = bsearch_b((__bridge const void *)name, StringEncodings, sizeof(StringEncodings) / sizeof(StringEncodings[0]), sizeof(StringEncodings[0]), NameCFEncodingComparator);
-    if (match) {
-        return CFStringConvertEncodingToNSStringEncoding(match->encoding);
+    uint32_t seed = EncodingLabelSeeds[HashEncodingLabel(label, length, 0) % (sizeof(EncodingLabelSeeds) / sizeof(EncodingLabelSeeds[0]))];
+    const EncodingLabelMap *candidate = &EncodingLabels[HashEncodingLabel(label, length, seed) % (sizeof(EncodingLabels) / sizeof(EncodingLabels[0]))];
+    if (candidate->label && strlen(candidate->label) == length && memcmp(candidate->label, label, length) == 0) {
+        return CFStringConvertEncodingToNSStringEncoding(candidate->encoding);
     } else {
         return InvalidStringEncoding();
     }
 }
 
+static BOOL IsASCIIWhitespace(UniChar c)
+{
+    return c == '\t' || c == '\n' || c == '\f' || c == '\r' || c == ' ';
+}
+
+static uint8_t ASCIILowercase(uint8_t c)
+{
+    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+/// Returns the string encoding for a label of ASCII bytes, ignoring surrounding whitespace and case.
+static NSStringEncoding StringEncodingForLabelBytes(const uint8_t *bytes, NSUInteger length)
+{
+    while (length > 0 && IsASCIIWhitespace(bytes[0])) {
+        bytes++;
+        length--;
+    }
+    while (length > 0 && IsASCIIWhitespace(bytes[length - 1])) {
+        length--;
+    }
+    if (length == 0 || length > LongestEncodingLabelLength) return InvalidStringEncoding();
+    
+    uint8_t lowercase[LongestEncodingLabelLength];
+    for (NSUInteger i = 0; i < length; i++) {
+        lowercase[i] = ASCIILowercase(bytes[i]);
+    }
+    return StringEncodingForLowercaseLabel(lowercase, length);
+}
+
 NSStringEncoding InvalidStringEncoding(void)
 {
     return CFStringConvertEncodingToNSStringEncoding(kCFStringEncodingInvalidId);
 }
 
-NSStringEncoding StringEncodingForLabel(NSString *untrimmedLabel)
+NSStringEncoding StringEncodingForLabel(NSString *label)
 {
-    NSString *label = [untrimmedLabel stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
-    NSString *name = NamedEncodingForLabel(label);
-    if (name) {
-        return StringEncodingForName(name);
-    } else {
-        return InvalidStringEncoding();
+    NSUInteger start = 0, end = label.length;
+    while (start < end && IsASCIIWhitespace([label characterAtIndex:start])) {
+        start++;
+    }
+    while (end > start && IsASCIIWhitespace([label characterAtIndex:end - 1])) {
+        end--;
+    }
+    if (end - start > LongestEncodingLabelLength) return InvalidStringEncoding();
+    
+    uint8_t bytes[LongestEncodingLabelLength];
+    for (NSUInteger i = start; i < end; i++) {
+        UniChar c = [label characterAtIndex:i];
+        if (c > 0x7F) return InvalidStringEncoding();
+        bytes[i - start] = (uint8_t)c;
+    }
+    return StringEncodingForLabelBytes(bytes, end - start);
+}
+
+/// An attribute found while prescanning. Names and values are lowercased, and neither can be longer than the bytes being prescanned.
+typedef struct {
+    uint8_t name[PrescanLength];
+    NSUInteger nameLength;
+    uint8_t value[PrescanLength];
+    NSUInteger valueLength;
+} PrescanAttribute;
+
+static BOOL PrescanAttributeNameIs(const PrescanAttribute *attribute, const char *name)
+{
+    return attribute->nameLength == strlen(name) && memcmp(attribute->name, name, attribute->nameLength) == 0;
+}
+
+/**
+    Returns YES and advances past an attribute, or returns NO if there are no more attributes. If the bytes run out, *position is set to length and the prescan should be aborted.
+ 
+    For more information, see https://html.spec.whatwg.org/multipage/syntax.html#concept-get-attributes-when-sniffing
+ */
+static BOOL GetPrescanAttribute(const uint8_t *bytes, NSUInteger length, NSUInteger *position, PrescanAttribute *attribute)
+{
+    attribute->nameLength = 0;
+    attribute->valueLength = 0;
+    NSUInteger i = *position;
+    #define ADVANCE_OR_ABORT() if (++i >= length) { *position = length; return NO; }
+    while (i < length && (IsASCIIWhitespace(bytes[i]) || bytes[i] == '/')) {
+        i++;
+    }
+    if (i >= length) {
+        *position = length;
+        return NO;
+    }
+    if (bytes[i] == '>') {
+        *position = i;
+        return NO;
+    }
+    
+    // Attribute name.
+    for (;;) {
+        uint8_t c = bytes[i];
+        if (c == '=' && attribute->nameLength > 0) {
+            break;
+        } else if (IsASCIIWhitespace(c)) {
+            while (IsASCIIWhitespace(bytes[i])) {
+                ADVANCE_OR_ABORT();
+            }
+            if (bytes[i] != '=') {
+                *position = i;
+                return YES;
+            }
+            break;
+        } else if (c == '/' || c == '>') {
+            *position = i;
+            return YES;
+        }
+        attribute->name[attribute->nameLength++] = ASCIILowercase(c);
+        ADVANCE_OR_ABORT();
+    }
+    
+    // Skip the equals sign and any whitespace after it.
+    ADVANCE_OR_ABORT();
+    while (IsASCIIWhitespace(bytes[i])) {
+        ADVANCE_OR_ABORT();
+    }
+    
+    // Attribute value.
+    uint8_t quote = bytes[i];
+    if (quote == '"' || quote == '\'') {
+        for (;;) {
+            ADVANCE_OR_ABORT();
+            if (bytes[i] == quote) {
+                *position = i + 1;
+                return YES;
+            }
+            attribute->value[attribute->valueLength++] = ASCIILowercase(bytes[i]);
+        }
+    }
+    if (bytes[i] == '>') {
+        *position = i;
+        return YES;
+    }
+    for (;;) {
+        attribute->value[attribute->valueLength++] = ASCIILowercase(bytes[i]);
+        ADVANCE_OR_ABORT();
+        if (IsASCIIWhitespace(bytes[i]) || bytes[i] == '>') {
+            *position = i;
+            return YES;
+        }
+    }
+    #undef ADVANCE_OR_ABORT
+}
+
+/**
+    Returns the string encoding given in the value of a <meta> tag's content attribute, or InvalidStringEncoding() if there is none.
+ 
+    For more information, see https://html.spec.whatwg.org/multipage/infrastructure.html#algorithm-for-extracting-a-character-encoding-from-a-meta-element
+ */
+static NSStringEncoding StringEncodingForMetaContent(const uint8_t *content, NSUInteger length)
+{
+    static const char Charset[] = "charset";
+    const NSUInteger CharsetLength = sizeof(Charset) - 1;
+    NSUInteger i = 0;
+    for (;;) {
+        for (; i + CharsetLength <= length; i++) {
+            if (memcmp(content + i, Charset, CharsetLength) == 0) break;
+        }
+        if (i + CharsetLength > length) return InvalidStringEncoding();
+        i += CharsetLength;
+        
+        while (i < length && IsASCIIWhitespace(content[i])) {
+            i++;
+        }
+        if (i < length && content[i] == '=') break;
+    }
+    
+    i++;
+    while (i < length && IsASCIIWhitespace(content[i])) {
+        i++;
+    }
+    if (i >= length) return InvalidStringEncoding();
+    
+    uint8_t quote = content[i];
+    if (quote == '"' || quote == '\'') {
+        const uint8_t *closingQuote = memchr(content + i + 1, quote, length - i - 1);
+        if (!closingQuote) return InvalidStringEncoding();
+        return StringEncodingForLabelBytes(content + i + 1, closingQuote - (content + i + 1));
+    }
+    NSUInteger end = i;
+    while (end < length && !IsASCIIWhitespace(content[end]) && content[end] != ';') {
+        end++;
+    }
+    return StringEncodingForLabelBytes(content + i, end - i);
+}
+
+static BOOL HasCaseInsensitivePrefix(const uint8_t *bytes, NSUInteger length, const char *lowercasePrefix)
+{
+    NSUInteger prefixLength = strlen(lowercasePrefix);
+    if (length < prefixLength) return NO;
+    for (NSUInteger i = 0; i < prefixLength; i++) {
+        if (ASCIILowercase(bytes[i]) != (uint8_t)lowercasePrefix[i]) return NO;
+    }
+    return YES;
+}
+
+static BOOL IsASCIILetter(uint8_t c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static NSStringEncoding PrescannedStringEncodingForBytes(const uint8_t *bytes, NSUInteger length)
+{
+    PrescanAttribute attribute;
+    NSUInteger i = 0;
+    while (i < length) {
+        const uint8_t *rest = bytes + i;
+        NSUInteger restLength = length - i;
+        if (HasCaseInsensitivePrefix(rest, restLength, "<!--")) {
+            // The hyphens that start the comment can also end it, as in "<!-->".
+            NSUInteger end = i + 2;
+            while (end + 2 < length && !(bytes[end] == '-' && bytes[end + 1] == '-' && bytes[end + 2] == '>')) {
+                end++;
+            }
+            if (end + 2 >= length) return InvalidStringEncoding();
+            i = end + 3;
+        } else if (HasCaseInsensitivePrefix(rest, restLength, "<meta") && restLength > 5 && (IsASCIIWhitespace(rest[5]) || rest[5] == '/')) {
+            i += 6;
+            BOOL sawHTTPEquiv = NO, sawContent = NO, sawCharset = NO;
+            BOOL gotPragma = NO;
+            enum { NeedPragmaUnknown, NeedPragma, DontNeedPragma } needPragma = NeedPragmaUnknown;
+            
+            // Either no charset has been found, or charset holds an encoding that may be InvalidStringEncoding() (if the label was unknown).
+            BOOL foundCharset = NO;
+            NSStringEncoding charset = InvalidStringEncoding();
+            
+            while (GetPrescanAttribute(bytes, length, &i, &attribute)) {
+                if (PrescanAttributeNameIs(&attribute, "http-equiv")) {
+                    if (sawHTTPEquiv) continue;
+                    sawHTTPEquiv = YES;
+                    static const char ContentType[] = "content-type";
+                    if (attribute.valueLength == sizeof(ContentType) - 1 && memcmp(attribute.value, ContentType, attribute.valueLength) == 0) {
+                        gotPragma = YES;
+                    }
+                } else if (PrescanAttributeNameIs(&attribute, "content")) {
+                    if (sawContent) continue;
+                    sawContent = YES;
+                    if (!foundCharset) {
+                        NSStringEncoding encoding = StringEncodingForMetaContent(attribute.value, attribute.valueLength);
+                        if (encoding != InvalidStringEncoding()) {
+                            foundCharset = YES;
+                            charset = encoding;
+                            needPragma = NeedPragma;
+                        }
+                    }
+                } else if (PrescanAttributeNameIs(&attribute, "charset")) {
+                    if (sawCharset) continue;
+                    sawCharset = YES;
+                    if (!foundCharset) {
+                        foundCharset = YES;
+                        charset = StringEncodingForLabelBytes(attribute.value, attribute.valueLength);
+                        needPragma = DontNeedPragma;
+                    }
+                }
+            }
+            if (i >= length) return InvalidStringEncoding();
+            
+            if (needPragma != NeedPragmaUnknown && !(needPragma == NeedPragma && !gotPragma) && charset != InvalidStringEncoding()) {
+                if (IsUTF16Encoding(charset)) {
+                    return NSUTF8StringEncoding;
+                } else {
+                    return charset;
+                }
+            }
+            i++;
+        } else if (restLength > 1 && rest[0] == '<' && (IsASCIILetter(rest[1]) || (rest[1] == '/' && restLength > 2 && IsASCIILetter(rest[2])))) {
+            while (i < length && !IsASCIIWhitespace(bytes[i]) && bytes[i] != '>') {
+                i++;
+            }
+            while (GetPrescanAttribute(bytes, length, &i, &attribute)) {
+                // Skip attributes of tags other than <meta>.
+            }
+            if (i >= length) return InvalidStringEncoding();
+            i++;
+        } else if (HasCaseInsensitivePrefix(rest, restLength, "<!") || HasCaseInsensitivePrefix(rest, restLength, "</") || HasCaseInsensitivePrefix(rest, restLength, "<?")) {
+            const uint8_t *greaterThan = memchr(rest + 2, '>', restLength - 2);
+            if (!greaterThan) return InvalidStringEncoding();
+            i = greaterThan - bytes + 1;
+        } else {
+            i++;
+        }
     }
+    return InvalidStringEncoding();
 }
 
 BOOL IsASCIICompatibleEncoding(NSStringEncoding nsencoding)
@@ -21,5 +21,17 @@ extern UTF32Char ReplacementForNumericEntity(UInt32 entity);
  */
 extern NSString * StringForNamedEntity(NSString *entityName, NSString * __autoreleasing *parsedName);
 
+/**
+    Follows one character of a named entity's name through a trie of all the names. Matching a name character by character, and remembering the last node that has a replacement, finds the longest named entity without building a string.
+ 
+    @param node 0 to start a new name, or the node returned for the previous character.
+ 
+    @return A node for the name so far, or 0 if no named entity starts with the name so far.
+ */
+extern NSUInteger NextNamedEntityNode(NSUInteger node, UTF32Char c);
+
+/// Returns the replacement string for the named entity that ends at a node, or nil if the name so far is only the start of named entities.
+extern NSString * NamedEntityReplacementAtNode(NSUInteger node);
+
 /// No named entities are longer than this (does not consider the leading ampersand).
 extern const NSUInteger LongestEntityNameLength;
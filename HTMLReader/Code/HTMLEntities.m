@@ -69,2293 +69,11434 @@ UTF32Char ReplacementForNumericEntity(UInt32 entity)
     }
 }
 
+/**
+    A node in a trie of named character reference names.
+ 
+    Each node's children are stored next to each other, sorted by character, so following a character means scanning one short run of nodes.
+ */
 typedef struct {
-    __unsafe_unretained NSString *name;
-    __unsafe_unretained NSString *characters;
-} NamedReferenceMap;
+    // The last character of the name so far.
+    char character;
+    uint8_t numberOfChildren;
+    uint16_t firstChild;
+    
+    // One more than the index of the replacement for the name so far, or 0 if it isn't a named character reference.
+    uint16_t replacement;
+} NamedReferenceNode;
 
-// These two arrays are generated by the Entity Fetcher utility. Make changes over there, not here!
+// These arrays are generated by the Entity Fetcher utility. Make changes over there, not here!
 
-static const NamedReferenceMap NamedReferences[] = {
-    { @"AElig;", @"\U000000c6" },
-    { @"AMP;", @"&" },
-    { @"Aacute;", @"\U000000c1" },
-    { @"Abreve;", @"\U00000102" },
-    { @"Acirc;", @"\U000000c2" },
-    { @"Acy;", @"\U00000410" },
-    { @"Afr;", @"\U0001d504" },
-    { @"Agrave;", @"\U000000c0" },
-    { @"Alpha;", @"\U00000391" },
-    { @"Amacr;", @"\U00000100" },
-    { @"And;", @"\U00002a53" },
-    { @"Aogon;", @"\U00000104" },
-    { @"Aopf;", @"\U0001d538" },
-    { @"ApplyFunction;", @"\U00002061" },
-    { @"Aring;", @"\U000000c5" },
-    { @"Ascr;", @"\U0001d49c" },
-    { @"Assign;", @"\U00002254" },
-    { @"Atilde;", @"\U000000c3" },
-    { @"Auml;", @"\U000000c4" },
-    { @"Backslash;", @"\U00002216" },
-    { @"Barv;", @"\U00002ae7" },
-    { @"Barwed;", @"\U00002306" },
-    { @"Bcy;", @"\U00000411" },
-    { @"Because;", @"\U00002235" },
-    { @"Bernoullis;", @"\U0000212c" },
-    { @"Beta;", @"\U00000392" },
-    { @"Bfr;", @"\U0001d505" },
-    { @"Bopf;", @"\U0001d539" },
-    { @"Breve;", @"\U000002d8" },
-    { @"Bscr;", @"\U0000212c" },
-    { @"Bumpeq;", @"\U0000224e" },
-    { @"CHcy;", @"\U00000427" },
-    { @"COPY;", @"\U000000a9" },
-    { @"Cacute;", @"\U00000106" },
-    { @"Cap;", @"\U000022d2" },
-    { @"CapitalDifferentialD;", @"\U00002145" },
-    { @"Cayleys;", @"\U0000212d" },
-    { @"Ccaron;", @"\U0000010c" },
-    { @"Ccedil;", @"\U000000c7" },
-    { @"Ccirc;", @"\U00000108" },
-    { @"Cconint;", @"\U00002230" },
-    { @"Cdot;", @"\U0000010a" },
-    { @"Cedilla;", @"\U000000b8" },
-    { @"CenterDot;", @"\U000000b7" },
-    { @"Cfr;", @"\U0000212d" },
-    { @"Chi;", @"\U000003a7" },
-    { @"CircleDot;", @"\U00002299" },
-    { @"CircleMinus;", @"\U00002296" },
-    { @"CirclePlus;", @"\U00002295" },
-    { @"CircleTimes;", @"\U00002297" },
-    { @"ClockwiseContourIntegral;", @"\U00002232" },
-    { @"CloseCurlyDoubleQuote;", @"\U0000201d" },
-    { @"CloseCurlyQuote;", @"\U00002019" },
-    { @"Colon;", @"\U00002237" },
-    { @"Colone;", @"\U00002a74" },
-    { @"Congruent;", @"\U00002261" },
-    { @"Conint;", @"\U0000222f" },
-    { @"ContourIntegral;", @"\U0000222e" },
-    { @"Copf;", @"\U00002102" },
-    { @"Coproduct;", @"\U00002210" },
-    { @"CounterClockwiseContourIntegral;", @"\U00002233" },
-    { @"Cross;", @"\U00002a2f" },
-    { @"Cscr;", @"\U0001d49e" },
-    { @"Cup;", @"\U000022d3" },
-    { @"CupCap;", @"\U0000224d" },
-    { @"DD;", @"\U00002145" },
-    { @"DDotrahd;", @"\U00002911" },
-    { @"DJcy;", @"\U00000402" },
-    { @"DScy;", @"\U00000405" },
-    { @"DZcy;", @"\U0000040f" },
-    { @"Dagger;", @"\U00002021" },
-    { @"Darr;", @"\U000021a1" },
-    { @"Dashv;", @"\U00002ae4" },
-    { @"Dcaron;", @"\U0000010e" },
-    { @"Dcy;", @"\U00000414" },
-    { @"Del;", @"\U00002207" },
-    { @"Delta;", @"\U00000394" },
-    { @"Dfr;", @"\U0001d507" },
-    { @"DiacriticalAcute;", @"\U000000b4" },
-    { @"DiacriticalDot;", @"\U000002d9" },
-    { @"DiacriticalDoubleAcute;", @"\U000002dd" },
-    { @"DiacriticalGrave;", @"\U00000060" },
-    { @"DiacriticalTilde;", @"\U000002dc" },
-    { @"Diamond;", @"\U000022c4" },
-    { @"DifferentialD;", @"\U00002146" },
-    { @"Dopf;", @"\U0001d53b" },
-    { @"Dot;", @"\U000000a8" },
-    { @"DotDot;", @"\U000020dc" },
-    { @"DotEqual;", @"\U00002250" },
-    { @"DoubleContourIntegral;", @"\U0000222f" },
-    { @"DoubleDot;", @"\U000000a8" },
-    { @"DoubleDownArrow;", @"\U000021d3" },
-    { @"DoubleLeftArrow;", @"\U000021d0" },
-    { @"DoubleLeftRightArrow;", @"\U000021d4" },
-    { @"DoubleLeftTee;", @"\U00002ae4" },
-    { @"DoubleLongLeftArrow;", @"\U000027f8" },
-    { @"DoubleLongLeftRightArrow;", @"\U000027fa" },
-    { @"DoubleLongRightArrow;", @"\U000027f9" },
-    { @"DoubleRightArrow;", @"\U000021d2" },
-    { @"DoubleRightTee;", @"\U000022a8" },
-    { @"DoubleUpArrow;", @"\U000021d1" },
-    { @"DoubleUpDownArrow;", @"\U000021d5" },
-    { @"DoubleVerticalBar;", @"\U00002225" },
-    { @"DownArrow;", @"\U00002193" },
-    { @"DownArrowBar;", @"\U00002913" },
-    { @"DownArrowUpArrow;", @"\U000021f5" },
-    { @"DownBreve;", @"\U00000311" },
-    { @"DownLeftRightVector;", @"\U00002950" },
-    { @"DownLeftTeeVector;", @"\U0000295e" },
-    { @"DownLeftVector;", @"\U000021bd" },
-    { @"DownLeftVectorBar;", @"\U00002956" },
-    { @"DownRightTeeVector;", @"\U0000295f" },
-    { @"DownRightVector;", @"\U000021c1" },
-    { @"DownRightVectorBar;", @"\U00002957" },
-    { @"DownTee;", @"\U000022a4" },
-    { @"DownTeeArrow;", @"\U000021a7" },
-    { @"Downarrow;", @"\U000021d3" },
-    { @"Dscr;", @"\U0001d49f" },
-    { @"Dstrok;", @"\U00000110" },
-    { @"ENG;", @"\U0000014a" },
-    { @"ETH;", @"\U000000d0" },
-    { @"Eacute;", @"\U000000c9" },
-    { @"Ecaron;", @"\U0000011a" },
-    { @"Ecirc;", @"\U000000ca" },
-    { @"Ecy;", @"\U0000042d" },
-    { @"Edot;", @"\U00000116" },
-    { @"Efr;", @"\U0001d508" },
-    { @"Egrave;", @"\U000000c8" },
-    { @"Element;", @"\U00002208" },
-    { @"Emacr;", @"\U00000112" },
-    { @"EmptySmallSquare;", @"\U000025fb" },
-    { @"EmptyVerySmallSquare;", @"\U000025ab" },
-    { @"Eogon;", @"\U00000118" },
-    { @"Eopf;", @"\U0001d53c" },
-    { @"Epsilon;", @"\U00000395" },
-    { @"Equal;", @"\U00002a75" },
-    { @"EqualTilde;", @"\U00002242" },
-    { @"Equilibrium;", @"\U000021cc" },
-    { @"Escr;", @"\U00002130" },
-    { @"Esim;", @"\U00002a73" },
-    { @"Eta;", @"\U00000397" },
-    { @"Euml;", @"\U000000cb" },
-    { @"Exists;", @"\U00002203" },
-    { @"ExponentialE;", @"\U00002147" },
-    { @"Fcy;", @"\U00000424" },
-    { @"Ffr;", @"\U0001d509" },
-    { @"FilledSmallSquare;", @"\U000025fc" },
-    { @"FilledVerySmallSquare;", @"\U000025aa" },
-    { @"Fopf;", @"\U0001d53d" },
-    { @"ForAll;", @"\U00002200" },
-    { @"Fouriertrf;", @"\U00002131" },
-    { @"Fscr;", @"\U00002131" },
-    { @"GJcy;", @"\U00000403" },
-    { @"GT;", @">" },
-    { @"Gamma;", @"\U00000393" },
-    { @"Gammad;", @"\U000003dc" },
-    { @"Gbreve;", @"\U0000011e" },
-    { @"Gcedil;", @"\U00000122" },
-    { @"Gcirc;", @"\U0000011c" },
-    { @"Gcy;", @"\U00000413" },
-    { @"Gdot;", @"\U00000120" },
-    { @"Gfr;", @"\U0001d50a" },
-    { @"Gg;", @"\U000022d9" },
-    { @"Gopf;", @"\U0001d53e" },
-    { @"GreaterEqual;", @"\U00002265" },
-    { @"GreaterEqualLess;", @"\U000022db" },
-    { @"GreaterFullEqual;", @"\U00002267" },
-    { @"GreaterGreater;", @"\U00002aa2" },
-    { @"GreaterLess;", @"\U00002277" },
-    { @"GreaterSlantEqual;", @"\U00002a7e" },
-    { @"GreaterTilde;", @"\U00002273" },
-    { @"Gscr;", @"\U0001d4a2" },
-    { @"Gt;", @"\U0000226b" },
-    { @"HARDcy;", @"\U0000042a" },
-    { @"Hacek;", @"\U000002c7" },
-    { @"Hat;", @"^" },
-    { @"Hcirc;", @"\U00000124" },
-    { @"Hfr;", @"\U0000210c" },
-    { @"HilbertSpace;", @"\U0000210b" },
-    { @"Hopf;", @"\U0000210d" },
-    { @"HorizontalLine;", @"\U00002500" },
-    { @"Hscr;", @"\U0000210b" },
-    { @"Hstrok;", @"\U00000126" },
-    { @"HumpDownHump;", @"\U0000224e" },
-    { @"HumpEqual;", @"\U0000224f" },
-    { @"IEcy;", @"\U00000415" },
-    { @"IJlig;", @"\U00000132" },
-    { @"IOcy;", @"\U00000401" },
-    { @"Iacute;", @"\U000000cd" },
-    { @"Icirc;", @"\U000000ce" },
-    { @"Icy;", @"\U00000418" },
-    { @"Idot;", @"\U00000130" },
-    { @"Ifr;", @"\U00002111" },
-    { @"Igrave;", @"\U000000cc" },
-    { @"Im;", @"\U00002111" },
-    { @"Imacr;", @"\U0000012a" },
-    { @"ImaginaryI;", @"\U00002148" },
-    { @"Implies;", @"\U000021d2" },
-    { @"Int;", @"\U0000222c" },
-    { @"Integral;", @"\U0000222b" },
-    { @"Intersection;", @"\U000022c2" },
-    { @"InvisibleComma;", @"\U00002063" },
-    { @"InvisibleTimes;", @"\U00002062" },
-    { @"Iogon;", @"\U0000012e" },
-    { @"Iopf;", @"\U0001d540" },
-    { @"Iota;", @"\U00000399" },
-    { @"Iscr;", @"\U00002110" },
-    { @"Itilde;", @"\U00000128" },
-    { @"Iukcy;", @"\U00000406" },
-    { @"Iuml;", @"\U000000cf" },
-    { @"Jcirc;", @"\U00000134" },
-    { @"Jcy;", @"\U00000419" },
-    { @"Jfr;", @"\U0001d50d" },
-    { @"Jopf;", @"\U0001d541" },
-    { @"Jscr;", @"\U0001d4a5" },
-    { @"Jsercy;", @"\U00000408" },
-    { @"Jukcy;", @"\U00000404" },
-    { @"KHcy;", @"\U00000425" },
-    { @"KJcy;", @"\U0000040c" },
-    { @"Kappa;", @"\U0000039a" },
-    { @"Kcedil;", @"\U00000136" },
-    { @"Kcy;", @"\U0000041a" },
-    { @"Kfr;", @"\U0001d50e" },
-    { @"Kopf;", @"\U0001d542" },
-    { @"Kscr;", @"\U0001d4a6" },
-    { @"LJcy;", @"\U00000409" },
-    { @"LT;", @"<" },
-    { @"Lacute;", @"\U00000139" },
-    { @"Lambda;", @"\U0000039b" },
-    { @"Lang;", @"\U000027ea" },
-    { @"Laplacetrf;", @"\U00002112" },
-    { @"Larr;", @"\U0000219e" },
-    { @"Lcaron;", @"\U0000013d" },
-    { @"Lcedil;", @"\U0000013b" },
-    { @"Lcy;", @"\U0000041b" },
-    { @"LeftAngleBracket;", @"\U000027e8" },
-    { @"LeftArrow;", @"\U00002190" },
-    { @"LeftArrowBar;", @"\U000021e4" },
-    { @"LeftArrowRightArrow;", @"\U000021c6" },
-    { @"LeftCeiling;", @"\U00002308" },
-    { @"LeftDoubleBracket;", @"\U000027e6" },
-    { @"LeftDownTeeVector;", @"\U00002961" },
-    { @"LeftDownVector;", @"\U000021c3" },
-    { @"LeftDownVectorBar;", @"\U00002959" },
-    { @"LeftFloor;", @"\U0000230a" },
-    { @"LeftRightArrow;", @"\U00002194" },
-    { @"LeftRightVector;", @"\U0000294e" },
-    { @"LeftTee;", @"\U000022a3" },
-    { @"LeftTeeArrow;", @"\U000021a4" },
-    { @"LeftTeeVector;", @"\U0000295a" },
-    { @"LeftTriangle;", @"\U000022b2" },
-    { @"LeftTriangleBar;", @"\U000029cf" },
-    { @"LeftTriangleEqual;", @"\U000022b4" },
-    { @"LeftUpDownVector;", @"\U00002951" },
-    { @"LeftUpTeeVector;", @"\U00002960" },
-    { @"LeftUpVector;", @"\U000021bf" },
-    { @"LeftUpVectorBar;", @"\U00002958" },
-    { @"LeftVector;", @"\U000021bc" },
-    { @"LeftVectorBar;", @"\U00002952" },
-    { @"Leftarrow;", @"\U000021d0" },
-    { @"Leftrightarrow;", @"\U000021d4" },
-    { @"LessEqualGreater;", @"\U000022da" },
-    { @"LessFullEqual;", @"\U00002266" },
-    { @"LessGreater;", @"\U00002276" },
-    { @"LessLess;", @"\U00002aa1" },
-    { @"LessSlantEqual;", @"\U00002a7d" },
-    { @"LessTilde;", @"\U00002272" },
-    { @"Lfr;", @"\U0001d50f" },
-    { @"Ll;", @"\U000022d8" },
-    { @"Lleftarrow;", @"\U000021da" },
-    { @"Lmidot;", @"\U0000013f" },
-    { @"LongLeftArrow;", @"\U000027f5" },
-    { @"LongLeftRightArrow;", @"\U000027f7" },
-    { @"LongRightArrow;", @"\U000027f6" },
-    { @"Longleftarrow;", @"\U000027f8" },
-    { @"Longleftrightarrow;", @"\U000027fa" },
-    { @"Longrightarrow;", @"\U000027f9" },
-    { @"Lopf;", @"\U0001d543" },
-    { @"LowerLeftArrow;", @"\U00002199" },
-    { @"LowerRightArrow;", @"\U00002198" },
-    { @"Lscr;", @"\U00002112" },
-    { @"Lsh;", @"\U000021b0" },
-    { @"Lstrok;", @"\U00000141" },
-    { @"Lt;", @"\U0000226a" },
-    { @"Map;", @"\U00002905" },
-    { @"Mcy;", @"\U0000041c" },
-    { @"MediumSpace;", @"\U0000205f" },
-    { @"Mellintrf;", @"\U00002133" },
-    { @"Mfr;", @"\U0001d510" },
-    { @"MinusPlus;", @"\U00002213" },
-    { @"Mopf;", @"\U0001d544" },
-    { @"Mscr;", @"\U00002133" },
-    { @"Mu;", @"\U0000039c" },
-    { @"NJcy;", @"\U0000040a" },
-    { @"Nacute;", @"\U00000143" },
-    { @"Ncaron;", @"\U00000147" },
-    { @"Ncedil;", @"\U00000145" },
-    { @"Ncy;", @"\U0000041d" },
-    { @"NegativeMediumSpace;", @"\U0000200b" },
-    { @"NegativeThickSpace;", @"\U0000200b" },
-    { @"NegativeThinSpace;", @"\U0000200b" },
-    { @"NegativeVeryThinSpace;", @"\U0000200b" },
-    { @"NestedGreaterGreater;", @"\U0000226b" },
-    { @"NestedLessLess;", @"\U0000226a" },
-    { @"NewLine;", @"\n" },
-    { @"Nfr;", @"\U0001d511" },
-    { @"NoBreak;", @"\U00002060" },
-    { @"NonBreakingSpace;", @"\U000000a0" },
-    { @"Nopf;", @"\U00002115" },
-    { @"Not;", @"\U00002aec" },
-    { @"NotCongruent;", @"\U00002262" },
-    { @"NotCupCap;", @"\U0000226d" },
-    { @"NotDoubleVerticalBar;", @"\U00002226" },
-    { @"NotElement;", @"\U00002209" },
-    { @"NotEqual;", @"\U00002260" },
-    { @"NotEqualTilde;", @"\U00002242\U00000338" },
-    { @"NotExists;", @"\U00002204" },
-    { @"NotGreater;", @"\U0000226f" },
-    { @"NotGreaterEqual;", @"\U00002271" },
-    { @"NotGreaterFullEqual;", @"\U00002267\U00000338" },
-    { @"NotGreaterGreater;", @"\U0000226b\U00000338" },
-    { @"NotGreaterLess;", @"\U00002279" },
-    { @"NotGreaterSlantEqual;", @"\U00002a7e\U00000338" },
-    { @"NotGreaterTilde;", @"\U00002275" },
-    { @"NotHumpDownHump;", @"\U0000224e\U00000338" },
-    { @"NotHumpEqual;", @"\U0000224f\U00000338" },
-    { @"NotLeftTriangle;", @"\U000022ea" },
-    { @"NotLeftTriangleBar;", @"\U000029cf\U00000338" },
-    { @"NotLeftTriangleEqual;", @"\U000022ec" },
-    { @"NotLess;", @"\U0000226e" },
-    { @"NotLessEqual;", @"\U00002270" },
-    { @"NotLessGreater;", @"\U00002278" },
-    { @"NotLessLess;", @"\U0000226a\U00000338" },
-    { @"NotLessSlantEqual;", @"\U00002a7d\U00000338" },
-    { @"NotLessTilde;", @"\U00002274" },
-    { @"NotNestedGreaterGreater;", @"\U00002aa2\U00000338" },
-    { @"NotNestedLessLess;", @"\U00002aa1\U00000338" },
-    { @"NotPrecedes;", @"\U00002280" },
-    { @"NotPrecedesEqual;", @"\U00002aaf\U00000338" },
-    { @"NotPrecedesSlantEqual;", @"\U000022e0" },
-    { @"NotReverseElement;", @"\U0000220c" },
-    { @"NotRightTriangle;", @"\U000022eb" },
-    { @"NotRightTriangleBar;", @"\U000029d0\U00000338" },
-    { @"NotRightTriangleEqual;", @"\U000022ed" },
-    { @"NotSquareSubset;", @"\U0000228f\U00000338" },
-    { @"NotSquareSubsetEqual;", @"\U000022e2" },
-    { @"NotSquareSuperset;", @"\U00002290\U00000338" },
-    { @"NotSquareSupersetEqual;", @"\U000022e3" },
-    { @"NotSubset;", @"\U00002282\U000020d2" },
-    { @"NotSubsetEqual;", @"\U00002288" },
-    { @"NotSucceeds;", @"\U00002281" },
-    { @"NotSucceedsEqual;", @"\U00002ab0\U00000338" },
-    { @"NotSucceedsSlantEqual;", @"\U000022e1" },
-    { @"NotSucceedsTilde;", @"\U0000227f\U00000338" },
-    { @"NotSuperset;", @"\U00002283\U000020d2" },
-    { @"NotSupersetEqual;", @"\U00002289" },
-    { @"NotTilde;", @"\U00002241" },
-    { @"NotTildeEqual;", @"\U00002244" },
-    { @"NotTildeFullEqual;", @"\U00002247" },
-    { @"NotTildeTilde;", @"\U00002249" },
-    { @"NotVerticalBar;", @"\U00002224" },
-    { @"Nscr;", @"\U0001d4a9" },
-    { @"Ntilde;", @"\U000000d1" },
-    { @"Nu;", @"\U0000039d" },
-    { @"OElig;", @"\U00000152" },
-    { @"Oacute;", @"\U000000d3" },
-    { @"Ocirc;", @"\U000000d4" },
-    { @"Ocy;", @"\U0000041e" },
-    { @"Odblac;", @"\U00000150" },
-    { @"Ofr;", @"\U0001d512" },
-    { @"Ograve;", @"\U000000d2" },
-    { @"Omacr;", @"\U0000014c" },
-    { @"Omega;", @"\U000003a9" },
-    { @"Omicron;", @"\U0000039f" },
-    { @"Oopf;", @"\U0001d546" },
-    { @"OpenCurlyDoubleQuote;", @"\U0000201c" },
-    { @"OpenCurlyQuote;", @"\U00002018" },
-    { @"Or;", @"\U00002a54" },
-    { @"Oscr;", @"\U0001d4aa" },
-    { @"Oslash;", @"\U000000d8" },
-    { @"Otilde;", @"\U000000d5" },
-    { @"Otimes;", @"\U00002a37" },
-    { @"Ouml;", @"\U000000d6" },
-    { @"OverBar;", @"\U0000203e" },
-    { @"OverBrace;", @"\U000023de" },
-    { @"OverBracket;", @"\U000023b4" },
-    { @"OverParenthesis;", @"\U000023dc" },
-    { @"PartialD;", @"\U00002202" },
-    { @"Pcy;", @"\U0000041f" },
-    { @"Pfr;", @"\U0001d513" },
-    { @"Phi;", @"\U000003a6" },
-    { @"Pi;", @"\U000003a0" },
-    { @"PlusMinus;", @"\U000000b1" },
-    { @"Poincareplane;", @"\U0000210c" },
-    { @"Popf;", @"\U00002119" },
-    { @"Pr;", @"\U00002abb" },
-    { @"Precedes;", @"\U0000227a" },
-    { @"PrecedesEqual;", @"\U00002aaf" },
-    { @"PrecedesSlantEqual;", @"\U0000227c" },
-    { @"PrecedesTilde;", @"\U0000227e" },
-    { @"Prime;", @"\U00002033" },
-    { @"Product;", @"\U0000220f" },
-    { @"Proportion;", @"\U00002237" },
-    { @"Proportional;", @"\U0000221d" },
-    { @"Pscr;", @"\U0001d4ab" },
-    { @"Psi;", @"\U000003a8" },
-    { @"QUOT;", @"\"" },
-    { @"Qfr;", @"\U0001d514" },
-    { @"Qopf;", @"\U0000211a" },
-    { @"Qscr;", @"\U0001d4ac" },
-    { @"RBarr;", @"\U00002910" },
-    { @"REG;", @"\U000000ae" },
-    { @"Racute;", @"\U00000154" },
-    { @"Rang;", @"\U000027eb" },
-    { @"Rarr;", @"\U000021a0" },
-    { @"Rarrtl;", @"\U00002916" },
-    { @"Rcaron;", @"\U00000158" },
-    { @"Rcedil;", @"\U00000156" },
-    { @"Rcy;", @"\U00000420" },
-    { @"Re;", @"\U0000211c" },
-    { @"ReverseElement;", @"\U0000220b" },
-    { @"ReverseEquilibrium;", @"\U000021cb" },
-    { @"ReverseUpEquilibrium;", @"\U0000296f" },
-    { @"Rfr;", @"\U0000211c" },
-    { @"Rho;", @"\U000003a1" },
-    { @"RightAngleBracket;", @"\U000027e9" },
-    { @"RightArrow;", @"\U00002192" },
-    { @"RightArrowBar;", @"\U000021e5" },
-    { @"RightArrowLeftArrow;", @"\U000021c4" },
-    { @"RightCeiling;", @"\U00002309" },
-    { @"RightDoubleBracket;", @"\U000027e7" },
-    { @"RightDownTeeVector;", @"\U0000295d" },
-    { @"RightDownVector;", @"\U000021c2" },
-    { @"RightDownVectorBar;", @"\U00002955" },
-    { @"RightFloor;", @"\U0000230b" },
-    { @"RightTee;", @"\U000022a2" },
-    { @"RightTeeArrow;", @"\U000021a6" },
-    { @"RightTeeVector;", @"\U0000295b" },
-    { @"RightTriangle;", @"\U000022b3" },
-    { @"RightTriangleBar;", @"\U000029d0" },
-    { @"RightTriangleEqual;", @"\U000022b5" },
-    { @"RightUpDownVector;", @"\U0000294f" },
-    { @"RightUpTeeVector;", @"\U0000295c" },
-    { @"RightUpVector;", @"\U000021be" },
-    { @"RightUpVectorBar;", @"\U00002954" },
-    { @"RightVector;", @"\U000021c0" },
-    { @"RightVectorBar;", @"\U00002953" },
-    { @"Rightarrow;", @"\U000021d2" },
-    { @"Ropf;", @"\U0000211d" },
-    { @"RoundImplies;", @"\U00002970" },
-    { @"Rrightarrow;", @"\U000021db" },
-    { @"Rscr;", @"\U0000211b" },
-    { @"Rsh;", @"\U000021b1" },
-    { @"RuleDelayed;", @"\U000029f4" },
-    { @"SHCHcy;", @"\U00000429" },
-    { @"SHcy;", @"\U00000428" },
-    { @"SOFTcy;", @"\U0000042c" },
-    { @"Sacute;", @"\U0000015a" },
-    { @"Sc;", @"\U00002abc" },
-    { @"Scaron;", @"\U00000160" },
-    { @"Scedil;", @"\U0000015e" },
-    { @"Scirc;", @"\U0000015c" },
-    { @"Scy;", @"\U00000421" },
-    { @"Sfr;", @"\U0001d516" },
-    { @"ShortDownArrow;", @"\U00002193" },
-    { @"ShortLeftArrow;", @"\U00002190" },
-    { @"ShortRightArrow;", @"\U00002192" },
-    { @"ShortUpArrow;", @"\U00002191" },
-    { @"Sigma;", @"\U000003a3" },
-    { @"SmallCircle;", @"\U00002218" },
-    { @"Sopf;", @"\U0001d54a" },
-    { @"Sqrt;", @"\U0000221a" },
-    { @"Square;", @"\U000025a1" },
-    { @"SquareIntersection;", @"\U00002293" },
-    { @"SquareSubset;", @"\U0000228f" },
-    { @"SquareSubsetEqual;", @"\U00002291" },
-    { @"SquareSuperset;", @"\U00002290" },
-    { @"SquareSupersetEqual;", @"\U00002292" },
-    { @"SquareUnion;", @"\U00002294" },
-    { @"Sscr;", @"\U0001d4ae" },
-    { @"Star;", @"\U000022c6" },
-    { @"Sub;", @"\U000022d0" },
-    { @"Subset;", @"\U000022d0" },
-    { @"SubsetEqual;", @"\U00002286" },
-    { @"Succeeds;", @"\U0000227b" },
-    { @"SucceedsEqual;", @"\U00002ab0" },
-    { @"SucceedsSlantEqual;", @"\U0000227d" },
-    { @"SucceedsTilde;", @"\U0000227f" },
-    { @"SuchThat;", @"\U0000220b" },
-    { @"Sum;", @"\U00002211" },
-    { @"Sup;", @"\U000022d1" },
-    { @"Superset;", @"\U00002283" },
-    { @"SupersetEqual;", @"\U00002287" },
-    { @"Supset;", @"\U000022d1" },
-    { @"THORN;", @"\U000000de" },
-    { @"TRADE;", @"\U00002122" },
-    { @"TSHcy;", @"\U0000040b" },
-    { @"TScy;", @"\U00000426" },
-    { @"Tab;", @"\t" },
-    { @"Tau;", @"\U000003a4" },
-    { @"Tcaron;", @"\U00000164" },
-    { @"Tcedil;", @"\U00000162" },
-    { @"Tcy;", @"\U00000422" },
-    { @"Tfr;", @"\U0001d517" },
-    { @"Therefore;", @"\U00002234" },
-    { @"Theta;", @"\U00000398" },
-    { @"ThickSpace;", @"\U0000205f\U0000200a" },
-    { @"ThinSpace;", @"\U00002009" },
-    { @"Tilde;", @"\U0000223c" },
-    { @"TildeEqual;", @"\U00002243" },
-    { @"TildeFullEqual;", @"\U00002245" },
-    { @"TildeTilde;", @"\U00002248" },
-    { @"Topf;", @"\U0001d54b" },
-    { @"TripleDot;", @"\U000020db" },
-    { @"Tscr;", @"\U0001d4af" },
-    { @"Tstrok;", @"\U00000166" },
-    { @"Uacute;", @"\U000000da" },
-    { @"Uarr;", @"\U0000219f" },
-    { @"Uarrocir;", @"\U00002949" },
-    { @"Ubrcy;", @"\U0000040e" },
-    { @"Ubreve;", @"\U0000016c" },
-    { @"Ucirc;", @"\U000000db" },
-    { @"Ucy;", @"\U00000423" },
-    { @"Udblac;", @"\U00000170" },
-    { @"Ufr;", @"\U0001d518" },
-    { @"Ugrave;", @"\U000000d9" },
-    { @"Umacr;", @"\U0000016a" },
-    { @"UnderBar;", @"_" },
-    { @"UnderBrace;", @"\U000023df" },
-    { @"UnderBracket;", @"\U000023b5" },
-    { @"UnderParenthesis;", @"\U000023dd" },
-    { @"Union;", @"\U000022c3" },
-    { @"UnionPlus;", @"\U0000228e" },
-    { @"Uogon;", @"\U00000172" },
-    { @"Uopf;", @"\U0001d54c" },
-    { @"UpArrow;", @"\U00002191" },
-    { @"UpArrowBar;", @"\U00002912" },
-    { @"UpArrowDownArrow;", @"\U000021c5" },
-    { @"UpDownArrow;", @"\U00002195" },
-    { @"UpEquilibrium;", @"\U0000296e" },
-    { @"UpTee;", @"\U000022a5" },
-    { @"UpTeeArrow;", @"\U000021a5" },
-    { @"Uparrow;", @"\U000021d1" },
-    { @"Updownarrow;", @"\U000021d5" },
-    { @"UpperLeftArrow;", @"\U00002196" },
-    { @"UpperRightArrow;", @"\U00002197" },
-    { @"Upsi;", @"\U000003d2" },
-    { @"Upsilon;", @"\U000003a5" },
-    { @"Uring;", @"\U0000016e" },
-    { @"Uscr;", @"\U0001d4b0" },
-    { @"Utilde;", @"\U00000168" },
-    { @"Uuml;", @"\U000000dc" },
-    { @"VDash;", @"\U000022ab" },
-    { @"Vbar;", @"\U00002aeb" },
-    { @"Vcy;", @"\U00000412" },
-    { @"Vdash;", @"\U000022a9" },
-    { @"Vdashl;", @"\U00002ae6" },
-    { @"Vee;", @"\U000022c1" },
-    { @"Verbar;", @"\U00002016" },
-    { @"Vert;", @"\U00002016" },
-    { @"VerticalBar;", @"\U00002223" },
-    { @"VerticalLine;", @"|" },
-    { @"VerticalSeparator;", @"\U00002758" },
-    { @"VerticalTilde;", @"\U00002240" },
-    { @"VeryThinSpace;", @"\U0000200a" },
-    { @"Vfr;", @"\U0001d519" },
-    { @"Vopf;", @"\U0001d54d" },
-    { @"Vscr;", @"\U0001d4b1" },
-    { @"Vvdash;", @"\U000022aa" },
-    { @"Wcirc;", @"\U00000174" },
-    { @"Wedge;", @"\U000022c0" },
-    { @"Wfr;", @"\U0001d51a" },
-    { @"Wopf;", @"\U0001d54e" },
-    { @"Wscr;", @"\U0001d4b2" },
-    { @"Xfr;", @"\U0001d51b" },
-    { @"Xi;", @"\U0000039e" },
-    { @"Xopf;", @"\U0001d54f" },
-    { @"Xscr;", @"\U0001d4b3" },
-    { @"YAcy;", @"\U0000042f" },
-    { @"YIcy;", @"\U00000407" },
-    { @"YUcy;", @"\U0000042e" },
-    { @"Yacute;", @"\U000000dd" },
-    { @"Ycirc;", @"\U00000176" },
-    { @"Ycy;", @"\U0000042b" },
-    { @"Yfr;", @"\U0001d51c" },
-    { @"Yopf;", @"\U0001d550" },
-    { @"Yscr;", @"\U0001d4b4" },
-    { @"Yuml;", @"\U00000178" },
-    { @"ZHcy;", @"\U00000416" },
-    { @"Zacute;", @"\U00000179" },
-    { @"Zcaron;", @"\U0000017d" },
-    { @"Zcy;", @"\U00000417" },
-    { @"Zdot;", @"\U0000017b" },
-    { @"ZeroWidthSpace;", @"\U0000200b" },
-    { @"Zeta;", @"\U00000396" },
-    { @"Zfr;", @"\U00002128" },
-    { @"Zopf;", @"\U00002124" },
-    { @"Zscr;", @"\U0001d4b5" },
-    { @"aacute;", @"\U000000e1" },
-    { @"abreve;", @"\U00000103" },
-    { @"ac;", @"\U0000223e" },
-    { @"acE;", @"\U0000223e\U00000333" },
-    { @"acd;", @"\U0000223f" },
-    { @"acirc;", @"\U000000e2" },
-    { @"acute;", @"\U000000b4" },
-    { @"acy;", @"\U00000430" },
-    { @"aelig;", @"\U000000e6" },
-    { @"af;", @"\U00002061" },
-    { @"afr;", @"\U0001d51e" },
-    { @"agrave;", @"\U000000e0" },
-    { @"alefsym;", @"\U00002135" },
-    { @"aleph;", @"\U00002135" },
-    { @"alpha;", @"\U000003b1" },
-    { @"amacr;", @"\U00000101" },
-    { @"amalg;", @"\U00002a3f" },
-    { @"amp;", @"&" },
-    { @"and;", @"\U00002227" },
-    { @"andand;", @"\U00002a55" },
-    { @"andd;", @"\U00002a5c" },
-    { @"andslope;", @"\U00002a58" },
-    { @"andv;", @"\U00002a5a" },
-    { @"ang;", @"\U00002220" },
-    { @"ange;", @"\U000029a4" },
-    { @"angle;", @"\U00002220" },
-    { @"angmsd;", @"\U00002221" },
-    { @"angmsdaa;", @"\U000029a8" },
-    { @"angmsdab;", @"\U000029a9" },
-    { @"angmsdac;", @"\U000029aa" },
-    { @"angmsdad;", @"\U000029ab" },
-    { @"angmsdae;", @"\U000029ac" },
-    { @"angmsdaf;", @"\U000029ad" },
-    { @"angmsdag;", @"\U000029ae" },
-    { @"angmsdah;", @"\U000029af" },
-    { @"angrt;", @"\U0000221f" },
-    { @"angrtvb;", @"\U000022be" },
-    { @"angrtvbd;", @"\U0000299d" },
-    { @"angsph;", @"\U00002222" },
-    { @"angst;", @"\U000000c5" },
-    { @"angzarr;", @"\U0000237c" },
-    { @"aogon;", @"\U00000105" },
-    { @"aopf;", @"\U0001d552" },
-    { @"ap;", @"\U00002248" },
-    { @"apE;", @"\U00002a70" },
-    { @"apacir;", @"\U00002a6f" },
-    { @"ape;", @"\U0000224a" },
-    { @"apid;", @"\U0000224b" },
-    { @"apos;", @"'" },
-    { @"approx;", @"\U00002248" },
-    { @"approxeq;", @"\U0000224a" },
-    { @"aring;", @"\U000000e5" },
-    { @"ascr;", @"\U0001d4b6" },
-    { @"ast;", @"*" },
-    { @"asymp;", @"\U00002248" },
-    { @"asympeq;", @"\U0000224d" },
-    { @"atilde;", @"\U000000e3" },
-    { @"auml;", @"\U000000e4" },
-    { @"awconint;", @"\U00002233" },
-    { @"awint;", @"\U00002a11" },
-    { @"bNot;", @"\U00002aed" },
-    { @"backcong;", @"\U0000224c" },
-    { @"backepsilon;", @"\U000003f6" },
-    { @"backprime;", @"\U00002035" },
-    { @"backsim;", @"\U0000223d" },
-    { @"backsimeq;", @"\U000022cd" },
-    { @"barvee;", @"\U000022bd" },
-    { @"barwed;", @"\U00002305" },
-    { @"barwedge;", @"\U00002305" },
-    { @"bbrk;", @"\U000023b5" },
-    { @"bbrktbrk;", @"\U000023b6" },
-    { @"bcong;", @"\U0000224c" },
-    { @"bcy;", @"\U00000431" },
-    { @"bdquo;", @"\U0000201e" },
-    { @"becaus;", @"\U00002235" },
-    { @"because;", @"\U00002235" },
-    { @"bemptyv;", @"\U000029b0" },
-    { @"bepsi;", @"\U000003f6" },
-    { @"bernou;", @"\U0000212c" },
-    { @"beta;", @"\U000003b2" },
-    { @"beth;", @"\U00002136" },
-    { @"between;", @"\U0000226c" },
-    { @"bfr;", @"\U0001d51f" },
-    { @"bigcap;", @"\U000022c2" },
-    { @"bigcirc;", @"\U000025ef" },
-    { @"bigcup;", @"\U000022c3" },
-    { @"bigodot;", @"\U00002a00" },
-    { @"bigoplus;", @"\U00002a01" },
-    { @"bigotimes;", @"\U00002a02" },
-    { @"bigsqcup;", @"\U00002a06" },
-    { @"bigstar;", @"\U00002605" },
-    { @"bigtriangledown;", @"\U000025bd" },
-    { @"bigtriangleup;", @"\U000025b3" },
-    { @"biguplus;", @"\U00002a04" },
-    { @"bigvee;", @"\U000022c1" },
-    { @"bigwedge;", @"\U000022c0" },
-    { @"bkarow;", @"\U0000290d" },
-    { @"blacklozenge;", @"\U000029eb" },
-    { @"blacksquare;", @"\U000025aa" },
-    { @"blacktriangle;", @"\U000025b4" },
-    { @"blacktriangledown;", @"\U000025be" },
-    { @"blacktriangleleft;", @"\U000025c2" },
-    { @"blacktriangleright;", @"\U000025b8" },
-    { @"blank;", @"\U00002423" },
-    { @"blk12;", @"\U00002592" },
-    { @"blk14;", @"\U00002591" },
-    { @"blk34;", @"\U00002593" },
-    { @"block;", @"\U00002588" },
-    { @"bne;", @"=\U000020e5" },
-    { @"bnequiv;", @"\U00002261\U000020e5" },
-    { @"bnot;", @"\U00002310" },
-    { @"bopf;", @"\U0001d553" },
-    { @"bot;", @"\U000022a5" },
-    { @"bottom;", @"\U000022a5" },
-    { @"bowtie;", @"\U000022c8" },
-    { @"boxDL;", @"\U00002557" },
-    { @"boxDR;", @"\U00002554" },
-    { @"boxDl;", @"\U00002556" },
-    { @"boxDr;", @"\U00002553" },
-    { @"boxH;", @"\U00002550" },
-    { @"boxHD;", @"\U00002566" },
-    { @"boxHU;", @"\U00002569" },
-    { @"boxHd;", @"\U00002564" },
-    { @"boxHu;", @"\U00002567" },
-    { @"boxUL;", @"\U0000255d" },
-    { @"boxUR;", @"\U0000255a" },
-    { @"boxUl;", @"\U0000255c" },
-    { @"boxUr;", @"\U00002559" },
-    { @"boxV;", @"\U00002551" },
-    { @"boxVH;", @"\U0000256c" },
-    { @"boxVL;", @"\U00002563" },
-    { @"boxVR;", @"\U00002560" },
-    { @"boxVh;", @"\U0000256b" },
-    { @"boxVl;", @"\U00002562" },
-    { @"boxVr;", @"\U0000255f" },
-    { @"boxbox;", @"\U000029c9" },
-    { @"boxdL;", @"\U00002555" },
-    { @"boxdR;", @"\U00002552" },
-    { @"boxdl;", @"\U00002510" },
-    { @"boxdr;", @"\U0000250c" },
-    { @"boxh;", @"\U00002500" },
-    { @"boxhD;", @"\U00002565" },
-    { @"boxhU;", @"\U00002568" },
-    { @"boxhd;", @"\U0000252c" },
-    { @"boxhu;", @"\U00002534" },
-    { @"boxminus;", @"\U0000229f" },
-    { @"boxplus;", @"\U0000229e" },
-    { @"boxtimes;", @"\U000022a0" },
-    { @"boxuL;", @"\U0000255b" },
-    { @"boxuR;", @"\U00002558" },
-    { @"boxul;", @"\U00002518" },
-    { @"boxur;", @"\U00002514" },
-    { @"boxv;", @"\U00002502" },
-    { @"boxvH;", @"\U0000256a" },
-    { @"boxvL;", @"\U00002561" },
-    { @"boxvR;", @"\U0000255e" },
-    { @"boxvh;", @"\U0000253c" },
-    { @"boxvl;", @"\U00002524" },
-    { @"boxvr;", @"\U0000251c" },
-    { @"bprime;", @"\U00002035" },
-    { @"breve;", @"\U000002d8" },
-    { @"brvbar;", @"\U000000a6" },
-    { @"bscr;", @"\U0001d4b7" },
-    { @"bsemi;", @"\U0000204f" },
-    { @"bsim;", @"\U0000223d" },
-    { @"bsime;", @"\U000022cd" },
-    { @"bsol;", @"\\" },
-    { @"bsolb;", @"\U000029c5" },
-    { @"bsolhsub;", @"\U000027c8" },
-    { @"bull;", @"\U00002022" },
-    { @"bullet;", @"\U00002022" },
-    { @"bump;", @"\U0000224e" },
-    { @"bumpE;", @"\U00002aae" },
-    { @"bumpe;", @"\U0000224f" },
-    { @"bumpeq;", @"\U0000224f" },
-    { @"cacute;", @"\U00000107" },
-    { @"cap;", @"\U00002229" },
-    { @"capand;", @"\U00002a44" },
-    { @"capbrcup;", @"\U00002a49" },
-    { @"capcap;", @"\U00002a4b" },
-    { @"capcup;", @"\U00002a47" },
-    { @"capdot;", @"\U00002a40" },
-    { @"caps;", @"\U00002229\U0000fe00" },
-    { @"caret;", @"\U00002041" },
-    { @"caron;", @"\U000002c7" },
-    { @"ccaps;", @"\U00002a4d" },
-    { @"ccaron;", @"\U0000010d" },
-    { @"ccedil;", @"\U000000e7" },
-    { @"ccirc;", @"\U00000109" },
-    { @"ccups;", @"\U00002a4c" },
-    { @"ccupssm;", @"\U00002a50" },
-    { @"cdot;", @"\U0000010b" },
-    { @"cedil;", @"\U000000b8" },
-    { @"cemptyv;", @"\U000029b2" },
-    { @"cent;", @"\U000000a2" },
-    { @"centerdot;", @"\U000000b7" },
-    { @"cfr;", @"\U0001d520" },
-    { @"chcy;", @"\U00000447" },
-    { @"check;", @"\U00002713" },
-    { @"checkmark;", @"\U00002713" },
-    { @"chi;", @"\U000003c7" },
-    { @"cir;", @"\U000025cb" },
-    { @"cirE;", @"\U000029c3" },
-    { @"circ;", @"\U000002c6" },
-    { @"circeq;", @"\U00002257" },
-    { @"circlearrowleft;", @"\U000021ba" },
-    { @"circlearrowright;", @"\U000021bb" },
-    { @"circledR;", @"\U000000ae" },
-    { @"circledS;", @"\U000024c8" },
-    { @"circledast;", @"\U0000229b" },
-    { @"circledcirc;", @"\U0000229a" },
-    { @"circleddash;", @"\U0000229d" },
-    { @"cire;", @"\U00002257" },
-    { @"cirfnint;", @"\U00002a10" },
-    { @"cirmid;", @"\U00002aef" },
-    { @"cirscir;", @"\U000029c2" },
-    { @"clubs;", @"\U00002663" },
-    { @"clubsuit;", @"\U00002663" },
-    { @"colon;", @":" },
-    { @"colone;", @"\U00002254" },
-    { @"coloneq;", @"\U00002254" },
-    { @"comma;", @"," },
-    { @"commat;", @"\U00000040" },
-    { @"comp;", @"\U00002201" },
-    { @"compfn;", @"\U00002218" },
-    { @"complement;", @"\U00002201" },
-    { @"complexes;", @"\U00002102" },
-    { @"cong;", @"\U00002245" },
-    { @"congdot;", @"\U00002a6d" },
-    { @"conint;", @"\U0000222e" },
-    { @"copf;", @"\U0001d554" },
-    { @"coprod;", @"\U00002210" },
-    { @"copy;", @"\U000000a9" },
-    { @"copysr;", @"\U00002117" },
-    { @"crarr;", @"\U000021b5" },
-    { @"cross;", @"\U00002717" },
-    { @"cscr;", @"\U0001d4b8" },
-    { @"csub;", @"\U00002acf" },
-    { @"csube;", @"\U00002ad1" },
-    { @"csup;", @"\U00002ad0" },
-    { @"csupe;", @"\U00002ad2" },
-    { @"ctdot;", @"\U000022ef" },
-    { @"cudarrl;", @"\U00002938" },
-    { @"cudarrr;", @"\U00002935" },
-    { @"cuepr;", @"\U000022de" },
-    { @"cuesc;", @"\U000022df" },
-    { @"cularr;", @"\U000021b6" },
-    { @"cularrp;", @"\U0000293d" },
-    { @"cup;", @"\U0000222a" },
-    { @"cupbrcap;", @"\U00002a48" },
-    { @"cupcap;", @"\U00002a46" },
-    { @"cupcup;", @"\U00002a4a" },
-    { @"cupdot;", @"\U0000228d" },
-    { @"cupor;", @"\U00002a45" },
-    { @"cups;", @"\U0000222a\U0000fe00" },
-    { @"curarr;", @"\U000021b7" },
-    { @"curarrm;", @"\U0000293c" },
-    { @"curlyeqprec;", @"\U000022de" },
-    { @"curlyeqsucc;", @"\U000022df" },
-    { @"curlyvee;", @"\U000022ce" },
-    { @"curlywedge;", @"\U000022cf" },
-    { @"curren;", @"\U000000a4" },
-    { @"curvearrowleft;", @"\U000021b6" },
-    { @"curvearrowright;", @"\U000021b7" },
-    { @"cuvee;", @"\U000022ce" },
-    { @"cuwed;", @"\U000022cf" },
-    { @"cwconint;", @"\U00002232" },
-    { @"cwint;", @"\U00002231" },
-    { @"cylcty;", @"\U0000232d" },
-    { @"dArr;", @"\U000021d3" },
-    { @"dHar;", @"\U00002965" },
-    { @"dagger;", @"\U00002020" },
-    { @"daleth;", @"\U00002138" },
-    { @"darr;", @"\U00002193" },
-    { @"dash;", @"\U00002010" },
-    { @"dashv;", @"\U000022a3" },
-    { @"dbkarow;", @"\U0000290f" },
-    { @"dblac;", @"\U000002dd" },
-    { @"dcaron;", @"\U0000010f" },
-    { @"dcy;", @"\U00000434" },
-    { @"dd;", @"\U00002146" },
-    { @"ddagger;", @"\U00002021" },
-    { @"ddarr;", @"\U000021ca" },
-    { @"ddotseq;", @"\U00002a77" },
-    { @"deg;", @"\U000000b0" },
-    { @"delta;", @"\U000003b4" },
-    { @"demptyv;", @"\U000029b1" },
-    { @"dfisht;", @"\U0000297f" },
-    { @"dfr;", @"\U0001d521" },
-    { @"dharl;", @"\U000021c3" },
-    { @"dharr;", @"\U000021c2" },
-    { @"diam;", @"\U000022c4" },
-    { @"diamond;", @"\U000022c4" },
-    { @"diamondsuit;", @"\U00002666" },
-    { @"diams;", @"\U00002666" },
-    { @"die;", @"\U000000a8" },
-    { @"digamma;", @"\U000003dd" },
-    { @"disin;", @"\U000022f2" },
-    { @"div;", @"\U000000f7" },
-    { @"divide;", @"\U000000f7" },
-    { @"divideontimes;", @"\U000022c7" },
-    { @"divonx;", @"\U000022c7" },
-    { @"djcy;", @"\U00000452" },
-    { @"dlcorn;", @"\U0000231e" },
-    { @"dlcrop;", @"\U0000230d" },
-    { @"dollar;", @"\U00000024" },
-    { @"dopf;", @"\U0001d555" },
-    { @"dot;", @"\U000002d9" },
-    { @"doteq;", @"\U00002250" },
-    { @"doteqdot;", @"\U00002251" },
-    { @"dotminus;", @"\U00002238" },
-    { @"dotplus;", @"\U00002214" },
-    { @"dotsquare;", @"\U000022a1" },
-    { @"doublebarwedge;", @"\U00002306" },
-    { @"downarrow;", @"\U00002193" },
-    { @"downdownarrows;", @"\U000021ca" },
-    { @"downharpoonleft;", @"\U000021c3" },
-    { @"downharpoonright;", @"\U000021c2" },
-    { @"drbkarow;", @"\U00002910" },
-    { @"drcorn;", @"\U0000231f" },
-    { @"drcrop;", @"\U0000230c" },
-    { @"dscr;", @"\U0001d4b9" },
-    { @"dscy;", @"\U00000455" },
-    { @"dsol;", @"\U000029f6" },
-    { @"dstrok;", @"\U00000111" },
-    { @"dtdot;", @"\U000022f1" },
-    { @"dtri;", @"\U000025bf" },
-    { @"dtrif;", @"\U000025be" },
-    { @"duarr;", @"\U000021f5" },
-    { @"duhar;", @"\U0000296f" },
-    { @"dwangle;", @"\U000029a6" },
-    { @"dzcy;", @"\U0000045f" },
-    { @"dzigrarr;", @"\U000027ff" },
-    { @"eDDot;", @"\U00002a77" },
-    { @"eDot;", @"\U00002251" },
-    { @"eacute;", @"\U000000e9" },
-    { @"easter;", @"\U00002a6e" },
-    { @"ecaron;", @"\U0000011b" },
-    { @"ecir;", @"\U00002256" },
-    { @"ecirc;", @"\U000000ea" },
-    { @"ecolon;", @"\U00002255" },
-    { @"ecy;", @"\U0000044d" },
-    { @"edot;", @"\U00000117" },
-    { @"ee;", @"\U00002147" },
-    { @"efDot;", @"\U00002252" },
-    { @"efr;", @"\U0001d522" },
-    { @"eg;", @"\U00002a9a" },
-    { @"egrave;", @"\U000000e8" },
-    { @"egs;", @"\U00002a96" },
-    { @"egsdot;", @"\U00002a98" },
-    { @"el;", @"\U00002a99" },
-    { @"elinters;", @"\U000023e7" },
-    { @"ell;", @"\U00002113" },
-    { @"els;", @"\U00002a95" },
-    { @"elsdot;", @"\U00002a97" },
-    { @"emacr;", @"\U00000113" },
-    { @"empty;", @"\U00002205" },
-    { @"emptyset;", @"\U00002205" },
-    { @"emptyv;", @"\U00002205" },
-    { @"emsp13;", @"\U00002004" },
-    { @"emsp14;", @"\U00002005" },
-    { @"emsp;", @"\U00002003" },
-    { @"eng;", @"\U0000014b" },
-    { @"ensp;", @"\U00002002" },
-    { @"eogon;", @"\U00000119" },
-    { @"eopf;", @"\U0001d556" },
-    { @"epar;", @"\U000022d5" },
-    { @"eparsl;", @"\U000029e3" },
-    { @"eplus;", @"\U00002a71" },
-    { @"epsi;", @"\U000003b5" },
-    { @"epsilon;", @"\U000003b5" },
-    { @"epsiv;", @"\U000003f5" },
-    { @"eqcirc;", @"\U00002256" },
-    { @"eqcolon;", @"\U00002255" },
-    { @"eqsim;", @"\U00002242" },
-    { @"eqslantgtr;", @"\U00002a96" },
-    { @"eqslantless;", @"\U00002a95" },
-    { @"equals;", @"=" },
-    { @"equest;", @"\U0000225f" },
-    { @"equiv;", @"\U00002261" },
-    { @"equivDD;", @"\U00002a78" },
-    { @"eqvparsl;", @"\U000029e5" },
-    { @"erDot;", @"\U00002253" },
-    { @"erarr;", @"\U00002971" },
-    { @"escr;", @"\U0000212f" },
-    { @"esdot;", @"\U00002250" },
-    { @"esim;", @"\U00002242" },
-    { @"eta;", @"\U000003b7" },
-    { @"eth;", @"\U000000f0" },
-    { @"euml;", @"\U000000eb" },
-    { @"euro;", @"\U000020ac" },
-    { @"excl;", @"!" },
-    { @"exist;", @"\U00002203" },
-    { @"expectation;", @"\U00002130" },
-    { @"exponentiale;", @"\U00002147" },
-    { @"fallingdotseq;", @"\U00002252" },
-    { @"fcy;", @"\U00000444" },
-    { @"female;", @"\U00002640" },
-    { @"ffilig;", @"\U0000fb03" },
-    { @"fflig;", @"\U0000fb00" },
-    { @"ffllig;", @"\U0000fb04" },
-    { @"ffr;", @"\U0001d523" },
-    { @"filig;", @"\U0000fb01" },
-    { @"fjlig;", @"fj" },
-    { @"flat;", @"\U0000266d" },
-    { @"fllig;", @"\U0000fb02" },
-    { @"fltns;", @"\U000025b1" },
-    { @"fnof;", @"\U00000192" },
-    { @"fopf;", @"\U0001d557" },
-    { @"forall;", @"\U00002200" },
-    { @"fork;", @"\U000022d4" },
-    { @"forkv;", @"\U00002ad9" },
-    { @"fpartint;", @"\U00002a0d" },
-    { @"frac12;", @"\U000000bd" },
-    { @"frac13;", @"\U00002153" },
-    { @"frac14;", @"\U000000bc" },
-    { @"frac15;", @"\U00002155" },
-    { @"frac16;", @"\U00002159" },
-    { @"frac18;", @"\U0000215b" },
-    { @"frac23;", @"\U00002154" },
-    { @"frac25;", @"\U00002156" },
-    { @"frac34;", @"\U000000be" },
-    { @"frac35;", @"\U00002157" },
-    { @"frac38;", @"\U0000215c" },
-    { @"frac45;", @"\U00002158" },
-    { @"frac56;", @"\U0000215a" },
-    { @"frac58;", @"\U0000215d" },
-    { @"frac78;", @"\U0000215e" },
-    { @"frasl;", @"\U00002044" },
-    { @"frown;", @"\U00002322" },
-    { @"fscr;", @"\U0001d4bb" },
-    { @"gE;", @"\U00002267" },
-    { @"gEl;", @"\U00002a8c" },
-    { @"gacute;", @"\U000001f5" },
-    { @"gamma;", @"\U000003b3" },
-    { @"gammad;", @"\U000003dd" },
-    { @"gap;", @"\U00002a86" },
-    { @"gbreve;", @"\U0000011f" },
-    { @"gcirc;", @"\U0000011d" },
-    { @"gcy;", @"\U00000433" },
-    { @"gdot;", @"\U00000121" },
-    { @"ge;", @"\U00002265" },
-    { @"gel;", @"\U000022db" },
-    { @"geq;", @"\U00002265" },
-    { @"geqq;", @"\U00002267" },
-    { @"geqslant;", @"\U00002a7e" },
-    { @"ges;", @"\U00002a7e" },
-    { @"gescc;", @"\U00002aa9" },
-    { @"gesdot;", @"\U00002a80" },
-    { @"gesdoto;", @"\U00002a82" },
-    { @"gesdotol;", @"\U00002a84" },
-    { @"gesl;", @"\U000022db\U0000fe00" },
-    { @"gesles;", @"\U00002a94" },
-    { @"gfr;", @"\U0001d524" },
-    { @"gg;", @"\U0000226b" },
-    { @"ggg;", @"\U000022d9" },
-    { @"gimel;", @"\U00002137" },
-    { @"gjcy;", @"\U00000453" },
-    { @"gl;", @"\U00002277" },
-    { @"glE;", @"\U00002a92" },
-    { @"gla;", @"\U00002aa5" },
-    { @"glj;", @"\U00002aa4" },
-    { @"gnE;", @"\U00002269" },
-    { @"gnap;", @"\U00002a8a" },
-    { @"gnapprox;", @"\U00002a8a" },
-    { @"gne;", @"\U00002a88" },
-    { @"gneq;", @"\U00002a88" },
-    { @"gneqq;", @"\U00002269" },
-    { @"gnsim;", @"\U000022e7" },
-    { @"gopf;", @"\U0001d558" },
-    { @"grave;", @"\U00000060" },
-    { @"gscr;", @"\U0000210a" },
-    { @"gsim;", @"\U00002273" },
-    { @"gsime;", @"\U00002a8e" },
-    { @"gsiml;", @"\U00002a90" },
-    { @"gt;", @">" },
-    { @"gtcc;", @"\U00002aa7" },
-    { @"gtcir;", @"\U00002a7a" },
-    { @"gtdot;", @"\U000022d7" },
-    { @"gtlPar;", @"\U00002995" },
-    { @"gtquest;", @"\U00002a7c" },
-    { @"gtrapprox;", @"\U00002a86" },
-    { @"gtrarr;", @"\U00002978" },
-    { @"gtrdot;", @"\U000022d7" },
-    { @"gtreqless;", @"\U000022db" },
-    { @"gtreqqless;", @"\U00002a8c" },
-    { @"gtrless;", @"\U00002277" },
-    { @"gtrsim;", @"\U00002273" },
-    { @"gvertneqq;", @"\U00002269\U0000fe00" },
-    { @"gvnE;", @"\U00002269\U0000fe00" },
-    { @"hArr;", @"\U000021d4" },
-    { @"hairsp;", @"\U0000200a" },
-    { @"half;", @"\U000000bd" },
-    { @"hamilt;", @"\U0000210b" },
-    { @"hardcy;", @"\U0000044a" },
-    { @"harr;", @"\U00002194" },
-    { @"harrcir;", @"\U00002948" },
-    { @"harrw;", @"\U000021ad" },
-    { @"hbar;", @"\U0000210f" },
-    { @"hcirc;", @"\U00000125" },
-    { @"hearts;", @"\U00002665" },
-    { @"heartsuit;", @"\U00002665" },
-    { @"hellip;", @"\U00002026" },
-    { @"hercon;", @"\U000022b9" },
-    { @"hfr;", @"\U0001d525" },
-    { @"hksearow;", @"\U00002925" },
-    { @"hkswarow;", @"\U00002926" },
-    { @"hoarr;", @"\U000021ff" },
-    { @"homtht;", @"\U0000223b" },
-    { @"hookleftarrow;", @"\U000021a9" },
-    { @"hookrightarrow;", @"\U000021aa" },
-    { @"hopf;", @"\U0001d559" },
-    { @"horbar;", @"\U00002015" },
-    { @"hscr;", @"\U0001d4bd" },
-    { @"hslash;", @"\U0000210f" },
-    { @"hstrok;", @"\U00000127" },
-    { @"hybull;", @"\U00002043" },
-    { @"hyphen;", @"\U00002010" },
-    { @"iacute;", @"\U000000ed" },
-    { @"ic;", @"\U00002063" },
-    { @"icirc;", @"\U000000ee" },
-    { @"icy;", @"\U00000438" },
-    { @"iecy;", @"\U00000435" },
-    { @"iexcl;", @"\U000000a1" },
-    { @"iff;", @"\U000021d4" },
-    { @"ifr;", @"\U0001d526" },
-    { @"igrave;", @"\U000000ec" },
-    { @"ii;", @"\U00002148" },
-    { @"iiiint;", @"\U00002a0c" },
-    { @"iiint;", @"\U0000222d" },
-    { @"iinfin;", @"\U000029dc" },
-    { @"iiota;", @"\U00002129" },
-    { @"ijlig;", @"\U00000133" },
-    { @"imacr;", @"\U0000012b" },
-    { @"image;", @"\U00002111" },
-    { @"imagline;", @"\U00002110" },
-    { @"imagpart;", @"\U00002111" },
-    { @"imath;", @"\U00000131" },
-    { @"imof;", @"\U000022b7" },
-    { @"imped;", @"\U000001b5" },
-    { @"in;", @"\U00002208" },
-    { @"incare;", @"\U00002105" },
-    { @"infin;", @"\U0000221e" },
-    { @"infintie;", @"\U000029dd" },
-    { @"inodot;", @"\U00000131" },
-    { @"int;", @"\U0000222b" },
-    { @"intcal;", @"\U000022ba" },
-    { @"integers;", @"\U00002124" },
-    { @"intercal;", @"\U000022ba" },
-    { @"intlarhk;", @"\U00002a17" },
-    { @"intprod;", @"\U00002a3c" },
-    { @"iocy;", @"\U00000451" },
-    { @"iogon;", @"\U0000012f" },
-    { @"iopf;", @"\U0001d55a" },
-    { @"iota;", @"\U000003b9" },
-    { @"iprod;", @"\U00002a3c" },
-    { @"iquest;", @"\U000000bf" },
-    { @"iscr;", @"\U0001d4be" },
-    { @"isin;", @"\U00002208" },
-    { @"isinE;", @"\U000022f9" },
-    { @"isindot;", @"\U000022f5" },
-    { @"isins;", @"\U000022f4" },
-    { @"isinsv;", @"\U000022f3" },
-    { @"isinv;", @"\U00002208" },
-    { @"it;", @"\U00002062" },
-    { @"itilde;", @"\U00000129" },
-    { @"iukcy;", @"\U00000456" },
-    { @"iuml;", @"\U000000ef" },
-    { @"jcirc;", @"\U00000135" },
-    { @"jcy;", @"\U00000439" },
-    { @"jfr;", @"\U0001d527" },
-    { @"jmath;", @"\U00000237" },
-    { @"jopf;", @"\U0001d55b" },
-    { @"jscr;", @"\U0001d4bf" },
-    { @"jsercy;", @"\U00000458" },
-    { @"jukcy;", @"\U00000454" },
-    { @"kappa;", @"\U000003ba" },
-    { @"kappav;", @"\U000003f0" },
-    { @"kcedil;", @"\U00000137" },
-    { @"kcy;", @"\U0000043a" },
-    { @"kfr;", @"\U0001d528" },
-    { @"kgreen;", @"\U00000138" },
-    { @"khcy;", @"\U00000445" },
-    { @"kjcy;", @"\U0000045c" },
-    { @"kopf;", @"\U0001d55c" },
-    { @"kscr;", @"\U0001d4c0" },
-    { @"lAarr;", @"\U000021da" },
-    { @"lArr;", @"\U000021d0" },
-    { @"lAtail;", @"\U0000291b" },
-    { @"lBarr;", @"\U0000290e" },
-    { @"lE;", @"\U00002266" },
-    { @"lEg;", @"\U00002a8b" },
-    { @"lHar;", @"\U00002962" },
-    { @"lacute;", @"\U0000013a" },
-    { @"laemptyv;", @"\U000029b4" },
-    { @"lagran;", @"\U00002112" },
-    { @"lambda;", @"\U000003bb" },
-    { @"lang;", @"\U000027e8" },
-    { @"langd;", @"\U00002991" },
-    { @"langle;", @"\U000027e8" },
-    { @"lap;", @"\U00002a85" },
-    { @"laquo;", @"\U000000ab" },
-    { @"larr;", @"\U00002190" },
-    { @"larrb;", @"\U000021e4" },
-    { @"larrbfs;", @"\U0000291f" },
-    { @"larrfs;", @"\U0000291d" },
-    { @"larrhk;", @"\U000021a9" },
-    { @"larrlp;", @"\U000021ab" },
-    { @"larrpl;", @"\U00002939" },
-    { @"larrsim;", @"\U00002973" },
-    { @"larrtl;", @"\U000021a2" },
-    { @"lat;", @"\U00002aab" },
-    { @"latail;", @"\U00002919" },
-    { @"late;", @"\U00002aad" },
-    { @"lates;", @"\U00002aad\U0000fe00" },
-    { @"lbarr;", @"\U0000290c" },
-    { @"lbbrk;", @"\U00002772" },
-    { @"lbrace;", @"{" },
-    { @"lbrack;", @"[" },
-    { @"lbrke;", @"\U0000298b" },
-    { @"lbrksld;", @"\U0000298f" },
-    { @"lbrkslu;", @"\U0000298d" },
-    { @"lcaron;", @"\U0000013e" },
-    { @"lcedil;", @"\U0000013c" },
-    { @"lceil;", @"\U00002308" },
-    { @"lcub;", @"{" },
-    { @"lcy;", @"\U0000043b" },
-    { @"ldca;", @"\U00002936" },
-    { @"ldquo;", @"\U0000201c" },
-    { @"ldquor;", @"\U0000201e" },
-    { @"ldrdhar;", @"\U00002967" },
-    { @"ldrushar;", @"\U0000294b" },
-    { @"ldsh;", @"\U000021b2" },
-    { @"le;", @"\U00002264" },
-    { @"leftarrow;", @"\U00002190" },
-    { @"leftarrowtail;", @"\U000021a2" },
-    { @"leftharpoondown;", @"\U000021bd" },
-    { @"leftharpoonup;", @"\U000021bc" },
-    { @"leftleftarrows;", @"\U000021c7" },
-    { @"leftrightarrow;", @"\U00002194" },
-    { @"leftrightarrows;", @"\U000021c6" },
-    { @"leftrightharpoons;", @"\U000021cb" },
-    { @"leftrightsquigarrow;", @"\U000021ad" },
-    { @"leftthreetimes;", @"\U000022cb" },
-    { @"leg;", @"\U000022da" },
-    { @"leq;", @"\U00002264" },
-    { @"leqq;", @"\U00002266" },
-    { @"leqslant;", @"\U00002a7d" },
-    { @"les;", @"\U00002a7d" },
-    { @"lescc;", @"\U00002aa8" },
-    { @"lesdot;", @"\U00002a7f" },
-    { @"lesdoto;", @"\U00002a81" },
-    { @"lesdotor;", @"\U00002a83" },
-    { @"lesg;", @"\U000022da\U0000fe00" },
-    { @"lesges;", @"\U00002a93" },
-    { @"lessapprox;", @"\U00002a85" },
-    { @"lessdot;", @"\U000022d6" },
-    { @"lesseqgtr;", @"\U000022da" },
-    { @"lesseqqgtr;", @"\U00002a8b" },
-    { @"lessgtr;", @"\U00002276" },
-    { @"lesssim;", @"\U00002272" },
-    { @"lfisht;", @"\U0000297c" },
-    { @"lfloor;", @"\U0000230a" },
-    { @"lfr;", @"\U0001d529" },
-    { @"lg;", @"\U00002276" },
-    { @"lgE;", @"\U00002a91" },
-    { @"lhard;", @"\U000021bd" },
-    { @"lharu;", @"\U000021bc" },
-    { @"lharul;", @"\U0000296a" },
-    { @"lhblk;", @"\U00002584" },
-    { @"ljcy;", @"\U00000459" },
-    { @"ll;", @"\U0000226a" },
-    { @"llarr;", @"\U000021c7" },
-    { @"llcorner;", @"\U0000231e" },
-    { @"llhard;", @"\U0000296b" },
-    { @"lltri;", @"\U000025fa" },
-    { @"lmidot;", @"\U00000140" },
-    { @"lmoust;", @"\U000023b0" },
-    { @"lmoustache;", @"\U000023b0" },
-    { @"lnE;", @"\U00002268" },
-    { @"lnap;", @"\U00002a89" },
-    { @"lnapprox;", @"\U00002a89" },
-    { @"lne;", @"\U00002a87" },
-    { @"lneq;", @"\U00002a87" },
-    { @"lneqq;", @"\U00002268" },
-    { @"lnsim;", @"\U000022e6" },
-    { @"loang;", @"\U000027ec" },
-    { @"loarr;", @"\U000021fd" },
-    { @"lobrk;", @"\U000027e6" },
-    { @"longleftarrow;", @"\U000027f5" },
-    { @"longleftrightarrow;", @"\U000027f7" },
-    { @"longmapsto;", @"\U000027fc" },
-    { @"longrightarrow;", @"\U000027f6" },
-    { @"looparrowleft;", @"\U000021ab" },
-    { @"looparrowright;", @"\U000021ac" },
-    { @"lopar;", @"\U00002985" },
-    { @"lopf;", @"\U0001d55d" },
-    { @"loplus;", @"\U00002a2d" },
-    { @"lotimes;", @"\U00002a34" },
-    { @"lowast;", @"\U00002217" },
-    { @"lowbar;", @"_" },
-    { @"loz;", @"\U000025ca" },
-    { @"lozenge;", @"\U000025ca" },
-    { @"lozf;", @"\U000029eb" },
-    { @"lpar;", @"(" },
-    { @"lparlt;", @"\U00002993" },
-    { @"lrarr;", @"\U000021c6" },
-    { @"lrcorner;", @"\U0000231f" },
-    { @"lrhar;", @"\U000021cb" },
-    { @"lrhard;", @"\U0000296d" },
-    { @"lrm;", @"\U0000200e" },
-    { @"lrtri;", @"\U000022bf" },
-    { @"lsaquo;", @"\U00002039" },
-    { @"lscr;", @"\U0001d4c1" },
-    { @"lsh;", @"\U000021b0" },
-    { @"lsim;", @"\U00002272" },
-    { @"lsime;", @"\U00002a8d" },
-    { @"lsimg;", @"\U00002a8f" },
-    { @"lsqb;", @"[" },
-    { @"lsquo;", @"\U00002018" },
-    { @"lsquor;", @"\U0000201a" },
-    { @"lstrok;", @"\U00000142" },
-    { @"lt;", @"<" },
-    { @"ltcc;", @"\U00002aa6" },
-    { @"ltcir;", @"\U00002a79" },
-    { @"ltdot;", @"\U000022d6" },
-    { @"lthree;", @"\U000022cb" },
-    { @"ltimes;", @"\U000022c9" },
-    { @"ltlarr;", @"\U00002976" },
-    { @"ltquest;", @"\U00002a7b" },
-    { @"ltrPar;", @"\U00002996" },
-    { @"ltri;", @"\U000025c3" },
-    { @"ltrie;", @"\U000022b4" },
-    { @"ltrif;", @"\U000025c2" },
-    { @"lurdshar;", @"\U0000294a" },
-    { @"luruhar;", @"\U00002966" },
-    { @"lvertneqq;", @"\U00002268\U0000fe00" },
-    { @"lvnE;", @"\U00002268\U0000fe00" },
-    { @"mDDot;", @"\U0000223a" },
-    { @"macr;", @"\U000000af" },
-    { @"male;", @"\U00002642" },
-    { @"malt;", @"\U00002720" },
-    { @"maltese;", @"\U00002720" },
-    { @"map;", @"\U000021a6" },
-    { @"mapsto;", @"\U000021a6" },
-    { @"mapstodown;", @"\U000021a7" },
-    { @"mapstoleft;", @"\U000021a4" },
-    { @"mapstoup;", @"\U000021a5" },
-    { @"marker;", @"\U000025ae" },
-    { @"mcomma;", @"\U00002a29" },
-    { @"mcy;", @"\U0000043c" },
-    { @"mdash;", @"\U00002014" },
-    { @"measuredangle;", @"\U00002221" },
-    { @"mfr;", @"\U0001d52a" },
-    { @"mho;", @"\U00002127" },
-    { @"micro;", @"\U000000b5" },
-    { @"mid;", @"\U00002223" },
-    { @"midast;", @"*" },
-    { @"midcir;", @"\U00002af0" },
-    { @"middot;", @"\U000000b7" },
-    { @"minus;", @"\U00002212" },
-    { @"minusb;", @"\U0000229f" },
-    { @"minusd;", @"\U00002238" },
-    { @"minusdu;", @"\U00002a2a" },
-    { @"mlcp;", @"\U00002adb" },
-    { @"mldr;", @"\U00002026" },
-    { @"mnplus;", @"\U00002213" },
-    { @"models;", @"\U000022a7" },
-    { @"mopf;", @"\U0001d55e" },
-    { @"mp;", @"\U00002213" },
-    { @"mscr;", @"\U0001d4c2" },
-    { @"mstpos;", @"\U0000223e" },
-    { @"mu;", @"\U000003bc" },
-    { @"multimap;", @"\U000022b8" },
-    { @"mumap;", @"\U000022b8" },
-    { @"nGg;", @"\U000022d9\U00000338" },
-    { @"nGt;", @"\U0000226b\U000020d2" },
-    { @"nGtv;", @"\U0000226b\U00000338" },
-    { @"nLeftarrow;", @"\U000021cd" },
-    { @"nLeftrightarrow;", @"\U000021ce" },
-    { @"nLl;", @"\U000022d8\U00000338" },
-    { @"nLt;", @"\U0000226a\U000020d2" },
-    { @"nLtv;", @"\U0000226a\U00000338" },
-    { @"nRightarrow;", @"\U000021cf" },
-    { @"nVDash;", @"\U000022af" },
-    { @"nVdash;", @"\U000022ae" },
-    { @"nabla;", @"\U00002207" },
-    { @"nacute;", @"\U00000144" },
-    { @"nang;", @"\U00002220\U000020d2" },
-    { @"nap;", @"\U00002249" },
-    { @"napE;", @"\U00002a70\U00000338" },
-    { @"napid;", @"\U0000224b\U00000338" },
-    { @"napos;", @"\U00000149" },
-    { @"napprox;", @"\U00002249" },
-    { @"natur;", @"\U0000266e" },
-    { @"natural;", @"\U0000266e" },
-    { @"naturals;", @"\U00002115" },
-    { @"nbsp;", @"\U000000a0" },
-    { @"nbump;", @"\U0000224e\U00000338" },
-    { @"nbumpe;", @"\U0000224f\U00000338" },
-    { @"ncap;", @"\U00002a43" },
-    { @"ncaron;", @"\U00000148" },
-    { @"ncedil;", @"\U00000146" },
-    { @"ncong;", @"\U00002247" },
-    { @"ncongdot;", @"\U00002a6d\U00000338" },
-    { @"ncup;", @"\U00002a42" },
-    { @"ncy;", @"\U0000043d" },
-    { @"ndash;", @"\U00002013" },
-    { @"ne;", @"\U00002260" },
-    { @"neArr;", @"\U000021d7" },
-    { @"nearhk;", @"\U00002924" },
-    { @"nearr;", @"\U00002197" },
-    { @"nearrow;", @"\U00002197" },
-    { @"nedot;", @"\U00002250\U00000338" },
-    { @"nequiv;", @"\U00002262" },
-    { @"nesear;", @"\U00002928" },
-    { @"nesim;", @"\U00002242\U00000338" },
-    { @"nexist;", @"\U00002204" },
-    { @"nexists;", @"\U00002204" },
-    { @"nfr;", @"\U0001d52b" },
-    { @"ngE;", @"\U00002267\U00000338" },
-    { @"nge;", @"\U00002271" },
-    { @"ngeq;", @"\U00002271" },
-    { @"ngeqq;", @"\U00002267\U00000338" },
-    { @"ngeqslant;", @"\U00002a7e\U00000338" },
-    { @"nges;", @"\U00002a7e\U00000338" },
-    { @"ngsim;", @"\U00002275" },
-    { @"ngt;", @"\U0000226f" },
-    { @"ngtr;", @"\U0000226f" },
-    { @"nhArr;", @"\U000021ce" },
-    { @"nharr;", @"\U000021ae" },
-    { @"nhpar;", @"\U00002af2" },
-    { @"ni;", @"\U0000220b" },
-    { @"nis;", @"\U000022fc" },
-    { @"nisd;", @"\U000022fa" },
-    { @"niv;", @"\U0000220b" },
-    { @"njcy;", @"\U0000045a" },
-    { @"nlArr;", @"\U000021cd" },
-    { @"nlE;", @"\U00002266\U00000338" },
-    { @"nlarr;", @"\U0000219a" },
-    { @"nldr;", @"\U00002025" },
-    { @"nle;", @"\U00002270" },
-    { @"nleftarrow;", @"\U0000219a" },
-    { @"nleftrightarrow;", @"\U000021ae" },
-    { @"nleq;", @"\U00002270" },
-    { @"nleqq;", @"\U00002266\U00000338" },
-    { @"nleqslant;", @"\U00002a7d\U00000338" },
-    { @"nles;", @"\U00002a7d\U00000338" },
-    { @"nless;", @"\U0000226e" },
-    { @"nlsim;", @"\U00002274" },
-    { @"nlt;", @"\U0000226e" },
-    { @"nltri;", @"\U000022ea" },
-    { @"nltrie;", @"\U000022ec" },
-    { @"nmid;", @"\U00002224" },
-    { @"nopf;", @"\U0001d55f" },
-    { @"not;", @"\U000000ac" },
-    { @"notin;", @"\U00002209" },
-    { @"notinE;", @"\U000022f9\U00000338" },
-    { @"notindot;", @"\U000022f5\U00000338" },
-    { @"notinva;", @"\U00002209" },
-    { @"notinvb;", @"\U000022f7" },
-    { @"notinvc;", @"\U000022f6" },
-    { @"notni;", @"\U0000220c" },
-    { @"notniva;", @"\U0000220c" },
-    { @"notnivb;", @"\U000022fe" },
-    { @"notnivc;", @"\U000022fd" },
-    { @"npar;", @"\U00002226" },
-    { @"nparallel;", @"\U00002226" },
-    { @"nparsl;", @"\U00002afd\U000020e5" },
-    { @"npart;", @"\U00002202\U00000338" },
-    { @"npolint;", @"\U00002a14" },
-    { @"npr;", @"\U00002280" },
-    { @"nprcue;", @"\U000022e0" },
-    { @"npre;", @"\U00002aaf\U00000338" },
-    { @"nprec;", @"\U00002280" },
-    { @"npreceq;", @"\U00002aaf\U00000338" },
-    { @"nrArr;", @"\U000021cf" },
-    { @"nrarr;", @"\U0000219b" },
-    { @"nrarrc;", @"\U00002933\U00000338" },
-    { @"nrarrw;", @"\U0000219d\U00000338" },
-    { @"nrightarrow;", @"\U0000219b" },
-    { @"nrtri;", @"\U000022eb" },
-    { @"nrtrie;", @"\U000022ed" },
-    { @"nsc;", @"\U00002281" },
-    { @"nsccue;", @"\U000022e1" },
-    { @"nsce;", @"\U00002ab0\U00000338" },
-    { @"nscr;", @"\U0001d4c3" },
-    { @"nshortmid;", @"\U00002224" },
-    { @"nshortparallel;", @"\U00002226" },
-    { @"nsim;", @"\U00002241" },
-    { @"nsime;", @"\U00002244" },
-    { @"nsimeq;", @"\U00002244" },
-    { @"nsmid;", @"\U00002224" },
-    { @"nspar;", @"\U00002226" },
-    { @"nsqsube;", @"\U000022e2" },
-    { @"nsqsupe;", @"\U000022e3" },
-    { @"nsub;", @"\U00002284" },
-    { @"nsubE;", @"\U00002ac5\U00000338" },
-    { @"nsube;", @"\U00002288" },
-    { @"nsubset;", @"\U00002282\U000020d2" },
-    { @"nsubseteq;", @"\U00002288" },
-    { @"nsubseteqq;", @"\U00002ac5\U00000338" },
-    { @"nsucc;", @"\U00002281" },
-    { @"nsucceq;", @"\U00002ab0\U00000338" },
-    { @"nsup;", @"\U00002285" },
-    { @"nsupE;", @"\U00002ac6\U00000338" },
-    { @"nsupe;", @"\U00002289" },
-    { @"nsupset;", @"\U00002283\U000020d2" },
-    { @"nsupseteq;", @"\U00002289" },
-    { @"nsupseteqq;", @"\U00002ac6\U00000338" },
-    { @"ntgl;", @"\U00002279" },
-    { @"ntilde;", @"\U000000f1" },
-    { @"ntlg;", @"\U00002278" },
-    { @"ntriangleleft;", @"\U000022ea" },
-    { @"ntrianglelefteq;", @"\U000022ec" },
-    { @"ntriangleright;", @"\U000022eb" },
-    { @"ntrianglerighteq;", @"\U000022ed" },
-    { @"nu;", @"\U000003bd" },
-    { @"num;", @"#" },
-    { @"numero;", @"\U00002116" },
-    { @"numsp;", @"\U00002007" },
-    { @"nvDash;", @"\U000022ad" },
-    { @"nvHarr;", @"\U00002904" },
-    { @"nvap;", @"\U0000224d\U000020d2" },
-    { @"nvdash;", @"\U000022ac" },
-    { @"nvge;", @"\U00002265\U000020d2" },
-    { @"nvgt;", @">\U000020d2" },
-    { @"nvinfin;", @"\U000029de" },
-    { @"nvlArr;", @"\U00002902" },
-    { @"nvle;", @"\U00002264\U000020d2" },
-    { @"nvlt;", @"<\U000020d2" },
-    { @"nvltrie;", @"\U000022b4\U000020d2" },
-    { @"nvrArr;", @"\U00002903" },
-    { @"nvrtrie;", @"\U000022b5\U000020d2" },
-    { @"nvsim;", @"\U0000223c\U000020d2" },
-    { @"nwArr;", @"\U000021d6" },
-    { @"nwarhk;", @"\U00002923" },
-    { @"nwarr;", @"\U00002196" },
-    { @"nwarrow;", @"\U00002196" },
-    { @"nwnear;", @"\U00002927" },
-    { @"oS;", @"\U000024c8" },
-    { @"oacute;", @"\U000000f3" },
-    { @"oast;", @"\U0000229b" },
-    { @"ocir;", @"\U0000229a" },
-    { @"ocirc;", @"\U000000f4" },
-    { @"ocy;", @"\U0000043e" },
-    { @"odash;", @"\U0000229d" },
-    { @"odblac;", @"\U00000151" },
-    { @"odiv;", @"\U00002a38" },
-    { @"odot;", @"\U00002299" },
-    { @"odsold;", @"\U000029bc" },
-    { @"oelig;", @"\U00000153" },
-    { @"ofcir;", @"\U000029bf" },
-    { @"ofr;", @"\U0001d52c" },
-    { @"ogon;", @"\U000002db" },
-    { @"ograve;", @"\U000000f2" },
-    { @"ogt;", @"\U000029c1" },
-    { @"ohbar;", @"\U000029b5" },
-    { @"ohm;", @"\U000003a9" },
-    { @"oint;", @"\U0000222e" },
-    { @"olarr;", @"\U000021ba" },
-    { @"olcir;", @"\U000029be" },
-    { @"olcross;", @"\U000029bb" },
-    { @"oline;", @"\U0000203e" },
-    { @"olt;", @"\U000029c0" },
-    { @"omacr;", @"\U0000014d" },
-    { @"omega;", @"\U000003c9" },
-    { @"omicron;", @"\U000003bf" },
-    { @"omid;", @"\U000029b6" },
-    { @"ominus;", @"\U00002296" },
-    { @"oopf;", @"\U0001d560" },
-    { @"opar;", @"\U000029b7" },
-    { @"operp;", @"\U000029b9" },
-    { @"oplus;", @"\U00002295" },
-    { @"or;", @"\U00002228" },
-    { @"orarr;", @"\U000021bb" },
-    { @"ord;", @"\U00002a5d" },
-    { @"order;", @"\U00002134" },
-    { @"orderof;", @"\U00002134" },
-    { @"ordf;", @"\U000000aa" },
-    { @"ordm;", @"\U000000ba" },
-    { @"origof;", @"\U000022b6" },
-    { @"oror;", @"\U00002a56" },
-    { @"orslope;", @"\U00002a57" },
-    { @"orv;", @"\U00002a5b" },
-    { @"oscr;", @"\U00002134" },
-    { @"oslash;", @"\U000000f8" },
-    { @"osol;", @"\U00002298" },
-    { @"otilde;", @"\U000000f5" },
-    { @"otimes;", @"\U00002297" },
-    { @"otimesas;", @"\U00002a36" },
-    { @"ouml;", @"\U000000f6" },
-    { @"ovbar;", @"\U0000233d" },
-    { @"par;", @"\U00002225" },
-    { @"para;", @"\U000000b6" },
-    { @"parallel;", @"\U00002225" },
-    { @"parsim;", @"\U00002af3" },
-    { @"parsl;", @"\U00002afd" },
-    { @"part;", @"\U00002202" },
-    { @"pcy;", @"\U0000043f" },
-    { @"percnt;", @"%" },
-    { @"period;", @"." },
-    { @"permil;", @"\U00002030" },
-    { @"perp;", @"\U000022a5" },
-    { @"pertenk;", @"\U00002031" },
-    { @"pfr;", @"\U0001d52d" },
-    { @"phi;", @"\U000003c6" },
-    { @"phiv;", @"\U000003d5" },
-    { @"phmmat;", @"\U00002133" },
-    { @"phone;", @"\U0000260e" },
-    { @"pi;", @"\U000003c0" },
-    { @"pitchfork;", @"\U000022d4" },
-    { @"piv;", @"\U000003d6" },
-    { @"planck;", @"\U0000210f" },
-    { @"planckh;", @"\U0000210e" },
-    { @"plankv;", @"\U0000210f" },
-    { @"plus;", @"+" },
-    { @"plusacir;", @"\U00002a23" },
-    { @"plusb;", @"\U0000229e" },
-    { @"pluscir;", @"\U00002a22" },
-    { @"plusdo;", @"\U00002214" },
-    { @"plusdu;", @"\U00002a25" },
-    { @"pluse;", @"\U00002a72" },
-    { @"plusmn;", @"\U000000b1" },
-    { @"plussim;", @"\U00002a26" },
-    { @"plustwo;", @"\U00002a27" },
-    { @"pm;", @"\U000000b1" },
-    { @"pointint;", @"\U00002a15" },
-    { @"popf;", @"\U0001d561" },
-    { @"pound;", @"\U000000a3" },
-    { @"pr;", @"\U0000227a" },
-    { @"prE;", @"\U00002ab3" },
-    { @"prap;", @"\U00002ab7" },
-    { @"prcue;", @"\U0000227c" },
-    { @"pre;", @"\U00002aaf" },
-    { @"prec;", @"\U0000227a" },
-    { @"precapprox;", @"\U00002ab7" },
-    { @"preccurlyeq;", @"\U0000227c" },
-    { @"preceq;", @"\U00002aaf" },
-    { @"precnapprox;", @"\U00002ab9" },
-    { @"precneqq;", @"\U00002ab5" },
-    { @"precnsim;", @"\U000022e8" },
-    { @"precsim;", @"\U0000227e" },
-    { @"prime;", @"\U00002032" },
-    { @"primes;", @"\U00002119" },
-    { @"prnE;", @"\U00002ab5" },
-    { @"prnap;", @"\U00002ab9" },
-    { @"prnsim;", @"\U000022e8" },
-    { @"prod;", @"\U0000220f" },
-    { @"profalar;", @"\U0000232e" },
-    { @"profline;", @"\U00002312" },
-    { @"profsurf;", @"\U00002313" },
-    { @"prop;", @"\U0000221d" },
-    { @"propto;", @"\U0000221d" },
-    { @"prsim;", @"\U0000227e" },
-    { @"prurel;", @"\U000022b0" },
-    { @"pscr;", @"\U0001d4c5" },
-    { @"psi;", @"\U000003c8" },
-    { @"puncsp;", @"\U00002008" },
-    { @"qfr;", @"\U0001d52e" },
-    { @"qint;", @"\U00002a0c" },
-    { @"qopf;", @"\U0001d562" },
-    { @"qprime;", @"\U00002057" },
-    { @"qscr;", @"\U0001d4c6" },
-    { @"quaternions;", @"\U0000210d" },
-    { @"quatint;", @"\U00002a16" },
-    { @"quest;", @"?" },
-    { @"questeq;", @"\U0000225f" },
-    { @"quot;", @"\"" },
-    { @"rAarr;", @"\U000021db" },
-    { @"rArr;", @"\U000021d2" },
-    { @"rAtail;", @"\U0000291c" },
-    { @"rBarr;", @"\U0000290f" },
-    { @"rHar;", @"\U00002964" },
-    { @"race;", @"\U0000223d\U00000331" },
-    { @"racute;", @"\U00000155" },
-    { @"radic;", @"\U0000221a" },
-    { @"raemptyv;", @"\U000029b3" },
-    { @"rang;", @"\U000027e9" },
-    { @"rangd;", @"\U00002992" },
-    { @"range;", @"\U000029a5" },
-    { @"rangle;", @"\U000027e9" },
-    { @"raquo;", @"\U000000bb" },
-    { @"rarr;", @"\U00002192" },
-    { @"rarrap;", @"\U00002975" },
-    { @"rarrb;", @"\U000021e5" },
-    { @"rarrbfs;", @"\U00002920" },
-    { @"rarrc;", @"\U00002933" },
-    { @"rarrfs;", @"\U0000291e" },
-    { @"rarrhk;", @"\U000021aa" },
-    { @"rarrlp;", @"\U000021ac" },
-    { @"rarrpl;", @"\U00002945" },
-    { @"rarrsim;", @"\U00002974" },
-    { @"rarrtl;", @"\U000021a3" },
-    { @"rarrw;", @"\U0000219d" },
-    { @"ratail;", @"\U0000291a" },
-    { @"ratio;", @"\U00002236" },
-    { @"rationals;", @"\U0000211a" },
-    { @"rbarr;", @"\U0000290d" },
-    { @"rbbrk;", @"\U00002773" },
-    { @"rbrace;", @"}" },
-    { @"rbrack;", @"]" },
-    { @"rbrke;", @"\U0000298c" },
-    { @"rbrksld;", @"\U0000298e" },
-    { @"rbrkslu;", @"\U00002990" },
-    { @"rcaron;", @"\U00000159" },
-    { @"rcedil;", @"\U00000157" },
-    { @"rceil;", @"\U00002309" },
-    { @"rcub;", @"}" },
-    { @"rcy;", @"\U00000440" },
-    { @"rdca;", @"\U00002937" },
-    { @"rdldhar;", @"\U00002969" },
-    { @"rdquo;", @"\U0000201d" },
-    { @"rdquor;", @"\U0000201d" },
-    { @"rdsh;", @"\U000021b3" },
-    { @"real;", @"\U0000211c" },
-    { @"realine;", @"\U0000211b" },
-    { @"realpart;", @"\U0000211c" },
-    { @"reals;", @"\U0000211d" },
-    { @"rect;", @"\U000025ad" },
-    { @"reg;", @"\U000000ae" },
-    { @"rfisht;", @"\U0000297d" },
-    { @"rfloor;", @"\U0000230b" },
-    { @"rfr;", @"\U0001d52f" },
-    { @"rhard;", @"\U000021c1" },
-    { @"rharu;", @"\U000021c0" },
-    { @"rharul;", @"\U0000296c" },
-    { @"rho;", @"\U000003c1" },
-    { @"rhov;", @"\U000003f1" },
-    { @"rightarrow;", @"\U00002192" },
-    { @"rightarrowtail;", @"\U000021a3" },
-    { @"rightharpoondown;", @"\U000021c1" },
-    { @"rightharpoonup;", @"\U000021c0" },
-    { @"rightleftarrows;", @"\U000021c4" },
-    { @"rightleftharpoons;", @"\U000021cc" },
-    { @"rightrightarrows;", @"\U000021c9" },
-    { @"rightsquigarrow;", @"\U0000219d" },
-    { @"rightthreetimes;", @"\U000022cc" },
-    { @"ring;", @"\U000002da" },
-    { @"risingdotseq;", @"\U00002253" },
-    { @"rlarr;", @"\U000021c4" },
-    { @"rlhar;", @"\U000021cc" },
-    { @"rlm;", @"\U0000200f" },
-    { @"rmoust;", @"\U000023b1" },
-    { @"rmoustache;", @"\U000023b1" },
-    { @"rnmid;", @"\U00002aee" },
-    { @"roang;", @"\U000027ed" },
-    { @"roarr;", @"\U000021fe" },
-    { @"robrk;", @"\U000027e7" },
-    { @"ropar;", @"\U00002986" },
-    { @"ropf;", @"\U0001d563" },
-    { @"roplus;", @"\U00002a2e" },
-    { @"rotimes;", @"\U00002a35" },
-    { @"rpar;", @")" },
-    { @"rpargt;", @"\U00002994" },
-    { @"rppolint;", @"\U00002a12" },
-    { @"rrarr;", @"\U000021c9" },
-    { @"rsaquo;", @"\U0000203a" },
-    { @"rscr;", @"\U0001d4c7" },
-    { @"rsh;", @"\U000021b1" },
-    { @"rsqb;", @"]" },
-    { @"rsquo;", @"\U00002019" },
-    { @"rsquor;", @"\U00002019" },
-    { @"rthree;", @"\U000022cc" },
-    { @"rtimes;", @"\U000022ca" },
-    { @"rtri;", @"\U000025b9" },
-    { @"rtrie;", @"\U000022b5" },
-    { @"rtrif;", @"\U000025b8" },
-    { @"rtriltri;", @"\U000029ce" },
-    { @"ruluhar;", @"\U00002968" },
-    { @"rx;", @"\U0000211e" },
-    { @"sacute;", @"\U0000015b" },
-    { @"sbquo;", @"\U0000201a" },
-    { @"sc;", @"\U0000227b" },
-    { @"scE;", @"\U00002ab4" },
-    { @"scap;", @"\U00002ab8" },
-    { @"scaron;", @"\U00000161" },
-    { @"sccue;", @"\U0000227d" },
-    { @"sce;", @"\U00002ab0" },
-    { @"scedil;", @"\U0000015f" },
-    { @"scirc;", @"\U0000015d" },
-    { @"scnE;", @"\U00002ab6" },
-    { @"scnap;", @"\U00002aba" },
-    { @"scnsim;", @"\U000022e9" },
-    { @"scpolint;", @"\U00002a13" },
-    { @"scsim;", @"\U0000227f" },
-    { @"scy;", @"\U00000441" },
-    { @"sdot;", @"\U000022c5" },
-    { @"sdotb;", @"\U000022a1" },
-    { @"sdote;", @"\U00002a66" },
-    { @"seArr;", @"\U000021d8" },
-    { @"searhk;", @"\U00002925" },
-    { @"searr;", @"\U00002198" },
-    { @"searrow;", @"\U00002198" },
-    { @"sect;", @"\U000000a7" },
-    { @"semi;", @";" },
-    { @"seswar;", @"\U00002929" },
-    { @"setminus;", @"\U00002216" },
-    { @"setmn;", @"\U00002216" },
-    { @"sext;", @"\U00002736" },
-    { @"sfr;", @"\U0001d530" },
-    { @"sfrown;", @"\U00002322" },
-    { @"sharp;", @"\U0000266f" },
-    { @"shchcy;", @"\U00000449" },
-    { @"shcy;", @"\U00000448" },
-    { @"shortmid;", @"\U00002223" },
-    { @"shortparallel;", @"\U00002225" },
-    { @"shy;", @"\U000000ad" },
-    { @"sigma;", @"\U000003c3" },
-    { @"sigmaf;", @"\U000003c2" },
-    { @"sigmav;", @"\U000003c2" },
-    { @"sim;", @"\U0000223c" },
-    { @"simdot;", @"\U00002a6a" },
-    { @"sime;", @"\U00002243" },
-    { @"simeq;", @"\U00002243" },
-    { @"simg;", @"\U00002a9e" },
-    { @"simgE;", @"\U00002aa0" },
-    { @"siml;", @"\U00002a9d" },
-    { @"simlE;", @"\U00002a9f" },
-    { @"simne;", @"\U00002246" },
-    { @"simplus;", @"\U00002a24" },
-    { @"simrarr;", @"\U00002972" },
-    { @"slarr;", @"\U00002190" },
-    { @"smallsetminus;", @"\U00002216" },
-    { @"smashp;", @"\U00002a33" },
-    { @"smeparsl;", @"\U000029e4" },
-    { @"smid;", @"\U00002223" },
-    { @"smile;", @"\U00002323" },
-    { @"smt;", @"\U00002aaa" },
-    { @"smte;", @"\U00002aac" },
-    { @"smtes;", @"\U00002aac\U0000fe00" },
-    { @"softcy;", @"\U0000044c" },
-    { @"sol;", @"/" },
-    { @"solb;", @"\U000029c4" },
-    { @"solbar;", @"\U0000233f" },
-    { @"sopf;", @"\U0001d564" },
-    { @"spades;", @"\U00002660" },
-    { @"spadesuit;", @"\U00002660" },
-    { @"spar;", @"\U00002225" },
-    { @"sqcap;", @"\U00002293" },
-    { @"sqcaps;", @"\U00002293\U0000fe00" },
-    { @"sqcup;", @"\U00002294" },
-    { @"sqcups;", @"\U00002294\U0000fe00" },
-    { @"sqsub;", @"\U0000228f" },
-    { @"sqsube;", @"\U00002291" },
-    { @"sqsubset;", @"\U0000228f" },
-    { @"sqsubseteq;", @"\U00002291" },
-    { @"sqsup;", @"\U00002290" },
-    { @"sqsupe;", @"\U00002292" },
-    { @"sqsupset;", @"\U00002290" },
-    { @"sqsupseteq;", @"\U00002292" },
-    { @"squ;", @"\U000025a1" },
-    { @"square;", @"\U000025a1" },
-    { @"squarf;", @"\U000025aa" },
-    { @"squf;", @"\U000025aa" },
-    { @"srarr;", @"\U00002192" },
-    { @"sscr;", @"\U0001d4c8" },
-    { @"ssetmn;", @"\U00002216" },
-    { @"ssmile;", @"\U00002323" },
-    { @"sstarf;", @"\U000022c6" },
-    { @"star;", @"\U00002606" },
-    { @"starf;", @"\U00002605" },
-    { @"straightepsilon;", @"\U000003f5" },
-    { @"straightphi;", @"\U000003d5" },
-    { @"strns;", @"\U000000af" },
-    { @"sub;", @"\U00002282" },
-    { @"subE;", @"\U00002ac5" },
-    { @"subdot;", @"\U00002abd" },
-    { @"sube;", @"\U00002286" },
-    { @"subedot;", @"\U00002ac3" },
-    { @"submult;", @"\U00002ac1" },
-    { @"subnE;", @"\U00002acb" },
-    { @"subne;", @"\U0000228a" },
-    { @"subplus;", @"\U00002abf" },
-    { @"subrarr;", @"\U00002979" },
-    { @"subset;", @"\U00002282" },
-    { @"subseteq;", @"\U00002286" },
-    { @"subseteqq;", @"\U00002ac5" },
-    { @"subsetneq;", @"\U0000228a" },
-    { @"subsetneqq;", @"\U00002acb" },
-    { @"subsim;", @"\U00002ac7" },
-    { @"subsub;", @"\U00002ad5" },
-    { @"subsup;", @"\U00002ad3" },
-    { @"succ;", @"\U0000227b" },
-    { @"succapprox;", @"\U00002ab8" },
-    { @"succcurlyeq;", @"\U0000227d" },
-    { @"succeq;", @"\U00002ab0" },
-    { @"succnapprox;", @"\U00002aba" },
-    { @"succneqq;", @"\U00002ab6" },
-    { @"succnsim;", @"\U000022e9" },
-    { @"succsim;", @"\U0000227f" },
-    { @"sum;", @"\U00002211" },
-    { @"sung;", @"\U0000266a" },
-    { @"sup1;", @"\U000000b9" },
-    { @"sup2;", @"\U000000b2" },
-    { @"sup3;", @"\U000000b3" },
-    { @"sup;", @"\U00002283" },
-    { @"supE;", @"\U00002ac6" },
-    { @"supdot;", @"\U00002abe" },
-    { @"supdsub;", @"\U00002ad8" },
-    { @"supe;", @"\U00002287" },
-    { @"supedot;", @"\U00002ac4" },
-    { @"suphsol;", @"\U000027c9" },
-    { @"suphsub;", @"\U00002ad7" },
-    { @"suplarr;", @"\U0000297b" },
-    { @"supmult;", @"\U00002ac2" },
-    { @"supnE;", @"\U00002acc" },
-    { @"supne;", @"\U0000228b" },
-    { @"supplus;", @"\U00002ac0" },
-    { @"supset;", @"\U00002283" },
-    { @"supseteq;", @"\U00002287" },
-    { @"supseteqq;", @"\U00002ac6" },
-    { @"supsetneq;", @"\U0000228b" },
-    { @"supsetneqq;", @"\U00002acc" },
-    { @"supsim;", @"\U00002ac8" },
-    { @"supsub;", @"\U00002ad4" },
-    { @"supsup;", @"\U00002ad6" },
-    { @"swArr;", @"\U000021d9" },
-    { @"swarhk;", @"\U00002926" },
-    { @"swarr;", @"\U00002199" },
-    { @"swarrow;", @"\U00002199" },
-    { @"swnwar;", @"\U0000292a" },
-    { @"szlig;", @"\U000000df" },
-    { @"target;", @"\U00002316" },
-    { @"tau;", @"\U000003c4" },
-    { @"tbrk;", @"\U000023b4" },
-    { @"tcaron;", @"\U00000165" },
-    { @"tcedil;", @"\U00000163" },
-    { @"tcy;", @"\U00000442" },
-    { @"tdot;", @"\U000020db" },
-    { @"telrec;", @"\U00002315" },
-    { @"tfr;", @"\U0001d531" },
-    { @"there4;", @"\U00002234" },
-    { @"therefore;", @"\U00002234" },
-    { @"theta;", @"\U000003b8" },
-    { @"thetasym;", @"\U000003d1" },
-    { @"thetav;", @"\U000003d1" },
-    { @"thickapprox;", @"\U00002248" },
-    { @"thicksim;", @"\U0000223c" },
-    { @"thinsp;", @"\U00002009" },
-    { @"thkap;", @"\U00002248" },
-    { @"thksim;", @"\U0000223c" },
-    { @"thorn;", @"\U000000fe" },
-    { @"tilde;", @"\U000002dc" },
-    { @"times;", @"\U000000d7" },
-    { @"timesb;", @"\U000022a0" },
-    { @"timesbar;", @"\U00002a31" },
-    { @"timesd;", @"\U00002a30" },
-    { @"tint;", @"\U0000222d" },
-    { @"toea;", @"\U00002928" },
-    { @"top;", @"\U000022a4" },
-    { @"topbot;", @"\U00002336" },
-    { @"topcir;", @"\U00002af1" },
-    { @"topf;", @"\U0001d565" },
-    { @"topfork;", @"\U00002ada" },
-    { @"tosa;", @"\U00002929" },
-    { @"tprime;", @"\U00002034" },
-    { @"trade;", @"\U00002122" },
-    { @"triangle;", @"\U000025b5" },
-    { @"triangledown;", @"\U000025bf" },
-    { @"triangleleft;", @"\U000025c3" },
-    { @"trianglelefteq;", @"\U000022b4" },
-    { @"triangleq;", @"\U0000225c" },
-    { @"triangleright;", @"\U000025b9" },
-    { @"trianglerighteq;", @"\U000022b5" },
-    { @"tridot;", @"\U000025ec" },
-    { @"trie;", @"\U0000225c" },
-    { @"triminus;", @"\U00002a3a" },
-    { @"triplus;", @"\U00002a39" },
-    { @"trisb;", @"\U000029cd" },
-    { @"tritime;", @"\U00002a3b" },
-    { @"trpezium;", @"\U000023e2" },
-    { @"tscr;", @"\U0001d4c9" },
-    { @"tscy;", @"\U00000446" },
-    { @"tshcy;", @"\U0000045b" },
-    { @"tstrok;", @"\U00000167" },
-    { @"twixt;", @"\U0000226c" },
-    { @"twoheadleftarrow;", @"\U0000219e" },
-    { @"twoheadrightarrow;", @"\U000021a0" },
-    { @"uArr;", @"\U000021d1" },
-    { @"uHar;", @"\U00002963" },
-    { @"uacute;", @"\U000000fa" },
-    { @"uarr;", @"\U00002191" },
-    { @"ubrcy;", @"\U0000045e" },
-    { @"ubreve;", @"\U0000016d" },
-    { @"ucirc;", @"\U000000fb" },
-    { @"ucy;", @"\U00000443" },
-    { @"udarr;", @"\U000021c5" },
-    { @"udblac;", @"\U00000171" },
-    { @"udhar;", @"\U0000296e" },
-    { @"ufisht;", @"\U0000297e" },
-    { @"ufr;", @"\U0001d532" },
-    { @"ugrave;", @"\U000000f9" },
-    { @"uharl;", @"\U000021bf" },
-    { @"uharr;", @"\U000021be" },
-    { @"uhblk;", @"\U00002580" },
-    { @"ulcorn;", @"\U0000231c" },
-    { @"ulcorner;", @"\U0000231c" },
-    { @"ulcrop;", @"\U0000230f" },
-    { @"ultri;", @"\U000025f8" },
-    { @"umacr;", @"\U0000016b" },
-    { @"uml;", @"\U000000a8" },
-    { @"uogon;", @"\U00000173" },
-    { @"uopf;", @"\U0001d566" },
-    { @"uparrow;", @"\U00002191" },
-    { @"updownarrow;", @"\U00002195" },
-    { @"upharpoonleft;", @"\U000021bf" },
-    { @"upharpoonright;", @"\U000021be" },
-    { @"uplus;", @"\U0000228e" },
-    { @"upsi;", @"\U000003c5" },
-    { @"upsih;", @"\U000003d2" },
-    { @"upsilon;", @"\U000003c5" },
-    { @"upuparrows;", @"\U000021c8" },
-    { @"urcorn;", @"\U0000231d" },
-    { @"urcorner;", @"\U0000231d" },
-    { @"urcrop;", @"\U0000230e" },
-    { @"uring;", @"\U0000016f" },
-    { @"urtri;", @"\U000025f9" },
-    { @"uscr;", @"\U0001d4ca" },
-    { @"utdot;", @"\U000022f0" },
-    { @"utilde;", @"\U00000169" },
-    { @"utri;", @"\U000025b5" },
-    { @"utrif;", @"\U000025b4" },
-    { @"uuarr;", @"\U000021c8" },
-    { @"uuml;", @"\U000000fc" },
-    { @"uwangle;", @"\U000029a7" },
-    { @"vArr;", @"\U000021d5" },
-    { @"vBar;", @"\U00002ae8" },
-    { @"vBarv;", @"\U00002ae9" },
-    { @"vDash;", @"\U000022a8" },
-    { @"vangrt;", @"\U0000299c" },
-    { @"varepsilon;", @"\U000003f5" },
-    { @"varkappa;", @"\U000003f0" },
-    { @"varnothing;", @"\U00002205" },
-    { @"varphi;", @"\U000003d5" },
-    { @"varpi;", @"\U000003d6" },
-    { @"varpropto;", @"\U0000221d" },
-    { @"varr;", @"\U00002195" },
-    { @"varrho;", @"\U000003f1" },
-    { @"varsigma;", @"\U000003c2" },
-    { @"varsubsetneq;", @"\U0000228a\U0000fe00" },
-    { @"varsubsetneqq;", @"\U00002acb\U0000fe00" },
-    { @"varsupsetneq;", @"\U0000228b\U0000fe00" },
-    { @"varsupsetneqq;", @"\U00002acc\U0000fe00" },
-    { @"vartheta;", @"\U000003d1" },
-    { @"vartriangleleft;", @"\U000022b2" },
-    { @"vartriangleright;", @"\U000022b3" },
-    { @"vcy;", @"\U00000432" },
-    { @"vdash;", @"\U000022a2" },
-    { @"vee;", @"\U00002228" },
-    { @"veebar;", @"\U000022bb" },
-    { @"veeeq;", @"\U0000225a" },
-    { @"vellip;", @"\U000022ee" },
-    { @"verbar;", @"|" },
-    { @"vert;", @"|" },
-    { @"vfr;", @"\U0001d533" },
-    { @"vltri;", @"\U000022b2" },
-    { @"vnsub;", @"\U00002282\U000020d2" },
-    { @"vnsup;", @"\U00002283\U000020d2" },
-    { @"vopf;", @"\U0001d567" },
-    { @"vprop;", @"\U0000221d" },
-    { @"vrtri;", @"\U000022b3" },
-    { @"vscr;", @"\U0001d4cb" },
-    { @"vsubnE;", @"\U00002acb\U0000fe00" },
-    { @"vsubne;", @"\U0000228a\U0000fe00" },
-    { @"vsupnE;", @"\U00002acc\U0000fe00" },
-    { @"vsupne;", @"\U0000228b\U0000fe00" },
-    { @"vzigzag;", @"\U0000299a" },
-    { @"wcirc;", @"\U00000175" },
-    { @"wedbar;", @"\U00002a5f" },
-    { @"wedge;", @"\U00002227" },
-    { @"wedgeq;", @"\U00002259" },
-    { @"weierp;", @"\U00002118" },
-    { @"wfr;", @"\U0001d534" },
-    { @"wopf;", @"\U0001d568" },
-    { @"wp;", @"\U00002118" },
-    { @"wr;", @"\U00002240" },
-    { @"wreath;", @"\U00002240" },
-    { @"wscr;", @"\U0001d4cc" },
-    { @"xcap;", @"\U000022c2" },
-    { @"xcirc;", @"\U000025ef" },
-    { @"xcup;", @"\U000022c3" },
-    { @"xdtri;", @"\U000025bd" },
-    { @"xfr;", @"\U0001d535" },
-    { @"xhArr;", @"\U000027fa" },
-    { @"xharr;", @"\U000027f7" },
-    { @"xi;", @"\U000003be" },
-    { @"xlArr;", @"\U000027f8" },
-    { @"xlarr;", @"\U000027f5" },
-    { @"xmap;", @"\U000027fc" },
-    { @"xnis;", @"\U000022fb" },
-    { @"xodot;", @"\U00002a00" },
-    { @"xopf;", @"\U0001d569" },
-    { @"xoplus;", @"\U00002a01" },
-    { @"xotime;", @"\U00002a02" },
-    { @"xrArr;", @"\U000027f9" },
-    { @"xrarr;", @"\U000027f6" },
-    { @"xscr;", @"\U0001d4cd" },
-    { @"xsqcup;", @"\U00002a06" },
-    { @"xuplus;", @"\U00002a04" },
-    { @"xutri;", @"\U000025b3" },
-    { @"xvee;", @"\U000022c1" },
-    { @"xwedge;", @"\U000022c0" },
-    { @"yacute;", @"\U000000fd" },
-    { @"yacy;", @"\U0000044f" },
-    { @"ycirc;", @"\U00000177" },
-    { @"ycy;", @"\U0000044b" },
-    { @"yen;", @"\U000000a5" },
-    { @"yfr;", @"\U0001d536" },
-    { @"yicy;", @"\U00000457" },
-    { @"yopf;", @"\U0001d56a" },
-    { @"yscr;", @"\U0001d4ce" },
-    { @"yucy;", @"\U0000044e" },
-    { @"yuml;", @"\U000000ff" },
-    { @"zacute;", @"\U0000017a" },
-    { @"zcaron;", @"\U0000017e" },
-    { @"zcy;", @"\U00000437" },
-    { @"zdot;", @"\U0000017c" },
-    { @"zeetrf;", @"\U00002128" },
-    { @"zeta;", @"\U000003b6" },
-    { @"zfr;", @"\U0001d537" },
-    { @"zhcy;", @"\U00000436" },
-    { @"zigrarr;", @"\U000021dd" },
-    { @"zopf;", @"\U0001d56b" },
-    { @"zscr;", @"\U0001d4cf" },
-    { @"zwj;", @"\U0000200d" },
-    { @"zwnj;", @"\U0000200c" },
+static __unsafe_unretained NSString * const NamedReferenceReplacements[] = {
+    @">",
+    @"<",
+    @"&",
+    @"\U00002145",
+    @"\U000000d0",
+    @"\U000022d9",
+    @"\U0000226b",
+    @"\U00002111",
+    @"\U000022d8",
+    @"\U0000226a",
+    @"\U0000039c",
+    @"\U0000039d",
+    @"\U00002a54",
+    @"\U000003a0",
+    @"\U00002abb",
+    @"\U000000ae",
+    @"\U0000211c",
+    @"\U00002abc",
+    @"\U0000039e",
+    @"\U0000223e",
+    @"\U00002061",
+    @"\U00002248",
+    @"\U00002146",
+    @"\U000000b0",
+    @"\U00002147",
+    @"\U00002a9a",
+    @"\U00002a99",
+    @"\U000000f0",
+    @"\U00002267",
+    @"\U00002265",
+    @"\U00002277",
+    @"\U00002063",
+    @"\U00002148",
+    @"\U00002208",
+    @"\U00002062",
+    @"\U00002266",
+    @"\U00002264",
+    @"\U00002276",
+    @"\U00002213",
+    @"\U000003bc",
+    @"\U00002260",
+    @"\U0000220b",
+    @"\U000000ac",
+    @"\U000003bd",
+    @"\U000024c8",
+    @"\U00002228",
+    @"\U000003c0",
+    @"\U000000b1",
+    @"\U0000227a",
+    @"\U0000211e",
+    @"\U0000227b",
+    @"\U000000ad",
+    @"\U000000a8",
+    @"\U00002118",
+    @"\U00002240",
+    @"\U000003be",
+    @"\U000000a5",
+    @"\U00000410",
+    @"\U0001d504",
+    @"\U00002a53",
+    @"\U000000c4",
+    @"\U00000411",
+    @"\U0001d505",
+    @"\U000000a9",
+    @"\U000022d2",
+    @"\U0000212d",
+    @"\U000003a7",
+    @"\U000022d3",
+    @"\U00000414",
+    @"\U00002207",
+    @"\U0001d507",
+    @"\U0000014a",
+    @"\U0000042d",
+    @"\U0001d508",
+    @"\U00000397",
+    @"\U000000cb",
+    @"\U00000424",
+    @"\U0001d509",
+    @"\U00000413",
+    @"\U0001d50a",
+    @"^",
+    @"\U0000210c",
+    @"\U00000418",
+    @"\U0000222c",
+    @"\U000000cf",
+    @"\U00000419",
+    @"\U0001d50d",
+    @"\U0000041a",
+    @"\U0001d50e",
+    @"\U0000041b",
+    @"\U0001d50f",
+    @"\U000021b0",
+    @"\U00002905",
+    @"\U0000041c",
+    @"\U0001d510",
+    @"\U0000041d",
+    @"\U0001d511",
+    @"\U00002aec",
+    @"\U0000041e",
+    @"\U0001d512",
+    @"\U000000d6",
+    @"\U0000041f",
+    @"\U0001d513",
+    @"\U000003a6",
+    @"\U000003a8",
+    @"\"",
+    @"\U0001d514",
+    @"\U00000420",
+    @"\U000003a1",
+    @"\U000021b1",
+    @"\U00000421",
+    @"\U0001d516",
+    @"\U000022d0",
+    @"\U00002211",
+    @"\U000022d1",
+    @"\t",
+    @"\U000003a4",
+    @"\U00000422",
+    @"\U0001d517",
+    @"\U00000423",
+    @"\U0001d518",
+    @"\U000000dc",
+    @"\U00000412",
+    @"\U000022c1",
+    @"\U0001d519",
+    @"\U0001d51a",
+    @"\U0001d51b",
+    @"\U0000042b",
+    @"\U0001d51c",
+    @"\U00000417",
+    @"\U00002128",
+    @"\U0000223e\U00000333",
+    @"\U0000223f",
+    @"\U00000430",
+    @"\U0001d51e",
+    @"\U00002227",
+    @"\U00002220",
+    @"\U00002a70",
+    @"\U0000224a",
+    @"*",
+    @"\U000000e4",
+    @"\U00000431",
+    @"\U0001d51f",
+    @"=\U000020e5",
+    @"\U000022a5",
+    @"\U00002229",
+    @"\U000000a2",
+    @"\U0001d520",
+    @"\U000003c7",
+    @"\U000025cb",
+    @"\U0000222a",
+    @"\U00000434",
+    @"\U0001d521",
+    @"\U000000f7",
+    @"\U000002d9",
+    @"\U0000044d",
+    @"\U0001d522",
+    @"\U00002a96",
+    @"\U00002113",
+    @"\U00002a95",
+    @"\U0000014b",
+    @"\U000003b7",
+    @"\U000000eb",
+    @"\U00000444",
+    @"\U0001d523",
+    @"\U00002a8c",
+    @"\U00002a86",
+    @"\U00000433",
+    @"\U000022db",
+    @"\U00002a7e",
+    @"\U0001d524",
+    @"\U00002a92",
+    @"\U00002aa5",
+    @"\U00002aa4",
+    @"\U00002269",
+    @"\U00002a88",
+    @"\U0001d525",
+    @"\U00000438",
+    @"\U000021d4",
+    @"\U0001d526",
+    @"\U0000222b",
+    @"\U000000ef",
+    @"\U00000439",
+    @"\U0001d527",
+    @"\U0000043a",
+    @"\U0001d528",
+    @"\U00002a8b",
+    @"\U00002a85",
+    @"\U00002aab",
+    @"\U0000043b",
+    @"\U000022da",
+    @"\U00002a7d",
+    @"\U0001d529",
+    @"\U00002a91",
+    @"\U00002268",
+    @"\U00002a87",
+    @"\U000025ca",
+    @"\U0000200e",
+    @"\U000000af",
+    @"\U000021a6",
+    @"\U0000043c",
+    @"\U0001d52a",
+    @"\U00002127",
+    @"\U00002223",
+    @"\U000022d9\U00000338",
+    @"\U0000226b\U000020d2",
+    @"\U000022d8\U00000338",
+    @"\U0000226a\U000020d2",
+    @"\U00002249",
+    @"\U000000a0",
+    @"\U0000043d",
+    @"\U0001d52b",
+    @"\U00002267\U00000338",
+    @"\U00002271",
+    @"\U0000226f",
+    @"\U000022fc",
+    @"\U00002266\U00000338",
+    @"\U00002270",
+    @"\U0000226e",
+    @"\U00002280",
+    @"\U00002281",
+    @"#",
+    @"\U0000043e",
+    @"\U0001d52c",
+    @"\U000029c1",
+    @"\U000003a9",
+    @"\U000029c0",
+    @"\U00002a5d",
+    @"\U000000aa",
+    @"\U000000ba",
+    @"\U00002a5b",
+    @"\U000000f6",
+    @"\U00002225",
+    @"\U000000b6",
+    @"\U0000043f",
+    @"\U0001d52d",
+    @"\U000003c6",
+    @"\U000003d6",
+    @"\U00002ab3",
+    @"\U00002aaf",
+    @"\U000003c8",
+    @"\U0001d52e",
+    @"\U00000440",
+    @"\U0001d52f",
+    @"\U000003c1",
+    @"\U0000200f",
+    @"\U00002ab4",
+    @"\U00002ab0",
+    @"\U00000441",
+    @"\U000000a7",
+    @"\U0001d530",
+    @"\U0000223c",
+    @"\U00002aaa",
+    @"/",
+    @"\U000025a1",
+    @"\U00002282",
+    @"\U000000b9",
+    @"\U000000b2",
+    @"\U000000b3",
+    @"\U00002283",
+    @"\U000003c4",
+    @"\U00000442",
+    @"\U0001d531",
+    @"\U000022a4",
+    @"\U00000443",
+    @"\U0001d532",
+    @"\U000000fc",
+    @"\U00000432",
+    @"\U0001d533",
+    @"\U0001d534",
+    @"\U0001d535",
+    @"\U0000044b",
+    @"\U0001d536",
+    @"\U000000ff",
+    @"\U00000437",
+    @"\U0001d537",
+    @"\U0000200d",
+    @"\U000000c6",
+    @"\U000000c2",
+    @"\U0001d538",
+    @"\U000000c5",
+    @"\U0001d49c",
+    @"\U00002ae7",
+    @"\U00000392",
+    @"\U0001d539",
+    @"\U0000212c",
+    @"\U00000427",
+    @"\U0000010a",
+    @"\U00002102",
+    @"\U0001d49e",
+    @"\U00000402",
+    @"\U00000405",
+    @"\U0000040f",
+    @"\U000021a1",
+    @"\U0001d53b",
+    @"\U0001d49f",
+    @"\U000000ca",
+    @"\U00000116",
+    @"\U0001d53c",
+    @"\U00002130",
+    @"\U00002a73",
+    @"\U0001d53d",
+    @"\U00002131",
+    @"\U00000403",
+    @"\U00000120",
+    @"\U0001d53e",
+    @"\U0001d4a2",
+    @"\U0000210d",
+    @"\U0000210b",
+    @"\U00000415",
+    @"\U00000401",
+    @"\U000000ce",
+    @"\U00000130",
+    @"\U0001d540",
+    @"\U00000399",
+    @"\U00002110",
+    @"\U0001d541",
+    @"\U0001d4a5",
+    @"\U00000425",
+    @"\U0000040c",
+    @"\U0001d542",
+    @"\U0001d4a6",
+    @"\U00000409",
+    @"\U000027ea",
+    @"\U0000219e",
+    @"\U0001d543",
+    @"\U00002112",
+    @"\U0001d544",
+    @"\U00002133",
+    @"\U0000040a",
+    @"\U00002115",
+    @"\U0001d4a9",
+    @"\U000000d4",
+    @"\U0001d546",
+    @"\U0001d4aa",
+    @"\U00002119",
+    @"\U0001d4ab",
+    @"\U0000211a",
+    @"\U0001d4ac",
+    @"\U000027eb",
+    @"\U000021a0",
+    @"\U0000211d",
+    @"\U0000211b",
+    @"\U00000428",
+    @"\U0001d54a",
+    @"\U0000221a",
+    @"\U0001d4ae",
+    @"\U000022c6",
+    @"\U000000de",
+    @"\U00000426",
+    @"\U0001d54b",
+    @"\U0001d4af",
+    @"\U0000219f",
+    @"\U000000db",
+    @"\U0001d54c",
+    @"\U000003d2",
+    @"\U0001d4b0",
+    @"\U00002aeb",
+    @"\U00002016",
+    @"\U0001d54d",
+    @"\U0001d4b1",
+    @"\U0001d54e",
+    @"\U0001d4b2",
+    @"\U0001d54f",
+    @"\U0001d4b3",
+    @"\U0000042f",
+    @"\U00000407",
+    @"\U0000042e",
+    @"\U0001d550",
+    @"\U0001d4b4",
+    @"\U00000178",
+    @"\U00000416",
+    @"\U0000017b",
+    @"\U00000396",
+    @"\U00002124",
+    @"\U0001d4b5",
+    @"\U000000e2",
+    @"\U000000b4",
+    @"\U000000e6",
+    @"\U00002a5c",
+    @"\U00002a5a",
+    @"\U000029a4",
+    @"\U0001d552",
+    @"\U0000224b",
+    @"'",
+    @"\U000000e5",
+    @"\U0001d4b6",
+    @"\U00002aed",
+    @"\U000023b5",
+    @"\U000003b2",
+    @"\U00002136",
+    @"\U00002310",
+    @"\U0001d553",
+    @"\U00002550",
+    @"\U00002551",
+    @"\U00002500",
+    @"\U00002502",
+    @"\U0001d4b7",
+    @"\U0000223d",
+    @"\\",
+    @"\U00002022",
+    @"\U0000224e",
+    @"\U00002229\U0000fe00",
+    @"\U0000010b",
+    @"\U000000b8",
+    @"\U00000447",
+    @"\U000029c3",
+    @"\U000002c6",
+    @"\U00002257",
+    @"\U00002201",
+    @"\U00002245",
+    @"\U0001d554",
+    @"\U0001d4b8",
+    @"\U00002acf",
+    @"\U00002ad0",
+    @"\U0000222a\U0000fe00",
+    @"\U000021d3",
+    @"\U00002965",
+    @"\U00002193",
+    @"\U00002010",
+    @"\U000022c4",
+    @"\U00000452",
+    @"\U0001d555",
+    @"\U0001d4b9",
+    @"\U00000455",
+    @"\U000029f6",
+    @"\U000025bf",
+    @"\U0000045f",
+    @"\U00002251",
+    @"\U00002256",
+    @"\U000000ea",
+    @"\U00000117",
+    @"\U00002003",
+    @"\U00002002",
+    @"\U0001d556",
+    @"\U000022d5",
+    @"\U000003b5",
+    @"\U0000212f",
+    @"\U00002242",
+    @"\U000020ac",
+    @"!",
+    @"\U0000266d",
+    @"\U00000192",
+    @"\U0001d557",
+    @"\U000022d4",
+    @"\U0001d4bb",
+    @"\U00000121",
+    @"\U000022db\U0000fe00",
+    @"\U00000453",
+    @"\U00002a8a",
+    @"\U0001d558",
+    @"\U0000210a",
+    @"\U00002273",
+    @"\U00002aa7",
+    @"\U00002269\U0000fe00",
+    @"\U000000bd",
+    @"\U00002194",
+    @"\U0000210f",
+    @"\U0001d559",
+    @"\U0001d4bd",
+    @"\U000000ee",
+    @"\U00000435",
+    @"\U000000a1",
+    @"\U000022b7",
+    @"\U00000451",
+    @"\U0001d55a",
+    @"\U000003b9",
+    @"\U0001d4be",
+    @"\U0001d55b",
+    @"\U0001d4bf",
+    @"\U00000445",
+    @"\U0000045c",
+    @"\U0001d55c",
+    @"\U0001d4c0",
+    @"\U000021d0",
+    @"\U00002962",
+    @"\U000027e8",
+    @"\U000000ab",
+    @"\U00002190",
+    @"\U00002aad",
+    @"{",
+    @"\U00002936",
+    @"\U000021b2",
+    @"\U000022da\U0000fe00",
+    @"\U00000459",
+    @"\U00002a89",
+    @"\U0001d55d",
+    @"\U000029eb",
+    @"(",
+    @"\U0001d4c1",
+    @"\U00002272",
+    @"[",
+    @"\U00002aa6",
+    @"\U000025c3",
+    @"\U00002268\U0000fe00",
+    @"\U00002642",
+    @"\U00002720",
+    @"\U000000b5",
+    @"\U00002adb",
+    @"\U00002026",
+    @"\U0001d55e",
+    @"\U0001d4c2",
+    @"\U0000226b\U00000338",
+    @"\U0000226a\U00000338",
+    @"\U00002220\U000020d2",
+    @"\U00002a70\U00000338",
+    @"\U00002a43",
+    @"\U00002a42",
+    @"\U00002a7e\U00000338",
+    @"\U000022fa",
+    @"\U0000045a",
+    @"\U00002025",
+    @"\U00002a7d\U00000338",
+    @"\U00002224",
+    @"\U0001d55f",
+    @"\U00002226",
+    @"\U00002aaf\U00000338",
+    @"\U00002ab0\U00000338",
+    @"\U0001d4c3",
+    @"\U00002241",
+    @"\U00002284",
+    @"\U00002285",
+    @"\U00002279",
+    @"\U00002278",
+    @"\U0000224d\U000020d2",
+    @"\U00002265\U000020d2",
+    @">\U000020d2",
+    @"\U00002264\U000020d2",
+    @"<\U000020d2",
+    @"\U0000229b",
+    @"\U0000229a",
+    @"\U000000f4",
+    @"\U00002a38",
+    @"\U00002299",
+    @"\U000002db",
+    @"\U0000222e",
+    @"\U000029b6",
+    @"\U0001d560",
+    @"\U000029b7",
+    @"\U00002a56",
+    @"\U00002134",
+    @"\U00002298",
+    @"\U00002202",
+    @"\U000003d5",
+    @"+",
+    @"\U0001d561",
+    @"\U000000a3",
+    @"\U00002ab7",
+    @"\U00002ab5",
+    @"\U0000220f",
+    @"\U0000221d",
+    @"\U0001d4c5",
+    @"\U00002a0c",
+    @"\U0001d562",
+    @"\U0001d4c6",
+    @"\U000021d2",
+    @"\U00002964",
+    @"\U0000223d\U00000331",
+    @"\U000027e9",
+    @"\U000000bb",
+    @"\U00002192",
+    @"}",
+    @"\U00002937",
+    @"\U000021b3",
+    @"\U000025ad",
+    @"\U000003f1",
+    @"\U000002da",
+    @"\U0001d563",
+    @")",
+    @"\U0001d4c7",
+    @"]",
+    @"\U000025b9",
+    @"\U00002ab8",
+    @"\U00002ab6",
+    @"\U000022c5",
+    @";",
+    @"\U00002736",
+    @"\U00000448",
+    @"\U00002243",
+    @"\U00002a9e",
+    @"\U00002a9d",
+    @"\U00002aac",
+    @"\U000029c4",
+    @"\U0001d564",
+    @"\U000025aa",
+    @"\U0001d4c8",
+    @"\U00002606",
+    @"\U00002ac5",
+    @"\U00002286",
+    @"\U0000266a",
+    @"\U00002ac6",
+    @"\U00002287",
+    @"\U000000df",
+    @"\U000023b4",
+    @"\U000020db",
+    @"\U000000fe",
+    @"\U000000d7",
+    @"\U0000222d",
+    @"\U00002928",
+    @"\U0001d565",
+    @"\U00002929",
+    @"\U0000225c",
+    @"\U0001d4c9",
+    @"\U00000446",
+    @"\U000021d1",
+    @"\U00002963",
+    @"\U00002191",
+    @"\U000000fb",
+    @"\U0001d566",
+    @"\U000003c5",
+    @"\U0001d4ca",
+    @"\U000025b5",
+    @"\U000021d5",
+    @"\U00002ae8",
+    @"\U00002195",
+    @"|",
+    @"\U0001d567",
+    @"\U0001d4cb",
+    @"\U0001d568",
+    @"\U0001d4cc",
+    @"\U000022c2",
+    @"\U000022c3",
+    @"\U000027fc",
+    @"\U000022fb",
+    @"\U0001d569",
+    @"\U0001d4cd",
+    @"\U0000044f",
+    @"\U00000457",
+    @"\U0001d56a",
+    @"\U0001d4ce",
+    @"\U0000044e",
+    @"\U0000017c",
+    @"\U000003b6",
+    @"\U00000436",
+    @"\U0001d56b",
+    @"\U0001d4cf",
+    @"\U0000200c",
+    @"\U000000c1",
+    @"\U000000c0",
+    @"\U00000391",
+    @"\U00000100",
+    @"\U00000104",
+    @"\U000000c3",
+    @"\U000002d8",
+    @"\U000000c7",
+    @"\U00000108",
+    @"\U00002237",
+    @"\U00002a2f",
+    @"\U00002ae4",
+    @"\U00000394",
+    @"\U000000c9",
+    @"\U000000c8",
+    @"\U00000112",
+    @"\U00000118",
+    @"\U00002a75",
+    @"\U00000393",
+    @"\U0000011c",
+    @"\U000002c7",
+    @"\U00000124",
+    @"\U00000132",
+    @"\U000000cd",
+    @"\U000000cc",
+    @"\U0000012a",
+    @"\U0000012e",
+    @"\U00000406",
+    @"\U00000134",
+    @"\U00000404",
+    @"\U0000039a",
+    @"\U000000d1",
+    @"\U00000152",
+    @"\U000000d3",
+    @"\U000000d2",
+    @"\U0000014c",
+    @"\U000000d8",
+    @"\U000000d5",
+    @"\U00002033",
+    @"\U00002910",
+    @"\U0000015c",
+    @"\U000003a3",
+    @"\U00002122",
+    @"\U0000040b",
+    @"\U00000398",
+    @"\U000000da",
+    @"\U0000040e",
+    @"\U000000d9",
+    @"\U0000016a",
+    @"\U00000172",
+    @"\U0000016e",
+    @"\U000022ab",
+    @"\U000022a9",
+    @"\U00000174",
+    @"\U000022c0",
+    @"\U000000dd",
+    @"\U00000176",
+    @"\U000000e1",
+    @"\U000000e0",
+    @"\U00002135",
+    @"\U000003b1",
+    @"\U00000101",
+    @"\U00002a3f",
+    @"\U0000221f",
+    @"\U00000105",
+    @"\U000000e3",
+    @"\U00002a11",
+    @"\U0000224c",
+    @"\U0000201e",
+    @"\U000003f6",
+    @"\U00002423",
+    @"\U00002592",
+    @"\U00002591",
+    @"\U00002593",
+    @"\U00002588",
+    @"\U00002557",
+    @"\U00002554",
+    @"\U00002556",
+    @"\U00002553",
+    @"\U00002566",
+    @"\U00002569",
+    @"\U00002564",
+    @"\U00002567",
+    @"\U0000255d",
+    @"\U0000255a",
+    @"\U0000255c",
+    @"\U00002559",
+    @"\U0000256c",
+    @"\U00002563",
+    @"\U00002560",
+    @"\U0000256b",
+    @"\U00002562",
+    @"\U0000255f",
+    @"\U00002555",
+    @"\U00002552",
+    @"\U00002510",
+    @"\U0000250c",
+    @"\U00002565",
+    @"\U00002568",
+    @"\U0000252c",
+    @"\U00002534",
+    @"\U0000255b",
+    @"\U00002558",
+    @"\U00002518",
+    @"\U00002514",
+    @"\U0000256a",
+    @"\U00002561",
+    @"\U0000255e",
+    @"\U0000253c",
+    @"\U00002524",
+    @"\U0000251c",
+    @"\U000000a6",
+    @"\U0000204f",
+    @"\U000022cd",
+    @"\U000029c5",
+    @"\U00002aae",
+    @"\U0000224f",
+    @"\U00002041",
+    @"\U00002a4d",
+    @"\U000000e7",
+    @"\U00000109",
+    @"\U00002a4c",
+    @"\U00002713",
+    @"\U00002663",
+    @":",
+    @",",
+    @"\U000021b5",
+    @"\U00002717",
+    @"\U00002ad1",
+    @"\U00002ad2",
+    @"\U000022ef",
+    @"\U000022de",
+    @"\U000022df",
+    @"\U00002a45",
+    @"\U000000a4",
+    @"\U000022ce",
+    @"\U000022cf",
+    @"\U00002231",
+    @"\U000022a3",
+    @"\U000002dd",
+    @"\U000021ca",
+    @"\U000003b4",
+    @"\U000021c3",
+    @"\U000021c2",
+    @"\U00002666",
+    @"\U000022f2",
+    @"\U00002250",
+    @"\U000022f1",
+    @"\U000025be",
+    @"\U000021f5",
+    @"\U0000296f",
+    @"\U00002a77",
+    @"\U000000e9",
+    @"\U00002252",
+    @"\U000000e8",
+    @"\U00000113",
+    @"\U00002205",
+    @"\U00000119",
+    @"\U00002a71",
+    @"\U000003f5",
+    @"\U00002261",
+    @"\U00002253",
+    @"\U00002971",
+    @"\U00002203",
+    @"\U0000fb00",
+    @"\U0000fb01",
+    @"fj",
+    @"\U0000fb02",
+    @"\U000025b1",
+    @"\U00002ad9",
+    @"\U000000bc",
+    @"\U000000be",
+    @"\U00002044",
+    @"\U00002322",
+    @"\U000003b3",
+    @"\U0000011d",
+    @"\U00002aa9",
+    @"\U00002137",
+    @"\U000022e7",
+    @"\U00000060",
+    @"\U00002a8e",
+    @"\U00002a90",
+    @"\U00002a7a",
+    @"\U000022d7",
+    @"\U000021ad",
+    @"\U00000125",
+    @"\U000021ff",
+    @"\U000000ed",
+    @"\U000000ec",
+    @"\U00002129",
+    @"\U00000133",
+    @"\U0000012b",
+    @"\U00000131",
+    @"\U000001b5",
+    @"\U0000221e",
+    @"\U0000012f",
+    @"\U00002a3c",
+    @"\U000000bf",
+    @"\U000022f9",
+    @"\U000022f4",
+    @"\U00000456",
+    @"\U00000135",
+    @"\U00000237",
+    @"\U00000454",
+    @"\U000003ba",
+    @"\U000021da",
+    @"\U0000290e",
+    @"\U00002991",
+    @"\U000021e4",
+    @"\U00002aad\U0000fe00",
+    @"\U0000290c",
+    @"\U00002772",
+    @"\U0000298b",
+    @"\U00002308",
+    @"\U0000201c",
+    @"\U00002aa8",
+    @"\U000021bd",
+    @"\U000021bc",
+    @"\U00002584",
+    @"\U000021c7",
+    @"\U000025fa",
+    @"\U000022e6",
+    @"\U000027ec",
+    @"\U000021fd",
+    @"\U000027e6",
+    @"\U00002985",
+    @"\U000021c6",
+    @"\U000021cb",
+    @"\U000022bf",
+    @"\U00002a8d",
+    @"\U00002a8f",
+    @"\U00002018",
+    @"\U00002a79",
+    @"\U000022d6",
+    @"\U000022b4",
+    @"\U000025c2",
+    @"\U0000223a",
+    @"\U00002014",
+    @"\U000000b7",
+    @"\U00002212",
+    @"\U000022b8",
+    @"\U0000224b\U00000338",
+    @"\U00000149",
+    @"\U0000266e",
+    @"\U0000224e\U00000338",
+    @"\U00002247",
+    @"\U00002013",
+    @"\U000021d7",
+    @"\U00002197",
+    @"\U00002250\U00000338",
+    @"\U00002242\U00000338",
+    @"\U00002275",
+    @"\U000021ce",
+    @"\U000021ae",
+    @"\U00002af2",
+    @"\U000021cd",
+    @"\U0000219a",
+    @"\U00002274",
+    @"\U000022ea",
+    @"\U00002209",
+    @"\U0000220c",
+    @"\U00002202\U00000338",
+    @"\U000021cf",
+    @"\U0000219b",
+    @"\U000022eb",
+    @"\U00002244",
+    @"\U00002ac5\U00000338",
+    @"\U00002288",
+    @"\U00002ac6\U00000338",
+    @"\U00002289",
+    @"\U000000f1",
+    @"\U00002007",
+    @"\U0000223c\U000020d2",
+    @"\U000021d6",
+    @"\U00002196",
+    @"\U000000f3",
+    @"\U0000229d",
+    @"\U00000153",
+    @"\U000029bf",
+    @"\U000000f2",
+    @"\U000029b5",
+    @"\U000021ba",
+    @"\U000029be",
+    @"\U0000203e",
+    @"\U0000014d",
+    @"\U000003c9",
+    @"\U000029b9",
+    @"\U00002295",
+    @"\U000021bb",
+    @"\U000000f8",
+    @"\U000000f5",
+    @"\U0000233d",
+    @"\U00002afd",
+    @"\U0000260e",
+    @"\U0000229e",
+    @"\U00002a72",
+    @"\U0000227c",
+    @"\U00002032",
+    @"\U00002ab9",
+    @"\U0000227e",
+    @"?",
+    @"\U000021db",
+    @"\U0000290f",
+    @"\U00002992",
+    @"\U000029a5",
+    @"\U000021e5",
+    @"\U00002933",
+    @"\U0000219d",
+    @"\U00002236",
+    @"\U0000290d",
+    @"\U00002773",
+    @"\U0000298c",
+    @"\U00002309",
+    @"\U0000201d",
+    @"\U000021c1",
+    @"\U000021c0",
+    @"\U000021c4",
+    @"\U000021cc",
+    @"\U00002aee",
+    @"\U000027ed",
+    @"\U000021fe",
+    @"\U000027e7",
+    @"\U00002986",
+    @"\U000021c9",
+    @"\U00002019",
+    @"\U000022b5",
+    @"\U000025b8",
+    @"\U0000201a",
+    @"\U0000227d",
+    @"\U0000015d",
+    @"\U00002aba",
+    @"\U0000227f",
+    @"\U000022a1",
+    @"\U00002a66",
+    @"\U000021d8",
+    @"\U00002198",
+    @"\U00002216",
+    @"\U0000266f",
+    @"\U000003c3",
+    @"\U00002aa0",
+    @"\U00002a9f",
+    @"\U00002246",
+    @"\U00002323",
+    @"\U00002aac\U0000fe00",
+    @"\U00002293",
+    @"\U00002294",
+    @"\U0000228f",
+    @"\U00002290",
+    @"\U00002605",
+    @"\U00002acb",
+    @"\U0000228a",
+    @"\U00002acc",
+    @"\U0000228b",
+    @"\U000021d9",
+    @"\U00002199",
+    @"\U000003b8",
+    @"\U000002dc",
+    @"\U000029cd",
+    @"\U0000045b",
+    @"\U0000226c",
+    @"\U000000fa",
+    @"\U0000045e",
+    @"\U000021c5",
+    @"\U0000296e",
+    @"\U000000f9",
+    @"\U000021bf",
+    @"\U000021be",
+    @"\U00002580",
+    @"\U000025f8",
+    @"\U0000016b",
+    @"\U00000173",
+    @"\U0000228e",
+    @"\U0000016f",
+    @"\U000025f9",
+    @"\U000022f0",
+    @"\U000025b4",
+    @"\U000021c8",
+    @"\U00002ae9",
+    @"\U000022a8",
+    @"\U000022a2",
+    @"\U0000225a",
+    @"\U000022b2",
+    @"\U00002282\U000020d2",
+    @"\U00002283\U000020d2",
+    @"\U000022b3",
+    @"\U00000175",
+    @"\U000025ef",
+    @"\U000025bd",
+    @"\U000027fa",
+    @"\U000027f7",
+    @"\U000027f8",
+    @"\U000027f5",
+    @"\U00002a00",
+    @"\U000027f9",
+    @"\U000027f6",
+    @"\U000025b3",
+    @"\U000000fd",
+    @"\U00000177",
+    @"\U00000102",
+    @"\U00002254",
+    @"\U00002306",
+    @"\U00000106",
+    @"\U0000010c",
+    @"\U00002a74",
+    @"\U0000222f",
+    @"\U0000224d",
+    @"\U00002021",
+    @"\U0000010e",
+    @"\U000020dc",
+    @"\U00000110",
+    @"\U0000011a",
+    @"\U00002200",
+    @"\U000003dc",
+    @"\U0000011e",
+    @"\U00000122",
+    @"\U0000042a",
+    @"\U00000126",
+    @"\U00000128",
+    @"\U00000408",
+    @"\U00000136",
+    @"\U00000139",
+    @"\U0000039b",
+    @"\U0000013d",
+    @"\U0000013b",
+    @"\U0000013f",
+    @"\U00000141",
+    @"\U00000143",
+    @"\U00000147",
+    @"\U00000145",
+    @"\U00000150",
+    @"\U00002a37",
+    @"\U00000154",
+    @"\U00002916",
+    @"\U00000158",
+    @"\U00000156",
+    @"\U00000429",
+    @"\U0000042c",
+    @"\U0000015a",
+    @"\U00000160",
+    @"\U0000015e",
+    @"\U00000164",
+    @"\U00000162",
+    @"\U00000166",
+    @"\U0000016c",
+    @"\U00000170",
+    @"\U00000168",
+    @"\U00002ae6",
+    @"\U000022aa",
+    @"\U00000179",
+    @"\U0000017d",
+    @"\U00000103",
+    @"\U00002a55",
+    @"\U00002221",
+    @"\U00002222",
+    @"\U00002a6f",
+    @"\U000022bd",
+    @"\U00002305",
+    @"\U00002235",
+    @"\U000022c8",
+    @"\U000029c9",
+    @"\U00002035",
+    @"\U00000107",
+    @"\U00002a44",
+    @"\U00002a4b",
+    @"\U00002a47",
+    @"\U00002a40",
+    @"\U0000010d",
+    @"\U00002aef",
+    @"\U00000040",
+    @"\U00002218",
+    @"\U00002210",
+    @"\U00002117",
+    @"\U000021b6",
+    @"\U00002a46",
+    @"\U00002a4a",
+    @"\U0000228d",
+    @"\U000021b7",
+    @"\U0000232d",
+    @"\U00002020",
+    @"\U00002138",
+    @"\U0000010f",
+    @"\U0000297f",
+    @"\U000022c7",
+    @"\U0000231e",
+    @"\U0000230d",
+    @"\U00000024",
+    @"\U0000231f",
+    @"\U0000230c",
+    @"\U00000111",
+    @"\U00002a6e",
+    @"\U0000011b",
+    @"\U00002255",
+    @"\U00002a98",
+    @"\U00002a97",
+    @"\U00002004",
+    @"\U00002005",
+    @"\U000029e3",
+    @"=",
+    @"\U0000225f",
+    @"\U00002640",
+    @"\U0000fb03",
+    @"\U0000fb04",
+    @"\U00002153",
+    @"\U00002155",
+    @"\U00002159",
+    @"\U0000215b",
+    @"\U00002154",
+    @"\U00002156",
+    @"\U00002157",
+    @"\U0000215c",
+    @"\U00002158",
+    @"\U0000215a",
+    @"\U0000215d",
+    @"\U0000215e",
+    @"\U000001f5",
+    @"\U000003dd",
+    @"\U0000011f",
+    @"\U00002a80",
+    @"\U00002a94",
+    @"\U00002995",
+    @"\U00002978",
+    @"\U0000200a",
+    @"\U0000044a",
+    @"\U00002665",
+    @"\U000022b9",
+    @"\U0000223b",
+    @"\U00002015",
+    @"\U00000127",
+    @"\U00002043",
+    @"\U000029dc",
+    @"\U00002105",
+    @"\U000022ba",
+    @"\U000022f3",
+    @"\U00000129",
+    @"\U00000458",
+    @"\U000003f0",
+    @"\U00000137",
+    @"\U00000138",
+    @"\U0000291b",
+    @"\U0000013a",
+    @"\U000003bb",
+    @"\U0000291d",
+    @"\U000021a9",
+    @"\U000021ab",
+    @"\U00002939",
+    @"\U000021a2",
+    @"\U00002919",
+    @"\U0000013e",
+    @"\U0000013c",
+    @"\U00002a7f",
+    @"\U00002a93",
+    @"\U0000297c",
+    @"\U0000230a",
+    @"\U0000296a",
+    @"\U0000296b",
+    @"\U00000140",
+    @"\U000023b0",
+    @"\U00002a2d",
+    @"\U00002217",
+    @"_",
+    @"\U00002993",
+    @"\U0000296d",
+    @"\U00002039",
+    @"\U00000142",
+    @"\U000022cb",
+    @"\U000022c9",
+    @"\U00002976",
+    @"\U00002996",
+    @"\U000025ae",
+    @"\U00002a29",
+    @"\U00002af0",
+    @"\U0000229f",
+    @"\U00002238",
+    @"\U000022a7",
+    @"\U000022af",
+    @"\U000022ae",
+    @"\U00000144",
+    @"\U0000224f\U00000338",
+    @"\U00000148",
+    @"\U00000146",
+    @"\U00002924",
+    @"\U00002262",
+    @"\U00002204",
+    @"\U000022ec",
+    @"\U000022f9\U00000338",
+    @"\U00002afd\U000020e5",
+    @"\U000022e0",
+    @"\U00002933\U00000338",
+    @"\U0000219d\U00000338",
+    @"\U000022ed",
+    @"\U000022e1",
+    @"\U00002116",
+    @"\U000022ad",
+    @"\U00002904",
+    @"\U000022ac",
+    @"\U00002902",
+    @"\U00002903",
+    @"\U00002923",
+    @"\U00002927",
+    @"\U00000151",
+    @"\U000029bc",
+    @"\U00002296",
+    @"\U000022b6",
+    @"\U00002297",
+    @"\U00002af3",
+    @"%",
+    @".",
+    @"\U00002030",
+    @"\U00002214",
+    @"\U00002a25",
+    @"\U000022e8",
+    @"\U000022b0",
+    @"\U00002008",
+    @"\U00002057",
+    @"\U0000291c",
+    @"\U00000155",
+    @"\U00002975",
+    @"\U0000291e",
+    @"\U000021aa",
+    @"\U000021ac",
+    @"\U00002945",
+    @"\U000021a3",
+    @"\U0000291a",
+    @"\U00000159",
+    @"\U00000157",
+    @"\U0000297d",
+    @"\U0000230b",
+    @"\U0000296c",
+    @"\U000023b1",
+    @"\U00002a2e",
+    @"\U00002994",
+    @"\U0000203a",
+    @"\U000022cc",
+    @"\U000022ca",
+    @"\U0000015b",
+    @"\U00000161",
+    @"\U0000015f",
+    @"\U000022e9",
+    @"\U00002925",
+    @"\U00000449",
+    @"\U000003c2",
+    @"\U00002a6a",
+    @"\U00002a33",
+    @"\U0000044c",
+    @"\U0000233f",
+    @"\U00002660",
+    @"\U00002293\U0000fe00",
+    @"\U00002294\U0000fe00",
+    @"\U00002291",
+    @"\U00002292",
+    @"\U00002abd",
+    @"\U00002ac7",
+    @"\U00002ad5",
+    @"\U00002ad3",
+    @"\U00002abe",
+    @"\U00002ac8",
+    @"\U00002ad4",
+    @"\U00002ad6",
+    @"\U00002926",
+    @"\U0000292a",
+    @"\U00002316",
+    @"\U00000165",
+    @"\U00000163",
+    @"\U00002315",
+    @"\U00002234",
+    @"\U000003d1",
+    @"\U00002009",
+    @"\U000022a0",
+    @"\U00002a30",
+    @"\U00002336",
+    @"\U00002af1",
+    @"\U00002034",
+    @"\U000025ec",
+    @"\U00000167",
+    @"\U0000016d",
+    @"\U00000171",
+    @"\U0000297e",
+    @"\U0000231c",
+    @"\U0000230f",
+    @"\U0000231d",
+    @"\U0000230e",
+    @"\U00000169",
+    @"\U0000299c",
+    @"\U000022bb",
+    @"\U000022ee",
+    @"\U00002acb\U0000fe00",
+    @"\U0000228a\U0000fe00",
+    @"\U00002acc\U0000fe00",
+    @"\U0000228b\U0000fe00",
+    @"\U00002a5f",
+    @"\U00002259",
+    @"\U00002a01",
+    @"\U00002a02",
+    @"\U00002a06",
+    @"\U00002a04",
+    @"\U0000017a",
+    @"\U0000017e",
+    @"\U00002230",
+    @"\U00000395",
+    @"\n",
+    @"\U00002060",
+    @"\U0000039f",
+    @"\U000003a5",
+    @"\U000022be",
+    @"\U0000237c",
+    @"\U000029b0",
+    @"\U00002261\U000020e5",
+    @"\U00002a50",
+    @"\U000029b2",
+    @"\U000029c2",
+    @"\U00002a6d",
+    @"\U00002938",
+    @"\U00002935",
+    @"\U0000293d",
+    @"\U0000293c",
+    @"\U000029b1",
+    @"\U000029a6",
+    @"\U00002a78",
+    @"\U00002a82",
+    @"\U00002a7c",
+    @"\U00002948",
+    @"\U000022f5",
+    @"\U0000291f",
+    @"\U00002973",
+    @"\U0000298f",
+    @"\U0000298d",
+    @"\U00002967",
+    @"\U00002a81",
+    @"\U00002a34",
+    @"\U00002a7b",
+    @"\U00002966",
+    @"\U00002a2a",
+    @"\U000022f7",
+    @"\U000022f6",
+    @"\U000022fe",
+    @"\U000022fd",
+    @"\U00002a14",
+    @"\U000022e2",
+    @"\U000022e3",
+    @"\U000029de",
+    @"\U000022b4\U000020d2",
+    @"\U000022b5\U000020d2",
+    @"\U000029bb",
+    @"\U000003bf",
+    @"\U00002a57",
+    @"\U00002031",
+    @"\U0000210e",
+    @"\U00002a22",
+    @"\U00002a26",
+    @"\U00002a27",
+    @"\U00002a16",
+    @"\U00002920",
+    @"\U00002974",
+    @"\U0000298e",
+    @"\U00002990",
+    @"\U00002969",
+    @"\U00002a35",
+    @"\U00002968",
+    @"\U00002a24",
+    @"\U00002972",
+    @"\U00002ac3",
+    @"\U00002ac1",
+    @"\U00002abf",
+    @"\U00002979",
+    @"\U00002ad8",
+    @"\U00002ac4",
+    @"\U000027c9",
+    @"\U00002ad7",
+    @"\U0000297b",
+    @"\U00002ac2",
+    @"\U00002ac0",
+    @"\U00002ada",
+    @"\U00002a39",
+    @"\U00002a3b",
+    @"\U000029a7",
+    @"\U0000299a",
+    @"\U000021dd",
+    @"\U00002911",
+    @"\U00002aa1",
+    @"\U00002949",
+    @"\U00002a58",
+    @"\U000029a8",
+    @"\U000029a9",
+    @"\U000029aa",
+    @"\U000029ab",
+    @"\U000029ac",
+    @"\U000029ad",
+    @"\U000029ae",
+    @"\U000029af",
+    @"\U0000299d",
+    @"\U00002233",
+    @"\U000023b6",
+    @"\U000027c8",
+    @"\U00002a49",
+    @"\U00002a10",
+    @"\U00002a48",
+    @"\U00002232",
+    @"\U000027ff",
+    @"\U000023e7",
+    @"\U000029e5",
+    @"\U00002a0d",
+    @"\U00002a84",
+    @"\U000029dd",
+    @"\U00002a17",
+    @"\U000029b4",
+    @"\U0000294b",
+    @"\U00002a83",
+    @"\U0000294a",
+    @"\U000021a5",
+    @"\U00002a6d\U00000338",
+    @"\U000022f5\U00000338",
+    @"\U00002a36",
+    @"\U00002a23",
+    @"\U00002a15",
+    @"\U0000232e",
+    @"\U00002312",
+    @"\U00002313",
+    @"\U000029b3",
+    @"\U00002a12",
+    @"\U000029ce",
+    @"\U00002a13",
+    @"\U000029e4",
+    @"\U00002a31",
+    @"\U00002a3a",
+    @"\U000023e2",
+    @"\U00000311",
+    @"\U0000226d",
+    @"\U000023de",
+    @"\U0000205f\U0000200a",
+    @"\U000023df",
+    @"\U00002912",
+    @"\U000021a7",
+    @"\U000021a4",
+    @"\U0000205f",
+    @"\U000029f4",
+    @"\U00002913",
+    @"\U00002970",
+    @"\U0000295a",
+    @"\U00002952",
+    @"\U00002aa2",
+    @"\U0000295b",
+    @"\U00002953",
+    @"\U0000200b",
+    @"\U0000294e",
+    @"\U000029cf",
+    @"\U00002960",
+    @"\U00002958",
+    @"\U0000228f\U00000338",
+    @"\U000023dc",
+    @"\U000025fb",
+    @"\U00002951",
+    @"\U0000227f\U00000338",
+    @"\U000029d0",
+    @"\U0000295c",
+    @"\U00002954",
+    @"\U000023dd",
+    @"\U0000295e",
+    @"\U00002956",
+    @"\U000025fc",
+    @"\U00002961",
+    @"\U00002959",
+    @"\U00002aa1\U00000338",
+    @"\U00002290\U00000338",
+    @"\U0000294f",
+    @"\U00002758",
+    @"\U0000295f",
+    @"\U00002957",
+    @"\U000029cf\U00000338",
+    @"\U0000295d",
+    @"\U00002955",
+    @"\U00002950",
+    @"\U000029d0\U00000338",
+    @"\U000025ab",
+    @"\U00002aa2\U00000338",
 };
 
-static const NamedReferenceMap NamedSemicolonlessReferences[] = {
-    { @"AElig", @"\U000000c6" },
-    { @"AMP", @"&" },
-    { @"Aacute", @"\U000000c1" },
-    { @"Acirc", @"\U000000c2" },
-    { @"Agrave", @"\U000000c0" },
-    { @"Aring", @"\U000000c5" },
-    { @"Atilde", @"\U000000c3" },
-    { @"Auml", @"\U000000c4" },
-    { @"COPY", @"\U000000a9" },
-    { @"Ccedil", @"\U000000c7" },
-    { @"ETH", @"\U000000d0" },
-    { @"Eacute", @"\U000000c9" },
-    { @"Ecirc", @"\U000000ca" },
-    { @"Egrave", @"\U000000c8" },
-    { @"Euml", @"\U000000cb" },
-    { @"GT", @">" },
-    { @"Iacute", @"\U000000cd" },
-    { @"Icirc", @"\U000000ce" },
-    { @"Igrave", @"\U000000cc" },
-    { @"Iuml", @"\U000000cf" },
-    { @"LT", @"<" },
-    { @"Ntilde", @"\U000000d1" },
-    { @"Oacute", @"\U000000d3" },
-    { @"Ocirc", @"\U000000d4" },
-    { @"Ograve", @"\U000000d2" },
-    { @"Oslash", @"\U000000d8" },
-    { @"Otilde", @"\U000000d5" },
-    { @"Ouml", @"\U000000d6" },
-    { @"QUOT", @"\"" },
-    { @"REG", @"\U000000ae" },
-    { @"THORN", @"\U000000de" },
-    { @"Uacute", @"\U000000da" },
-    { @"Ucirc", @"\U000000db" },
-    { @"Ugrave", @"\U000000d9" },
-    { @"Uuml", @"\U000000dc" },
-    { @"Yacute", @"\U000000dd" },
-    { @"aacute", @"\U000000e1" },
-    { @"acirc", @"\U000000e2" },
-    { @"acute", @"\U000000b4" },
-    { @"aelig", @"\U000000e6" },
-    { @"agrave", @"\U000000e0" },
-    { @"amp", @"&" },
-    { @"aring", @"\U000000e5" },
-    { @"atilde", @"\U000000e3" },
-    { @"auml", @"\U000000e4" },
-    { @"brvbar", @"\U000000a6" },
-    { @"ccedil", @"\U000000e7" },
-    { @"cedil", @"\U000000b8" },
-    { @"cent", @"\U000000a2" },
-    { @"copy", @"\U000000a9" },
-    { @"curren", @"\U000000a4" },
-    { @"deg", @"\U000000b0" },
-    { @"divide", @"\U000000f7" },
-    { @"eacute", @"\U000000e9" },
-    { @"ecirc", @"\U000000ea" },
-    { @"egrave", @"\U000000e8" },
-    { @"eth", @"\U000000f0" },
-    { @"euml", @"\U000000eb" },
-    { @"frac12", @"\U000000bd" },
-    { @"frac14", @"\U000000bc" },
-    { @"frac34", @"\U000000be" },
-    { @"gt", @">" },
-    { @"iacute", @"\U000000ed" },
-    { @"icirc", @"\U000000ee" },
-    { @"iexcl", @"\U000000a1" },
-    { @"igrave", @"\U000000ec" },
-    { @"iquest", @"\U000000bf" },
-    { @"iuml", @"\U000000ef" },
-    { @"laquo", @"\U000000ab" },
-    { @"lt", @"<" },
-    { @"macr", @"\U000000af" },
-    { @"micro", @"\U000000b5" },
-    { @"middot", @"\U000000b7" },
-    { @"nbsp", @"\U000000a0" },
-    { @"not", @"\U000000ac" },
-    { @"ntilde", @"\U000000f1" },
-    { @"oacute", @"\U000000f3" },
-    { @"ocirc", @"\U000000f4" },
-    { @"ograve", @"\U000000f2" },
-    { @"ordf", @"\U000000aa" },
-    { @"ordm", @"\U000000ba" },
-    { @"oslash", @"\U000000f8" },
-    { @"otilde", @"\U000000f5" },
-    { @"ouml", @"\U000000f6" },
-    { @"para", @"\U000000b6" },
-    { @"plusmn", @"\U000000b1" },
-    { @"pound", @"\U000000a3" },
-    { @"quot", @"\"" },
-    { @"raquo", @"\U000000bb" },
-    { @"reg", @"\U000000ae" },
-    { @"sect", @"\U000000a7" },
-    { @"shy", @"\U000000ad" },
-    { @"sup1", @"\U000000b9" },
-    { @"sup2", @"\U000000b2" },
-    { @"sup3", @"\U000000b3" },
-    { @"szlig", @"\U000000df" },
-    { @"thorn", @"\U000000fe" },
-    { @"times", @"\U000000d7" },
-    { @"uacute", @"\U000000fa" },
-    { @"ucirc", @"\U000000fb" },
-    { @"ugrave", @"\U000000f9" },
-    { @"uml", @"\U000000a8" },
-    { @"uuml", @"\U000000fc" },
-    { @"yacute", @"\U000000fd" },
-    { @"yen", @"\U000000a5" },
-    { @"yuml", @"\U000000ff" },
+static const NamedReferenceNode NamedReferenceNodes[] = {
+    { '\0', 52, 1, 0 },
+    { 'A', 16, 53, 0 },
+    { 'B', 8, 69, 0 },
+    { 'C', 14, 77, 0 },
+    { 'D', 11, 91, 0 },
+    { 'E', 16, 102, 0 },
+    { 'F', 5, 118, 0 },
+    { 'G', 12, 123, 0 },
+    { 'H', 8, 135, 0 },
+    { 'I', 14, 143, 0 },
+    { 'J', 5, 157, 0 },
+    { 'K', 7, 162, 0 },
+    { 'L', 11, 169, 0 },
+    { 'M', 8, 180, 0 },
+    { 'N', 9, 188, 0 },
+    { 'O', 14, 197, 0 },
+    { 'P', 9, 211, 0 },
+    { 'Q', 4, 220, 0 },
+    { 'R', 12, 224, 0 },
+    { 'S', 13, 236, 0 },
+    { 'T', 11, 249, 0 },
+    { 'U', 14, 260, 0 },
+    { 'V', 9, 274, 0 },
+    { 'W', 5, 283, 0 },
+    { 'X', 4, 288, 0 },
+    { 'Y', 9, 292, 0 },
+    { 'Z', 8, 301, 0 },
+    { 'a', 16, 309, 0 },
+    { 'b', 16, 325, 0 },
+    { 'c', 15, 341, 0 },
+    { 'd', 19, 356, 0 },
+    { 'e', 18, 375, 0 },
+    { 'f', 12, 393, 0 },
+    { 'g', 17, 405, 0 },
+    { 'h', 10, 422, 0 },
+    { 'i', 15, 432, 0 },
+    { 'j', 6, 447, 0 },
+    { 'k', 8, 453, 0 },
+    { 'l', 23, 461, 0 },
+    { 'm', 14, 484, 0 },
+    { 'n', 24, 498, 0 },
+    { 'o', 18, 522, 0 },
+    { 'p', 12, 540, 0 },
+    { 'q', 6, 552, 0 },
+    { 'r', 21, 558, 0 },
+    { 's', 19, 579, 0 },
+    { 't', 13, 598, 0 },
+    { 'u', 18, 611, 0 },
+    { 'v', 15, 629, 0 },
+    { 'w', 7, 644, 0 },
+    { 'x', 14, 651, 0 },
+    { 'y', 8, 665, 0 },
+    { 'z', 10, 673, 0 },
+    { 'E', 1, 683, 0 },
+    { 'M', 1, 684, 0 },
+    { 'a', 1, 685, 0 },
+    { 'b', 1, 686, 0 },
+    { 'c', 2, 687, 0 },
+    { 'f', 1, 689, 0 },
+    { 'g', 1, 690, 0 },
+    { 'l', 1, 691, 0 },
+    { 'm', 1, 692, 0 },
+    { 'n', 1, 693, 0 },
+    { 'o', 2, 694, 0 },
+    { 'p', 1, 696, 0 },
+    { 'r', 1, 697, 0 },
+    { 's', 2, 698, 0 },
+    { 't', 1, 700, 0 },
+    { 'u', 1, 701, 0 },
+    { 'a', 2, 702, 0 },
+    { 'c', 1, 704, 0 },
+    { 'e', 3, 705, 0 },
+    { 'f', 1, 708, 0 },
+    { 'o', 1, 709, 0 },
+    { 'r', 1, 710, 0 },
+    { 's', 1, 711, 0 },
+    { 'u', 1, 712, 0 },
+    { 'H', 1, 713, 0 },
+    { 'O', 1, 714, 0 },
+    { 'a', 3, 715, 0 },
+    { 'c', 4, 718, 0 },
+    { 'd', 1, 722, 0 },
+    { 'e', 2, 723, 0 },
+    { 'f', 1, 725, 0 },
+    { 'h', 1, 726, 0 },
+    { 'i', 1, 727, 0 },
+    { 'l', 1, 728, 0 },
+    { 'o', 4, 729, 0 },
+    { 'r', 1, 733, 0 },
+    { 's', 1, 734, 0 },
+    { 'u', 1, 735, 0 },
+    { 'D', 2, 736, 0 },
+    { 'J', 1, 738, 0 },
+    { 'S', 1, 739, 0 },
+    { 'Z', 1, 740, 0 },
+    { 'a', 3, 741, 0 },
+    { 'c', 2, 744, 0 },
+    { 'e', 1, 746, 0 },
+    { 'f', 1, 747, 0 },
+    { 'i', 2, 748, 0 },
+    { 'o', 4, 750, 0 },
+    { 's', 2, 754, 0 },
+    { 'N', 1, 756, 0 },
+    { 'T', 1, 757, 0 },
+    { 'a', 1, 758, 0 },
+    { 'c', 3, 759, 0 },
+    { 'd', 1, 762, 0 },
+    { 'f', 1, 763, 0 },
+    { 'g', 1, 764, 0 },
+    { 'l', 1, 765, 0 },
+    { 'm', 2, 766, 0 },
+    { 'o', 2, 768, 0 },
+    { 'p', 1, 770, 0 },
+    { 'q', 1, 771, 0 },
+    { 's', 2, 772, 0 },
+    { 't', 1, 774, 0 },
+    { 'u', 1, 775, 0 },
+    { 'x', 2, 776, 0 },
+    { 'c', 1, 778, 0 },
+    { 'f', 1, 779, 0 },
+    { 'i', 1, 780, 0 },
+    { 'o', 3, 781, 0 },
+    { 's', 1, 784, 0 },
+    { 'J', 1, 785, 0 },
+    { 'T', 1, 786, 1 },
+    { 'a', 1, 787, 0 },
+    { 'b', 1, 788, 0 },
+    { 'c', 3, 789, 0 },
+    { 'd', 1, 792, 0 },
+    { 'f', 1, 793, 0 },
+    { 'g', 1, 794, 0 },
+    { 'o', 1, 795, 0 },
+    { 'r', 1, 796, 0 },
+    { 's', 1, 797, 0 },
+    { 't', 1, 798, 0 },
+    { 'A', 1, 799, 0 },
+    { 'a', 2, 800, 0 },
+    { 'c', 1, 802, 0 },
+    { 'f', 1, 803, 0 },
+    { 'i', 1, 804, 0 },
+    { 'o', 2, 805, 0 },
+    { 's', 2, 807, 0 },
+    { 'u', 1, 809, 0 },
+    { 'E', 1, 810, 0 },
+    { 'J', 1, 811, 0 },
+    { 'O', 1, 812, 0 },
+    { 'a', 1, 813, 0 },
+    { 'c', 2, 814, 0 },
+    { 'd', 1, 816, 0 },
+    { 'f', 1, 817, 0 },
+    { 'g', 1, 818, 0 },
+    { 'm', 3, 819, 0 },
+    { 'n', 2, 822, 0 },
+    { 'o', 3, 824, 0 },
+    { 's', 1, 827, 0 },
+    { 't', 1, 828, 0 },
+    { 'u', 2, 829, 0 },
+    { 'c', 2, 831, 0 },
+    { 'f', 1, 833, 0 },
+    { 'o', 1, 834, 0 },
+    { 's', 2, 835, 0 },
+    { 'u', 1, 837, 0 },
+    { 'H', 1, 838, 0 },
+    { 'J', 1, 839, 0 },
+    { 'a', 1, 840, 0 },
+    { 'c', 2, 841, 0 },
+    { 'f', 1, 843, 0 },
+    { 'o', 1, 844, 0 },
+    { 's', 1, 845, 0 },
+    { 'J', 1, 846, 0 },
+    { 'T', 1, 847, 2 },
+    { 'a', 5, 848, 0 },
+    { 'c', 3, 853, 0 },
+    { 'e', 2, 856, 0 },
+    { 'f', 1, 858, 0 },
+    { 'l', 2, 859, 0 },
+    { 'm', 1, 861, 0 },
+    { 'o', 3, 862, 0 },
+    { 's', 3, 865, 0 },
+    { 't', 1, 868, 0 },
+    { 'a', 1, 869, 0 },
+    { 'c', 1, 870, 0 },
+    { 'e', 2, 871, 0 },
+    { 'f', 1, 873, 0 },
+    { 'i', 1, 874, 0 },
+    { 'o', 1, 875, 0 },
+    { 's', 1, 876, 0 },
+    { 'u', 1, 877, 0 },
+    { 'J', 1, 878, 0 },
+    { 'a', 1, 879, 0 },
+    { 'c', 3, 880, 0 },
+    { 'e', 3, 883, 0 },
+    { 'f', 1, 886, 0 },
+    { 'o', 4, 887, 0 },
+    { 's', 1, 891, 0 },
+    { 't', 1, 892, 0 },
+    { 'u', 1, 893, 0 },
+    { 'E', 1, 894, 0 },
+    { 'a', 1, 895, 0 },
+    { 'c', 2, 896, 0 },
+    { 'd', 1, 898, 0 },
+    { 'f', 1, 899, 0 },
+    { 'g', 1, 900, 0 },
+    { 'm', 3, 901, 0 },
+    { 'o', 1, 904, 0 },
+    { 'p', 1, 905, 0 },
+    { 'r', 1, 906, 0 },
+    { 's', 2, 907, 0 },
+    { 't', 1, 909, 0 },
+    { 'u', 1, 910, 0 },
+    { 'v', 1, 911, 0 },
+    { 'a', 1, 912, 0 },
+    { 'c', 1, 913, 0 },
+    { 'f', 1, 914, 0 },
+    { 'h', 1, 915, 0 },
+    { 'i', 1, 916, 0 },
+    { 'l', 1, 917, 0 },
+    { 'o', 2, 918, 0 },
+    { 'r', 4, 920, 0 },
+    { 's', 2, 924, 0 },
+    { 'U', 1, 926, 0 },
+    { 'f', 1, 927, 0 },
+    { 'o', 1, 928, 0 },
+    { 's', 1, 929, 0 },
+    { 'B', 1, 930, 0 },
+    { 'E', 1, 931, 0 },
+    { 'a', 3, 932, 0 },
+    { 'c', 3, 935, 0 },
+    { 'e', 2, 938, 0 },
+    { 'f', 1, 940, 0 },
+    { 'h', 1, 941, 0 },
+    { 'i', 1, 942, 0 },
+    { 'o', 2, 943, 0 },
+    { 'r', 1, 945, 0 },
+    { 's', 2, 946, 0 },
+    { 'u', 1, 948, 0 },
+    { 'H', 2, 949, 0 },
+    { 'O', 1, 951, 0 },
+    { 'a', 1, 952, 0 },
+    { 'c', 5, 953, 0 },
+    { 'f', 1, 958, 0 },
+    { 'h', 1, 959, 0 },
+    { 'i', 1, 960, 0 },
+    { 'm', 1, 961, 0 },
+    { 'o', 1, 962, 0 },
+    { 'q', 2, 963, 0 },
+    { 's', 1, 965, 0 },
+    { 't', 1, 966, 0 },
+    { 'u', 4, 967, 0 },
+    { 'H', 1, 971, 0 },
+    { 'R', 1, 972, 0 },
+    { 'S', 2, 973, 0 },
+    { 'a', 2, 975, 0 },
+    { 'c', 3, 977, 0 },
+    { 'f', 1, 980, 0 },
+    { 'h', 2, 981, 0 },
+    { 'i', 1, 983, 0 },
+    { 'o', 1, 984, 0 },
+    { 'r', 1, 985, 0 },
+    { 's', 2, 986, 0 },
+    { 'a', 2, 988, 0 },
+    { 'b', 1, 990, 0 },
+    { 'c', 2, 991, 0 },
+    { 'd', 1, 993, 0 },
+    { 'f', 1, 994, 0 },
+    { 'g', 1, 995, 0 },
+    { 'm', 1, 996, 0 },
+    { 'n', 2, 997, 0 },
+    { 'o', 2, 999, 0 },
+    { 'p', 8, 1001, 0 },
+    { 'r', 1, 1009, 0 },
+    { 's', 1, 1010, 0 },
+    { 't', 1, 1011, 0 },
+    { 'u', 1, 1012, 0 },
+    { 'D', 1, 1013, 0 },
+    { 'b', 1, 1014, 0 },
+    { 'c', 1, 1015, 0 },
+    { 'd', 1, 1016, 0 },
+    { 'e', 2, 1017, 0 },
+    { 'f', 1, 1019, 0 },
+    { 'o', 1, 1020, 0 },
+    { 's', 1, 1021, 0 },
+    { 'v', 1, 1022, 0 },
+    { 'c', 1, 1023, 0 },
+    { 'e', 1, 1024, 0 },
+    { 'f', 1, 1025, 0 },
+    { 'o', 1, 1026, 0 },
+    { 's', 1, 1027, 0 },
+    { 'f', 1, 1028, 0 },
+    { 'i', 1, 1029, 0 },
+    { 'o', 1, 1030, 0 },
+    { 's', 1, 1031, 0 },
+    { 'A', 1, 1032, 0 },
+    { 'I', 1, 1033, 0 },
+    { 'U', 1, 1034, 0 },
+    { 'a', 1, 1035, 0 },
+    { 'c', 2, 1036, 0 },
+    { 'f', 1, 1038, 0 },
+    { 'o', 1, 1039, 0 },
+    { 's', 1, 1040, 0 },
+    { 'u', 1, 1041, 0 },
+    { 'H', 1, 1042, 0 },
+    { 'a', 1, 1043, 0 },
+    { 'c', 2, 1044, 0 },
+    { 'd', 1, 1046, 0 },
+    { 'e', 2, 1047, 0 },
+    { 'f', 1, 1049, 0 },
+    { 'o', 1, 1050, 0 },
+    { 's', 1, 1051, 0 },
+    { 'a', 1, 1052, 0 },
+    { 'b', 1, 1053, 0 },
+    { 'c', 6, 1054, 0 },
+    { 'e', 1, 1060, 0 },
+    { 'f', 2, 1061, 0 },
+    { 'g', 1, 1063, 0 },
+    { 'l', 2, 1064, 0 },
+    { 'm', 2, 1066, 0 },
+    { 'n', 2, 1068, 0 },
+    { 'o', 2, 1070, 0 },
+    { 'p', 7, 1072, 0 },
+    { 'r', 1, 1079, 0 },
+    { 's', 3, 1080, 0 },
+    { 't', 1, 1083, 0 },
+    { 'u', 1, 1084, 0 },
+    { 'w', 2, 1085, 0 },
+    { 'N', 1, 1087, 0 },
+    { 'a', 2, 1088, 0 },
+    { 'b', 1, 1090, 0 },
+    { 'c', 2, 1091, 0 },
+    { 'd', 1, 1093, 0 },
+    { 'e', 5, 1094, 0 },
+    { 'f', 1, 1099, 0 },
+    { 'i', 1, 1100, 0 },
+    { 'k', 1, 1101, 0 },
+    { 'l', 3, 1102, 0 },
+    { 'n', 2, 1105, 0 },
+    { 'o', 4, 1107, 0 },
+    { 'p', 1, 1111, 0 },
+    { 'r', 2, 1112, 0 },
+    { 's', 4, 1114, 0 },
+    { 'u', 2, 1118, 0 },
+    { 'a', 3, 1120, 0 },
+    { 'c', 4, 1123, 0 },
+    { 'd', 1, 1127, 0 },
+    { 'e', 3, 1128, 0 },
+    { 'f', 1, 1131, 0 },
+    { 'h', 3, 1132, 0 },
+    { 'i', 1, 1135, 0 },
+    { 'l', 1, 1136, 0 },
+    { 'o', 4, 1137, 0 },
+    { 'r', 2, 1141, 0 },
+    { 's', 2, 1143, 0 },
+    { 't', 1, 1145, 0 },
+    { 'u', 7, 1146, 0 },
+    { 'w', 2, 1153, 0 },
+    { 'y', 1, 1155, 0 },
+    { 'A', 1, 1156, 0 },
+    { 'H', 1, 1157, 0 },
+    { 'a', 4, 1158, 0 },
+    { 'b', 2, 1162, 0 },
+    { 'c', 2, 1164, 0 },
+    { 'd', 3, 1166, 0 },
+    { 'e', 3, 1169, 0 },
+    { 'f', 2, 1172, 0 },
+    { 'h', 1, 1174, 0 },
+    { 'i', 5, 1175, 0 },
+    { 'j', 1, 1180, 0 },
+    { 'l', 1, 1181, 0 },
+    { 'o', 5, 1182, 0 },
+    { 'r', 2, 1187, 0 },
+    { 's', 3, 1189, 0 },
+    { 't', 2, 1192, 0 },
+    { 'u', 2, 1194, 0 },
+    { 'w', 1, 1196, 0 },
+    { 'z', 2, 1197, 0 },
+    { 'D', 2, 1199, 0 },
+    { 'a', 2, 1201, 0 },
+    { 'c', 4, 1203, 0 },
+    { 'd', 1, 1207, 0 },
+    { 'e', 1, 1208, 0 },
+    { 'f', 2, 1209, 0 },
+    { 'g', 3, 1211, 0 },
+    { 'l', 4, 1214, 0 },
+    { 'm', 3, 1218, 0 },
+    { 'n', 2, 1221, 0 },
+    { 'o', 2, 1223, 0 },
+    { 'p', 3, 1225, 0 },
+    { 'q', 4, 1228, 0 },
+    { 'r', 2, 1232, 0 },
+    { 's', 3, 1234, 0 },
+    { 't', 2, 1237, 0 },
+    { 'u', 2, 1239, 0 },
+    { 'x', 3, 1241, 0 },
+    { 'a', 1, 1244, 0 },
+    { 'c', 1, 1245, 0 },
+    { 'e', 1, 1246, 0 },
+    { 'f', 3, 1247, 0 },
+    { 'i', 1, 1250, 0 },
+    { 'j', 1, 1251, 0 },
+    { 'l', 3, 1252, 0 },
+    { 'n', 1, 1255, 0 },
+    { 'o', 2, 1256, 0 },
+    { 'p', 1, 1258, 0 },
+    { 'r', 2, 1259, 0 },
+    { 's', 1, 1261, 0 },
+    { 'E', 2, 1262, 0 },
+    { 'a', 3, 1264, 0 },
+    { 'b', 1, 1267, 0 },
+    { 'c', 2, 1268, 0 },
+    { 'd', 1, 1270, 0 },
+    { 'e', 4, 1271, 0 },
+    { 'f', 1, 1275, 0 },
+    { 'g', 2, 1276, 0 },
+    { 'i', 1, 1278, 0 },
+    { 'j', 1, 1279, 0 },
+    { 'l', 4, 1280, 0 },
+    { 'n', 4, 1284, 0 },
+    { 'o', 1, 1288, 0 },
+    { 'r', 1, 1289, 0 },
+    { 's', 2, 1290, 0 },
+    { 't', 6, 1292, 1 },
+    { 'v', 2, 1298, 0 },
+    { 'A', 1, 1300, 0 },
+    { 'a', 4, 1301, 0 },
+    { 'b', 1, 1305, 0 },
+    { 'c', 1, 1306, 0 },
+    { 'e', 3, 1307, 0 },
+    { 'f', 1, 1310, 0 },
+    { 'k', 1, 1311, 0 },
+    { 'o', 5, 1312, 0 },
+    { 's', 3, 1317, 0 },
+    { 'y', 2, 1320, 0 },
+    { 'a', 1, 1322, 0 },
+    { 'c', 3, 1323, 0 },
+    { 'e', 2, 1326, 0 },
+    { 'f', 2, 1328, 0 },
+    { 'g', 1, 1330, 0 },
+    { 'i', 4, 1331, 0 },
+    { 'j', 1, 1335, 0 },
+    { 'm', 3, 1336, 0 },
+    { 'n', 5, 1339, 0 },
+    { 'o', 4, 1344, 0 },
+    { 'p', 1, 1348, 0 },
+    { 'q', 1, 1349, 0 },
+    { 's', 2, 1350, 0 },
+    { 't', 2, 1352, 0 },
+    { 'u', 2, 1354, 0 },
+    { 'c', 2, 1356, 0 },
+    { 'f', 1, 1358, 0 },
+    { 'm', 1, 1359, 0 },
+    { 'o', 1, 1360, 0 },
+    { 's', 2, 1361, 0 },
+    { 'u', 1, 1363, 0 },
+    { 'a', 1, 1364, 0 },
+    { 'c', 2, 1365, 0 },
+    { 'f', 1, 1367, 0 },
+    { 'g', 1, 1368, 0 },
+    { 'h', 1, 1369, 0 },
+    { 'j', 1, 1370, 0 },
+    { 'o', 1, 1371, 0 },
+    { 's', 1, 1372, 0 },
+    { 'A', 3, 1373, 0 },
+    { 'B', 1, 1376, 0 },
+    { 'E', 2, 1377, 0 },
+    { 'H', 1, 1379, 0 },
+    { 'a', 9, 1380, 0 },
+    { 'b', 3, 1389, 0 },
+    { 'c', 4, 1392, 0 },
+    { 'd', 4, 1396, 0 },
+    { 'e', 5, 1400, 0 },
+    { 'f', 3, 1405, 0 },
+    { 'g', 2, 1408, 0 },
+    { 'h', 2, 1410, 0 },
+    { 'j', 1, 1412, 0 },
+    { 'l', 5, 1413, 0 },
+    { 'm', 2, 1418, 0 },
+    { 'n', 4, 1420, 0 },
+    { 'o', 8, 1424, 0 },
+    { 'p', 1, 1432, 0 },
+    { 'r', 5, 1433, 0 },
+    { 's', 6, 1438, 0 },
+    { 't', 8, 1444, 2 },
+    { 'u', 1, 1452, 0 },
+    { 'v', 2, 1453, 0 },
+    { 'D', 1, 1455, 0 },
+    { 'a', 4, 1456, 0 },
+    { 'c', 2, 1460, 0 },
+    { 'd', 1, 1462, 0 },
+    { 'e', 1, 1463, 0 },
+    { 'f', 1, 1464, 0 },
+    { 'h', 1, 1465, 0 },
+    { 'i', 3, 1466, 0 },
+    { 'l', 2, 1469, 0 },
+    { 'n', 1, 1471, 0 },
+    { 'o', 2, 1472, 0 },
+    { 'p', 1, 1474, 0 },
+    { 's', 2, 1475, 0 },
+    { 'u', 3, 1477, 0 },
+    { 'G', 2, 1480, 0 },
+    { 'L', 3, 1482, 0 },
+    { 'R', 1, 1485, 0 },
+    { 'V', 2, 1486, 0 },
+    { 'a', 5, 1488, 0 },
+    { 'b', 2, 1493, 0 },
+    { 'c', 5, 1495, 0 },
+    { 'd', 1, 1500, 0 },
+    { 'e', 7, 1501, 0 },
+    { 'f', 1, 1508, 0 },
+    { 'g', 4, 1509, 0 },
+    { 'h', 3, 1513, 0 },
+    { 'i', 3, 1516, 0 },
+    { 'j', 1, 1519, 0 },
+    { 'l', 7, 1520, 0 },
+    { 'm', 1, 1527, 0 },
+    { 'o', 2, 1528, 0 },
+    { 'p', 3, 1530, 0 },
+    { 'r', 4, 1533, 0 },
+    { 's', 7, 1537, 0 },
+    { 't', 4, 1544, 0 },
+    { 'u', 2, 1548, 0 },
+    { 'v', 9, 1550, 0 },
+    { 'w', 3, 1559, 0 },
+    { 'S', 1, 1562, 0 },
+    { 'a', 2, 1563, 0 },
+    { 'c', 2, 1565, 0 },
+    { 'd', 5, 1567, 0 },
+    { 'e', 1, 1572, 0 },
+    { 'f', 2, 1573, 0 },
+    { 'g', 3, 1575, 0 },
+    { 'h', 2, 1578, 0 },
+    { 'i', 1, 1580, 0 },
+    { 'l', 4, 1581, 0 },
+    { 'm', 3, 1585, 0 },
+    { 'o', 1, 1588, 0 },
+    { 'p', 3, 1589, 0 },
+    { 'r', 7, 1592, 0 },
+    { 's', 3, 1599, 0 },
+    { 't', 1, 1602, 0 },
+    { 'u', 1, 1603, 0 },
+    { 'v', 1, 1604, 0 },
+    { 'a', 1, 1605, 0 },
+    { 'c', 1, 1606, 0 },
+    { 'e', 1, 1607, 0 },
+    { 'f', 1, 1608, 0 },
+    { 'h', 3, 1609, 0 },
+    { 'i', 3, 1612, 0 },
+    { 'l', 2, 1615, 0 },
+    { 'm', 1, 1617, 0 },
+    { 'o', 3, 1618, 0 },
+    { 'r', 10, 1621, 0 },
+    { 's', 2, 1631, 0 },
+    { 'u', 1, 1633, 0 },
+    { 'f', 1, 1634, 0 },
+    { 'i', 1, 1635, 0 },
+    { 'o', 1, 1636, 0 },
+    { 'p', 1, 1637, 0 },
+    { 's', 1, 1638, 0 },
+    { 'u', 3, 1639, 0 },
+    { 'A', 3, 1642, 0 },
+    { 'B', 1, 1645, 0 },
+    { 'H', 1, 1646, 0 },
+    { 'a', 7, 1647, 0 },
+    { 'b', 3, 1654, 0 },
+    { 'c', 4, 1657, 0 },
+    { 'd', 4, 1661, 0 },
+    { 'e', 3, 1665, 0 },
+    { 'f', 3, 1668, 0 },
+    { 'h', 2, 1671, 0 },
+    { 'i', 3, 1673, 0 },
+    { 'l', 3, 1676, 0 },
+    { 'm', 1, 1679, 0 },
+    { 'n', 1, 1680, 0 },
+    { 'o', 4, 1681, 0 },
+    { 'p', 2, 1685, 0 },
+    { 'r', 1, 1687, 0 },
+    { 's', 4, 1688, 0 },
+    { 't', 3, 1692, 0 },
+    { 'u', 1, 1695, 0 },
+    { 'x', 1, 1696, 0 },
+    { 'a', 1, 1697, 0 },
+    { 'b', 1, 1698, 0 },
+    { 'c', 10, 1699, 0 },
+    { 'd', 1, 1709, 0 },
+    { 'e', 7, 1710, 0 },
+    { 'f', 1, 1717, 0 },
+    { 'h', 4, 1718, 0 },
+    { 'i', 2, 1722, 0 },
+    { 'l', 1, 1724, 0 },
+    { 'm', 4, 1725, 0 },
+    { 'o', 3, 1729, 0 },
+    { 'p', 1, 1732, 0 },
+    { 'q', 3, 1733, 0 },
+    { 'r', 1, 1736, 0 },
+    { 's', 4, 1737, 0 },
+    { 't', 2, 1741, 0 },
+    { 'u', 5, 1743, 0 },
+    { 'w', 3, 1748, 0 },
+    { 'z', 1, 1751, 0 },
+    { 'a', 2, 1752, 0 },
+    { 'b', 1, 1754, 0 },
+    { 'c', 3, 1755, 0 },
+    { 'd', 1, 1758, 0 },
+    { 'e', 1, 1759, 0 },
+    { 'f', 1, 1760, 0 },
+    { 'h', 4, 1761, 0 },
+    { 'i', 3, 1765, 0 },
+    { 'o', 3, 1768, 0 },
+    { 'p', 1, 1771, 0 },
+    { 'r', 3, 1772, 0 },
+    { 's', 3, 1775, 0 },
+    { 'w', 2, 1778, 0 },
+    { 'A', 1, 1780, 0 },
+    { 'H', 1, 1781, 0 },
+    { 'a', 2, 1782, 0 },
+    { 'b', 1, 1784, 0 },
+    { 'c', 2, 1785, 0 },
+    { 'd', 3, 1787, 0 },
+    { 'f', 2, 1790, 0 },
+    { 'g', 1, 1792, 0 },
+    { 'h', 2, 1793, 0 },
+    { 'l', 2, 1795, 0 },
+    { 'm', 2, 1797, 0 },
+    { 'o', 2, 1799, 0 },
+    { 'p', 6, 1801, 0 },
+    { 'r', 3, 1807, 0 },
+    { 's', 1, 1810, 0 },
+    { 't', 3, 1811, 0 },
+    { 'u', 2, 1814, 0 },
+    { 'w', 1, 1816, 0 },
+    { 'A', 1, 1817, 0 },
+    { 'B', 1, 1818, 0 },
+    { 'D', 1, 1819, 0 },
+    { 'a', 2, 1820, 0 },
+    { 'c', 1, 1822, 0 },
+    { 'd', 1, 1823, 0 },
+    { 'e', 3, 1824, 0 },
+    { 'f', 1, 1827, 0 },
+    { 'l', 1, 1828, 0 },
+    { 'n', 1, 1829, 0 },
+    { 'o', 1, 1830, 0 },
+    { 'p', 1, 1831, 0 },
+    { 'r', 1, 1832, 0 },
+    { 's', 2, 1833, 0 },
+    { 'z', 1, 1835, 0 },
+    { 'c', 1, 1836, 0 },
+    { 'e', 2, 1837, 0 },
+    { 'f', 1, 1839, 0 },
+    { 'o', 1, 1840, 0 },
+    { 'p', 1, 1841, 0 },
+    { 'r', 2, 1842, 0 },
+    { 's', 1, 1844, 0 },
+    { 'c', 3, 1845, 0 },
+    { 'd', 1, 1848, 0 },
+    { 'f', 1, 1849, 0 },
+    { 'h', 2, 1850, 0 },
+    { 'i', 1, 1852, 0 },
+    { 'l', 2, 1853, 0 },
+    { 'm', 1, 1855, 0 },
+    { 'n', 1, 1856, 0 },
+    { 'o', 3, 1857, 0 },
+    { 'r', 2, 1860, 0 },
+    { 's', 2, 1862, 0 },
+    { 'u', 2, 1864, 0 },
+    { 'v', 1, 1866, 0 },
+    { 'w', 1, 1867, 0 },
+    { 'a', 1, 1868, 0 },
+    { 'c', 2, 1869, 0 },
+    { 'e', 1, 1871, 0 },
+    { 'f', 1, 1872, 0 },
+    { 'i', 1, 1873, 0 },
+    { 'o', 1, 1874, 0 },
+    { 's', 1, 1875, 0 },
+    { 'u', 2, 1876, 0 },
+    { 'a', 1, 1878, 0 },
+    { 'c', 2, 1879, 0 },
+    { 'd', 1, 1881, 0 },
+    { 'e', 2, 1882, 0 },
+    { 'f', 1, 1884, 0 },
+    { 'h', 1, 1885, 0 },
+    { 'i', 1, 1886, 0 },
+    { 'o', 1, 1887, 0 },
+    { 's', 1, 1888, 0 },
+    { 'w', 2, 1889, 0 },
+    { 'l', 1, 1891, 0 },
+    { 'P', 1, 1892, 3 },
+    { 'c', 1, 1893, 0 },
+    { 'r', 1, 1894, 0 },
+    { 'i', 1, 1895, 0 },
+    { 'y', 1, 1896, 0 },
+    { 'r', 1, 1897, 0 },
+    { 'r', 1, 1898, 0 },
+    { 'p', 1, 1899, 0 },
+    { 'a', 1, 1900, 0 },
+    { 'd', 1, 1901, 0 },
+    { 'g', 1, 1902, 0 },
+    { 'p', 1, 1903, 0 },
+    { 'p', 1, 1904, 0 },
+    { 'i', 1, 1905, 0 },
+    { 'c', 1, 1906, 0 },
+    { 's', 1, 1907, 0 },
+    { 'i', 1, 1908, 0 },
+    { 'm', 1, 1909, 0 },
+    { 'c', 1, 1910, 0 },
+    { 'r', 2, 1911, 0 },
+    { 'y', 1, 1913, 0 },
+    { 'c', 1, 1914, 0 },
+    { 'r', 1, 1915, 0 },
+    { 't', 1, 1916, 0 },
+    { 'r', 1, 1917, 0 },
+    { 'p', 1, 1918, 0 },
+    { 'e', 1, 1919, 0 },
+    { 'c', 1, 1920, 0 },
+    { 'm', 1, 1921, 0 },
+    { 'c', 1, 1922, 0 },
+    { 'P', 1, 1923, 0 },
+    { 'c', 1, 1924, 0 },
+    { 'p', 2, 1925, 0 },
+    { 'y', 1, 1927, 0 },
+    { 'a', 1, 1928, 0 },
+    { 'e', 1, 1929, 0 },
+    { 'i', 1, 1930, 0 },
+    { 'o', 1, 1931, 0 },
+    { 'o', 1, 1932, 0 },
+    { 'd', 1, 1933, 0 },
+    { 'n', 1, 1934, 0 },
+    { 'r', 1, 1935, 0 },
+    { 'i', 1, 1936, 0 },
+    { 'r', 1, 1937, 0 },
+    { 'o', 2, 1938, 0 },
+    { 'l', 1, 1940, 0 },
+    { 'n', 3, 1941, 0 },
+    { 'p', 2, 1944, 0 },
+    { 'u', 1, 1946, 0 },
+    { 'o', 1, 1947, 0 },
+    { 'c', 1, 1948, 0 },
+    { 'p', 2, 1949, 0 },
+    { ';', 0, 0, 4 },
+    { 'o', 1, 1951, 0 },
+    { 'c', 1, 1952, 0 },
+    { 'c', 1, 1953, 0 },
+    { 'c', 1, 1954, 0 },
+    { 'g', 1, 1955, 0 },
+    { 'r', 1, 1956, 0 },
+    { 's', 1, 1957, 0 },
+    { 'a', 1, 1958, 0 },
+    { 'y', 1, 1959, 0 },
+    { 'l', 2, 1960, 0 },
+    { 'r', 1, 1962, 0 },
+    { 'a', 2, 1963, 0 },
+    { 'f', 1, 1965, 0 },
+    { 'p', 1, 1966, 0 },
+    { 't', 3, 1967, 0 },
+    { 'u', 1, 1970, 0 },
+    { 'w', 1, 1971, 0 },
+    { 'c', 1, 1972, 0 },
+    { 't', 1, 1973, 0 },
+    { 'G', 1, 1974, 0 },
+    { 'H', 1, 1975, 5 },
+    { 'c', 1, 1976, 0 },
+    { 'a', 1, 1977, 0 },
+    { 'i', 1, 1978, 0 },
+    { 'y', 1, 1979, 0 },
+    { 'o', 1, 1980, 0 },
+    { 'r', 1, 1981, 0 },
+    { 'r', 1, 1982, 0 },
+    { 'e', 1, 1983, 0 },
+    { 'a', 1, 1984, 0 },
+    { 'p', 1, 1985, 0 },
+    { 'g', 1, 1986, 0 },
+    { 'p', 1, 1987, 0 },
+    { 's', 1, 1988, 0 },
+    { 'u', 2, 1989, 0 },
+    { 'c', 1, 1991, 0 },
+    { 'i', 1, 1992, 0 },
+    { 'a', 1, 1993, 0 },
+    { 'm', 1, 1994, 0 },
+    { 'i', 1, 1995, 0 },
+    { 'p', 1, 1996, 0 },
+    { 'y', 1, 1997, 0 },
+    { 'r', 1, 1998, 0 },
+    { 'l', 1, 1999, 0 },
+    { 'p', 1, 2000, 0 },
+    { 'r', 1, 2001, 0 },
+    { 'u', 1, 2002, 0 },
+    { 'c', 1, 2003, 0 },
+    { 'c', 1, 2004, 0 },
+    { ';', 0, 0, 1 },
+    { 'm', 1, 2005, 0 },
+    { 'r', 1, 2006, 0 },
+    { 'e', 1, 2007, 0 },
+    { 'i', 1, 2008, 0 },
+    { 'y', 1, 2009, 0 },
+    { 'o', 1, 2010, 0 },
+    { 'r', 1, 2011, 0 },
+    { ';', 0, 0, 6 },
+    { 'p', 1, 2012, 0 },
+    { 'e', 1, 2013, 0 },
+    { 'c', 1, 2014, 0 },
+    { ';', 0, 0, 7 },
+    { 'R', 1, 2015, 0 },
+    { 'c', 1, 2016, 0 },
+    { 't', 1, 2017, 0 },
+    { 'i', 1, 2018, 0 },
+    { 'r', 1, 2019, 0 },
+    { 'l', 1, 2020, 0 },
+    { 'p', 1, 2021, 0 },
+    { 'r', 1, 2022, 0 },
+    { 'c', 1, 2023, 0 },
+    { 't', 1, 2024, 0 },
+    { 'm', 1, 2025, 0 },
+    { 'c', 1, 2026, 0 },
+    { 'l', 1, 2027, 0 },
+    { 'c', 1, 2028, 0 },
+    { 'c', 1, 2029, 0 },
+    { 'i', 1, 2030, 0 },
+    { 'y', 1, 2031, 0 },
+    { 'o', 1, 2032, 0 },
+    { 'r', 1, 2033, 0 },
+    { 'r', 1, 2034, 0 },
+    { ';', 0, 0, 8 },
+    { 'a', 2, 2035, 0 },
+    { 'p', 1, 2037, 0 },
+    { 't', 2, 2038, 0 },
+    { 'v', 1, 2040, 0 },
+    { 'g', 1, 2041, 0 },
+    { 'p', 1, 2042, 0 },
+    { 't', 1, 2043, 0 },
+    { 'c', 1, 2044, 0 },
+    { 'i', 1, 2045, 0 },
+    { 'k', 1, 2046, 0 },
+    { 'm', 1, 2047, 0 },
+    { 'i', 1, 2048, 0 },
+    { 'y', 1, 2049, 0 },
+    { 'r', 1, 2050, 0 },
+    { 'p', 1, 2051, 0 },
+    { 'c', 1, 2052, 0 },
+    { 'e', 1, 2053, 0 },
+    { 'k', 1, 2054, 0 },
+    { 'c', 1, 2055, 0 },
+    { 'c', 1, 2056, 0 },
+    { 'p', 1, 2057, 0 },
+    { 'e', 1, 2058, 0 },
+    { 'y', 1, 2059, 0 },
+    { 'r', 1, 2060, 0 },
+    { 'p', 1, 2061, 0 },
+    { 'c', 1, 2062, 0 },
+    { 'c', 1, 2063, 0 },
+    { ';', 0, 0, 2 },
+    { 'c', 1, 2064, 0 },
+    { 'm', 1, 2065, 0 },
+    { 'n', 1, 2066, 0 },
+    { 'p', 1, 2067, 0 },
+    { 'r', 1, 2068, 0 },
+    { 'a', 1, 2069, 0 },
+    { 'e', 1, 2070, 0 },
+    { 'y', 1, 2071, 0 },
+    { 'f', 1, 2072, 0 },
+    { 's', 1, 2073, 0 },
+    { 'r', 1, 2074, 0 },
+    { ';', 0, 0, 9 },
+    { 'e', 1, 2075, 0 },
+    { 'i', 1, 2076, 0 },
+    { 'n', 1, 2077, 0 },
+    { 'p', 1, 2078, 0 },
+    { 'w', 1, 2079, 0 },
+    { 'c', 1, 2080, 0 },
+    { 'h', 1, 2081, 0 },
+    { 't', 1, 2082, 0 },
+    { ';', 0, 0, 10 },
+    { 'p', 1, 2083, 0 },
+    { 'y', 1, 2084, 0 },
+    { 'd', 1, 2085, 0 },
+    { 'l', 1, 2086, 0 },
+    { 'r', 1, 2087, 0 },
+    { 'n', 1, 2088, 0 },
+    { 'p', 1, 2089, 0 },
+    { 'c', 1, 2090, 0 },
+    { ';', 0, 0, 11 },
+    { 'c', 1, 2091, 0 },
+    { 'c', 1, 2092, 0 },
+    { 'a', 1, 2093, 0 },
+    { 'e', 1, 2094, 0 },
+    { 'y', 1, 2095, 0 },
+    { 'g', 1, 2096, 0 },
+    { 's', 1, 2097, 0 },
+    { 'w', 1, 2098, 0 },
+    { 'r', 1, 2099, 0 },
+    { 'B', 1, 2100, 0 },
+    { 'n', 1, 2101, 0 },
+    { 'p', 1, 2102, 0 },
+    { 't', 13, 2103, 0 },
+    { 'c', 1, 2116, 0 },
+    { 'i', 1, 2117, 0 },
+    { ';', 0, 0, 12 },
+    { 'l', 1, 2118, 0 },
+    { 'c', 1, 2119, 0 },
+    { 'i', 1, 2120, 0 },
+    { 'y', 1, 2121, 0 },
+    { 'b', 1, 2122, 0 },
+    { 'r', 1, 2123, 0 },
+    { 'r', 1, 2124, 0 },
+    { 'a', 1, 2125, 0 },
+    { 'e', 1, 2126, 0 },
+    { 'i', 1, 2127, 0 },
+    { 'p', 1, 2128, 0 },
+    { 'e', 1, 2129, 0 },
+    { ';', 0, 0, 13 },
+    { 'c', 1, 2130, 0 },
+    { 'l', 1, 2131, 0 },
+    { 'i', 2, 2132, 0 },
+    { 'm', 1, 2134, 0 },
+    { 'e', 1, 2135, 0 },
+    { 'r', 1, 2136, 0 },
+    { 'y', 1, 2137, 0 },
+    { 'r', 1, 2138, 0 },
+    { 'i', 1, 2139, 0 },
+    { ';', 0, 0, 14 },
+    { 'u', 1, 2140, 0 },
+    { 'i', 1, 2141, 0 },
+    { 'p', 1, 2142, 0 },
+    { ';', 0, 0, 15 },
+    { 'e', 1, 2143, 0 },
+    { 'i', 1, 2144, 0 },
+    { 'o', 2, 2145, 0 },
+    { 'c', 1, 2147, 0 },
+    { 'i', 1, 2148, 0 },
+    { 'O', 1, 2149, 0 },
+    { 'r', 1, 2150, 0 },
+    { 'p', 1, 2151, 0 },
+    { 'c', 1, 2152, 0 },
+    { 'a', 1, 2153, 0 },
+    { 'G', 1, 2154, 16 },
+    { 'c', 1, 2155, 0 },
+    { 'n', 1, 2156, 0 },
+    { 'r', 1, 2157, 0 },
+    { 'a', 1, 2158, 0 },
+    { 'e', 1, 2159, 0 },
+    { 'y', 1, 2160, 0 },
+    { ';', 0, 0, 17 },
+    { 'v', 1, 2161, 0 },
+    { 'r', 1, 2162, 0 },
+    { 'o', 1, 2163, 0 },
+    { 'g', 1, 2164, 0 },
+    { 'p', 1, 2165, 0 },
+    { 'u', 1, 2166, 0 },
+    { 'i', 1, 2167, 0 },
+    { 'c', 1, 2168, 0 },
+    { 'h', 1, 2169, 0 },
+    { 'l', 1, 2170, 0 },
+    { 'C', 1, 2171, 0 },
+    { 'c', 1, 2172, 0 },
+    { 'F', 1, 2173, 0 },
+    { 'c', 1, 2174, 0 },
+    { ';', 0, 0, 18 },
+    { 'a', 1, 2175, 0 },
+    { 'e', 1, 2176, 0 },
+    { 'i', 1, 2177, 0 },
+    { 'y', 1, 2178, 0 },
+    { 'r', 1, 2179, 0 },
+    { 'o', 1, 2180, 0 },
+    { 'g', 1, 2181, 0 },
+    { 'a', 1, 2182, 0 },
+    { 'p', 1, 2183, 0 },
+    { 'r', 1, 2184, 0 },
+    { 'u', 1, 2185, 0 },
+    { 'c', 1, 2186, 0 },
+    { 'a', 1, 2187, 0 },
+    { 'b', 2, 2188, 0 },
+    { 'c', 2, 2190, 0 },
+    { 'm', 1, 2192, 0 },
+    { 'p', 3, 2193, 0 },
+    { 'O', 1, 2196, 0 },
+    { 'A', 1, 2197, 0 },
+    { 'H', 1, 2198, 0 },
+    { 'c', 1, 2199, 0 },
+    { 'b', 1, 2200, 0 },
+    { 'u', 1, 2201, 0 },
+    { 'a', 1, 2202, 0 },
+    { 'e', 1, 2203, 0 },
+    { 'y', 1, 2204, 0 },
+    { 'r', 1, 2205, 0 },
+    { 'e', 2, 2206, 0 },
+    { 'i', 2, 2208, 0 },
+    { 'l', 1, 2210, 0 },
+    { 'p', 1, 2211, 0 },
+    { 'i', 1, 2212, 0 },
+    { 'c', 1, 2213, 0 },
+    { 't', 1, 2214, 0 },
+    { 'c', 1, 2215, 0 },
+    { 'r', 1, 2216, 0 },
+    { 'r', 2, 2217, 0 },
+    { 'i', 1, 2219, 0 },
+    { 'y', 1, 2220, 0 },
+    { 'b', 1, 2221, 0 },
+    { 'r', 1, 2222, 0 },
+    { 'r', 1, 2223, 0 },
+    { 'a', 1, 2224, 0 },
+    { 'd', 1, 2225, 0 },
+    { 'i', 1, 2226, 0 },
+    { 'g', 1, 2227, 0 },
+    { 'p', 1, 2228, 0 },
+    { 'A', 1, 2229, 0 },
+    { 'D', 1, 2230, 0 },
+    { 'E', 1, 2231, 0 },
+    { 'T', 1, 2232, 0 },
+    { 'a', 1, 2233, 0 },
+    { 'd', 1, 2234, 0 },
+    { 'p', 1, 2235, 0 },
+    { 's', 1, 2236, 0 },
+    { 'i', 1, 2237, 0 },
+    { 'c', 1, 2238, 0 },
+    { 'i', 1, 2239, 0 },
+    { 'm', 1, 2240, 0 },
+    { 'a', 1, 2241, 0 },
+    { 'a', 1, 2242, 0 },
+    { 'y', 1, 2243, 0 },
+    { 'a', 1, 2244, 0 },
+    { 'e', 1, 2245, 0 },
+    { 'r', 3, 2246, 0 },
+    { 'r', 1, 2249, 0 },
+    { 'p', 1, 2250, 0 },
+    { 'c', 1, 2251, 0 },
+    { 'd', 1, 2252, 0 },
+    { 'i', 1, 2253, 0 },
+    { 'd', 1, 2254, 0 },
+    { 'r', 1, 2255, 0 },
+    { 'p', 1, 2256, 0 },
+    { 'c', 1, 2257, 0 },
+    { 'r', 1, 2258, 0 },
+    { ';', 0, 0, 19 },
+    { 'p', 1, 2259, 0 },
+    { 'c', 1, 2260, 0 },
+    { 'c', 1, 2261, 0 },
+    { 'c', 1, 2262, 0 },
+    { 'c', 1, 2263, 0 },
+    { 'c', 1, 2264, 0 },
+    { 'i', 1, 2265, 0 },
+    { 'y', 1, 2266, 0 },
+    { 'r', 1, 2267, 0 },
+    { 'p', 1, 2268, 0 },
+    { 'c', 1, 2269, 0 },
+    { 'm', 1, 2270, 0 },
+    { 'c', 1, 2271, 0 },
+    { 'c', 1, 2272, 0 },
+    { 'a', 1, 2273, 0 },
+    { 'y', 1, 2274, 0 },
+    { 'o', 1, 2275, 0 },
+    { 'r', 1, 2276, 0 },
+    { 't', 1, 2277, 0 },
+    { 'r', 1, 2278, 0 },
+    { 'p', 1, 2279, 0 },
+    { 'c', 1, 2280, 0 },
+    { 'c', 1, 2281, 0 },
+    { 'r', 1, 2282, 0 },
+    { ';', 0, 0, 20 },
+    { 'E', 1, 2283, 0 },
+    { 'd', 1, 2284, 0 },
+    { 'i', 1, 2285, 0 },
+    { 'u', 1, 2286, 0 },
+    { 'y', 1, 2287, 0 },
+    { 'l', 1, 2288, 0 },
+    { ';', 0, 0, 21 },
+    { 'r', 1, 2289, 0 },
+    { 'r', 1, 2290, 0 },
+    { 'e', 2, 2291, 0 },
+    { 'p', 1, 2293, 0 },
+    { 'a', 2, 2294, 0 },
+    { 'p', 1, 2296, 3 },
+    { 'd', 5, 2297, 0 },
+    { 'g', 7, 2302, 0 },
+    { 'g', 1, 2309, 0 },
+    { 'p', 1, 2310, 0 },
+    { ';', 0, 0, 22 },
+    { 'E', 1, 2311, 0 },
+    { 'a', 1, 2312, 0 },
+    { 'e', 1, 2313, 0 },
+    { 'i', 1, 2314, 0 },
+    { 'o', 1, 2315, 0 },
+    { 'p', 1, 2316, 0 },
+    { 'i', 1, 2317, 0 },
+    { 'c', 1, 2318, 0 },
+    { 't', 1, 2319, 0 },
+    { 'y', 1, 2320, 0 },
+    { 'i', 1, 2321, 0 },
+    { 'm', 1, 2322, 0 },
+    { 'c', 1, 2323, 0 },
+    { 'i', 1, 2324, 0 },
+    { 'o', 1, 2325, 0 },
+    { 'c', 1, 2326, 0 },
+    { 'r', 2, 2327, 0 },
+    { 'r', 1, 2329, 0 },
+    { 'o', 1, 2330, 0 },
+    { 'y', 1, 2331, 0 },
+    { 'q', 1, 2332, 0 },
+    { 'c', 1, 2333, 0 },
+    { 'm', 1, 2334, 0 },
+    { 'p', 1, 2335, 0 },
+    { 'r', 1, 2336, 0 },
+    { 't', 3, 2337, 0 },
+    { 'r', 1, 2340, 0 },
+    { 'g', 7, 2341, 0 },
+    { 'a', 1, 2348, 0 },
+    { 'a', 2, 2349, 0 },
+    { 'k', 2, 2351, 0 },
+    { 'o', 1, 2353, 0 },
+    { 'e', 2, 2354, 0 },
+    { 'o', 1, 2356, 0 },
+    { 'p', 1, 2357, 0 },
+    { 't', 2, 2358, 0 },
+    { 'w', 1, 2360, 0 },
+    { 'x', 12, 2361, 0 },
+    { 'r', 1, 2373, 0 },
+    { 'e', 1, 2374, 0 },
+    { 'v', 1, 2375, 0 },
+    { 'c', 1, 2376, 0 },
+    { 'e', 1, 2377, 0 },
+    { 'i', 1, 2378, 0 },
+    { 'o', 1, 2379, 0 },
+    { 'l', 1, 2380, 0 },
+    { 'm', 1, 2381, 0 },
+    { 'c', 1, 2382, 0 },
+    { 'p', 6, 2383, 0 },
+    { 'r', 2, 2389, 0 },
+    { 'a', 2, 2391, 0 },
+    { 'e', 1, 2393, 0 },
+    { 'i', 1, 2394, 0 },
+    { 'u', 1, 2395, 0 },
+    { 'o', 1, 2396, 0 },
+    { 'd', 1, 2397, 0 },
+    { 'm', 1, 2398, 0 },
+    { 'n', 1, 2399, 0 },
+    { 'r', 1, 2400, 0 },
+    { 'c', 1, 2401, 0 },
+    { 'e', 1, 2402, 0 },
+    { 'i', 1, 2403, 0 },
+    { 'r', 7, 2404, 0 },
+    { 'u', 1, 2411, 0 },
+    { 'l', 1, 2412, 0 },
+    { 'm', 2, 2413, 0 },
+    { 'n', 2, 2415, 0 },
+    { 'p', 3, 2417, 0 },
+    { 'a', 1, 2420, 0 },
+    { 'o', 1, 2421, 0 },
+    { 'c', 1, 2422, 0 },
+    { 'u', 2, 2423, 0 },
+    { 'd', 1, 2425, 0 },
+    { 'd', 1, 2426, 0 },
+    { 'e', 2, 2427, 0 },
+    { 'l', 1, 2429, 0 },
+    { 'p', 6, 2430, 0 },
+    { 'r', 4, 2436, 0 },
+    { 'v', 1, 2440, 0 },
+    { 'w', 1, 2441, 0 },
+    { 'c', 1, 2442, 0 },
+    { 'i', 1, 2443, 0 },
+    { 'l', 1, 2444, 0 },
+    { 'r', 1, 2445, 0 },
+    { 'a', 1, 2446, 0 },
+    { 'g', 1, 2447, 0 },
+    { 'l', 1, 2448, 0 },
+    { 'r', 1, 2449, 0 },
+    { 's', 1, 2450, 0 },
+    { 'k', 1, 2451, 0 },
+    { 'l', 1, 2452, 0 },
+    { 'a', 1, 2453, 0 },
+    { 'y', 1, 2454, 0 },
+    { ';', 0, 0, 23 },
+    { 'a', 2, 2455, 0 },
+    { 'o', 1, 2457, 0 },
+    { 'g', 1, 2458, 24 },
+    { 'l', 1, 2459, 0 },
+    { 'm', 1, 2460, 0 },
+    { 'i', 1, 2461, 0 },
+    { 'r', 1, 2462, 0 },
+    { 'a', 1, 2463, 0 },
+    { 'a', 1, 2464, 0 },
+    { 'e', 1, 2465, 0 },
+    { 'g', 1, 2466, 0 },
+    { 's', 1, 2467, 0 },
+    { 'v', 3, 2468, 0 },
+    { 'c', 1, 2471, 0 },
+    { 'c', 2, 2472, 0 },
+    { 'l', 1, 2474, 0 },
+    { 'p', 1, 2475, 0 },
+    { 't', 5, 2476, 0 },
+    { 'u', 1, 2481, 0 },
+    { 'w', 1, 2482, 0 },
+    { 'b', 1, 2483, 0 },
+    { 'c', 2, 2484, 0 },
+    { 'c', 2, 2486, 0 },
+    { 'o', 1, 2488, 0 },
+    { 't', 1, 2489, 0 },
+    { 'd', 1, 2490, 0 },
+    { 'r', 1, 2491, 0 },
+    { 'a', 1, 2492, 0 },
+    { 'h', 1, 2493, 0 },
+    { 'a', 1, 2494, 0 },
+    { 'c', 1, 2495, 0 },
+    { 'i', 1, 2496, 0 },
+    { 'D', 1, 2497, 0 },
+    { 'o', 1, 2498, 0 },
+    { 'c', 1, 2499, 0 },
+    { 's', 1, 2500, 0 },
+    { 'a', 1, 2501, 0 },
+    { 'i', 1, 2502, 0 },
+    { 'o', 1, 2503, 0 },
+    { 'y', 1, 2504, 0 },
+    { 'o', 1, 2505, 0 },
+    { ';', 0, 0, 25 },
+    { 'D', 1, 2506, 0 },
+    { 'r', 1, 2507, 0 },
+    { ';', 0, 0, 26 },
+    { 'r', 1, 2508, 0 },
+    { 's', 2, 2509, 0 },
+    { ';', 0, 0, 27 },
+    { 'i', 1, 2511, 0 },
+    { 'l', 1, 2512, 0 },
+    { 's', 2, 2513, 0 },
+    { 'a', 1, 2515, 0 },
+    { 'p', 1, 2516, 0 },
+    { 's', 1, 2517, 0 },
+    { 'g', 1, 2518, 0 },
+    { 's', 1, 2519, 0 },
+    { 'g', 1, 2520, 0 },
+    { 'p', 1, 2521, 0 },
+    { 'a', 1, 2522, 0 },
+    { 'l', 1, 2523, 0 },
+    { 's', 1, 2524, 0 },
+    { 'c', 2, 2525, 0 },
+    { 's', 2, 2527, 0 },
+    { 'u', 3, 2529, 0 },
+    { 'v', 1, 2532, 0 },
+    { 'D', 1, 2533, 0 },
+    { 'a', 1, 2534, 0 },
+    { 'c', 1, 2535, 0 },
+    { 'd', 1, 2536, 0 },
+    { 'i', 1, 2537, 0 },
+    { 'a', 1, 2538, 0 },
+    { 'h', 1, 2539, 28 },
+    { 'm', 1, 2540, 0 },
+    { 'r', 1, 2541, 0 },
+    { 'c', 1, 2542, 0 },
+    { 'i', 1, 2543, 0 },
+    { 'p', 2, 2544, 0 },
+    { 'l', 1, 2546, 0 },
+    { 'y', 1, 2547, 0 },
+    { 'm', 1, 2548, 0 },
+    { 'i', 1, 2549, 0 },
+    { 'l', 2, 2550, 0 },
+    { 'r', 1, 2552, 0 },
+    { 'l', 1, 2553, 0 },
+    { 'l', 1, 2554, 0 },
+    { 'a', 1, 2555, 0 },
+    { 'l', 1, 2556, 0 },
+    { 't', 1, 2557, 0 },
+    { 'o', 1, 2558, 0 },
+    { 'p', 1, 2559, 0 },
+    { 'r', 2, 2560, 0 },
+    { 'a', 1, 2562, 0 },
+    { 'a', 2, 2563, 0 },
+    { 'o', 1, 2565, 0 },
+    { 'c', 1, 2566, 0 },
+    { ';', 0, 0, 29 },
+    { 'l', 1, 2567, 0 },
+    { 'c', 1, 2568, 0 },
+    { 'm', 1, 2569, 0 },
+    { 'p', 1, 2570, 0 },
+    { 'r', 1, 2571, 0 },
+    { 'i', 1, 2572, 0 },
+    { 'y', 1, 2573, 0 },
+    { 'o', 1, 2574, 0 },
+    { ';', 0, 0, 30 },
+    { 'l', 1, 2575, 0 },
+    { 'q', 3, 2576, 0 },
+    { 's', 4, 2579, 0 },
+    { 'r', 1, 2583, 0 },
+    { ';', 0, 0, 7 },
+    { 'g', 1, 2584, 0 },
+    { 'm', 1, 2585, 0 },
+    { 'c', 1, 2586, 0 },
+    { ';', 0, 0, 31 },
+    { 'E', 1, 2587, 0 },
+    { 'a', 1, 2588, 0 },
+    { 'j', 1, 2589, 0 },
+    { 'E', 1, 2590, 0 },
+    { 'a', 1, 2591, 0 },
+    { 'e', 2, 2592, 0 },
+    { 's', 1, 2594, 0 },
+    { 'p', 1, 2595, 0 },
+    { 'a', 1, 2596, 0 },
+    { 'c', 1, 2597, 0 },
+    { 'i', 1, 2598, 0 },
+    { ';', 0, 0, 1 },
+    { 'c', 2, 2599, 0 },
+    { 'd', 1, 2601, 0 },
+    { 'l', 1, 2602, 0 },
+    { 'q', 1, 2603, 0 },
+    { 'r', 5, 2604, 0 },
+    { 'e', 1, 2609, 0 },
+    { 'n', 1, 2610, 0 },
+    { 'r', 1, 2611, 0 },
+    { 'i', 1, 2612, 0 },
+    { 'l', 1, 2613, 0 },
+    { 'm', 1, 2614, 0 },
+    { 'r', 2, 2615, 0 },
+    { 'a', 1, 2617, 0 },
+    { 'i', 1, 2618, 0 },
+    { 'a', 1, 2619, 0 },
+    { 'l', 1, 2620, 0 },
+    { 'r', 1, 2621, 0 },
+    { 'r', 1, 2622, 0 },
+    { 's', 2, 2623, 0 },
+    { 'a', 1, 2625, 0 },
+    { 'm', 1, 2626, 0 },
+    { 'o', 1, 2627, 0 },
+    { 'p', 1, 2628, 0 },
+    { 'r', 1, 2629, 0 },
+    { 'c', 1, 2630, 0 },
+    { 'l', 1, 2631, 0 },
+    { 't', 1, 2632, 0 },
+    { 'b', 1, 2633, 0 },
+    { 'p', 1, 2634, 0 },
+    { 'c', 1, 2635, 0 },
+    { ';', 0, 0, 32 },
+    { 'i', 1, 2636, 0 },
+    { 'y', 1, 2637, 0 },
+    { 'c', 1, 2638, 0 },
+    { 'x', 1, 2639, 0 },
+    { 'f', 1, 2640, 0 },
+    { 'r', 1, 2641, 0 },
+    { 'r', 1, 2642, 0 },
+    { ';', 0, 0, 33 },
+    { 'i', 2, 2643, 0 },
+    { 'n', 1, 2645, 0 },
+    { 'o', 1, 2646, 0 },
+    { 'l', 1, 2647, 0 },
+    { 'a', 3, 2648, 0 },
+    { 'o', 1, 2651, 0 },
+    { 'p', 1, 2652, 0 },
+    { ';', 0, 0, 34 },
+    { 'c', 1, 2653, 0 },
+    { 'f', 1, 2654, 0 },
+    { 'o', 1, 2655, 0 },
+    { 't', 5, 2656, 0 },
+    { 'c', 1, 2661, 0 },
+    { 'g', 1, 2662, 0 },
+    { 'p', 1, 2663, 0 },
+    { 't', 1, 2664, 0 },
+    { 'r', 1, 2665, 0 },
+    { 'u', 1, 2666, 0 },
+    { 'c', 1, 2667, 0 },
+    { 'i', 1, 2668, 0 },
+    { ';', 0, 0, 35 },
+    { 'i', 1, 2669, 0 },
+    { 'k', 1, 2670, 0 },
+    { 'm', 1, 2671, 0 },
+    { 'i', 1, 2672, 0 },
+    { 'y', 1, 2673, 0 },
+    { 'r', 1, 2674, 0 },
+    { 'a', 1, 2675, 0 },
+    { 'p', 1, 2676, 0 },
+    { 'c', 1, 2677, 0 },
+    { 'e', 1, 2678, 0 },
+    { 'k', 1, 2679, 0 },
+    { 'p', 1, 2680, 0 },
+    { 'e', 1, 2681, 0 },
+    { 'y', 1, 2682, 0 },
+    { 'r', 1, 2683, 0 },
+    { 'r', 1, 2684, 0 },
+    { 'c', 1, 2685, 0 },
+    { 'c', 1, 2686, 0 },
+    { 'p', 1, 2687, 0 },
+    { 'c', 1, 2688, 0 },
+    { 'a', 1, 2689, 0 },
+    { 'r', 1, 2690, 0 },
+    { 't', 1, 2691, 0 },
+    { 'a', 1, 2692, 0 },
+    { ';', 0, 0, 36 },
+    { 'g', 1, 2693, 0 },
+    { 'a', 1, 2694, 0 },
+    { 'c', 1, 2695, 0 },
+    { 'e', 1, 2696, 0 },
+    { 'g', 1, 2697, 0 },
+    { 'm', 1, 2698, 0 },
+    { 'n', 1, 2699, 0 },
+    { 'p', 1, 2700, 0 },
+    { 'q', 1, 2701, 0 },
+    { 'r', 1, 2702, 0 },
+    { 't', 3, 2703, 0 },
+    { 'a', 1, 2706, 0 },
+    { 'b', 1, 2707, 0 },
+    { 'r', 2, 2708, 0 },
+    { 'a', 1, 2710, 0 },
+    { 'e', 2, 2711, 0 },
+    { 'u', 1, 2713, 0 },
+    { 'y', 1, 2714, 0 },
+    { 'c', 1, 2715, 0 },
+    { 'q', 1, 2716, 0 },
+    { 'r', 2, 2717, 0 },
+    { 's', 1, 2719, 0 },
+    { ';', 0, 0, 37 },
+    { 'f', 1, 2720, 0 },
+    { 'g', 1, 2721, 0 },
+    { 'q', 3, 2722, 0 },
+    { 's', 5, 2725, 0 },
+    { 'i', 1, 2730, 0 },
+    { 'l', 1, 2731, 0 },
+    { 'r', 1, 2732, 0 },
+    { ';', 0, 0, 38 },
+    { 'E', 1, 2733, 0 },
+    { 'a', 1, 2734, 0 },
+    { 'b', 1, 2735, 0 },
+    { 'c', 1, 2736, 0 },
+    { ';', 0, 0, 10 },
+    { 'a', 1, 2737, 0 },
+    { 'c', 1, 2738, 0 },
+    { 'h', 1, 2739, 0 },
+    { 't', 1, 2740, 0 },
+    { 'i', 1, 2741, 0 },
+    { 'o', 1, 2742, 0 },
+    { 'E', 1, 2743, 0 },
+    { 'a', 1, 2744, 0 },
+    { 'e', 2, 2745, 0 },
+    { 's', 1, 2747, 0 },
+    { 'a', 2, 2748, 0 },
+    { 'b', 1, 2750, 0 },
+    { 'n', 1, 2751, 0 },
+    { 'o', 1, 2752, 0 },
+    { 'p', 3, 2753, 0 },
+    { 't', 1, 2756, 0 },
+    { 'w', 2, 2757, 0 },
+    { 'z', 3, 2759, 0 },
+    { 'a', 1, 2762, 0 },
+    { 'a', 1, 2763, 0 },
+    { 'c', 1, 2764, 0 },
+    { 'h', 1, 2765, 0 },
+    { 'm', 1, 2766, 0 },
+    { 't', 1, 2767, 0 },
+    { 'a', 1, 2768, 0 },
+    { 'c', 1, 2769, 0 },
+    { 'h', 1, 2770, 0 },
+    { 'i', 1, 2771, 0 },
+    { 'q', 2, 2772, 0 },
+    { 't', 1, 2774, 0 },
+    { ';', 0, 0, 2 },
+    { 'c', 2, 2775, 0 },
+    { 'd', 1, 2777, 0 },
+    { 'h', 1, 2778, 0 },
+    { 'i', 1, 2779, 0 },
+    { 'l', 1, 2780, 0 },
+    { 'q', 1, 2781, 0 },
+    { 'r', 2, 2782, 0 },
+    { 'r', 2, 2784, 0 },
+    { 'e', 1, 2786, 0 },
+    { 'n', 1, 2787, 0 },
+    { 'D', 1, 2788, 0 },
+    { 'c', 1, 2789, 0 },
+    { 'l', 2, 2790, 0 },
+    { 'p', 2, 2792, 0 },
+    { 'r', 1, 2794, 0 },
+    { 'o', 1, 2795, 0 },
+    { 'y', 1, 2796, 0 },
+    { 'a', 1, 2797, 0 },
+    { 'a', 1, 2798, 0 },
+    { 'r', 1, 2799, 0 },
+    { 'o', 1, 2800, 0 },
+    { 'c', 1, 2801, 0 },
+    { 'd', 4, 2802, 0 },
+    { 'n', 1, 2806, 0 },
+    { 'c', 1, 2807, 0 },
+    { 'd', 1, 2808, 0 },
+    { 'p', 1, 2809, 0 },
+    { 'd', 1, 2810, 0 },
+    { 'p', 1, 2811, 0 },
+    { ';', 0, 0, 39 },
+    { 'c', 1, 2812, 0 },
+    { 't', 1, 2813, 0 },
+    { ';', 0, 0, 40 },
+    { 'l', 1, 2814, 0 },
+    { 'm', 1, 2815, 0 },
+    { 'g', 1, 2816, 0 },
+    { 't', 2, 2817, 0 },
+    { 'e', 1, 2819, 0 },
+    { 'l', 1, 2820, 0 },
+    { 't', 2, 2821, 0 },
+    { 'i', 1, 2823, 0 },
+    { 'D', 1, 2824, 0 },
+    { 'd', 1, 2825, 0 },
+    { 'b', 1, 2826, 0 },
+    { 'c', 1, 2827, 0 },
+    { 'n', 1, 2828, 0 },
+    { 'p', 5, 2829, 0 },
+    { 't', 1, 2834, 0 },
+    { 's', 1, 2835, 0 },
+    { 'u', 1, 2836, 0 },
+    { 'a', 2, 2837, 0 },
+    { 'e', 1, 2839, 0 },
+    { 'o', 1, 2840, 0 },
+    { 'u', 1, 2841, 0 },
+    { 'y', 1, 2842, 0 },
+    { 'a', 1, 2843, 0 },
+    { ';', 0, 0, 41 },
+    { 'A', 1, 2844, 0 },
+    { 'a', 1, 2845, 0 },
+    { 'd', 1, 2846, 0 },
+    { 'q', 1, 2847, 0 },
+    { 's', 2, 2848, 0 },
+    { 'x', 1, 2850, 0 },
+    { 'r', 1, 2851, 0 },
+    { 'E', 1, 2852, 0 },
+    { 'e', 3, 2853, 0 },
+    { 's', 1, 2856, 0 },
+    { 't', 2, 2857, 0 },
+    { 'A', 1, 2859, 0 },
+    { 'a', 1, 2860, 0 },
+    { 'p', 1, 2861, 0 },
+    { ';', 0, 0, 42 },
+    { 's', 2, 2862, 0 },
+    { 'v', 1, 2864, 0 },
+    { 'c', 1, 2865, 0 },
+    { 'A', 1, 2866, 0 },
+    { 'E', 1, 2867, 0 },
+    { 'a', 1, 2868, 0 },
+    { 'd', 1, 2869, 0 },
+    { 'e', 4, 2870, 0 },
+    { 's', 1, 2874, 0 },
+    { 't', 2, 2875, 0 },
+    { 'i', 1, 2877, 0 },
+    { 'p', 1, 2878, 0 },
+    { 't', 3, 2879, 43 },
+    { 'a', 1, 2882, 0 },
+    { 'o', 1, 2883, 0 },
+    { 'r', 3, 2884, 0 },
+    { 'A', 1, 2887, 0 },
+    { 'a', 1, 2888, 0 },
+    { 'i', 1, 2889, 0 },
+    { 't', 1, 2890, 0 },
+    { 'c', 4, 2891, 0 },
+    { 'h', 1, 2895, 0 },
+    { 'i', 1, 2896, 0 },
+    { 'm', 1, 2897, 0 },
+    { 'p', 1, 2898, 0 },
+    { 'q', 1, 2899, 0 },
+    { 'u', 3, 2900, 0 },
+    { 'g', 1, 2903, 0 },
+    { 'i', 1, 2904, 0 },
+    { 'l', 1, 2905, 0 },
+    { 'r', 1, 2906, 0 },
+    { ';', 0, 0, 44 },
+    { 'm', 3, 2907, 0 },
+    { 'D', 1, 2910, 0 },
+    { 'H', 1, 2911, 0 },
+    { 'a', 1, 2912, 0 },
+    { 'd', 1, 2913, 0 },
+    { 'g', 2, 2914, 0 },
+    { 'i', 1, 2916, 0 },
+    { 'l', 3, 2917, 0 },
+    { 'r', 2, 2920, 0 },
+    { 's', 1, 2922, 0 },
+    { 'A', 1, 2923, 0 },
+    { 'a', 1, 2924, 0 },
+    { 'n', 1, 2925, 0 },
+    { ';', 0, 0, 45 },
+    { 'c', 1, 2926, 0 },
+    { 's', 1, 2927, 0 },
+    { 'i', 1, 2928, 0 },
+    { 'y', 1, 2929, 0 },
+    { 'a', 1, 2930, 0 },
+    { 'b', 1, 2931, 0 },
+    { 'i', 1, 2932, 0 },
+    { 'o', 1, 2933, 0 },
+    { 's', 1, 2934, 0 },
+    { 'l', 1, 2935, 0 },
+    { 'c', 1, 2936, 0 },
+    { 'r', 1, 2937, 0 },
+    { 'o', 1, 2938, 0 },
+    { 'r', 1, 2939, 0 },
+    { 't', 1, 2940, 0 },
+    { 'b', 1, 2941, 0 },
+    { 'm', 1, 2942, 0 },
+    { 'n', 1, 2943, 0 },
+    { 'a', 1, 2944, 0 },
+    { 'c', 2, 2945, 0 },
+    { 'i', 1, 2947, 0 },
+    { 't', 1, 2948, 0 },
+    { 'a', 1, 2949, 0 },
+    { 'e', 1, 2950, 0 },
+    { 'i', 3, 2951, 0 },
+    { 'p', 1, 2954, 0 },
+    { 'a', 1, 2955, 0 },
+    { 'e', 1, 2956, 0 },
+    { 'l', 1, 2957, 0 },
+    { ';', 0, 0, 46 },
+    { 'a', 1, 2958, 0 },
+    { 'd', 4, 2959, 0 },
+    { 'i', 1, 2963, 0 },
+    { 'o', 1, 2964, 0 },
+    { 's', 1, 2965, 0 },
+    { 'v', 1, 2966, 0 },
+    { 'c', 1, 2967, 0 },
+    { 'l', 1, 2968, 0 },
+    { 'o', 1, 2969, 0 },
+    { 'i', 2, 2970, 0 },
+    { 'm', 1, 2972, 0 },
+    { 'b', 1, 2973, 0 },
+    { 'r', 4, 2974, 0 },
+    { 'y', 1, 2978, 0 },
+    { 'r', 5, 2979, 0 },
+    { 'r', 1, 2984, 0 },
+    { 'i', 2, 2985, 0 },
+    { 'm', 1, 2987, 0 },
+    { 'o', 1, 2988, 0 },
+    { ';', 0, 0, 47 },
+    { 't', 1, 2989, 0 },
+    { 'v', 1, 2990, 0 },
+    { 'a', 1, 2991, 0 },
+    { 'u', 1, 2992, 0 },
+    { ';', 0, 0, 48 },
+    { 'i', 1, 2993, 0 },
+    { 'p', 1, 2994, 0 },
+    { 'u', 1, 2995, 0 },
+    { ';', 0, 0, 49 },
+    { 'E', 1, 2996, 0 },
+    { 'a', 1, 2997, 0 },
+    { 'c', 1, 2998, 0 },
+    { 'e', 2, 2999, 0 },
+    { 'i', 1, 3001, 0 },
+    { 'n', 3, 3002, 0 },
+    { 'o', 3, 3005, 0 },
+    { 's', 1, 3008, 0 },
+    { 'u', 1, 3009, 0 },
+    { 'c', 1, 3010, 0 },
+    { 'i', 1, 3011, 0 },
+    { 'n', 1, 3012, 0 },
+    { 'r', 1, 3013, 0 },
+    { 'n', 1, 3014, 0 },
+    { 'p', 1, 3015, 0 },
+    { 'r', 1, 3016, 0 },
+    { 'c', 1, 3017, 0 },
+    { 'a', 1, 3018, 0 },
+    { 'e', 1, 3019, 0 },
+    { 'o', 1, 3020, 0 },
+    { 'a', 1, 3021, 0 },
+    { 'r', 1, 3022, 0 },
+    { 't', 1, 3023, 0 },
+    { 'a', 1, 3024, 0 },
+    { 'a', 1, 3025, 0 },
+    { 'c', 2, 3026, 0 },
+    { 'd', 1, 3028, 0 },
+    { 'e', 1, 3029, 0 },
+    { 'n', 1, 3030, 0 },
+    { 'q', 1, 3031, 0 },
+    { 'r', 1, 3032, 0 },
+    { 't', 2, 3033, 0 },
+    { 'a', 1, 3035, 0 },
+    { 'b', 1, 3036, 0 },
+    { 'r', 2, 3037, 0 },
+    { 'a', 1, 3039, 0 },
+    { 'e', 2, 3040, 0 },
+    { 'u', 1, 3042, 0 },
+    { 'y', 1, 3043, 0 },
+    { 'c', 1, 3044, 0 },
+    { 'l', 1, 3045, 0 },
+    { 'q', 1, 3046, 0 },
+    { 's', 1, 3047, 0 },
+    { 'a', 1, 3048, 0 },
+    { 'c', 1, 3049, 0 },
+    { 'g', 1, 3050, 16 },
+    { 'i', 1, 3051, 0 },
+    { 'l', 1, 3052, 0 },
+    { 'r', 1, 3053, 0 },
+    { 'a', 1, 3054, 0 },
+    { 'o', 2, 3055, 0 },
+    { 'g', 1, 3057, 0 },
+    { 'n', 1, 3058, 0 },
+    { 's', 1, 3059, 0 },
+    { 'a', 1, 3060, 0 },
+    { 'h', 1, 3061, 0 },
+    { 'm', 1, 3062, 0 },
+    { 'o', 1, 3063, 0 },
+    { 'm', 1, 3064, 0 },
+    { 'a', 2, 3065, 0 },
+    { 'b', 1, 3067, 0 },
+    { 'p', 3, 3068, 0 },
+    { 't', 1, 3071, 0 },
+    { 'a', 1, 3072, 0 },
+    { 'p', 1, 3073, 0 },
+    { 'a', 1, 3074, 0 },
+    { 'a', 1, 3075, 0 },
+    { 'c', 1, 3076, 0 },
+    { 'h', 1, 3077, 0 },
+    { 'q', 2, 3078, 0 },
+    { 'h', 1, 3080, 0 },
+    { 'i', 1, 3081, 0 },
+    { 'r', 1, 3082, 0 },
+    { 'l', 1, 3083, 0 },
+    { ';', 0, 0, 50 },
+    { 'c', 1, 3084, 0 },
+    { 'q', 1, 3085, 0 },
+    { ';', 0, 0, 51 },
+    { 'E', 1, 3086, 0 },
+    { 'a', 2, 3087, 0 },
+    { 'c', 1, 3089, 0 },
+    { 'e', 2, 3090, 0 },
+    { 'i', 1, 3092, 0 },
+    { 'n', 3, 3093, 0 },
+    { 'p', 1, 3096, 0 },
+    { 's', 1, 3097, 0 },
+    { 'y', 1, 3098, 0 },
+    { 'o', 1, 3099, 0 },
+    { 'A', 1, 3100, 0 },
+    { 'a', 1, 3101, 0 },
+    { 'c', 1, 3102, 0 },
+    { 'm', 1, 3103, 0 },
+    { 's', 1, 3104, 0 },
+    { 't', 1, 3105, 0 },
+    { 'x', 1, 3106, 0 },
+    { 'r', 2, 3107, 0 },
+    { 'a', 1, 3109, 0 },
+    { 'c', 2, 3110, 0 },
+    { 'o', 1, 3112, 0 },
+    { 'y', 1, 3113, 52 },
+    { 'g', 1, 3114, 0 },
+    { 'm', 8, 3115, 0 },
+    { 'a', 1, 3123, 0 },
+    { 'a', 2, 3124, 0 },
+    { 'e', 1, 3126, 0 },
+    { 'i', 2, 3127, 0 },
+    { 't', 2, 3129, 0 },
+    { 'f', 1, 3131, 0 },
+    { 'l', 2, 3132, 0 },
+    { 'p', 1, 3134, 0 },
+    { 'a', 2, 3135, 0 },
+    { 'c', 2, 3137, 0 },
+    { 's', 1, 3139, 0 },
+    { 'u', 3, 3140, 0 },
+    { 'a', 1, 3143, 0 },
+    { 'c', 1, 3144, 0 },
+    { 'e', 1, 3145, 0 },
+    { 'm', 1, 3146, 0 },
+    { 't', 1, 3147, 0 },
+    { 'a', 1, 3148, 0 },
+    { 'r', 2, 3149, 0 },
+    { 'b', 9, 3151, 0 },
+    { 'c', 1, 3160, 0 },
+    { 'm', 1, 3161, 0 },
+    { 'n', 1, 3162, 0 },
+    { 'p', 13, 3163, 0 },
+    { 'A', 1, 3176, 0 },
+    { 'a', 1, 3177, 0 },
+    { 'n', 1, 3178, 0 },
+    { 'l', 1, 3179, 0 },
+    { 'r', 1, 3180, 0 },
+    { 'u', 1, 3181, 0 },
+    { 'r', 1, 3182, 0 },
+    { 'a', 1, 3183, 0 },
+    { 'e', 1, 3184, 0 },
+    { 'y', 1, 3185, 0 },
+    { 'o', 1, 3186, 0 },
+    { 'l', 1, 3187, 0 },
+    { 'r', 1, 3188, 0 },
+    { 'e', 2, 3189, 0 },
+    { 'i', 2, 3191, 0 },
+    { 'k', 2, 3193, 0 },
+    { 'o', 1, 3195, 0 },
+    { 'l', 1, 3196, 0 },
+    { 'm', 1, 3197, 0 },
+    { 'n', 1, 3198, 0 },
+    { 'e', 1, 3199, 0 },
+    { 'p', 4, 3200, 0 },
+    { 's', 1, 3204, 0 },
+    { 'r', 1, 3205, 0 },
+    { 'a', 1, 3206, 0 },
+    { 'i', 7, 3207, 0 },
+    { 'p', 1, 3214, 0 },
+    { 'c', 2, 3215, 0 },
+    { 'h', 1, 3217, 0 },
+    { 't', 1, 3218, 0 },
+    { 'i', 1, 3219, 0 },
+    { 'o', 1, 3220, 0 },
+    { 'r', 1, 3221, 0 },
+    { 'a', 1, 3222, 0 },
+    { 'c', 1, 3223, 0 },
+    { 'r', 1, 3224, 0 },
+    { 'r', 2, 3225, 0 },
+    { 'i', 1, 3227, 0 },
+    { 'y', 1, 3228, 0 },
+    { 'a', 1, 3229, 0 },
+    { 'b', 1, 3230, 0 },
+    { 'h', 1, 3231, 0 },
+    { 'i', 1, 3232, 0 },
+    { 'r', 1, 3233, 0 },
+    { 'r', 1, 3234, 0 },
+    { 'a', 1, 3235, 0 },
+    { 'b', 1, 3236, 0 },
+    { 'c', 2, 3237, 0 },
+    { 't', 1, 3239, 0 },
+    { 'a', 1, 3240, 0 },
+    { 'l', 1, 3241, 53 },
+    { 'g', 1, 3242, 0 },
+    { 'p', 1, 3243, 0 },
+    { 'a', 1, 3244, 0 },
+    { 'd', 1, 3245, 0 },
+    { 'h', 1, 3246, 0 },
+    { 'l', 1, 3247, 0 },
+    { 's', 1, 3248, 0 },
+    { 'u', 1, 3249, 0 },
+    { 'c', 2, 3250, 0 },
+    { 'i', 1, 3252, 0 },
+    { 't', 1, 3253, 0 },
+    { 'c', 1, 3254, 0 },
+    { 'd', 1, 3255, 0 },
+    { 'i', 1, 3256, 0 },
+    { 'r', 1, 3257, 0 },
+    { 'a', 1, 3258, 0 },
+    { 'm', 1, 3259, 0 },
+    { 'a', 1, 3260, 0 },
+    { 'r', 1, 3261, 0 },
+    { 'a', 1, 3262, 0 },
+    { 'a', 1, 3263, 0 },
+    { 'n', 1, 3264, 0 },
+    { 'r', 7, 3265, 0 },
+    { 'y', 1, 3272, 0 },
+    { 'a', 1, 3273, 0 },
+    { 'e', 3, 3274, 0 },
+    { 'l', 1, 3277, 0 },
+    { 'r', 2, 3278, 0 },
+    { 'r', 1, 3280, 0 },
+    { 't', 1, 3281, 0 },
+    { 's', 1, 3282, 0 },
+    { 'p', 1, 3283, 0 },
+    { 'r', 1, 3284, 0 },
+    { 't', 1, 3285, 0 },
+    { 'c', 1, 3286, 0 },
+    { 'u', 2, 3287, 0 },
+    { 'i', 1, 3289, 0 },
+    { 'i', 1, 3290, 0 },
+    { 'd', 2, 3291, 0 },
+    { 'i', 1, 3293, 0 },
+    { 'r', 1, 3294, 0 },
+    { 'p', 1, 3295, 0 },
+    { ';', 0, 0, 54 },
+    { ';', 0, 0, 55 },
+    { 'e', 1, 3296, 0 },
+    { 'c', 1, 3297, 0 },
+    { 'a', 1, 3298, 0 },
+    { 'i', 1, 3299, 0 },
+    { 'u', 1, 3300, 0 },
+    { 't', 1, 3301, 0 },
+    { 'r', 1, 3302, 0 },
+    { 'A', 1, 3303, 0 },
+    { 'a', 1, 3304, 0 },
+    { ';', 0, 0, 56 },
+    { 'A', 1, 3305, 0 },
+    { 'a', 1, 3306, 0 },
+    { 'a', 1, 3307, 0 },
+    { 'i', 1, 3308, 0 },
+    { 'd', 1, 3309, 0 },
+    { 'p', 2, 3310, 0 },
+    { 't', 1, 3312, 0 },
+    { 'A', 1, 3313, 0 },
+    { 'a', 1, 3314, 0 },
+    { 'c', 1, 3315, 0 },
+    { 'q', 1, 3316, 0 },
+    { 'p', 1, 3317, 0 },
+    { 't', 1, 3318, 0 },
+    { 'e', 1, 3319, 0 },
+    { 'e', 1, 3320, 0 },
+    { 'c', 2, 3321, 0 },
+    { 'i', 1, 3323, 0 },
+    { 'y', 1, 3324, 0 },
+    { 'n', 1, 3325, 57 },
+    { 'r', 1, 3326, 0 },
+    { 'c', 1, 3327, 0 },
+    { 'p', 1, 3328, 0 },
+    { 'c', 1, 3329, 0 },
+    { 'c', 1, 3330, 0 },
+    { 'm', 1, 3331, 0 },
+    { 'c', 1, 3332, 0 },
+    { 'a', 1, 3333, 0 },
+    { 'y', 1, 3334, 0 },
+    { 'o', 1, 3335, 0 },
+    { 'e', 1, 3336, 0 },
+    { 't', 1, 3337, 0 },
+    { 'r', 1, 3338, 0 },
+    { 'c', 1, 3339, 0 },
+    { 'g', 1, 3340, 0 },
+    { 'p', 1, 3341, 0 },
+    { 'c', 1, 3342, 0 },
+    { 'j', 1, 3343, 0 },
+    { 'n', 1, 3344, 0 },
+    { 'i', 1, 3345, 0 },
+    { ';', 0, 0, 3 },
+    { 'u', 1, 3346, 0 },
+    { 'e', 1, 3347, 0 },
+    { 'r', 1, 3348, 0 },
+    { ';', 0, 0, 58 },
+    { ';', 0, 0, 59 },
+    { 'a', 1, 3349, 0 },
+    { 'h', 1, 3350, 0 },
+    { 'c', 1, 3351, 0 },
+    { ';', 0, 0, 60 },
+    { 'o', 1, 3352, 0 },
+    { 'f', 1, 3353, 0 },
+    { 'l', 1, 3354, 0 },
+    { 'n', 1, 3355, 0 },
+    { 'r', 1, 3356, 0 },
+    { 'i', 1, 3357, 0 },
+    { 'l', 1, 3358, 0 },
+    { 'l', 1, 3359, 61 },
+    { 'k', 1, 3360, 0 },
+    { 'v', 1, 3361, 0 },
+    { 'w', 1, 3362, 0 },
+    { ';', 0, 0, 62 },
+    { 'a', 1, 3363, 0 },
+    { 'n', 1, 3364, 0 },
+    { 'a', 1, 3365, 0 },
+    { ';', 0, 0, 63 },
+    { 'f', 1, 3366, 0 },
+    { 'v', 1, 3367, 0 },
+    { 'r', 1, 3368, 0 },
+    { 'p', 1, 3369, 0 },
+    { 'y', 1, 3370, 0 },
+    { 'Y', 1, 3371, 64 },
+    { 'u', 1, 3372, 0 },
+    { ';', 0, 0, 65 },
+    { 'i', 1, 3373, 0 },
+    { 'l', 1, 3374, 0 },
+    { 'r', 1, 3375, 0 },
+    { 'd', 1, 3376, 0 },
+    { 'r', 1, 3377, 0 },
+    { 'n', 1, 3378, 0 },
+    { 't', 1, 3379, 0 },
+    { 'i', 1, 3380, 0 },
+    { 't', 1, 3381, 0 },
+    { ';', 0, 0, 66 },
+    { ';', 0, 0, 67 },
+    { 'c', 1, 3382, 0 },
+    { 'c', 1, 3383, 0 },
+    { 's', 1, 3384, 0 },
+    { 'o', 1, 3385, 0 },
+    { 'g', 1, 3386, 0 },
+    { 'i', 1, 3387, 0 },
+    { 't', 1, 3388, 0 },
+    { 'f', 1, 3389, 0 },
+    { 'r', 1, 3390, 0 },
+    { 'n', 1, 3391, 0 },
+    { 's', 1, 3392, 0 },
+    { 'r', 1, 3393, 0 },
+    { ';', 0, 0, 68 },
+    { 'C', 1, 3394, 0 },
+    { 't', 1, 3395, 0 },
+    { 'y', 1, 3396, 0 },
+    { 'y', 1, 3397, 0 },
+    { 'y', 1, 3398, 0 },
+    { 'g', 1, 3399, 0 },
+    { 'r', 1, 3400, 0 },
+    { 'h', 1, 3401, 0 },
+    { 'r', 1, 3402, 0 },
+    { ';', 0, 0, 69 },
+    { ';', 0, 0, 70 },
+    { 't', 1, 3403, 0 },
+    { ';', 0, 0, 71 },
+    { 'c', 1, 3404, 0 },
+    { 'm', 1, 3405, 0 },
+    { 'f', 1, 3406, 0 },
+    { 'f', 1, 3407, 0 },
+    { ';', 0, 0, 53 },
+    { 'D', 1, 3408, 0 },
+    { 'E', 1, 3409, 0 },
+    { 'b', 1, 3410, 0 },
+    { 'n', 6, 3411, 0 },
+    { 'r', 1, 3417, 0 },
+    { 'r', 1, 3418, 0 },
+    { ';', 0, 0, 72 },
+    { ';', 0, 0, 5 },
+    { 'u', 1, 3419, 0 },
+    { 'r', 1, 3420, 0 },
+    { 'r', 1, 3421, 0 },
+    { ';', 0, 0, 73 },
+    { 't', 1, 3422, 0 },
+    { ';', 0, 0, 74 },
+    { 'a', 1, 3423, 0 },
+    { 'm', 1, 3424, 0 },
+    { 'c', 1, 3425, 0 },
+    { 't', 1, 3426, 0 },
+    { 'o', 1, 3427, 0 },
+    { 'f', 1, 3428, 0 },
+    { 'i', 1, 3429, 0 },
+    { 'a', 1, 3430, 0 },
+    { 'i', 1, 3431, 0 },
+    { 'r', 1, 3432, 0 },
+    { 'm', 1, 3433, 0 },
+    { ';', 0, 0, 75 },
+    { 'l', 1, 3434, 76 },
+    { 's', 1, 3435, 0 },
+    { 'o', 1, 3436, 0 },
+    { ';', 0, 0, 77 },
+    { ';', 0, 0, 78 },
+    { 'l', 1, 3437, 0 },
+    { 'f', 1, 3438, 0 },
+    { 'A', 1, 3439, 0 },
+    { 'r', 1, 3440, 0 },
+    { 'r', 1, 3441, 0 },
+    { 'y', 1, 3442, 0 },
+    { 'm', 1, 3443, 0 },
+    { 'e', 1, 3444, 0 },
+    { 'd', 1, 3445, 0 },
+    { 'r', 1, 3446, 0 },
+    { ';', 0, 0, 79 },
+    { 't', 1, 3447, 0 },
+    { ';', 0, 0, 80 },
+    { 'f', 1, 3448, 0 },
+    { 'a', 1, 3449, 0 },
+    { 'r', 1, 3450, 0 },
+    { 'D', 1, 3451, 0 },
+    { 'e', 1, 3452, 0 },
+    { ';', 0, 0, 81 },
+    { 'r', 1, 3453, 0 },
+    { ';', 0, 0, 82 },
+    { 'b', 1, 3454, 0 },
+    { 'f', 1, 3455, 0 },
+    { 'i', 1, 3456, 0 },
+    { 'r', 1, 3457, 0 },
+    { 'r', 1, 3458, 0 },
+    { 'p', 2, 3459, 0 },
+    { 'y', 1, 3461, 0 },
+    { 'i', 1, 3462, 0 },
+    { 'y', 1, 3463, 0 },
+    { 'u', 1, 3464, 0 },
+    { 'r', 1, 3465, 0 },
+    { ';', 0, 0, 83 },
+    { 't', 1, 3466, 0 },
+    { ';', 0, 0, 8 },
+    { 'a', 1, 3467, 0 },
+    { 'c', 1, 3468, 0 },
+    { 'g', 1, 3469, 0 },
+    { 'l', 1, 3470, 0 },
+    { ';', 0, 0, 84 },
+    { 'e', 2, 3471, 0 },
+    { 'i', 1, 3473, 0 },
+    { 'o', 1, 3474, 0 },
+    { 'f', 1, 3475, 0 },
+    { 'a', 1, 3476, 0 },
+    { 'r', 1, 3477, 0 },
+    { 'l', 1, 3478, 0 },
+    { 'c', 1, 3479, 0 },
+    { 'l', 1, 3480, 85 },
+    { 'r', 1, 3481, 0 },
+    { ';', 0, 0, 86 },
+    { ';', 0, 0, 87 },
+    { 'f', 1, 3482, 0 },
+    { 'r', 1, 3483, 0 },
+    { 'r', 1, 3484, 0 },
+    { 'c', 1, 3485, 0 },
+    { 'y', 1, 3486, 0 },
+    { 'y', 1, 3487, 0 },
+    { 'p', 1, 3488, 0 },
+    { 'd', 1, 3489, 0 },
+    { ';', 0, 0, 88 },
+    { ';', 0, 0, 89 },
+    { 'f', 1, 3490, 0 },
+    { 'r', 1, 3491, 0 },
+    { 'y', 1, 3492, 0 },
+    { 'u', 1, 3493, 0 },
+    { 'b', 1, 3494, 0 },
+    { 'g', 1, 3495, 0 },
+    { 'l', 1, 3496, 0 },
+    { 'r', 1, 3497, 0 },
+    { 'r', 1, 3498, 0 },
+    { 'd', 1, 3499, 0 },
+    { ';', 0, 0, 90 },
+    { 't', 10, 3500, 0 },
+    { 's', 6, 3510, 0 },
+    { ';', 0, 0, 91 },
+    { 'f', 1, 3516, 0 },
+    { 'd', 1, 3517, 0 },
+    { 'g', 4, 3518, 0 },
+    { 'f', 1, 3522, 0 },
+    { 'e', 1, 3523, 0 },
+    { 'r', 1, 3524, 0 },
+    { ';', 0, 0, 92 },
+    { 'r', 1, 3525, 0 },
+    { ';', 0, 0, 93 },
+    { ';', 0, 0, 94 },
+    { 'i', 1, 3526, 0 },
+    { 'l', 1, 3527, 0 },
+    { ';', 0, 0, 95 },
+    { 'u', 1, 3528, 0 },
+    { 'f', 1, 3529, 0 },
+    { 'r', 1, 3530, 0 },
+    { 'y', 1, 3531, 0 },
+    { 'u', 1, 3532, 0 },
+    { 'r', 1, 3533, 0 },
+    { 'd', 1, 3534, 0 },
+    { ';', 0, 0, 96 },
+    { 'a', 1, 3535, 0 },
+    { 't', 1, 3536, 0 },
+    { 'L', 1, 3537, 0 },
+    { ';', 0, 0, 97 },
+    { 'r', 1, 3538, 0 },
+    { 'B', 1, 3539, 0 },
+    { 'f', 1, 3540, 0 },
+    { ';', 0, 0, 98 },
+    { 'C', 2, 3541, 0 },
+    { 'D', 1, 3543, 0 },
+    { 'E', 3, 3544, 0 },
+    { 'G', 1, 3547, 0 },
+    { 'H', 1, 3548, 0 },
+    { 'L', 1, 3549, 0 },
+    { 'N', 1, 3550, 0 },
+    { 'P', 1, 3551, 0 },
+    { 'R', 2, 3552, 0 },
+    { 'S', 2, 3554, 0 },
+    { 'T', 1, 3556, 0 },
+    { 'V', 1, 3557, 0 },
+    { 'r', 1, 3558, 0 },
+    { 'l', 1, 3559, 0 },
+    { 'i', 1, 3560, 0 },
+    { 'u', 1, 3561, 0 },
+    { 'r', 1, 3562, 0 },
+    { ';', 0, 0, 99 },
+    { 'l', 1, 3563, 0 },
+    { ';', 0, 0, 100 },
+    { 'a', 1, 3564, 0 },
+    { 'c', 1, 3565, 0 },
+    { 'g', 1, 3566, 0 },
+    { 'c', 1, 3567, 0 },
+    { 'f', 1, 3568, 0 },
+    { 'n', 1, 3569, 0 },
+    { 'r', 1, 3570, 0 },
+    { 'a', 1, 3571, 0 },
+    { 'l', 1, 3572, 0 },
+    { 'm', 1, 3573, 0 },
+    { 'l', 1, 3574, 101 },
+    { 'r', 2, 3575, 0 },
+    { 't', 1, 3577, 0 },
+    { ';', 0, 0, 102 },
+    { ';', 0, 0, 103 },
+    { ';', 0, 0, 104 },
+    { 's', 1, 3578, 0 },
+    { 'n', 1, 3579, 0 },
+    { 'f', 1, 3580, 0 },
+    { 'c', 1, 3581, 0 },
+    { 'm', 1, 3582, 0 },
+    { 'd', 1, 3583, 0 },
+    { 'p', 1, 3584, 0 },
+    { 'r', 1, 3585, 0 },
+    { ';', 0, 0, 105 },
+    { 'T', 1, 3586, 106 },
+    { ';', 0, 0, 107 },
+    { 'f', 1, 3587, 0 },
+    { 'r', 1, 3588, 0 },
+    { 'r', 1, 3589, 0 },
+    { ';', 0, 0, 16 },
+    { 'u', 1, 3590, 0 },
+    { 'g', 1, 3591, 0 },
+    { 'r', 2, 3592, 0 },
+    { 'r', 1, 3594, 0 },
+    { 'd', 1, 3595, 0 },
+    { ';', 0, 0, 108 },
+    { 'e', 1, 3596, 0 },
+    { ';', 0, 0, 17 },
+    { ';', 0, 0, 109 },
+    { 'h', 1, 3597, 0 },
+    { 'f', 1, 3598, 0 },
+    { 'n', 1, 3599, 0 },
+    { 'g', 1, 3600, 0 },
+    { 'r', 1, 3601, 0 },
+    { ';', 0, 0, 110 },
+    { 'e', 1, 3602, 0 },
+    { 'H', 1, 3603, 0 },
+    { 'y', 1, 3604, 0 },
+    { 'T', 1, 3605, 0 },
+    { 'u', 1, 3606, 0 },
+    { 'r', 1, 3607, 0 },
+    { 'd', 1, 3608, 0 },
+    { 'r', 1, 3609, 0 },
+    { ';', 0, 0, 111 },
+    { ';', 0, 0, 112 },
+    { 'r', 1, 3610, 0 },
+    { 'm', 1, 3611, 0 },
+    { 'l', 1, 3612, 0 },
+    { 'f', 1, 3613, 0 },
+    { 't', 1, 3614, 0 },
+    { 'a', 1, 3615, 0 },
+    { 'r', 1, 3616, 0 },
+    { 'r', 1, 3617, 0 },
+    { ';', 0, 0, 113 },
+    { 's', 1, 3618, 0 },
+    { 'c', 1, 3619, 0 },
+    { 'h', 1, 3620, 0 },
+    { ';', 0, 0, 114 },
+    { ';', 0, 0, 115 },
+    { 'e', 1, 3621, 0 },
+    { 's', 1, 3622, 0 },
+    { 'R', 1, 3623, 0 },
+    { 'D', 1, 3624, 0 },
+    { 'c', 1, 3625, 0 },
+    { 'y', 1, 3626, 0 },
+    { ';', 0, 0, 116 },
+    { ';', 0, 0, 117 },
+    { 'r', 1, 3627, 0 },
+    { 'd', 1, 3628, 0 },
+    { ';', 0, 0, 118 },
+    { ';', 0, 0, 119 },
+    { 'r', 1, 3629, 0 },
+    { 't', 1, 3630, 0 },
+    { 'c', 1, 3631, 0 },
+    { 'n', 1, 3632, 0 },
+    { 'd', 1, 3633, 0 },
+    { 'f', 1, 3634, 0 },
+    { 'p', 1, 3635, 0 },
+    { 'r', 1, 3636, 0 },
+    { 'r', 1, 3637, 0 },
+    { 'u', 1, 3638, 0 },
+    { 'r', 2, 3639, 0 },
+    { 'c', 1, 3641, 0 },
+    { 'e', 1, 3642, 0 },
+    { 'r', 1, 3643, 0 },
+    { ';', 0, 0, 120 },
+    { 'l', 1, 3644, 0 },
+    { ';', 0, 0, 121 },
+    { 'a', 1, 3645, 0 },
+    { 'c', 1, 3646, 0 },
+    { 'e', 1, 3647, 0 },
+    { 'o', 1, 3648, 0 },
+    { 'o', 1, 3649, 0 },
+    { 'f', 1, 3650, 0 },
+    { 'r', 1, 3651, 0 },
+    { 'o', 1, 3652, 0 },
+    { 'q', 1, 3653, 0 },
+    { 'e', 1, 3654, 0 },
+    { 'r', 1, 3655, 0 },
+    { 'o', 1, 3656, 0 },
+    { 'e', 1, 3657, 0 },
+    { 'i', 2, 3658, 0 },
+    { 'n', 1, 3660, 0 },
+    { 'r', 1, 3661, 0 },
+    { 'l', 1, 3662, 0 },
+    { 'l', 1, 3663, 122 },
+    { 's', 1, 3664, 0 },
+    { 'r', 1, 3665, 0 },
+    { ';', 0, 0, 123 },
+    { 's', 1, 3666, 0 },
+    { ';', 0, 0, 124 },
+    { 'b', 1, 3667, 0 },
+    { 't', 2, 3668, 0 },
+    { 'y', 1, 3670, 0 },
+    { ';', 0, 0, 125 },
+    { 'f', 1, 3671, 0 },
+    { 'r', 1, 3672, 0 },
+    { 'a', 1, 3673, 0 },
+    { 'r', 1, 3674, 0 },
+    { 'g', 1, 3675, 0 },
+    { ';', 0, 0, 126 },
+    { 'f', 1, 3676, 0 },
+    { 'r', 1, 3677, 0 },
+    { ';', 0, 0, 127 },
+    { 'f', 1, 3678, 0 },
+    { 'r', 1, 3679, 0 },
+    { 'y', 1, 3680, 0 },
+    { 'y', 1, 3681, 0 },
+    { 'y', 1, 3682, 0 },
+    { 'u', 1, 3683, 0 },
+    { 'r', 1, 3684, 0 },
+    { ';', 0, 0, 128 },
+    { ';', 0, 0, 129 },
+    { 'f', 1, 3685, 0 },
+    { 'r', 1, 3686, 0 },
+    { 'l', 1, 3687, 0 },
+    { 'y', 1, 3688, 0 },
+    { 'u', 1, 3689, 0 },
+    { 'r', 1, 3690, 0 },
+    { ';', 0, 0, 130 },
+    { 't', 1, 3691, 0 },
+    { 'o', 1, 3692, 0 },
+    { 'a', 1, 3693, 0 },
+    { ';', 0, 0, 131 },
+    { 'f', 1, 3694, 0 },
+    { 'r', 1, 3695, 0 },
+    { 'u', 1, 3696, 0 },
+    { 'e', 1, 3697, 0 },
+    { ';', 0, 0, 132 },
+    { ';', 0, 0, 133 },
+    { 'r', 1, 3698, 0 },
+    { 't', 1, 3699, 0 },
+    { ';', 0, 0, 134 },
+    { 'i', 1, 3700, 0 },
+    { ';', 0, 0, 135 },
+    { 'a', 1, 3701, 0 },
+    { 'f', 1, 3702, 0 },
+    { 'p', 1, 3703, 0 },
+    { 'h', 1, 3704, 0 },
+    { 'c', 1, 3705, 0 },
+    { 'l', 1, 3706, 0 },
+    { ';', 0, 0, 3 },
+    { ';', 0, 0, 136 },
+    { 'a', 1, 3707, 0 },
+    { 'd', 1, 3708, 0 },
+    { 's', 1, 3709, 0 },
+    { 'v', 1, 3710, 0 },
+    { ';', 0, 0, 137 },
+    { 'e', 1, 3711, 0 },
+    { 'l', 1, 3712, 0 },
+    { 'm', 1, 3713, 0 },
+    { 'r', 1, 3714, 0 },
+    { 's', 2, 3715, 0 },
+    { 'z', 1, 3717, 0 },
+    { 'o', 1, 3718, 0 },
+    { 'f', 1, 3719, 0 },
+    { ';', 0, 0, 138 },
+    { 'c', 1, 3720, 0 },
+    { ';', 0, 0, 139 },
+    { 'd', 1, 3721, 0 },
+    { 's', 1, 3722, 0 },
+    { 'r', 1, 3723, 0 },
+    { 'n', 1, 3724, 0 },
+    { 'r', 1, 3725, 0 },
+    { ';', 0, 0, 140 },
+    { 'm', 1, 3726, 0 },
+    { 'l', 1, 3727, 0 },
+    { 'l', 1, 3728, 141 },
+    { 'o', 1, 3729, 0 },
+    { 'n', 1, 3730, 0 },
+    { 't', 1, 3731, 0 },
+    { 'k', 4, 3732, 0 },
+    { 'v', 1, 3736, 0 },
+    { 'w', 1, 3737, 0 },
+    { 'k', 2, 3738, 0 },
+    { 'n', 1, 3740, 0 },
+    { ';', 0, 0, 142 },
+    { 'u', 1, 3741, 0 },
+    { 'a', 1, 3742, 0 },
+    { 'p', 1, 3743, 0 },
+    { 's', 1, 3744, 0 },
+    { 'n', 1, 3745, 0 },
+    { 'a', 1, 3746, 0 },
+    { 'h', 1, 3747, 0 },
+    { 'w', 1, 3748, 0 },
+    { ';', 0, 0, 143 },
+    { 'c', 3, 3749, 0 },
+    { 'o', 3, 3752, 0 },
+    { 's', 2, 3755, 0 },
+    { 't', 1, 3757, 0 },
+    { 'u', 1, 3758, 0 },
+    { 'v', 1, 3759, 0 },
+    { 'w', 1, 3760, 0 },
+    { 'r', 1, 3761, 0 },
+    { 'c', 1, 3762, 0 },
+    { 'n', 1, 3763, 0 },
+    { '1', 2, 3764, 0 },
+    { '3', 1, 3766, 0 },
+    { 'c', 1, 3767, 0 },
+    { ';', 0, 0, 144 },
+    { 'q', 1, 3768, 0 },
+    { 't', 1, 3769, 0 },
+    { 'f', 1, 3770, 0 },
+    { ';', 0, 0, 145 },
+    { 't', 1, 3771, 0 },
+    { 't', 1, 3772, 0 },
+    { 'D', 4, 3773, 0 },
+    { 'H', 5, 3777, 0 },
+    { 'U', 4, 3782, 0 },
+    { 'V', 7, 3786, 0 },
+    { 'b', 1, 3793, 0 },
+    { 'd', 4, 3794, 0 },
+    { 'h', 5, 3798, 0 },
+    { 'm', 1, 3803, 0 },
+    { 'p', 1, 3804, 0 },
+    { 't', 1, 3805, 0 },
+    { 'u', 4, 3806, 0 },
+    { 'v', 7, 3810, 0 },
+    { 'i', 1, 3817, 0 },
+    { 'v', 1, 3818, 0 },
+    { 'b', 1, 3819, 0 },
+    { 'r', 1, 3820, 0 },
+    { 'm', 1, 3821, 0 },
+    { 'm', 2, 3822, 0 },
+    { 'l', 3, 3824, 0 },
+    { 'l', 2, 3827, 0 },
+    { 'p', 3, 3829, 0 },
+    { 'u', 1, 3832, 0 },
+    { ';', 0, 0, 146 },
+    { 'a', 1, 3833, 0 },
+    { 'b', 1, 3834, 0 },
+    { 'c', 2, 3835, 0 },
+    { 'd', 1, 3837, 0 },
+    { 's', 1, 3838, 0 },
+    { 'e', 1, 3839, 0 },
+    { 'o', 1, 3840, 0 },
+    { 'p', 1, 3841, 0 },
+    { 'r', 1, 3842, 0 },
+    { 'd', 1, 3843, 0 },
+    { 'r', 1, 3844, 0 },
+    { 'p', 1, 3845, 0 },
+    { 't', 1, 3846, 0 },
+    { 'i', 1, 3847, 0 },
+    { 'p', 1, 3848, 0 },
+    { 't', 2, 3849, 147 },
+    { ';', 0, 0, 148 },
+    { 'y', 1, 3851, 0 },
+    { 'c', 1, 3852, 0 },
+    { ';', 0, 0, 149 },
+    { ';', 0, 0, 150 },
+    { 'E', 1, 3853, 0 },
+    { 'c', 3, 3854, 0 },
+    { 'e', 1, 3857, 0 },
+    { 'f', 1, 3858, 0 },
+    { 'm', 1, 3859, 0 },
+    { 's', 1, 3860, 0 },
+    { 'b', 1, 3861, 0 },
+    { 'o', 1, 3862, 0 },
+    { 'm', 1, 3863, 0 },
+    { 'p', 3, 3864, 0 },
+    { 'g', 2, 3867, 0 },
+    { 'i', 1, 3869, 0 },
+    { 'f', 1, 3870, 0 },
+    { 'r', 1, 3871, 0 },
+    { 'y', 2, 3872, 64 },
+    { 'r', 1, 3874, 0 },
+    { 's', 1, 3875, 0 },
+    { 'r', 1, 3876, 0 },
+    { 'b', 2, 3877, 0 },
+    { 'p', 2, 3879, 0 },
+    { 'o', 1, 3881, 0 },
+    { 'a', 1, 3882, 0 },
+    { 'p', 1, 3883, 0 },
+    { 's', 1, 3884, 0 },
+    { 'a', 1, 3885, 0 },
+    { ';', 0, 0, 151 },
+    { 'b', 1, 3886, 0 },
+    { 'c', 2, 3887, 0 },
+    { 'd', 1, 3889, 0 },
+    { 'o', 1, 3890, 0 },
+    { 's', 1, 3891, 0 },
+    { 'a', 1, 3892, 0 },
+    { 'l', 1, 3893, 0 },
+    { 'r', 1, 3894, 0 },
+    { 'v', 1, 3895, 0 },
+    { 'e', 1, 3896, 0 },
+    { 'e', 1, 3897, 0 },
+    { 'o', 1, 3898, 0 },
+    { 'n', 1, 3899, 0 },
+    { 'c', 1, 3900, 0 },
+    { 'r', 1, 3901, 0 },
+    { 'r', 1, 3902, 0 },
+    { 'g', 1, 3903, 0 },
+    { 'e', 1, 3904, 0 },
+    { 'r', 1, 3905, 0 },
+    { 'h', 2, 3906, 0 },
+    { 'a', 1, 3908, 0 },
+    { 'a', 1, 3909, 0 },
+    { 'r', 1, 3910, 0 },
+    { ';', 0, 0, 152 },
+    { 'g', 1, 3911, 0 },
+    { 'r', 1, 3912, 0 },
+    { 't', 1, 3913, 0 },
+    { ';', 0, 0, 24 },
+    { 't', 1, 3914, 0 },
+    { 'p', 1, 3915, 0 },
+    { 's', 1, 3916, 0 },
+    { ';', 0, 0, 153 },
+    { 'r', 2, 3917, 0 },
+    { 'm', 3, 3919, 0 },
+    { ';', 0, 0, 53 },
+    { 'a', 1, 3922, 0 },
+    { 'i', 1, 3923, 0 },
+    { ';', 0, 0, 154 },
+    { 'i', 1, 3924, 0 },
+    { 'o', 1, 3925, 0 },
+    { 'y', 1, 3926, 0 },
+    { 'o', 1, 3927, 0 },
+    { 'r', 1, 3928, 0 },
+    { 'l', 1, 3929, 0 },
+    { 'f', 1, 3930, 0 },
+    { ';', 0, 0, 155 },
+    { 'e', 1, 3931, 0 },
+    { 'm', 1, 3932, 0 },
+    { 'p', 1, 3933, 0 },
+    { 's', 1, 3934, 0 },
+    { 'b', 1, 3935, 0 },
+    { 'n', 3, 3936, 0 },
+    { 'k', 1, 3939, 0 },
+    { 'o', 1, 3940, 0 },
+    { 'r', 1, 3941, 0 },
+    { 'r', 1, 3942, 0 },
+    { 'y', 1, 3943, 0 },
+    { 'l', 1, 3944, 0 },
+    { 'r', 1, 3945, 0 },
+    { 'o', 1, 3946, 0 },
+    { 'i', 2, 3947, 0 },
+    { 'r', 1, 3949, 0 },
+    { 'a', 1, 3950, 0 },
+    { 'n', 1, 3951, 0 },
+    { 'y', 1, 3952, 0 },
+    { 'g', 1, 3953, 0 },
+    { 'o', 1, 3954, 0 },
+    { 't', 1, 3955, 0 },
+    { 'u', 1, 3956, 0 },
+    { 't', 1, 3957, 0 },
+    { 'r', 1, 3958, 0 },
+    { 'r', 2, 3959, 0 },
+    { 'l', 1, 3961, 0 },
+    { ';', 0, 0, 156 },
+    { 't', 1, 3962, 0 },
+    { 'o', 1, 3963, 0 },
+    { ';', 0, 0, 157 },
+    { 'a', 1, 3964, 0 },
+    { ';', 0, 0, 158 },
+    { 'd', 1, 3965, 0 },
+    { 'n', 1, 3966, 0 },
+    { ';', 0, 0, 159 },
+    { ';', 0, 0, 160 },
+    { 'd', 1, 3967, 0 },
+    { 'c', 1, 3968, 0 },
+    { 't', 1, 3969, 0 },
+    { 'p', 2, 3970, 0 },
+    { ';', 0, 0, 161 },
+    { 'p', 1, 3972, 0 },
+    { 'o', 1, 3973, 0 },
+    { 'f', 1, 3974, 0 },
+    { 'r', 2, 3975, 0 },
+    { 'u', 1, 3977, 0 },
+    { 'i', 3, 3978, 0 },
+    { 'i', 1, 3981, 0 },
+    { 'o', 1, 3982, 0 },
+    { 'i', 1, 3983, 0 },
+    { 'l', 1, 3984, 0 },
+    { 'a', 1, 3985, 0 },
+    { 'e', 1, 3986, 0 },
+    { 'i', 1, 3987, 0 },
+    { 'p', 1, 3988, 0 },
+    { 'o', 1, 3989, 0 },
+    { 'r', 1, 3990, 0 },
+    { 'r', 1, 3991, 0 },
+    { 'o', 1, 3992, 0 },
+    { 'm', 1, 3993, 0 },
+    { ';', 0, 0, 162 },
+    { ';', 0, 0, 28 },
+    { 'l', 1, 3994, 163 },
+    { 'o', 1, 3995, 0 },
+    { 'l', 1, 3996, 0 },
+    { 's', 1, 3997, 0 },
+    { 'e', 1, 3998, 0 },
+    { 'o', 1, 3999, 0 },
+    { 'l', 1, 4000, 0 },
+    { ';', 0, 0, 164 },
+    { 'a', 1, 4001, 0 },
+    { 'l', 1, 4002, 0 },
+    { 'i', 1, 4003, 0 },
+    { 'l', 1, 4004, 0 },
+    { ';', 0, 0, 165 },
+    { 'i', 1, 4005, 0 },
+    { 'i', 1, 4006, 0 },
+    { 't', 1, 4007, 0 },
+    { 'i', 1, 4008, 0 },
+    { 'n', 1, 4009, 0 },
+    { 'f', 1, 4010, 0 },
+    { 'f', 1, 4011, 0 },
+    { 'a', 1, 4012, 0 },
+    { 'k', 2, 4013, 0 },
+    { 'r', 1, 4015, 0 },
+    { 'c', 6, 4016, 0 },
+    { 's', 1, 4022, 0 },
+    { 'w', 1, 4023, 0 },
+    { 'r', 1, 4024, 0 },
+    { ';', 0, 0, 166 },
+    { 'u', 1, 4025, 0 },
+    { 'm', 1, 4026, 0 },
+    { ';', 0, 0, 167 },
+    { 'e', 1, 4027, 0 },
+    { 'r', 1, 4028, 0 },
+    { ';', 0, 0, 168 },
+    { 't', 1, 4029, 0 },
+    { ';', 0, 0, 169 },
+    { ';', 0, 0, 30 },
+    { 'q', 1, 4030, 0 },
+    { 's', 1, 4031, 0 },
+    { ';', 0, 0, 170 },
+    { 'c', 1, 4032, 0 },
+    { 'd', 1, 4033, 0 },
+    { 'l', 2, 4034, 0 },
+    { ';', 0, 0, 171 },
+    { ';', 0, 0, 6 },
+    { 'e', 1, 4036, 0 },
+    { 'y', 1, 4037, 0 },
+    { ';', 0, 0, 172 },
+    { ';', 0, 0, 173 },
+    { ';', 0, 0, 174 },
+    { ';', 0, 0, 175 },
+    { 'p', 2, 4038, 0 },
+    { ';', 0, 0, 176 },
+    { 'q', 2, 4040, 0 },
+    { 'i', 1, 4042, 0 },
+    { 'f', 1, 4043, 0 },
+    { 'v', 1, 4044, 0 },
+    { 'r', 1, 4045, 0 },
+    { 'm', 3, 4046, 0 },
+    { 'c', 1, 4049, 0 },
+    { 'i', 1, 4050, 0 },
+    { 'o', 1, 4051, 0 },
+    { 'P', 1, 4052, 0 },
+    { 'u', 1, 4053, 0 },
+    { 'a', 2, 4054, 0 },
+    { 'd', 1, 4056, 0 },
+    { 'e', 1, 4057, 0 },
+    { 'l', 1, 4058, 0 },
+    { 's', 1, 4059, 0 },
+    { 'r', 1, 4060, 0 },
+    { 'E', 1, 4061, 0 },
+    { 'r', 1, 4062, 0 },
+    { 'r', 1, 4063, 0 },
+    { 'f', 1, 4064, 0 },
+    { 'i', 1, 4065, 0 },
+    { 'd', 1, 4066, 0 },
+    { 'r', 3, 4067, 0 },
+    { 'r', 1, 4070, 0 },
+    { 'r', 1, 4071, 0 },
+    { 'r', 1, 4072, 0 },
+    { 'l', 1, 4073, 0 },
+    { 'c', 1, 4074, 0 },
+    { ';', 0, 0, 177 },
+    { 'e', 1, 4075, 0 },
+    { 'w', 1, 4076, 0 },
+    { 'r', 1, 4077, 0 },
+    { 't', 1, 4078, 0 },
+    { 'k', 2, 4079, 0 },
+    { 'f', 1, 4081, 0 },
+    { 'b', 1, 4082, 0 },
+    { 'r', 1, 4083, 0 },
+    { 'a', 1, 4084, 0 },
+    { 'r', 1, 4085, 0 },
+    { 'u', 1, 4086, 0 },
+    { 'h', 1, 4087, 0 },
+    { 'u', 1, 4088, 0 },
+    { 'r', 1, 4089, 0 },
+    { ';', 0, 0, 178 },
+    { 'y', 1, 4090, 0 },
+    { 'c', 1, 4091, 0 },
+    { ';', 0, 0, 179 },
+    { ';', 0, 0, 180 },
+    { 'a', 1, 4092, 0 },
+    { 'i', 1, 4093, 0 },
+    { 'n', 1, 4094, 0 },
+    { 'f', 1, 4095, 0 },
+    { 't', 1, 4096, 0 },
+    { 'i', 1, 4097, 0 },
+    { 'c', 1, 4098, 0 },
+    { 'g', 3, 4099, 0 },
+    { 't', 1, 4102, 0 },
+    { 'f', 1, 4103, 0 },
+    { 'e', 1, 4104, 0 },
+    { 'a', 1, 4105, 0 },
+    { 'i', 1, 4106, 0 },
+    { 'd', 1, 4107, 0 },
+    { ';', 0, 0, 181 },
+    { 'c', 1, 4108, 0 },
+    { 'e', 2, 4109, 0 },
+    { 'l', 1, 4111, 0 },
+    { 'p', 1, 4112, 0 },
+    { 'y', 1, 4113, 0 },
+    { 'o', 1, 4114, 0 },
+    { 'f', 1, 4115, 0 },
+    { 'a', 1, 4116, 0 },
+    { 'o', 1, 4117, 0 },
+    { 'e', 1, 4118, 0 },
+    { 'r', 1, 4119, 0 },
+    { 'n', 5, 4120, 0 },
+    { 'l', 1, 4125, 0 },
+    { 'c', 1, 4126, 0 },
+    { 'l', 1, 4127, 182 },
+    { 'r', 1, 4128, 0 },
+    { ';', 0, 0, 183 },
+    { ';', 0, 0, 184 },
+    { 't', 1, 4129, 0 },
+    { 'f', 1, 4130, 0 },
+    { 'r', 1, 4131, 0 },
+    { 'r', 1, 4132, 0 },
+    { 'c', 1, 4133, 0 },
+    { 'p', 1, 4134, 0 },
+    { 'd', 1, 4135, 0 },
+    { ';', 0, 0, 185 },
+    { ';', 0, 0, 186 },
+    { 'e', 1, 4136, 0 },
+    { 'y', 1, 4137, 0 },
+    { 'y', 1, 4138, 0 },
+    { 'f', 1, 4139, 0 },
+    { 'r', 1, 4140, 0 },
+    { 'r', 1, 4141, 0 },
+    { 'r', 1, 4142, 0 },
+    { 'a', 1, 4143, 0 },
+    { 'r', 1, 4144, 0 },
+    { ';', 0, 0, 187 },
+    { 'r', 1, 4145, 0 },
+    { 'u', 1, 4146, 0 },
+    { 'm', 1, 4147, 0 },
+    { 'r', 1, 4148, 0 },
+    { 'b', 1, 4149, 0 },
+    { 'g', 3, 4150, 0 },
+    { ';', 0, 0, 188 },
+    { 'u', 1, 4153, 0 },
+    { 'r', 8, 4154, 0 },
+    { ';', 0, 0, 189 },
+    { 'a', 1, 4162, 0 },
+    { 'e', 2, 4163, 0 },
+    { 'r', 1, 4165, 0 },
+    { 'r', 1, 4166, 0 },
+    { 'a', 1, 4167, 0 },
+    { 'k', 2, 4168, 0 },
+    { 'r', 1, 4170, 0 },
+    { 'd', 1, 4171, 0 },
+    { 'i', 1, 4172, 0 },
+    { 'b', 1, 4173, 0 },
+    { ';', 0, 0, 190 },
+    { 'a', 1, 4174, 0 },
+    { 'u', 1, 4175, 0 },
+    { 'd', 1, 4176, 0 },
+    { 'u', 1, 4177, 0 },
+    { 'h', 1, 4178, 0 },
+    { 't', 5, 4179, 0 },
+    { ';', 0, 0, 191 },
+    { ';', 0, 0, 37 },
+    { 'q', 1, 4184, 0 },
+    { 's', 1, 4185, 0 },
+    { ';', 0, 0, 192 },
+    { 'c', 1, 4186, 0 },
+    { 'd', 1, 4187, 0 },
+    { 'g', 2, 4188, 0 },
+    { 's', 5, 4190, 0 },
+    { 's', 1, 4195, 0 },
+    { 'o', 1, 4196, 0 },
+    { ';', 0, 0, 193 },
+    { ';', 0, 0, 194 },
+    { 'r', 2, 4197, 0 },
+    { 'l', 1, 4199, 0 },
+    { 'y', 1, 4200, 0 },
+    { 'r', 1, 4201, 0 },
+    { 'o', 1, 4202, 0 },
+    { 'a', 1, 4203, 0 },
+    { 'r', 1, 4204, 0 },
+    { 'd', 1, 4205, 0 },
+    { 'u', 1, 4206, 0 },
+    { ';', 0, 0, 195 },
+    { 'p', 2, 4207, 0 },
+    { ';', 0, 0, 196 },
+    { 'q', 2, 4209, 0 },
+    { 'i', 1, 4211, 0 },
+    { 'n', 1, 4212, 0 },
+    { 'r', 1, 4213, 0 },
+    { 'r', 1, 4214, 0 },
+    { 'g', 3, 4215, 0 },
+    { 'p', 1, 4218, 0 },
+    { 'a', 1, 4219, 0 },
+    { 'f', 1, 4220, 0 },
+    { 'l', 1, 4221, 0 },
+    { 'i', 1, 4222, 0 },
+    { 'a', 1, 4223, 0 },
+    { 'b', 1, 4224, 0 },
+    { ';', 0, 0, 197 },
+    { 'e', 1, 4225, 0 },
+    { 'f', 1, 4226, 0 },
+    { 'r', 2, 4227, 0 },
+    { 'r', 1, 4229, 0 },
+    { 'o', 1, 4230, 0 },
+    { 'a', 1, 4231, 0 },
+    { ';', 0, 0, 198 },
+    { 'r', 1, 4232, 0 },
+    { 'q', 1, 4233, 0 },
+    { 'r', 1, 4234, 0 },
+    { ';', 0, 0, 92 },
+    { 'm', 3, 4235, 0 },
+    { 'b', 1, 4238, 0 },
+    { 'u', 1, 4239, 0 },
+    { 'r', 1, 4240, 0 },
+    { 'c', 1, 4241, 0 },
+    { 'i', 1, 4242, 0 },
+    { 'o', 1, 4243, 0 },
+    { 'r', 1, 4244, 0 },
+    { 'm', 1, 4245, 0 },
+    { 'a', 1, 4246, 0 },
+    { 'u', 1, 4247, 0 },
+    { 'P', 1, 4248, 0 },
+    { 'i', 3, 4249, 0 },
+    { 'd', 1, 4252, 0 },
+    { 'u', 1, 4253, 0 },
+    { 'r', 1, 4254, 0 },
+    { 'E', 1, 4255, 0 },
+    { 'o', 1, 4256, 0 },
+    { 'r', 1, 4257, 199 },
+    { 'e', 1, 4258, 0 },
+    { 't', 2, 4259, 0 },
+    { ';', 0, 0, 200 },
+    { 's', 1, 4261, 0 },
+    { 'k', 1, 4262, 0 },
+    { 'm', 1, 4263, 0 },
+    { ';', 0, 0, 201 },
+    { 's', 1, 4264, 0 },
+    { 's', 1, 4265, 0 },
+    { ';', 0, 0, 202 },
+    { ';', 0, 0, 203 },
+    { 'r', 1, 4266, 0 },
+    { ';', 0, 0, 204 },
+    { 'a', 1, 4267, 0 },
+    { 'c', 1, 4268, 0 },
+    { 'd', 1, 4269, 0 },
+    { 'u', 1, 4270, 0 },
+    { 'p', 1, 4271, 0 },
+    { 'r', 1, 4272, 0 },
+    { 'l', 1, 4273, 0 },
+    { 'e', 1, 4274, 0 },
+    { 'f', 1, 4275, 0 },
+    { 'r', 1, 4276, 0 },
+    { 'p', 1, 4277, 0 },
+    { 't', 1, 4278, 0 },
+    { 'a', 1, 4279, 0 },
+    { ';', 0, 0, 205 },
+    { ';', 0, 0, 206 },
+    { 'v', 1, 4280, 0 },
+    { 'f', 1, 4281, 0 },
+    { ';', 0, 0, 207 },
+    { ';', 0, 0, 208 },
+    { 'v', 1, 4282, 0 },
+    { 'g', 1, 4283, 0 },
+    { 'a', 1, 4284, 0 },
+    { 'a', 1, 4285, 0 },
+    { 'l', 1, 4286, 0 },
+    { 'u', 1, 4287, 0 },
+    { 'g', 1, 4288, 0 },
+    { ';', 0, 0, 209 },
+    { 'E', 1, 4289, 0 },
+    { 'i', 1, 4290, 0 },
+    { 'o', 1, 4291, 0 },
+    { 'p', 1, 4292, 0 },
+    { 'u', 1, 4293, 0 },
+    { 'p', 1, 4294, 210 },
+    { 'm', 1, 4295, 0 },
+    { 'p', 1, 4296, 0 },
+    { 'r', 1, 4297, 0 },
+    { 'd', 1, 4298, 0 },
+    { 'n', 1, 4299, 0 },
+    { 'p', 1, 4300, 0 },
+    { ';', 0, 0, 211 },
+    { 's', 1, 4301, 0 },
+    { 'r', 1, 4302, 0 },
+    { 'r', 2, 4303, 0 },
+    { 'o', 1, 4305, 0 },
+    { 'u', 1, 4306, 0 },
+    { 'e', 1, 4307, 0 },
+    { 'i', 1, 4308, 0 },
+    { 'i', 1, 4309, 0 },
+    { ';', 0, 0, 212 },
+    { ';', 0, 0, 213 },
+    { ';', 0, 0, 214 },
+    { 'q', 3, 4310, 0 },
+    { 's', 1, 4313, 0 },
+    { 'i', 1, 4314, 0 },
+    { ';', 0, 0, 215 },
+    { 'r', 1, 4315, 0 },
+    { 'r', 1, 4316, 0 },
+    { 'r', 1, 4317, 0 },
+    { 'a', 1, 4318, 0 },
+    { ';', 0, 0, 216 },
+    { 'd', 1, 4319, 0 },
+    { ';', 0, 0, 42 },
+    { 'y', 1, 4320, 0 },
+    { 'r', 1, 4321, 0 },
+    { ';', 0, 0, 217 },
+    { 'r', 1, 4322, 0 },
+    { 'r', 1, 4323, 0 },
+    { ';', 0, 0, 218 },
+    { 'f', 1, 4324, 0 },
+    { 'q', 3, 4325, 0 },
+    { 's', 2, 4328, 0 },
+    { 'i', 1, 4330, 0 },
+    { ';', 0, 0, 219 },
+    { 'r', 1, 4331, 0 },
+    { 'd', 1, 4332, 0 },
+    { 'f', 1, 4333, 0 },
+    { ';', 0, 0, 43 },
+    { 'i', 1, 4334, 0 },
+    { 'n', 1, 4335, 0 },
+    { 'r', 4, 4336, 0 },
+    { 'l', 1, 4340, 0 },
+    { ';', 0, 0, 220 },
+    { 'c', 1, 4341, 0 },
+    { 'e', 2, 4342, 0 },
+    { 'r', 1, 4344, 0 },
+    { 'r', 1, 4345, 0 },
+    { 'g', 1, 4346, 0 },
+    { 'r', 1, 4347, 0 },
+    { ';', 0, 0, 221 },
+    { 'c', 1, 4348, 0 },
+    { 'e', 1, 4349, 0 },
+    { 'r', 1, 4350, 0 },
+    { 'o', 1, 4351, 0 },
+    { 'm', 2, 4352, 0 },
+    { 'i', 1, 4354, 0 },
+    { 'a', 1, 4355, 0 },
+    { 's', 1, 4356, 0 },
+    { 'b', 4, 4357, 0 },
+    { 'c', 1, 4361, 0 },
+    { 'p', 4, 4362, 0 },
+    { 'l', 1, 4366, 0 },
+    { 'l', 1, 4367, 0 },
+    { 'g', 1, 4368, 0 },
+    { 'i', 1, 4369, 0 },
+    { ';', 0, 0, 222 },
+    { 'e', 1, 4370, 0 },
+    { 's', 1, 4371, 0 },
+    { 'a', 1, 4372, 0 },
+    { 'a', 1, 4373, 0 },
+    { 'p', 1, 4374, 0 },
+    { 'a', 1, 4375, 0 },
+    { 'e', 1, 4376, 0 },
+    { 't', 1, 4377, 0 },
+    { 'n', 1, 4378, 0 },
+    { 'A', 1, 4379, 0 },
+    { 'e', 1, 4380, 0 },
+    { 't', 2, 4381, 0 },
+    { 'A', 1, 4383, 0 },
+    { 't', 1, 4384, 0 },
+    { 'i', 1, 4385, 0 },
+    { 'r', 1, 4386, 0 },
+    { 'r', 2, 4387, 0 },
+    { 'e', 1, 4389, 0 },
+    { 'u', 1, 4390, 0 },
+    { 't', 1, 4391, 0 },
+    { 'r', 2, 4392, 0 },
+    { ';', 0, 0, 223 },
+    { 's', 1, 4394, 0 },
+    { 'l', 1, 4395, 0 },
+    { 'v', 1, 4396, 0 },
+    { 't', 1, 4397, 0 },
+    { 'o', 1, 4398, 0 },
+    { 'i', 1, 4399, 0 },
+    { 'i', 1, 4400, 0 },
+    { ';', 0, 0, 224 },
+    { 'n', 1, 4401, 0 },
+    { 'a', 1, 4402, 0 },
+    { ';', 0, 0, 225 },
+    { 'a', 1, 4403, 0 },
+    { ';', 0, 0, 226 },
+    { 't', 1, 4404, 0 },
+    { 'r', 1, 4405, 0 },
+    { 'i', 1, 4406, 0 },
+    { 'r', 1, 4407, 0 },
+    { 'n', 1, 4408, 0 },
+    { ';', 0, 0, 227 },
+    { 'c', 1, 4409, 0 },
+    { 'g', 1, 4410, 0 },
+    { 'c', 1, 4411, 0 },
+    { 'd', 1, 4412, 0 },
+    { 'n', 1, 4413, 0 },
+    { 'f', 1, 4414, 0 },
+    { 'r', 1, 4415, 0 },
+    { 'r', 1, 4416, 0 },
+    { 'u', 1, 4417, 0 },
+    { 'r', 1, 4418, 0 },
+    { ';', 0, 0, 228 },
+    { 'e', 1, 4419, 0 },
+    { 'f', 1, 4420, 229 },
+    { 'm', 1, 4421, 230 },
+    { 'g', 1, 4422, 0 },
+    { 'r', 1, 4423, 0 },
+    { 'l', 1, 4424, 0 },
+    { ';', 0, 0, 231 },
+    { 'r', 1, 4425, 0 },
+    { 'a', 1, 4426, 0 },
+    { 'l', 1, 4427, 0 },
+    { 'l', 1, 4428, 0 },
+    { 'm', 1, 4429, 0 },
+    { 'l', 1, 4430, 232 },
+    { 'a', 1, 4431, 0 },
+    { ';', 0, 0, 233 },
+    { 'a', 2, 4432, 234 },
+    { 's', 2, 4434, 0 },
+    { 't', 1, 4436, 0 },
+    { ';', 0, 0, 235 },
+    { 'c', 1, 4437, 0 },
+    { 'i', 1, 4438, 0 },
+    { 'm', 1, 4439, 0 },
+    { 'p', 1, 4440, 0 },
+    { 't', 1, 4441, 0 },
+    { ';', 0, 0, 236 },
+    { ';', 0, 0, 237 },
+    { 'v', 1, 4442, 0 },
+    { 'm', 1, 4443, 0 },
+    { 'n', 1, 4444, 0 },
+    { 'c', 1, 4445, 0 },
+    { ';', 0, 0, 238 },
+    { 'n', 2, 4446, 0 },
+    { 's', 9, 4448, 0 },
+    { 'n', 1, 4457, 0 },
+    { 'f', 1, 4458, 0 },
+    { 'n', 1, 4459, 0 },
+    { ';', 0, 0, 239 },
+    { 'p', 1, 4460, 0 },
+    { 'u', 1, 4461, 0 },
+    { ';', 0, 0, 240 },
+    { 'c', 6, 4462, 0 },
+    { 'm', 1, 4468, 0 },
+    { 'E', 1, 4469, 0 },
+    { 'a', 1, 4470, 0 },
+    { 's', 1, 4471, 0 },
+    { 'd', 1, 4472, 0 },
+    { 'f', 3, 4473, 0 },
+    { 'p', 2, 4476, 0 },
+    { 'i', 1, 4478, 0 },
+    { 'r', 1, 4479, 0 },
+    { 'r', 1, 4480, 0 },
+    { ';', 0, 0, 241 },
+    { 'c', 1, 4481, 0 },
+    { ';', 0, 0, 242 },
+    { 't', 1, 4482, 0 },
+    { 'f', 1, 4483, 0 },
+    { 'i', 1, 4484, 0 },
+    { 'r', 1, 4485, 0 },
+    { 't', 2, 4486, 0 },
+    { 's', 1, 4488, 0 },
+    { 't', 1, 4489, 106 },
+    { 'r', 1, 4490, 0 },
+    { 'r', 1, 4491, 0 },
+    { 'a', 1, 4492, 0 },
+    { 'r', 1, 4493, 0 },
+    { 'r', 1, 4494, 0 },
+    { 'e', 1, 4495, 0 },
+    { 'u', 1, 4496, 0 },
+    { 'i', 1, 4497, 0 },
+    { 'm', 1, 4498, 0 },
+    { 'g', 4, 4499, 0 },
+    { 'u', 1, 4503, 0 },
+    { 'r', 11, 4504, 0 },
+    { 'a', 1, 4515, 0 },
+    { 'i', 1, 4516, 0 },
+    { 'r', 1, 4517, 0 },
+    { 'r', 1, 4518, 0 },
+    { 'a', 1, 4519, 0 },
+    { 'k', 2, 4520, 0 },
+    { 'r', 1, 4522, 0 },
+    { 'd', 1, 4523, 0 },
+    { 'i', 1, 4524, 0 },
+    { 'b', 1, 4525, 0 },
+    { ';', 0, 0, 243 },
+    { 'a', 1, 4526, 0 },
+    { 'd', 1, 4527, 0 },
+    { 'u', 1, 4528, 0 },
+    { 'h', 1, 4529, 0 },
+    { 'l', 4, 4530, 0 },
+    { 't', 1, 4534, 0 },
+    { ';', 0, 0, 16 },
+    { 's', 1, 4535, 0 },
+    { 'o', 1, 4536, 0 },
+    { ';', 0, 0, 244 },
+    { 'r', 2, 4537, 0 },
+    { ';', 0, 0, 245 },
+    { 'v', 1, 4539, 0 },
+    { 'h', 1, 4540, 0 },
+    { 'g', 1, 4541, 0 },
+    { 'i', 1, 4542, 0 },
+    { 'r', 1, 4543, 0 },
+    { 'a', 1, 4544, 0 },
+    { ';', 0, 0, 246 },
+    { 'u', 1, 4545, 0 },
+    { 'i', 1, 4546, 0 },
+    { 'n', 1, 4547, 0 },
+    { 'r', 1, 4548, 0 },
+    { 'r', 1, 4549, 0 },
+    { 'a', 1, 4550, 0 },
+    { 'f', 1, 4551, 0 },
+    { 'l', 1, 4552, 0 },
+    { 'i', 1, 4553, 0 },
+    { 'r', 2, 4554, 0 },
+    { 'o', 1, 4556, 0 },
+    { 'r', 1, 4557, 0 },
+    { 'q', 1, 4558, 0 },
+    { 'r', 1, 4559, 0 },
+    { ';', 0, 0, 110 },
+    { 'b', 1, 4560, 0 },
+    { 'u', 1, 4561, 0 },
+    { 'r', 1, 4562, 0 },
+    { 'm', 1, 4563, 0 },
+    { 'i', 4, 4564, 0 },
+    { 'u', 1, 4568, 0 },
+    { 'u', 1, 4569, 0 },
+    { 'u', 1, 4570, 0 },
+    { ';', 0, 0, 247 },
+    { 'p', 1, 4571, 0 },
+    { 'r', 1, 4572, 0 },
+    { 'u', 1, 4573, 0 },
+    { ';', 0, 0, 248 },
+    { 'd', 1, 4574, 0 },
+    { 'r', 1, 4575, 0 },
+    { 'E', 1, 4576, 0 },
+    { 'a', 1, 4577, 0 },
+    { 's', 1, 4578, 0 },
+    { 'o', 1, 4579, 0 },
+    { 'i', 1, 4580, 0 },
+    { ';', 0, 0, 249 },
+    { 't', 3, 4581, 0 },
+    { 'r', 1, 4584, 0 },
+    { 'r', 2, 4585, 0 },
+    { 't', 1, 4587, 250 },
+    { 'i', 1, 4588, 0 },
+    { 'w', 1, 4589, 0 },
+    { 'm', 2, 4590, 0 },
+    { 't', 1, 4592, 0 },
+    { ';', 0, 0, 251 },
+    { 'o', 1, 4593, 0 },
+    { 'r', 1, 4594, 0 },
+    { 'h', 1, 4595, 0 },
+    { 'y', 1, 4596, 0 },
+    { 'r', 1, 4597, 0 },
+    { ';', 0, 0, 52 },
+    { 'm', 1, 4598, 0 },
+    { ';', 0, 0, 252 },
+    { 'd', 1, 4599, 0 },
+    { 'e', 2, 4600, 0 },
+    { 'g', 2, 4602, 0 },
+    { 'l', 2, 4604, 0 },
+    { 'n', 1, 4606, 0 },
+    { 'p', 1, 4607, 0 },
+    { 'r', 1, 4608, 0 },
+    { 'r', 1, 4609, 0 },
+    { 'l', 1, 4610, 0 },
+    { 's', 1, 4611, 0 },
+    { 'p', 1, 4612, 0 },
+    { 'd', 1, 4613, 0 },
+    { 'l', 1, 4614, 0 },
+    { ';', 0, 0, 253 },
+    { 'e', 2, 4615, 0 },
+    { 't', 1, 4617, 0 },
+    { ';', 0, 0, 254 },
+    { 'b', 2, 4618, 0 },
+    { 'f', 1, 4620, 0 },
+    { 'd', 1, 4621, 0 },
+    { 'r', 1, 4622, 0 },
+    { 'a', 1, 4623, 0 },
+    { 'u', 1, 4624, 0 },
+    { 'u', 2, 4625, 0 },
+    { ';', 0, 0, 255 },
+    { 'a', 1, 4627, 0 },
+    { 'f', 1, 4628, 0 },
+    { 'r', 1, 4629, 0 },
+    { 'r', 1, 4630, 0 },
+    { 't', 1, 4631, 0 },
+    { 'i', 1, 4632, 0 },
+    { 'a', 1, 4633, 0 },
+    { 'r', 2, 4634, 0 },
+    { 'a', 1, 4636, 0 },
+    { 'n', 1, 4637, 0 },
+    { ';', 0, 0, 256 },
+    { 'E', 1, 4638, 0 },
+    { 'd', 1, 4639, 0 },
+    { 'e', 2, 4640, 0 },
+    { 'm', 1, 4642, 0 },
+    { 'n', 2, 4643, 0 },
+    { 'p', 1, 4645, 0 },
+    { 'r', 1, 4646, 0 },
+    { 's', 3, 4647, 0 },
+    { 'c', 6, 4650, 0 },
+    { ';', 0, 0, 114 },
+    { 'g', 1, 4656, 0 },
+    { '1', 1, 4657, 257 },
+    { '2', 1, 4658, 258 },
+    { '3', 1, 4659, 259 },
+    { ';', 0, 0, 260 },
+    { 'E', 1, 4660, 0 },
+    { 'd', 2, 4661, 0 },
+    { 'e', 2, 4663, 0 },
+    { 'h', 1, 4665, 0 },
+    { 'l', 1, 4666, 0 },
+    { 'm', 1, 4667, 0 },
+    { 'n', 2, 4668, 0 },
+    { 'p', 1, 4670, 0 },
+    { 's', 3, 4671, 0 },
+    { 'r', 1, 4674, 0 },
+    { 'r', 2, 4675, 0 },
+    { 'w', 1, 4677, 0 },
+    { 'i', 1, 4678, 0 },
+    { 'g', 1, 4679, 0 },
+    { ';', 0, 0, 261 },
+    { 'k', 1, 4680, 0 },
+    { 'r', 1, 4681, 0 },
+    { 'd', 1, 4682, 0 },
+    { ';', 0, 0, 262 },
+    { 't', 1, 4683, 0 },
+    { 'r', 1, 4684, 0 },
+    { ';', 0, 0, 263 },
+    { 'r', 1, 4685, 0 },
+    { 't', 1, 4686, 0 },
+    { 'c', 1, 4687, 0 },
+    { 'n', 1, 4688, 0 },
+    { 'a', 1, 4689, 0 },
+    { 's', 1, 4690, 0 },
+    { 'r', 1, 4691, 0 },
+    { 'd', 1, 4692, 0 },
+    { 'e', 1, 4693, 0 },
+    { 't', 1, 4694, 0 },
+    { 'a', 1, 4695, 0 },
+    { ';', 0, 0, 264 },
+    { 'b', 1, 4696, 0 },
+    { 'c', 1, 4697, 0 },
+    { 'f', 2, 4698, 0 },
+    { 'a', 1, 4700, 0 },
+    { 'i', 1, 4701, 0 },
+    { 'd', 1, 4702, 0 },
+    { 'a', 1, 4703, 0 },
+    { 'd', 1, 4704, 0 },
+    { 'e', 1, 4705, 0 },
+    { 'm', 1, 4706, 0 },
+    { 'p', 1, 4707, 0 },
+    { 's', 1, 4708, 0 },
+    { 't', 1, 4709, 0 },
+    { 'e', 1, 4710, 0 },
+    { 'r', 1, 4711, 0 },
+    { 'y', 1, 4712, 0 },
+    { 'c', 1, 4713, 0 },
+    { 'r', 1, 4714, 0 },
+    { 'x', 1, 4715, 0 },
+    { 'h', 1, 4716, 0 },
+    { 'r', 1, 4717, 0 },
+    { 'r', 1, 4718, 0 },
+    { 'u', 1, 4719, 0 },
+    { 'r', 1, 4720, 0 },
+    { 'c', 1, 4721, 0 },
+    { 'e', 1, 4722, 0 },
+    { 'r', 1, 4723, 0 },
+    { ';', 0, 0, 265 },
+    { 'r', 1, 4724, 0 },
+    { 'l', 1, 4725, 0 },
+    { 'a', 1, 4726, 0 },
+    { 's', 1, 4727, 0 },
+    { ';', 0, 0, 266 },
+    { 'a', 1, 4728, 0 },
+    { 'r', 2, 4729, 0 },
+    { 'l', 1, 4731, 0 },
+    { 'o', 1, 4732, 0 },
+    { 'r', 1, 4733, 0 },
+    { 'r', 1, 4734, 0 },
+    { 'c', 1, 4735, 0 },
+    { ';', 0, 0, 53 },
+    { 'o', 1, 4736, 0 },
+    { 'f', 1, 4737, 0 },
+    { 'r', 1, 4738, 0 },
+    { 'o', 1, 4739, 0 },
+    { 'a', 1, 4740, 0 },
+    { 'u', 1, 4741, 0 },
+    { 'i', 3, 4742, 0 },
+    { 'p', 1, 4745, 0 },
+    { 'o', 1, 4746, 0 },
+    { 'r', 1, 4747, 0 },
+    { 'n', 1, 4748, 0 },
+    { 'r', 1, 4749, 0 },
+    { 'r', 1, 4750, 0 },
+    { 'o', 1, 4751, 0 },
+    { 'l', 1, 4752, 0 },
+    { 'i', 2, 4753, 0 },
+    { 'r', 1, 4755, 0 },
+    { 'l', 1, 4756, 267 },
+    { 'n', 1, 4757, 0 },
+    { 'r', 1, 4758, 0 },
+    { 'r', 2, 4759, 0 },
+    { 's', 1, 4761, 0 },
+    { 'g', 1, 4762, 0 },
+    { 'e', 1, 4763, 0 },
+    { 'k', 1, 4764, 0 },
+    { 'n', 1, 4765, 0 },
+    { 'p', 3, 4766, 0 },
+    { 'r', 2, 4769, 0 },
+    { 's', 2, 4771, 0 },
+    { 't', 2, 4773, 0 },
+    { ';', 0, 0, 268 },
+    { 's', 1, 4775, 0 },
+    { ';', 0, 0, 46 },
+    { 'b', 1, 4776, 0 },
+    { 'e', 1, 4777, 0 },
+    { 'l', 1, 4778, 0 },
+    { 'b', 1, 4779, 0 },
+    { 't', 1, 4780, 0 },
+    { ';', 0, 0, 269 },
+    { 'r', 1, 4781, 0 },
+    { 'u', 2, 4782, 0 },
+    { 'f', 1, 4784, 0 },
+    { 'o', 1, 4785, 0 },
+    { 'r', 1, 4786, 0 },
+    { 'r', 1, 4787, 0 },
+    { 'b', 1, 4788, 0 },
+    { 'p', 1, 4789, 0 },
+    { 'g', 1, 4790, 0 },
+    { 'r', 1, 4791, 0 },
+    { 'b', 1, 4792, 0 },
+    { 'g', 1, 4793, 0 },
+    { 'e', 1, 4794, 0 },
+    { ';', 0, 0, 270 },
+    { 'f', 1, 4795, 0 },
+    { 'a', 1, 4796, 0 },
+    { 'r', 1, 4797, 0 },
+    { 'p', 1, 4798, 0 },
+    { 'r', 1, 4799, 0 },
+    { 'p', 1, 4800, 0 },
+    { 'r', 1, 4801, 0 },
+    { ';', 0, 0, 271 },
+    { 'r', 1, 4802, 0 },
+    { 'r', 1, 4803, 0 },
+    { 'r', 1, 4804, 0 },
+    { 'r', 1, 4805, 0 },
+    { 'p', 1, 4806, 0 },
+    { 's', 1, 4807, 0 },
+    { 'o', 1, 4808, 0 },
+    { 'f', 1, 4809, 0 },
+    { 'l', 1, 4810, 0 },
+    { 'i', 1, 4811, 0 },
+    { 'r', 1, 4812, 0 },
+    { 'r', 1, 4813, 0 },
+    { 'r', 1, 4814, 0 },
+    { 'c', 1, 4815, 0 },
+    { 'l', 1, 4816, 0 },
+    { 'r', 1, 4817, 0 },
+    { 'e', 1, 4818, 0 },
+    { 'd', 1, 4819, 0 },
+    { 'u', 1, 4820, 0 },
+    { 'y', 1, 4821, 0 },
+    { 'r', 1, 4822, 0 },
+    { ';', 0, 0, 272 },
+    { ';', 0, 0, 57 },
+    { ';', 0, 0, 273 },
+    { 'y', 1, 4823, 0 },
+    { 'f', 1, 4824, 0 },
+    { 'r', 1, 4825, 0 },
+    { 'y', 1, 4826, 0 },
+    { 'l', 1, 4827, 274 },
+    { 'u', 1, 4828, 0 },
+    { 'r', 1, 4829, 0 },
+    { ';', 0, 0, 275 },
+    { 't', 1, 4830, 0 },
+    { 't', 1, 4831, 0 },
+    { 'a', 1, 4832, 0 },
+    { ';', 0, 0, 276 },
+    { 'y', 1, 4833, 0 },
+    { 'r', 1, 4834, 0 },
+    { 'f', 1, 4835, 0 },
+    { 'r', 1, 4836, 0 },
+    { ';', 0, 0, 277 },
+    { 'j', 1, 4837, 0 },
+    { 'g', 1, 4838, 278 },
+    { 't', 1, 4839, 0 },
+    { 'v', 1, 4840, 0 },
+    { 'c', 1, 4841, 279 },
+    { 'v', 1, 4842, 0 },
+    { 'a', 1, 4843, 0 },
+    { 'r', 1, 4844, 0 },
+    { 'n', 1, 4845, 0 },
+    { ';', 0, 0, 280 },
+    { 'y', 1, 4846, 0 },
+    { 'g', 1, 4847, 281 },
+    { ';', 0, 0, 282 },
+    { 'g', 1, 4848, 0 },
+    { 'd', 1, 4849, 0 },
+    { ';', 0, 0, 61 },
+    { 's', 1, 4850, 0 },
+    { ';', 0, 0, 283 },
+    { 'e', 1, 4851, 0 },
+    { 'u', 1, 4852, 0 },
+    { 'o', 1, 4853, 0 },
+    { ';', 0, 0, 284 },
+    { ';', 0, 0, 285 },
+    { 'e', 1, 4854, 0 },
+    { ';', 0, 0, 286 },
+    { 'e', 1, 4855, 0 },
+    { ';', 0, 0, 287 },
+    { ';', 0, 0, 64 },
+    { 't', 1, 4856, 0 },
+    { 't', 1, 4857, 0 },
+    { 'e', 1, 4858, 0 },
+    { 'o', 1, 4859, 0 },
+    { 'i', 1, 4860, 0 },
+    { 'c', 1, 4861, 0 },
+    { 'i', 1, 4862, 0 },
+    { ';', 0, 0, 288 },
+    { 'l', 1, 4863, 0 },
+    { 'e', 1, 4864, 0 },
+    { 'l', 1, 4865, 0 },
+    { 'k', 1, 4866, 0 },
+    { 'e', 1, 4867, 0 },
+    { 'n', 2, 4868, 0 },
+    { 'r', 1, 4870, 0 },
+    { 'n', 1, 4871, 0 },
+    { 'o', 1, 4872, 0 },
+    { ';', 0, 0, 289 },
+    { 'o', 1, 4873, 0 },
+    { 't', 1, 4874, 0 },
+    { 's', 1, 4875, 0 },
+    { ';', 0, 0, 290 },
+    { 'a', 1, 4876, 0 },
+    { 'r', 1, 4877, 0 },
+    { ';', 0, 0, 291 },
+    { ';', 0, 0, 292 },
+    { ';', 0, 0, 293 },
+    { 'e', 1, 4878, 0 },
+    { ';', 0, 0, 294 },
+    { 'v', 1, 4879, 0 },
+    { 'o', 1, 4880, 0 },
+    { 'a', 1, 4881, 0 },
+    { 'r', 1, 4882, 0 },
+    { 'o', 1, 4883, 0 },
+    { 'e', 1, 4884, 0 },
+    { ';', 0, 0, 295 },
+    { 'o', 1, 4885, 0 },
+    { 'q', 1, 4886, 0 },
+    { 'l', 1, 4887, 0 },
+    { 'A', 1, 4888, 0 },
+    { 'B', 1, 4889, 0 },
+    { 'L', 1, 4890, 0 },
+    { 'R', 1, 4891, 0 },
+    { 'T', 1, 4892, 0 },
+    { 'a', 1, 4893, 0 },
+    { ';', 0, 0, 296 },
+    { 'o', 1, 4894, 0 },
+    { 't', 1, 4895, 0 },
+    { 'o', 1, 4896, 0 },
+    { 'c', 1, 4897, 297 },
+    { ';', 0, 0, 298 },
+    { 'v', 1, 4898, 0 },
+    { 'e', 1, 4899, 0 },
+    { 'r', 1, 4900, 0 },
+    { 'y', 2, 4901, 0 },
+    { 'n', 1, 4903, 0 },
+    { ';', 0, 0, 299 },
+    { 'l', 1, 4904, 0 },
+    { 'l', 2, 4905, 0 },
+    { 'l', 1, 4907, 0 },
+    { ';', 0, 0, 300 },
+    { ';', 0, 0, 301 },
+    { ';', 0, 0, 76 },
+    { 't', 1, 4908, 0 },
+    { 'n', 1, 4909, 0 },
+    { 'e', 1, 4910, 0 },
+    { ';', 0, 0, 302 },
+    { 'l', 1, 4911, 0 },
+    { 'i', 1, 4912, 0 },
+    { ';', 0, 0, 303 },
+    { ';', 0, 0, 304 },
+    { 'a', 2, 4913, 0 },
+    { 'v', 1, 4915, 0 },
+    { 'i', 1, 4916, 0 },
+    { 'c', 1, 4917, 0 },
+    { ';', 0, 0, 305 },
+    { ';', 0, 0, 306 },
+    { 't', 1, 4918, 0 },
+    { ';', 0, 0, 307 },
+    { 'c', 1, 4919, 0 },
+    { 'k', 1, 4920, 0 },
+    { 'c', 1, 4921, 0 },
+    { 'e', 1, 4922, 0 },
+    { ';', 0, 0, 308 },
+    { 'z', 1, 4923, 0 },
+    { ';', 0, 0, 309 },
+    { 'o', 1, 4924, 0 },
+    { 'D', 1, 4925, 0 },
+    { 'E', 1, 4926, 0 },
+    { ';', 0, 0, 310 },
+    { 'g', 1, 4927, 0 },
+    { ';', 0, 0, 311 },
+    { 't', 1, 4928, 0 },
+    { 'c', 1, 4929, 312 },
+    { ';', 0, 0, 313 },
+    { 'v', 1, 4930, 0 },
+    { 'r', 1, 4931, 0 },
+    { 'i', 1, 4932, 0 },
+    { 'i', 1, 4933, 0 },
+    { 'g', 1, 4934, 0 },
+    { 'r', 1, 4935, 0 },
+    { 's', 1, 4936, 0 },
+    { 'n', 1, 4937, 0 },
+    { ';', 0, 0, 314 },
+    { ';', 0, 0, 315 },
+    { ';', 0, 0, 316 },
+    { 'd', 1, 4938, 0 },
+    { 'y', 1, 4939, 0 },
+    { ';', 0, 0, 85 },
+    { 'c', 1, 4940, 0 },
+    { ';', 0, 0, 317 },
+    { ';', 0, 0, 318 },
+    { 'c', 1, 4941, 0 },
+    { 'y', 1, 4942, 0 },
+    { ';', 0, 0, 319 },
+    { ';', 0, 0, 320 },
+    { 'a', 1, 4943, 0 },
+    { 'i', 1, 4944, 0 },
+    { ';', 0, 0, 321 },
+    { ';', 0, 0, 322 },
+    { ';', 0, 0, 323 },
+    { 't', 1, 4945, 0 },
+    { 'd', 1, 4946, 0 },
+    { ';', 0, 0, 324 },
+    { 'a', 1, 4947, 0 },
+    { ';', 0, 0, 325 },
+    { 'o', 1, 4948, 0 },
+    { 'i', 1, 4949, 0 },
+    { 'A', 2, 4950, 0 },
+    { 'C', 1, 4952, 0 },
+    { 'D', 1, 4953, 0 },
+    { 'F', 1, 4954, 0 },
+    { 'R', 1, 4955, 0 },
+    { 'T', 2, 4956, 0 },
+    { 'U', 1, 4958, 0 },
+    { 'V', 1, 4959, 0 },
+    { 'a', 1, 4960, 0 },
+    { 'r', 1, 4961, 0 },
+    { 'E', 1, 4962, 0 },
+    { 'F', 1, 4963, 0 },
+    { 'G', 1, 4964, 0 },
+    { 'L', 1, 4965, 0 },
+    { 'S', 1, 4966, 0 },
+    { 'T', 1, 4967, 0 },
+    { 't', 1, 4968, 0 },
+    { 'o', 1, 4969, 0 },
+    { 'L', 1, 4970, 0 },
+    { 'R', 1, 4971, 0 },
+    { 'l', 1, 4972, 0 },
+    { 'r', 1, 4973, 0 },
+    { ';', 0, 0, 326 },
+    { 'r', 2, 4974, 0 },
+    { ';', 0, 0, 327 },
+    { 'o', 1, 4976, 0 },
+    { 'u', 1, 4977, 0 },
+    { 'i', 1, 4978, 0 },
+    { 's', 1, 4979, 0 },
+    { ';', 0, 0, 328 },
+    { ';', 0, 0, 329 },
+    { ';', 0, 0, 330 },
+    { 't', 1, 4980, 0 },
+    { 'o', 1, 4981, 0 },
+    { 'i', 1, 4982, 0 },
+    { 't', 1, 4983, 0 },
+    { 'e', 1, 4984, 0 },
+    { 'i', 1, 4985, 0 },
+    { 'e', 1, 4986, 0 },
+    { 'r', 1, 4987, 0 },
+    { ';', 0, 0, 331 },
+    { 'o', 1, 4988, 0 },
+    { 'u', 1, 4989, 0 },
+    { 'o', 1, 4990, 0 },
+    { 'l', 1, 4991, 0 },
+    { 'q', 1, 4992, 0 },
+    { 'x', 1, 4993, 0 },
+    { 'r', 1, 4994, 0 },
+    { 'u', 1, 4995, 0 },
+    { 'e', 2, 4996, 0 },
+    { 'e', 1, 4998, 0 },
+    { 'r', 1, 4999, 0 },
+    { 'e', 1, 5000, 0 },
+    { 'i', 1, 5001, 0 },
+    { 'q', 1, 5002, 0 },
+    { 'u', 3, 5003, 0 },
+    { 'i', 1, 5006, 0 },
+    { 'e', 1, 5007, 0 },
+    { ';', 0, 0, 332 },
+    { 'd', 1, 5008, 0 },
+    { 'g', 1, 5009, 0 },
+    { 't', 1, 5010, 0 },
+    { 'c', 1, 5011, 333 },
+    { 'a', 1, 5012, 0 },
+    { 'v', 1, 5013, 0 },
+    { 'r', 1, 5014, 0 },
+    { 'a', 1, 5015, 0 },
+    { 'r', 1, 5016, 0 },
+    { ';', 0, 0, 334 },
+    { 'C', 1, 5017, 0 },
+    { ';', 0, 0, 335 },
+    { 's', 1, 5018, 0 },
+    { 'd', 1, 5019, 0 },
+    { 'e', 1, 5020, 0 },
+    { ';', 0, 0, 101 },
+    { 'B', 2, 5021, 0 },
+    { 'P', 1, 5023, 0 },
+    { 'i', 1, 5024, 0 },
+    { 'M', 1, 5025, 0 },
+    { 'c', 1, 5026, 0 },
+    { ';', 0, 0, 336 },
+    { 'e', 1, 5027, 0 },
+    { 'e', 1, 5028, 0 },
+    { 'u', 1, 5029, 0 },
+    { 'o', 1, 5030, 0 },
+    { ';', 0, 0, 337 },
+    { ';', 0, 0, 106 },
+    { ';', 0, 0, 338 },
+    { ';', 0, 0, 339 },
+    { 'r', 1, 5031, 0 },
+    { 't', 1, 5032, 0 },
+    { ';', 0, 0, 340 },
+    { ';', 0, 0, 341 },
+    { 't', 1, 5033, 0 },
+    { 'o', 1, 5034, 0 },
+    { 'i', 1, 5035, 0 },
+    { 'r', 1, 5036, 0 },
+    { 't', 8, 5037, 0 },
+    { ';', 0, 0, 342 },
+    { 'd', 1, 5045, 0 },
+    { 'h', 1, 5046, 0 },
+    { ';', 0, 0, 343 },
+    { 'D', 1, 5047, 0 },
+    { 'c', 1, 5048, 0 },
+    { ';', 0, 0, 344 },
+    { 'c', 1, 5049, 0 },
+    { 't', 1, 5050, 0 },
+    { 'o', 1, 5051, 0 },
+    { 'i', 1, 5052, 0 },
+    { 'c', 1, 5053, 0 },
+    { 't', 4, 5054, 0 },
+    { 'a', 1, 5058, 0 },
+    { 'l', 1, 5059, 0 },
+    { ';', 0, 0, 345 },
+    { ';', 0, 0, 346 },
+    { 'r', 1, 5060, 0 },
+    { ';', 0, 0, 347 },
+    { ';', 0, 0, 348 },
+    { 'e', 1, 5061, 0 },
+    { 'e', 1, 5062, 0 },
+    { 'T', 1, 5063, 0 },
+    { 'r', 1, 5064, 0 },
+    { 'e', 1, 5065, 0 },
+    { 'N', 1, 5066, 349 },
+    { 'E', 1, 5067, 0 },
+    { 'y', 1, 5068, 0 },
+    { ';', 0, 0, 350 },
+    { 'o', 1, 5069, 0 },
+    { 'i', 1, 5070, 0 },
+    { 'e', 1, 5071, 0 },
+    { 'a', 1, 5072, 0 },
+    { 'k', 1, 5073, 0 },
+    { 'S', 1, 5074, 0 },
+    { 'e', 4, 5075, 0 },
+    { ';', 0, 0, 351 },
+    { 'l', 1, 5079, 0 },
+    { ';', 0, 0, 352 },
+    { 'o', 1, 5080, 0 },
+    { 't', 1, 5081, 0 },
+    { ';', 0, 0, 353 },
+    { 'o', 1, 5082, 0 },
+    { 'y', 1, 5083, 0 },
+    { 'v', 1, 5084, 0 },
+    { 'c', 1, 5085, 354 },
+    { 'a', 1, 5086, 0 },
+    { 'v', 1, 5087, 0 },
+    { 'r', 1, 5088, 0 },
+    { 'r', 2, 5089, 0 },
+    { 'n', 2, 5091, 0 },
+    { 'n', 1, 5093, 0 },
+    { ';', 0, 0, 355 },
+    { 'r', 1, 5094, 0 },
+    { 'w', 1, 5095, 0 },
+    { 'u', 1, 5096, 0 },
+    { 'e', 2, 5097, 0 },
+    { 'r', 1, 5099, 0 },
+    { 'w', 1, 5100, 0 },
+    { 'r', 2, 5101, 0 },
+    { ';', 0, 0, 356 },
+    { 'l', 1, 5103, 0 },
+    { 'g', 1, 5104, 0 },
+    { ';', 0, 0, 357 },
+    { 'd', 1, 5105, 0 },
+    { ';', 0, 0, 122 },
+    { 'h', 1, 5106, 0 },
+    { ';', 0, 0, 358 },
+    { 'h', 2, 5107, 0 },
+    { 'a', 1, 5109, 0 },
+    { ';', 0, 0, 359 },
+    { 'i', 1, 5110, 0 },
+    { 'T', 1, 5111, 0 },
+    { ';', 0, 0, 360 },
+    { ';', 0, 0, 361 },
+    { 's', 1, 5112, 0 },
+    { 'c', 1, 5113, 0 },
+    { 'e', 1, 5114, 0 },
+    { ';', 0, 0, 362 },
+    { ';', 0, 0, 363 },
+    { ';', 0, 0, 364 },
+    { ';', 0, 0, 365 },
+    { ';', 0, 0, 366 },
+    { ';', 0, 0, 367 },
+    { ';', 0, 0, 368 },
+    { 't', 1, 5115, 0 },
+    { 'c', 1, 5116, 0 },
+    { ';', 0, 0, 369 },
+    { ';', 0, 0, 370 },
+    { ';', 0, 0, 371 },
+    { ';', 0, 0, 372 },
+    { 't', 1, 5117, 0 },
+    { 'o', 1, 5118, 0 },
+    { ';', 0, 0, 373 },
+    { 'W', 1, 5119, 0 },
+    { ';', 0, 0, 374 },
+    { ';', 0, 0, 375 },
+    { ';', 0, 0, 376 },
+    { 't', 1, 5120, 0 },
+    { 'v', 1, 5121, 0 },
+    { 'c', 1, 5122, 377 },
+    { 'e', 1, 5123, 378 },
+    { 'g', 1, 5124, 379 },
+    { 'v', 1, 5125, 0 },
+    { 's', 1, 5126, 0 },
+    { 'h', 1, 5127, 0 },
+    { 'a', 1, 5128, 0 },
+    { 'r', 1, 5129, 0 },
+    { 'g', 1, 5130, 0 },
+    { 'n', 1, 5131, 0 },
+    { ';', 0, 0, 380 },
+    { 'l', 1, 5132, 0 },
+    { ';', 0, 0, 381 },
+    { ';', 0, 0, 382 },
+    { 'e', 1, 5133, 0 },
+    { 's', 1, 5134, 0 },
+    { 't', 2, 5135, 0 },
+    { 'p', 1, 5137, 0 },
+    { 't', 1, 5138, 0 },
+    { 'a', 1, 5139, 0 },
+    { 'n', 1, 5140, 0 },
+    { ';', 0, 0, 383 },
+    { 'i', 1, 5141, 0 },
+    { ';', 0, 0, 384 },
+    { ';', 0, 0, 385 },
+    { 'o', 1, 5142, 0 },
+    { 'g', 1, 5143, 386 },
+    { ';', 0, 0, 387 },
+    { 'p', 2, 5144, 0 },
+    { 'd', 1, 5146, 0 },
+    { ';', 0, 0, 141 },
+    { 'n', 1, 5147, 0 },
+    { 't', 1, 5148, 0 },
+    { ';', 0, 0, 388 },
+    { 'c', 1, 5149, 0 },
+    { 'e', 1, 5150, 0 },
+    { 'p', 1, 5151, 0 },
+    { 's', 1, 5152, 0 },
+    { 'e', 1, 5153, 0 },
+    { 'e', 1, 5154, 0 },
+    { ';', 0, 0, 389 },
+    { 't', 1, 5155, 0 },
+    { 'g', 1, 5156, 0 },
+    { 'o', 1, 5157, 0 },
+    { 'u', 1, 5158, 0 },
+    { 't', 1, 5159, 0 },
+    { 'i', 1, 5160, 0 },
+    { 'o', 1, 5161, 0 },
+    { ';', 0, 0, 390 },
+    { ';', 0, 0, 391 },
+    { 'e', 1, 5162, 0 },
+    { 'a', 1, 5163, 0 },
+    { 'i', 1, 5164, 0 },
+    { 'u', 1, 5165, 0 },
+    { 'd', 1, 5166, 0 },
+    { 'p', 1, 5167, 0 },
+    { 't', 1, 5168, 0 },
+    { 'q', 1, 5169, 0 },
+    { 't', 1, 5170, 0 },
+    { 'r', 1, 5171, 0 },
+    { 'p', 1, 5172, 0 },
+    { 'e', 1, 5173, 0 },
+    { 'e', 1, 5174, 0 },
+    { 'o', 1, 5175, 0 },
+    { 'k', 3, 5176, 0 },
+    { 'k', 1, 5179, 0 },
+    { '2', 1, 5180, 0 },
+    { '4', 1, 5181, 0 },
+    { '4', 1, 5182, 0 },
+    { 'k', 1, 5183, 0 },
+    { 'u', 1, 5184, 0 },
+    { ';', 0, 0, 392 },
+    { ';', 0, 0, 393 },
+    { 'o', 1, 5185, 0 },
+    { 'i', 1, 5186, 0 },
+    { 'L', 1, 5187, 0 },
+    { 'R', 1, 5188, 0 },
+    { 'l', 1, 5189, 0 },
+    { 'r', 1, 5190, 0 },
+    { ';', 0, 0, 394 },
+    { 'D', 1, 5191, 0 },
+    { 'U', 1, 5192, 0 },
+    { 'd', 1, 5193, 0 },
+    { 'u', 1, 5194, 0 },
+    { 'L', 1, 5195, 0 },
+    { 'R', 1, 5196, 0 },
+    { 'l', 1, 5197, 0 },
+    { 'r', 1, 5198, 0 },
+    { ';', 0, 0, 395 },
+    { 'H', 1, 5199, 0 },
+    { 'L', 1, 5200, 0 },
+    { 'R', 1, 5201, 0 },
+    { 'h', 1, 5202, 0 },
+    { 'l', 1, 5203, 0 },
+    { 'r', 1, 5204, 0 },
+    { 'o', 1, 5205, 0 },
+    { 'L', 1, 5206, 0 },
+    { 'R', 1, 5207, 0 },
+    { 'l', 1, 5208, 0 },
+    { 'r', 1, 5209, 0 },
+    { ';', 0, 0, 396 },
+    { 'D', 1, 5210, 0 },
+    { 'U', 1, 5211, 0 },
+    { 'd', 1, 5212, 0 },
+    { 'u', 1, 5213, 0 },
+    { 'i', 1, 5214, 0 },
+    { 'l', 1, 5215, 0 },
+    { 'i', 1, 5216, 0 },
+    { 'L', 1, 5217, 0 },
+    { 'R', 1, 5218, 0 },
+    { 'l', 1, 5219, 0 },
+    { 'r', 1, 5220, 0 },
+    { ';', 0, 0, 397 },
+    { 'H', 1, 5221, 0 },
+    { 'L', 1, 5222, 0 },
+    { 'R', 1, 5223, 0 },
+    { 'h', 1, 5224, 0 },
+    { 'l', 1, 5225, 0 },
+    { 'r', 1, 5226, 0 },
+    { 'm', 1, 5227, 0 },
+    { 'e', 1, 5228, 0 },
+    { 'a', 1, 5229, 0 },
+    { ';', 0, 0, 398 },
+    { 'i', 1, 5230, 0 },
+    { ';', 0, 0, 399 },
+    { 'e', 1, 5231, 0 },
+    { ';', 0, 0, 400 },
+    { 'b', 1, 5232, 0 },
+    { 'h', 1, 5233, 0 },
+    { ';', 0, 0, 401 },
+    { 'e', 1, 5234, 0 },
+    { ';', 0, 0, 402 },
+    { 'E', 1, 5235, 0 },
+    { 'e', 2, 5236, 0 },
+    { 't', 1, 5238, 0 },
+    { 'n', 1, 5239, 0 },
+    { 'r', 1, 5240, 0 },
+    { 'a', 1, 5241, 0 },
+    { 'u', 1, 5242, 0 },
+    { 'o', 1, 5243, 0 },
+    { ';', 0, 0, 403 },
+    { 't', 1, 5244, 0 },
+    { 'n', 1, 5245, 0 },
+    { 's', 1, 5246, 0 },
+    { 'o', 1, 5247, 0 },
+    { 'i', 1, 5248, 0 },
+    { 'c', 1, 5249, 0 },
+    { 's', 2, 5250, 0 },
+    { ';', 0, 0, 404 },
+    { 'l', 1, 5252, 405 },
+    { 't', 1, 5253, 0 },
+    { ';', 0, 0, 147 },
+    { 'e', 1, 5254, 0 },
+    { ';', 0, 0, 406 },
+    { 'k', 2, 5255, 0 },
+    { ';', 0, 0, 407 },
+    { ';', 0, 0, 408 },
+    { 'e', 1, 5257, 0 },
+    { 'l', 1, 5258, 0 },
+    { ';', 0, 0, 409 },
+    { 'n', 1, 5259, 0 },
+    { 'i', 1, 5260, 0 },
+    { 'c', 1, 5261, 0 },
+    { 's', 2, 5262, 0 },
+    { 'n', 2, 5264, 0 },
+    { 'a', 2, 5266, 0 },
+    { ';', 0, 0, 410 },
+    { 'f', 1, 5268, 0 },
+    { 'l', 1, 5269, 0 },
+    { ';', 0, 0, 411 },
+    { 'd', 1, 5270, 0 },
+    { 'n', 1, 5271, 0 },
+    { ';', 0, 0, 412 },
+    { 'o', 1, 5272, 0 },
+    { ';', 0, 0, 64 },
+    { 's', 1, 5273, 0 },
+    { 'r', 1, 5274, 0 },
+    { 's', 1, 5275, 0 },
+    { ';', 0, 0, 413 },
+    { ';', 0, 0, 414 },
+    { 'e', 1, 5276, 0 },
+    { ';', 0, 0, 415 },
+    { 'e', 1, 5277, 0 },
+    { 't', 1, 5278, 0 },
+    { 'r', 1, 5279, 0 },
+    { 'r', 1, 5280, 0 },
+    { 'c', 1, 5281, 0 },
+    { 'r', 1, 5282, 0 },
+    { 'r', 1, 5283, 0 },
+    { 'a', 1, 5284, 0 },
+    { 'u', 1, 5285, 0 },
+    { 'o', 1, 5286, 0 },
+    { 'r', 1, 5287, 0 },
+    { ';', 0, 0, 416 },
+    { 'r', 1, 5288, 0 },
+    { 'y', 3, 5289, 0 },
+    { 'e', 1, 5292, 0 },
+    { 'e', 1, 5293, 0 },
+    { 'e', 1, 5294, 0 },
+    { 'd', 1, 5295, 0 },
+    { 'n', 1, 5296, 0 },
+    { 't', 1, 5297, 0 },
+    { 't', 1, 5298, 0 },
+    { ';', 0, 0, 417 },
+    { ';', 0, 0, 418 },
+    { 'e', 1, 5299, 0 },
+    { 't', 1, 5300, 0 },
+    { ';', 0, 0, 419 },
+    { ';', 0, 0, 420 },
+    { 'v', 1, 5301, 0 },
+    { 'r', 1, 5302, 0 },
+    { 'c', 1, 5303, 0 },
+    { 'o', 1, 5304, 0 },
+    { 'g', 1, 5305, 0 },
+    { 'r', 1, 5306, 0 },
+    { 's', 1, 5307, 0 },
+    { 'a', 1, 5308, 0 },
+    { 't', 1, 5309, 0 },
+    { 'h', 1, 5310, 0 },
+    { 'l', 1, 5311, 0 },
+    { 'r', 1, 5312, 0 },
+    { ';', 0, 0, 421 },
+    { 'o', 1, 5313, 0 },
+    { 's', 1, 5314, 0 },
+    { 'm', 1, 5315, 0 },
+    { 'n', 1, 5316, 0 },
+    { 'd', 1, 5317, 0 },
+    { 'n', 1, 5318, 0 },
+    { ';', 0, 0, 422 },
+    { 'r', 1, 5319, 0 },
+    { 'o', 1, 5320, 0 },
+    { 'a', 1, 5321, 0 },
+    { ';', 0, 0, 423 },
+    { 'q', 2, 5322, 0 },
+    { 'i', 1, 5324, 0 },
+    { 'l', 1, 5325, 0 },
+    { 'q', 1, 5326, 0 },
+    { 'l', 1, 5327, 0 },
+    { 'a', 1, 5328, 0 },
+    { 'd', 1, 5329, 0 },
+    { 'h', 1, 5330, 0 },
+    { 'a', 1, 5331, 0 },
+    { 'r', 1, 5332, 0 },
+    { 'o', 1, 5333, 0 },
+    { ';', 0, 0, 424 },
+    { ';', 0, 0, 425 },
+    { ';', 0, 0, 426 },
+    { 'o', 1, 5334, 0 },
+    { 't', 1, 5335, 0 },
+    { ';', 0, 0, 427 },
+    { 'f', 1, 5336, 0 },
+    { 'r', 1, 5337, 0 },
+    { 'r', 1, 5338, 0 },
+    { 'g', 1, 5339, 0 },
+    { ';', 0, 0, 428 },
+    { 'r', 1, 5340, 0 },
+    { 't', 1, 5341, 0 },
+    { ';', 0, 0, 429 },
+    { 't', 1, 5342, 0 },
+    { 'e', 1, 5343, 0 },
+    { 'o', 1, 5344, 0 },
+    { ';', 0, 0, 430 },
+    { 'c', 1, 5345, 431 },
+    { 'o', 1, 5346, 0 },
+    { ';', 0, 0, 432 },
+    { 't', 1, 5347, 0 },
+    { 'v', 1, 5348, 0 },
+    { 'o', 1, 5349, 0 },
+    { 't', 1, 5350, 0 },
+    { 'o', 1, 5351, 0 },
+    { 'r', 1, 5352, 0 },
+    { 'y', 3, 5353, 0 },
+    { '1', 2, 5356, 0 },
+    { ';', 0, 0, 433 },
+    { ';', 0, 0, 434 },
+    { 'n', 1, 5358, 0 },
+    { ';', 0, 0, 435 },
+    { ';', 0, 0, 436 },
+    { 's', 1, 5359, 0 },
+    { 's', 1, 5360, 0 },
+    { ';', 0, 0, 437 },
+    { 'l', 1, 5361, 0 },
+    { 'v', 1, 5362, 0 },
+    { 'r', 1, 5363, 0 },
+    { 'l', 1, 5364, 0 },
+    { 'm', 1, 5365, 0 },
+    { 'a', 1, 5366, 0 },
+    { 'l', 1, 5367, 0 },
+    { 's', 1, 5368, 0 },
+    { 'v', 2, 5369, 0 },
+    { 'a', 1, 5371, 0 },
+    { 't', 1, 5372, 0 },
+    { 'r', 1, 5373, 0 },
+    { ';', 0, 0, 438 },
+    { 't', 1, 5374, 0 },
+    { ';', 0, 0, 439 },
+    { ';', 0, 0, 163 },
+    { ';', 0, 0, 440 },
+    { ';', 0, 0, 441 },
+    { 't', 1, 5375, 0 },
+    { 'c', 1, 5376, 0 },
+    { 'n', 1, 5377, 0 },
+    { 'i', 1, 5378, 0 },
+    { 'l', 1, 5379, 0 },
+    { 'i', 1, 5380, 0 },
+    { 'g', 1, 5381, 0 },
+    { 'i', 1, 5382, 0 },
+    { 'g', 1, 5383, 0 },
+    { 'g', 1, 5384, 0 },
+    { ';', 0, 0, 442 },
+    { 'g', 1, 5385, 0 },
+    { 's', 1, 5386, 0 },
+    { ';', 0, 0, 443 },
+    { ';', 0, 0, 444 },
+    { 'l', 1, 5387, 0 },
+    { ';', 0, 0, 445 },
+    { 'v', 1, 5388, 0 },
+    { 't', 1, 5389, 0 },
+    { '1', 6, 5390, 0 },
+    { '2', 2, 5396, 0 },
+    { '3', 3, 5398, 0 },
+    { '4', 1, 5401, 0 },
+    { '5', 2, 5402, 0 },
+    { '7', 1, 5404, 0 },
+    { 'l', 1, 5405, 0 },
+    { 'n', 1, 5406, 0 },
+    { ';', 0, 0, 446 },
+    { 't', 1, 5407, 0 },
+    { 'a', 2, 5408, 0 },
+    { 'v', 1, 5410, 0 },
+    { 'c', 1, 5411, 0 },
+    { ';', 0, 0, 447 },
+    { ';', 0, 0, 29 },
+    { 'l', 1, 5412, 0 },
+    { 'c', 1, 5413, 0 },
+    { 'o', 1, 5414, 0 },
+    { ';', 0, 0, 448 },
+    { 'e', 1, 5415, 0 },
+    { 'l', 1, 5416, 0 },
+    { ';', 0, 0, 449 },
+    { ';', 0, 0, 450 },
+    { 'p', 1, 5417, 0 },
+    { ';', 0, 0, 176 },
+    { 'q', 1, 5418, 0 },
+    { 'm', 1, 5419, 0 },
+    { ';', 0, 0, 451 },
+    { 'e', 1, 5420, 0 },
+    { ';', 0, 0, 452 },
+    { ';', 0, 0, 453 },
+    { 'e', 1, 5421, 0 },
+    { 'l', 1, 5422, 0 },
+    { ';', 0, 0, 454 },
+    { 'r', 1, 5423, 0 },
+    { 't', 1, 5424, 0 },
+    { 'a', 1, 5425, 0 },
+    { 'e', 1, 5426, 0 },
+    { 'p', 1, 5427, 0 },
+    { 'r', 1, 5428, 0 },
+    { 'o', 1, 5429, 0 },
+    { 'q', 2, 5430, 0 },
+    { 'e', 1, 5432, 0 },
+    { 'i', 1, 5433, 0 },
+    { 't', 1, 5434, 0 },
+    { ';', 0, 0, 455 },
+    { ';', 0, 0, 179 },
+    { 's', 1, 5435, 0 },
+    { ';', 0, 0, 456 },
+    { 'l', 1, 5436, 0 },
+    { 'c', 1, 5437, 0 },
+    { ';', 0, 0, 457 },
+    { 'c', 1, 5438, 0 },
+    { 'w', 1, 5439, 0 },
+    { ';', 0, 0, 458 },
+    { 'c', 1, 5440, 0 },
+    { 't', 1, 5441, 0 },
+    { 'i', 1, 5442, 0 },
+    { 'o', 1, 5443, 0 },
+    { 'a', 1, 5444, 0 },
+    { 'a', 1, 5445, 0 },
+    { 'r', 1, 5446, 0 },
+    { 'h', 1, 5447, 0 },
+    { 'l', 1, 5448, 0 },
+    { 'r', 1, 5449, 0 },
+    { ';', 0, 0, 459 },
+    { 'a', 1, 5450, 0 },
+    { ';', 0, 0, 460 },
+    { 's', 1, 5451, 0 },
+    { 'o', 1, 5452, 0 },
+    { 'l', 1, 5453, 0 },
+    { 'e', 1, 5454, 0 },
+    { 't', 1, 5455, 0 },
+    { 'c', 1, 5456, 461 },
+    { ';', 0, 0, 462 },
+    { 'l', 1, 5457, 463 },
+    { 'v', 1, 5458, 0 },
+    { 'n', 1, 5459, 0 },
+    { 't', 1, 5460, 0 },
+    { 'i', 1, 5461, 0 },
+    { 'a', 1, 5462, 0 },
+    { 'g', 1, 5463, 0 },
+    { 'r', 1, 5464, 0 },
+    { 'e', 1, 5465, 0 },
+    { 'l', 1, 5466, 0 },
+    { 'p', 1, 5467, 0 },
+    { 'h', 1, 5468, 0 },
+    { ';', 0, 0, 464 },
+    { 'd', 1, 5469, 0 },
+    { 'r', 1, 5470, 0 },
+    { 'n', 2, 5471, 0 },
+    { 'o', 1, 5473, 0 },
+    { 'a', 1, 5474, 0 },
+    { 'g', 1, 5475, 0 },
+    { 'r', 1, 5476, 0 },
+    { 'a', 1, 5477, 0 },
+    { 'r', 1, 5478, 0 },
+    { ';', 0, 0, 465 },
+    { 'n', 1, 5479, 0 },
+    { ';', 0, 0, 466 },
+    { ';', 0, 0, 467 },
+    { 'd', 1, 5480, 0 },
+    { 's', 1, 5481, 0 },
+    { ';', 0, 0, 468 },
+    { ';', 0, 0, 34 },
+    { 'E', 1, 5482, 0 },
+    { 'd', 1, 5483, 0 },
+    { 's', 2, 5484, 0 },
+    { 'v', 1, 5486, 0 },
+    { 'd', 1, 5487, 0 },
+    { 'y', 1, 5488, 0 },
+    { ';', 0, 0, 182 },
+    { 'c', 1, 5489, 0 },
+    { 'h', 1, 5490, 0 },
+    { ';', 0, 0, 469 },
+    { ';', 0, 0, 470 },
+    { 'c', 1, 5491, 0 },
+    { 'y', 1, 5492, 0 },
+    { 'a', 2, 5493, 0 },
+    { 'i', 1, 5495, 0 },
+    { 'e', 1, 5496, 0 },
+    { ';', 0, 0, 471 },
+    { ';', 0, 0, 472 },
+    { ';', 0, 0, 473 },
+    { ';', 0, 0, 474 },
+    { 'r', 1, 5497, 0 },
+    { ';', 0, 0, 475 },
+    { 'i', 1, 5498, 0 },
+    { 'r', 1, 5499, 0 },
+    { ';', 0, 0, 476 },
+    { 't', 1, 5500, 0 },
+    { 'p', 1, 5501, 0 },
+    { 'a', 1, 5502, 0 },
+    { 'd', 1, 5503, 0 },
+    { ';', 0, 0, 477 },
+    { 'd', 1, 5504, 0 },
+    { 'l', 1, 5505, 0 },
+    { 'o', 1, 5506, 478 },
+    { ';', 0, 0, 479 },
+    { 'b', 2, 5507, 0 },
+    { 'f', 1, 5509, 0 },
+    { 'h', 1, 5510, 0 },
+    { 'l', 1, 5511, 0 },
+    { 'p', 1, 5512, 0 },
+    { 's', 1, 5513, 0 },
+    { 't', 1, 5514, 0 },
+    { 'i', 1, 5515, 0 },
+    { ';', 0, 0, 480 },
+    { 's', 1, 5516, 0 },
+    { 'r', 1, 5517, 0 },
+    { 'k', 1, 5518, 0 },
+    { 'c', 2, 5519, 0 },
+    { 'e', 1, 5521, 0 },
+    { 's', 1, 5522, 0 },
+    { 'o', 1, 5523, 0 },
+    { 'i', 1, 5524, 0 },
+    { 'l', 1, 5525, 0 },
+    { ';', 0, 0, 481 },
+    { ';', 0, 0, 482 },
+    { 'o', 2, 5526, 0 },
+    { 'h', 1, 5528, 0 },
+    { 's', 1, 5529, 0 },
+    { ';', 0, 0, 483 },
+    { 'a', 1, 5530, 0 },
+    { 'h', 1, 5531, 0 },
+    { 'l', 1, 5532, 0 },
+    { 'r', 1, 5533, 0 },
+    { 't', 1, 5534, 0 },
+    { ';', 0, 0, 36 },
+    { 'l', 1, 5535, 0 },
+    { 'c', 1, 5536, 0 },
+    { 'o', 1, 5537, 0 },
+    { ';', 0, 0, 484 },
+    { 'e', 1, 5538, 0 },
+    { 'a', 1, 5539, 0 },
+    { 'd', 1, 5540, 0 },
+    { 'e', 1, 5541, 0 },
+    { 'g', 1, 5542, 0 },
+    { 's', 1, 5543, 0 },
+    { 'h', 1, 5544, 0 },
+    { 'o', 1, 5545, 0 },
+    { 'd', 1, 5546, 0 },
+    { 'u', 2, 5547, 0 },
+    { 'k', 1, 5549, 0 },
+    { ';', 0, 0, 485 },
+    { 'r', 1, 5550, 0 },
+    { 'r', 1, 5551, 0 },
+    { 'r', 1, 5552, 0 },
+    { 'i', 1, 5553, 0 },
+    { 'o', 1, 5554, 0 },
+    { 's', 1, 5555, 0 },
+    { ';', 0, 0, 486 },
+    { 'p', 1, 5556, 0 },
+    { ';', 0, 0, 196 },
+    { 'q', 1, 5557, 0 },
+    { 'm', 1, 5558, 0 },
+    { 'g', 1, 5559, 0 },
+    { 'r', 1, 5560, 0 },
+    { 'k', 1, 5561, 0 },
+    { 'l', 1, 5562, 0 },
+    { 'm', 1, 5563, 0 },
+    { 'r', 1, 5564, 0 },
+    { 'a', 1, 5565, 0 },
+    { 'r', 1, 5566, 0 },
+    { ';', 0, 0, 487 },
+    { 'u', 1, 5567, 0 },
+    { 'm', 1, 5568, 0 },
+    { 's', 1, 5569, 0 },
+    { 'a', 1, 5570, 0 },
+    { 'n', 1, 5571, 0 },
+    { ';', 0, 0, 488 },
+    { ';', 0, 0, 489 },
+    { 'l', 1, 5572, 0 },
+    { 'r', 1, 5573, 0 },
+    { 'r', 1, 5574, 0 },
+    { 'r', 2, 5575, 0 },
+    { 'i', 1, 5577, 0 },
+    { 'u', 1, 5578, 0 },
+    { ';', 0, 0, 490 },
+    { ';', 0, 0, 491 },
+    { 'e', 1, 5579, 0 },
+    { 'g', 1, 5580, 0 },
+    { ';', 0, 0, 492 },
+    { 'o', 2, 5581, 0 },
+    { 'o', 1, 5583, 0 },
+    { ';', 0, 0, 493 },
+    { 'r', 1, 5584, 0 },
+    { 't', 1, 5585, 0 },
+    { 'e', 1, 5586, 0 },
+    { 'e', 1, 5587, 0 },
+    { 'r', 1, 5588, 0 },
+    { 'e', 1, 5589, 0 },
+    { 'a', 1, 5590, 0 },
+    { ';', 0, 0, 494 },
+    { 'e', 1, 5591, 0 },
+    { 'f', 1, 5592, 0 },
+    { 's', 1, 5593, 0 },
+    { 'h', 1, 5594, 0 },
+    { 't', 1, 5595, 0 },
+    { ';', 0, 0, 495 },
+    { 't', 1, 5596, 0 },
+    { ';', 0, 0, 199 },
+    { ';', 0, 0, 496 },
+    { ';', 0, 0, 497 },
+    { 'e', 1, 5597, 0 },
+    { 't', 1, 5598, 0 },
+    { 'e', 1, 5599, 0 },
+    { 'm', 1, 5600, 0 },
+    { 'h', 1, 5601, 0 },
+    { 'u', 1, 5602, 0 },
+    { 'o', 1, 5603, 498 },
+    { 's', 1, 5604, 0 },
+    { 'i', 1, 5605, 0 },
+    { 'o', 1, 5606, 0 },
+    { 's', 3, 5607, 0 },
+    { ';', 0, 0, 499 },
+    { ';', 0, 0, 500 },
+    { 'u', 1, 5610, 0 },
+    { 'l', 1, 5611, 0 },
+    { ';', 0, 0, 501 },
+    { ';', 0, 0, 502 },
+    { 'o', 1, 5612, 0 },
+    { 'i', 1, 5613, 0 },
+    { 'p', 1, 5614, 0 },
+    { ';', 0, 0, 503 },
+    { 't', 2, 5615, 0 },
+    { ';', 0, 0, 504 },
+    { 'h', 1, 5617, 0 },
+    { 's', 1, 5618, 0 },
+    { 's', 1, 5619, 0 },
+    { 'a', 1, 5620, 0 },
+    { 't', 1, 5621, 0 },
+    { ';', 0, 0, 505 },
+    { ';', 0, 0, 506 },
+    { 'd', 1, 5622, 0 },
+    { 's', 1, 5623, 0 },
+    { 'r', 1, 5624, 0 },
+    { 'r', 2, 5625, 0 },
+    { ';', 0, 0, 210 },
+    { 'p', 2, 5627, 0 },
+    { ';', 0, 0, 507 },
+    { 'o', 1, 5629, 0 },
+    { 'i', 1, 5630, 0 },
+    { 'g', 2, 5631, 0 },
+    { ';', 0, 0, 508 },
+    { 'h', 1, 5633, 0 },
+    { 'r', 1, 5634, 0 },
+    { 'h', 1, 5635, 0 },
+    { 'r', 2, 5636, 0 },
+    { 't', 1, 5638, 0 },
+    { 'i', 1, 5639, 0 },
+    { 'a', 1, 5640, 0 },
+    { 'm', 1, 5641, 0 },
+    { 's', 1, 5642, 0 },
+    { ';', 0, 0, 214 },
+    { 'q', 1, 5643, 0 },
+    { 's', 1, 5644, 0 },
+    { ';', 0, 0, 509 },
+    { 'm', 1, 5645, 0 },
+    { ';', 0, 0, 215 },
+    { 'r', 1, 5646, 0 },
+    { 'r', 1, 5647, 0 },
+    { 'r', 1, 5648, 0 },
+    { ';', 0, 0, 510 },
+    { ';', 0, 0, 511 },
+    { 'r', 1, 5649, 0 },
+    { 'r', 1, 5650, 0 },
+    { ';', 0, 0, 512 },
+    { 't', 2, 5651, 0 },
+    { ';', 0, 0, 218 },
+    { 'q', 1, 5653, 0 },
+    { 's', 1, 5654, 0 },
+    { ';', 0, 0, 513 },
+    { 's', 1, 5655, 0 },
+    { 'm', 1, 5656, 0 },
+    { 'i', 2, 5657, 0 },
+    { ';', 0, 0, 514 },
+    { ';', 0, 0, 515 },
+    { 'n', 4, 5659, 0 },
+    { 'i', 2, 5663, 0 },
+    { ';', 0, 0, 516 },
+    { 'a', 1, 5665, 0 },
+    { 's', 1, 5666, 0 },
+    { 't', 1, 5667, 0 },
+    { 'i', 1, 5668, 0 },
+    { 'u', 1, 5669, 0 },
+    { ';', 0, 0, 517 },
+    { 'c', 2, 5670, 0 },
+    { 'r', 1, 5672, 0 },
+    { 'r', 3, 5673, 0 },
+    { 'h', 1, 5676, 0 },
+    { 'i', 2, 5677, 0 },
+    { 'u', 1, 5679, 0 },
+    { ';', 0, 0, 518 },
+    { ';', 0, 0, 519 },
+    { 'r', 1, 5680, 0 },
+    { ';', 0, 0, 520 },
+    { 'e', 2, 5681, 0 },
+    { 'd', 1, 5683, 0 },
+    { 'r', 1, 5684, 0 },
+    { 'u', 2, 5685, 0 },
+    { ';', 0, 0, 521 },
+    { 'E', 1, 5687, 0 },
+    { 'e', 1, 5688, 0 },
+    { 's', 1, 5689, 0 },
+    { 'c', 2, 5690, 0 },
+    { ';', 0, 0, 522 },
+    { 'E', 1, 5692, 0 },
+    { 'e', 1, 5693, 0 },
+    { 's', 1, 5694, 0 },
+    { ';', 0, 0, 523 },
+    { 'd', 1, 5695, 0 },
+    { ';', 0, 0, 524 },
+    { 'a', 1, 5696, 0 },
+    { 'r', 1, 5697, 0 },
+    { 'p', 1, 5698, 0 },
+    { 's', 1, 5699, 0 },
+    { 'r', 1, 5700, 0 },
+    { ';', 0, 0, 525 },
+    { 's', 1, 5701, 0 },
+    { ';', 0, 0, 526 },
+    { ';', 0, 0, 527 },
+    { 'f', 1, 5702, 0 },
+    { 'r', 1, 5703, 0 },
+    { ';', 0, 0, 528 },
+    { ';', 0, 0, 529 },
+    { 'r', 1, 5704, 0 },
+    { 'r', 1, 5705, 0 },
+    { 'r', 1, 5706, 0 },
+    { 'm', 1, 5707, 0 },
+    { 'r', 1, 5708, 0 },
+    { 'h', 1, 5709, 0 },
+    { 'r', 2, 5710, 0 },
+    { 'a', 1, 5712, 0 },
+    { 't', 1, 5713, 0 },
+    { ';', 0, 0, 530 },
+    { ';', 0, 0, 531 },
+    { 'c', 1, 5714, 532 },
+    { 'h', 1, 5715, 0 },
+    { 'a', 1, 5716, 0 },
+    { ';', 0, 0, 533 },
+    { ';', 0, 0, 534 },
+    { 'l', 1, 5717, 0 },
+    { 'g', 1, 5718, 0 },
+    { 'r', 1, 5719, 0 },
+    { ';', 0, 0, 535 },
+    { 'v', 1, 5720, 0 },
+    { 'r', 1, 5721, 0 },
+    { ';', 0, 0, 536 },
+    { 'r', 1, 5722, 0 },
+    { 'r', 1, 5723, 0 },
+    { 'o', 1, 5724, 0 },
+    { 'e', 1, 5725, 0 },
+    { 'r', 1, 5726, 0 },
+    { 'a', 1, 5727, 0 },
+    { 'r', 1, 5728, 0 },
+    { ';', 0, 0, 537 },
+    { 'u', 1, 5729, 0 },
+    { ';', 0, 0, 538 },
+    { ';', 0, 0, 539 },
+    { 'p', 1, 5730, 0 },
+    { 's', 1, 5731, 0 },
+    { 'r', 1, 5732, 0 },
+    { 'r', 2, 5733, 0 },
+    { ';', 0, 0, 229 },
+    { ';', 0, 0, 230 },
+    { 'o', 1, 5735, 0 },
+    { ';', 0, 0, 540 },
+    { 'o', 1, 5736, 0 },
+    { ';', 0, 0, 541 },
+    { 's', 1, 5737, 0 },
+    { ';', 0, 0, 542 },
+    { 'd', 1, 5738, 0 },
+    { 'e', 1, 5739, 0 },
+    { ';', 0, 0, 232 },
+    { 'r', 1, 5740, 0 },
+    { ';', 0, 0, 234 },
+    { 'l', 1, 5741, 0 },
+    { 'i', 1, 5742, 0 },
+    { 'l', 1, 5743, 0 },
+    { ';', 0, 0, 543 },
+    { 'n', 1, 5744, 0 },
+    { 'o', 1, 5745, 0 },
+    { 'i', 1, 5746, 0 },
+    { ';', 0, 0, 145 },
+    { 'e', 1, 5747, 0 },
+    { ';', 0, 0, 544 },
+    { 'a', 1, 5748, 0 },
+    { 'e', 1, 5749, 0 },
+    { 'h', 1, 5750, 0 },
+    { 'c', 1, 5751, 0 },
+    { 'k', 1, 5752, 0 },
+    { ';', 0, 0, 545 },
+    { 'a', 1, 5753, 0 },
+    { 'b', 1, 5754, 0 },
+    { 'c', 1, 5755, 0 },
+    { 'd', 2, 5756, 0 },
+    { 'e', 1, 5758, 0 },
+    { 'm', 1, 5759, 0 },
+    { 's', 1, 5760, 0 },
+    { 't', 1, 5761, 0 },
+    { 't', 1, 5762, 0 },
+    { ';', 0, 0, 546 },
+    { 'd', 1, 5763, 547 },
+    { ';', 0, 0, 548 },
+    { 'e', 1, 5764, 0 },
+    { ';', 0, 0, 49 },
+    { 'a', 1, 5765, 0 },
+    { 'c', 1, 5766, 0 },
+    { 'e', 1, 5767, 0 },
+    { 'n', 3, 5768, 0 },
+    { 's', 1, 5771, 0 },
+    { 'e', 2, 5772, 0 },
+    { ';', 0, 0, 549 },
+    { 'p', 1, 5774, 0 },
+    { 'i', 1, 5775, 0 },
+    { ';', 0, 0, 550 },
+    { 'a', 1, 5776, 0 },
+    { 'l', 1, 5777, 0 },
+    { 's', 1, 5778, 0 },
+    { ';', 0, 0, 551 },
+    { 't', 1, 5779, 0 },
+    { 'm', 1, 5780, 0 },
+    { 'e', 1, 5781, 0 },
+    { ';', 0, 0, 552 },
+    { 's', 1, 5782, 0 },
+    { ';', 0, 0, 553 },
+    { ';', 0, 0, 554 },
+    { 'm', 1, 5783, 0 },
+    { ';', 0, 0, 555 },
+    { 'e', 1, 5784, 0 },
+    { 'i', 1, 5785, 0 },
+    { 't', 2, 5786, 0 },
+    { ';', 0, 0, 106 },
+    { 'r', 1, 5788, 0 },
+    { ';', 0, 0, 556 },
+    { 'i', 1, 5789, 0 },
+    { 'r', 1, 5790, 0 },
+    { ';', 0, 0, 557 },
+    { ';', 0, 0, 558 },
+    { 't', 1, 5791, 0 },
+    { 'c', 1, 5792, 0 },
+    { 'p', 1, 5793, 0 },
+    { ';', 0, 0, 559 },
+    { 'd', 1, 5794, 0 },
+    { 'e', 1, 5795, 0 },
+    { 'l', 1, 5796, 0 },
+    { 'o', 1, 5797, 560 },
+    { ';', 0, 0, 561 },
+    { 'a', 1, 5798, 0 },
+    { 'b', 2, 5799, 0 },
+    { 'c', 1, 5801, 0 },
+    { 'f', 1, 5802, 0 },
+    { 'h', 1, 5803, 0 },
+    { 'l', 1, 5804, 0 },
+    { 'p', 1, 5805, 0 },
+    { 's', 1, 5806, 0 },
+    { 't', 1, 5807, 0 },
+    { 'w', 1, 5808, 0 },
+    { 'i', 1, 5809, 0 },
+    { 'o', 2, 5810, 0 },
+    { 'r', 1, 5812, 0 },
+    { 'k', 1, 5813, 0 },
+    { 'c', 2, 5814, 0 },
+    { 'e', 1, 5816, 0 },
+    { 's', 1, 5817, 0 },
+    { 'o', 1, 5818, 0 },
+    { 'i', 1, 5819, 0 },
+    { 'l', 1, 5820, 0 },
+    { ';', 0, 0, 562 },
+    { ';', 0, 0, 563 },
+    { 'h', 1, 5821, 0 },
+    { 'o', 2, 5822, 0 },
+    { ';', 0, 0, 564 },
+    { ';', 0, 0, 17 },
+    { 'i', 1, 5824, 0 },
+    { 'p', 1, 5825, 0 },
+    { 's', 1, 5826, 0 },
+    { ';', 0, 0, 565 },
+    { 'h', 1, 5827, 0 },
+    { 'o', 1, 5828, 0 },
+    { 'd', 1, 5829, 0 },
+    { 'u', 2, 5830, 0 },
+    { ';', 0, 0, 566 },
+    { 't', 6, 5832, 0 },
+    { ';', 0, 0, 567 },
+    { 'n', 1, 5838, 0 },
+    { 'r', 1, 5839, 0 },
+    { 'r', 1, 5840, 0 },
+    { 's', 1, 5841, 0 },
+    { 'd', 1, 5842, 0 },
+    { 'g', 1, 5843, 0 },
+    { 'r', 1, 5844, 0 },
+    { 'k', 1, 5845, 0 },
+    { 'r', 1, 5846, 0 },
+    { ';', 0, 0, 568 },
+    { 'u', 1, 5847, 0 },
+    { 'm', 1, 5848, 0 },
+    { ';', 0, 0, 569 },
+    { 'g', 1, 5849, 0 },
+    { 'l', 1, 5850, 0 },
+    { 'r', 1, 5851, 0 },
+    { 'u', 1, 5852, 0 },
+    { ';', 0, 0, 570 },
+    { ';', 0, 0, 571 },
+    { 'o', 2, 5853, 0 },
+    { 'e', 1, 5855, 0 },
+    { 'e', 1, 5856, 0 },
+    { ';', 0, 0, 572 },
+    { 'e', 1, 5857, 0 },
+    { 'f', 1, 5858, 0 },
+    { 'l', 1, 5859, 0 },
+    { 'h', 1, 5860, 0 },
+    { 't', 1, 5861, 0 },
+    { 'o', 1, 5862, 0 },
+    { ';', 0, 0, 573 },
+    { 'o', 1, 5863, 0 },
+    { 'e', 1, 5864, 0 },
+    { 'i', 1, 5865, 0 },
+    { 'c', 1, 5866, 0 },
+    { ';', 0, 0, 574 },
+    { 'p', 1, 5867, 0 },
+    { 'i', 1, 5868, 0 },
+    { 'l', 1, 5869, 0 },
+    { 'm', 1, 5870, 0 },
+    { ';', 0, 0, 575 },
+    { 'b', 1, 5871, 0 },
+    { 'e', 1, 5872, 0 },
+    { 'r', 1, 5873, 0 },
+    { 'h', 1, 5874, 0 },
+    { 'r', 2, 5875, 0 },
+    { ';', 0, 0, 250 },
+    { ';', 0, 0, 576 },
+    { 'a', 1, 5877, 0 },
+    { 'i', 1, 5878, 0 },
+    { 'n', 1, 5879, 0 },
+    { ';', 0, 0, 577 },
+    { 'w', 1, 5880, 0 },
+    { 'p', 1, 5881, 0 },
+    { 'c', 1, 5882, 0 },
+    { ';', 0, 0, 578 },
+    { 't', 2, 5883, 0 },
+    { 'a', 3, 5885, 0 },
+    { 'o', 1, 5888, 0 },
+    { ';', 0, 0, 579 },
+    { 'q', 1, 5889, 0 },
+    { ';', 0, 0, 580 },
+    { 'E', 1, 5890, 0 },
+    { ';', 0, 0, 581 },
+    { 'E', 1, 5891, 0 },
+    { 'e', 1, 5892, 0 },
+    { 'l', 1, 5893, 0 },
+    { 'a', 1, 5894, 0 },
+    { 'r', 1, 5895, 0 },
+    { 'l', 1, 5896, 0 },
+    { 'h', 1, 5897, 0 },
+    { 'a', 1, 5898, 0 },
+    { ';', 0, 0, 204 },
+    { 'e', 1, 5899, 0 },
+    { ';', 0, 0, 582 },
+    { 's', 1, 5900, 0 },
+    { 'c', 1, 5901, 0 },
+    { ';', 0, 0, 583 },
+    { 'a', 1, 5902, 0 },
+    { ';', 0, 0, 584 },
+    { 'e', 1, 5903, 0 },
+    { ';', 0, 0, 233 },
+    { 'p', 2, 5904, 0 },
+    { 'p', 2, 5906, 0 },
+    { 'b', 3, 5908, 0 },
+    { 'p', 3, 5911, 0 },
+    { 'r', 2, 5914, 0 },
+    { ';', 0, 0, 585 },
+    { 'r', 1, 5916, 0 },
+    { ';', 0, 0, 586 },
+    { 'm', 1, 5917, 0 },
+    { 'l', 1, 5918, 0 },
+    { 'r', 1, 5919, 0 },
+    { ';', 0, 0, 587 },
+    { 'f', 1, 5920, 0 },
+    { 'i', 1, 5921, 0 },
+    { 's', 1, 5922, 0 },
+    { ';', 0, 0, 588 },
+    { 'o', 1, 5923, 0 },
+    { ';', 0, 0, 589 },
+    { 'd', 1, 5924, 0 },
+    { 'u', 1, 5925, 0 },
+    { 'E', 1, 5926, 0 },
+    { 'e', 1, 5927, 0 },
+    { 'l', 1, 5928, 0 },
+    { 'a', 1, 5929, 0 },
+    { 'e', 1, 5930, 0 },
+    { 'i', 1, 5931, 0 },
+    { 'u', 2, 5932, 0 },
+    { ';', 0, 0, 51 },
+    { 'a', 1, 5934, 0 },
+    { 'c', 1, 5935, 0 },
+    { 'e', 1, 5936, 0 },
+    { 'n', 3, 5937, 0 },
+    { 's', 1, 5940, 0 },
+    { ';', 0, 0, 590 },
+    { ';', 0, 0, 257 },
+    { ';', 0, 0, 258 },
+    { ';', 0, 0, 259 },
+    { ';', 0, 0, 591 },
+    { 'o', 1, 5941, 0 },
+    { 's', 1, 5942, 0 },
+    { ';', 0, 0, 592 },
+    { 'd', 1, 5943, 0 },
+    { 's', 2, 5944, 0 },
+    { 'a', 1, 5946, 0 },
+    { 'u', 1, 5947, 0 },
+    { 'E', 1, 5948, 0 },
+    { 'e', 1, 5949, 0 },
+    { 'l', 1, 5950, 0 },
+    { 'e', 1, 5951, 0 },
+    { 'i', 1, 5952, 0 },
+    { 'u', 2, 5953, 0 },
+    { 'r', 1, 5955, 0 },
+    { 'h', 1, 5956, 0 },
+    { 'r', 2, 5957, 0 },
+    { 'a', 1, 5959, 0 },
+    { 'g', 1, 5960, 593 },
+    { 'e', 1, 5961, 0 },
+    { ';', 0, 0, 594 },
+    { 'o', 1, 5962, 0 },
+    { 'i', 1, 5963, 0 },
+    { ';', 0, 0, 595 },
+    { 'e', 1, 5964, 0 },
+    { 'e', 2, 5965, 0 },
+    { 'a', 3, 5967, 0 },
+    { 'k', 2, 5970, 0 },
+    { 's', 1, 5972, 0 },
+    { 'p', 1, 5973, 0 },
+    { 'i', 1, 5974, 0 },
+    { 'n', 1, 5975, 596 },
+    { 'e', 1, 5976, 0 },
+    { 's', 3, 5977, 597 },
+    { ';', 0, 0, 598 },
+    { ';', 0, 0, 599 },
+    { 'o', 1, 5980, 0 },
+    { 'i', 1, 5981, 0 },
+    { ';', 0, 0, 600 },
+    { 'o', 1, 5982, 0 },
+    { ';', 0, 0, 601 },
+    { 'm', 1, 5983, 0 },
+    { 'e', 1, 5984, 0 },
+    { 'n', 1, 5985, 0 },
+    { 'o', 1, 5986, 0 },
+    { ';', 0, 0, 602 },
+    { 'i', 1, 5987, 0 },
+    { 'l', 1, 5988, 0 },
+    { 'b', 1, 5989, 0 },
+    { 'i', 1, 5990, 0 },
+    { 'z', 1, 5991, 0 },
+    { ';', 0, 0, 603 },
+    { ';', 0, 0, 604 },
+    { 'y', 1, 5992, 0 },
+    { 'o', 1, 5993, 0 },
+    { 't', 1, 5994, 0 },
+    { 'e', 1, 5995, 0 },
+    { ';', 0, 0, 605 },
+    { ';', 0, 0, 606 },
+    { 't', 1, 5996, 0 },
+    { ';', 0, 0, 607 },
+    { 'y', 1, 5997, 0 },
+    { 'v', 1, 5998, 0 },
+    { 'c', 1, 5999, 608 },
+    { 'r', 1, 6000, 0 },
+    { 'a', 1, 6001, 0 },
+    { 'r', 1, 6002, 0 },
+    { 'h', 1, 6003, 0 },
+    { 'v', 1, 6004, 0 },
+    { 'l', 1, 6005, 0 },
+    { 'r', 1, 6006, 0 },
+    { 'k', 1, 6007, 0 },
+    { 'r', 1, 6008, 0 },
+    { 'o', 1, 6009, 0 },
+    { 'i', 1, 6010, 0 },
+    { 'r', 1, 6011, 0 },
+    { 'n', 1, 6012, 0 },
+    { ';', 0, 0, 609 },
+    { 'r', 1, 6013, 0 },
+    { 'w', 1, 6014, 0 },
+    { 'r', 1, 6015, 0 },
+    { 's', 1, 6016, 0 },
+    { ';', 0, 0, 610 },
+    { 'h', 1, 6017, 0 },
+    { 'l', 1, 6018, 0 },
+    { 'a', 1, 6019, 0 },
+    { 'r', 1, 6020, 0 },
+    { 'o', 1, 6021, 0 },
+    { 'g', 1, 6022, 0 },
+    { 'i', 1, 6023, 0 },
+    { ';', 0, 0, 611 },
+    { 't', 1, 6024, 0 },
+    { 'd', 1, 6025, 0 },
+    { ';', 0, 0, 612 },
+    { 'f', 1, 6026, 0 },
+    { 'r', 1, 6027, 0 },
+    { ';', 0, 0, 267 },
+    { 'g', 1, 6028, 0 },
+    { ';', 0, 0, 613 },
+    { ';', 0, 0, 614 },
+    { 'v', 1, 6029, 0 },
+    { 'h', 1, 6030, 0 },
+    { 'r', 1, 6031, 0 },
+    { 'p', 1, 6032, 0 },
+    { 'a', 1, 6033, 0 },
+    { 'o', 1, 6034, 0 },
+    { 'h', 1, 6035, 0 },
+    { 'i', 1, 6036, 0 },
+    { 'r', 1, 6037, 0 },
+    { ';', 0, 0, 615 },
+    { 'h', 1, 6038, 0 },
+    { 'i', 1, 6039, 0 },
+    { 'u', 2, 6040, 0 },
+    { 'h', 1, 6042, 0 },
+    { 'r', 1, 6043, 0 },
+    { 'h', 1, 6044, 0 },
+    { 'a', 1, 6045, 0 },
+    { 'q', 1, 6046, 0 },
+    { 'i', 1, 6047, 0 },
+    { 'a', 1, 6048, 0 },
+    { ';', 0, 0, 616 },
+    { 'i', 1, 6049, 0 },
+    { 'b', 1, 6050, 0 },
+    { 'p', 1, 6051, 0 },
+    { ';', 0, 0, 617 },
+    { 'p', 1, 6052, 0 },
+    { 'i', 1, 6053, 0 },
+    { ';', 0, 0, 618 },
+    { 'n', 2, 6054, 0 },
+    { 'n', 2, 6056, 0 },
+    { 'z', 1, 6058, 0 },
+    { 'c', 1, 6059, 0 },
+    { 'a', 1, 6060, 0 },
+    { 'e', 2, 6061, 0 },
+    { 'r', 1, 6063, 0 },
+    { ';', 0, 0, 619 },
+    { 't', 1, 6064, 0 },
+    { ';', 0, 0, 620 },
+    { ';', 0, 0, 621 },
+    { 'c', 1, 6065, 0 },
+    { ';', 0, 0, 622 },
+    { 'i', 1, 6066, 0 },
+    { 'r', 1, 6067, 0 },
+    { 'r', 1, 6068, 0 },
+    { 'r', 1, 6069, 0 },
+    { 'r', 1, 6070, 0 },
+    { ';', 0, 0, 623 },
+    { ';', 0, 0, 624 },
+    { 't', 1, 6071, 0 },
+    { ';', 0, 0, 625 },
+    { 'u', 1, 6072, 0 },
+    { 'm', 1, 6073, 0 },
+    { 'r', 1, 6074, 0 },
+    { 'r', 1, 6075, 0 },
+    { ';', 0, 0, 626 },
+    { 'u', 1, 6076, 0 },
+    { 'u', 1, 6077, 0 },
+    { 'i', 1, 6078, 0 },
+    { ';', 0, 0, 124 },
+    { 'g', 1, 6079, 0 },
+    { 't', 1, 6080, 0 },
+    { ';', 0, 0, 627 },
+    { 'c', 1, 6081, 0 },
+    { ';', 0, 0, 628 },
+    { ';', 0, 0, 629 },
+    { ';', 0, 0, 630 },
+    { ';', 0, 0, 631 },
+    { ';', 0, 0, 274 },
+    { 't', 1, 6082, 0 },
+    { 'o', 1, 6083, 0 },
+    { ';', 0, 0, 632 },
+    { 'r', 1, 6084, 0 },
+    { ';', 0, 0, 633 },
+    { ';', 0, 0, 634 },
+    { 'a', 1, 6085, 0 },
+    { ';', 0, 0, 635 },
+    { ';', 0, 0, 636 },
+    { ';', 0, 0, 637 },
+    { ';', 0, 0, 278 },
+    { 'e', 1, 6086, 638 },
+    { 'e', 1, 6087, 0 },
+    { ';', 0, 0, 279 },
+    { 'e', 1, 6088, 639 },
+    { ';', 0, 0, 640 },
+    { ';', 0, 0, 641 },
+    { ';', 0, 0, 642 },
+    { 'F', 1, 6089, 0 },
+    { ';', 0, 0, 281 },
+    { 'n', 1, 6090, 0 },
+    { 'e', 1, 6091, 643 },
+    { 'l', 1, 6092, 0 },
+    { 'd', 1, 6093, 0 },
+    { 's', 1, 6094, 0 },
+    { 'u', 1, 6095, 0 },
+    { ';', 0, 0, 644 },
+    { 'q', 1, 6096, 0 },
+    { 'e', 1, 6097, 0 },
+    { 'a', 1, 6098, 0 },
+    { 'y', 1, 6099, 0 },
+    { 'n', 1, 6100, 0 },
+    { 'l', 1, 6101, 645 },
+    { ';', 0, 0, 646 },
+    { 'n', 1, 6102, 0 },
+    { 'l', 1, 6103, 0 },
+    { 'r', 1, 6104, 0 },
+    { 'e', 4, 6105, 0 },
+    { 'w', 1, 6109, 0 },
+    { 'C', 1, 6110, 0 },
+    { ';', 0, 0, 647 },
+    { 'e', 1, 6111, 0 },
+    { 'u', 1, 6112, 0 },
+    { 't', 1, 6113, 0 },
+    { 'u', 1, 6114, 0 },
+    { 'd', 1, 6115, 0 },
+    { 'e', 1, 6116, 0 },
+    { ';', 0, 0, 648 },
+    { 'p', 1, 6117, 0 },
+    { 'a', 1, 6118, 0 },
+    { 'r', 1, 6119, 0 },
+    { ';', 0, 0, 649 },
+    { 'n', 1, 6120, 0 },
+    { ';', 0, 0, 650 },
+    { 'i', 1, 6121, 0 },
+    { 'n', 1, 6122, 0 },
+    { 'r', 1, 6123, 0 },
+    { 't', 1, 6124, 0 },
+    { 'u', 1, 6125, 0 },
+    { 'e', 6, 6126, 0 },
+    { 'r', 1, 6132, 0 },
+    { 'r', 1, 6133, 0 },
+    { 'e', 1, 6134, 0 },
+    { 'i', 1, 6135, 0 },
+    { 'e', 1, 6136, 0 },
+    { 'r', 1, 6137, 0 },
+    { 'k', 1, 6138, 0 },
+    { 'e', 1, 6139, 651 },
+    { 'n', 1, 6140, 0 },
+    { ';', 0, 0, 297 },
+    { 'e', 1, 6141, 652 },
+    { 'n', 1, 6142, 0 },
+    { ';', 0, 0, 653 },
+    { 'S', 1, 6143, 0 },
+    { 'V', 1, 6144, 0 },
+    { ';', 0, 0, 654 },
+    { 'o', 1, 6145, 0 },
+    { ';', 0, 0, 655 },
+    { 'T', 1, 6146, 0 },
+    { 'i', 1, 6147, 0 },
+    { 's', 1, 6148, 0 },
+    { 'e', 1, 6149, 0 },
+    { 'd', 2, 6150, 0 },
+    { 'l', 1, 6152, 0 },
+    { 'e', 1, 6153, 0 },
+    { ';', 0, 0, 656 },
+    { 'd', 1, 6154, 0 },
+    { 'e', 1, 6155, 0 },
+    { 'l', 1, 6156, 0 },
+    { ';', 0, 0, 657 },
+    { 'e', 1, 6157, 0 },
+    { 'y', 1, 6158, 0 },
+    { ';', 0, 0, 658 },
+    { ';', 0, 0, 659 },
+    { 'r', 1, 6159, 0 },
+    { 'o', 1, 6160, 0 },
+    { 'k', 1, 6161, 0 },
+    { 'o', 1, 6162, 0 },
+    { 'q', 1, 6163, 0 },
+    { ';', 0, 0, 660 },
+    { 'e', 1, 6164, 661 },
+    { ';', 0, 0, 312 },
+    { 'e', 1, 6165, 662 },
+    { ';', 0, 0, 663 },
+    { 'n', 1, 6166, 0 },
+    { 'e', 1, 6167, 0 },
+    { 'r', 1, 6168, 0 },
+    { 's', 1, 6169, 0 },
+    { 'i', 1, 6170, 0 },
+    { ';', 0, 0, 664 },
+    { 'e', 1, 6171, 0 },
+    { ';', 0, 0, 665 },
+    { ';', 0, 0, 666 },
+    { 'y', 1, 6172, 0 },
+    { ';', 0, 0, 667 },
+    { ';', 0, 0, 668 },
+    { 'l', 1, 6173, 0 },
+    { 'e', 1, 6174, 0 },
+    { 'a', 1, 6175, 0 },
+    { 'c', 1, 6176, 0 },
+    { 'n', 1, 6177, 0 },
+    { 'l', 1, 6178, 0 },
+    { 'n', 1, 6179, 0 },
+    { 'r', 1, 6180, 0 },
+    { 'e', 1, 6181, 0 },
+    { 'o', 2, 6182, 0 },
+    { 'l', 1, 6184, 0 },
+    { 'i', 1, 6185, 0 },
+    { 'e', 1, 6186, 0 },
+    { 'r', 1, 6187, 0 },
+    { 'p', 3, 6188, 0 },
+    { 'e', 1, 6191, 0 },
+    { 'r', 1, 6192, 0 },
+    { 'i', 1, 6193, 0 },
+    { 'q', 1, 6194, 0 },
+    { 'u', 1, 6195, 0 },
+    { 'r', 1, 6196, 0 },
+    { 'e', 1, 6197, 0 },
+    { 'l', 1, 6198, 0 },
+    { 'i', 1, 6199, 0 },
+    { 'a', 1, 6200, 0 },
+    { 't', 1, 6201, 0 },
+    { 'e', 1, 6202, 0 },
+    { 'i', 1, 6203, 0 },
+    { 'e', 1, 6204, 0 },
+    { 'i', 1, 6205, 0 },
+    { 'L', 1, 6206, 0 },
+    { 'R', 1, 6207, 0 },
+    { 'k', 1, 6208, 0 },
+    { 'm', 1, 6209, 0 },
+    { 'n', 1, 6210, 0 },
+    { 'P', 1, 6211, 0 },
+    { 'e', 1, 6212, 0 },
+    { 'n', 1, 6213, 0 },
+    { 'l', 1, 6214, 0 },
+    { 'i', 1, 6215, 0 },
+    { 'd', 2, 6216, 0 },
+    { 'n', 1, 6218, 0 },
+    { 'a', 1, 6219, 0 },
+    { 'e', 1, 6220, 0 },
+    { 'n', 1, 6221, 0 },
+    { 'p', 1, 6222, 0 },
+    { 'u', 1, 6223, 0 },
+    { 'e', 1, 6224, 0 },
+    { 'u', 1, 6225, 0 },
+    { 'i', 1, 6226, 0 },
+    { 'e', 1, 6227, 0 },
+    { 'm', 1, 6228, 0 },
+    { 'f', 1, 6229, 0 },
+    { 's', 1, 6230, 0 },
+    { 's', 1, 6231, 0 },
+    { 'e', 1, 6232, 0 },
+    { 'v', 1, 6233, 0 },
+    { 'g', 1, 6234, 0 },
+    { 'u', 1, 6235, 0 },
+    { 'b', 1, 6236, 0 },
+    { 'c', 1, 6237, 0 },
+    { 'p', 1, 6238, 0 },
+    { 'l', 1, 6239, 0 },
+    { 'r', 1, 6240, 0 },
+    { 'e', 1, 6241, 669 },
+    { ';', 0, 0, 670 },
+    { 'e', 1, 6242, 671 },
+    { ';', 0, 0, 333 },
+    { 'c', 1, 6243, 0 },
+    { 'e', 1, 6244, 672 },
+    { ';', 0, 0, 673 },
+    { ';', 0, 0, 226 },
+    { 'o', 1, 6245, 0 },
+    { 'u', 1, 6246, 0 },
+    { 'h', 1, 6247, 674 },
+    { 'e', 1, 6248, 675 },
+    { 's', 1, 6249, 0 },
+    { 'a', 1, 6250, 0 },
+    { 'r', 1, 6251, 0 },
+    { 'a', 1, 6252, 0 },
+    { 'a', 1, 6253, 0 },
+    { 'i', 1, 6254, 0 },
+    { 'a', 1, 6255, 0 },
+    { 'd', 1, 6256, 0 },
+    { ';', 0, 0, 676 },
+    { 'c', 1, 6257, 0 },
+    { 'r', 1, 6258, 0 },
+    { ';', 0, 0, 677 },
+    { 'e', 1, 6259, 0 },
+    { 'l', 1, 6260, 0 },
+    { 'n', 1, 6261, 0 },
+    { 'l', 1, 6262, 0 },
+    { 's', 1, 6263, 0 },
+    { 'A', 2, 6264, 0 },
+    { 'C', 1, 6266, 0 },
+    { 'D', 1, 6267, 0 },
+    { 'F', 1, 6268, 0 },
+    { 'T', 2, 6269, 0 },
+    { 'U', 1, 6271, 0 },
+    { 'V', 1, 6272, 0 },
+    { 'a', 1, 6273, 0 },
+    { 'I', 1, 6274, 0 },
+    { 't', 1, 6275, 0 },
+    { 'e', 1, 6276, 0 },
+    { 'y', 1, 6277, 0 },
+    { 'y', 1, 6278, 0 },
+    { 'e', 1, 6279, 0 },
+    { 'n', 1, 6280, 0 },
+    { 'l', 1, 6281, 0 },
+    { ';', 0, 0, 678 },
+    { 'D', 1, 6282, 0 },
+    { 'L', 1, 6283, 0 },
+    { 'R', 1, 6284, 0 },
+    { 'U', 1, 6285, 0 },
+    { ';', 0, 0, 679 },
+    { 'C', 1, 6286, 0 },
+    { 'e', 4, 6287, 0 },
+    { 't', 2, 6291, 0 },
+    { 'e', 1, 6293, 0 },
+    { 'h', 1, 6294, 0 },
+    { 's', 1, 6295, 0 },
+    { 't', 1, 6296, 0 },
+    { ';', 0, 0, 349 },
+    { ';', 0, 0, 680 },
+    { ';', 0, 0, 681 },
+    { 'n', 1, 6297, 0 },
+    { 'l', 1, 6298, 0 },
+    { 'f', 1, 6299, 0 },
+    { ';', 0, 0, 682 },
+    { 'S', 1, 6300, 0 },
+    { 'p', 1, 6301, 0 },
+    { ';', 0, 0, 252 },
+    { 'E', 1, 6302, 0 },
+    { 'F', 1, 6303, 0 },
+    { 'T', 1, 6304, 0 },
+    { 'e', 1, 6305, 0 },
+    { 'k', 1, 6306, 0 },
+    { 'e', 1, 6307, 683 },
+    { 'c', 1, 6308, 0 },
+    { ';', 0, 0, 684 },
+    { 'e', 1, 6309, 0 },
+    { ';', 0, 0, 354 },
+    { 'c', 1, 6310, 0 },
+    { 'e', 1, 6311, 685 },
+    { ';', 0, 0, 686 },
+    { 'B', 2, 6312, 0 },
+    { 'P', 1, 6314, 0 },
+    { ';', 0, 0, 622 },
+    { 'P', 1, 6315, 0 },
+    { ';', 0, 0, 687 },
+    { 'o', 1, 6316, 0 },
+    { 'n', 1, 6317, 0 },
+    { 'i', 1, 6318, 0 },
+    { ';', 0, 0, 145 },
+    { 'A', 1, 6319, 0 },
+    { 'o', 1, 6320, 0 },
+    { 'n', 1, 6321, 0 },
+    { 'L', 1, 6322, 0 },
+    { 'R', 1, 6323, 0 },
+    { 'o', 1, 6324, 0 },
+    { ';', 0, 0, 688 },
+    { 'e', 1, 6325, 0 },
+    { ';', 0, 0, 689 },
+    { ';', 0, 0, 690 },
+    { 'l', 1, 6326, 0 },
+    { 'r', 1, 6327, 0 },
+    { 'c', 1, 6328, 0 },
+    { 'h', 1, 6329, 0 },
+    { 'h', 1, 6330, 0 },
+    { ';', 0, 0, 691 },
+    { ';', 0, 0, 692 },
+    { 'e', 1, 6331, 693 },
+    { ';', 0, 0, 694 },
+    { 'e', 1, 6332, 0 },
+    { 'n', 1, 6333, 0 },
+    { 'i', 1, 6334, 0 },
+    { 'e', 1, 6335, 695 },
+    { 'e', 1, 6336, 0 },
+    { ';', 0, 0, 377 },
+    { ';', 0, 0, 378 },
+    { ';', 0, 0, 379 },
+    { 'e', 1, 6337, 696 },
+    { 'y', 1, 6338, 0 },
+    { ';', 0, 0, 697 },
+    { ';', 0, 0, 698 },
+    { ';', 0, 0, 699 },
+    { ';', 0, 0, 700 },
+    { 'd', 1, 6339, 0 },
+    { 'o', 1, 6340, 0 },
+    { ';', 0, 0, 137 },
+    { 'd', 2, 6341, 0 },
+    { ';', 0, 0, 701 },
+    { 'v', 1, 6343, 0 },
+    { 'h', 1, 6344, 0 },
+    { ';', 0, 0, 281 },
+    { 'r', 1, 6345, 0 },
+    { ';', 0, 0, 702 },
+    { 'r', 1, 6346, 0 },
+    { 'x', 2, 6347, 0 },
+    { ';', 0, 0, 386 },
+    { ';', 0, 0, 22 },
+    { 'e', 1, 6349, 0 },
+    { 'e', 1, 6350, 703 },
+    { 'i', 1, 6351, 0 },
+    { ';', 0, 0, 704 },
+    { 'o', 1, 6352, 0 },
+    { 'p', 1, 6353, 0 },
+    { 'r', 1, 6354, 0 },
+    { 'i', 1, 6355, 0 },
+    { 'e', 1, 6356, 0 },
+    { 'd', 2, 6357, 0 },
+    { 'b', 1, 6359, 0 },
+    { ';', 0, 0, 705 },
+    { ';', 0, 0, 706 },
+    { 's', 2, 6360, 0 },
+    { 'y', 1, 6362, 0 },
+    { ';', 0, 0, 707 },
+    { 'u', 1, 6363, 0 },
+    { 'e', 1, 6364, 0 },
+    { 'p', 1, 6365, 0 },
+    { 'r', 1, 6366, 0 },
+    { 'p', 1, 6367, 0 },
+    { 'o', 1, 6368, 0 },
+    { 'l', 1, 6369, 0 },
+    { 'i', 1, 6370, 0 },
+    { 'c', 1, 6371, 0 },
+    { 'a', 1, 6372, 0 },
+    { 'i', 1, 6373, 0 },
+    { 'l', 1, 6374, 0 },
+    { 'e', 1, 6375, 0 },
+    { 'd', 1, 6376, 0 },
+    { 'w', 1, 6377, 0 },
+    { 'l', 1, 6378, 0 },
+    { 's', 1, 6379, 0 },
+    { 't', 1, 6380, 0 },
+    { ';', 0, 0, 708 },
+    { ';', 0, 0, 709 },
+    { ';', 0, 0, 710 },
+    { ';', 0, 0, 711 },
+    { ';', 0, 0, 712 },
+    { 'i', 1, 6381, 0 },
+    { 'm', 1, 6382, 0 },
+    { 'e', 1, 6383, 0 },
+    { ';', 0, 0, 713 },
+    { ';', 0, 0, 714 },
+    { ';', 0, 0, 715 },
+    { ';', 0, 0, 716 },
+    { ';', 0, 0, 717 },
+    { ';', 0, 0, 718 },
+    { ';', 0, 0, 719 },
+    { ';', 0, 0, 720 },
+    { ';', 0, 0, 721 },
+    { ';', 0, 0, 722 },
+    { ';', 0, 0, 723 },
+    { ';', 0, 0, 724 },
+    { ';', 0, 0, 725 },
+    { ';', 0, 0, 726 },
+    { ';', 0, 0, 727 },
+    { ';', 0, 0, 728 },
+    { ';', 0, 0, 729 },
+    { ';', 0, 0, 730 },
+    { 'x', 1, 6384, 0 },
+    { ';', 0, 0, 731 },
+    { ';', 0, 0, 732 },
+    { ';', 0, 0, 733 },
+    { ';', 0, 0, 734 },
+    { ';', 0, 0, 735 },
+    { ';', 0, 0, 736 },
+    { ';', 0, 0, 737 },
+    { ';', 0, 0, 738 },
+    { 'n', 1, 6385, 0 },
+    { 'u', 1, 6386, 0 },
+    { 'm', 1, 6387, 0 },
+    { ';', 0, 0, 739 },
+    { ';', 0, 0, 740 },
+    { ';', 0, 0, 741 },
+    { ';', 0, 0, 742 },
+    { ';', 0, 0, 743 },
+    { ';', 0, 0, 744 },
+    { ';', 0, 0, 745 },
+    { ';', 0, 0, 746 },
+    { ';', 0, 0, 747 },
+    { ';', 0, 0, 748 },
+    { 'e', 1, 6388, 0 },
+    { ';', 0, 0, 644 },
+    { 'r', 1, 6389, 749 },
+    { ';', 0, 0, 750 },
+    { ';', 0, 0, 751 },
+    { ';', 0, 0, 752 },
+    { 's', 1, 6390, 0 },
+    { 't', 1, 6391, 0 },
+    { ';', 0, 0, 753 },
+    { ';', 0, 0, 754 },
+    { 'q', 1, 6392, 0 },
+    { 'e', 1, 6393, 0 },
+    { 'd', 1, 6394, 0 },
+    { 'c', 1, 6395, 0 },
+    { 'p', 1, 6396, 0 },
+    { 'p', 1, 6397, 0 },
+    { 't', 1, 6398, 0 },
+    { ';', 0, 0, 755 },
+    { ';', 0, 0, 658 },
+    { ';', 0, 0, 756 },
+    { 'n', 1, 6399, 0 },
+    { 'l', 1, 6400, 757 },
+    { ';', 0, 0, 758 },
+    { ';', 0, 0, 759 },
+    { 's', 1, 6401, 0 },
+    { ';', 0, 0, 405 },
+    { 'y', 1, 6402, 0 },
+    { 'r', 1, 6403, 0 },
+    { ';', 0, 0, 760 },
+    { 'm', 1, 6404, 0 },
+    { 'q', 1, 6405, 0 },
+    { 'e', 2, 6406, 0 },
+    { 'i', 1, 6408, 0 },
+    { 'd', 1, 6409, 0 },
+    { 'i', 1, 6410, 0 },
+    { ';', 0, 0, 761 },
+    { 'u', 1, 6411, 0 },
+    { ';', 0, 0, 762 },
+    { 'e', 2, 6412, 0 },
+    { ';', 0, 0, 763 },
+    { 't', 1, 6414, 0 },
+    { 'n', 1, 6415, 0 },
+    { 'e', 2, 6416, 0 },
+    { 'o', 1, 6418, 0 },
+    { 't', 1, 6419, 0 },
+    { 'd', 1, 6420, 0 },
+    { 'r', 1, 6421, 0 },
+    { ';', 0, 0, 764 },
+    { ';', 0, 0, 765 },
+    { ';', 0, 0, 766 },
+    { ';', 0, 0, 767 },
+    { ';', 0, 0, 768 },
+    { 'r', 2, 6422, 0 },
+    { ';', 0, 0, 769 },
+    { ';', 0, 0, 770 },
+    { 'r', 2, 6424, 0 },
+    { 'c', 1, 6426, 0 },
+    { 'p', 1, 6427, 0 },
+    { 'p', 1, 6428, 0 },
+    { 't', 1, 6429, 0 },
+    { ';', 0, 0, 771 },
+    { 'r', 2, 6430, 0 },
+    { 'e', 1, 6432, 0 },
+    { 'v', 1, 6433, 0 },
+    { 'w', 1, 6434, 0 },
+    { 'n', 1, 6435, 772 },
+    { 'a', 1, 6436, 0 },
+    { ';', 0, 0, 773 },
+    { ';', 0, 0, 774 },
+    { 'i', 1, 6437, 0 },
+    { ';', 0, 0, 775 },
+    { 'y', 1, 6438, 0 },
+    { 'r', 1, 6439, 0 },
+    { 'h', 1, 6440, 0 },
+    { ';', 0, 0, 776 },
+    { 'o', 1, 6441, 0 },
+    { ';', 0, 0, 777 },
+    { 'n', 1, 6442, 0 },
+    { 'e', 1, 6443, 0 },
+    { ';', 0, 0, 778 },
+    { 'e', 1, 6444, 0 },
+    { ';', 0, 0, 779 },
+    { 'y', 1, 6445, 0 },
+    { 't', 1, 6446, 0 },
+    { ';', 0, 0, 780 },
+    { ';', 0, 0, 781 },
+    { 'n', 1, 6447, 0 },
+    { ';', 0, 0, 782 },
+    { 'm', 1, 6448, 0 },
+    { ';', 0, 0, 783 },
+    { 'e', 2, 6449, 154 },
+    { 'x', 1, 6451, 0 },
+    { 'n', 1, 6452, 0 },
+    { 'p', 1, 6453, 0 },
+    { 'r', 1, 6454, 0 },
+    { ';', 0, 0, 784 },
+    { 'd', 1, 6455, 0 },
+    { 'n', 1, 6456, 0 },
+    { 'u', 1, 6457, 0 },
+    { 'u', 1, 6458, 0 },
+    { 'e', 1, 6459, 0 },
+    { 'r', 1, 6460, 0 },
+    { 'o', 1, 6461, 0 },
+    { 'a', 1, 6462, 0 },
+    { 'r', 1, 6463, 0 },
+    { 'n', 1, 6464, 0 },
+    { 'p', 1, 6465, 0 },
+    { 'k', 1, 6466, 0 },
+    { ';', 0, 0, 785 },
+    { ';', 0, 0, 786 },
+    { ';', 0, 0, 787 },
+    { ';', 0, 0, 788 },
+    { 'l', 1, 6467, 0 },
+    { 'a', 1, 6468, 0 },
+    { ';', 0, 0, 789 },
+    { 'e', 1, 6469, 790 },
+    { 'r', 1, 6470, 0 },
+    { 'n', 1, 6471, 0 },
+    { ';', 0, 0, 431 },
+    { 'n', 1, 6472, 0 },
+    { ';', 0, 0, 791 },
+    { 'e', 1, 6473, 792 },
+    { 't', 1, 6474, 0 },
+    { 'e', 1, 6475, 0 },
+    { 't', 1, 6476, 0 },
+    { ';', 0, 0, 793 },
+    { ';', 0, 0, 794 },
+    { 's', 1, 6477, 0 },
+    { 'v', 1, 6478, 0 },
+    { '3', 1, 6479, 0 },
+    { '4', 1, 6480, 0 },
+    { ';', 0, 0, 795 },
+    { 'l', 1, 6481, 0 },
+    { ';', 0, 0, 796 },
+    { 'o', 1, 6482, 0 },
+    { ';', 0, 0, 797 },
+    { 'c', 1, 6483, 0 },
+    { 'o', 1, 6484, 0 },
+    { ';', 0, 0, 439 },
+    { 'n', 1, 6485, 0 },
+    { 's', 1, 6486, 0 },
+    { 't', 1, 6487, 0 },
+    { ';', 0, 0, 798 },
+    { 'D', 1, 6488, 0 },
+    { 'r', 1, 6489, 0 },
+    { ';', 0, 0, 799 },
+    { ';', 0, 0, 800 },
+    { ';', 0, 0, 784 },
+    { ';', 0, 0, 801 },
+    { 't', 1, 6490, 0 },
+    { 'e', 1, 6491, 0 },
+    { 'n', 1, 6492, 0 },
+    { 'e', 1, 6493, 0 },
+    { 'g', 1, 6494, 0 },
+    { ';', 0, 0, 802 },
+    { 'g', 1, 6495, 0 },
+    { ';', 0, 0, 803 },
+    { ';', 0, 0, 804 },
+    { ';', 0, 0, 805 },
+    { ';', 0, 0, 806 },
+    { 'l', 1, 6496, 0 },
+    { ';', 0, 0, 807 },
+    { 'i', 1, 6497, 0 },
+    { '2', 1, 6498, 456 },
+    { '3', 1, 6499, 0 },
+    { '4', 1, 6500, 808 },
+    { '5', 1, 6501, 0 },
+    { '6', 1, 6502, 0 },
+    { '8', 1, 6503, 0 },
+    { '3', 1, 6504, 0 },
+    { '5', 1, 6505, 0 },
+    { '4', 1, 6506, 809 },
+    { '5', 1, 6507, 0 },
+    { '8', 1, 6508, 0 },
+    { '5', 1, 6509, 0 },
+    { '6', 1, 6510, 0 },
+    { '8', 1, 6511, 0 },
+    { '8', 1, 6512, 0 },
+    { ';', 0, 0, 810 },
+    { ';', 0, 0, 811 },
+    { 'e', 1, 6513, 0 },
+    { ';', 0, 0, 812 },
+    { 'd', 1, 6514, 0 },
+    { 'e', 1, 6515, 0 },
+    { ';', 0, 0, 813 },
+    { 'a', 1, 6516, 0 },
+    { ';', 0, 0, 814 },
+    { 't', 2, 6517, 0 },
+    { 's', 1, 6519, 0 },
+    { ';', 0, 0, 815 },
+    { 'r', 1, 6520, 0 },
+    { ';', 0, 0, 175 },
+    { ';', 0, 0, 816 },
+    { ';', 0, 0, 817 },
+    { ';', 0, 0, 818 },
+    { ';', 0, 0, 819 },
+    { ';', 0, 0, 820 },
+    { ';', 0, 0, 821 },
+    { 'r', 1, 6521, 0 },
+    { 's', 1, 6522, 0 },
+    { 'p', 1, 6523, 0 },
+    { 'r', 1, 6524, 0 },
+    { 't', 1, 6525, 0 },
+    { 'l', 1, 6526, 0 },
+    { 'q', 1, 6527, 0 },
+    { 's', 1, 6528, 0 },
+    { 'm', 1, 6529, 0 },
+    { 'n', 1, 6530, 0 },
+    { 'p', 1, 6531, 0 },
+    { 't', 1, 6532, 0 },
+    { 'y', 1, 6533, 0 },
+    { 'i', 1, 6534, 0 },
+    { ';', 0, 0, 822 },
+    { ';', 0, 0, 823 },
+    { 's', 2, 6535, 0 },
+    { 'p', 1, 6537, 0 },
+    { 'n', 1, 6538, 0 },
+    { 'r', 1, 6539, 0 },
+    { 'r', 1, 6540, 0 },
+    { ';', 0, 0, 824 },
+    { 't', 1, 6541, 0 },
+    { 'e', 1, 6542, 0 },
+    { 'i', 1, 6543, 0 },
+    { 'r', 1, 6544, 0 },
+    { 'h', 1, 6545, 0 },
+    { 'k', 1, 6546, 0 },
+    { 'l', 1, 6547, 0 },
+    { 'n', 1, 6548, 0 },
+    { 'e', 1, 6549, 825 },
+    { ';', 0, 0, 461 },
+    { ';', 0, 0, 463 },
+    { 'e', 1, 6550, 826 },
+    { 't', 1, 6551, 0 },
+    { ';', 0, 0, 598 },
+    { 'n', 1, 6552, 0 },
+    { ';', 0, 0, 827 },
+    { ';', 0, 0, 828 },
+    { ';', 0, 0, 829 },
+    { ';', 0, 0, 8 },
+    { 'i', 1, 6553, 0 },
+    { 'a', 1, 6554, 0 },
+    { ';', 0, 0, 830 },
+    { ';', 0, 0, 831 },
+    { 'e', 1, 6555, 0 },
+    { ';', 0, 0, 832 },
+    { 't', 1, 6556, 0 },
+    { 't', 1, 6557, 0 },
+    { 'l', 1, 6558, 0 },
+    { 'e', 1, 6559, 0 },
+    { 'c', 1, 6560, 0 },
+    { 'r', 1, 6561, 0 },
+    { 'o', 1, 6562, 0 },
+    { ';', 0, 0, 833 },
+    { ';', 0, 0, 834 },
+    { 't', 1, 6563, 835 },
+    { ';', 0, 0, 836 },
+    { 'o', 1, 6564, 0 },
+    { ';', 0, 0, 837 },
+    { 'v', 1, 6565, 0 },
+    { ';', 0, 0, 34 },
+    { 'e', 1, 6566, 0 },
+    { ';', 0, 0, 838 },
+    { ';', 0, 0, 839 },
+    { ';', 0, 0, 840 },
+    { 'y', 1, 6567, 0 },
+    { ';', 0, 0, 841 },
+    { ';', 0, 0, 842 },
+    { 'v', 1, 6568, 0 },
+    { 'l', 1, 6569, 0 },
+    { 'n', 1, 6570, 0 },
+    { ';', 0, 0, 843 },
+    { 'l', 1, 6571, 0 },
+    { ';', 0, 0, 844 },
+    { 'e', 1, 6572, 0 },
+    { 't', 1, 6573, 0 },
+    { 'n', 1, 6574, 0 },
+    { 'a', 1, 6575, 0 },
+    { ';', 0, 0, 845 },
+    { 'e', 1, 6576, 0 },
+    { ';', 0, 0, 478 },
+    { ';', 0, 0, 846 },
+    { 'f', 1, 6577, 0 },
+    { 's', 1, 6578, 0 },
+    { 'k', 1, 6579, 0 },
+    { 'p', 1, 6580, 0 },
+    { 'l', 1, 6581, 0 },
+    { 'i', 1, 6582, 0 },
+    { 'l', 1, 6583, 0 },
+    { 'l', 1, 6584, 0 },
+    { ';', 0, 0, 847 },
+    { ';', 0, 0, 848 },
+    { ';', 0, 0, 849 },
+    { 'e', 1, 6585, 0 },
+    { 'k', 1, 6586, 0 },
+    { ';', 0, 0, 850 },
+    { 'l', 2, 6587, 0 },
+    { 'n', 1, 6589, 0 },
+    { 'l', 1, 6590, 0 },
+    { ';', 0, 0, 851 },
+    { ';', 0, 0, 852 },
+    { 'r', 1, 6591, 0 },
+    { 'a', 1, 6592, 0 },
+    { 'h', 1, 6593, 0 },
+    { 'r', 1, 6594, 0 },
+    { 'a', 1, 6595, 0 },
+    { 'e', 1, 6596, 0 },
+    { 'i', 1, 6597, 0 },
+    { 'h', 1, 6598, 0 },
+    { 'a', 1, 6599, 0 },
+    { ';', 0, 0, 853 },
+    { 't', 2, 6600, 0 },
+    { 's', 1, 6602, 0 },
+    { 'p', 1, 6603, 0 },
+    { 'o', 1, 6604, 0 },
+    { 'q', 2, 6605, 0 },
+    { 't', 1, 6607, 0 },
+    { 'i', 1, 6608, 0 },
+    { 't', 1, 6609, 0 },
+    { 'r', 1, 6610, 0 },
+    { ';', 0, 0, 854 },
+    { ';', 0, 0, 855 },
+    { 'l', 1, 6611, 0 },
+    { ';', 0, 0, 856 },
+    { ';', 0, 0, 857 },
+    { 'n', 1, 6612, 0 },
+    { 'd', 1, 6613, 0 },
+    { ';', 0, 0, 858 },
+    { 't', 1, 6614, 0 },
+    { 't', 2, 6615, 0 },
+    { 'r', 1, 6617, 0 },
+    { ';', 0, 0, 195 },
+    { ';', 0, 0, 859 },
+    { ';', 0, 0, 860 },
+    { ';', 0, 0, 861 },
+    { ';', 0, 0, 862 },
+    { 'e', 1, 6618, 0 },
+    { 'a', 1, 6619, 0 },
+    { 'i', 1, 6620, 0 },
+    { 'r', 1, 6621, 0 },
+    { ';', 0, 0, 863 },
+    { 's', 1, 6622, 0 },
+    { 'e', 1, 6623, 0 },
+    { 't', 1, 6624, 0 },
+    { 'r', 1, 6625, 0 },
+    { 'g', 1, 6626, 0 },
+    { 't', 1, 6627, 0 },
+    { ';', 0, 0, 864 },
+    { 'n', 1, 6628, 0 },
+    { ';', 0, 0, 865 },
+    { 'd', 1, 6629, 0 },
+    { ';', 0, 0, 866 },
+    { 'o', 1, 6630, 0 },
+    { ';', 0, 0, 867 },
+    { ';', 0, 0, 868 },
+    { ';', 0, 0, 869 },
+    { 'r', 1, 6631, 0 },
+    { 'k', 1, 6632, 0 },
+    { ';', 0, 0, 870 },
+    { ';', 0, 0, 871 },
+    { 'e', 1, 6633, 0 },
+    { 's', 1, 6634, 0 },
+    { 'r', 1, 6635, 0 },
+    { 's', 1, 6636, 0 },
+    { 'r', 1, 6637, 0 },
+    { ';', 0, 0, 872 },
+    { ';', 0, 0, 873 },
+    { 'h', 1, 6638, 0 },
+    { 'a', 1, 6639, 0 },
+    { 'n', 1, 6640, 0 },
+    { ';', 0, 0, 874 },
+    { 's', 1, 6641, 0 },
+    { 'o', 4, 6642, 0 },
+    { 'r', 1, 6646, 0 },
+    { 'a', 1, 6647, 0 },
+    { ';', 0, 0, 875 },
+    { 'r', 1, 6648, 0 },
+    { ';', 0, 0, 498 },
+    { 't', 1, 6649, 0 },
+    { 'r', 1, 6650, 0 },
+    { 't', 1, 6651, 876 },
+    { ';', 0, 0, 877 },
+    { 'b', 1, 6652, 0 },
+    { 'd', 2, 6653, 0 },
+    { 's', 1, 6655, 0 },
+    { 's', 1, 6656, 0 },
+    { 's', 1, 6657, 0 },
+    { 'm', 1, 6658, 0 },
+    { ';', 0, 0, 878 },
+    { 'a', 1, 6659, 0 },
+    { 'r', 1, 6660, 0 },
+    { 't', 1, 6661, 0 },
+    { 'h', 1, 6662, 0 },
+    { 'h', 1, 6663, 0 },
+    { ';', 0, 0, 70 },
+    { 'e', 1, 6664, 0 },
+    { ';', 0, 0, 879 },
+    { ';', 0, 0, 880 },
+    { 'o', 1, 6665, 0 },
+    { ';', 0, 0, 881 },
+    { 'a', 1, 6666, 0 },
+    { ';', 0, 0, 882 },
+    { 'e', 1, 6667, 0 },
+    { 'n', 1, 6668, 0 },
+    { 'l', 1, 6669, 0 },
+    { ';', 0, 0, 883 },
+    { 'd', 1, 6670, 0 },
+    { ';', 0, 0, 884 },
+    { ';', 0, 0, 885 },
+    { 'k', 1, 6671, 0 },
+    { ';', 0, 0, 886 },
+    { 'o', 1, 6672, 0 },
+    { ';', 0, 0, 887 },
+    { 'v', 1, 6673, 0 },
+    { 'r', 1, 6674, 0 },
+    { ';', 0, 0, 888 },
+    { 't', 2, 6675, 0 },
+    { ';', 0, 0, 213 },
+    { 'l', 1, 6677, 0 },
+    { ';', 0, 0, 889 },
+    { ';', 0, 0, 890 },
+    { ';', 0, 0, 891 },
+    { ';', 0, 0, 892 },
+    { ';', 0, 0, 893 },
+    { ';', 0, 0, 894 },
+    { 'a', 1, 6678, 0 },
+    { 'r', 1, 6679, 0 },
+    { ';', 0, 0, 217 },
+    { 'l', 1, 6680, 0 },
+    { ';', 0, 0, 219 },
+    { ';', 0, 0, 895 },
+    { ';', 0, 0, 896 },
+    { 'e', 1, 6681, 0 },
+    { ';', 0, 0, 897 },
+    { 'E', 1, 6682, 0 },
+    { 'd', 1, 6683, 0 },
+    { 'v', 3, 6684, 0 },
+    { ';', 0, 0, 898 },
+    { 'v', 3, 6687, 0 },
+    { 'l', 1, 6690, 0 },
+    { 'l', 1, 6691, 0 },
+    { ';', 0, 0, 899 },
+    { 'n', 1, 6692, 0 },
+    { 'e', 1, 6693, 0 },
+    { ';', 0, 0, 220 },
+    { 'e', 1, 6694, 0 },
+    { ';', 0, 0, 900 },
+    { ';', 0, 0, 901 },
+    { 'c', 1, 6695, 0 },
+    { 'w', 1, 6696, 0 },
+    { 't', 1, 6697, 0 },
+    { ';', 0, 0, 902 },
+    { 'e', 1, 6698, 0 },
+    { 'e', 1, 6699, 0 },
+    { 't', 2, 6700, 0 },
+    { ';', 0, 0, 903 },
+    { 'q', 1, 6702, 0 },
+    { ';', 0, 0, 514 },
+    { ';', 0, 0, 516 },
+    { 'b', 1, 6703, 0 },
+    { 'p', 1, 6704, 0 },
+    { ';', 0, 0, 904 },
+    { ';', 0, 0, 905 },
+    { 'e', 1, 6705, 0 },
+    { ';', 0, 0, 221 },
+    { 'e', 1, 6706, 0 },
+    { ';', 0, 0, 906 },
+    { ';', 0, 0, 907 },
+    { 'e', 1, 6707, 0 },
+    { 'e', 1, 6708, 908 },
+    { 'n', 1, 6709, 0 },
+    { 'o', 1, 6710, 0 },
+    { ';', 0, 0, 909 },
+    { 'h', 1, 6711, 0 },
+    { 'r', 1, 6712, 0 },
+    { 'h', 1, 6713, 0 },
+    { 'i', 1, 6714, 0 },
+    { 'r', 1, 6715, 0 },
+    { 'i', 1, 6716, 0 },
+    { 'r', 1, 6717, 0 },
+    { 'i', 1, 6718, 0 },
+    { ';', 0, 0, 910 },
+    { ';', 0, 0, 911 },
+    { 'k', 1, 6719, 0 },
+    { ';', 0, 0, 912 },
+    { 'o', 1, 6720, 0 },
+    { 'r', 1, 6721, 0 },
+    { 'e', 1, 6722, 913 },
+    { ';', 0, 0, 532 },
+    { ';', 0, 0, 914 },
+    { 'c', 1, 6723, 0 },
+    { 'd', 1, 6724, 0 },
+    { ';', 0, 0, 915 },
+    { ';', 0, 0, 916 },
+    { 'e', 1, 6725, 917 },
+    { ';', 0, 0, 918 },
+    { ';', 0, 0, 919 },
+    { ';', 0, 0, 920 },
+    { 's', 1, 6726, 0 },
+    { ';', 0, 0, 921 },
+    { ';', 0, 0, 922 },
+    { ';', 0, 0, 923 },
+    { 'o', 1, 6727, 0 },
+    { 's', 1, 6728, 0 },
+    { ';', 0, 0, 924 },
+    { ';', 0, 0, 925 },
+    { ';', 0, 0, 926 },
+    { ';', 0, 0, 541 },
+    { 'o', 1, 6729, 0 },
+    { 'f', 1, 6730, 0 },
+    { 'p', 1, 6731, 0 },
+    { 'h', 1, 6732, 927 },
+    { 'e', 1, 6733, 928 },
+    { 's', 2, 6734, 0 },
+    { ';', 0, 0, 929 },
+    { 'l', 1, 6736, 0 },
+    { 'm', 1, 6737, 0 },
+    { ';', 0, 0, 930 },
+    { 't', 1, 6738, 0 },
+    { 'd', 1, 6739, 0 },
+    { 'l', 1, 6740, 0 },
+    { 'n', 1, 6741, 0 },
+    { 't', 1, 6742, 0 },
+    { ';', 0, 0, 931 },
+    { 'f', 1, 6743, 0 },
+    { 'k', 2, 6744, 0 },
+    { 'v', 1, 6746, 0 },
+    { 'c', 1, 6747, 0 },
+    { ';', 0, 0, 932 },
+    { 'i', 1, 6748, 0 },
+    { 'o', 1, 6749, 0 },
+    { 'u', 1, 6750, 0 },
+    { ';', 0, 0, 933 },
+    { 'n', 1, 6751, 48 },
+    { 'i', 1, 6752, 0 },
+    { 'w', 1, 6753, 0 },
+    { 'i', 1, 6754, 0 },
+    { ';', 0, 0, 547 },
+    { ';', 0, 0, 934 },
+    { 'p', 1, 6755, 0 },
+    { 'u', 1, 6756, 0 },
+    { 'q', 1, 6757, 0 },
+    { 'a', 1, 6758, 0 },
+    { 'e', 1, 6759, 0 },
+    { 's', 1, 6760, 0 },
+    { 'i', 1, 6761, 0 },
+    { ';', 0, 0, 935 },
+    { 's', 1, 6762, 0 },
+    { ';', 0, 0, 936 },
+    { 'm', 1, 6763, 0 },
+    { 'l', 1, 6764, 0 },
+    { 'i', 1, 6765, 0 },
+    { 'u', 1, 6766, 0 },
+    { 'o', 1, 6767, 0 },
+    { ';', 0, 0, 937 },
+    { 'l', 1, 6768, 0 },
+    { 'p', 1, 6769, 0 },
+    { 'e', 1, 6770, 0 },
+    { 'r', 1, 6771, 0 },
+    { 'n', 1, 6772, 0 },
+    { ';', 0, 0, 938 },
+    { 'e', 1, 6773, 0 },
+    { ';', 0, 0, 939 },
+    { 'l', 1, 6774, 0 },
+    { ';', 0, 0, 940 },
+    { 'e', 1, 6775, 0 },
+    { ';', 0, 0, 346 },
+    { 't', 1, 6776, 0 },
+    { ';', 0, 0, 941 },
+    { ';', 0, 0, 942 },
+    { 'e', 1, 6777, 0 },
+    { ';', 0, 0, 560 },
+    { 'p', 1, 6778, 0 },
+    { ';', 0, 0, 943 },
+    { 'f', 1, 6779, 0 },
+    { ';', 0, 0, 944 },
+    { 's', 1, 6780, 0 },
+    { 'k', 1, 6781, 0 },
+    { 'p', 1, 6782, 0 },
+    { 'l', 1, 6783, 0 },
+    { 'i', 1, 6784, 0 },
+    { 'l', 1, 6785, 0 },
+    { ';', 0, 0, 945 },
+    { 'l', 1, 6786, 0 },
+    { ';', 0, 0, 946 },
+    { 'n', 1, 6787, 0 },
+    { ';', 0, 0, 947 },
+    { ';', 0, 0, 948 },
+    { 'e', 1, 6788, 0 },
+    { 'k', 1, 6789, 0 },
+    { ';', 0, 0, 949 },
+    { 'l', 2, 6790, 0 },
+    { 'n', 1, 6792, 0 },
+    { 'l', 1, 6793, 0 },
+    { ';', 0, 0, 950 },
+    { 'a', 1, 6794, 0 },
+    { ';', 0, 0, 951 },
+    { 'r', 1, 6795, 0 },
+    { 'n', 1, 6796, 0 },
+    { 'a', 1, 6797, 0 },
+    { ';', 0, 0, 342 },
+    { 't', 1, 6798, 0 },
+    { 'r', 1, 6799, 0 },
+    { ';', 0, 0, 952 },
+    { ';', 0, 0, 953 },
+    { 'l', 1, 6800, 0 },
+    { 'a', 1, 6801, 0 },
+    { 'h', 1, 6802, 0 },
+    { 'l', 1, 6803, 0 },
+    { 'r', 1, 6804, 0 },
+    { 's', 1, 6805, 0 },
+    { 't', 1, 6806, 0 },
+    { 'g', 1, 6807, 0 },
+    { ';', 0, 0, 954 },
+    { ';', 0, 0, 955 },
+    { 't', 2, 6808, 0 },
+    { ';', 0, 0, 956 },
+    { ';', 0, 0, 957 },
+    { ';', 0, 0, 958 },
+    { ';', 0, 0, 959 },
+    { ';', 0, 0, 960 },
+    { 's', 1, 6810, 0 },
+    { 'e', 1, 6811, 0 },
+    { 't', 1, 6812, 0 },
+    { 'i', 1, 6813, 0 },
+    { ';', 0, 0, 961 },
+    { 'o', 1, 6814, 0 },
+    { ';', 0, 0, 962 },
+    { 'r', 1, 6815, 0 },
+    { 'e', 1, 6816, 0 },
+    { 's', 1, 6817, 0 },
+    { ';', 0, 0, 963 },
+    { ';', 0, 0, 964 },
+    { 't', 1, 6818, 0 },
+    { 'a', 1, 6819, 0 },
+    { 'e', 1, 6820, 0 },
+    { ';', 0, 0, 965 },
+    { 'n', 1, 6821, 0 },
+    { ';', 0, 0, 966 },
+    { 'l', 1, 6822, 0 },
+    { ';', 0, 0, 967 },
+    { ';', 0, 0, 968 },
+    { 'm', 1, 6823, 0 },
+    { 'i', 1, 6824, 0 },
+    { ';', 0, 0, 969 },
+    { ';', 0, 0, 970 },
+    { ';', 0, 0, 971 },
+    { ';', 0, 0, 972 },
+    { 'k', 1, 6825, 0 },
+    { ';', 0, 0, 973 },
+    { 'o', 1, 6826, 0 },
+    { 'r', 1, 6827, 0 },
+    { 'n', 1, 6828, 0 },
+    { ';', 0, 0, 974 },
+    { 'n', 1, 6829, 0 },
+    { ';', 0, 0, 975 },
+    { 'y', 1, 6830, 0 },
+    { 'm', 1, 6831, 0 },
+    { 'p', 1, 6832, 0 },
+    { ';', 0, 0, 976 },
+    { 'f', 1, 6833, 0 },
+    { 'v', 1, 6834, 0 },
+    { 't', 1, 6835, 0 },
+    { ';', 0, 0, 579 },
+    { ';', 0, 0, 977 },
+    { ';', 0, 0, 978 },
+    { ';', 0, 0, 979 },
+    { 'u', 1, 6836, 0 },
+    { 'r', 1, 6837, 0 },
+    { ';', 0, 0, 479 },
+    { 's', 1, 6838, 0 },
+    { 'p', 1, 6839, 0 },
+    { 'r', 1, 6840, 0 },
+    { ';', 0, 0, 980 },
+    { ';', 0, 0, 981 },
+    { 'y', 1, 6841, 0 },
+    { 'r', 1, 6842, 0 },
+    { 's', 2, 6843, 0 },
+    { ';', 0, 0, 982 },
+    { 's', 1, 6845, 0 },
+    { ';', 0, 0, 983 },
+    { 's', 1, 6846, 0 },
+    { ';', 0, 0, 984 },
+    { 'e', 1, 6847, 0 },
+    { 's', 1, 6848, 0 },
+    { ';', 0, 0, 985 },
+    { 'e', 1, 6849, 0 },
+    { 's', 1, 6850, 0 },
+    { 'e', 1, 6851, 0 },
+    { 'f', 1, 6852, 0 },
+    { ';', 0, 0, 561 },
+    { 'n', 1, 6853, 0 },
+    { 'e', 1, 6854, 0 },
+    { 'f', 1, 6855, 0 },
+    { ';', 0, 0, 986 },
+    { 'g', 1, 6856, 0 },
+    { ';', 0, 0, 199 },
+    { 't', 1, 6857, 0 },
+    { 'o', 1, 6858, 0 },
+    { 'l', 1, 6859, 0 },
+    { ';', 0, 0, 987 },
+    { ';', 0, 0, 988 },
+    { 'u', 1, 6860, 0 },
+    { 'r', 1, 6861, 0 },
+    { 't', 3, 6862, 0 },
+    { 'm', 1, 6865, 0 },
+    { 'b', 1, 6866, 0 },
+    { 'p', 1, 6867, 0 },
+    { 'p', 1, 6868, 0 },
+    { 'u', 1, 6869, 0 },
+    { 'q', 1, 6870, 0 },
+    { 'a', 1, 6871, 0 },
+    { 'e', 1, 6872, 0 },
+    { 's', 1, 6873, 0 },
+    { 'i', 1, 6874, 0 },
+    { 't', 1, 6875, 0 },
+    { 'u', 1, 6876, 0 },
+    { 'o', 1, 6877, 0 },
+    { 'o', 1, 6878, 0 },
+    { 'u', 1, 6879, 0 },
+    { 'r', 1, 6880, 0 },
+    { 'l', 1, 6881, 0 },
+    { ';', 0, 0, 989 },
+    { ';', 0, 0, 990 },
+    { 'u', 1, 6882, 0 },
+    { 't', 3, 6883, 0 },
+    { 'm', 1, 6886, 0 },
+    { 'b', 1, 6887, 0 },
+    { 'p', 1, 6888, 0 },
+    { ';', 0, 0, 991 },
+    { 'k', 1, 6889, 0 },
+    { ';', 0, 0, 992 },
+    { 'o', 1, 6890, 0 },
+    { 'r', 1, 6891, 0 },
+    { ';', 0, 0, 593 },
+    { 't', 1, 6892, 0 },
+    { 'n', 1, 6893, 0 },
+    { 'l', 1, 6894, 0 },
+    { 'c', 1, 6895, 0 },
+    { '4', 1, 6896, 0 },
+    { 'f', 1, 6897, 0 },
+    { ';', 0, 0, 993 },
+    { 's', 1, 6898, 0 },
+    { 'v', 1, 6899, 0 },
+    { 'a', 1, 6900, 0 },
+    { 's', 1, 6901, 0 },
+    { 'p', 1, 6902, 0 },
+    { ';', 0, 0, 22 },
+    { 'm', 1, 6903, 0 },
+    { ';', 0, 0, 596 },
+    { ';', 0, 0, 994 },
+    { ';', 0, 0, 597 },
+    { 'b', 2, 6904, 0 },
+    { 'd', 1, 6906, 0 },
+    { 't', 1, 6907, 0 },
+    { 'r', 1, 6908, 0 },
+    { 'r', 1, 6909, 0 },
+    { 'e', 1, 6910, 0 },
+    { ';', 0, 0, 680 },
+    { 'g', 1, 6911, 0 },
+    { 't', 1, 6912, 0 },
+    { 'n', 1, 6913, 0 },
+    { 'u', 1, 6914, 0 },
+    { ';', 0, 0, 995 },
+    { 'm', 1, 6915, 0 },
+    { 'i', 1, 6916, 0 },
+    { ';', 0, 0, 996 },
+    { 'k', 1, 6917, 0 },
+    { ';', 0, 0, 997 },
+    { 'a', 1, 6918, 0 },
+    { 'e', 1, 6919, 998 },
+    { ';', 0, 0, 999 },
+    { 'e', 1, 6920, 0 },
+    { ';', 0, 0, 608 },
+    { ';', 0, 0, 1000 },
+    { 'c', 1, 6921, 0 },
+    { ';', 0, 0, 1001 },
+    { 't', 1, 6922, 0 },
+    { 'e', 1, 6923, 1002 },
+    { ';', 0, 0, 1003 },
+    { ';', 0, 0, 1004 },
+    { ';', 0, 0, 1005 },
+    { 'n', 2, 6924, 0 },
+    { 'p', 1, 6926, 0 },
+    { ';', 0, 0, 1006 },
+    { ';', 0, 0, 1007 },
+    { ';', 0, 0, 1008 },
+    { 'o', 1, 6927, 0 },
+    { 'n', 1, 6928, 0 },
+    { 'p', 1, 6929, 0 },
+    { ';', 0, 0, 1009 },
+    { ';', 0, 0, 356 },
+    { 'o', 1, 6930, 0 },
+    { 'r', 1, 6931, 0 },
+    { 'n', 2, 6932, 0 },
+    { 'p', 1, 6934, 0 },
+    { ';', 0, 0, 1010 },
+    { ';', 0, 0, 1011 },
+    { ';', 0, 0, 1012 },
+    { 'e', 1, 6935, 0 },
+    { ';', 0, 0, 1013 },
+    { ';', 0, 0, 1014 },
+    { 'l', 1, 6936, 0 },
+    { ';', 0, 0, 1015 },
+    { ';', 0, 0, 1016 },
+    { 't', 1, 6937, 0 },
+    { 's', 1, 6938, 0 },
+    { 'p', 1, 6939, 0 },
+    { 't', 1, 6940, 0 },
+    { 'i', 1, 6941, 0 },
+    { ';', 0, 0, 238 },
+    { 'o', 1, 6942, 0 },
+    { 'o', 1, 6943, 0 },
+    { 'g', 1, 6944, 0 },
+    { 'b', 1, 6945, 0 },
+    { 'p', 1, 6946, 0 },
+    { 'e', 1, 6947, 0 },
+    { 'i', 1, 6948, 0 },
+    { ';', 0, 0, 1017 },
+    { 'r', 1, 6949, 0 },
+    { ';', 0, 0, 1018 },
+    { 'p', 1, 6950, 0 },
+    { 'r', 1, 6951, 0 },
+    { ';', 0, 0, 1019 },
+    { ';', 0, 0, 1020 },
+    { ';', 0, 0, 1021 },
+    { ';', 0, 0, 551 },
+    { ';', 0, 0, 1022 },
+    { 'E', 1, 6952, 0 },
+    { 'e', 1, 6953, 0 },
+    { 'E', 1, 6954, 0 },
+    { 'e', 1, 6955, 0 },
+    { 'a', 1, 6956, 0 },
+    { ';', 0, 0, 1023 },
+    { 'r', 1, 6957, 0 },
+    { ';', 0, 0, 136 },
+    { 'q', 1, 6958, 0 },
+    { 'p', 1, 6959, 0 },
+    { 'h', 1, 6960, 0 },
+    { ';', 0, 0, 1024 },
+    { ';', 0, 0, 1025 },
+    { ';', 0, 0, 1026 },
+    { ';', 0, 0, 1027 },
+    { ';', 0, 0, 1028 },
+    { ';', 0, 0, 1029 },
+    { ';', 0, 0, 1030 },
+    { 's', 1, 6961, 0 },
+    { 'e', 1, 6962, 0 },
+    { ';', 0, 0, 1031 },
+    { ';', 0, 0, 1032 },
+    { 'p', 1, 6963, 0 },
+    { 's', 1, 6964, 0 },
+    { ';', 0, 0, 1033 },
+    { 'e', 1, 6965, 0 },
+    { 'e', 1, 6966, 1034 },
+    { ';', 0, 0, 1035 },
+    { 'e', 1, 6967, 0 },
+    { 'n', 1, 6968, 0 },
+    { 'f', 1, 6969, 0 },
+    { 'r', 1, 6970, 0 },
+    { ';', 0, 0, 638 },
+    { ';', 0, 0, 1036 },
+    { ';', 0, 0, 639 },
+    { 'u', 1, 6971, 0 },
+    { ';', 0, 0, 1037 },
+    { ';', 0, 0, 643 },
+    { 'a', 1, 6972, 0 },
+    { ';', 0, 0, 1038 },
+    { 'e', 1, 6973, 0 },
+    { 'l', 1, 6974, 0 },
+    { ';', 0, 0, 402 },
+    { ';', 0, 0, 1039 },
+    { 'l', 1, 6975, 0 },
+    { 's', 1, 6976, 0 },
+    { ';', 0, 0, 1040 },
+    { ';', 0, 0, 645 },
+    { 't', 1, 6977, 0 },
+    { 'a', 1, 6978, 0 },
+    { 'D', 1, 6979, 0 },
+    { 'D', 1, 6980, 0 },
+    { 'M', 1, 6981, 0 },
+    { 'P', 1, 6982, 0 },
+    { 'T', 1, 6983, 0 },
+    { 'i', 1, 6984, 0 },
+    { 'u', 1, 6985, 0 },
+    { ';', 0, 0, 1041 },
+    { 'e', 1, 6986, 0 },
+    { ';', 0, 0, 1042 },
+    { 'r', 1, 6987, 0 },
+    { 'u', 1, 6988, 0 },
+    { 'r', 1, 6989, 0 },
+    { ';', 0, 0, 1043 },
+    { 'h', 1, 6990, 0 },
+    { ';', 0, 0, 1044 },
+    { ';', 0, 0, 1045 },
+    { 't', 1, 6991, 0 },
+    { 'd', 1, 6992, 0 },
+    { 'e', 1, 6993, 0 },
+    { ';', 0, 0, 1046 },
+    { 'a', 1, 6994, 0 },
+    { 'C', 1, 6995, 0 },
+    { 'D', 1, 6996, 0 },
+    { 'L', 2, 6997, 0 },
+    { 'R', 1, 6999, 0 },
+    { 'U', 1, 7000, 0 },
+    { 'V', 1, 7001, 0 },
+    { 'r', 1, 7002, 0 },
+    { 'e', 1, 7003, 0 },
+    { 'f', 1, 7004, 0 },
+    { 'g', 1, 7005, 0 },
+    { 'e', 2, 7006, 0 },
+    { 'r', 1, 7008, 0 },
+    { ';', 0, 0, 1047 },
+    { ';', 0, 0, 651 },
+    { ';', 0, 0, 1048 },
+    { ';', 0, 0, 652 },
+    { 't', 1, 7009, 0 },
+    { 'm', 1, 7010, 0 },
+    { 'e', 1, 7011, 0 },
+    { 'n', 1, 7012, 0 },
+    { 'i', 1, 7013, 0 },
+    { 'b', 1, 7014, 0 },
+    { ';', 0, 0, 801 },
+    { 'n', 1, 7015, 0 },
+    { 'S', 1, 7016, 0 },
+    { 'V', 1, 7017, 0 },
+    { ';', 0, 0, 1049 },
+    { 'r', 1, 7018, 0 },
+    { ';', 0, 0, 1050 },
+    { ';', 0, 0, 1051 },
+    { ';', 0, 0, 1052 },
+    { 'r', 6, 7019, 0 },
+    { ';', 0, 0, 1053 },
+    { 't', 1, 7025, 0 },
+    { 'n', 1, 7026, 0 },
+    { ';', 0, 0, 1054 },
+    { 'w', 1, 7027, 0 },
+    { 'u', 1, 7028, 0 },
+    { ';', 0, 0, 661 },
+    { ';', 0, 0, 662 },
+    { 'a', 1, 7029, 0 },
+    { 's', 1, 7030, 0 },
+    { 'a', 1, 7031, 0 },
+    { 'e', 1, 7032, 0 },
+    { 'b', 1, 7033, 0 },
+    { ';', 0, 0, 1055 },
+    { ';', 0, 0, 1056 },
+    { ';', 0, 0, 1057 },
+    { ';', 0, 0, 1058 },
+    { ';', 0, 0, 1059 },
+    { 'e', 1, 7034, 0 },
+    { ';', 0, 0, 1060 },
+    { ';', 0, 0, 1061 },
+    { 'g', 1, 7035, 0 },
+    { 'r', 1, 7036, 0 },
+    { 'i', 1, 7037, 0 },
+    { 'u', 1, 7038, 0 },
+    { 'w', 1, 7039, 0 },
+    { 'o', 1, 7040, 0 },
+    { 'g', 1, 7041, 0 },
+    { 'e', 3, 7042, 0 },
+    { 'i', 1, 7045, 0 },
+    { 'D', 1, 7046, 0 },
+    { 'T', 1, 7047, 0 },
+    { 'V', 1, 7048, 0 },
+    { 'c', 1, 7049, 0 },
+    { 'r', 1, 7050, 0 },
+    { 'g', 1, 7051, 0 },
+    { 'u', 1, 7052, 0 },
+    { 'l', 1, 7053, 0 },
+    { 'e', 1, 7054, 0 },
+    { 's', 1, 7055, 0 },
+    { 'a', 1, 7056, 0 },
+    { 'l', 1, 7057, 0 },
+    { 'r', 1, 7058, 0 },
+    { ';', 0, 0, 1062 },
+    { 'f', 1, 7059, 0 },
+    { 'g', 1, 7060, 0 },
+    { 'f', 1, 7061, 0 },
+    { 'g', 1, 7062, 0 },
+    { 'e', 1, 7063, 0 },
+    { 'i', 1, 7064, 0 },
+    { ';', 0, 0, 1063 },
+    { 'S', 1, 7065, 0 },
+    { 't', 1, 7066, 0 },
+    { 'l', 1, 7067, 0 },
+    { ';', 0, 0, 1064 },
+    { ';', 0, 0, 1065 },
+    { ';', 0, 0, 1066 },
+    { 'v', 1, 7068, 0 },
+    { 'G', 1, 7069, 0 },
+    { 'L', 1, 7070, 0 },
+    { 'e', 1, 7071, 0 },
+    { 'k', 1, 7072, 0 },
+    { 'a', 1, 7073, 0 },
+    { 'g', 1, 7074, 0 },
+    { 'C', 1, 7075, 0 },
+    { 'b', 1, 7076, 0 },
+    { 'm', 1, 7077, 0 },
+    { 'a', 1, 7078, 0 },
+    { 's', 1, 7079, 0 },
+    { 'a', 1, 7080, 0 },
+    { 'p', 2, 7081, 0 },
+    { 't', 1, 7083, 0 },
+    { 's', 6, 7084, 0 },
+    { 't', 1, 7090, 0 },
+    { 'c', 1, 7091, 0 },
+    { 'e', 1, 7092, 0 },
+    { 'h', 1, 7093, 0 },
+    { 'a', 1, 7094, 0 },
+    { 's', 1, 7095, 0 },
+    { 'c', 1, 7096, 0 },
+    { 'e', 1, 7097, 0 },
+    { 'd', 1, 7098, 0 },
+    { 't', 1, 7099, 0 },
+    { ';', 0, 0, 669 },
+    { ';', 0, 0, 671 },
+    { ';', 0, 0, 1067 },
+    { ';', 0, 0, 672 },
+    { 'n', 1, 7100, 0 },
+    { 'r', 1, 7101, 0 },
+    { ';', 0, 0, 674 },
+    { ';', 0, 0, 675 },
+    { ';', 0, 0, 1068 },
+    { 'r', 1, 7102, 0 },
+    { 'a', 1, 7103, 0 },
+    { 'r', 1, 7104, 0 },
+    { 'l', 1, 7105, 0 },
+    { 'n', 1, 7106, 0 },
+    { 'r', 1, 7107, 0 },
+    { 'e', 1, 7108, 0 },
+    { 't', 1, 7109, 0 },
+    { 't', 1, 7110, 0 },
+    { ';', 0, 0, 1069 },
+    { ';', 0, 0, 1070 },
+    { ';', 0, 0, 1071 },
+    { ';', 0, 0, 1072 },
+    { 'e', 2, 7111, 0 },
+    { 'n', 1, 7113, 0 },
+    { 'r', 1, 7114, 0 },
+    { 'e', 1, 7115, 0 },
+    { 'o', 2, 7116, 0 },
+    { 'l', 1, 7118, 0 },
+    { 'e', 1, 7119, 0 },
+    { 'r', 1, 7120, 0 },
+    { 'p', 3, 7121, 0 },
+    { 'e', 1, 7124, 0 },
+    { 'r', 1, 7125, 0 },
+    { 'm', 1, 7126, 0 },
+    { 'a', 1, 7127, 0 },
+    { 'l', 1, 7128, 0 },
+    { ';', 0, 0, 1073 },
+    { ';', 0, 0, 1074 },
+    { ';', 0, 0, 1075 },
+    { ';', 0, 0, 1076 },
+    { ';', 0, 0, 1077 },
+    { 'o', 1, 7129, 0 },
+    { 'e', 1, 7130, 0 },
+    { 'i', 1, 7131, 0 },
+    { 'p', 1, 7132, 0 },
+    { 'i', 1, 7133, 0 },
+    { ';', 0, 0, 255 },
+    { 'I', 1, 7134, 0 },
+    { 'S', 1, 7135, 0 },
+    { 'U', 1, 7136, 0 },
+    { ';', 0, 0, 113 },
+    { 'E', 1, 7137, 0 },
+    { 'd', 1, 7138, 0 },
+    { 'a', 1, 7139, 0 },
+    { 'e', 1, 7140, 0 },
+    { ';', 0, 0, 115 },
+    { ';', 0, 0, 1078 },
+    { ';', 0, 0, 1079 },
+    { 'o', 1, 7141, 0 },
+    { 'p', 1, 7142, 0 },
+    { 'a', 1, 7143, 0 },
+    { 'q', 1, 7144, 0 },
+    { 'u', 1, 7145, 0 },
+    { 'i', 1, 7146, 0 },
+    { 'D', 1, 7147, 0 },
+    { ';', 0, 0, 1080 },
+    { ';', 0, 0, 683 },
+    { 'i', 1, 7148, 0 },
+    { ';', 0, 0, 1081 },
+    { ';', 0, 0, 1082 },
+    { ';', 0, 0, 685 },
+    { 'a', 1, 7149, 0 },
+    { 'r', 1, 7150, 0 },
+    { 'a', 1, 7151, 0 },
+    { 'l', 1, 7152, 0 },
+    { 'w', 3, 7153, 0 },
+    { 'A', 1, 7156, 0 },
+    { 'l', 1, 7157, 0 },
+    { 'r', 1, 7158, 0 },
+    { 'w', 1, 7159, 0 },
+    { 'a', 1, 7160, 0 },
+    { 'e', 1, 7161, 0 },
+    { 'i', 1, 7162, 0 },
+    { 'n', 1, 7163, 0 },
+    { ';', 0, 0, 1083 },
+    { ';', 0, 0, 1084 },
+    { ';', 0, 0, 359 },
+    { 'a', 1, 7164, 0 },
+    { 'i', 1, 7165, 0 },
+    { ';', 0, 0, 1085 },
+    { ';', 0, 0, 693 },
+    { ';', 0, 0, 1086 },
+    { ';', 0, 0, 1087 },
+    { 'd', 1, 7166, 0 },
+    { ';', 0, 0, 695 },
+    { ';', 0, 0, 1088 },
+    { ';', 0, 0, 696 },
+    { 'm', 1, 7167, 0 },
+    { ';', 0, 0, 1089 },
+    { 'p', 1, 7168, 0 },
+    { ';', 0, 0, 1090 },
+    { 'a', 8, 7169, 0 },
+    { 'b', 2, 7177, 0 },
+    { ';', 0, 0, 1091 },
+    { 'r', 1, 7179, 0 },
+    { ';', 0, 0, 1092 },
+    { ';', 0, 0, 22 },
+    { 'e', 1, 7180, 0 },
+    { 'q', 1, 7181, 0 },
+    { ';', 0, 0, 703 },
+    { 'n', 1, 7182, 0 },
+    { 'n', 1, 7183, 0 },
+    { 's', 1, 7184, 0 },
+    { 'i', 1, 7185, 0 },
+    { 'm', 2, 7186, 0 },
+    { ';', 0, 0, 1093 },
+    { ';', 0, 0, 1094 },
+    { 'g', 1, 7188, 0 },
+    { 'r', 1, 7189, 0 },
+    { ';', 0, 0, 1095 },
+    { 'e', 1, 7190, 0 },
+    { 'v', 1, 7191, 0 },
+    { ';', 0, 0, 286 },
+    { 'n', 1, 7192, 0 },
+    { ';', 0, 0, 621 },
+    { 'c', 1, 7193, 0 },
+    { ';', 0, 0, 622 },
+    { 't', 1, 7194, 0 },
+    { 'u', 1, 7195, 0 },
+    { 'm', 1, 7196, 0 },
+    { 'u', 1, 7197, 0 },
+    { 'r', 1, 7198, 0 },
+    { 'a', 1, 7199, 0 },
+    { 'u', 1, 7200, 0 },
+    { ';', 0, 0, 124 },
+    { 'g', 1, 7201, 0 },
+    { ';', 0, 0, 947 },
+    { 'o', 1, 7202, 0 },
+    { 'q', 1, 7203, 0 },
+    { 'r', 1, 7204, 0 },
+    { 'v', 1, 7205, 0 },
+    { ';', 0, 0, 145 },
+    { ';', 0, 0, 1096 },
+    { ';', 0, 0, 1097 },
+    { 'u', 1, 7206, 0 },
+    { 's', 1, 7207, 0 },
+    { 'e', 1, 7208, 0 },
+    { ';', 0, 0, 1098 },
+    { ';', 0, 0, 749 },
+    { 'u', 1, 7209, 0 },
+    { ';', 0, 0, 401 },
+    { ';', 0, 0, 754 },
+    { ';', 0, 0, 1099 },
+    { ';', 0, 0, 1100 },
+    { 'u', 1, 7210, 0 },
+    { ';', 0, 0, 1101 },
+    { ';', 0, 0, 1102 },
+    { ';', 0, 0, 1103 },
+    { ';', 0, 0, 1104 },
+    { ';', 0, 0, 757 },
+    { 'm', 1, 7211, 0 },
+    { 'v', 1, 7212, 0 },
+    { 'd', 1, 7213, 0 },
+    { 'a', 1, 7214, 0 },
+    { ';', 0, 0, 409 },
+    { 'a', 1, 7215, 0 },
+    { 'd', 5, 7216, 0 },
+    { 'n', 1, 7221, 0 },
+    { ';', 0, 0, 1105 },
+    { 'r', 1, 7222, 0 },
+    { 'i', 1, 7223, 0 },
+    { ';', 0, 0, 1037 },
+    { 'q', 1, 7224, 0 },
+    { ';', 0, 0, 1106 },
+    { ';', 0, 0, 1107 },
+    { 'm', 1, 7225, 0 },
+    { 'x', 1, 7226, 0 },
+    { 't', 1, 7227, 0 },
+    { ';', 0, 0, 536 },
+    { ';', 0, 0, 1108 },
+    { ';', 0, 0, 1109 },
+    { 'l', 1, 7228, 0 },
+    { 'r', 1, 7229, 0 },
+    { ';', 0, 0, 1110 },
+    { 'p', 1, 7230, 0 },
+    { 'a', 1, 7231, 0 },
+    { ';', 0, 0, 1111 },
+    { ';', 0, 0, 1112 },
+    { ';', 0, 0, 1113 },
+    { ';', 0, 0, 1114 },
+    { 'm', 1, 7232, 0 },
+    { 'q', 2, 7233, 0 },
+    { 'e', 1, 7235, 0 },
+    { 'e', 1, 7236, 0 },
+    { ';', 0, 0, 772 },
+    { 'r', 1, 7237, 0 },
+    { 'n', 1, 7238, 0 },
+    { ';', 0, 0, 1115 },
+    { ';', 0, 0, 1116 },
+    { ';', 0, 0, 1117 },
+    { 'w', 1, 7239, 0 },
+    { ';', 0, 0, 1118 },
+    { 'r', 1, 7240, 0 },
+    { 'q', 1, 7241, 0 },
+    { 'v', 1, 7242, 0 },
+    { ';', 0, 0, 1119 },
+    { 'd', 2, 7243, 0 },
+    { 'a', 1, 7245, 0 },
+    { ';', 0, 0, 154 },
+    { 'o', 1, 7246, 0 },
+    { ';', 0, 0, 1120 },
+    { ';', 0, 0, 1121 },
+    { ';', 0, 0, 1122 },
+    { ';', 0, 0, 1123 },
+    { 'o', 1, 7247, 0 },
+    { 'u', 1, 7248, 0 },
+    { 's', 1, 7249, 0 },
+    { 'a', 1, 7250, 0 },
+    { 'b', 1, 7251, 0 },
+    { 'r', 1, 7252, 0 },
+    { 'w', 1, 7253, 0 },
+    { 'r', 1, 7254, 0 },
+    { 'o', 1, 7255, 0 },
+    { ';', 0, 0, 1124 },
+    { ';', 0, 0, 1125 },
+    { ';', 0, 0, 1126 },
+    { 'e', 1, 7256, 0 },
+    { 'r', 1, 7257, 0 },
+    { ';', 0, 0, 790 },
+    { ';', 0, 0, 1127 },
+    { ';', 0, 0, 1128 },
+    { ';', 0, 0, 1129 },
+    { ';', 0, 0, 792 },
+    { ';', 0, 0, 1130 },
+    { 'r', 1, 7258, 0 },
+    { ';', 0, 0, 1131 },
+    { 'e', 1, 7259, 0 },
+    { ';', 0, 0, 794 },
+    { ';', 0, 0, 1132 },
+    { ';', 0, 0, 1133 },
+    { ';', 0, 0, 1134 },
+    { 'n', 1, 7260, 0 },
+    { ';', 0, 0, 430 },
+    { 'n', 1, 7261, 0 },
+    { 't', 2, 7262, 0 },
+    { ';', 0, 0, 1135 },
+    { ';', 0, 0, 1136 },
+    { 'D', 1, 7264, 0 },
+    { 's', 1, 7265, 0 },
+    { 'a', 1, 7266, 0 },
+    { 'n', 1, 7267, 0 },
+    { 'g', 1, 7268, 0 },
+    { ';', 0, 0, 1137 },
+    { ';', 0, 0, 1138 },
+    { ';', 0, 0, 1139 },
+    { ';', 0, 0, 1049 },
+    { 'n', 1, 7269, 0 },
+    { ';', 0, 0, 456 },
+    { ';', 0, 0, 1140 },
+    { ';', 0, 0, 808 },
+    { ';', 0, 0, 1141 },
+    { ';', 0, 0, 1142 },
+    { ';', 0, 0, 1143 },
+    { ';', 0, 0, 1144 },
+    { ';', 0, 0, 1145 },
+    { ';', 0, 0, 809 },
+    { ';', 0, 0, 1146 },
+    { ';', 0, 0, 1147 },
+    { ';', 0, 0, 1148 },
+    { ';', 0, 0, 1149 },
+    { ';', 0, 0, 1150 },
+    { ';', 0, 0, 1151 },
+    { ';', 0, 0, 1152 },
+    { ';', 0, 0, 1153 },
+    { ';', 0, 0, 1154 },
+    { 'n', 1, 7270, 0 },
+    { ';', 0, 0, 1155 },
+    { 'o', 2, 7271, 0 },
+    { ';', 0, 0, 1156 },
+    { 'o', 1, 7273, 0 },
+    { ';', 0, 0, 1157 },
+    { 't', 1, 7274, 0 },
+    { 'r', 1, 7275, 0 },
+    { ';', 0, 0, 1158 },
+    { ';', 0, 0, 821 },
+    { 'e', 1, 7276, 0 },
+    { 'l', 1, 7277, 0 },
+    { 's', 1, 7278, 0 },
+    { ';', 0, 0, 453 },
+    { 'e', 1, 7279, 0 },
+    { ';', 0, 0, 1159 },
+    { ';', 0, 0, 309 },
+    { ';', 0, 0, 1160 },
+    { 'r', 1, 7280, 0 },
+    { ';', 0, 0, 1161 },
+    { 'u', 1, 7281, 0 },
+    { ';', 0, 0, 500 },
+    { ';', 0, 0, 1162 },
+    { 'o', 1, 7282, 0 },
+    { 'o', 1, 7283, 0 },
+    { ';', 0, 0, 1163 },
+    { 'f', 1, 7284, 0 },
+    { 'g', 1, 7285, 0 },
+    { ';', 0, 0, 1164 },
+    { ';', 0, 0, 458 },
+    { ';', 0, 0, 1165 },
+    { ';', 0, 0, 1166 },
+    { ';', 0, 0, 420 },
+    { ';', 0, 0, 825 },
+    { ';', 0, 0, 826 },
+    { ';', 0, 0, 553 },
+    { ';', 0, 0, 1167 },
+    { 'n', 1, 7286, 0 },
+    { 'r', 1, 7287, 0 },
+    { ';', 0, 0, 1168 },
+    { 'i', 1, 7288, 0 },
+    { ';', 0, 0, 830 },
+    { ';', 0, 0, 1169 },
+    { 'r', 1, 7289, 0 },
+    { 'a', 1, 7290, 0 },
+    { 'h', 1, 7291, 0 },
+    { 'd', 1, 7292, 0 },
+    { ';', 0, 0, 835 },
+    { 't', 1, 7293, 0 },
+    { ';', 0, 0, 1170 },
+    { ';', 0, 0, 1171 },
+    { ';', 0, 0, 1172 },
+    { ';', 0, 0, 1173 },
+    { ';', 0, 0, 1174 },
+    { ';', 0, 0, 1175 },
+    { ';', 0, 0, 1176 },
+    { ';', 0, 0, 1177 },
+    { 'y', 1, 7294, 0 },
+    { ';', 0, 0, 327 },
+    { ';', 0, 0, 1178 },
+    { ';', 0, 0, 477 },
+    { 's', 1, 7295, 0 },
+    { ';', 0, 0, 1179 },
+    { ';', 0, 0, 1180 },
+    { ';', 0, 0, 1181 },
+    { ';', 0, 0, 1182 },
+    { 'm', 1, 7296, 0 },
+    { ';', 0, 0, 1183 },
+    { ';', 0, 0, 1184 },
+    { ';', 0, 0, 481 },
+    { ';', 0, 0, 492 },
+    { 'd', 1, 7297, 0 },
+    { 'u', 1, 7298, 0 },
+    { ';', 0, 0, 1185 },
+    { ';', 0, 0, 1186 },
+    { ';', 0, 0, 706 },
+    { 'r', 1, 7299, 0 },
+    { 'a', 1, 7300, 0 },
+    { 'r', 1, 7301, 0 },
+    { 'r', 1, 7302, 0 },
+    { 'f', 1, 7303, 0 },
+    { 'g', 1, 7304, 0 },
+    { 'r', 1, 7305, 0 },
+    { 'n', 1, 7306, 0 },
+    { ';', 0, 0, 1187 },
+    { 'o', 2, 7307, 0 },
+    { ';', 0, 0, 1188 },
+    { 'p', 1, 7309, 0 },
+    { 't', 1, 7310, 0 },
+    { 'g', 1, 7311, 0 },
+    { 'q', 1, 7312, 0 },
+    { 'r', 1, 7313, 0 },
+    { 'm', 1, 7314, 0 },
+    { ';', 0, 0, 1189 },
+    { ';', 0, 0, 1190 },
+    { ';', 0, 0, 1191 },
+    { 'e', 1, 7315, 0 },
+    { ';', 0, 0, 1192 },
+    { ';', 0, 0, 1193 },
+    { ';', 0, 0, 1194 },
+    { 'a', 1, 7316, 0 },
+    { 'o', 1, 7317, 0 },
+    { 'f', 1, 7318, 0 },
+    { 'p', 1, 7319, 0 },
+    { 'g', 1, 7320, 0 },
+    { 'r', 1, 7321, 0 },
+    { ';', 0, 0, 1195 },
+    { 's', 1, 7322, 0 },
+    { ';', 0, 0, 1196 },
+    { ';', 0, 0, 1197 },
+    { 'e', 1, 7323, 0 },
+    { ';', 0, 0, 1198 },
+    { 'e', 1, 7324, 0 },
+    { ';', 0, 0, 1199 },
+    { ';', 0, 0, 1200 },
+    { ';', 0, 0, 965 },
+    { ';', 0, 0, 1201 },
+    { ';', 0, 0, 1202 },
+    { ';', 0, 0, 1203 },
+    { ';', 0, 0, 1204 },
+    { 't', 1, 7325, 0 },
+    { ';', 0, 0, 1205 },
+    { 'a', 1, 7326, 0 },
+    { 'r', 1, 7327, 0 },
+    { 'e', 1, 7328, 0 },
+    { 'e', 1, 7329, 0 },
+    { ';', 0, 0, 200 },
+    { 'd', 1, 7330, 0 },
+    { 'l', 1, 7331, 0 },
+    { 'u', 1, 7332, 0 },
+    { ';', 0, 0, 1206 },
+    { ';', 0, 0, 1207 },
+    { 'e', 1, 7333, 0 },
+    { ';', 0, 0, 140 },
+    { ';', 0, 0, 1208 },
+    { ';', 0, 0, 876 },
+    { ';', 0, 0, 1209 },
+    { ';', 0, 0, 1210 },
+    { 'u', 1, 7334, 0 },
+    { ';', 0, 0, 39 },
+    { ';', 0, 0, 1211 },
+    { ';', 0, 0, 20 },
+    { 'a', 1, 7335, 0 },
+    { 'r', 1, 7336, 0 },
+    { 'i', 1, 7337, 0 },
+    { 'a', 1, 7338, 0 },
+    { ';', 0, 0, 1212 },
+    { ';', 0, 0, 1213 },
+    { ';', 0, 0, 1214 },
+    { 'x', 1, 7339, 0 },
+    { 'l', 2, 7340, 0 },
+    { ';', 0, 0, 1215 },
+    { ';', 0, 0, 1216 },
+    { ';', 0, 0, 1217 },
+    { 'o', 1, 7342, 0 },
+    { ';', 0, 0, 1218 },
+    { 'w', 1, 7343, 0 },
+    { ';', 0, 0, 1219 },
+    { ';', 0, 0, 599 },
+    { ';', 0, 0, 1220 },
+    { 's', 1, 7344, 0 },
+    { 'a', 1, 7345, 0 },
+    { 'r', 1, 7346, 0 },
+    { 'i', 1, 7347, 0 },
+    { 'a', 1, 7348, 0 },
+    { ';', 0, 0, 1221 },
+    { ';', 0, 0, 1222 },
+    { 'o', 1, 7349, 0 },
+    { 'a', 1, 7350, 0 },
+    { 'b', 1, 7351, 0 },
+    { 'c', 1, 7352, 0 },
+    { 'a', 1, 7353, 0 },
+    { 'b', 1, 7354, 0 },
+    { 'c', 1, 7355, 0 },
+    { 'l', 1, 7356, 0 },
+    { ';', 0, 0, 1223 },
+    { 't', 1, 7357, 0 },
+    { ';', 0, 0, 1224 },
+    { 'q', 1, 7358, 0 },
+    { ';', 0, 0, 1225 },
+    { ';', 0, 0, 1226 },
+    { 'a', 1, 7359, 0 },
+    { ';', 0, 0, 1227 },
+    { ';', 0, 0, 1228 },
+    { 'm', 1, 7360, 0 },
+    { 'p', 1, 7361, 0 },
+    { ';', 0, 0, 903 },
+    { 'e', 1, 7362, 0 },
+    { 'e', 1, 7363, 0 },
+    { 't', 2, 7364, 0 },
+    { 'q', 1, 7366, 0 },
+    { 't', 2, 7367, 0 },
+    { ';', 0, 0, 908 },
+    { 'g', 1, 7369, 0 },
+    { ';', 0, 0, 1229 },
+    { ';', 0, 0, 1230 },
+    { ';', 0, 0, 1231 },
+    { ';', 0, 0, 1232 },
+    { 'n', 1, 7370, 0 },
+    { ';', 0, 0, 1233 },
+    { 'e', 1, 7371, 0 },
+    { ';', 0, 0, 1234 },
+    { 'e', 1, 7372, 0 },
+    { ';', 0, 0, 1235 },
+    { 'w', 1, 7373, 0 },
+    { ';', 0, 0, 1236 },
+    { ';', 0, 0, 913 },
+    { ';', 0, 0, 1237 },
+    { ';', 0, 0, 1238 },
+    { ';', 0, 0, 917 },
+    { 's', 1, 7374, 0 },
+    { 'n', 1, 7375, 0 },
+    { ';', 0, 0, 1239 },
+    { 'f', 1, 7376, 0 },
+    { ';', 0, 0, 1240 },
+    { 'e', 1, 7377, 0 },
+    { ';', 0, 0, 927 },
+    { ';', 0, 0, 928 },
+    { ';', 0, 0, 1241 },
+    { 'a', 1, 7378, 0 },
+    { 'e', 1, 7379, 0 },
+    { ';', 0, 0, 1242 },
+    { ';', 0, 0, 1243 },
+    { ';', 0, 0, 1244 },
+    { ';', 0, 0, 1245 },
+    { 'k', 1, 7380, 0 },
+    { ';', 0, 0, 329 },
+    { 'o', 1, 7381, 0 },
+    { ';', 0, 0, 458 },
+    { 'h', 1, 7382, 0 },
+    { ';', 0, 0, 458 },
+    { 'i', 1, 7383, 0 },
+    { 'r', 1, 7384, 0 },
+    { ';', 0, 0, 1246 },
+    { ';', 0, 0, 1247 },
+    { ';', 0, 0, 48 },
+    { 'm', 1, 7385, 0 },
+    { 'o', 1, 7386, 0 },
+    { 'n', 1, 7387, 0 },
+    { 'p', 1, 7388, 0 },
+    { 'r', 1, 7389, 0 },
+    { ';', 0, 0, 240 },
+    { 'p', 1, 7390, 0 },
+    { 'q', 1, 7391, 0 },
+    { 'i', 1, 7392, 0 },
+    { 'm', 1, 7393, 0 },
+    { ';', 0, 0, 336 },
+    { ';', 0, 0, 1248 },
+    { 'a', 1, 7394, 0 },
+    { 'n', 1, 7395, 0 },
+    { 'r', 1, 7396, 0 },
+    { ';', 0, 0, 551 },
+    { ';', 0, 0, 1249 },
+    { ';', 0, 0, 1250 },
+    { ';', 0, 0, 1251 },
+    { 'n', 1, 7397, 0 },
+    { 't', 1, 7398, 0 },
+    { 'q', 1, 7399, 0 },
+    { ';', 0, 0, 1252 },
+    { ';', 0, 0, 1253 },
+    { 'y', 1, 7400, 0 },
+    { ';', 0, 0, 559 },
+    { ';', 0, 0, 1254 },
+    { 's', 1, 7401, 0 },
+    { ';', 0, 0, 1255 },
+    { ';', 0, 0, 1256 },
+    { ';', 0, 0, 1257 },
+    { ';', 0, 0, 1258 },
+    { 'm', 1, 7402, 0 },
+    { ';', 0, 0, 1259 },
+    { ';', 0, 0, 1260 },
+    { 'a', 1, 7403, 0 },
+    { ';', 0, 0, 562 },
+    { ';', 0, 0, 571 },
+    { 'd', 1, 7404, 0 },
+    { 'u', 1, 7405, 0 },
+    { ';', 0, 0, 1261 },
+    { ';', 0, 0, 1262 },
+    { 'r', 1, 7406, 0 },
+    { ';', 0, 0, 951 },
+    { 'e', 1, 7407, 0 },
+    { 'r', 1, 7408, 0 },
+    { ';', 0, 0, 1263 },
+    { ';', 0, 0, 1264 },
+    { ';', 0, 0, 1265 },
+    { 'r', 1, 7409, 0 },
+    { 'a', 1, 7410, 0 },
+    { 'e', 1, 7411, 0 },
+    { 'i', 1, 7412, 0 },
+    { 'q', 1, 7413, 0 },
+    { 'h', 1, 7414, 0 },
+    { 'd', 1, 7415, 0 },
+    { ';', 0, 0, 1266 },
+    { 'a', 1, 7416, 0 },
+    { ';', 0, 0, 1267 },
+    { 's', 1, 7417, 0 },
+    { ';', 0, 0, 1268 },
+    { 'n', 1, 7418, 0 },
+    { ';', 0, 0, 1269 },
+    { ';', 0, 0, 962 },
+    { ';', 0, 0, 1270 },
+    { ';', 0, 0, 1271 },
+    { 'r', 1, 7419, 0 },
+    { 'r', 1, 7420, 0 },
+    { ';', 0, 0, 1272 },
+    { ';', 0, 0, 1273 },
+    { ';', 0, 0, 1274 },
+    { ';', 0, 0, 1275 },
+    { 'n', 1, 7421, 0 },
+    { ';', 0, 0, 1276 },
+    { 'w', 1, 7422, 0 },
+    { ';', 0, 0, 601 },
+    { 'u', 1, 7423, 0 },
+    { ';', 0, 0, 811 },
+    { ';', 0, 0, 1277 },
+    { 'i', 1, 7424, 0 },
+    { 'a', 1, 7425, 0 },
+    { ';', 0, 0, 1278 },
+    { ';', 0, 0, 1278 },
+    { ';', 0, 0, 1279 },
+    { 's', 1, 7426, 0 },
+    { 'r', 1, 7427, 0 },
+    { 'e', 1, 7428, 0 },
+    { ';', 0, 0, 1280 },
+    { 's', 1, 7429, 0 },
+    { ';', 0, 0, 1281 },
+    { ';', 0, 0, 1282 },
+    { ';', 0, 0, 1283 },
+    { 'u', 1, 7430, 0 },
+    { ';', 0, 0, 1284 },
+    { ';', 0, 0, 1285 },
+    { ';', 0, 0, 1286 },
+    { 'e', 1, 7431, 0 },
+    { ';', 0, 0, 1287 },
+    { 'e', 1, 7432, 0 },
+    { ';', 0, 0, 255 },
+    { ';', 0, 0, 585 },
+    { ';', 0, 0, 974 },
+    { ';', 0, 0, 980 },
+    { ';', 0, 0, 348 },
+    { 'h', 1, 7433, 0 },
+    { ';', 0, 0, 1288 },
+    { 't', 1, 7434, 0 },
+    { 't', 1, 7435, 0 },
+    { 's', 1, 7436, 0 },
+    { 'r', 1, 7437, 0 },
+    { ';', 0, 0, 256 },
+    { 'e', 1, 7438, 0 },
+    { 'n', 1, 7439, 0 },
+    { ';', 0, 0, 1289 },
+    { ';', 0, 0, 1290 },
+    { ';', 0, 0, 1291 },
+    { 'p', 1, 7440, 0 },
+    { 'r', 1, 7441, 0 },
+    { ';', 0, 0, 248 },
+    { 'p', 1, 7442, 0 },
+    { 'q', 1, 7443, 0 },
+    { 'i', 1, 7444, 0 },
+    { 'm', 1, 7445, 0 },
+    { ';', 0, 0, 1292 },
+    { 'b', 1, 7446, 0 },
+    { 't', 1, 7447, 0 },
+    { 'l', 1, 7448, 0 },
+    { 'b', 1, 7449, 0 },
+    { 'r', 1, 7450, 0 },
+    { 't', 1, 7451, 0 },
+    { 's', 1, 7452, 0 },
+    { ';', 0, 0, 260 },
+    { 'e', 1, 7453, 0 },
+    { 'n', 1, 7454, 0 },
+    { ';', 0, 0, 1293 },
+    { ';', 0, 0, 1294 },
+    { ';', 0, 0, 1295 },
+    { ';', 0, 0, 1296 },
+    { 'w', 1, 7455, 0 },
+    { ';', 0, 0, 1297 },
+    { ';', 0, 0, 1298 },
+    { ';', 0, 0, 1299 },
+    { ';', 0, 0, 1300 },
+    { ';', 0, 0, 1301 },
+    { ';', 0, 0, 1302 },
+    { 'o', 1, 7456, 0 },
+    { 'y', 1, 7457, 0 },
+    { ';', 0, 0, 1303 },
+    { 'p', 1, 7458, 0 },
+    { 'i', 1, 7459, 0 },
+    { ';', 0, 0, 1304 },
+    { ';', 0, 0, 252 },
+    { ';', 0, 0, 1305 },
+    { 'a', 1, 7460, 0 },
+    { ';', 0, 0, 1306 },
+    { ';', 0, 0, 1307 },
+    { ';', 0, 0, 1308 },
+    { 'k', 1, 7461, 0 },
+    { ';', 0, 0, 1309 },
+    { 'l', 1, 7462, 0 },
+    { ';', 0, 0, 1310 },
+    { 'u', 1, 7463, 0 },
+    { 's', 1, 7464, 0 },
+    { 'e', 1, 7465, 0 },
+    { 'u', 1, 7466, 0 },
+    { ';', 0, 0, 1311 },
+    { 'd', 2, 7467, 0 },
+    { ';', 0, 0, 998 },
+    { ';', 0, 0, 1312 },
+    { ';', 0, 0, 1313 },
+    { ';', 0, 0, 1314 },
+    { ';', 0, 0, 1002 },
+    { ';', 0, 0, 1315 },
+    { 'e', 1, 7469, 0 },
+    { ';', 0, 0, 1316 },
+    { 'w', 1, 7470, 0 },
+    { 'a', 1, 7471, 0 },
+    { 'o', 1, 7472, 0 },
+    { 'n', 1, 7473, 0 },
+    { 'r', 1, 7474, 0 },
+    { ';', 0, 0, 1317 },
+    { 'e', 1, 7475, 0 },
+    { ';', 0, 0, 1318 },
+    { ';', 0, 0, 1319 },
+    { 'e', 1, 7476, 0 },
+    { ';', 0, 0, 1320 },
+    { 'i', 1, 7477, 0 },
+    { 'p', 1, 7478, 0 },
+    { 'h', 1, 7479, 0 },
+    { ';', 0, 0, 544 },
+    { 'p', 1, 7480, 0 },
+    { ';', 0, 0, 566 },
+    { 'm', 1, 7481, 0 },
+    { 's', 1, 7482, 0 },
+    { 's', 1, 7483, 0 },
+    { 't', 1, 7484, 0 },
+    { 'a', 1, 7485, 0 },
+    { ';', 0, 0, 1321 },
+    { ';', 0, 0, 1322 },
+    { ';', 0, 0, 616 },
+    { ';', 0, 0, 1323 },
+    { ';', 0, 0, 1324 },
+    { ';', 0, 0, 1325 },
+    { ';', 0, 0, 1326 },
+    { 'g', 1, 7486, 0 },
+    { ';', 0, 0, 1327 },
+    { ';', 0, 0, 1328 },
+    { ';', 0, 0, 54 },
+    { ';', 0, 0, 55 },
+    { ';', 0, 0, 1329 },
+    { ';', 0, 0, 1330 },
+    { ';', 0, 0, 1331 },
+    { ';', 0, 0, 1332 },
+    { ';', 0, 0, 692 },
+    { ';', 0, 0, 1034 },
+    { ';', 0, 0, 1333 },
+    { ';', 0, 0, 1334 },
+    { ';', 0, 0, 131 },
+    { 'r', 1, 7487, 0 },
+    { 'n', 1, 7488, 0 },
+    { 's', 1, 7489, 0 },
+    { ';', 0, 0, 1095 },
+    { 'l', 1, 7490, 0 },
+    { 'D', 1, 7491, 0 },
+    { ';', 0, 0, 66 },
+    { ';', 0, 0, 1335 },
+    { ';', 0, 0, 405 },
+    { 'o', 1, 7492, 0 },
+    { 'o', 1, 7493, 0 },
+    { 'i', 1, 7494, 0 },
+    { 'l', 1, 7495, 0 },
+    { 'i', 1, 7496, 0 },
+    { 's', 1, 7497, 0 },
+    { 'r', 1, 7498, 0 },
+    { 'n', 1, 7499, 0 },
+    { 'I', 1, 7500, 0 },
+    { 'c', 1, 7501, 0 },
+    { 'C', 1, 7502, 0 },
+    { 'd', 1, 7503, 0 },
+    { 'i', 1, 7504, 0 },
+    { ';', 0, 0, 421 },
+    { 'n', 1, 7505, 0 },
+    { 'l', 1, 7506, 0 },
+    { 'o', 1, 7507, 0 },
+    { 'o', 2, 7508, 0 },
+    { 'e', 1, 7510, 0 },
+    { 'o', 1, 7511, 0 },
+    { 'i', 1, 7512, 0 },
+    { 'p', 2, 7513, 0 },
+    { 'e', 1, 7515, 0 },
+    { 'o', 1, 7516, 0 },
+    { 'v', 1, 7517, 0 },
+    { 't', 3, 7518, 0 },
+    { 'h', 1, 7521, 0 },
+    { ';', 0, 0, 264 },
+    { 'A', 1, 7522, 0 },
+    { 'o', 1, 7523, 0 },
+    { ';', 0, 0, 34 },
+    { 'a', 1, 7524, 0 },
+    { 'r', 1, 7525, 0 },
+    { ';', 0, 0, 1336 },
+    { 'l', 1, 7526, 0 },
+    { 'r', 1, 7527, 0 },
+    { 't', 1, 7528, 0 },
+    { 'm', 1, 7529, 0 },
+    { 'e', 1, 7530, 0 },
+    { 't', 1, 7531, 0 },
+    { 'E', 1, 7532, 0 },
+    { 'F', 1, 7533, 0 },
+    { 'G', 1, 7534, 0 },
+    { 'L', 1, 7535, 0 },
+    { 'S', 1, 7536, 0 },
+    { 'T', 1, 7537, 0 },
+    { 'S', 1, 7538, 0 },
+    { 't', 1, 7539, 0 },
+    { 'n', 1, 7540, 0 },
+    { 'a', 1, 7541, 0 },
+    { 'r', 1, 7542, 0 },
+    { ';', 0, 0, 556 },
+    { 'l', 1, 7543, 0 },
+    { 'c', 1, 7544, 0 },
+    { 'l', 1, 7545, 0 },
+    { 't', 1, 7546, 0 },
+    { 'l', 1, 7547, 0 },
+    { 'o', 1, 7548, 0 },
+    { 'l', 1, 7549, 0 },
+    { 'b', 1, 7550, 0 },
+    { 'n', 2, 7551, 0 },
+    { 'o', 1, 7553, 0 },
+    { 'h', 1, 7554, 0 },
+    { ';', 0, 0, 776 },
+    { 'A', 1, 7555, 0 },
+    { 'V', 1, 7556, 0 },
+    { 'a', 1, 7557, 0 },
+    { 'o', 1, 7558, 0 },
+    { 'e', 1, 7559, 0 },
+    { 'e', 1, 7560, 0 },
+    { 't', 1, 7561, 0 },
+    { 'o', 1, 7562, 0 },
+    { 'h', 1, 7563, 0 },
+    { 'a', 1, 7564, 0 },
+    { 'l', 1, 7565, 0 },
+    { 'a', 1, 7566, 0 },
+    { 's', 1, 7567, 0 },
+    { 'n', 1, 7568, 0 },
+    { 'd', 1, 7569, 0 },
+    { 'r', 1, 7570, 0 },
+    { 't', 2, 7571, 0 },
+    { 'h', 1, 7573, 0 },
+    { 't', 2, 7574, 0 },
+    { 'h', 1, 7576, 0 },
+    { 'f', 1, 7577, 0 },
+    { 'g', 1, 7578, 0 },
+    { 'p', 1, 7579, 0 },
+    { 'r', 1, 7580, 0 },
+    { 'u', 1, 7581, 0 },
+    { 'e', 3, 7582, 0 },
+    { 'r', 1, 7585, 0 },
+    { 'e', 1, 7586, 0 },
+    { ';', 0, 0, 1337 },
+    { ';', 0, 0, 1338 },
+    { 'k', 1, 7587, 0 },
+    { 'r', 1, 7588, 0 },
+    { 'a', 1, 7589, 0 },
+    { 'l', 1, 7590, 0 },
+    { 'e', 1, 7591, 0 },
+    { 'l', 2, 7592, 0 },
+    { 't', 1, 7594, 0 },
+    { 't', 1, 7595, 0 },
+    { 'D', 1, 7596, 0 },
+    { 'E', 1, 7597, 0 },
+    { 'T', 1, 7598, 0 },
+    { ';', 0, 0, 219 },
+    { 'E', 1, 7599, 0 },
+    { 'G', 1, 7600, 0 },
+    { 'L', 1, 7601, 0 },
+    { 'S', 1, 7602, 0 },
+    { 'T', 1, 7603, 0 },
+    { 'e', 1, 7604, 0 },
+    { 'e', 1, 7605, 0 },
+    { 'r', 1, 7606, 0 },
+    { 't', 1, 7607, 0 },
+    { 'r', 1, 7608, 0 },
+    { 'e', 1, 7609, 0 },
+    { 'e', 1, 7610, 0 },
+    { 'r', 1, 7611, 0 },
+    { 'e', 4, 7612, 0 },
+    { 'i', 1, 7616, 0 },
+    { ';', 0, 0, 1339 },
+    { 'l', 1, 7617, 0 },
+    { ';', 0, 0, 921 },
+    { 'c', 2, 7618, 0 },
+    { 'e', 1, 7620, 0 },
+    { 'D', 1, 7621, 0 },
+    { 'u', 1, 7622, 0 },
+    { 'e', 1, 7623, 0 },
+    { 's', 4, 7624, 0 },
+    { ';', 0, 0, 550 },
+    { 'i', 1, 7628, 0 },
+    { 'E', 2, 7629, 0 },
+    { 'U', 1, 7631, 0 },
+    { 'g', 1, 7632, 0 },
+    { 'r', 1, 7633, 0 },
+    { 'i', 1, 7634, 0 },
+    { 'u', 1, 7635, 0 },
+    { 'w', 1, 7636, 0 },
+    { 'o', 1, 7637, 0 },
+    { 'e', 3, 7638, 0 },
+    { 'i', 1, 7641, 0 },
+    { 'D', 1, 7642, 0 },
+    { 'T', 1, 7643, 0 },
+    { 'V', 1, 7644, 0 },
+    { 'c', 1, 7645, 0 },
+    { 'r', 1, 7646, 0 },
+    { 'p', 1, 7647, 0 },
+    { 'r', 1, 7648, 0 },
+    { 'a', 1, 7649, 0 },
+    { 'w', 1, 7650, 0 },
+    { 'f', 1, 7651, 0 },
+    { 'g', 1, 7652, 0 },
+    { 'A', 1, 7653, 0 },
+    { 'r', 1, 7654, 0 },
+    { 'n', 1, 7655, 0 },
+    { 'u', 2, 7656, 0 },
+    { 'n', 1, 7658, 0 },
+    { 'q', 1, 7659, 0 },
+    { 's', 4, 7660, 0 },
+    { 't', 1, 7664, 0 },
+    { 't', 2, 7665, 0 },
+    { 'r', 1, 7667, 0 },
+    { 'a', 1, 7668, 0 },
+    { 'c', 1, 7669, 0 },
+    { 'u', 1, 7670, 0 },
+    { 'l', 1, 7671, 0 },
+    { 'l', 1, 7672, 0 },
+    { 'o', 1, 7673, 0 },
+    { 'r', 1, 7674, 0 },
+    { 'r', 1, 7675, 0 },
+    { 'a', 1, 7676, 0 },
+    { 'r', 1, 7677, 0 },
+    { 'u', 1, 7678, 0 },
+    { ';', 0, 0, 607 },
+    { 'B', 1, 7679, 0 },
+    { 'D', 1, 7680, 0 },
+    { 'r', 1, 7681, 0 },
+    { 'i', 1, 7682, 0 },
+    { 'r', 1, 7683, 0 },
+    { ';', 0, 0, 605 },
+    { 'r', 1, 7684, 0 },
+    { 'f', 1, 7685, 0 },
+    { 'g', 1, 7686, 0 },
+    { ';', 0, 0, 1340 },
+    { 'l', 4, 7687, 0 },
+    { 'n', 1, 7691, 0 },
+    { 't', 1, 7692, 0 },
+    { ';', 0, 0, 697 },
+    { 'e', 1, 7693, 0 },
+    { 'a', 1, 7694, 0 },
+    { 'b', 1, 7695, 0 },
+    { 'c', 1, 7696, 0 },
+    { 'd', 1, 7697, 0 },
+    { 'e', 1, 7698, 0 },
+    { 'f', 1, 7699, 0 },
+    { 'g', 1, 7700, 0 },
+    { 'h', 1, 7701, 0 },
+    { ';', 0, 0, 1341 },
+    { 'd', 1, 7702, 0 },
+    { ';', 0, 0, 1342 },
+    { 'q', 1, 7703, 0 },
+    { ';', 0, 0, 1043 },
+    { 't', 1, 7704, 0 },
+    { 'g', 1, 7705, 0 },
+    { 'i', 1, 7706, 0 },
+    { 'm', 1, 7707, 0 },
+    { ';', 0, 0, 399 },
+    { 'e', 1, 7708, 0 },
+    { 'e', 1, 7709, 0 },
+    { 'k', 1, 7710, 0 },
+    { ';', 0, 0, 1095 },
+    { ';', 0, 0, 1343 },
+    { ';', 0, 0, 997 },
+    { ';', 0, 0, 1024 },
+    { ';', 0, 0, 1030 },
+    { 's', 1, 7711, 0 },
+    { 'e', 1, 7712, 0 },
+    { 'p', 1, 7713, 0 },
+    { ';', 0, 0, 986 },
+    { 'n', 1, 7714, 0 },
+    { 's', 1, 7715, 0 },
+    { 'e', 1, 7716, 0 },
+    { 'z', 1, 7717, 0 },
+    { 'u', 1, 7718, 0 },
+    { 'i', 1, 7719, 0 },
+    { ';', 0, 0, 1344 },
+    { 's', 1, 7720, 0 },
+    { ';', 0, 0, 932 },
+    { 's', 1, 7721, 0 },
+    { 'b', 1, 7722, 0 },
+    { 'p', 1, 7723, 0 },
+    { ';', 0, 0, 1345 },
+    { ';', 0, 0, 1346 },
+    { 'o', 1, 7724, 0 },
+    { 'r', 1, 7725, 0 },
+    { 'r', 1, 7726, 0 },
+    { 'R', 1, 7727, 0 },
+    { 'S', 1, 7728, 0 },
+    { 'a', 1, 7729, 0 },
+    { 'c', 1, 7730, 0 },
+    { 'd', 1, 7731, 0 },
+    { 't', 1, 7732, 0 },
+    { ';', 0, 0, 1347 },
+    { 't', 1, 7733, 0 },
+    { ';', 0, 0, 1037 },
+    { 'e', 1, 7734, 0 },
+    { 'e', 1, 7735, 0 },
+    { ';', 0, 0, 1348 },
+    { ';', 0, 0, 1349 },
+    { ';', 0, 0, 1350 },
+    { ';', 0, 0, 1351 },
+    { 'p', 1, 7736, 0 },
+    { ';', 0, 0, 1352 },
+    { 'p', 1, 7737, 0 },
+    { 's', 1, 7738, 0 },
+    { 'e', 1, 7739, 0 },
+    { 'd', 1, 7740, 0 },
+    { 'r', 1, 7741, 0 },
+    { 't', 1, 7742, 0 },
+    { ';', 0, 0, 940 },
+    { ';', 0, 0, 1044 },
+    { ';', 0, 0, 789 },
+    { ';', 0, 0, 1353 },
+    { ';', 0, 0, 421 },
+    { 's', 1, 7743, 0 },
+    { ';', 0, 0, 1153 },
+    { 'n', 1, 7744, 0 },
+    { 't', 1, 7745, 0 },
+    { 's', 1, 7746, 0 },
+    { ';', 0, 0, 1246 },
+    { 'r', 1, 7747, 0 },
+    { 'a', 1, 7748, 0 },
+    { 'o', 1, 7749, 0 },
+    { 'n', 1, 7750, 0 },
+    { 'p', 1, 7751, 0 },
+    { 'w', 1, 7752, 0 },
+    { ';', 0, 0, 1354 },
+    { 'r', 1, 7753, 0 },
+    { 's', 1, 7754, 0 },
+    { 't', 1, 7755, 0 },
+    { ';', 0, 0, 437 },
+    { ';', 0, 0, 1129 },
+    { 'g', 1, 7756, 0 },
+    { 'l', 1, 7757, 0 },
+    { ';', 0, 0, 1355 },
+    { 'l', 1, 7758, 0 },
+    { 't', 1, 7759, 0 },
+    { 't', 1, 7760, 0 },
+    { 'd', 1, 7761, 0 },
+    { 't', 1, 7762, 0 },
+    { 't', 1, 7763, 0 },
+    { ';', 0, 0, 1356 },
+    { 'l', 1, 7764, 0 },
+    { 'x', 1, 7765, 0 },
+    { ';', 0, 0, 1357 },
+    { 'o', 1, 7766, 0 },
+    { 's', 1, 7767, 0 },
+    { 'e', 1, 7768, 0 },
+    { ';', 0, 0, 31 },
+    { 'q', 1, 7769, 0 },
+    { ';', 0, 0, 1358 },
+    { 'i', 1, 7770, 0 },
+    { 'w', 1, 7771, 0 },
+    { 'w', 1, 7772, 0 },
+    { 't', 1, 7773, 0 },
+    { 'h', 1, 7774, 0 },
+    { 'e', 1, 7775, 0 },
+    { 't', 1, 7776, 0 },
+    { 'e', 1, 7777, 0 },
+    { 's', 1, 7778, 0 },
+    { 'l', 1, 7779, 0 },
+    { 'k', 1, 7780, 0 },
+    { ';', 0, 0, 834 },
+    { ';', 0, 0, 1359 },
+    { 'v', 1, 7781, 0 },
+    { ';', 0, 0, 1360 },
+    { ';', 0, 0, 1361 },
+    { ';', 0, 0, 1362 },
+    { ';', 0, 0, 1363 },
+    { ';', 0, 0, 1364 },
+    { 'r', 1, 7782, 0 },
+    { 'o', 1, 7783, 0 },
+    { 'p', 1, 7784, 0 },
+    { 't', 1, 7785, 0 },
+    { 'h', 1, 7786, 0 },
+    { 'e', 1, 7787, 0 },
+    { 't', 1, 7788, 0 },
+    { ';', 0, 0, 1365 },
+    { 'r', 1, 7789, 0 },
+    { 'r', 1, 7790, 0 },
+    { ';', 0, 0, 871 },
+    { 't', 1, 7791, 0 },
+    { 'g', 1, 7792, 0 },
+    { ';', 0, 0, 38 },
+    { ';', 0, 0, 491 },
+    { 'r', 1, 7793, 0 },
+    { 'c', 1, 7794, 0 },
+    { 'x', 1, 7795, 0 },
+    { 't', 2, 7796, 0 },
+    { 's', 1, 7798, 0 },
+    { 'h', 1, 7799, 0 },
+    { 'o', 1, 7800, 0 },
+    { ';', 0, 0, 1366 },
+    { ';', 0, 0, 197 },
+    { 'r', 1, 7801, 0 },
+    { ';', 0, 0, 1367 },
+    { 'r', 1, 7802, 0 },
+    { ';', 0, 0, 1368 },
+    { 'q', 1, 7803, 0 },
+    { ';', 0, 0, 497 },
+    { 'o', 1, 7804, 0 },
+    { 'e', 1, 7805, 0 },
+    { 'p', 1, 7806, 0 },
+    { 'd', 1, 7807, 0 },
+    { ';', 0, 0, 1369 },
+    { 'p', 1, 7808, 0 },
+    { 'r', 1, 7809, 0 },
+    { 'g', 1, 7810, 0 },
+    { 'r', 1, 7811, 0 },
+    { ';', 0, 0, 209 },
+    { ';', 0, 0, 881 },
+    { 's', 1, 7812, 0 },
+    { 't', 1, 7813, 0 },
+    { ';', 0, 0, 886 },
+    { ';', 0, 0, 1220 },
+    { 'n', 1, 7814, 0 },
+    { 'r', 1, 7815, 0 },
+    { 'g', 1, 7816, 0 },
+    { 'n', 1, 7817, 0 },
+    { 't', 1, 7818, 0 },
+    { ';', 0, 0, 897 },
+    { ';', 0, 0, 1370 },
+    { ';', 0, 0, 1371 },
+    { ';', 0, 0, 898 },
+    { ';', 0, 0, 1372 },
+    { ';', 0, 0, 1373 },
+    { 'e', 1, 7819, 0 },
+    { ';', 0, 0, 1374 },
+    { ';', 0, 0, 517 },
+    { 'r', 1, 7820, 0 },
+    { 'i', 1, 7821, 0 },
+    { 'a', 1, 7822, 0 },
+    { ';', 0, 0, 1375 },
+    { ';', 0, 0, 1376 },
+    { ';', 0, 0, 1020 },
+    { 'e', 1, 7823, 0 },
+    { ';', 0, 0, 518 },
+    { ';', 0, 0, 1021 },
+    { 'e', 1, 7824, 0 },
+    { 'l', 1, 7825, 0 },
+    { ';', 0, 0, 1377 },
+    { ';', 0, 0, 1378 },
+    { ';', 0, 0, 1379 },
+    { ';', 0, 0, 912 },
+    { ';', 0, 0, 1380 },
+    { ';', 0, 0, 1381 },
+    { ';', 0, 0, 541 },
+    { ';', 0, 0, 1382 },
+    { 's', 1, 7826, 0 },
+    { 'l', 1, 7827, 0 },
+    { ';', 0, 0, 1383 },
+    { 'r', 1, 7828, 0 },
+    { ';', 0, 0, 1384 },
+    { 'r', 1, 7829, 0 },
+    { ';', 0, 0, 1385 },
+    { ';', 0, 0, 1386 },
+    { ';', 0, 0, 1387 },
+    { 't', 1, 7830, 0 },
+    { 'r', 1, 7831, 0 },
+    { 'l', 1, 7832, 0 },
+    { 'p', 1, 7833, 0 },
+    { 'q', 1, 7834, 0 },
+    { 'm', 1, 7835, 0 },
+    { ';', 0, 0, 937 },
+    { 'r', 1, 7836, 0 },
+    { 'e', 1, 7837, 0 },
+    { 'f', 1, 7838, 0 },
+    { 'i', 1, 7839, 0 },
+    { ';', 0, 0, 1388 },
+    { ';', 0, 0, 1136 },
+    { 'v', 1, 7840, 0 },
+    { ';', 0, 0, 1389 },
+    { ';', 0, 0, 1390 },
+    { 'l', 1, 7841, 0 },
+    { ';', 0, 0, 1391 },
+    { ';', 0, 0, 1392 },
+    { ';', 0, 0, 1393 },
+    { ';', 0, 0, 343 },
+    { 't', 1, 7842, 0 },
+    { 'r', 1, 7843, 0 },
+    { 'r', 1, 7844, 0 },
+    { 'f', 1, 7845, 0 },
+    { 'g', 1, 7846, 0 },
+    { 'u', 1, 7847, 0 },
+    { 'r', 1, 7848, 0 },
+    { 'o', 1, 7849, 0 },
+    { 'c', 1, 7850, 0 },
+    { ';', 0, 0, 1394 },
+    { 't', 1, 7851, 0 },
+    { 'i', 1, 7852, 0 },
+    { ';', 0, 0, 1395 },
+    { 't', 1, 7853, 0 },
+    { ';', 0, 0, 973 },
+    { 's', 1, 7854, 0 },
+    { 'd', 1, 7855, 0 },
+    { 'r', 1, 7856, 0 },
+    { ';', 0, 0, 1396 },
+    { ';', 0, 0, 1397 },
+    { 't', 1, 7857, 0 },
+    { 'l', 1, 7858, 0 },
+    { 'i', 1, 7859, 0 },
+    { 't', 2, 7860, 0 },
+    { 't', 2, 7862, 0 },
+    { 't', 2, 7864, 0 },
+    { ';', 0, 0, 1398 },
+    { ';', 0, 0, 1399 },
+    { ';', 0, 0, 1400 },
+    { ';', 0, 0, 1401 },
+    { 'q', 2, 7866, 0 },
+    { 'e', 1, 7868, 0 },
+    { 'r', 1, 7869, 0 },
+    { 'l', 1, 7870, 0 },
+    { 'p', 1, 7871, 0 },
+    { 'q', 1, 7872, 0 },
+    { 'm', 1, 7873, 0 },
+    { ';', 0, 0, 969 },
+    { ';', 0, 0, 1402 },
+    { ';', 0, 0, 1403 },
+    { ';', 0, 0, 1404 },
+    { ';', 0, 0, 1405 },
+    { ';', 0, 0, 1406 },
+    { ';', 0, 0, 1407 },
+    { ';', 0, 0, 1408 },
+    { 'q', 2, 7874, 0 },
+    { 'e', 1, 7876, 0 },
+    { ';', 0, 0, 992 },
+    { 'r', 1, 7877, 0 },
+    { 'm', 1, 7878, 0 },
+    { 'p', 1, 7879, 0 },
+    { 'm', 1, 7880, 0 },
+    { 'r', 1, 7881, 0 },
+    { ';', 0, 0, 1409 },
+    { 'e', 5, 7882, 0 },
+    { 's', 1, 7887, 0 },
+    { ';', 0, 0, 1410 },
+    { ';', 0, 0, 1411 },
+    { 'm', 1, 7888, 0 },
+    { 'l', 1, 7889, 0 },
+    { 'r', 1, 7890, 0 },
+    { 'r', 1, 7891, 0 },
+    { ';', 0, 0, 607 },
+    { 'r', 1, 7892, 0 },
+    { 'o', 1, 7893, 0 },
+    { ';', 0, 0, 610 },
+    { 'o', 1, 7894, 0 },
+    { 'r', 1, 7895, 0 },
+    { ';', 0, 0, 1412 },
+    { 'l', 1, 7896, 0 },
+    { 'a', 1, 7897, 0 },
+    { 'i', 1, 7898, 0 },
+    { 't', 1, 7899, 0 },
+    { 'a', 1, 7900, 0 },
+    { 'e', 1, 7901, 0 },
+    { 'e', 1, 7902, 0 },
+    { 'a', 1, 7903, 0 },
+    { 'n', 1, 7904, 0 },
+    { ';', 0, 0, 1413 },
+    { ';', 0, 0, 1414 },
+    { 'c', 1, 7905, 0 },
+    { 'h', 1, 7906, 0 },
+    { 'i', 1, 7907, 0 },
+    { 'i', 1, 7908, 0 },
+    { 't', 1, 7909, 0 },
+    { 't', 1, 7910, 0 },
+    { 'n', 1, 7911, 0 },
+    { 'u', 1, 7912, 0 },
+    { 'm', 1, 7913, 0 },
+    { 'e', 1, 7914, 0 },
+    { 'l', 1, 7915, 0 },
+    { 't', 1, 7916, 0 },
+    { 'n', 1, 7917, 0 },
+    { 't', 1, 7918, 0 },
+    { 'l', 1, 7919, 0 },
+    { ';', 0, 0, 1415 },
+    { 'c', 1, 7920, 0 },
+    { 't', 1, 7921, 0 },
+    { ';', 0, 0, 784 },
+    { 'n', 1, 7922, 0 },
+    { 't', 1, 7923, 0 },
+    { 'w', 1, 7924, 0 },
+    { 'f', 1, 7925, 0 },
+    { 'n', 1, 7926, 0 },
+    { 'g', 1, 7927, 0 },
+    { 'A', 1, 7928, 0 },
+    { 'D', 1, 7929, 0 },
+    { 'r', 1, 7930, 0 },
+    { 'w', 3, 7931, 0 },
+    { 'e', 1, 7934, 0 },
+    { 'R', 1, 7935, 0 },
+    { 'T', 1, 7936, 0 },
+    { 'V', 1, 7937, 0 },
+    { 't', 2, 7938, 0 },
+    { 'r', 1, 7940, 0 },
+    { 'w', 1, 7941, 0 },
+    { 'l', 1, 7942, 0 },
+    { 'y', 1, 7943, 0 },
+    { 'd', 1, 7944, 0 },
+    { 'i', 1, 7945, 0 },
+    { 'i', 1, 7946, 0 },
+    { 'a', 1, 7947, 0 },
+    { 'r', 1, 7948, 0 },
+    { 'r', 1, 7949, 0 },
+    { 'q', 1, 7950, 0 },
+    { 'u', 1, 7951, 0 },
+    { 'r', 1, 7952, 0 },
+    { 'e', 1, 7953, 0 },
+    { 'l', 1, 7954, 0 },
+    { 'i', 1, 7955, 0 },
+    { 'p', 1, 7956, 0 },
+    { 'a', 1, 7957, 0 },
+    { 'H', 1, 7958, 0 },
+    { 'l', 1, 7959, 0 },
+    { 'y', 1, 7960, 0 },
+    { ';', 0, 0, 181 },
+    { 't', 1, 7961, 0 },
+    { 'e', 2, 7962, 0 },
+    { 'r', 1, 7964, 0 },
+    { 'e', 1, 7965, 0 },
+    { 'w', 3, 7966, 0 },
+    { 'i', 1, 7969, 0 },
+    { 'l', 1, 7970, 0 },
+    { 'T', 1, 7971, 0 },
+    { 'V', 1, 7972, 0 },
+    { 'r', 1, 7973, 0 },
+    { 't', 2, 7974, 0 },
+    { 'r', 1, 7976, 0 },
+    { 'e', 1, 7977, 0 },
+    { 'n', 1, 7978, 0 },
+    { 'w', 1, 7979, 0 },
+    { 'e', 1, 7980, 0 },
+    { 'c', 1, 7981, 0 },
+    { 'o', 1, 7982, 0 },
+    { 'w', 1, 7983, 0 },
+    { 't', 1, 7984, 0 },
+    { 'l', 1, 7985, 0 },
+    { 'E', 1, 7986, 0 },
+    { 't', 1, 7987, 0 },
+    { ';', 0, 0, 1416 },
+    { 't', 1, 7988, 0 },
+    { 'e', 1, 7989, 0 },
+    { 'o', 1, 7990, 0 },
+    { 'A', 1, 7991, 0 },
+    { 'R', 1, 7992, 0 },
+    { 't', 1, 7993, 0 },
+    { 'a', 1, 7994, 0 },
+    { 'r', 1, 7995, 0 },
+    { 't', 1, 7996, 0 },
+    { 't', 1, 7997, 0 },
+    { 'h', 1, 7998, 0 },
+    { 'a', 1, 7999, 0 },
+    { 'f', 1, 8000, 0 },
+    { 's', 1, 8001, 0 },
+    { 'M', 1, 8002, 0 },
+    { 'T', 1, 8003, 0 },
+    { 'V', 1, 8004, 0 },
+    { 'e', 1, 8005, 0 },
+    { 's', 1, 8006, 0 },
+    { 'i', 1, 8007, 0 },
+    { 'u', 1, 8008, 0 },
+    { 'p', 1, 8009, 0 },
+    { 'e', 1, 8010, 0 },
+    { 'n', 1, 8011, 0 },
+    { ';', 0, 0, 41 },
+    { 'T', 1, 8012, 0 },
+    { 's', 1, 8013, 0 },
+    { 'e', 1, 8014, 0 },
+    { 'o', 1, 8015, 0 },
+    { 'q', 1, 8016, 0 },
+    { 'r', 1, 8017, 0 },
+    { 'q', 1, 8018, 0 },
+    { 'r', 1, 8019, 0 },
+    { 'e', 1, 8020, 0 },
+    { 'l', 1, 8021, 0 },
+    { 'i', 1, 8022, 0 },
+    { 'd', 2, 8023, 0 },
+    { 'd', 1, 8025, 0 },
+    { 's', 1, 8026, 0 },
+    { 'T', 1, 8027, 0 },
+    { 'e', 1, 8028, 0 },
+    { 't', 2, 8029, 0 },
+    { 'e', 1, 8031, 0 },
+    { 's', 1, 8032, 0 },
+    { ';', 0, 0, 520 },
+    { 'E', 1, 8033, 0 },
+    { 'F', 1, 8034, 0 },
+    { 'T', 1, 8035, 0 },
+    { 'c', 1, 8036, 0 },
+    { 'y', 2, 8037, 0 },
+    { 'e', 1, 8039, 0 },
+    { 'k', 1, 8040, 0 },
+    { 'n', 1, 8041, 0 },
+    { ';', 0, 0, 543 },
+    { 's', 1, 8042, 0 },
+    { 'p', 1, 8043, 0 },
+    { ';', 0, 0, 49 },
+    { 'E', 1, 8044, 0 },
+    { 'S', 1, 8045, 0 },
+    { 'T', 1, 8046, 0 },
+    { 'o', 1, 8047, 0 },
+    { 'l', 1, 8048, 0 },
+    { 'q', 1, 8049, 0 },
+    { 'p', 1, 8050, 0 },
+    { 'l', 1, 8051, 0 },
+    { 'o', 1, 8052, 0 },
+    { 'l', 1, 8053, 0 },
+    { 'b', 1, 8054, 0 },
+    { 'n', 2, 8055, 0 },
+    { 'o', 1, 8057, 0 },
+    { ';', 0, 0, 1017 },
+    { 'A', 1, 8058, 0 },
+    { 'V', 1, 8059, 0 },
+    { 'a', 1, 8060, 0 },
+    { 'o', 1, 8061, 0 },
+    { 'e', 1, 8062, 0 },
+    { 'e', 1, 8063, 0 },
+    { 't', 1, 8064, 0 },
+    { 'o', 1, 8065, 0 },
+    { 'l', 1, 8066, 0 },
+    { 'r', 1, 8067, 0 },
+    { 'y', 1, 8068, 0 },
+    { 'n', 1, 8069, 0 },
+    { 't', 1, 8070, 0 },
+    { 'h', 1, 8071, 0 },
+    { 'r', 1, 8072, 0 },
+    { 'c', 1, 8073, 0 },
+    { 't', 1, 8074, 0 },
+    { 'b', 1, 8075, 0 },
+    { 'p', 1, 8076, 0 },
+    { 'i', 1, 8077, 0 },
+    { 'u', 1, 8078, 0 },
+    { ';', 0, 0, 51 },
+    { 'E', 1, 8079, 0 },
+    { 'S', 1, 8080, 0 },
+    { 'T', 1, 8081, 0 },
+    { ';', 0, 0, 42 },
+    { ';', 0, 0, 260 },
+    { 'E', 1, 8082, 0 },
+    { 'e', 1, 8083, 0 },
+    { 'c', 1, 8084, 0 },
+    { 'e', 1, 8085, 0 },
+    { 'a', 1, 8086, 0 },
+    { 'l', 1, 8087, 0 },
+    { 'd', 1, 8088, 0 },
+    { 't', 1, 8089, 0 },
+    { ';', 0, 0, 1417 },
+    { ';', 0, 0, 1197 },
+    { 'c', 2, 8090, 0 },
+    { 'e', 1, 8092, 0 },
+    { 's', 1, 8093, 0 },
+    { 'a', 1, 8094, 0 },
+    { 'o', 1, 8095, 0 },
+    { 'r', 1, 8096, 0 },
+    { 'b', 1, 8097, 0 },
+    { 'o', 1, 8098, 0 },
+    { 'r', 1, 8099, 0 },
+    { 't', 1, 8100, 0 },
+    { 'h', 1, 8101, 0 },
+    { 'B', 1, 8102, 0 },
+    { 'L', 1, 8103, 0 },
+    { 'S', 1, 8104, 0 },
+    { 'T', 1, 8105, 0 },
+    { 'S', 1, 8106, 0 },
+    { 'h', 1, 8107, 0 },
+    { ';', 0, 0, 1418 },
+    { ';', 0, 0, 1419 },
+    { ';', 0, 0, 1420 },
+    { ';', 0, 0, 1421 },
+    { ';', 0, 0, 1422 },
+    { ';', 0, 0, 1423 },
+    { ';', 0, 0, 1424 },
+    { ';', 0, 0, 1425 },
+    { ';', 0, 0, 1426 },
+    { ';', 0, 0, 1427 },
+    { ';', 0, 0, 139 },
+    { ';', 0, 0, 1428 },
+    { ';', 0, 0, 705 },
+    { 'l', 1, 8108, 0 },
+    { 'e', 1, 8109, 0 },
+    { 'q', 1, 8110, 0 },
+    { ';', 0, 0, 1094 },
+    { ';', 0, 0, 1429 },
+    { ';', 0, 0, 1329 },
+    { 's', 1, 8111, 0 },
+    { ';', 0, 0, 1331 },
+    { 'g', 1, 8112, 0 },
+    { ';', 0, 0, 1332 },
+    { ';', 0, 0, 692 },
+    { 'e', 1, 8113, 0 },
+    { 'a', 1, 8114, 0 },
+    { 'a', 1, 8115, 0 },
+    { ';', 0, 0, 1209 },
+    { ';', 0, 0, 1305 },
+    { ';', 0, 0, 1430 },
+    { ';', 0, 0, 1431 },
+    { 't', 1, 8116, 0 },
+    { 'k', 1, 8117, 0 },
+    { 'r', 1, 8118, 0 },
+    { ';', 0, 0, 16 },
+    { ';', 0, 0, 45 },
+    { 's', 1, 8119, 0 },
+    { 'i', 1, 8120, 0 },
+    { 'a', 1, 8121, 0 },
+    { ';', 0, 0, 1432 },
+    { ';', 0, 0, 761 },
+    { 'n', 1, 8122, 0 },
+    { 's', 1, 8123, 0 },
+    { ';', 0, 0, 1433 },
+    { 'r', 1, 8124, 0 },
+    { 'u', 1, 8125, 0 },
+    { ';', 0, 0, 773 },
+    { 'g', 1, 8126, 0 },
+    { 'o', 1, 8127, 0 },
+    { ';', 0, 0, 1434 },
+    { 'u', 1, 8128, 0 },
+    { 't', 1, 8129, 0 },
+    { ';', 0, 0, 429 },
+    { ';', 0, 0, 1210 },
+    { 'e', 1, 8130, 0 },
+    { 'r', 1, 8131, 0 },
+    { 'w', 1, 8132, 0 },
+    { 'a', 1, 8133, 0 },
+    { 'o', 1, 8134, 0 },
+    { ';', 0, 0, 677 },
+    { ';', 0, 0, 1435 },
+    { ';', 0, 0, 1436 },
+    { ';', 0, 0, 794 },
+    { 't', 1, 8135, 0 },
+    { 'e', 1, 8136, 0 },
+    { ';', 0, 0, 1437 },
+    { 'i', 1, 8137, 0 },
+    { 'i', 1, 8138, 0 },
+    { 'o', 1, 8139, 0 },
+    { ';', 0, 0, 1438 },
+    { ';', 0, 0, 170 },
+    { ';', 0, 0, 1439 },
+    { ';', 0, 0, 450 },
+    { 'x', 1, 8140, 0 },
+    { 's', 1, 8141, 0 },
+    { 's', 1, 8142, 0 },
+    { 'q', 1, 8143, 0 },
+    { 't', 1, 8144, 0 },
+    { ';', 0, 0, 1276 },
+    { ';', 0, 0, 1296 },
+    { 'a', 1, 8145, 0 },
+    { 't', 1, 8146, 0 },
+    { ';', 0, 0, 316 },
+    { ';', 0, 0, 8 },
+    { ';', 0, 0, 1440 },
+    { ';', 0, 0, 375 },
+    { ';', 0, 0, 1169 },
+    { ';', 0, 0, 1441 },
+    { ';', 0, 0, 1442 },
+    { ';', 0, 0, 1443 },
+    { 'w', 2, 8147, 0 },
+    { 'o', 1, 8149, 0 },
+    { 'a', 1, 8150, 0 },
+    { 't', 3, 8151, 0 },
+    { 'e', 1, 8154, 0 },
+    { ';', 0, 0, 192 },
+    { ';', 0, 0, 1444 },
+    { 'o', 1, 8155, 0 },
+    { 'r', 1, 8156, 0 },
+    { 't', 1, 8157, 0 },
+    { ';', 0, 0, 1121 },
+    { 'h', 1, 8158, 0 },
+    { ';', 0, 0, 486 },
+    { 'a', 1, 8159, 0 },
+    { 'r', 1, 8160, 0 },
+    { 't', 1, 8161, 0 },
+    { 't', 1, 8162, 0 },
+    { 'w', 2, 8163, 0 },
+    { ';', 0, 0, 1124 },
+    { ';', 0, 0, 1445 },
+    { 'q', 1, 8165, 0 },
+    { 'w', 1, 8166, 0 },
+    { 'f', 1, 8167, 0 },
+    { ';', 0, 0, 1446 },
+    { 'a', 1, 8168, 0 },
+    { ';', 0, 0, 878 },
+    { 'o', 1, 8169, 0 },
+    { 'h', 1, 8170, 0 },
+    { 'r', 1, 8171, 0 },
+    { ';', 0, 0, 331 },
+    { ';', 0, 0, 1447 },
+    { 't', 1, 8172, 0 },
+    { 'o', 1, 8173, 0 },
+    { 'h', 1, 8174, 0 },
+    { 't', 1, 8175, 0 },
+    { ';', 0, 0, 1448 },
+    { 'l', 1, 8176, 0 },
+    { 'r', 1, 8177, 0 },
+    { 'd', 1, 8178, 0 },
+    { 'r', 1, 8179, 0 },
+    { 'q', 2, 8180, 0 },
+    { 'q', 2, 8182, 0 },
+    { 'e', 2, 8184, 0 },
+    { ';', 0, 0, 1449 },
+    { ';', 0, 0, 233 },
+    { 'k', 1, 8186, 0 },
+    { ';', 0, 0, 1450 },
+    { ';', 0, 0, 1451 },
+    { 'o', 1, 8187, 0 },
+    { 'y', 1, 8188, 0 },
+    { 'r', 1, 8189, 0 },
+    { ';', 0, 0, 549 },
+    { ';', 0, 0, 1248 },
+    { ';', 0, 0, 1452 },
+    { ';', 0, 0, 1453 },
+    { ';', 0, 0, 1454 },
+    { 'o', 1, 8190, 0 },
+    { ';', 0, 0, 1455 },
+    { 's', 1, 8191, 0 },
+    { ';', 0, 0, 17 },
+    { 'o', 1, 8192, 0 },
+    { 'p', 1, 8193, 0 },
+    { 't', 2, 8194, 0 },
+    { 'h', 1, 8196, 0 },
+    { 'i', 1, 8197, 0 },
+    { 'e', 1, 8198, 0 },
+    { 't', 1, 8199, 0 },
+    { 'h', 1, 8200, 0 },
+    { ';', 0, 0, 1456 },
+    { ';', 0, 0, 1457 },
+    { ';', 0, 0, 1458 },
+    { ';', 0, 0, 974 },
+    { ';', 0, 0, 204 },
+    { 'a', 1, 8201, 0 },
+    { 'm', 1, 8202, 0 },
+    { ';', 0, 0, 1459 },
+    { 't', 1, 8203, 0 },
+    { ';', 0, 0, 984 },
+    { 'e', 1, 8204, 0 },
+    { ';', 0, 0, 985 },
+    { 'e', 1, 8205, 0 },
+    { 'e', 1, 8206, 0 },
+    { 'p', 1, 8207, 0 },
+    { ';', 0, 0, 589 },
+    { 'q', 1, 8208, 0 },
+    { 'q', 2, 8209, 0 },
+    { 'o', 1, 8211, 0 },
+    { 'y', 1, 8212, 0 },
+    { 'r', 1, 8213, 0 },
+    { ';', 0, 0, 574 },
+    { ';', 0, 0, 1275 },
+    { ';', 0, 0, 592 },
+    { 'q', 1, 8214, 0 },
+    { 'q', 2, 8215, 0 },
+    { 'e', 1, 8217, 0 },
+    { ';', 0, 0, 1303 },
+    { 'r', 1, 8218, 0 },
+    { ';', 0, 0, 252 },
+    { ';', 0, 0, 1460 },
+    { ';', 0, 0, 612 },
+    { 'd', 1, 8219, 0 },
+    { 'l', 1, 8220, 0 },
+    { 'q', 1, 8221, 0 },
+    { 'r', 1, 8222, 0 },
+    { ';', 0, 0, 1461 },
+    { ';', 0, 0, 1462 },
+    { 'e', 1, 8223, 0 },
+    { 'i', 1, 8224, 0 },
+    { ';', 0, 0, 1315 },
+    { 'r', 1, 8225, 0 },
+    { 'n', 2, 8226, 0 },
+    { 'w', 1, 8228, 0 },
+    { ';', 0, 0, 1317 },
+    { 'o', 1, 8229, 0 },
+    { ';', 0, 0, 1173 },
+    { 'n', 1, 8230, 0 },
+    { 'o', 1, 8231, 0 },
+    { ';', 0, 0, 1278 },
+    { 't', 1, 8232, 0 },
+    { 't', 1, 8233, 0 },
+    { ';', 0, 0, 1303 },
+    { 'g', 1, 8234, 0 },
+    { 't', 1, 8235, 0 },
+    { ';', 0, 0, 974 },
+    { 's', 1, 8236, 0 },
+    { 'f', 1, 8237, 0 },
+    { ';', 0, 0, 876 },
+    { ';', 0, 0, 534 },
+    { 'u', 1, 8238, 0 },
+    { 's', 1, 8239, 0 },
+    { 'e', 1, 8240, 0 },
+    { 'C', 1, 8241, 0 },
+    { 'y', 2, 8242, 0 },
+    { ';', 0, 0, 798 },
+    { 't', 1, 8244, 0 },
+    { ';', 0, 0, 1108 },
+    { 'o', 1, 8245, 0 },
+    { 'a', 1, 8246, 0 },
+    { 'i', 1, 8247, 0 },
+    { 't', 1, 8248, 0 },
+    { ';', 0, 0, 53 },
+    { 'n', 1, 8249, 0 },
+    { 't', 3, 8250, 0 },
+    { 'g', 2, 8253, 0 },
+    { 'h', 1, 8255, 0 },
+    { 'r', 1, 8256, 0 },
+    { 'o', 1, 8257, 0 },
+    { 't', 1, 8258, 0 },
+    { ';', 0, 0, 419 },
+    { 'B', 1, 8259, 0 },
+    { 'U', 1, 8260, 0 },
+    { ';', 0, 0, 1463 },
+    { 'i', 1, 8261, 0 },
+    { 'e', 1, 8262, 0 },
+    { 'e', 1, 8263, 0 },
+    { 'T', 1, 8264, 0 },
+    { 'V', 1, 8265, 0 },
+    { 'r', 1, 8266, 0 },
+    { ';', 0, 0, 417 },
+    { 'l', 1, 8267, 0 },
+    { 'S', 1, 8268, 0 },
+    { 'e', 1, 8269, 0 },
+    { 'u', 1, 8270, 0 },
+    { 'a', 1, 8271, 0 },
+    { 'l', 1, 8272, 0 },
+    { 'y', 1, 8273, 0 },
+    { 'f', 1, 8274, 0 },
+    { 'u', 1, 8275, 0 },
+    { 'l', 1, 8276, 0 },
+    { 'e', 1, 8277, 0 },
+    { 's', 1, 8278, 0 },
+    { 'a', 1, 8279, 0 },
+    { 'l', 1, 8280, 0 },
+    { 'a', 1, 8281, 0 },
+    { 'l', 1, 8282, 0 },
+    { 'u', 1, 8283, 0 },
+    { ';', 0, 0, 754 },
+    { 'I', 1, 8284, 0 },
+    { 'i', 1, 8285, 0 },
+    { 'C', 1, 8286, 0 },
+    { 'T', 1, 8287, 0 },
+    { 'f', 1, 8288, 0 },
+    { 'B', 1, 8289, 0 },
+    { ';', 0, 0, 479 },
+    { 'B', 1, 8290, 0 },
+    { 'R', 1, 8291, 0 },
+    { 'n', 1, 8292, 0 },
+    { 'e', 1, 8293, 0 },
+    { 'e', 1, 8294, 0 },
+    { 'e', 1, 8295, 0 },
+    { ';', 0, 0, 1190 },
+    { 'A', 1, 8296, 0 },
+    { 'V', 1, 8297, 0 },
+    { 'r', 1, 8298, 0 },
+    { 'c', 1, 8299, 0 },
+    { 'g', 1, 8300, 0 },
+    { 'n', 1, 8301, 0 },
+    { 'V', 1, 8302, 0 },
+    { 't', 1, 8303, 0 },
+    { 'r', 2, 8304, 0 },
+    { ';', 0, 0, 475 },
+    { 'a', 1, 8306, 0 },
+    { 'G', 1, 8307, 0 },
+    { 'q', 1, 8308, 0 },
+    { 'e', 1, 8309, 0 },
+    { 'E', 1, 8310, 0 },
+    { ';', 0, 0, 491 },
+    { 'w', 1, 8311, 0 },
+    { 'r', 1, 8312, 0 },
+    { 'i', 1, 8313, 0 },
+    { 'A', 1, 8314, 0 },
+    { 'r', 1, 8315, 0 },
+    { 'i', 1, 8316, 0 },
+    { 'a', 1, 8317, 0 },
+    { 'A', 1, 8318, 0 },
+    { 't', 1, 8319, 0 },
+    { 'c', 1, 8320, 0 },
+    { ';', 0, 0, 329 },
+    { ';', 0, 0, 39 },
+    { 'e', 1, 8321, 0 },
+    { 'h', 1, 8322, 0 },
+    { 'e', 1, 8323, 0 },
+    { 'a', 1, 8324, 0 },
+    { 's', 1, 8325, 0 },
+    { 'n', 1, 8326, 0 },
+    { 'e', 1, 8327, 0 },
+    { ';', 0, 0, 1464 },
+    { 'V', 1, 8328, 0 },
+    { 't', 1, 8329, 0 },
+    { 'i', 1, 8330, 0 },
+    { ';', 0, 0, 1220 },
+    { 'r', 7, 8331, 0 },
+    { 'w', 1, 8338, 0 },
+    { 'u', 1, 8339, 0 },
+    { 'i', 1, 8340, 0 },
+    { 'u', 1, 8341, 0 },
+    { 'e', 1, 8342, 0 },
+    { 's', 1, 8343, 0 },
+    { 'a', 1, 8344, 0 },
+    { 'l', 1, 8345, 0 },
+    { 'G', 1, 8346, 0 },
+    { 'L', 1, 8347, 0 },
+    { 'e', 1, 8348, 0 },
+    { 'e', 1, 8349, 0 },
+    { 'r', 1, 8350, 0 },
+    { 'S', 1, 8351, 0 },
+    { ';', 0, 0, 1020 },
+    { 'E', 1, 8352, 0 },
+    { 'd', 1, 8353, 0 },
+    { 'e', 1, 8354, 0 },
+    { 'q', 1, 8355, 0 },
+    { 'u', 1, 8356, 0 },
+    { 'i', 1, 8357, 0 },
+    { 'a', 1, 8358, 0 },
+    { 'D', 1, 8359, 0 },
+    { 'Q', 1, 8360, 0 },
+    { ';', 0, 0, 1465 },
+    { 'e', 1, 8361, 0 },
+    { 't', 1, 8362, 0 },
+    { ';', 0, 0, 48 },
+    { 'l', 1, 8363, 0 },
+    { 'q', 1, 8364, 0 },
+    { 'l', 1, 8365, 0 },
+    { 'i', 1, 8366, 0 },
+    { 'n', 2, 8367, 0 },
+    { 'e', 1, 8369, 0 },
+    { 'u', 1, 8370, 0 },
+    { 'E', 1, 8371, 0 },
+    { 'e', 1, 8372, 0 },
+    { 'w', 3, 8373, 0 },
+    { 'i', 1, 8376, 0 },
+    { 'l', 1, 8377, 0 },
+    { 'T', 1, 8378, 0 },
+    { 'V', 1, 8379, 0 },
+    { 'r', 1, 8380, 0 },
+    { 'r', 1, 8381, 0 },
+    { 'e', 1, 8382, 0 },
+    { 'n', 1, 8383, 0 },
+    { 'w', 1, 8384, 0 },
+    { 'e', 1, 8385, 0 },
+    { 'c', 1, 8386, 0 },
+    { 'o', 1, 8387, 0 },
+    { 'w', 1, 8388, 0 },
+    { 'i', 1, 8389, 0 },
+    { 'o', 1, 8390, 0 },
+    { 'e', 1, 8391, 0 },
+    { 'A', 1, 8392, 0 },
+    { 'A', 1, 8393, 0 },
+    { 't', 1, 8394, 0 },
+    { 'r', 1, 8395, 0 },
+    { 'l', 1, 8396, 0 },
+    { 'e', 1, 8397, 0 },
+    { 's', 1, 8398, 0 },
+    { 'e', 1, 8399, 0 },
+    { 'o', 1, 8400, 0 },
+    { 'a', 1, 8401, 0 },
+    { 'q', 1, 8402, 0 },
+    { 'l', 1, 8403, 0 },
+    { 'i', 1, 8404, 0 },
+    { 'q', 1, 8405, 0 },
+    { ';', 0, 0, 1302 },
+    { 'e', 1, 8406, 0 },
+    { ';', 0, 0, 1304 },
+    { 'l', 1, 8407, 0 },
+    { 'E', 1, 8408, 0 },
+    { 'e', 1, 8409, 0 },
+    { ';', 0, 0, 595 },
+    { 'e', 1, 8410, 0 },
+    { 'k', 1, 8411, 0 },
+    { 'n', 1, 8412, 0 },
+    { ';', 0, 0, 1009 },
+    { 'r', 1, 8413, 0 },
+    { 'w', 1, 8414, 0 },
+    { 'o', 1, 8415, 0 },
+    { 'r', 1, 8416, 0 },
+    { 'w', 1, 8417, 0 },
+    { 'o', 1, 8418, 0 },
+    { 'A', 1, 8419, 0 },
+    { 't', 1, 8420, 0 },
+    { 'a', 1, 8421, 0 },
+    { 'i', 1, 8422, 0 },
+    { 'e', 1, 8423, 0 },
+    { 'i', 1, 8424, 0 },
+    { 'p', 1, 8425, 0 },
+    { 'S', 1, 8426, 0 },
+    { 'o', 1, 8427, 0 },
+    { ';', 0, 0, 1098 },
+    { ';', 0, 0, 751 },
+    { ';', 0, 0, 1330 },
+    { 'l', 1, 8428, 0 },
+    { 'n', 1, 8429, 0 },
+    { 'r', 1, 8430, 0 },
+    { 'n', 1, 8431, 0 },
+    { ';', 0, 0, 876 },
+    { ';', 0, 0, 760 },
+    { 'o', 1, 8432, 0 },
+    { 't', 1, 8433, 0 },
+    { 'r', 1, 8434, 0 },
+    { 's', 1, 8435, 0 },
+    { 't', 1, 8436, 0 },
+    { ';', 0, 0, 289 },
+    { 'e', 1, 8437, 0 },
+    { 'c', 1, 8438, 0 },
+    { 'e', 1, 8439, 0 },
+    { 'w', 2, 8440, 0 },
+    { 'i', 1, 8442, 0 },
+    { 'i', 1, 8443, 0 },
+    { ';', 0, 0, 970 },
+    { 'w', 1, 8444, 0 },
+    { ';', 0, 0, 419 },
+    { 'r', 1, 8445, 0 },
+    { 'o', 1, 8446, 0 },
+    { 'r', 1, 8447, 0 },
+    { 's', 1, 8448, 0 },
+    { 'o', 1, 8449, 0 },
+    { 'a', 1, 8450, 0 },
+    { 't', 1, 8451, 0 },
+    { ';', 0, 0, 167 },
+    { ';', 0, 0, 169 },
+    { 's', 1, 8452, 0 },
+    { ';', 0, 0, 455 },
+    { ';', 0, 0, 1161 },
+    { 'r', 1, 8453, 0 },
+    { 'a', 1, 8454, 0 },
+    { ';', 0, 0, 479 },
+    { 't', 1, 8455, 0 },
+    { 'o', 1, 8456, 0 },
+    { 'r', 1, 8457, 0 },
+    { 'a', 1, 8458, 0 },
+    { 'h', 1, 8459, 0 },
+    { 's', 1, 8460, 0 },
+    { 't', 1, 8461, 0 },
+    { 'x', 1, 8462, 0 },
+    { ';', 0, 0, 191 },
+    { 'r', 1, 8463, 0 },
+    { 'e', 1, 8464, 0 },
+    { 'r', 1, 8465, 0 },
+    { 'i', 1, 8466, 0 },
+    { 'o', 1, 8467, 0 },
+    { 'a', 1, 8468, 0 },
+    { 'l', 1, 8469, 0 },
+    { 'r', 1, 8470, 0 },
+    { ';', 0, 0, 495 },
+    { 'n', 1, 8471, 0 },
+    { 't', 1, 8472, 0 },
+    { 'n', 1, 8473, 0 },
+    { 'w', 1, 8474, 0 },
+    { 't', 1, 8475, 0 },
+    { 'o', 1, 8476, 0 },
+    { ';', 0, 0, 509 },
+    { 'w', 1, 8477, 0 },
+    { 't', 1, 8478, 0 },
+    { ';', 0, 0, 513 },
+    { ';', 0, 0, 516 },
+    { 'o', 1, 8479, 0 },
+    { ';', 0, 0, 514 },
+    { 'a', 1, 8480, 0 },
+    { ';', 0, 0, 905 },
+    { 'q', 1, 8481, 0 },
+    { ';', 0, 0, 907 },
+    { 'q', 1, 8482, 0 },
+    { 'l', 1, 8483, 0 },
+    { 'r', 1, 8484, 0 },
+    { ';', 0, 0, 445 },
+    { 'x', 1, 8485, 0 },
+    { 'e', 1, 8486, 0 },
+    { 'o', 1, 8487, 0 },
+    { 'n', 1, 8488, 0 },
+    { ';', 0, 0, 338 },
+    { 'w', 2, 8489, 0 },
+    { 'o', 1, 8491, 0 },
+    { 'a', 1, 8492, 0 },
+    { 'h', 1, 8493, 0 },
+    { 't', 1, 8494, 0 },
+    { 'g', 1, 8495, 0 },
+    { 'e', 1, 8496, 0 },
+    { 's', 1, 8497, 0 },
+    { 'e', 1, 8498, 0 },
+    { 'l', 1, 8499, 0 },
+    { 'i', 1, 8500, 0 },
+    { ';', 0, 0, 1283 },
+    { 'q', 1, 8501, 0 },
+    { 'q', 1, 8502, 0 },
+    { 'p', 1, 8503, 0 },
+    { 'h', 1, 8504, 0 },
+    { ';', 0, 0, 588 },
+    { ';', 0, 0, 988 },
+    { 'q', 1, 8505, 0 },
+    { 'x', 1, 8506, 0 },
+    { 'e', 1, 8507, 0 },
+    { 'o', 1, 8508, 0 },
+    { ';', 0, 0, 591 },
+    { ';', 0, 0, 990 },
+    { 'q', 1, 8509, 0 },
+    { ';', 0, 0, 1302 },
+    { 'o', 1, 8510, 0 },
+    { 'o', 1, 8511, 0 },
+    { 'e', 1, 8512, 0 },
+    { ';', 0, 0, 602 },
+    { 'i', 1, 8513, 0 },
+    { 'f', 1, 8514, 0 },
+    { 'g', 1, 8515, 0 },
+    { 'o', 1, 8516, 0 },
+    { 'l', 1, 8517, 0 },
+    { 'r', 1, 8518, 0 },
+    { 's', 1, 8519, 0 },
+    { 'n', 1, 8520, 0 },
+    { 'g', 1, 8521, 0 },
+    { ';', 0, 0, 551 },
+    { 'n', 1, 8522, 0 },
+    { 'n', 1, 8523, 0 },
+    { 'l', 1, 8524, 0 },
+    { 'i', 1, 8525, 0 },
+    { ';', 0, 0, 286 },
+    { 'f', 1, 8526, 0 },
+    { 's', 1, 8527, 0 },
+    { ';', 0, 0, 925 },
+    { 's', 1, 8528, 0 },
+    { 'o', 1, 8529, 0 },
+    { 'D', 1, 8530, 0 },
+    { 'Q', 1, 8531, 0 },
+    { 'e', 1, 8532, 0 },
+    { 'c', 1, 8533, 0 },
+    { 'l', 4, 8534, 0 },
+    { 'a', 1, 8538, 0 },
+    { 'o', 1, 8539, 0 },
+    { 'A', 1, 8540, 0 },
+    { 'A', 1, 8541, 0 },
+    { 'R', 1, 8542, 0 },
+    { 'T', 1, 8543, 0 },
+    { 'L', 1, 8544, 0 },
+    { 'R', 1, 8545, 0 },
+    { 't', 2, 8546, 0 },
+    { 'r', 1, 8548, 0 },
+    { 'w', 1, 8549, 0 },
+    { 'i', 1, 8550, 0 },
+    { 'a', 1, 8551, 0 },
+    { 'p', 1, 8552, 0 },
+    { 'g', 1, 8553, 0 },
+    { 'e', 1, 8554, 0 },
+    { 'c', 1, 8555, 0 },
+    { 'e', 1, 8556, 0 },
+    { 'e', 1, 8557, 0 },
+    { 'o', 1, 8558, 0 },
+    { 'S', 1, 8559, 0 },
+    { 'm', 1, 8560, 0 },
+    { ';', 0, 0, 439 },
+    { 'm', 1, 8561, 0 },
+    { 'l', 1, 8562, 0 },
+    { 'l', 1, 8563, 0 },
+    { 'S', 1, 8564, 0 },
+    { ';', 0, 0, 303 },
+    { 'a', 1, 8565, 0 },
+    { 'l', 1, 8566, 0 },
+    { 'a', 1, 8567, 0 },
+    { 's', 1, 8568, 0 },
+    { 'n', 1, 8569, 0 },
+    { 'd', 1, 8570, 0 },
+    { 'c', 1, 8571, 0 },
+    { 'L', 1, 8572, 0 },
+    { 'm', 1, 8573, 0 },
+    { ';', 0, 0, 33 },
+    { 'o', 1, 8574, 0 },
+    { 'o', 1, 8575, 0 },
+    { 'i', 1, 8576, 0 },
+    { ';', 0, 0, 327 },
+    { 'r', 1, 8577, 0 },
+    { 'a', 1, 8578, 0 },
+    { 'i', 1, 8579, 0 },
+    { 'g', 1, 8580, 0 },
+    { 'B', 1, 8581, 0 },
+    { 'e', 1, 8582, 0 },
+    { 'c', 1, 8583, 0 },
+    { 'r', 1, 8584, 0 },
+    { 'e', 1, 8585, 0 },
+    { 'o', 1, 8586, 0 },
+    { 't', 1, 8587, 0 },
+    { 'l', 1, 8588, 0 },
+    { 'V', 1, 8589, 0 },
+    { 'e', 1, 8590, 0 },
+    { 'o', 1, 8591, 0 },
+    { ';', 0, 0, 855 },
+    { 'B', 1, 8592, 0 },
+    { 'r', 1, 8593, 0 },
+    { 'r', 1, 8594, 0 },
+    { 'u', 1, 8595, 0 },
+    { 'r', 1, 8596, 0 },
+    { 'q', 1, 8597, 0 },
+    { ';', 0, 0, 843 },
+    { 'r', 1, 8598, 0 },
+    { 'g', 1, 8599, 0 },
+    { 'r', 1, 8600, 0 },
+    { 'r', 1, 8601, 0 },
+    { 'g', 1, 8602, 0 },
+    { 'r', 1, 8603, 0 },
+    { 'r', 1, 8604, 0 },
+    { 'A', 1, 8605, 0 },
+    { 'e', 1, 8606, 0 },
+    { 'd', 1, 8607, 0 },
+    { 'i', 2, 8608, 0 },
+    { 'r', 1, 8610, 0 },
+    { 't', 1, 8611, 0 },
+    { 'L', 1, 8612, 0 },
+    { 'g', 1, 8613, 0 },
+    { 'n', 1, 8614, 0 },
+    { 'e', 1, 8615, 0 },
+    { ';', 0, 0, 897 },
+    { 'l', 1, 8616, 0 },
+    { ';', 0, 0, 215 },
+    { 'E', 1, 8617, 0 },
+    { 'F', 1, 8618, 0 },
+    { 'G', 1, 8619, 0 },
+    { 'L', 1, 8620, 0 },
+    { 'S', 1, 8621, 0 },
+    { 'T', 1, 8622, 0 },
+    { 'n', 1, 8623, 0 },
+    { 'a', 1, 8624, 0 },
+    { 'a', 1, 8625, 0 },
+    { 'a', 1, 8626, 0 },
+    { 'a', 1, 8627, 0 },
+    { 's', 1, 8628, 0 },
+    { 'n', 1, 8629, 0 },
+    { 'd', 1, 8630, 0 },
+    { 'r', 1, 8631, 0 },
+    { 'e', 1, 8632, 0 },
+    { 's', 3, 8633, 0 },
+    { 'E', 1, 8636, 0 },
+    { 'i', 1, 8637, 0 },
+    { 'u', 2, 8638, 0 },
+    { 'q', 1, 8640, 0 },
+    { 's', 4, 8641, 0 },
+    { 't', 2, 8645, 0 },
+    { 'u', 1, 8647, 0 },
+    { 'l', 1, 8648, 0 },
+    { 'l', 1, 8649, 0 },
+    { 'l', 1, 8650, 0 },
+    { 'o', 1, 8651, 0 },
+    { 'u', 1, 8652, 0 },
+    { 't', 1, 8653, 0 },
+    { 'h', 1, 8654, 0 },
+    { 'a', 1, 8655, 0 },
+    { 'u', 1, 8656, 0 },
+    { 'a', 1, 8657, 0 },
+    { 'l', 1, 8658, 0 },
+    { ';', 0, 0, 647 },
+    { 'a', 1, 8659, 0 },
+    { 'm', 1, 8660, 0 },
+    { 'i', 1, 8661, 0 },
+    { 'q', 1, 8662, 0 },
+    { 'B', 1, 8663, 0 },
+    { ';', 0, 0, 561 },
+    { 'B', 1, 8664, 0 },
+    { 'L', 1, 8665, 0 },
+    { 'n', 1, 8666, 0 },
+    { 'e', 1, 8667, 0 },
+    { 'e', 1, 8668, 0 },
+    { 'e', 1, 8669, 0 },
+    { ';', 0, 0, 1264 },
+    { 'r', 1, 8670, 0 },
+    { 'c', 1, 8671, 0 },
+    { 'g', 1, 8672, 0 },
+    { 'n', 1, 8673, 0 },
+    { 'V', 1, 8674, 0 },
+    { 't', 1, 8675, 0 },
+    { 'r', 2, 8676, 0 },
+    { ';', 0, 0, 556 },
+    { 'e', 1, 8678, 0 },
+    { 'w', 1, 8679, 0 },
+    { 'd', 1, 8680, 0 },
+    { 'r', 1, 8681, 0 },
+    { 'r', 1, 8682, 0 },
+    { 'A', 1, 8683, 0 },
+    { 'o', 1, 8684, 0 },
+    { 'e', 1, 8685, 0 },
+    { 'r', 1, 8686, 0 },
+    { 'e', 1, 8687, 0 },
+    { 'r', 1, 8688, 0 },
+    { 'n', 1, 8689, 0 },
+    { 'l', 1, 8690, 0 },
+    { 'u', 1, 8691, 0 },
+    { 'a', 1, 8692, 0 },
+    { 'l', 1, 8693, 0 },
+    { 'u', 1, 8694, 0 },
+    { ';', 0, 0, 1466 },
+    { ';', 0, 0, 579 },
+    { 'q', 1, 8695, 0 },
+    { ';', 0, 0, 22 },
+    { ';', 0, 0, 1467 },
+    { 'e', 1, 8696, 0 },
+    { 't', 1, 8697, 0 },
+    { ';', 0, 0, 1468 },
+    { 'n', 1, 8698, 0 },
+    { 'w', 1, 8699, 0 },
+    { 'i', 1, 8700, 0 },
+    { ';', 0, 0, 1446 },
+    { 'w', 1, 8701, 0 },
+    { 'r', 1, 8702, 0 },
+    { 'A', 1, 8703, 0 },
+    { 'r', 1, 8704, 0 },
+    { 'n', 1, 8705, 0 },
+    { 'p', 1, 8706, 0 },
+    { 'l', 1, 8707, 0 },
+    { 'a', 1, 8708, 0 },
+    { 'p', 1, 8709, 0 },
+    { 'n', 1, 8710, 0 },
+    { 'e', 2, 8711, 0 },
+    { 'g', 1, 8713, 0 },
+    { 'e', 1, 8714, 0 },
+    { 'g', 1, 8715, 0 },
+    { 'w', 2, 8716, 0 },
+    { ';', 0, 0, 530 },
+    { 'c', 1, 8718, 0 },
+    { 'h', 1, 8719, 0 },
+    { ';', 0, 0, 410 },
+    { 'c', 1, 8720, 0 },
+    { 'c', 1, 8721, 0 },
+    { ';', 0, 0, 774 },
+    { 'l', 1, 8722, 0 },
+    { 'r', 1, 8723, 0 },
+    { 't', 1, 8724, 0 },
+    { 'm', 1, 8725, 0 },
+    { 'e', 1, 8726, 0 },
+    { 'r', 1, 8727, 0 },
+    { 'n', 2, 8728, 0 },
+    { ';', 0, 0, 158 },
+    { 's', 1, 8730, 0 },
+    { 'n', 1, 8731, 0 },
+    { 'l', 1, 8732, 0 },
+    { 's', 1, 8733, 0 },
+    { ';', 0, 0, 166 },
+    { 'r', 1, 8734, 0 },
+    { 'r', 1, 8735, 0 },
+    { 'a', 1, 8736, 0 },
+    { 'n', 2, 8737, 0 },
+    { 'r', 1, 8739, 0 },
+    { 'r', 1, 8740, 0 },
+    { 'a', 1, 8741, 0 },
+    { 'q', 1, 8742, 0 },
+    { 'i', 1, 8743, 0 },
+    { ';', 0, 0, 188 },
+    { ';', 0, 0, 187 },
+    { ';', 0, 0, 1194 },
+    { 'r', 1, 8744, 0 },
+    { 'g', 1, 8745, 0 },
+    { ';', 0, 0, 623 },
+    { 'r', 1, 8746, 0 },
+    { 'e', 1, 8747, 0 },
+    { 'i', 1, 8748, 0 },
+    { ';', 0, 0, 1469 },
+    { ';', 0, 0, 1470 },
+    { 'g', 1, 8749, 0 },
+    { ';', 0, 0, 893 },
+    { 'a', 1, 8750, 0 },
+    { 'w', 1, 8751, 0 },
+    { ';', 0, 0, 894 },
+    { 'a', 1, 8752, 0 },
+    { 'w', 1, 8753, 0 },
+    { 'l', 1, 8754, 0 },
+    { ';', 0, 0, 904 },
+    { ';', 0, 0, 906 },
+    { 'e', 1, 8755, 0 },
+    { 'i', 1, 8756, 0 },
+    { ';', 0, 0, 548 },
+    { 'q', 1, 8757, 0 },
+    { 'x', 1, 8758, 0 },
+    { 's', 1, 8759, 0 },
+    { ';', 0, 0, 561 },
+    { 't', 1, 8760, 0 },
+    { 'o', 1, 8761, 0 },
+    { 'r', 1, 8762, 0 },
+    { 'a', 1, 8763, 0 },
+    { 'a', 1, 8764, 0 },
+    { 'a', 1, 8765, 0 },
+    { 't', 1, 8766, 0 },
+    { 'e', 1, 8767, 0 },
+    { ';', 0, 0, 1266 },
+    { 'l', 1, 8768, 0 },
+    { 'n', 1, 8769, 0 },
+    { ';', 0, 0, 1286 },
+    { ';', 0, 0, 1287 },
+    { 's', 1, 8770, 0 },
+    { 'i', 1, 8771, 0 },
+    { ';', 0, 0, 987 },
+    { ';', 0, 0, 573 },
+    { 'q', 1, 8772, 0 },
+    { 'x', 1, 8773, 0 },
+    { ';', 0, 0, 989 },
+    { 'x', 1, 8774, 0 },
+    { 'w', 1, 8775, 0 },
+    { 'f', 1, 8776, 0 },
+    { 'g', 1, 8777, 0 },
+    { 't', 1, 8778, 0 },
+    { 'h', 1, 8779, 0 },
+    { 'w', 1, 8780, 0 },
+    { 'e', 1, 8781, 0 },
+    { 'i', 1, 8782, 0 },
+    { ';', 0, 0, 1014 },
+    { ';', 0, 0, 797 },
+    { ';', 0, 0, 794 },
+    { 'e', 1, 8783, 0 },
+    { 'e', 1, 8784, 0 },
+    { 'e', 2, 8785, 0 },
+    { 'o', 1, 8787, 0 },
+    { 'e', 1, 8788, 0 },
+    { ';', 0, 0, 1239 },
+    { ';', 0, 0, 1241 },
+    { 'n', 1, 8789, 0 },
+    { 'o', 1, 8790, 0 },
+    { 'u', 1, 8791, 0 },
+    { 'g', 1, 8792, 0 },
+    { 'k', 1, 8793, 0 },
+    { 'A', 1, 8794, 0 },
+    { 'D', 1, 8795, 0 },
+    { 'G', 1, 8796, 0 },
+    { 'T', 1, 8797, 0 },
+    { 'l', 1, 8798, 0 },
+    { 'u', 1, 8799, 0 },
+    { 'r', 1, 8800, 0 },
+    { 'r', 1, 8801, 0 },
+    { 'i', 1, 8802, 0 },
+    { 'e', 1, 8803, 0 },
+    { 'e', 1, 8804, 0 },
+    { 'i', 1, 8805, 0 },
+    { 'A', 1, 8806, 0 },
+    { 'T', 1, 8807, 0 },
+    { 'o', 1, 8808, 0 },
+    { 'n', 1, 8809, 0 },
+    { 'c', 1, 8810, 0 },
+    { 'r', 1, 8811, 0 },
+    { 'A', 1, 8812, 0 },
+    { 'h', 1, 8813, 0 },
+    { 'V', 1, 8814, 0 },
+    { 't', 1, 8815, 0 },
+    { 'e', 1, 8816, 0 },
+    { 'c', 1, 8817, 0 },
+    { 'w', 1, 8818, 0 },
+    { 'q', 1, 8819, 0 },
+    { 'a', 1, 8820, 0 },
+    { ';', 0, 0, 955 },
+    { 'E', 1, 8821, 0 },
+    { 'S', 1, 8822, 0 },
+    { 'm', 1, 8823, 0 },
+    { 'l', 2, 8824, 0 },
+    { 'E', 1, 8826, 0 },
+    { 't', 1, 8827, 0 },
+    { ';', 0, 0, 31 },
+    { 't', 1, 8828, 0 },
+    { 'e', 1, 8829, 0 },
+    { 'e', 1, 8830, 0 },
+    { 'i', 1, 8831, 0 },
+    { 'p', 1, 8832, 0 },
+    { 'n', 1, 8833, 0 },
+    { 'm', 1, 8834, 0 },
+    { 'm', 1, 8835, 0 },
+    { 'a', 1, 8836, 0 },
+    { 'r', 1, 8837, 0 },
+    { 'g', 1, 8838, 0 },
+    { ';', 0, 0, 851 },
+    { 'r', 1, 8839, 0 },
+    { 'V', 1, 8840, 0 },
+    { 't', 1, 8841, 0 },
+    { 'r', 1, 8842, 0 },
+    { 'c', 1, 8843, 0 },
+    { 'w', 1, 8844, 0 },
+    { 'o', 1, 8845, 0 },
+    { 'e', 3, 8846, 0 },
+    { 'e', 1, 8849, 0 },
+    { 'c', 1, 8850, 0 },
+    { 'r', 2, 8851, 0 },
+    { 'a', 1, 8853, 0 },
+    { 'r', 1, 8854, 0 },
+    { 'e', 1, 8855, 0 },
+    { 'a', 1, 8856, 0 },
+    { ';', 0, 0, 38 },
+    { 'u', 1, 8857, 0 },
+    { 'o', 1, 8858, 0 },
+    { 'h', 1, 8859, 0 },
+    { 'r', 1, 8860, 0 },
+    { 'o', 1, 8861, 0 },
+    { 'h', 1, 8862, 0 },
+    { 'r', 1, 8863, 0 },
+    { 'r', 1, 8864, 0 },
+    { 'r', 1, 8865, 0 },
+    { ';', 0, 0, 1471 },
+    { 'i', 1, 8866, 0 },
+    { 'c', 1, 8867, 0 },
+    { 'n', 1, 8868, 0 },
+    { 'y', 1, 8869, 0 },
+    { 'e', 1, 8870, 0 },
+    { 'e', 1, 8871, 0 },
+    { 'S', 1, 8872, 0 },
+    { 't', 1, 8873, 0 },
+    { 'r', 1, 8874, 0 },
+    { 'd', 1, 8875, 0 },
+    { 'q', 1, 8876, 0 },
+    { 'u', 1, 8877, 0 },
+    { 'r', 1, 8878, 0 },
+    { 'e', 1, 8879, 0 },
+    { 'l', 1, 8880, 0 },
+    { 'i', 1, 8881, 0 },
+    { 'H', 1, 8882, 0 },
+    { 'l', 1, 8883, 0 },
+    { 'n', 1, 8884, 0 },
+    { 'l', 1, 8885, 0 },
+    { 't', 1, 8886, 0 },
+    { ';', 0, 0, 504 },
+    { 't', 1, 8887, 0 },
+    { 'e', 1, 8888, 0 },
+    { 'e', 1, 8889, 0 },
+    { 's', 1, 8890, 0 },
+    { ';', 0, 0, 220 },
+    { 'E', 1, 8891, 0 },
+    { 'S', 1, 8892, 0 },
+    { 'l', 1, 8893, 0 },
+    { 'a', 1, 8894, 0 },
+    { 'b', 1, 8895, 0 },
+    { 'p', 1, 8896, 0 },
+    { 'u', 1, 8897, 0 },
+    { ';', 0, 0, 221 },
+    { 'E', 1, 8898, 0 },
+    { 'S', 1, 8899, 0 },
+    { 'T', 1, 8900, 0 },
+    { ';', 0, 0, 1021 },
+    { 'E', 1, 8901, 0 },
+    { 'a', 1, 8902, 0 },
+    { 'l', 1, 8903, 0 },
+    { 'd', 1, 8904, 0 },
+    { 'B', 1, 8905, 0 },
+    { 'u', 1, 8906, 0 },
+    { 'o', 1, 8907, 0 },
+    { ';', 0, 0, 594 },
+    { 'e', 1, 8908, 0 },
+    { 'n', 1, 8909, 0 },
+    { 'a', 1, 8910, 0 },
+    { 'n', 1, 8911, 0 },
+    { 'd', 1, 8912, 0 },
+    { 'l', 1, 8913, 0 },
+    { 'e', 1, 8914, 0 },
+    { 'l', 1, 8915, 0 },
+    { 'u', 1, 8916, 0 },
+    { 'r', 1, 8917, 0 },
+    { 'a', 1, 8918, 0 },
+    { 'e', 1, 8919, 0 },
+    { 'g', 1, 8920, 0 },
+    { 'B', 1, 8921, 0 },
+    { 'e', 1, 8922, 0 },
+    { 'c', 1, 8923, 0 },
+    { 'o', 1, 8924, 0 },
+    { 't', 1, 8925, 0 },
+    { 'l', 1, 8926, 0 },
+    { 'V', 1, 8927, 0 },
+    { 'e', 1, 8928, 0 },
+    { 'o', 1, 8929, 0 },
+    { ';', 0, 0, 953 },
+    { 'B', 1, 8930, 0 },
+    { 's', 1, 8931, 0 },
+    { ';', 0, 0, 939 },
+    { ';', 0, 0, 1472 },
+    { 'r', 1, 8932, 0 },
+    { 'r', 1, 8933, 0 },
+    { 'r', 1, 8934, 0 },
+    { 'w', 1, 8935, 0 },
+    { ';', 0, 0, 1107 },
+    { 's', 1, 8936, 0 },
+    { 't', 2, 8937, 0 },
+    { 's', 1, 8939, 0 },
+    { ';', 0, 0, 983 },
+    { ';', 0, 0, 589 },
+    { 'a', 1, 8940, 0 },
+    { 'n', 1, 8941, 0 },
+    { 'd', 1, 8942, 0 },
+    { 'a', 1, 8943, 0 },
+    { 'u', 1, 8944, 0 },
+    { 't', 1, 8945, 0 },
+    { 'h', 1, 8946, 0 },
+    { 'A', 1, 8947, 0 },
+    { ';', 0, 0, 615 },
+    { 'u', 1, 8948, 0 },
+    { ';', 0, 0, 613 },
+    { 'r', 1, 8949, 0 },
+    { 'r', 1, 8950, 0 },
+    { ';', 0, 0, 204 },
+    { 'e', 1, 8951, 0 },
+    { 'a', 1, 8952, 0 },
+    { 'd', 1, 8953, 0 },
+    { 'c', 1, 8954, 0 },
+    { 'a', 1, 8955, 0 },
+    { ';', 0, 0, 707 },
+    { 'd', 1, 8956, 0 },
+    { 'u', 1, 8957, 0 },
+    { 'e', 1, 8958, 0 },
+    { ';', 0, 0, 585 },
+    { 'l', 1, 8959, 0 },
+    { 'l', 1, 8960, 0 },
+    { 'r', 1, 8961, 0 },
+    { ';', 0, 0, 531 },
+    { ';', 0, 0, 914 },
+    { ';', 0, 0, 769 },
+    { ';', 0, 0, 770 },
+    { 'e', 1, 8962, 0 },
+    { 'i', 1, 8963, 0 },
+    { ';', 0, 0, 782 },
+    { 'e', 1, 8964, 0 },
+    { 'd', 1, 8965, 0 },
+    { 'o', 1, 8966, 0 },
+    { 'l', 1, 8967, 0 },
+    { 'r', 1, 8968, 0 },
+    { ';', 0, 0, 160 },
+    { ';', 0, 0, 300 },
+    { 'e', 1, 8969, 0 },
+    { 'e', 1, 8970, 0 },
+    { 'o', 1, 8971, 0 },
+    { 'r', 1, 8972, 0 },
+    { 'i', 1, 8973, 0 },
+    { 'd', 1, 8974, 0 },
+    { 'u', 1, 8975, 0 },
+    { 'o', 1, 8976, 0 },
+    { 'r', 1, 8977, 0 },
+    { 'r', 1, 8978, 0 },
+    { 'u', 1, 8979, 0 },
+    { 'm', 1, 8980, 0 },
+    { 'o', 1, 8981, 0 },
+    { 'h', 1, 8982, 0 },
+    { 'r', 1, 8983, 0 },
+    { 'f', 1, 8984, 0 },
+    { 'g', 1, 8985, 0 },
+    { 'l', 1, 8986, 0 },
+    { 'r', 1, 8987, 0 },
+    { ';', 0, 0, 900 },
+    { 'r', 1, 8988, 0 },
+    { ';', 0, 0, 901 },
+    { 'l', 1, 8989, 0 },
+    { 'f', 1, 8990, 0 },
+    { 'g', 1, 8991, 0 },
+    { ';', 0, 0, 934 },
+    { ';', 0, 0, 936 },
+    { ';', 0, 0, 308 },
+    { 'a', 1, 8992, 0 },
+    { 'n', 2, 8993, 0 },
+    { 'r', 1, 8995, 0 },
+    { 'r', 1, 8996, 0 },
+    { 'r', 1, 8997, 0 },
+    { 'r', 1, 8998, 0 },
+    { 'i', 1, 8999, 0 },
+    { 'q', 1, 9000, 0 },
+    { 'e', 1, 9001, 0 },
+    { 'u', 1, 9002, 0 },
+    { 'i', 1, 9003, 0 },
+    { ';', 0, 0, 544 },
+    { ';', 0, 0, 966 },
+    { ';', 0, 0, 968 },
+    { ';', 0, 0, 22 },
+    { 'n', 1, 9004, 0 },
+    { 't', 2, 9005, 0 },
+    { 'h', 1, 9007, 0 },
+    { 'a', 1, 9008, 0 },
+    { 't', 1, 9009, 0 },
+    { ';', 0, 0, 615 },
+    { 'f', 1, 9010, 0 },
+    { 'g', 1, 9011, 0 },
+    { 'q', 2, 9012, 0 },
+    { 'q', 2, 9014, 0 },
+    { 'l', 1, 9016, 0 },
+    { 'r', 1, 9017, 0 },
+    { 'n', 1, 9018, 0 },
+    { 'r', 1, 9019, 0 },
+    { 't', 1, 9020, 0 },
+    { 'u', 1, 9021, 0 },
+    { 'o', 1, 9022, 0 },
+    { 'r', 1, 9023, 0 },
+    { 'w', 1, 9024, 0 },
+    { 'c', 1, 9025, 0 },
+    { 'o', 2, 9026, 0 },
+    { 'r', 1, 9028, 0 },
+    { 'i', 1, 9029, 0 },
+    { 'D', 1, 9030, 0 },
+    { 'r', 1, 9031, 0 },
+    { 'r', 1, 9032, 0 },
+    { 'r', 1, 9033, 0 },
+    { 'g', 1, 9034, 0 },
+    { 'e', 1, 9035, 0 },
+    { 'f', 1, 9036, 0 },
+    { 'g', 1, 9037, 0 },
+    { 'r', 1, 9038, 0 },
+    { 'e', 1, 9039, 0 },
+    { 'w', 1, 9040, 0 },
+    { 'A', 1, 9041, 0 },
+    { 'a', 1, 9042, 0 },
+    { ';', 0, 0, 1473 },
+    { 'r', 1, 9043, 0 },
+    { 't', 1, 9044, 0 },
+    { 'e', 1, 9045, 0 },
+    { 'o', 1, 9046, 0 },
+    { 'V', 1, 9047, 0 },
+    { 't', 1, 9048, 0 },
+    { ';', 0, 0, 1469 },
+    { 'u', 1, 9049, 0 },
+    { 'l', 1, 9050, 0 },
+    { ';', 0, 0, 25 },
+    { 'q', 1, 9051, 0 },
+    { 'a', 1, 9052, 0 },
+    { ';', 0, 0, 30 },
+    { 'L', 1, 9053, 0 },
+    { 'q', 1, 9054, 0 },
+    { 'e', 1, 9055, 0 },
+    { 'E', 1, 9056, 0 },
+    { ';', 0, 0, 453 },
+    { ';', 0, 0, 309 },
+    { 'n', 1, 9057, 0 },
+    { ';', 0, 0, 402 },
+    { ';', 0, 0, 621 },
+    { 'm', 1, 9058, 0 },
+    { 'e', 1, 9059, 0 },
+    { 'c', 1, 9060, 0 },
+    { ';', 0, 0, 846 },
+    { 'h', 1, 9061, 0 },
+    { 'a', 1, 9062, 0 },
+    { 'e', 1, 9063, 0 },
+    { 'o', 1, 9064, 0 },
+    { 'o', 1, 9065, 0 },
+    { 't', 1, 9066, 0 },
+    { ';', 0, 0, 1470 },
+    { 'r', 1, 9067, 0 },
+    { ';', 0, 0, 1019 },
+    { 'B', 1, 9068, 0 },
+    { 'E', 1, 9069, 0 },
+    { 'c', 1, 9070, 0 },
+    { 't', 1, 9071, 0 },
+    { ';', 0, 0, 1003 },
+    { 'B', 1, 9072, 0 },
+    { 'r', 1, 9073, 0 },
+    { 'o', 1, 9074, 0 },
+    { 'a', 1, 9075, 0 },
+    { 'l', 1, 9076, 0 },
+    { 'a', 1, 9077, 0 },
+    { 'w', 1, 9078, 0 },
+    { 't', 1, 9079, 0 },
+    { 'o', 1, 9080, 0 },
+    { 'w', 1, 9081, 0 },
+    { 't', 1, 9082, 0 },
+    { 'o', 1, 9083, 0 },
+    { 'o', 1, 9084, 0 },
+    { 'r', 1, 9085, 0 },
+    { 'u', 1, 9086, 0 },
+    { 'k', 1, 9087, 0 },
+    { 'S', 1, 9088, 0 },
+    { 'T', 1, 9089, 0 },
+    { 'r', 1, 9090, 0 },
+    { 's', 1, 9091, 0 },
+    { 'p', 1, 9092, 0 },
+    { ';', 0, 0, 1219 },
+    { 't', 1, 9093, 0 },
+    { 'e', 1, 9094, 0 },
+    { 'u', 1, 9095, 0 },
+    { 'l', 1, 9096, 0 },
+    { 'e', 1, 9097, 0 },
+    { 's', 1, 9098, 0 },
+    { 'a', 1, 9099, 0 },
+    { 'l', 1, 9100, 0 },
+    { 'u', 1, 9101, 0 },
+    { ';', 0, 0, 1215 },
+    { 'g', 1, 9102, 0 },
+    { ';', 0, 0, 218 },
+    { 'e', 1, 9103, 0 },
+    { 'E', 1, 9104, 0 },
+    { ';', 0, 0, 895 },
+    { 'a', 1, 9105, 0 },
+    { 's', 1, 9106, 0 },
+    { 'q', 1, 9107, 0 },
+    { 'l', 1, 9108, 0 },
+    { 'e', 1, 9109, 0 },
+    { 'n', 1, 9110, 0 },
+    { 's', 1, 9111, 0 },
+    { 'e', 1, 9112, 0 },
+    { 'a', 1, 9113, 0 },
+    { 'q', 1, 9114, 0 },
+    { 'l', 1, 9115, 0 },
+    { 'i', 1, 9116, 0 },
+    { 'q', 1, 9117, 0 },
+    { 'l', 1, 9118, 0 },
+    { 'E', 1, 9119, 0 },
+    { 'e', 1, 9120, 0 },
+    { 'a', 1, 9121, 0 },
+    { 'b', 1, 9122, 0 },
+    { 't', 1, 9123, 0 },
+    { 's', 1, 9124, 0 },
+    { 'e', 1, 9125, 0 },
+    { 'l', 1, 9126, 0 },
+    { 't', 1, 9127, 0 },
+    { 'e', 1, 9128, 0 },
+    { ';', 0, 0, 551 },
+    { 'n', 1, 9129, 0 },
+    { 'i', 1, 9130, 0 },
+    { 'i', 1, 9131, 0 },
+    { 'a', 1, 9132, 0 },
+    { 'r', 1, 9133, 0 },
+    { 'f', 1, 9134, 0 },
+    { ';', 0, 0, 950 },
+    { 'r', 1, 9135, 0 },
+    { 'V', 1, 9136, 0 },
+    { 't', 1, 9137, 0 },
+    { 'w', 1, 9138, 0 },
+    { 'o', 1, 9139, 0 },
+    { 'e', 3, 9140, 0 },
+    { 'e', 1, 9143, 0 },
+    { 'c', 1, 9144, 0 },
+    { 'r', 2, 9145, 0 },
+    { 'a', 1, 9147, 0 },
+    { ';', 0, 0, 1474 },
+    { 'o', 1, 9148, 0 },
+    { 'o', 1, 9149, 0 },
+    { 'r', 1, 9150, 0 },
+    { ';', 0, 0, 607 },
+    { 'e', 1, 9151, 0 },
+    { ';', 0, 0, 984 },
+    { 'E', 1, 9152, 0 },
+    { 'e', 1, 9153, 0 },
+    { 'l', 1, 9154, 0 },
+    { 't', 1, 9155, 0 },
+    { 'e', 1, 9156, 0 },
+    { 'l', 1, 9157, 0 },
+    { 'a', 1, 9158, 0 },
+    { ';', 0, 0, 389 },
+    { 'e', 1, 9159, 0 },
+    { 'r', 1, 9160, 0 },
+    { 'm', 1, 9161, 0 },
+    { 'o', 1, 9162, 0 },
+    { 'r', 1, 9163, 0 },
+    { ';', 0, 0, 616 },
+    { 'r', 1, 9164, 0 },
+    { 'e', 1, 9165, 0 },
+    { 'e', 1, 9166, 0 },
+    { 'c', 1, 9167, 0 },
+    { 'o', 1, 9168, 0 },
+    { 'p', 1, 9169, 0 },
+    { ';', 0, 0, 488 },
+    { 'e', 4, 9170, 0 },
+    { 'e', 1, 9174, 0 },
+    { 'i', 1, 9175, 0 },
+    { 'f', 1, 9176, 0 },
+    { 'g', 1, 9177, 0 },
+    { 's', 1, 9178, 0 },
+    { 'g', 1, 9179, 0 },
+    { 'w', 1, 9180, 0 },
+    { 'e', 1, 9181, 0 },
+    { 'i', 1, 9182, 0 },
+    { ';', 0, 0, 25 },
+    { 'q', 1, 9183, 0 },
+    { 'w', 1, 9184, 0 },
+    { 'o', 1, 9185, 0 },
+    { 'l', 1, 9186, 0 },
+    { 'o', 1, 9187, 0 },
+    { 'p', 1, 9188, 0 },
+    { 'w', 1, 9189, 0 },
+    { 'o', 1, 9190, 0 },
+    { 'p', 1, 9191, 0 },
+    { 'i', 1, 9192, 0 },
+    { 'e', 1, 9193, 0 },
+    { 'w', 1, 9194, 0 },
+    { 't', 1, 9195, 0 },
+    { 'o', 1, 9196, 0 },
+    { 't', 1, 9197, 0 },
+    { 'h', 1, 9198, 0 },
+    { 'e', 1, 9199, 0 },
+    { 'r', 1, 9200, 0 },
+    { 'r', 1, 9201, 0 },
+    { 'e', 1, 9202, 0 },
+    { 't', 2, 9203, 0 },
+    { 'h', 1, 9205, 0 },
+    { 'i', 1, 9206, 0 },
+    { 'd', 1, 9207, 0 },
+    { 'u', 1, 9208, 0 },
+    { 'o', 1, 9209, 0 },
+    { 'p', 1, 9210, 0 },
+    { 'r', 1, 9211, 0 },
+    { 'r', 1, 9212, 0 },
+    { 'm', 1, 9213, 0 },
+    { ';', 0, 0, 799 },
+    { 'l', 1, 9214, 0 },
+    { 's', 1, 9215, 0 },
+    { 'l', 1, 9216, 0 },
+    { ';', 0, 0, 427 },
+    { ';', 0, 0, 494 },
+    { 'e', 1, 9217, 0 },
+    { 't', 2, 9218, 0 },
+    { 'r', 1, 9220, 0 },
+    { 'a', 1, 9221, 0 },
+    { 't', 1, 9222, 0 },
+    { 'h', 1, 9223, 0 },
+    { ';', 0, 0, 1324 },
+    { 'q', 1, 9224, 0 },
+    { ';', 0, 0, 1326 },
+    { 'q', 1, 9225, 0 },
+    { 'e', 1, 9226, 0 },
+    { 'i', 1, 9227, 0 },
+    { ';', 0, 0, 21 },
+    { 'e', 1, 9228, 0 },
+    { 'o', 1, 9229, 0 },
+    { 'b', 1, 9230, 0 },
+    { 't', 1, 9231, 0 },
+    { 'a', 1, 9232, 0 },
+    { 'i', 1, 9233, 0 },
+    { 'u', 1, 9234, 0 },
+    { 't', 1, 9235, 0 },
+    { 'u', 1, 9236, 0 },
+    { 'a', 1, 9237, 0 },
+    { 'l', 1, 9238, 0 },
+    { ';', 0, 0, 23 },
+    { 'I', 1, 9239, 0 },
+    { 'o', 1, 9240, 0 },
+    { 'o', 1, 9241, 0 },
+    { 'h', 1, 9242, 0 },
+    { ';', 0, 0, 649 },
+    { 't', 2, 9243, 0 },
+    { 'h', 1, 9245, 0 },
+    { 'r', 1, 9246, 0 },
+    { 'e', 1, 9247, 0 },
+    { ';', 0, 0, 605 },
+    { 'r', 1, 9248, 0 },
+    { 'l', 1, 9249, 0 },
+    { 'r', 1, 9250, 0 },
+    { 'V', 1, 9251, 0 },
+    { 'c', 1, 9252, 0 },
+    { 'r', 2, 9253, 0 },
+    { 'e', 1, 9255, 0 },
+    { 'o', 1, 9256, 0 },
+    { 'a', 1, 9257, 0 },
+    { 'l', 1, 9258, 0 },
+    { 'u', 1, 9259, 0 },
+    { 'l', 1, 9260, 0 },
+    { 'e', 1, 9261, 0 },
+    { 'u', 1, 9262, 0 },
+    { 'r', 1, 9263, 0 },
+    { 'q', 1, 9264, 0 },
+    { 'e', 1, 9265, 0 },
+    { 'a', 1, 9266, 0 },
+    { 's', 1, 9267, 0 },
+    { 'k', 1, 9268, 0 },
+    { 't', 1, 9269, 0 },
+    { 'c', 1, 9270, 0 },
+    { 'c', 1, 9271, 0 },
+    { 'r', 2, 9272, 0 },
+    { 'w', 1, 9274, 0 },
+    { 'o', 1, 9275, 0 },
+    { ';', 0, 0, 1475 },
+    { 'a', 1, 9276, 0 },
+    { 'q', 1, 9277, 0 },
+    { 't', 1, 9278, 0 },
+    { 'o', 1, 9279, 0 },
+    { 'a', 1, 9280, 0 },
+    { ';', 0, 0, 1476 },
+    { 'w', 1, 9281, 0 },
+    { 't', 1, 9282, 0 },
+    { ';', 0, 0, 36 },
+    { 'l', 1, 9283, 0 },
+    { ';', 0, 0, 1029 },
+    { 'A', 1, 9284, 0 },
+    { 'w', 1, 9285, 0 },
+    { ';', 0, 0, 1028 },
+    { 'a', 1, 9286, 0 },
+    { 'w', 1, 9287, 0 },
+    { 'w', 1, 9288, 0 },
+    { 'o', 1, 9289, 0 },
+    { 'm', 1, 9290, 0 },
+    { 'S', 1, 9291, 0 },
+    { 'p', 1, 9292, 0 },
+    { 'h', 1, 9293, 0 },
+    { 'G', 1, 9294, 0 },
+    { 's', 1, 9295, 0 },
+    { 'a', 1, 9296, 0 },
+    { 'i', 1, 9297, 0 },
+    { ';', 0, 0, 888 },
+    { 'a', 1, 9298, 0 },
+    { 'l', 1, 9299, 0 },
+    { 'a', 1, 9300, 0 },
+    { 's', 1, 9301, 0 },
+    { 'n', 1, 9302, 0 },
+    { 'd', 1, 9303, 0 },
+    { 'm', 1, 9304, 0 },
+    { 'l', 1, 9305, 0 },
+    { 'r', 1, 9306, 0 },
+    { 'q', 1, 9307, 0 },
+    { 't', 1, 9308, 0 },
+    { 'L', 1, 9309, 0 },
+    { 'u', 1, 9310, 0 },
+    { 'a', 1, 9311, 0 },
+    { 'm', 1, 9312, 0 },
+    { 'g', 1, 9313, 0 },
+    { 'e', 1, 9314, 0 },
+    { 'r', 1, 9315, 0 },
+    { 'l', 1, 9316, 0 },
+    { 'u', 1, 9317, 0 },
+    { 'a', 1, 9318, 0 },
+    { 'l', 1, 9319, 0 },
+    { 'u', 1, 9320, 0 },
+    { ';', 0, 0, 903 },
+    { 'q', 1, 9321, 0 },
+    { ';', 0, 0, 209 },
+    { 'r', 1, 9322, 0 },
+    { 'l', 1, 9323, 0 },
+    { 'e', 1, 9324, 0 },
+    { 'i', 1, 9325, 0 },
+    { ';', 0, 0, 82 },
+    { ';', 0, 0, 240 },
+    { 'E', 1, 9326, 0 },
+    { ';', 0, 0, 937 },
+    { 't', 1, 9327, 0 },
+    { 'b', 1, 9328, 0 },
+    { 'l', 1, 9329, 0 },
+    { 'c', 1, 9330, 0 },
+    { ';', 0, 0, 943 },
+    { 't', 1, 9331, 0 },
+    { 'a', 1, 9332, 0 },
+    { 'e', 1, 9333, 0 },
+    { 'o', 1, 9334, 0 },
+    { ';', 0, 0, 200 },
+    { 'r', 1, 9335, 0 },
+    { ';', 0, 0, 1022 },
+    { 'B', 1, 9336, 0 },
+    { 'E', 1, 9337, 0 },
+    { 'c', 1, 9338, 0 },
+    { 't', 1, 9339, 0 },
+    { ';', 0, 0, 1004 },
+    { 'B', 1, 9340, 0 },
+    { 'r', 1, 9341, 0 },
+    { 'w', 1, 9342, 0 },
+    { 'w', 1, 9343, 0 },
+    { 'o', 1, 9344, 0 },
+    { 'c', 1, 9345, 0 },
+    { 'q', 1, 9346, 0 },
+    { 't', 2, 9347, 0 },
+    { ';', 0, 0, 248 },
+    { 'E', 1, 9349, 0 },
+    { ';', 0, 0, 969 },
+    { ';', 0, 0, 592 },
+    { 'l', 1, 9350, 0 },
+    { 's', 1, 9351, 0 },
+    { 'r', 1, 9352, 0 },
+    { ';', 0, 0, 1001 },
+    { 'w', 1, 9353, 0 },
+    { 'o', 1, 9354, 0 },
+    { 'a', 1, 9355, 0 },
+    { ';', 0, 0, 55 },
+    { ';', 0, 0, 1159 },
+    { 'e', 1, 9356, 0 },
+    { 'w', 1, 9357, 0 },
+    { ';', 0, 0, 1033 },
+    { ';', 0, 0, 1013 },
+    { 'd', 1, 9358, 0 },
+    { 'l', 1, 9359, 0 },
+    { 'r', 1, 9360, 0 },
+    { 'f', 1, 9361, 0 },
+    { 'g', 1, 9362, 0 },
+    { 't', 1, 9363, 0 },
+    { 'h', 1, 9364, 0 },
+    { ';', 0, 0, 1120 },
+    { 'e', 1, 9365, 0 },
+    { 's', 1, 9366, 0 },
+    { 'f', 1, 9367, 0 },
+    { 'g', 1, 9368, 0 },
+    { ';', 0, 0, 791 },
+    { ';', 0, 0, 1180 },
+    { 'w', 1, 9369, 0 },
+    { ';', 0, 0, 1183 },
+    { 'w', 1, 9370, 0 },
+    { ';', 0, 0, 855 },
+    { 's', 1, 9371, 0 },
+    { 'w', 2, 9372, 0 },
+    { 'o', 1, 9374, 0 },
+    { 'g', 1, 9375, 0 },
+    { 's', 1, 9376, 0 },
+    { ';', 0, 0, 1029 },
+    { 'a', 1, 9377, 0 },
+    { 'w', 1, 9378, 0 },
+    { ';', 0, 0, 1181 },
+    { 't', 1, 9379, 0 },
+    { ';', 0, 0, 1090 },
+    { 'o', 1, 9380, 0 },
+    { 'o', 1, 9381, 0 },
+    { 'l', 1, 9382, 0 },
+    { ';', 0, 0, 896 },
+    { 'e', 1, 9383, 0 },
+    { 't', 2, 9384, 0 },
+    { 'l', 1, 9386, 0 },
+    { 'o', 1, 9387, 0 },
+    { 'p', 1, 9388, 0 },
+    { 'w', 1, 9389, 0 },
+    { 'o', 1, 9390, 0 },
+    { 'o', 1, 9391, 0 },
+    { 'o', 1, 9392, 0 },
+    { 'e', 1, 9393, 0 },
+    { ';', 0, 0, 233 },
+    { ';', 0, 0, 974 },
+    { 'o', 1, 9394, 0 },
+    { 'q', 1, 9395, 0 },
+    { ';', 0, 0, 572 },
+    { 'e', 1, 9396, 0 },
+    { 'r', 1, 9397, 0 },
+    { 'r', 1, 9398, 0 },
+    { ';', 0, 0, 1003 },
+    { 't', 1, 9399, 0 },
+    { ';', 0, 0, 1323 },
+    { ';', 0, 0, 1325 },
+    { 'f', 1, 9400, 0 },
+    { 'g', 1, 9401, 0 },
+    { 'n', 1, 9402, 0 },
+    { 'u', 1, 9403, 0 },
+    { 'l', 1, 9404, 0 },
+    { 'e', 1, 9405, 0 },
+    { 'l', 1, 9406, 0 },
+    { 's', 1, 9407, 0 },
+    { 't', 1, 9408, 0 },
+    { ';', 0, 0, 155 },
+    { 'b', 1, 9409, 0 },
+    { 'v', 1, 9410, 0 },
+    { 'd', 1, 9411, 0 },
+    { 'n', 1, 9412, 0 },
+    { 'w', 1, 9413, 0 },
+    { 'w', 1, 9414, 0 },
+    { 't', 1, 9415, 0 },
+    { 'A', 1, 9416, 0 },
+    { 'R', 1, 9417, 0 },
+    { 't', 1, 9418, 0 },
+    { 'o', 1, 9419, 0 },
+    { ';', 0, 0, 1016 },
+    { 'r', 1, 9420, 0 },
+    { 'B', 1, 9421, 0 },
+    { 'o', 1, 9422, 0 },
+    { 'e', 1, 9423, 0 },
+    { 't', 1, 9424, 0 },
+    { ';', 0, 0, 854 },
+    { 'B', 1, 9425, 0 },
+    { 'c', 1, 9426, 0 },
+    { 'r', 2, 9427, 0 },
+    { 'r', 1, 9429, 0 },
+    { 'S', 1, 9430, 0 },
+    { 'a', 1, 9431, 0 },
+    { 'l', 1, 9432, 0 },
+    { 's', 1, 9433, 0 },
+    { 'a', 1, 9434, 0 },
+    { ';', 0, 0, 1477 },
+    { 'u', 1, 9435, 0 },
+    { ';', 0, 0, 396 },
+    { ';', 0, 0, 32 },
+    { ';', 0, 0, 35 },
+    { 'e', 1, 9436, 0 },
+    { 'A', 1, 9437, 0 },
+    { 'k', 1, 9438, 0 },
+    { 't', 1, 9439, 0 },
+    { ';', 0, 0, 780 },
+    { 'B', 1, 9440, 0 },
+    { ';', 0, 0, 457 },
+    { 'r', 1, 9441, 0 },
+    { 'r', 1, 9442, 0 },
+    { 'u', 1, 9443, 0 },
+    { 'o', 1, 9444, 0 },
+    { 'r', 1, 9445, 0 },
+    { 'r', 1, 9446, 0 },
+    { ';', 0, 0, 179 },
+    { 'e', 1, 9447, 0 },
+    { ';', 0, 0, 192 },
+    { 'r', 1, 9448, 0 },
+    { ';', 0, 0, 1032 },
+    { 'r', 1, 9449, 0 },
+    { ';', 0, 0, 1031 },
+    { ';', 0, 0, 992 },
+    { 'w', 1, 9450, 0 },
+    { 'S', 1, 9451, 0 },
+    { 'p', 1, 9452, 0 },
+    { 'a', 1, 9453, 0 },
+    { 'i', 1, 9454, 0 },
+    { 'r', 1, 9455, 0 },
+    { ';', 0, 0, 10 },
+    { 'c', 1, 9456, 0 },
+    { 'c', 1, 9457, 0 },
+    { 'l', 1, 9458, 0 },
+    { 'E', 1, 9459, 0 },
+    { 't', 1, 9460, 0 },
+    { ';', 0, 0, 523 },
+    { 't', 1, 9461, 0 },
+    { 'e', 1, 9462, 0 },
+    { 'p', 1, 9463, 0 },
+    { 'e', 3, 9464, 0 },
+    { ';', 0, 0, 524 },
+    { 'u', 1, 9467, 0 },
+    { 'e', 1, 9468, 0 },
+    { 'e', 1, 9469, 0 },
+    { 'a', 1, 9470, 0 },
+    { 'n', 1, 9471, 0 },
+    { 'e', 1, 9472, 0 },
+    { 'l', 1, 9473, 0 },
+    { 't', 2, 9474, 0 },
+    { 's', 1, 9476, 0 },
+    { ';', 0, 0, 905 },
+    { 'a', 1, 9477, 0 },
+    { 'n', 1, 9478, 0 },
+    { 'd', 1, 9479, 0 },
+    { 'a', 1, 9480, 0 },
+    { 'u', 1, 9481, 0 },
+    { ';', 0, 0, 514 },
+    { 'e', 1, 9482, 0 },
+    { ';', 0, 0, 869 },
+    { 's', 1, 9483, 0 },
+    { 'q', 1, 9484, 0 },
+    { ';', 0, 0, 42 },
+    { 'r', 1, 9485, 0 },
+    { 'i', 1, 9486, 0 },
+    { 'k', 1, 9487, 0 },
+    { 'A', 1, 9488, 0 },
+    { 'c', 1, 9489, 0 },
+    { 'c', 1, 9490, 0 },
+    { 'r', 2, 9491, 0 },
+    { ';', 0, 0, 1478 },
+    { 'a', 1, 9493, 0 },
+    { 'q', 1, 9494, 0 },
+    { 't', 1, 9495, 0 },
+    { 'o', 1, 9496, 0 },
+    { 'a', 1, 9497, 0 },
+    { ';', 0, 0, 1479 },
+    { ';', 0, 0, 419 },
+    { ';', 0, 0, 479 },
+    { 'w', 1, 9498, 0 },
+    { 't', 1, 9499, 0 },
+    { 'u', 1, 9500, 0 },
+    { ';', 0, 0, 985 },
+    { 'E', 1, 9501, 0 },
+    { 'q', 1, 9502, 0 },
+    { ';', 0, 0, 411 },
+    { 'i', 1, 9503, 0 },
+    { 'o', 1, 9504, 0 },
+    { ';', 0, 0, 912 },
+    { 'w', 1, 9505, 0 },
+    { 't', 1, 9506, 0 },
+    { ';', 0, 0, 1480 },
+    { 'n', 1, 9507, 0 },
+    { 'o', 1, 9508, 0 },
+    { 'e', 1, 9509, 0 },
+    { 'i', 1, 9510, 0 },
+    { 't', 1, 9511, 0 },
+    { 'h', 1, 9512, 0 },
+    { ';', 0, 0, 1110 },
+    { 't', 1, 9513, 0 },
+    { ';', 0, 0, 1038 },
+    { ';', 0, 0, 778 },
+    { 't', 1, 9514, 0 },
+    { 'h', 1, 9515, 0 },
+    { ';', 0, 0, 1256 },
+    { 'n', 1, 9516, 0 },
+    { ';', 0, 0, 857 },
+    { ';', 0, 0, 457 },
+    { 's', 1, 9517, 0 },
+    { 'o', 1, 9518, 0 },
+    { 'a', 1, 9519, 0 },
+    { ';', 0, 0, 1202 },
+    { 'r', 1, 9520, 0 },
+    { ';', 0, 0, 1032 },
+    { ';', 0, 0, 1257 },
+    { 'w', 1, 9521, 0 },
+    { 'w', 1, 9522, 0 },
+    { ';', 0, 0, 516 },
+    { 'q', 1, 9523, 0 },
+    { ';', 0, 0, 902 },
+    { 'e', 1, 9524, 0 },
+    { ';', 0, 0, 1259 },
+    { 'w', 1, 9525, 0 },
+    { ';', 0, 0, 953 },
+    { 's', 1, 9526, 0 },
+    { 'o', 1, 9527, 0 },
+    { 'w', 1, 9528, 0 },
+    { 'w', 1, 9529, 0 },
+    { 's', 1, 9530, 0 },
+    { 'n', 1, 9531, 0 },
+    { ';', 0, 0, 872 },
+    { 'q', 1, 9532, 0 },
+    { 'o', 1, 9533, 0 },
+    { 'r', 1, 9534, 0 },
+    { ';', 0, 0, 1004 },
+    { 't', 1, 9535, 0 },
+    { 'h', 1, 9536, 0 },
+    { 't', 1, 9537, 0 },
+    { 'r', 1, 9538, 0 },
+    { 'e', 1, 9539, 0 },
+    { ';', 0, 0, 962 },
+    { ';', 0, 0, 536 },
+    { 'e', 1, 9540, 0 },
+    { 'e', 1, 9541, 0 },
+    { 'l', 1, 9542, 0 },
+    { 'e', 1, 9543, 0 },
+    { 'e', 1, 9544, 0 },
+    { 't', 1, 9545, 0 },
+    { ';', 0, 0, 417 },
+    { ';', 0, 0, 475 },
+    { 'A', 1, 9546, 0 },
+    { 'r', 1, 9547, 0 },
+    { 'i', 1, 9548, 0 },
+    { 'A', 1, 9549, 0 },
+    { 'w', 1, 9550, 0 },
+    { 'o', 1, 9551, 0 },
+    { 'a', 1, 9552, 0 },
+    { 'w', 1, 9553, 0 },
+    { 'c', 1, 9554, 0 },
+    { 'o', 1, 9555, 0 },
+    { 'a', 1, 9556, 0 },
+    { 't', 1, 9557, 0 },
+    { ';', 0, 0, 952 },
+    { 'B', 1, 9558, 0 },
+    { 'e', 1, 9559, 0 },
+    { 'q', 1, 9560, 0 },
+    { 'r', 1, 9561, 0 },
+    { 'S', 1, 9562, 0 },
+    { 's', 1, 9563, 0 },
+    { 'l', 1, 9564, 0 },
+    { 'a', 1, 9565, 0 },
+    { 't', 1, 9566, 0 },
+    { 'r', 1, 9567, 0 },
+    { 'e', 1, 9568, 0 },
+    { 'o', 1, 9569, 0 },
+    { 'a', 1, 9570, 0 },
+    { ';', 0, 0, 1481 },
+    { ';', 0, 0, 1482 },
+    { 'a', 1, 9571, 0 },
+    { 'r', 1, 9572, 0 },
+    { ';', 0, 0, 1483 },
+    { ';', 0, 0, 1484 },
+    { 'r', 1, 9573, 0 },
+    { 'r', 1, 9574, 0 },
+    { 'r', 1, 9575, 0 },
+    { ';', 0, 0, 973 },
+    { 'p', 1, 9576, 0 },
+    { 'a', 1, 9577, 0 },
+    { 'c', 1, 9578, 0 },
+    { 'n', 1, 9579, 0 },
+    { 'e', 1, 9580, 0 },
+    { 'e', 1, 9581, 0 },
+    { 'a', 1, 9582, 0 },
+    { ';', 0, 0, 214 },
+    { 'q', 1, 9583, 0 },
+    { 'e', 1, 9584, 0 },
+    { 'E', 1, 9585, 0 },
+    { ';', 0, 0, 889 },
+    { ';', 0, 0, 882 },
+    { ';', 0, 0, 896 },
+    { 'B', 1, 9586, 0 },
+    { 'E', 1, 9587, 0 },
+    { 'a', 1, 9588, 0 },
+    { 'r', 1, 9589, 0 },
+    { 's', 1, 9590, 0 },
+    { 'l', 1, 9591, 0 },
+    { 't', 1, 9592, 0 },
+    { 'n', 1, 9593, 0 },
+    { 'e', 3, 9594, 0 },
+    { ';', 0, 0, 1485 },
+    { 'E', 1, 9597, 0 },
+    { 'e', 1, 9598, 0 },
+    { 'l', 1, 9599, 0 },
+    { 't', 1, 9600, 0 },
+    { 'e', 1, 9601, 0 },
+    { 'l', 1, 9602, 0 },
+    { 'a', 1, 9603, 0 },
+    { 'Q', 1, 9604, 0 },
+    { ';', 0, 0, 1486 },
+    { 'u', 1, 9605, 0 },
+    { 'i', 1, 9606, 0 },
+    { 'b', 1, 9607, 0 },
+    { 'e', 1, 9608, 0 },
+    { 'r', 1, 9609, 0 },
+    { 'k', 1, 9610, 0 },
+    { 't', 1, 9611, 0 },
+    { ';', 0, 0, 781 },
+    { 'B', 1, 9612, 0 },
+    { 'r', 1, 9613, 0 },
+    { 'u', 1, 9614, 0 },
+    { 'o', 1, 9615, 0 },
+    { 'r', 1, 9616, 0 },
+    { 'r', 1, 9617, 0 },
+    { ';', 0, 0, 561 },
+    { 'i', 1, 9618, 0 },
+    { 'a', 1, 9619, 0 },
+    { 'q', 1, 9620, 0 },
+    { 'u', 1, 9621, 0 },
+    { 's', 1, 9622, 0 },
+    { 'w', 1, 9623, 0 },
+    { ';', 0, 0, 886 },
+    { 'o', 1, 9624, 0 },
+    { ';', 0, 0, 1025 },
+    { 'w', 1, 9625, 0 },
+    { 'f', 1, 9626, 0 },
+    { 'g', 1, 9627, 0 },
+    { ';', 0, 0, 919 },
+    { 't', 1, 9628, 0 },
+    { ';', 0, 0, 1114 },
+    { ';', 0, 0, 780 },
+    { 't', 1, 9629, 0 },
+    { ';', 0, 0, 854 },
+    { ';', 0, 0, 864 },
+    { 'n', 1, 9630, 0 },
+    { 'r', 1, 9631, 0 },
+    { 'r', 1, 9632, 0 },
+    { ';', 0, 0, 890 },
+    { ';', 0, 0, 891 },
+    { ';', 0, 0, 1221 },
+    { 'q', 1, 9633, 0 },
+    { 'n', 1, 9634, 0 },
+    { ';', 0, 0, 954 },
+    { 'n', 1, 9635, 0 },
+    { 's', 1, 9636, 0 },
+    { ';', 0, 0, 945 },
+    { ';', 0, 0, 1270 },
+    { ';', 0, 0, 797 },
+    { ';', 0, 0, 963 },
+    { 'w', 1, 9637, 0 },
+    { 'o', 1, 9638, 0 },
+    { ';', 0, 0, 1019 },
+    { 't', 1, 9639, 0 },
+    { 'i', 1, 9640, 0 },
+    { 'I', 1, 9641, 0 },
+    { 'Q', 1, 9642, 0 },
+    { 'C', 1, 9643, 0 },
+    { ';', 0, 0, 378 },
+    { 'e', 1, 9644, 0 },
+    { ';', 0, 0, 817 },
+    { ';', 0, 0, 994 },
+    { 'e', 1, 9645, 0 },
+    { 'r', 1, 9646, 0 },
+    { 'r', 1, 9647, 0 },
+    { 'g', 1, 9648, 0 },
+    { 'r', 1, 9649, 0 },
+    { ';', 0, 0, 556 },
+    { 'w', 1, 9650, 0 },
+    { 'r', 1, 9651, 0 },
+    { ';', 0, 0, 787 },
+    { 't', 1, 9652, 0 },
+    { 'r', 1, 9653, 0 },
+    { 'r', 1, 9654, 0 },
+    { 'o', 1, 9655, 0 },
+    { 'a', 1, 9656, 0 },
+    { ';', 0, 0, 1487 },
+    { 'u', 1, 9657, 0 },
+    { 'e', 1, 9658, 0 },
+    { 'q', 1, 9659, 0 },
+    { ';', 0, 0, 169 },
+    { ';', 0, 0, 29 },
+    { 'l', 1, 9660, 0 },
+    { ';', 0, 0, 477 },
+    { 'r', 1, 9661, 0 },
+    { 't', 1, 9662, 0 },
+    { 'r', 1, 9663, 0 },
+    { 'r', 1, 9664, 0 },
+    { 'l', 1, 9665, 0 },
+    { ';', 0, 0, 1488 },
+    { ';', 0, 0, 191 },
+    { 'o', 1, 9666, 0 },
+    { 'o', 1, 9667, 0 },
+    { 'a', 1, 9668, 0 },
+    { 'c', 1, 9669, 0 },
+    { 'e', 1, 9670, 0 },
+    { 'S', 1, 9671, 0 },
+    { 'a', 1, 9672, 0 },
+    { ';', 0, 0, 210 },
+    { 'l', 1, 9673, 0 },
+    { 'u', 1, 9674, 0 },
+    { 'r', 1, 9675, 0 },
+    { 'q', 1, 9676, 0 },
+    { 'a', 1, 9677, 0 },
+    { 'q', 1, 9678, 0 },
+    { 'l', 1, 9679, 0 },
+    { 'G', 1, 9680, 0 },
+    { 's', 1, 9681, 0 },
+    { ';', 0, 0, 517 },
+    { 'E', 1, 9682, 0 },
+    { 't', 1, 9683, 0 },
+    { ';', 0, 0, 902 },
+    { 'B', 1, 9684, 0 },
+    { 'E', 1, 9685, 0 },
+    { 'q', 1, 9686, 0 },
+    { 't', 2, 9687, 0 },
+    { ';', 0, 0, 518 },
+    { 'E', 1, 9689, 0 },
+    { ';', 0, 0, 1489 },
+    { ';', 0, 0, 907 },
+    { 'l', 1, 9690, 0 },
+    { 'u', 1, 9691, 0 },
+    { 'a', 1, 9692, 0 },
+    { 'u', 1, 9693, 0 },
+    { 'r', 1, 9694, 0 },
+    { 't', 1, 9695, 0 },
+    { 'r', 1, 9696, 0 },
+    { 'e', 1, 9697, 0 },
+    { 'o', 1, 9698, 0 },
+    { 'a', 1, 9699, 0 },
+    { ';', 0, 0, 1490 },
+    { 'a', 1, 9700, 0 },
+    { 'r', 1, 9701, 0 },
+    { ';', 0, 0, 1491 },
+    { ';', 0, 0, 1492 },
+    { 'o', 1, 9702, 0 },
+    { 'l', 1, 9703, 0 },
+    { 'u', 1, 9704, 0 },
+    { 'a', 1, 9705, 0 },
+    { ';', 0, 0, 1493 },
+    { ';', 0, 0, 1000 },
+    { 'r', 1, 9706, 0 },
+    { 'n', 1, 9707, 0 },
+    { 't', 1, 9708, 0 },
+    { 'h', 1, 9709, 0 },
+    { ';', 0, 0, 926 },
+    { ';', 0, 0, 781 },
+    { 's', 1, 9710, 0 },
+    { 'r', 1, 9711, 0 },
+    { 'o', 1, 9712, 0 },
+    { ';', 0, 0, 1227 },
+    { ';', 0, 0, 952 },
+    { 's', 1, 9713, 0 },
+    { ';', 0, 0, 961 },
+    { ';', 0, 0, 325 },
+    { 'w', 1, 9714, 0 },
+    { ';', 0, 0, 1022 },
+    { 'a', 1, 9715, 0 },
+    { 'n', 1, 9716, 0 },
+    { 'u', 1, 9717, 0 },
+    { 'o', 1, 9718, 0 },
+    { 'A', 1, 9719, 0 },
+    { 'g', 1, 9720, 0 },
+    { 'r', 1, 9721, 0 },
+    { 'o', 1, 9722, 0 },
+    { 'h', 1, 9723, 0 },
+    { 'r', 1, 9724, 0 },
+    { ';', 0, 0, 613 },
+    { ';', 0, 0, 233 },
+    { 'o', 1, 9725, 0 },
+    { ';', 0, 0, 1494 },
+    { ';', 0, 0, 1495 },
+    { 'r', 1, 9726, 0 },
+    { 'r', 1, 9727, 0 },
+    { 'a', 1, 9728, 0 },
+    { ';', 0, 0, 1496 },
+    { 'u', 1, 9729, 0 },
+    { ';', 0, 0, 170 },
+    { 'o', 1, 9730, 0 },
+    { ';', 0, 0, 862 },
+    { ';', 0, 0, 1497 },
+    { ';', 0, 0, 1498 },
+    { ';', 0, 0, 872 },
+    { 'w', 1, 9731, 0 },
+    { 'w', 1, 9732, 0 },
+    { 'c', 1, 9733, 0 },
+    { 'e', 1, 9734, 0 },
+    { ';', 0, 0, 1480 },
+    { 'p', 1, 9735, 0 },
+    { 't', 1, 9736, 0 },
+    { 'B', 1, 9737, 0 },
+    { 'a', 1, 9738, 0 },
+    { ';', 0, 0, 503 },
+    { 'u', 1, 9739, 0 },
+    { 'r', 1, 9740, 0 },
+    { 'u', 1, 9741, 0 },
+    { ';', 0, 0, 513 },
+    { 'r', 1, 9742, 0 },
+    { ';', 0, 0, 1499 },
+    { 'q', 1, 9743, 0 },
+    { ';', 0, 0, 898 },
+    { 'a', 1, 9744, 0 },
+    { 'q', 1, 9745, 0 },
+    { 'u', 1, 9746, 0 },
+    { ';', 0, 0, 1500 },
+    { 'E', 1, 9747, 0 },
+    { 'q', 1, 9748, 0 },
+    { ';', 0, 0, 883 },
+    { 'o', 1, 9749, 0 },
+    { 'l', 1, 9750, 0 },
+    { 'm', 1, 9751, 0 },
+    { 'i', 1, 9752, 0 },
+    { ';', 0, 0, 559 },
+    { 'o', 1, 9753, 0 },
+    { 't', 1, 9754, 0 },
+    { 'r', 1, 9755, 0 },
+    { 'r', 1, 9756, 0 },
+    { 'l', 1, 9757, 0 },
+    { ';', 0, 0, 1501 },
+    { 'n', 1, 9758, 0 },
+    { ';', 0, 0, 1286 },
+    { 'a', 1, 9759, 0 },
+    { 'l', 1, 9760, 0 },
+    { ';', 0, 0, 1502 },
+    { ';', 0, 0, 786 },
+    { ';', 0, 0, 873 },
+    { 't', 1, 9761, 0 },
+    { ';', 0, 0, 865 },
+    { 'o', 1, 9762, 0 },
+    { 'w', 1, 9763, 0 },
+    { ';', 0, 0, 955 },
+    { ';', 0, 0, 341 },
+    { 'l', 1, 9764, 0 },
+    { 't', 1, 9765, 0 },
+    { 'o', 1, 9766, 0 },
+    { 'n', 1, 9767, 0 },
+    { 'c', 1, 9768, 0 },
+    { 'r', 1, 9769, 0 },
+    { 'o', 1, 9770, 0 },
+    { 'w', 1, 9771, 0 },
+    { 't', 1, 9772, 0 },
+    { 'o', 1, 9773, 0 },
+    { 'r', 1, 9774, 0 },
+    { ';', 0, 0, 1503 },
+    { ';', 0, 0, 1504 },
+    { 'r', 1, 9775, 0 },
+    { 'a', 1, 9776, 0 },
+    { 'w', 1, 9777, 0 },
+    { ';', 0, 0, 1027 },
+    { ';', 0, 0, 1026 },
+    { 'e', 1, 9778, 0 },
+    { ';', 0, 0, 1480 },
+    { 'a', 1, 9779, 0 },
+    { 'e', 1, 9780, 0 },
+    { 'a', 1, 9781, 0 },
+    { 'l', 1, 9782, 0 },
+    { 'a', 1, 9783, 0 },
+    { ';', 0, 0, 1505 },
+    { 'a', 1, 9784, 0 },
+    { 'e', 1, 9785, 0 },
+    { 'u', 1, 9786, 0 },
+    { 'r', 1, 9787, 0 },
+    { 'u', 1, 9788, 0 },
+    { 'a', 1, 9789, 0 },
+    { 'q', 1, 9790, 0 },
+    { 'u', 1, 9791, 0 },
+    { 't', 1, 9792, 0 },
+    { ';', 0, 0, 934 },
+    { ';', 0, 0, 865 },
+    { 'u', 1, 9793, 0 },
+    { 'w', 1, 9794, 0 },
+    { ';', 0, 0, 959 },
+    { ';', 0, 0, 1506 },
+    { ';', 0, 0, 1507 },
+    { ';', 0, 0, 963 },
+    { ';', 0, 0, 982 },
+    { 'l', 1, 9795, 0 },
+    { ';', 0, 0, 966 },
+    { ';', 0, 0, 964 },
+    { 'w', 1, 9796, 0 },
+    { ';', 0, 0, 1027 },
+    { 'D', 1, 9797, 0 },
+    { 'e', 1, 9798, 0 },
+    { 't', 1, 9799, 0 },
+    { 't', 1, 9800, 0 },
+    { 'u', 1, 9801, 0 },
+    { 'a', 1, 9802, 0 },
+    { 'w', 1, 9803, 0 },
+    { ';', 0, 0, 1028 },
+    { 'A', 1, 9804, 0 },
+    { 'w', 1, 9805, 0 },
+    { ';', 0, 0, 1508 },
+    { 'e', 1, 9806, 0 },
+    { 'r', 1, 9807, 0 },
+    { ';', 0, 0, 864 },
+    { ';', 0, 0, 1480 },
+    { 'c', 1, 9808, 0 },
+    { 'r', 1, 9809, 0 },
+    { 'r', 1, 9810, 0 },
+    { ';', 0, 0, 213 },
+    { 'l', 1, 9811, 0 },
+    { 'l', 1, 9812, 0 },
+    { 'a', 1, 9813, 0 },
+    { 'a', 1, 9814, 0 },
+    { ';', 0, 0, 1509 },
+    { 'a', 1, 9815, 0 },
+    { 'l', 1, 9816, 0 },
+    { 'u', 1, 9817, 0 },
+    { 'a', 1, 9818, 0 },
+    { 'e', 1, 9819, 0 },
+    { 'm', 1, 9820, 0 },
+    { ';', 0, 0, 954 },
+    { ';', 0, 0, 1287 },
+    { ';', 0, 0, 822 },
+    { ';', 0, 0, 4 },
+    { 'g', 1, 9821, 0 },
+    { 'e', 1, 9822, 0 },
+    { 'o', 1, 9823, 0 },
+    { 't', 1, 9824, 0 },
+    { 'l', 1, 9825, 0 },
+    { ';', 0, 0, 179 },
+    { 'r', 1, 9826, 0 },
+    { ';', 0, 0, 1031 },
+    { ';', 0, 0, 1510 },
+    { 'e', 1, 9827, 0 },
+    { 'e', 1, 9828, 0 },
+    { ';', 0, 0, 7 },
+    { ';', 0, 0, 516 },
+    { ';', 0, 0, 509 },
+    { ';', 0, 0, 1221 },
+    { 't', 1, 9829, 0 },
+    { 'l', 1, 9830, 0 },
+    { 'l', 1, 9831, 0 },
+    { ';', 0, 0, 1375 },
+    { 'a', 1, 9832, 0 },
+    { 'l', 1, 9833, 0 },
+    { ';', 0, 0, 852 },
+    { ';', 0, 0, 788 },
+    { 'r', 1, 9834, 0 },
+    { ';', 0, 0, 951 },
+    { 'u', 1, 9835, 0 },
+    { 'e', 1, 9836, 0 },
+    { ';', 0, 0, 1042 },
+    { 'r', 1, 9837, 0 },
+    { ';', 0, 0, 585 },
+    { ';', 0, 0, 1480 },
+    { 'e', 1, 9838, 0 },
+    { ';', 0, 0, 1224 },
+    { ';', 0, 0, 1227 },
+    { 'l', 1, 9839, 0 },
+    { ';', 0, 0, 1228 },
+    { 'a', 1, 9840, 0 },
+    { 'r', 1, 9841, 0 },
+    { ';', 0, 0, 777 },
+    { 'o', 1, 9842, 0 },
+    { 'r', 1, 9843, 0 },
+    { ';', 0, 0, 1376 },
+    { 'l', 1, 9844, 0 },
+    { 'I', 1, 9845, 0 },
+    { 'w', 1, 9846, 0 },
+    { ';', 0, 0, 1511 },
+    { ';', 0, 0, 1434 },
+    { 'n', 1, 9847, 0 },
+    { ';', 0, 0, 1026 },
+    { 't', 1, 9848, 0 },
+    { 'e', 1, 9849, 0 },
+    { 'g', 1, 9850, 0 },
+    { 'r', 1, 9851, 0 },
+    { 'a', 1, 9852, 0 },
+    { 'l', 1, 9853, 0 },
+    { ';', 0, 0, 1428 },
 };
 
 const NSUInteger LongestEntityNameLength = 32;
 
-static int (^NamedMapPrefixComparator)(const void *, const void *) = ^int(const void *voidKey, const void *voidItem) {
-    const NSString *key = (__bridge const NSString *)voidKey;
-    const NamedReferenceMap *item = voidItem;
-    if ([key hasPrefix:item->name]) {
-        return 0;
-    } else {
-        return (int) [key compare:item->name];
+NSUInteger NextNamedEntityNode(NSUInteger node, UTF32Char c)
+{
+    const NamedReferenceNode *parent = &NamedReferenceNodes[node];
+    NSUInteger end = parent->firstChild + parent->numberOfChildren;
+    for (NSUInteger i = parent->firstChild; i < end; i++) {
+        UTF32Char character = (UTF32Char)NamedReferenceNodes[i].character;
+        if (character == c) {
+            return i;
+        } else if (character > c) {
+            break;
+        }
     }
-};
+    return 0;
+}
+
+NSString * NamedEntityReplacementAtNode(NSUInteger node)
+{
+    uint16_t replacement = NamedReferenceNodes[node].replacement;
+    return replacement ? NamedReferenceReplacements[replacement - 1] : nil;
+}
 
 NSString * StringForNamedEntity(NSString *search, NSString **parsedName)
 {
-    // If there's a semicolon, we're looking for an exact prefix match.
-    NamedReferenceMap *match = bsearch_b((__bridge void *)search, NamedReferences, sizeof(NamedReferences) / sizeof(NamedReferences[0]), sizeof(NamedReferences[0]), NamedMapPrefixComparator);
-    if (match) {
-        if (parsedName) {
-            *parsedName = match->name;
-        }
-        return match->characters;
-    }
-    
-    // If there's no semicolon, we need the longest matching prefix. Start with any semicolonless prefix; the longest prefix can't be far from there.
-    size_t count = sizeof(NamedSemicolonlessReferences) / sizeof(NamedSemicolonlessReferences[0]);
-    NamedReferenceMap *nearbyItem = bsearch_b((__bridge void *)search, NamedSemicolonlessReferences, count, sizeof(NamedReferenceMap), NamedMapPrefixComparator);
-    if (!nearbyItem) return nil;
-    NamedReferenceMap *longestPrefixItem = nearbyItem;
-    for (NamedReferenceMap *item = nearbyItem - 1; item >= NamedReferences; item--) {
-        if (![item->name hasPrefix:nearbyItem->name]) break;
-        if ([search hasPrefix:item->name] && item->name.length > longestPrefixItem->name.length) {
-            longestPrefixItem = item;
-        }
-    }
-    for (NamedReferenceMap *item = nearbyItem + 1; item < NamedReferences + count; item++) {
-        if (![item->name hasPrefix:nearbyItem->name]) break;
-        if ([search hasPrefix:item->name] && item->name.length > longestPrefixItem->name.length) {
-            longestPrefixItem = item;
+    NSUInteger length = MIN(search.length, LongestEntityNameLength);
+    NSUInteger node = 0;
+    NSString *replacement;
+    NSUInteger parsedLength = 0;
+    for (NSUInteger i = 0; i < length; i++) {
+        node = NextNamedEntityNode(node, [search characterAtIndex:i]);
+        if (!node) break;
+        NSString *candidate = NamedEntityReplacementAtNode(node);
+        if (candidate) {
+            replacement = candidate;
+            parsedLength = i + 1;
         }
     }
-    
-    if (parsedName) {
-        *parsedName = longestPrefixItem->name;
+    if (replacement && parsedName) {
+        *parsedName = [search substringToIndex:parsedLength];
     }
-    return longestPrefixItem->characters;
+    return replacement;
 }
@@ -0,0 +1,44 @@
+//  HTMLFragmentParser.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+#import "HTMLElement.h"
+#import "HTMLParseError.h"
+
+/**
+    An HTMLFragmentParser parses fragments of HTML as if each were the contents of the same context element, the way setting innerHTML does.
+ 
+    Everything that depends only on the context element (the tokenizer's starting state, the insertion mode, the nearest form) is worked out once, and the tokenizer and the parser's stacks are reused from one fragment to the next. Parsing lots of small fragments, like the cells of a scraped table, is much cheaper than setting up a new parser for each.
+ 
+    The context element's ancestors are consulted when the fragment parser is initialized, so changes made to them afterwards are not noticed. A fragment parser is not thread-safe.
+ 
+    For more information, see http://www.whatwg.org/specs/web-apps/current-work/multipage/the-end.html#parsing-html-fragments
+ */
+@interface HTMLFragmentParser : NSObject
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes a fragment parser for a context element. The element is not changed by parsing.
+- (instancetype)initWithContextElement:(HTMLElement *)contextElement NS_DESIGNATED_INITIALIZER;
+
+/// The element that fragments are parsed into.
+@property (readonly, strong, nonatomic) HTMLElement *contextElement;
+
+/// How much to record about parse errors in each fragment. The default is HTMLParseErrorReportingOff.
+@property (assign, nonatomic) HTMLParseErrorReporting errorReporting;
+
+/// Returns the nodes parsed from a string of HTML, in order. The nodes have no parent.
+- (NSArray *)nodesWithString:(NSString *)string;
+
+/// Returns the nodes parsed from some UTF-8 encoded HTML, in order. The nodes have no parent.
+- (NSArray *)nodesWithUTF8Data:(NSData *)data;
+
+/// The number of parse errors in the most recently parsed fragment. Always zero when errorReporting is HTMLParseErrorReportingOff.
+@property (readonly, assign, nonatomic) NSUInteger numberOfErrors;
+
+/// Instances of HTMLParseError representing the errors in the most recently parsed fragment. Empty unless errorReporting is HTMLParseErrorReportingFull.
+@property (readonly, copy, nonatomic) NSArray *parseErrors;
+
+@end
@@ -0,0 +1,73 @@
+//  HTMLFragmentParser.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLFragmentParser.h"
+#import "HTMLParser.h"
+#import "HTMLPreprocessedInputStream.h"
+
+@interface HTMLParser ()
+
+- (NSArray *)parseFragmentWithInputStream:(HTMLPreprocessedInputStream *)inputStream;
+
+@end
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+@interface HTMLFragmentParser ()
+- (instancetype)init NS_DESIGNATED_INITIALIZER;
+@end
+
+@implementation HTMLFragmentParser
+{
+    HTMLParser *_parser;
+}
+
+- (instancetype)initWithContextElement:(HTMLElement *)contextElement
+{
+    NSParameterAssert(contextElement);
+    if ((self = [super init])) {
+        _contextElement = contextElement;
+        HTMLStringEncoding encoding = (HTMLStringEncoding){
+            .encoding = NSUTF8StringEncoding,
+            .confidence = Irrelevant
+        };
+        _parser = [[HTMLParser alloc] initWithString:@"" encoding:encoding context:contextElement];
+        _parser.errorReporting = HTMLParseErrorReportingOff;
+    }
+    return self;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (HTMLParseErrorReporting)errorReporting
+{
+    return _parser.errorReporting;
+}
+
+- (void)setErrorReporting:(HTMLParseErrorReporting)errorReporting
+{
+    _parser.errorReporting = errorReporting;
+}
+
+- (NSArray *)nodesWithString:(NSString *)string
+{
+    return [_parser parseFragmentWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithString:string]];
+}
+
+- (NSArray *)nodesWithUTF8Data:(NSData *)data
+{
+    return [_parser parseFragmentWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithUTF8Data:data]];
+}
+
+- (NSUInteger)numberOfErrors
+{
+    return _parser.numberOfErrors;
+}
+
+- (NSArray *)parseErrors
+{
+    return _parser.parseErrors;
+}
+
+@end
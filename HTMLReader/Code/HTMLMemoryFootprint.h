@@ -0,0 +1,71 @@
+//  HTMLMemoryFootprint.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+#import "HTMLNode.h"
+
+/**
+    An HTMLMemoryFootprint tallies what a tree of nodes holds on to, for sizing caches of parsed documents and for keeping an eye on how nodes are laid out.
+ 
+    Sizes are estimates in bytes, worked out without asking the allocator: objects at their instance size rounded up to a 16-byte allocation, strings at two bytes per code unit, and collections by how many objects they hold. Strings shared by every document, such as known tag and attribute names, aren't counted.
+ */
+@interface HTMLMemoryFootprint : NSObject
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The number of nodes of every kind, including the node the footprint was taken from.
+@property (readonly, assign, nonatomic) NSUInteger numberOfNodes;
+
+/// The number of HTMLElement instances.
+@property (readonly, assign, nonatomic) NSUInteger numberOfElements;
+
+/// The number of HTMLTextNode instances.
+@property (readonly, assign, nonatomic) NSUInteger numberOfTextNodes;
+
+/// The number of HTMLComment instances.
+@property (readonly, assign, nonatomic) NSUInteger numberOfComments;
+
+/// The number of nodes that are none of the above, such as documents and document types.
+@property (readonly, assign, nonatomic) NSUInteger numberOfOtherNodes;
+
+/// The node objects themselves, along with their unshared names.
+@property (readonly, assign, nonatomic) NSUInteger nodeBytes;
+
+/// The text of text nodes and comments.
+@property (readonly, assign, nonatomic) NSUInteger textBytes;
+
+/// The number of attributes on all elements.
+@property (readonly, assign, nonatomic) NSUInteger numberOfAttributes;
+
+/// Attribute names and values.
+@property (readonly, assign, nonatomic) NSUInteger attributeBytes;
+
+/// The arrays that hold children, and any -mutableChildren proxies.
+@property (readonly, assign, nonatomic) NSUInteger childContainerBytes;
+
+/// The arrays that hold attributes, and the hash tables of elements with lots of attributes.
+@property (readonly, assign, nonatomic) NSUInteger attributeContainerBytes;
+
+/// Caches that get rebuilt as needed: text content, class names, and a document's element index.
+@property (readonly, assign, nonatomic) NSUInteger cacheBytes;
+
+/// All of the above bytes added together.
+@property (readonly, assign, nonatomic) NSUInteger estimatedBytes;
+
+/// Each of the above as an NSNumber, keyed by property name. Handy for logging or writing out as JSON.
+@property (readonly, copy, nonatomic) NSDictionary *dictionaryRepresentation;
+
+@end
+
+@interface HTMLNode (HTMLMemoryFootprint)
+
+/**
+    Walks the subtree rooted at the node once to tally how much memory it holds.
+ 
+    Nodes belonging to an HTMLCompactDocument are created as needed, so use -[HTMLCompactDocument storageSize] for those instead.
+ */
+- (HTMLMemoryFootprint *)memoryFootprint;
+
+@end
@@ -0,0 +1,176 @@
+//  HTMLMemoryFootprint.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLMemoryFootprint.h"
+#import "HTMLNode+Private.h"
+#import <objc/runtime.h>
+
+// malloc hands out blocks in multiples of 16 bytes on the platforms we care about.
+static NSUInteger RoundUpToAllocationSize(NSUInteger size)
+{
+    return (size + 15) & ~(NSUInteger)15;
+}
+
+// Roughly what Foundation's collections keep alongside their contents: an isa, a retain count, a count, a capacity, and a pointer to the storage.
+static const NSUInteger CollectionHeaderSize = 48;
+
+NSUInteger HTMLEstimatedBufferSize(NSUInteger size)
+{
+    return size > 0 ? RoundUpToAllocationSize(size) : 0;
+}
+
+NSUInteger HTMLEstimatedObjectSize(id object)
+{
+    return object ? RoundUpToAllocationSize(class_getInstanceSize(object_getClass(object))) : 0;
+}
+
+NSUInteger HTMLEstimatedStringSize(NSString *string)
+{
+    NSUInteger length = string.length;
+    return length > 0 ? HTMLEstimatedObjectSize(string) + RoundUpToAllocationSize(length * sizeof(unichar)) : 0;
+}
+
+NSUInteger HTMLEstimatedArraySize(NSUInteger count)
+{
+    return RoundUpToAllocationSize(CollectionHeaderSize) + (count > 0 ? RoundUpToAllocationSize(count * sizeof(id)) : 0);
+}
+
+NSUInteger HTMLEstimatedDictionarySize(NSUInteger count)
+{
+    // A key and a value per entry, in a hash table kept no more than about three quarters full.
+    NSUInteger slots = count + count / 3 + 1;
+    return RoundUpToAllocationSize(CollectionHeaderSize) + RoundUpToAllocationSize(slots * 2 * sizeof(id));
+}
+
+@interface HTMLMemoryFootprint ()
+
+- (instancetype)initWithTally:(const HTMLMemoryTally *)tally NS_DESIGNATED_INITIALIZER;
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_DESIGNATED_INITIALIZER;
+
+@end
+
+@implementation HTMLMemoryFootprint
+{
+    HTMLMemoryTally _tally;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (instancetype)initWithTally:(const HTMLMemoryTally *)tally
+{
+    if ((self = [super init])) {
+        _tally = *tally;
+    }
+    return self;
+}
+
+- (NSUInteger)numberOfNodes
+{
+    return _tally.numberOfNodes;
+}
+
+- (NSUInteger)numberOfElements
+{
+    return _tally.numberOfElements;
+}
+
+- (NSUInteger)numberOfTextNodes
+{
+    return _tally.numberOfTextNodes;
+}
+
+- (NSUInteger)numberOfComments
+{
+    return _tally.numberOfComments;
+}
+
+- (NSUInteger)numberOfOtherNodes
+{
+    return _tally.numberOfNodes - _tally.numberOfElements - _tally.numberOfTextNodes - _tally.numberOfComments;
+}
+
+- (NSUInteger)nodeBytes
+{
+    return _tally.nodeBytes;
+}
+
+- (NSUInteger)textBytes
+{
+    return _tally.textBytes;
+}
+
+- (NSUInteger)numberOfAttributes
+{
+    return _tally.numberOfAttributes;
+}
+
+- (NSUInteger)attributeBytes
+{
+    return _tally.attributeBytes;
+}
+
+- (NSUInteger)childContainerBytes
+{
+    return _tally.childContainerBytes;
+}
+
+- (NSUInteger)attributeContainerBytes
+{
+    return _tally.attributeContainerBytes;
+}
+
+- (NSUInteger)cacheBytes
+{
+    return _tally.cacheBytes;
+}
+
+- (NSUInteger)estimatedBytes
+{
+    return (_tally.nodeBytes + _tally.textBytes + _tally.attributeBytes
+            + _tally.childContainerBytes + _tally.attributeContainerBytes + _tally.cacheBytes);
+}
+
+- (NSDictionary *)dictionaryRepresentation
+{
+    return @{ @"numberOfNodes": @(self.numberOfNodes),
+              @"numberOfElements": @(self.numberOfElements),
+              @"numberOfTextNodes": @(self.numberOfTextNodes),
+              @"numberOfComments": @(self.numberOfComments),
+              @"numberOfOtherNodes": @(self.numberOfOtherNodes),
+              @"nodeBytes": @(self.nodeBytes),
+              @"textBytes": @(self.textBytes),
+              @"numberOfAttributes": @(self.numberOfAttributes),
+              @"attributeBytes": @(self.attributeBytes),
+              @"childContainerBytes": @(self.childContainerBytes),
+              @"attributeContainerBytes": @(self.attributeContainerBytes),
+              @"cacheBytes": @(self.cacheBytes),
+              @"estimatedBytes": @(self.estimatedBytes) };
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p> %@", self.class, self, self.dictionaryRepresentation];
+}
+
+@end
+
+static HTMLTreeVisitorResult AddNodeToTally(HTMLNode *node, void *context)
+{
+    [node addToMemoryTally:context];
+    return HTMLTreeVisitorContinue;
+}
+
+@implementation HTMLNode (HTMLMemoryFootprint)
+
+- (HTMLMemoryFootprint *)memoryFootprint
+{
+    HTMLMemoryTally tally = {0};
+    HTMLVisitTree(self, NO, AddNodeToTally, &tally);
+    return [[HTMLMemoryFootprint alloc] initWithTally:&tally];
+}
+
+@end
@@ -0,0 +1,111 @@
+//  HTMLNode+Private.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLNode.h"
+#import "HTMLAttributeStorage.h"
+#import "HTMLTextNode.h"
+@class HTMLElement;
+
+/// Running totals for -[HTMLNode memoryFootprint]. Fields match the properties of HTMLMemoryFootprint.
+typedef struct {
+    NSUInteger numberOfNodes;
+    NSUInteger numberOfElements;
+    NSUInteger numberOfTextNodes;
+    NSUInteger numberOfComments;
+    NSUInteger nodeBytes;
+    NSUInteger textBytes;
+    NSUInteger numberOfAttributes;
+    NSUInteger attributeBytes;
+    NSUInteger childContainerBytes;
+    NSUInteger attributeContainerBytes;
+    NSUInteger cacheBytes;
+} HTMLMemoryTally;
+
+/// Estimated bytes allocated for an object, not counting anything it points to. Zero for nil.
+extern NSUInteger HTMLEstimatedObjectSize(id object);
+
+/// Estimated bytes allocated for a buffer of size bytes.
+extern NSUInteger HTMLEstimatedBufferSize(NSUInteger size);
+
+/// Estimated bytes allocated for a string, at two bytes per code unit. Zero for nil.
+extern NSUInteger HTMLEstimatedStringSize(NSString *string);
+
+/// Estimated bytes allocated for an array (or ordered set) of count objects, not counting the objects.
+extern NSUInteger HTMLEstimatedArraySize(NSUInteger count);
+
+/// Estimated bytes allocated for a dictionary of count entries, not counting the keys or values.
+extern NSUInteger HTMLEstimatedDictionarySize(NSUInteger count);
+
+/**
+    Tree mutation that skips the -mutableChildren proxy, for use by the parser and other HTMLReader internals.
+ 
+    A child is detached from its current parent, if any, before it is added. When a node moves within the same parent, the index refers to the children as they were before the move.
+ */
+@interface HTMLNode (Private)
+
+/// Inserts a child. Throws an NSRangeException if index is greater than the number of children.
+- (void)insertChild:(HTMLNode *)child atIndex:(NSUInteger)index;
+
+/// Adds a child after all other children.
+- (void)addChild:(HTMLNode *)child;
+
+/// Removes a child. Does nothing if the node is not the child's parent.
+- (void)removeChild:(HTMLNode *)child;
+
+/// Moves all of another node's children, in order, after all of this node's children.
+- (void)addChildrenOfNode:(HTMLNode *)node;
+
+/// Removes all children at once and returns them in order, handing over the children array instead of copying it.
+- (NSArray *)removeAllChildren;
+
+/// Adds the node, but not its descendants, to the tally. Subclasses call super, then add whatever else they hold on to.
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally;
+
+@end
+
+@interface HTMLTextNode (Private)
+
+/// The text without copying it. Only valid until the text changes.
+@property (readonly, nonatomic) NSString *uncopiedData;
+
+@end
+
+/// The value of the named attribute, reading the element's attributes directly when it can. Known names passed as atoms are found by pointer.
+extern NSString * HTMLElementAttributeValue(HTMLElement *element, NSString *name);
+
+/// The element's attributes without copying them, or NULL if the element keeps its attributes elsewhere (like those of an HTMLCompactDocument do). Don't change them.
+extern const HTMLAttributeStorage * HTMLElementAttributeStorage(HTMLElement *element);
+
+/// Calls the block with each of the element's attributes in order, without copying them when it can.
+extern void HTMLElementEnumerateAttributes(HTMLElement *element, void (^block)(NSString *name, NSString *value, BOOL *stop));
+
+/// Marks a document or element as belonging to a document with an index. The mark stays even after the node moves elsewhere.
+extern void HTMLNodeMarkInIndexedDocument(HTMLNode *node);
+
+/// YES if the node has ever been marked by HTMLNodeMarkInIndexedDocument. When NO, changes to the node can't affect any document's index.
+extern BOOL HTMLNodeIsMarkedInIndexedDocument(HTMLNode *node);
+
+/// Throws out the cached text content of the node and its ancestors. Cheap for nodes that have never been part of a subtree whose text was cached.
+extern void HTMLNodeTextDidChange(HTMLNode *node);
+
+/// The node's children array without copying it, or NULL if the node has no children array. Nodes that keep their children elsewhere (like those of an HTMLCompactDocument) always return NULL, so fall back to -numberOfChildren and -childAtIndex:.
+extern CFArrayRef HTMLNodeChildrenArray(HTMLNode *node);
+
+/// What an HTMLTreeVisitor wants to happen after visiting a node.
+typedef NS_ENUM(NSInteger, HTMLTreeVisitorResult)
+{
+    /// Visit the node's descendants, then carry on in tree order.
+    HTMLTreeVisitorContinue,
+    
+    /// Carry on in tree order without visiting the node's descendants.
+    HTMLTreeVisitorSkipChildren,
+    
+    /// Visit no more nodes.
+    HTMLTreeVisitorStop,
+};
+
+typedef HTMLTreeVisitorResult (*HTMLTreeVisitor)(HTMLNode *node, void *context);
+
+/// Calls the visitor with each node in the subtree rooted at root, in tree order, without the overhead of an NSEnumerator. If elementsOnly is YES, only instances of HTMLElement are visited. The tree must not change during the walk.
+extern void HTMLVisitTree(HTMLNode *root, BOOL elementsOnly, HTMLTreeVisitor visitor, void *context);
@@ -8,6 +8,19 @@
 #import "HTMLNamespace.h"
 #import "HTMLSupport.h"
 
+/// Ways to tidy up text returned by -[HTMLNode textContentWithOptions:].
+typedef NS_OPTIONS(NSUInteger, HTMLTextContentOptions)
+{
+    /// Replaces each run of whitespace with a single space, and leaves out whitespace at the start and end.
+    HTMLTextContentCollapseWhitespace = 1 << 0,
+    
+    /// Leaves out the text of <script> and <style> elements.
+    HTMLTextContentSkipScriptAndStyle = 1 << 1,
+    
+    /// Puts a newline around block-level elements (such as <p>, <div>, <li>, and <tr>) and at <br>, and a tab between table cells. Separators never repeat, and never start or end the text.
+    HTMLTextContentBlockSeparators = 1 << 2,
+};
+
 /**
     HTMLNode is an abstract class representing a node in a parsed HTML tree.
  
@@ -55,10 +68,16 @@
 /**
     Returns the location of a child, or NSNotFound if the node is not the child's parent.
  
-    This method is faster than calling `[aNode.children indexOfObject:]`.
+    This method is faster than calling `[aNode.children indexOfObject:]`, and usually takes constant time.
  */
 - (NSUInteger)indexOfChild:(HTMLNode *)child;
 
+/// The node immediately before this one among its parent's children, or nil if there is no such node.
+@property (readonly, strong, nonatomic) HTMLNode *previousSibling;
+
+/// The node immediately after this one among its parent's children, or nil if there is no such node.
+@property (readonly, strong, nonatomic) HTMLNode *nextSibling;
+
 /// The node's children which are instances of HTMLElement.
 @property (readonly, copy, nonatomic) NSArray *childElementNodes;
 
@@ -72,6 +91,9 @@
 /// Emits in tree order the node in the subree rooted at the node, except children are enumerated back to front.
 - (NSEnumerator *)reversedTreeEnumerator;
 
+/// Emits in tree order the elements in the subtree rooted at the node, skipping text, comments, and other nodes that aren't instances of HTMLElement.
+- (NSEnumerator *)elementTreeEnumerator;
+
 /**
     The combined text content of the node and its descendants. The setter replaces the node's text, removing all descendants.
  
@@ -79,6 +101,13 @@
  */
 @property (copy, nonatomic) NSString *textContent;
 
+/**
+    The text content of the node and its descendants, tidied up as the options describe. -textContent is the same as passing no options.
+ 
+    The text is gathered into a single buffer in one pass over the subtree. The result is kept until something in the subtree changes, so asking again (with the same options) is cheap.
+ */
+- (NSString *)textContentWithOptions:(HTMLTextContentOptions)options;
+
 /**
     Convenience method for either adding a string to an existing text node or creating a new text node.
  
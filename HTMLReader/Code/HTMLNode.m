@@ -2,32 +2,113 @@
 //
 //  Public domain. https://github.com/nolanw/HTMLReader
 
-#import "HTMLNode.h"
-#import "HTMLDocument.h"
+#import "HTMLNode+Private.h"
+#import "HTMLAtom.h"
+#import "HTMLDocument+Private.h"
+#import "HTMLElement.h"
 #import "HTMLTextNode.h"
 #import "HTMLTreeEnumerator.h"
 
 @interface HTMLChildrenRelationshipProxy : NSMutableOrderedSet
 
-- (instancetype)initWithNode:(HTMLNode *)node children:(NSMutableOrderedSet *)children;
+- (instancetype)initWithNode:(HTMLNode *)node;
 
-@property (readonly, strong, nonatomic) HTMLNode *node;
-
-@property (readonly, strong, nonatomic) NSMutableOrderedSet *children;
+@property (readonly, weak, nonatomic) HTMLNode *node;
 
 @end
 
 @implementation HTMLNode
 {
-    NSMutableOrderedSet *_children;
+    __weak HTMLNode *_parentNode;
+    
+    // Children are kept in an array and each child remembers its own index, so finding a child's position (and from there its siblings) doesn't need a search or a hash.
+    NSMutableArray *_children;
+    HTMLChildrenRelationshipProxy *_mutableChildren;
+    
+    // Only trustworthy when less than the parent's _firstStaleChildIndex.
+    NSUInteger _indexInParent;
+    
+    // Inserting or removing a child shifts the children after it. Rather than renumbering them right away, they're renumbered the next time one of their indexes is needed.
+    NSUInteger _firstStaleChildIndex;
+    
+    // The most recent result of -textContentWithOptions:, kept until something in the subtree changes.
+    NSString *_cachedText;
+    HTMLTextContentOptions _cachedTextOptions;
+    
+    // Set on every node visited while caching text, and never cleared. Changes to nodes without it can't affect any cached text.
+    BOOL _inCachedText;
+    
+    // Set when an index is built for the node's document, and never cleared. Changes to nodes without it can't affect any index.
+    BOOL _inIndexedDocument;
+}
+
+void HTMLNodeTextDidChange(HTMLNode *node)
+{
+    // Only nodes that were around when some text was cached need to look for it. Anything added since then has already thrown that text out.
+    if (!node->_inCachedText) return;
+    
+    for (HTMLNode *ancestor = node; ancestor; ancestor = ancestor->_parentNode) {
+        ancestor->_cachedText = nil;
+    }
 }
 
-- (instancetype)init
+void HTMLNodeMarkInIndexedDocument(HTMLNode *node)
 {
-    if ((self = [super init])) {
-        _children = [NSMutableOrderedSet new];
+    node->_inIndexedDocument = YES;
+}
+
+BOOL HTMLNodeIsMarkedInIndexedDocument(HTMLNode *node)
+{
+    return node->_inIndexedDocument;
+}
+
+CFArrayRef HTMLNodeChildrenArray(HTMLNode *node)
+{
+    return (__bridge CFArrayRef)node->_children;
+}
+
+// Assumes that parent is child's parent.
+static NSUInteger IndexOfChild(HTMLNode *parent, HTMLNode *child)
+{
+    if (child->_indexInParent >= parent->_firstStaleChildIndex) {
+        NSUInteger count = parent->_children.count;
+        for (NSUInteger i = parent->_firstStaleChildIndex; i < count; i++) {
+            HTMLNode *node = parent->_children[i];
+            node->_indexInParent = i;
+        }
+        parent->_firstStaleChildIndex = count;
     }
-    return self;
+    return child->_indexInParent;
+}
+
+static void InsertIntoChildren(HTMLNode *parent, HTMLNode *child, NSUInteger index)
+{
+    HTMLDocumentNodeDidChange(parent);
+    HTMLNodeTextDidChange(parent);
+    if (!parent->_children) {
+        parent->_children = [NSMutableArray new];
+    }
+    NSUInteger count = parent->_children.count;
+    [parent->_children insertObject:child atIndex:index];
+    child->_indexInParent = index;
+    child->_parentNode = parent;
+    
+    // Appending is by far the most common insertion, and it leaves every index intact.
+    if (index == count && parent->_firstStaleChildIndex == count) {
+        parent->_firstStaleChildIndex = count + 1;
+    } else {
+        parent->_firstStaleChildIndex = MIN(parent->_firstStaleChildIndex, index);
+    }
+}
+
+static void RemoveFromChildren(HTMLNode *parent, NSUInteger index)
+{
+    HTMLDocumentNodeDidChange(parent);
+    HTMLNodeTextDidChange(parent);
+    HTMLNode *child = parent->_children[index];
+    child->_parentNode = nil;
+    [parent->_children removeObjectAtIndex:index];
+    parent->_firstStaleChildIndex = MIN(parent->_firstStaleChildIndex, index);
 }
 
 - (HTMLDocument *)document
@@ -41,15 +122,10 @@
 
 - (void)setParentNode:(HTMLNode *)parentNode
 {
-    [self setParentNode:parentNode updateChildren:YES];
-}
-
-- (void)setParentNode:(HTMLNode *)parentNode updateChildren:(BOOL)updateChildren
-{
-    [_parentNode removeChild:self updateParentNode:NO];
-    _parentNode = parentNode;
-    if (updateChildren) {
-        [parentNode addChild:self updateParentNode:NO];
+    if (parentNode) {
+        [parentNode addChild:self];
+    } else {
+        [_parentNode removeChild:self];
     }
 }
 
@@ -66,12 +142,12 @@
 
 - (void)removeFromParentNode
 {
-    [self.parentNode.mutableChildren removeObject:self];
+    [_parentNode removeChild:self];
 }
 
 - (NSOrderedSet *)children
 {
-    return [_children copy];
+    return _children ? [NSOrderedSet orderedSetWithArray:_children] : [NSOrderedSet orderedSet];
 }
 
 // In order to quickly mutate the children set, we need to pull some shenanigans. From the Key-Value Coding Programming Guide:
@@ -82,13 +158,16 @@
 // > 2. Otherwise (no simple accessor method is found), searches the class of the receiver for methods whose names match the patterns countOf<Key> and objectIn<Key>AtIndex: … and <key>AtIndexes:….
 // > If the countOf<Key> method and at least one of the other two possible methods are found, a collection proxy object that responds to all NSArray [sic] methods is returned. Each NSArray [sic] message sent to the collection proxy object will result in some combination of countOf<Key>, objectIn<Key>AtIndex:, and <key>AtIndexes: messages being sent to the original receiver of valueForKey:.
 //
-// From this, we can see that implementing -children stops us at step 1, and our implementation involves copying the set so it is slow. To work around this, we become KVC-compliant for the key "HTMLMutableChildren" and implement the accessors for that key. Since we don't implement -HTMLMutableChildren et al (step 1), our accessors are used instead (step 2), and all is well.
+// From this, we can see that implementing -children stops us at step 1, and our implementation involves copying the set so it is slow. To work around this, we hand out our own proxy, which talks directly to the node. The proxy only holds a weak reference to the node, so the node can keep it around for the next caller.
 //
 // Note that -mutableOrderedSetValueForKey: will still work for the key "children", it'll just be slow.
 
 - (NSMutableOrderedSet *)mutableChildren
 {
-    return [[HTMLChildrenRelationshipProxy alloc] initWithNode:self children:_children];
+    if (!_mutableChildren) {
+        _mutableChildren = [[HTMLChildrenRelationshipProxy alloc] initWithNode:self];
+    }
+    return _mutableChildren;
 }
 
 - (NSUInteger)numberOfChildren
@@ -98,68 +177,144 @@
 
 - (HTMLNode *)childAtIndex:(NSUInteger)index
 {
+    if (!_children) {
+        [NSException raise:NSRangeException format:@"index %lu beyond bounds for node with no children", (unsigned long)index];
+    }
     return _children[index];
 }
 
 - (NSUInteger)indexOfChild:(HTMLNode *)child
 {
-    return [_children indexOfObject:child];
+    if (!child || child->_parentNode != self) return NSNotFound;
+    return IndexOfChild(self, child);
 }
 
-- (void)insertObject:(HTMLNode *)node inChildrenAtIndex:(NSUInteger)index
+- (HTMLNode *)previousSibling
 {
-    [_children insertObject:node atIndex:index];
-    [node setParentNode:self updateChildren:NO];
+    HTMLNode *parent = self.parentNode;
+    if (!parent) return nil;
+    NSUInteger index = [parent indexOfChild:self];
+    return index > 0 ? [parent childAtIndex:index - 1] : nil;
 }
 
-- (void)insertChildren:(NSArray *)array atIndexes:(NSIndexSet *)indexes
+- (HTMLNode *)nextSibling
 {
-    [_children insertObjects:array atIndexes:indexes];
-    for (HTMLNode *node in array) {
-        [node setParentNode:self updateChildren:NO];
+    HTMLNode *parent = self.parentNode;
+    if (!parent) return nil;
+    NSUInteger index = [parent indexOfChild:self];
+    return index + 1 < parent.numberOfChildren ? [parent childAtIndex:index + 1] : nil;
+}
+
+#pragma mark Child storage
+
+- (void)insertChild:(HTMLNode *)child atIndex:(NSUInteger)index
+{
+    if (index > _children.count) {
+        [NSException raise:NSRangeException format:@"index %lu beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_children.count];
     }
+    HTMLNode *oldParent = child->_parentNode;
+    if (oldParent) {
+        NSUInteger oldIndex = IndexOfChild(oldParent, child);
+        RemoveFromChildren(oldParent, oldIndex);
+        if (oldParent == self && oldIndex < index) {
+            index--;
+        }
+    }
+    InsertIntoChildren(self, child, index);
 }
 
-- (void)removeObjectFromChildrenAtIndex:(NSUInteger)index
+- (void)addChild:(HTMLNode *)child
 {
-    HTMLNode *node = _children[index];
-    [_children removeObjectAtIndex:index];
-    [node setParentNode:nil updateChildren:NO];
+    [self insertChild:child atIndex:_children.count];
 }
 
-- (void)removeChildrenAtIndexes:(NSIndexSet *)indexes
+- (void)removeChild:(HTMLNode *)child
 {
-    NSArray *nodes = [_children objectsAtIndexes:indexes];
-    [_children removeObjectsAtIndexes:indexes];
-    for (HTMLNode *node in nodes) {
-        [node setParentNode:nil updateChildren:NO];
+    if (child->_parentNode == self) {
+        RemoveFromChildren(self, IndexOfChild(self, child));
     }
 }
 
-- (void)replaceObjectInChildrenAtIndex:(NSUInteger)index withObject:(HTMLNode *)node
+- (void)addChildrenOfNode:(HTMLNode *)node
 {
-    HTMLNode *old = _children[index];
-    [_children replaceObjectAtIndex:index withObject:node];
-    [old setParentNode:nil updateChildren:NO];
-    [node setParentNode:self updateChildren:NO];
+    if (node == self) return;
+    HTMLDocumentNodeDidChange(node);
+    HTMLNodeTextDidChange(node);
+    NSArray *children = node->_children;
+    node->_children = nil;
+    node->_firstStaleChildIndex = 0;
+    for (HTMLNode *child in children) {
+        child->_parentNode = nil;
+        InsertIntoChildren(self, child, _children.count);
+    }
 }
 
-- (void)addChild:(HTMLNode *)node updateParentNode:(BOOL)updateParentNode
+- (NSArray *)removeAllChildren
 {
-    [_children addObject:node];
-    if (updateParentNode) {
-        [node setParentNode:self updateChildren:NO];
+    if (!_children) return @[];
+    HTMLDocumentNodeDidChange(self);
+    HTMLNodeTextDidChange(self);
+    NSArray *children = _children;
+    _children = nil;
+    _firstStaleChildIndex = 0;
+    for (HTMLNode *child in children) {
+        child->_parentNode = nil;
     }
+    return children;
 }
 
-- (void)removeChild:(HTMLNode *)node updateParentNode:(BOOL)updateParentNode
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally
 {
-    [_children removeObject:node];
-    if (updateParentNode) {
-        [node setParentNode:nil updateChildren:NO];
+    tally->numberOfNodes++;
+    tally->nodeBytes += HTMLEstimatedObjectSize(self);
+    if (_children) {
+        tally->childContainerBytes += HTMLEstimatedArraySize(_children.count);
     }
+    tally->childContainerBytes += HTMLEstimatedObjectSize(_mutableChildren);
+    tally->cacheBytes += HTMLEstimatedStringSize(_cachedText);
+}
+
+- (void)replaceChildAtIndex:(NSUInteger)index withChild:(HTMLNode *)child
+{
+    if (_children[index] == child) return;
+    RemoveFromChildren(self, index);
+    [self insertChild:child atIndex:index];
+}
+
+#pragma mark KVC children accessors
+
+- (void)insertObject:(HTMLNode *)node inChildrenAtIndex:(NSUInteger)index
+{
+    [self insertChild:node atIndex:index];
+}
+
+- (void)insertChildren:(NSArray *)array atIndexes:(NSIndexSet *)indexes
+{
+    __block NSUInteger i = 0;
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        [self insertChild:array[i++] atIndex:index];
+    }];
+}
+
+- (void)removeObjectFromChildrenAtIndex:(NSUInteger)index
+{
+    RemoveFromChildren(self, index);
+}
+
+- (void)removeChildrenAtIndexes:(NSIndexSet *)indexes
+{
+    [indexes enumerateIndexesWithOptions:NSEnumerationReverse usingBlock:^(NSUInteger index, BOOL *stop) {
+        RemoveFromChildren(self, index);
+    }];
+}
+
+- (void)replaceObjectInChildrenAtIndex:(NSUInteger)index withObject:(HTMLNode *)node
+{
+    [self replaceChildAtIndex:index withChild:node];
 }
 
+#pragma mark -
+
 - (void)insertString:(NSString *)string atChildNodeIndex:(NSUInteger)index
 {
     id candidate = index > 0 ? _children[index - 1] : nil;
@@ -168,7 +323,7 @@
         textNode = candidate;
     } else {
         textNode = [HTMLTextNode new];
-        [[self mutableChildren] insertObject:textNode atIndex:index];
+        [self insertChild:textNode atIndex:index];
     }
     [textNode appendString:string];
 }
@@ -194,23 +349,179 @@
 	return [[HTMLTreeEnumerator alloc] initWithNode:self reversed:YES];
 }
 
+- (NSEnumerator *)elementTreeEnumerator
+{
+    return [[HTMLTreeEnumerator alloc] initWithNode:self reversed:NO elementsOnly:YES];
+}
+
 - (NSString *)textContent
 {
-    NSMutableArray *parts = [NSMutableArray new];
-    for (HTMLTextNode *node in self.treeEnumerator) {
-        if ([node isKindOfClass:[HTMLTextNode class]]) {
-            [parts addObject:node.data];
+    return [self textContentWithOptions:0];
+}
+
+/// Collects extracted text in one growable buffer of UTF-16 code units.
+typedef struct {
+    UniChar *characters;
+    NSUInteger length;
+    NSUInteger capacity;
+    HTMLTextContentOptions options;
+    
+    // A separator waiting for more text before it's written, so that separators never start or end the text. One of ' ', '\t', '\n', or 0 for none.
+    UniChar pendingSeparator;
+} HTMLTextBuffer;
+
+static void ReserveTextBufferSpace(HTMLTextBuffer *buffer, NSUInteger count)
+{
+    if (buffer->length + count > buffer->capacity) {
+        buffer->capacity = MAX(buffer->capacity * 2, buffer->length + count);
+        buffer->characters = reallocf(buffer->characters, buffer->capacity * sizeof(UniChar));
+    }
+}
+
+// A stronger separator replaces a weaker one: a newline beats a tab, which beats a space.
+static void AddSeparator(HTMLTextBuffer *buffer, UniChar separator)
+{
+    static const char Strength[] = " \t\n";
+    if (!buffer->pendingSeparator || strchr(Strength, separator) > strchr(Strength, buffer->pendingSeparator)) {
+        buffer->pendingSeparator = separator;
+    }
+}
+
+static void WritePendingSeparator(HTMLTextBuffer *buffer)
+{
+    if (buffer->pendingSeparator && buffer->length > 0) {
+        ReserveTextBufferSpace(buffer, 1);
+        buffer->characters[buffer->length++] = buffer->pendingSeparator;
+    }
+    buffer->pendingSeparator = 0;
+}
+
+static void AppendText(HTMLTextBuffer *buffer, NSString *text)
+{
+    CFStringRef cftext = (__bridge CFStringRef)text;
+    CFIndex length = CFStringGetLength(cftext);
+    if (length == 0) return;
+    
+    if (!(buffer->options & HTMLTextContentCollapseWhitespace)) {
+        WritePendingSeparator(buffer);
+        ReserveTextBufferSpace(buffer, length);
+        CFStringGetCharacters(cftext, CFRangeMake(0, length), buffer->characters + buffer->length);
+        buffer->length += length;
+        return;
+    }
+    
+    CFStringInlineBuffer inlineBuffer;
+    CFStringInitInlineBuffer(cftext, &inlineBuffer, CFRangeMake(0, length));
+    for (CFIndex i = 0; i < length; i++) {
+        UniChar c = CFStringGetCharacterFromInlineBuffer(&inlineBuffer, i);
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r') {
+            AddSeparator(buffer, ' ');
+        } else {
+            if (buffer->pendingSeparator) {
+                WritePendingSeparator(buffer);
+            }
+            ReserveTextBufferSpace(buffer, 1);
+            buffer->characters[buffer->length++] = c;
+        }
+    }
+}
+
+// Returns the separator that goes around an element's text, or 0 if none.
+static UniChar SeparatorForElement(HTMLElement *element)
+{
+    NSString *tagName = element.tagName;
+    if (TagNameIsAnyOf(tagName, @"address", @"article", @"aside", @"blockquote", @"br", @"caption", @"center", @"dd", @"details", @"dialog", @"dir", @"div", @"dl", @"dt", @"fieldset", @"figcaption", @"figure", @"footer", @"form", @"h1", @"h2", @"h3", @"h4", @"h5", @"h6", @"header", @"hgroup", @"hr", @"legend", @"li", @"listing", @"main", @"menu", @"nav", @"ol", @"option", @"p", @"plaintext", @"pre", @"section", @"summary", @"table", @"tbody", @"tfoot", @"thead", @"tr", @"ul")) {
+        return '\n';
+    } else if (TagNameIsAnyOf(tagName, @"td", @"th")) {
+        return '\t';
+    } else {
+        return 0;
+    }
+}
+
+typedef struct {
+    // Retained, as nodes in an HTMLCompactDocument are only kept alive by whoever's using them.
+    CFTypeRef node;
+    
+    NSUInteger nextChildIndex;
+    UniChar separator;
+} HTMLTextFrame;
+
+- (NSString *)textContentWithOptions:(HTMLTextContentOptions)options
+{
+    if (_cachedText && _cachedTextOptions == options) {
+        return _cachedText;
+    }
+    
+    HTMLTextBuffer buffer = { .options = options };
+    NSUInteger capacity = 32;
+    NSUInteger count = 0;
+    HTMLTextFrame *stack = malloc(capacity * sizeof(*stack));
+    stack[count++] = (HTMLTextFrame){ .node = CFBridgingRetain(self) };
+    _inCachedText = YES;
+    if ([self isKindOfClass:[HTMLTextNode class]]) {
+        AppendText(&buffer, [(HTMLTextNode *)self uncopiedData]);
+    }
+    while (count > 0) {
+        HTMLNode *node = (__bridge HTMLNode *)stack[count - 1].node;
+        NSUInteger index = stack[count - 1].nextChildIndex;
+        if (index >= node.numberOfChildren) {
+            if (stack[count - 1].separator) {
+                AddSeparator(&buffer, stack[count - 1].separator);
+            }
+            count--;
+            CFRelease(stack[count].node);
+            continue;
+        }
+        
+        stack[count - 1].nextChildIndex++;
+        HTMLNode *child = [node childAtIndex:index];
+        child->_inCachedText = YES;
+        if ([child isKindOfClass:[HTMLTextNode class]]) {
+            AppendText(&buffer, [(HTMLTextNode *)child uncopiedData]);
+        } else if ([child isKindOfClass:[HTMLElement class]]) {
+            HTMLElement *element = (HTMLElement *)child;
+            if ((options & HTMLTextContentSkipScriptAndStyle) && TagNameIsAnyOf(element.tagName, @"script", @"style")) {
+                continue;
+            }
+            UniChar separator = (options & HTMLTextContentBlockSeparators) ? SeparatorForElement(element) : 0;
+            if (separator) {
+                AddSeparator(&buffer, separator);
+            }
+            if (count == capacity) {
+                capacity *= 2;
+                stack = reallocf(stack, capacity * sizeof(*stack));
+            }
+            stack[count++] = (HTMLTextFrame){ .node = CFBridgingRetain(child), .separator = separator };
         }
     }
-    return [parts componentsJoinedByString:@""];
+    free(stack);
+    
+    NSString *text;
+    if (buffer.length > 0) {
+        text = [[NSString alloc] initWithCharactersNoCopy:buffer.characters length:buffer.length freeWhenDone:YES];
+    } else {
+        free(buffer.characters);
+        text = @"";
+    }
+    
+    _cachedText = text;
+    _cachedTextOptions = options;
+    return text;
 }
 
 - (void)setTextContent:(NSString *)textContent
 {
-    [[self mutableChildren] removeAllObjects];
+    HTMLDocumentNodeDidChange(self);
+    HTMLNodeTextDidChange(self);
+    for (HTMLNode *child in _children) {
+        child->_parentNode = nil;
+    }
+    _children = nil;
+    _firstStaleChildIndex = 0;
     if (textContent.length > 0) {
         HTMLTextNode *textNode = [[HTMLTextNode alloc] initWithData:textContent];
-        [[self mutableChildren] addObject:textNode];
+        [self addChild:textNode];
     }
 }
 
@@ -228,33 +539,34 @@
  */
 @implementation HTMLChildrenRelationshipProxy : NSMutableOrderedSet
 
-- (instancetype)initWithNode:(HTMLNode *)node children:(NSMutableOrderedSet *)children
+- (instancetype)initWithNode:(HTMLNode *)node
 {
     if ((self = [super init])) {
         _node = node;
-        _children = children;
     }
     return self;
 }
 
 - (NSUInteger)count
 {
-    return _children.count;
+    return _node.numberOfChildren;
 }
 
 - (id)objectAtIndex:(NSUInteger)index
 {
-    return [_children objectAtIndex:index];
+    return [_node childAtIndex:index];
 }
 
 - (NSUInteger)indexOfObject:(id)object
 {
-    return [_children indexOfObject:object];
+    return [_node indexOfChild:object];
 }
 
 - (void)insertObject:(id)object atIndex:(NSUInteger)index
 {
-    [_node insertObject:object inChildrenAtIndex:index];
+    // Like any other ordered set, inserting an object that's already present has no effect.
+    if ([object parentNode] == _node) return;
+    [_node insertChild:object atIndex:index];
 }
 
 - (void)insertObjects:(NSArray *)objects atIndexes:(NSIndexSet *)indexes
@@ -3,22 +3,45 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLOrderedDictionary.h"
+#import "HTMLAttributeStorage.h"
 
 @implementation HTMLOrderedDictionary
 {
-    CFMutableDictionaryRef _map;
-    NSMutableArray *_keys;
+    HTMLAttributeStorage _storage;
+    unsigned long _mutations;
 }
 
 - (instancetype)initWithCapacity:(NSUInteger)numItems
 {
     if ((self = [super init])) {
-        _map = CFDictionaryCreateMutable(nil, numItems, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
-        _keys = [NSMutableArray arrayWithCapacity:numItems];
+        if (numItems > 0) {
+            HTMLAttributeStorageReserve(&_storage, numItems);
+        }
     }
     return self;
 }
 
+HTMLAttributeStorage * HTMLOrderedDictionaryStorage(HTMLOrderedDictionary *dictionary)
+{
+    return &dictionary->_storage;
+}
+
+HTMLOrderedDictionary * HTMLOrderedDictionaryWithStorage(const HTMLAttributeStorage *storage)
+{
+    HTMLOrderedDictionary *dictionary = [HTMLOrderedDictionary new];
+    HTMLAttributeStorageCopy(&dictionary->_storage, storage);
+    return dictionary;
+}
+
+static NSArray * Keys(const HTMLAttributeStorage *storage)
+{
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:storage->count];
+    for (uint32_t i = 0; i < storage->count; i++) {
+        [keys addObject:(__bridge id)storage->attributes[i].name];
+    }
+    return keys;
+}
+
 // Diagnostic needs ignoring on iOS 5.
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wmismatched-parameter-types"
@@ -57,7 +80,7 @@
 
 - (void)dealloc
 {
-    CFRelease(_map);
+    HTMLAttributeStorageFree(&_storage);
 }
 
 - (Class)classForKeyedArchiver
@@ -67,14 +90,14 @@
 
 - (void)encodeWithCoder:(NSCoder *)coder
 {
-    [coder encodeObject:(__bridge NSDictionary *)_map forKey:@"map"];
-    [coder encodeObject:_keys forKey:@"keys"];
+    [coder encodeObject:[NSDictionary dictionaryWithDictionary:self] forKey:@"map"];
+    [coder encodeObject:Keys(&_storage) forKey:@"keys"];
 }
 
 - (id)copyWithZone:(NSZone *)zone
 {
-    HTMLOrderedDictionary *copy = [[[self class] allocWithZone:zone] initWithCapacity:self.count];
-    [copy addEntriesFromDictionary:self];
+    HTMLOrderedDictionary *copy = [[[self class] allocWithZone:zone] initWithCapacity:0];
+    HTMLAttributeStorageCopy(&copy->_storage, &_storage);
     return copy;
 }
 
@@ -85,31 +108,27 @@
 
 - (NSUInteger)count
 {
-    return _keys.count;
+    return _storage.count;
 }
 
 - (id)objectForKey:(id)key
 {
-    return (__bridge id)CFDictionaryGetValue(_map, (__bridge const void *)key);
+    return HTMLAttributeStorageValue(&_storage, key);
 }
 
 - (NSUInteger)indexOfKey:(id)key
 {
-    if ([self objectForKey:key]) {
-        return [_keys indexOfObject:key];
-    } else {
-        return NSNotFound;
-    }
+    return HTMLAttributeStorageIndexOfName(&_storage, key);
 }
 
 - (id)firstKey
 {
-    return _keys.firstObject;
+    return _storage.count > 0 ? (__bridge id)_storage.attributes[0].name : nil;
 }
 
 - (id)lastKey
 {
-    return _keys.lastObject;
+    return _storage.count > 0 ? (__bridge id)_storage.attributes[_storage.count - 1].name : nil;
 }
 
 - (void)setObject:(id)object forKey:(id)key
@@ -124,10 +143,14 @@
 {
     if (!key) [NSException raise:NSInvalidArgumentException format:@"%@ key cannot be nil", NSStringFromSelector(_cmd)];
     
-    if ([self objectForKey:key]) {
-        CFDictionaryRemoveValue(_map, (__bridge const void *)key);
-        [_keys removeObject:key];
-    }
+    HTMLAttributeStorageRemove(&_storage, key);
+    _mutations++;
+}
+
+- (void)removeAllObjects
+{
+    HTMLAttributeStorageRemoveAll(&_storage);
+    _mutations++;
 }
 
 - (void)insertObject:(id)object forKey:(id)key atIndex:(NSUInteger)index
@@ -136,26 +159,33 @@
     if (!key) [NSException raise:NSInvalidArgumentException format:@"%@ key cannot be nil", NSStringFromSelector(_cmd)];
     if (index > self.count) [NSException raise:NSRangeException format:@"%@ index %@ beyond count %@ of array", NSStringFromSelector(_cmd), @(index), @(self.count)];
     
-    if (![self objectForKey:key]) {
-        key = [key copy];
-        [_keys insertObject:key atIndex:index];
-    }
-    CFDictionarySetValue(_map, (__bridge const void *)key, (__bridge const void *)object);
+    HTMLAttributeStorageInsert(&_storage, key, object, index);
+    _mutations++;
 }
 
 - (NSEnumerator *)keyEnumerator
 {
-    return _keys.objectEnumerator;
+    return Keys(&_storage).objectEnumerator;
 }
 
 - (id)objectAtIndexedSubscript:(NSUInteger)index
 {
-    return _keys[index];
+    if (index >= self.count) [NSException raise:NSRangeException format:@"%@ index %@ beyond count %@ of array", NSStringFromSelector(_cmd), @(index), @(self.count)];
+    
+    return (__bridge id)_storage.attributes[index].name;
 }
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id [])buffer count:(NSUInteger)len
 {
-    return [_keys countByEnumeratingWithState:state objects:buffer count:len];
+    state->mutationsPtr = &_mutations;
+    state->itemsPtr = buffer;
+    NSUInteger i = state->state;
+    NSUInteger count = 0;
+    while (i < _storage.count && count < len) {
+        buffer[count++] = (__bridge id)_storage.attributes[i++].name;
+    }
+    state->state = i;
+    return count;
 }
 
 @end
@@ -0,0 +1,38 @@
+//  HTMLParseError.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+
+/// How much a parser or tokenizer records about parse errors.
+typedef NS_ENUM(NSInteger, HTMLParseErrorReporting)
+{
+    /// Parse errors are ignored.
+    HTMLParseErrorReportingOff,
+    
+    /// Parse errors are counted, without describing them.
+    HTMLParseErrorReportingCount,
+    
+    /// Each parse error is recorded with its reason and position.
+    HTMLParseErrorReportingFull,
+};
+
+/// An HTMLParseError describes a parse error and where it was noticed.
+@interface HTMLParseError : NSObject
+
+/// Initializes a parse error.
+- (instancetype)initWithReason:(NSString *)reason line:(NSUInteger)line column:(NSUInteger)column NS_DESIGNATED_INITIALIZER;
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// What went wrong.
+@property (readonly, copy, nonatomic) NSString *reason;
+
+/// The line where the error was noticed, counting from 1.
+@property (readonly, assign, nonatomic) NSUInteger line;
+
+/// The column where the error was noticed, counting characters from 1.
+@property (readonly, assign, nonatomic) NSUInteger column;
+
+@end
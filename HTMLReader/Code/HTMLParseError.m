@@ -0,0 +1,32 @@
+//  HTMLParseError.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLParseError.h"
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+@interface HTMLParseError ()
+- (instancetype)init NS_DESIGNATED_INITIALIZER;
+@end
+
+@implementation HTMLParseError
+
+- (instancetype)initWithReason:(NSString *)reason line:(NSUInteger)line column:(NSUInteger)column
+{
+    if ((self = [super init])) {
+        _reason = [reason copy];
+        _line = line;
+        _column = column;
+    }
+    return self;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"%@:%@: %@", @(_line), @(_column), _reason];
+}
+
+@end
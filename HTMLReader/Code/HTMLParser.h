@@ -6,6 +6,7 @@
 #import "HTMLDocument.h"
 #import "HTMLElement.h"
 #import "HTMLEncoding.h"
+#import "HTMLParseError.h"
 
 /**
     An HTMLParser turns a string into an HTMLDocument.
@@ -28,21 +29,74 @@
  
     For more information on the context parameter, see http://www.whatwg.org/specs/web-apps/current-work/multipage/the-end.html#parsing-html-fragments
  */
-- (instancetype)initWithString:(NSString *)string encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithString:(NSString *)string encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context;
 
-/// The HTML being parsed.
+/**
+    Initializes a parser with some data that appears to be HTML.
+ 
+    UTF-8 data is tokenized directly from its bytes, without first decoding the whole thing into a string. Data in any other encoding is decoded up front.
+ 
+    @param data     The encoded HTML.
+    @param encoding The (possibly presumed) string encoding of the data. May change during parsing, causing this parser to be irrelevant.
+    @param context  A context element used for parsing a fragment of HTML, or nil if the fragment parsing algorithm is not to be used.
+ */
+- (instancetype)initWithData:(NSData *)data encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context;
+
+/**
+    Initializes a parser that receives its HTML a piece at a time, such as while the HTML is being downloaded. Pass the pieces to -appendData:, then call -finish.
+ 
+    @param contentType The value of the HTTP Content-Type header associated with the data, if any.
+ */
+- (instancetype)initWithContentType:(NSString *)contentType;
+
+/**
+    Adds some data to the end of the HTML and parses as much as possible.
+ 
+    Data can be split anywhere, even in the middle of a character, a character reference, or a tag. Parsing resumes where it left off when more data arrives.
+ 
+    Unless the content type or a byte order mark settles the encoding, nothing is parsed until PrescanByteCount bytes have arrived (or -finish is called), so that a <meta> tag declaring the encoding can be found first.
+ 
+    Only parsers initialized via -initWithContentType: accept data.
+ */
+- (void)appendData:(NSData *)data;
+
+/// Indicates that no more data will be appended, and parses whatever remains. Afterwards, the document is complete.
+- (void)finish;
+
+/// The HTML being parsed. Parsers initialized with UTF-8 data decode the string on each call.
 @property (readonly, copy, nonatomic) NSString *string;
 
 /// The document's presumed string encoding.
 @property (readonly, assign, nonatomic) HTMLStringEncoding encoding;
 
-/// Instances of NSString representing the errors encountered while parsing the document.
+/**
+    How much to record about parse errors. The default is HTMLParseErrorReportingFull.
+ 
+    When off or only counting, no strings or objects are made for parse errors, which are common in real-world HTML. Set this before parsing starts, which is when the document is first accessed or data is first appended.
+ */
+@property (assign, nonatomic) HTMLParseErrorReporting errorReporting;
+
+/// The number of parse errors encountered so far. Always zero when errorReporting is HTMLParseErrorReportingOff.
+@property (readonly, assign, nonatomic) NSUInteger numberOfErrors;
+
+/// Instances of NSString representing the errors encountered while parsing the document. Empty unless errorReporting is HTMLParseErrorReportingFull.
 @property (readonly, copy, nonatomic) NSArray *errors;
 
-/// The parsed document. Lazily created on first access.
+/**
+    Instances of HTMLParseError representing the errors encountered while parsing the document. Empty unless errorReporting is HTMLParseErrorReportingFull.
+ 
+    Errors found by the tokenizer are positioned where the tokenizer noticed them. Errors found during tree construction are positioned wherever the tokenizer had got to, which may be a little past the token at fault.
+ */
+@property (readonly, copy, nonatomic) NSArray *parseErrors;
+
+/**
+    The parsed document. Lazily created on first access.
+ 
+    For parsers initialized via -initWithContentType:, the document is nil until enough data arrives to determine its string encoding. It is built as data is appended, and is complete once -finish is called. If a <meta> tag changes the document's string encoding, parsing starts over with a new document.
+ */
 @property (readonly, strong, nonatomic) HTMLDocument *document;
 
-/// A block called when the string encoding has changed, making this parser useless.
+/// A block called when the string encoding has changed, making this parser useless. Not called for parsers initialized via -initWithContentType:, which start over on their own.
 @property (copy, nonatomic) void (^changeEncoding)(HTMLStringEncoding newEncoding);
 
 @end
@@ -53,3 +107,6 @@
     @param contentType The value of the HTTP Content-Type header associated with the data, if any.
  */
 extern HTMLParser * ParserWithDataAndContentType(NSData *data, NSString *contentType);
+
+/// Returns a parser suitable for some data of an unknown string encoding, which records as much about parse errors as asked.
+extern HTMLParser * ParserWithDataContentTypeAndErrorReporting(NSData *data, NSString *contentType, HTMLParseErrorReporting errorReporting);
@@ -3,7 +3,9 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLParser.h"
+#import "HTMLAtom.h"
 #import "HTMLComment.h"
+#import "HTMLNode+Private.h"
 #import "HTMLString.h"
 #import "HTMLTokenizer.h"
 
@@ -45,11 +47,55 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 @property (readonly, strong, nonatomic) HTMLElement *currentNode;
 
+/// The elements that haven't been closed yet, outermost first.
+@property (readonly, strong, nonatomic) NSArray *stackOfOpenElements;
+
+@property (readonly, strong, nonatomic) HTMLElement *headElementPointer;
+
+/// Called after each token is processed, including the end of the file.
+@property (copy, nonatomic) void (^didProcessToken)(void);
+
+/// Called with each element the parser creates, including clones made while fixing misnested formatting. The element may not be in the tree yet.
+@property (copy, nonatomic) void (^didCreateElement)(HTMLElement *element);
+
+/// Parses a fragment using the context element given at initialization, and returns the fragment's nodes without a parent. The parser can be reused for another fragment afterwards.
+- (NSArray *)parseFragmentWithInputStream:(HTMLPreprocessedInputStream *)inputStream;
+
 // http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
 - (instancetype)init NS_DESIGNATED_INITIALIZER;
 
+- (instancetype)initWithInputStream:(HTMLPreprocessedInputStream *)inputStream encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context NS_DESIGNATED_INITIALIZER;
+
 @end
 
+static HTMLTokenizerState TokenizerStateForContext(HTMLElement *context)
+{
+    if (context.htmlNamespace == HTMLNamespaceHTML) {
+        if (TagNameIsAnyOf(context.tagName, @"title", @"textarea")) {
+            return HTMLRCDATATokenizerState;
+        } else if (TagNameIsAnyOf(context.tagName, @"style", @"xmp", @"iframe", @"noembed", @"noframes")) {
+            return HTMLRAWTEXTTokenizerState;
+        } else if (TagNameIsAnyOf(context.tagName, @"script")) {
+            return HTMLScriptDataTokenizerState;
+        } else if (TagNameIsAnyOf(context.tagName, @"noscript")) {
+            return HTMLRAWTEXTTokenizerState;
+        } else if (TagNameIsAnyOf(context.tagName, @"plaintext")) {
+            return HTMLPLAINTEXTTokenizerState;
+        }
+    }
+    return HTMLDataTokenizerState;
+}
+
+static HTMLElement * NearestFormElement(HTMLElement *context)
+{
+    for (HTMLElement *element = context; element; element = element.parentElement) {
+        if (TagNameIsAnyOf(element.tagName, @"form")) {
+            return element;
+        }
+    }
+    return nil;
+}
+
 @implementation HTMLParser
 {
     HTMLTokenizer *_tokenizer;
@@ -61,6 +107,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
     HTMLElement *_formElementPointer;
     HTMLDocument *_document;
     NSMutableArray *_errors;
+    NSUInteger _numberOfErrors;
     BOOL _framesetOkFlag;
     BOOL _ignoreNextTokenIfLineFeed;
     NSMutableArray *_activeFormattingElements;
@@ -68,39 +115,53 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
     BOOL _fosterParenting;
     BOOL _done;
     BOOL _fragmentParsingAlgorithm;
+    BOOL _incremental;
+    NSString *_contentType;
+    NSMutableData *_data;
+    NSUInteger _decodedDataLength;
+    BOOL _encodingDetermined;
+    BOOL _finished;
+    BOOL _restartWithChangedEncoding;
+    
+    // Fragment parsing starts each fragment in the same place, which only depends on the context element.
+    HTMLTokenizerState _contextTokenizerState;
+    HTMLInsertionMode _contextInsertionMode;
+    HTMLElement *_contextFormElement;
 }
 
 // http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
 - (instancetype)init { @throw nil; }
 
 - (instancetype)initWithString:(NSString *)string encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context
+{
+    return [self initWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithString:string] encoding:encoding context:context];
+}
+
+- (instancetype)initWithData:(NSData *)data encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context
+{
+    HTMLPreprocessedInputStream *inputStream;
+    if (encoding.encoding == NSUTF8StringEncoding) {
+        inputStream = [[HTMLPreprocessedInputStream alloc] initWithUTF8Data:data];
+    } else {
+        inputStream = [[HTMLPreprocessedInputStream alloc] initWithString:[[NSString alloc] initWithData:data encoding:encoding.encoding]];
+    }
+    return [self initWithInputStream:inputStream encoding:encoding context:context];
+}
+
+- (instancetype)initWithInputStream:(HTMLPreprocessedInputStream *)inputStream encoding:(HTMLStringEncoding)encoding context:(HTMLElement *)context
 {
     if ((self = [super init])) {
-        _tokenizer = [[HTMLTokenizer alloc] initWithString:string];
-        _tokenizer.parser = self;
+        _errorReporting = HTMLParseErrorReportingFull;
+        [self resetWithInputStream:inputStream];
         _encoding = encoding;
         _context = context;
-        _insertionMode = HTMLInitialInsertionMode;
-        _stackOfOpenElements = [NSMutableArray new];
-        _errors = [NSMutableArray new];
-        _framesetOkFlag = YES;
-        _activeFormattingElements = [NSMutableArray new];
         _fragmentParsingAlgorithm = !!context;
         
         if (context) {
-            if (context.htmlNamespace == HTMLNamespaceHTML) {
-                if (StringIsEqualToAnyOf(context.tagName, @"title", @"textarea")) {
-                    _tokenizer.state = HTMLRCDATATokenizerState;
-                } else if (StringIsEqualToAnyOf(context.tagName, @"style", @"xmp", @"iframe", @"noembed", @"noframes")) {
-                    _tokenizer.state = HTMLRAWTEXTTokenizerState;
-                } else if ([context.tagName isEqualToString:@"script"]) {
-                    _tokenizer.state = HTMLScriptDataTokenizerState;
-                } else if ([context.tagName isEqualToString:@"noscript"]) {
-                    _tokenizer.state = HTMLRAWTEXTTokenizerState;
-                } else if ([context.tagName isEqualToString:@"plaintext"]) {
-                    _tokenizer.state = HTMLPLAINTEXTTokenizerState;
-                }
-            }
+            _contextTokenizerState = TokenizerStateForContext(context);
+            _tokenizer.state = _contextTokenizerState;
+            _contextInsertionMode = HTMLInvalidInsertionMode;
+            _contextFormElement = NearestFormElement(context);
             
             _encoding = (HTMLStringEncoding){
                 .encoding = NSUTF8StringEncoding,
@@ -111,6 +172,39 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
     return self;
 }
 
+- (instancetype)initWithContentType:(NSString *)contentType
+{
+    HTMLPreprocessedInputStream *inputStream = [[HTMLPreprocessedInputStream alloc] initWithString:@""];
+    inputStream.open = YES;
+    if ((self = [self initWithInputStream:inputStream encoding:(HTMLStringEncoding){ .encoding = NSUTF8StringEncoding, .confidence = Tentative } context:nil])) {
+        _incremental = YES;
+        _contentType = [contentType copy];
+        _data = [NSMutableData new];
+    }
+    return self;
+}
+
+- (void)resetWithInputStream:(HTMLPreprocessedInputStream *)inputStream
+{
+    _tokenizer = [[HTMLTokenizer alloc] initWithInputStream:inputStream];
+    _tokenizer.parser = self;
+    _tokenizer.errorReporting = _errorReporting;
+    _insertionMode = HTMLInitialInsertionMode;
+    _originalInsertionMode = HTMLInvalidInsertionMode;
+    _stackOfOpenElements = [NSMutableArray new];
+    _headElementPointer = nil;
+    _formElementPointer = nil;
+    _document = nil;
+    _errors = [NSMutableArray new];
+    _numberOfErrors = 0;
+    _framesetOkFlag = YES;
+    _ignoreNextTokenIfLineFeed = NO;
+    _activeFormattingElements = [NSMutableArray new];
+    _pendingTableCharacters = nil;
+    _fosterParenting = NO;
+    _done = NO;
+}
+
 - (NSString *)string
 {
     return _tokenizer.string;
@@ -118,37 +212,317 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (HTMLDocument *)document
 {
-    if (_document) return _document;
+    if (_document || _incremental) return _document;
+    [self startParsing];
+    [self processAvailableTokens];
+    [self processEndOfFile];
+    return _document;
+}
+
+- (void)startParsing
+{
     _document = [HTMLDocument new];
     if (_fragmentParsingAlgorithm) {
         HTMLElement *root = [[HTMLElement alloc] initWithTagName:@"html" attributes:nil];
         _document.rootElement = root;
         [_stackOfOpenElements setArray:@[ root ]];
         [self resetInsertionModeAppropriately];
-        HTMLElement *nearestForm = _context;
-        while (nearestForm) {
-            if ([nearestForm.tagName isEqualToString:@"form"]) {
-                break;
+        _formElementPointer = _contextFormElement;
+    }
+}
+
+- (void)processAvailableTokens
+{
+    for (;;) {
+        for (id token in _tokenizer) {
+            if (_done) break;
+            [self processToken:token];
+            [_tokenizer recycleToken:token];
+            if (_didProcessToken) {
+                _didProcessToken();
             }
-            nearestForm = nearestForm.parentElement;
         }
-        _formElementPointer = (HTMLElement *)nearestForm;
+        if (!_restartWithChangedEncoding) break;
+        [self restartWithChangedEncoding];
     }
-    for (id token in _tokenizer) {
-        if (_done) break;
-        [self processToken:token];
+}
+
+- (void)processEndOfFile
+{
+    // Once parsing has stopped, the stack of open elements is empty and the insertion mode is stale, so the end of the file has nothing to close and only the wrong places to insert.
+    if (!_done) {
+        [self processToken:[HTMLEOFToken new]];
     }
-    [self processToken:[HTMLEOFToken new]];
     if (_context) {
-        HTMLNode *root = _document.children[0];
-        NSMutableOrderedSet *documentChildren = [_document mutableChildren];
-        [documentChildren removeAllObjects];
-        [documentChildren addObjectsFromArray:root.children.array];
+        HTMLNode *root = [_document childAtIndex:0];
+        [[_document mutableChildren] removeAllObjects];
+        [_document addChildrenOfNode:root];
+    }
+    if (_didProcessToken) {
+        _didProcessToken();
+    }
+}
+
+#pragma mark Fragments
+
+- (NSArray *)parseFragmentWithInputStream:(HTMLPreprocessedInputStream *)inputStream
+{
+    NSAssert(_fragmentParsingAlgorithm, @"fragments need a context element");
+    
+    // Comments after the end of an html context go in the document, so one is kept around to catch them. They aren't part of the fragment.
+    if (!_document) {
+        _document = [HTMLDocument new];
+    }
+    [_tokenizer resetWithInputStream:inputStream];
+    _tokenizer.state = _contextTokenizerState;
+    HTMLElement *root = [[HTMLElement alloc] initWithTagName:@"html" attributes:nil];
+    [_stackOfOpenElements removeAllObjects];
+    [_stackOfOpenElements addObject:root];
+    [_activeFormattingElements removeAllObjects];
+    [_errors removeAllObjects];
+    _numberOfErrors = 0;
+    _headElementPointer = nil;
+    _formElementPointer = _contextFormElement;
+    _originalInsertionMode = HTMLInvalidInsertionMode;
+    _framesetOkFlag = YES;
+    _ignoreNextTokenIfLineFeed = NO;
+    _pendingTableCharacters = nil;
+    _fosterParenting = NO;
+    _done = NO;
+    if (_contextInsertionMode == HTMLInvalidInsertionMode) {
+        [self resetInsertionModeAppropriately];
+        _contextInsertionMode = _insertionMode;
+    } else {
+        _insertionMode = _contextInsertionMode;
+    }
+    
+    [self processAvailableTokens];
+    [self processToken:[HTMLEOFToken new]];
+    [_document removeAllChildren];
+    [_stackOfOpenElements removeAllObjects];
+    return [root removeAllChildren];
+}
+
+#pragma mark Incremental parsing
+
+/**
+    Returns the number of bytes that can be decoded without splitting a character. Any remaining bytes need to wait for more data.
+ 
+    UTF-16 surrogate pairs can still be split, but the preprocessed input stream puts them back together.
+ */
+static NSUInteger DecodableLengthOfBytes(const uint8_t *bytes, NSUInteger length, NSStringEncoding encoding)
+{
+    if (encoding == NSUTF8StringEncoding) {
+        // Back up to the start of the last character, then see whether it's all there.
+        NSUInteger start = length;
+        while (start > 0 && length - start < 4 && (bytes[start - 1] & 0xC0) == 0x80) {
+            start--;
+        }
+        if (start == 0) return length;
+        uint8_t lead = bytes[start - 1];
+        NSUInteger expected = 1;
+        if ((lead & 0xE0) == 0xC0) {
+            expected = 2;
+        } else if ((lead & 0xF0) == 0xE0) {
+            expected = 3;
+        } else if ((lead & 0xF8) == 0xF0) {
+            expected = 4;
+        }
+        if (length - (start - 1) < expected) {
+            return start - 1;
+        } else {
+            return length;
+        }
+    } else if (IsUTF16Encoding(encoding)) {
+        return length & ~(NSUInteger)1;
+    } else if (IsASCIICompatibleEncoding(encoding) && CFStringGetMaximumSizeForEncoding(1, CFStringConvertNSStringEncodingToEncoding(encoding)) == 1) {
+        return length;
+    } else {
+        // Multibyte encodings without an easily-found character boundary. StringByDecodingBytes holds back an incomplete character.
+        return length;
+    }
+}
+
+static NSString * StringWithBytes(const uint8_t *bytes, NSUInteger length, NSStringEncoding encoding)
+{
+    return [[NSString alloc] initWithBytesNoCopy:(void *)bytes length:length encoding:encoding freeWhenDone:NO];
+}
+
+// Returns the length of the longest prefix of up to `length` bytes that decodes, trimming at most three bytes to get back to a character boundary, or NSNotFound if none do.
+static NSUInteger DecodableLengthNear(const uint8_t *bytes, NSUInteger length, NSStringEncoding encoding)
+{
+    for (NSUInteger trim = 0; trim < 4 && trim <= length; trim++) {
+        if (StringWithBytes(bytes, length - trim, encoding)) return length - trim;
+    }
+    return NSNotFound;
+}
+
+/**
+    Returns the length of the longest prefix that decodes. The bytes that follow it start a sequence that won't decode.
+ 
+    @param length The number of bytes, which must not decode all together.
+ */
+static NSUInteger DecodableLengthBeforeBadSequence(const uint8_t *bytes, NSUInteger length, NSStringEncoding encoding)
+{
+    // A prefix that ends before the bad sequence decodes once trimmed back to a character boundary, and one that ends after it never does, so binary search for it.
+    NSUInteger low = 0, high = length, decodable = 0;
+    while (high - low > 1) {
+        NSUInteger middle = low + (high - low) / 2;
+        NSUInteger trimmed = DecodableLengthNear(bytes, middle, encoding);
+        if (trimmed != NSNotFound) {
+            low = middle;
+            decodable = MAX(decodable, trimmed);
+        } else {
+            high = middle;
+        }
+    }
+    return decodable;
+}
+
+/**
+    Decodes as many bytes as possible, replacing each sequence that won't decode with U+FFFD REPLACEMENT CHARACTER.
+ 
+    @param final NO if more bytes may follow, in which case a few undecodable bytes at the end are kept back as a possibly incomplete character.
+    @param decodedLength On return, the number of bytes decoded.
+ */
+static NSString * StringByDecodingBytes(const uint8_t *bytes, NSUInteger length, NSStringEncoding encoding, BOOL final, NSUInteger *decodedLength)
+{
+    NSMutableString *string;
+    NSUInteger location = 0;
+    while (location < length) {
+        NSString *rest = StringWithBytes(bytes + location, length - location, encoding);
+        if (rest) {
+            location = length;
+            if (!string) {
+                string = [rest mutableCopy];
+            } else {
+                [string appendString:rest];
+            }
+            break;
+        }
+        
+        NSUInteger decodable = DecodableLengthBeforeBadSequence(bytes + location, length - location, encoding);
+        if (!string) {
+            string = [NSMutableString new];
+        }
+        if (decodable > 0) {
+            [string appendString:StringWithBytes(bytes + location, decodable, encoding)];
+            location += decodable;
+        }
+        if (!final && length - location < 4) break;
+        [string appendString:@"\uFFFD"];
+        location++;
+    }
+    *decodedLength = location;
+    return string ?: @"";
+}
+
+- (void)appendData:(NSData *)data
+{
+    NSAssert(_incremental, @"%@ can only append data when initialized with a content type", self);
+    NSAssert(!_finished, @"cannot append data after %@ has finished", self);
+    [_data appendData:data];
+    
+    // Wait for enough data to check for a byte order mark, then for enough to prescan for a <meta> tag (unless the encoding is already certain).
+    if (!_encodingDetermined) {
+        if (_data.length < 3) return;
+        if (_data.length < PrescanByteCount && DeterminedStringEncodingForData(_data, _contentType).confidence != Certain) return;
+    }
+    
+    [self decodeAvailableData];
+    [self processAvailableTokens];
+}
+
+- (void)finish
+{
+    NSAssert(_incremental, @"%@ can only finish when initialized with a content type", self);
+    if (_finished) return;
+    _finished = YES;
+    [self decodeAvailableData];
+    _tokenizer.open = NO;
+    [self processAvailableTokens];
+    [self processEndOfFile];
+}
+
+- (void)decodeAvailableData
+{
+    if (!_encodingDetermined) {
+        _encoding = DeterminedStringEncodingForData(_data, _contentType);
+        _encodingDetermined = YES;
+        [self startOver];
+        return;
+    }
+    
+    // The input stream decodes UTF-8 on its own.
+    if (_encoding.encoding == NSUTF8StringEncoding) {
+        [_tokenizer appendUTF8Data:[_data subdataWithRange:NSMakeRange(_decodedDataLength, _data.length - _decodedDataLength)]];
+        _decodedDataLength = _data.length;
+        return;
+    }
+    
+    const uint8_t *bytes = (const uint8_t *)_data.bytes + _decodedDataLength;
+    NSUInteger length = _data.length - _decodedDataLength;
+    if (!_finished) {
+        length = DecodableLengthOfBytes(bytes, length, _encoding.encoding);
+    }
+    if (length == 0) return;
+    
+    NSUInteger decodedLength;
+    NSString *string = StringByDecodingBytes(bytes, length, _encoding.encoding, _finished, &decodedLength);
+    [_tokenizer appendString:string];
+    _decodedDataLength += decodedLength;
+}
+
+// Start over from the beginning of the data after a <meta> tag changes the encoding. By now the encoding is certain, so this happens at most once.
+- (void)restartWithChangedEncoding
+{
+    _restartWithChangedEncoding = NO;
+    [self startOver];
+}
+
+// Parse everything received so far from scratch, using an input stream suited to the encoding.
+- (void)startOver
+{
+    HTMLPreprocessedInputStream *inputStream;
+    if (_encoding.encoding == NSUTF8StringEncoding) {
+        inputStream = [[HTMLPreprocessedInputStream alloc] initWithUTF8Data:nil];
+    } else {
+        inputStream = [[HTMLPreprocessedInputStream alloc] initWithString:@""];
+    }
+    inputStream.open = YES;
+    [self resetWithInputStream:inputStream];
+    _decodedDataLength = 0;
+    [self startParsing];
+    [self decodeAvailableData];
+    inputStream.open = !_finished;
+}
+
+- (void)setErrorReporting:(HTMLParseErrorReporting)errorReporting
+{
+    _errorReporting = errorReporting;
+    _tokenizer.errorReporting = errorReporting;
+}
+
+- (NSUInteger)numberOfErrors
+{
+    // A tokenizer that's only counting keeps its errors to itself.
+    if (_errorReporting == HTMLParseErrorReportingCount) {
+        return _numberOfErrors + _tokenizer.numberOfErrors;
+    } else {
+        return _numberOfErrors;
     }
-    return _document;
 }
 
 - (NSArray *)errors
+{
+    NSMutableArray *errors = [NSMutableArray arrayWithCapacity:_errors.count];
+    for (HTMLParseError *error in _errors) {
+        [errors addObject:error.reason];
+    }
+    return errors;
+}
+
+- (NSArray *)parseErrors
 {
     return [_errors copy];
 }
@@ -333,9 +707,9 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)beforeHtmlInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         HTMLElement *html = [self createElementForToken:token];
-        [[_document mutableChildren] addObject:html];
+        [_document addChild:html];
         [_stackOfOpenElements addObject:html];
         [self switchInsertionMode:HTMLBeforeHeadInsertionMode];
     } else {
@@ -345,7 +719,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)beforeHtmlInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"head", @"body", @"html", @"br")) {
+    if (TagNameIsAnyOf(token.tagName, @"head", @"body", @"html", @"br")) {
         [self beforeHtmlInsertionModeHandleAnythingElse:token];
     } else {
         [self addParseError:@"Unexpected end tag named %@ before <html>", token.tagName];
@@ -355,7 +729,10 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 - (void)beforeHtmlInsertionModeHandleAnythingElse:(id)token
 {
     HTMLElement *html = [[HTMLElement alloc] initWithTagName:@"html" attributes:nil];
-    [[_document mutableChildren] addObject:html];
+    if (_didCreateElement) {
+        _didCreateElement(html);
+    }
+    [_document addChild:html];
     [_stackOfOpenElements addObject:html];
     [self switchInsertionMode:HTMLBeforeHeadInsertionMode];
     [self reprocessToken:token];
@@ -383,9 +760,9 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)beforeHeadInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"head"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"head")) {
         HTMLElement *head = [self insertElementForToken:token];
         _headElementPointer = head;
         [self switchInsertionMode:HTMLInHeadInsertionMode];
@@ -396,7 +773,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)beforeHeadInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"head", @"body", @"html", @"br")) {
+    if (TagNameIsAnyOf(token.tagName, @"head", @"body", @"html", @"br")) {
         [self beforeHeadInsertionModeHandleAnythingElse:token];
     } else {
         [self addParseError:@"Unexpected end tag named %@ before <head>", token.tagName];
@@ -437,12 +814,12 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)inHeadInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"base", @"basefont", @"bgsound", @"link")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"base", @"basefont", @"bgsound", @"link")) {
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
-    } else if ([token.tagName isEqualToString:@"meta"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"meta")) {
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
         if (self.encoding.confidence == Tentative) {
@@ -494,19 +871,19 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
                 }
             }
         }
-    } else if ([token.tagName isEqualToString:@"title"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"title")) {
         [self followGenericRCDATAElementParsingAlgorithmForToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"noscript", @"noframes", @"style")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"noscript", @"noframes", @"style")) {
         [self followGenericRawTextElementParsingAlgorithmForToken:token];
-    } else if ([token.tagName isEqualToString:@"script"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"script")) {
         NSUInteger index;
         HTMLNode *adjustedInsertionLocation = [self appropriatePlaceForInsertingANodeIndex:&index];
         HTMLElement *script = [self createElementForToken:token];
-        [[adjustedInsertionLocation mutableChildren] insertObject:script atIndex:index];
+        [adjustedInsertionLocation insertChild:script atIndex:index];
         [_stackOfOpenElements addObject:script];
         _tokenizer.state = HTMLScriptDataTokenizerState;
         [self switchInsertionMode:HTMLTextInsertionMode];
-    } else if ([token.tagName isEqualToString:@"head"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"head")) {
         [self addParseError:@"<head> already started"];
     } else {
         [self inHeadInsertionModeHandleAnythingElse:token];
@@ -532,7 +909,11 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         return;
     }
     
-    if (self.changeEncoding) {
+    if (_incremental) {
+        _encoding = (HTMLStringEncoding){ .encoding = newEncoding, .confidence = Certain };
+        _restartWithChangedEncoding = YES;
+        [self stopParsing];
+    } else if (self.changeEncoding) {
         self.changeEncoding((HTMLStringEncoding){ .encoding = newEncoding, .confidence = Certain });
         [self stopParsing];
     } else {
@@ -542,10 +923,10 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)inHeadInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"head"]) {
+    if (TagNameIsAnyOf(token.tagName, @"head")) {
         [_stackOfOpenElements removeLastObject];
         [self switchInsertionMode:HTMLAfterHeadInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"body", @"html", @"br")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body", @"html", @"br")) {
         [self inHeadInsertionModeHandleAnythingElse:token];
     } else {
         [self addParseError:@"Unexpected end tag named %@ in head", token.tagName];
@@ -585,21 +966,21 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)afterHeadInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"body"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body")) {
         [self insertElementForToken:token];
         _framesetOkFlag = NO;
         [self switchInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"frameset"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"frameset")) {
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInFramesetInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"base", @"basefont", @"bgsound", @"link", @"meta", @"noframes", @"script", @"style", @"title")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"base", @"basefont", @"bgsound", @"link", @"meta", @"noframes", @"script", @"style", @"title")) {
         [self addParseError:@"Misnested start tag named %@ after <head>", token.tagName];
         [_stackOfOpenElements addObject:_headElementPointer];
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
         [_stackOfOpenElements removeObject:_headElementPointer];
-    } else if ([token.tagName isEqualToString:@"head"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"head")) {
         [self addParseError:@"Start tag named head after <head>"];
     } else {
         [self afterHeadInsertionModeHandleAnythingElse:token];
@@ -608,7 +989,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)afterHeadInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"body", @"html", @"br")) {
+    if (TagNameIsAnyOf(token.tagName, @"body", @"html", @"br")) {
         [self afterHeadInsertionModeHandleAnythingElse:token];
     } else {
         [self addParseError:@"Unexpected end tag named %@ after <head>", token.tagName];
@@ -652,7 +1033,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)inBodyInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self addParseError:@"Start tag named html in <body>"];
         HTMLElement *element = _stackOfOpenElements[0];
         NSDictionary *attributes = token.attributes;
@@ -661,12 +1042,12 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
                 element[attributeName] = attributes[attributeName];
             }
         }
-    } else if (StringIsEqualToAnyOf(token.tagName, @"base", @"basefont", @"bgsound", @"link", @"meta", @"noframes", @"script", @"style", @"title")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"base", @"basefont", @"bgsound", @"link", @"meta", @"noframes", @"script", @"style", @"title")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
-    } else if ([token.tagName isEqualToString:@"body"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body")) {
         [self addParseError:@"Start tag named body in <body>"];
         if (_stackOfOpenElements.count < 2 ||
-            ![[_stackOfOpenElements[1] tagName] isEqualToString:@"body"])
+            !TagNameIsAnyOf([_stackOfOpenElements[1] tagName], @"body"))
         {
             return;
         }
@@ -678,43 +1059,43 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
                 body[attributeName] = attributes[attributeName];
             }
         }
-    } else if ([token.tagName isEqualToString:@"frameset"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"frameset")) {
         [self addParseError:@"Start tag named frameset in <body>"];
         if (_stackOfOpenElements.count < 2 ||
-            ![[_stackOfOpenElements[1] tagName] isEqualToString:@"body"])
+            !TagNameIsAnyOf([_stackOfOpenElements[1] tagName], @"body"))
         {
             return;
         }
         if (!_framesetOkFlag) return;
         HTMLNode *topOfStack = _stackOfOpenElements[0];
-        [[topOfStack mutableChildren] removeObject:_stackOfOpenElements[1]];
+        [topOfStack removeChild:_stackOfOpenElements[1]];
         while (_stackOfOpenElements.count > 1) {
             [_stackOfOpenElements removeLastObject];
         }
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInFramesetInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"address", @"article", @"aside", @"blockquote", @"center", @"details", @"dialog", @"dir", @"div", @"dl", @"fieldset", @"figcaption", @"figure", @"footer", @"header", @"hgroup", @"main", @"menu", @"nav", @"ol", @"p", @"section", @"summary", @"ul")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"address", @"article", @"aside", @"blockquote", @"center", @"details", @"dialog", @"dir", @"div", @"dl", @"fieldset", @"figcaption", @"figure", @"footer", @"header", @"hgroup", @"main", @"menu", @"nav", @"ol", @"p", @"section", @"summary", @"ul")) {
         if ([self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
         [self insertElementForToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
         if ([self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
-        if (StringIsEqualToAnyOf(self.currentNode.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
             [self addParseError:@"Nested header start tag %@ in <body>", token.tagName];
             [_stackOfOpenElements removeLastObject];
         }
         [self insertElementForToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"pre", @"listing")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"pre", @"listing")) {
         if ([self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
         [self insertElementForToken:token];
         _ignoreNextTokenIfLineFeed = YES;
         _framesetOkFlag = NO;
-    } else if ([token.tagName isEqualToString:@"form"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"form")) {
         if (_formElementPointer) {
             [self addParseError:@"Start tag named form within a form in <body>"];
             return;
@@ -724,22 +1105,22 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         }
         HTMLElement *form = [self insertElementForToken:token];
         _formElementPointer = form;
-    } else if ([token.tagName isEqualToString:@"li"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"li")) {
         _framesetOkFlag = NO;
         HTMLElement *node = self.currentNode;
     loop:
-        if ([node.tagName isEqualToString:@"li"]) {
+        if (TagNameIsAnyOf(node.tagName, @"li")) {
             [self generateImpliedEndTagsExceptForTagsNamed:@"li"];
-            if (![self.currentNode.tagName isEqualToString:@"li"]) {
+            if (!TagNameIsAnyOf(self.currentNode.tagName, @"li")) {
                 [self addParseError:@"Misnested li tag in <body>"];
             }
-            while (![self.currentNode.tagName isEqualToString:@"li"]) {
+            while (!TagNameIsAnyOf(self.currentNode.tagName, @"li")) {
                 [_stackOfOpenElements removeLastObject];
             }
             [_stackOfOpenElements removeLastObject];
             goto done;
         }
-        if (IsSpecialElement(node) && !(node.htmlNamespace == HTMLNamespaceHTML && StringIsEqualToAnyOf(node.tagName, @"address", @"div", @"p"))) {
+        if (IsSpecialElement(node) && !(node.htmlNamespace == HTMLNamespaceHTML && TagNameIsAnyOf(node.tagName, @"address", @"div", @"p"))) {
             goto done;
         }
         node = [_stackOfOpenElements objectAtIndex:[_stackOfOpenElements indexOfObject:node] - 1];
@@ -749,30 +1130,30 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             [self closePElement];
         }
         [self insertElementForToken:token];
-    } else if ([token.tagName isEqualToString:@"dd"] || [token.tagName isEqualToString:@"dt"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"dd") || TagNameIsAnyOf(token.tagName, @"dt")) {
         _framesetOkFlag = NO;
         for (HTMLElement *node in _stackOfOpenElements.reverseObjectEnumerator) {
-            if ([node.tagName isEqualToString:@"dd"]) {
+            if (TagNameIsAnyOf(node.tagName, @"dd")) {
                 [self generateImpliedEndTagsExceptForTagsNamed:@"dd"];
-                if (![self.currentNode.tagName isEqualToString:@"dd"]) {
+                if (!TagNameIsAnyOf(self.currentNode.tagName, @"dd")) {
                     [self addParseError:@"Misnested dd tag in <body>"];
                 }
-                while (![self.currentNode.tagName isEqualToString:@"dd"]) {
+                while (!TagNameIsAnyOf(self.currentNode.tagName, @"dd")) {
                     [_stackOfOpenElements removeLastObject];
                 }
                 [_stackOfOpenElements removeLastObject];
                 break;
-            } else if ([node.tagName isEqualToString:@"dt"]) {
+            } else if (TagNameIsAnyOf(node.tagName, @"dt")) {
                 [self generateImpliedEndTagsExceptForTagsNamed:@"dt"];
-                if (![self.currentNode.tagName isEqualToString:@"dt"]) {
+                if (!TagNameIsAnyOf(self.currentNode.tagName, @"dt")) {
                     [self addParseError:@"Misnested dt tag in <body>"];
                 }
-                while (![self.currentNode.tagName isEqualToString:@"dt"]) {
+                while (!TagNameIsAnyOf(self.currentNode.tagName, @"dt")) {
                     [_stackOfOpenElements removeLastObject];
                 }
                 [_stackOfOpenElements removeLastObject];
                 break;
-            } else if (IsSpecialElement(node) && !(node.htmlNamespace == HTMLNamespaceHTML && StringIsEqualToAnyOf(node.tagName, @"address", @"div", @"p"))) {
+            } else if (IsSpecialElement(node) && !(node.htmlNamespace == HTMLNamespaceHTML && TagNameIsAnyOf(node.tagName, @"address", @"div", @"p"))) {
                 break;
             }
         }
@@ -780,17 +1161,17 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             [self closePElement];
         }
         [self insertElementForToken:token];
-    } else if ([token.tagName isEqualToString:@"plaintext"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"plaintext")) {
         if ([self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
         [self insertElementForToken:token];
         _tokenizer.state = HTMLPLAINTEXTTokenizerState;
-    } else if ([token.tagName isEqualToString:@"button"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"button")) {
         if ([self elementInScopeWithTagName:@"button"]) {
             [self addParseError:@"Nested button tag in <body>"];
             [self generateImpliedEndTags];
-            while (![self.currentNode.tagName isEqualToString:@"button"]) {
+            while (!TagNameIsAnyOf(self.currentNode.tagName, @"button")) {
                 [_stackOfOpenElements removeLastObject];
             }
             [_stackOfOpenElements removeLastObject];
@@ -798,10 +1179,10 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         [self reconstructTheActiveFormattingElements];
         [self insertElementForToken:token];
         _framesetOkFlag = NO;
-    } else if ([token.tagName isEqualToString:@"a"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"a")) {
         for (HTMLElement *element in _activeFormattingElements.reverseObjectEnumerator.allObjects) {
             if ([element isEqual:[HTMLMarker marker]]) break;
-            if ([element.tagName isEqualToString:@"a"]) {
+            if (TagNameIsAnyOf(element.tagName, @"a")) {
                 [self addParseError:@"Nested start tag 'a' in <body>"];
                 if (![self runAdoptionAgencyAlgorithmForTagName:@"a"]) {
                     [self inBodyInsertionModeHandleAnyOtherEndTagToken:token];
@@ -815,11 +1196,11 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         [self reconstructTheActiveFormattingElements];
         HTMLElement *element = [self insertElementForToken:token];
         [self pushElementOnToListOfActiveFormattingElements:element];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"b", @"big", @"code", @"em", @"font", @"i", @"s", @"small", @"strike", @"strong", @"tt", @"u")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"b", @"big", @"code", @"em", @"font", @"i", @"s", @"small", @"strike", @"strong", @"tt", @"u")) {
         [self reconstructTheActiveFormattingElements];
         HTMLElement *element = [self insertElementForToken:token];
         [self pushElementOnToListOfActiveFormattingElements:element];
-    } else if ([token.tagName isEqualToString:@"nobr"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"nobr")) {
         [self reconstructTheActiveFormattingElements];
         if ([self elementInScopeWithTagName:@"nobr"]) {
             [self addParseError:@"Misnested nobr tag in <body>"];
@@ -831,24 +1212,24 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         }
         HTMLElement *element = [self insertElementForToken:token];
         [self pushElementOnToListOfActiveFormattingElements:element];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"applet", @"marquee", @"object")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"applet", @"marquee", @"object")) {
         [self reconstructTheActiveFormattingElements];
         [self insertElementForToken:token];
         [self pushMarkerOnToListOfActiveFormattingElements];
         _framesetOkFlag = NO;
-    } else if ([token.tagName isEqualToString:@"table"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"table")) {
         if (_document.quirksMode != HTMLQuirksModeQuirks && [self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
         [self insertElementForToken:token];
         _framesetOkFlag = NO;
         [self switchInsertionMode:HTMLInTableInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"area", @"br", @"embed", @"img", @"keygen", @"wbr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"area", @"br", @"embed", @"img", @"keygen", @"wbr")) {
         [self reconstructTheActiveFormattingElements];
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
         _framesetOkFlag = NO;
-    } else if ([token.tagName isEqualToString:@"input"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"input")) {
         [self reconstructTheActiveFormattingElements];
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
@@ -856,20 +1237,20 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         if (!type || [type caseInsensitiveCompare:@"hidden"] != NSOrderedSame) {
             _framesetOkFlag = NO;
         }
-    } else if (StringIsEqualToAnyOf(token.tagName, @"menuitem", @"param", @"source", @"track")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"menuitem", @"param", @"source", @"track")) {
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
-    } else if ([token.tagName isEqualToString:@"hr"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"hr")) {
         if ([self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
         _framesetOkFlag = NO;
-    } else if ([token.tagName isEqualToString:@"image"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"image")) {
         [self addParseError:@"It's spelled 'img' in <body>"];
         [self reprocessToken:[token copyWithTagName:@"img"]];
-    } else if ([token.tagName isEqualToString:@"isindex"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"isindex")) {
         [self addParseError:@"Don't use isindex in <body>"];
         if (_formElementPointer) return;
         _framesetOkFlag = NO;
@@ -902,25 +1283,25 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         [_stackOfOpenElements removeLastObject];
         [_stackOfOpenElements removeLastObject];
         _formElementPointer = nil;
-    } else if ([token.tagName isEqualToString:@"textarea"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"textarea")) {
         [self insertElementForToken:token];
         _ignoreNextTokenIfLineFeed = YES;
         _tokenizer.state = HTMLRCDATATokenizerState;
         _framesetOkFlag = NO;
         [self switchInsertionMode:HTMLTextInsertionMode];
-    } else if ([token.tagName isEqualToString:@"xmp"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"xmp")) {
         if ([self elementInButtonScopeWithTagName:@"p"]) {
             [self closePElement];
         }
         [self reconstructTheActiveFormattingElements];
         _framesetOkFlag = NO;
         [self followGenericRawTextElementParsingAlgorithmForToken:token];
-    } else if ([token.tagName isEqualToString:@"iframe"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"iframe")) {
         _framesetOkFlag = NO;
         [self followGenericRawTextElementParsingAlgorithmForToken:token];
-    } else if ([token.tagName isEqualToString:@"noembed"] || [token.tagName isEqualToString:@"noscript"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"noembed") || TagNameIsAnyOf(token.tagName, @"noscript")) {
         [self followGenericRawTextElementParsingAlgorithmForToken:token];
-    } else if ([token.tagName isEqualToString:@"select"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"select")) {
         [self reconstructTheActiveFormattingElements];
         [self insertElementForToken:token];
         _framesetOkFlag = NO;
@@ -936,21 +1317,21 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
                 [self switchInsertionMode:HTMLInSelectInsertionMode];
                 break;
         }
-    } else if (StringIsEqualToAnyOf(token.tagName, @"optgroup", @"option")) {
-        if ([self.currentNode.tagName isEqualToString:@"option"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"optgroup", @"option")) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"option")) {
             [_stackOfOpenElements removeLastObject];
         }
         [self reconstructTheActiveFormattingElements];
         [self insertElementForToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"rp", @"rt")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"rp", @"rt")) {
         if ([self elementInScopeWithTagName:@"ruby"]) {
             [self generateImpliedEndTags];
-            if (![self.currentNode.tagName isEqualToString:@"ruby"]) {
+            if (!TagNameIsAnyOf(self.currentNode.tagName, @"ruby")) {
                 [self addParseError:@"Start tag named %@ outside of ruby in <body>", token.tagName];
             }
         }
         [self insertElementForToken:token];
-    } else if ([token.tagName isEqualToString:@"math"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"math")) {
         [self reconstructTheActiveFormattingElements];
         AdjustMathMLAttributesForToken(token);
         AdjustForeignAttributesForToken(token);
@@ -959,7 +1340,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         if (token.selfClosingFlag) {
             [_stackOfOpenElements removeLastObject];
         }
-    } else if ([token.tagName isEqualToString:@"svg"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"svg")) {
         [self reconstructTheActiveFormattingElements];
         AdjustSVGAttributesForToken(token);
         AdjustForeignAttributesForToken(token);
@@ -968,7 +1349,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         if (token.selfClosingFlag) {
             [_stackOfOpenElements removeLastObject];
         }
-    } else if (StringIsEqualToAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"frame", @"head", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"frame", @"head", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
         [self addParseError:@"Start tag named %@ ignored in <body>", token.tagName];
     } else {
         [self reconstructTheActiveFormattingElements];
@@ -979,7 +1360,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 - (void)inBodyInsertionModeHandleEOFToken:(HTMLEOFToken *)token
 {
     for (HTMLElement *node in _stackOfOpenElements) {
-        if (!StringIsEqualToAnyOf(node.tagName, @"dd", @"dt", @"li", @"p", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr", @"body", @"html")) {
+        if (!TagNameIsAnyOf(node.tagName, @"dd", @"dt", @"li", @"p", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr", @"body", @"html")) {
             [self addParseError:@"Unclosed %@ element in <body> at end of file", node.tagName];
             break;
         }
@@ -989,22 +1370,22 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 
 - (void)inBodyInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"body", @"html")) {
+    if (TagNameIsAnyOf(token.tagName, @"body", @"html")) {
         if (![self elementInScopeWithTagName:@"body"]) {
             [self addParseError:@"End tag named %@ without body in scope in <body>", token.tagName];
             return;
         }
         for (HTMLElement *element in _stackOfOpenElements.reverseObjectEnumerator) {
-            if (!StringIsEqualToAnyOf(element.tagName, @"dd", @"dt", @"li", @"optgroup", @"option", @"p", @"rp", @"rt", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr", @"body", @"html")) {
+            if (!TagNameIsAnyOf(element.tagName, @"dd", @"dt", @"li", @"optgroup", @"option", @"p", @"rp", @"rt", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr", @"body", @"html")) {
                 [self addParseError:@"Misplaced %@ element in <body>", element.tagName];
                 break;
             }
         }
         [self switchInsertionMode:HTMLAfterBodyInsertionMode];
-        if ([token.tagName isEqualToString:@"html"]) {
+        if (TagNameIsAnyOf(token.tagName, @"html")) {
             [self reprocessToken:token];
         }
-    } else if (StringIsEqualToAnyOf(token.tagName, @"address", @"article", @"aside", @"blockquote", @"button", @"center", @"details", @"dialog", @"dir", @"div", @"dl", @"fieldset", @"figcaption", @"figure", @"footer", @"header", @"hgroup", @"listing", @"main", @"menu", @"nav", @"ol", @"pre", @"section", @"summary", @"ul")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"address", @"article", @"aside", @"blockquote", @"button", @"center", @"details", @"dialog", @"dir", @"div", @"dl", @"fieldset", @"figcaption", @"figure", @"footer", @"header", @"hgroup", @"listing", @"main", @"menu", @"nav", @"ol", @"pre", @"section", @"summary", @"ul")) {
         if (![self elementInScopeWithTagName:token.tagName]) {
             [self addParseError:@"End tag '%@' for unmatched open tag in <body>", token.tagName];
             return;
@@ -1017,7 +1398,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
-    } else if ([token.tagName isEqualToString:@"form"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"form")) {
         HTMLElement *node = _formElementPointer;
         _formElementPointer = nil;
         if (![self isElementInScope:node]) {
@@ -1029,26 +1410,26 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             [self addParseError:@"Misnested 'form' in <body>"];
         }
         [_stackOfOpenElements removeObject:node];
-    } else if ([token.tagName isEqualToString:@"p"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"p")) {
         if (![self elementInButtonScopeWithTagName:@"p"]) {
             [self addParseError:@"Not closing unknown 'p' element in <body>"];
             [self insertElementForToken:[[HTMLStartTagToken alloc] initWithTagName:@"p"]];
         }
         [self closePElement];
-    } else if ([token.tagName isEqualToString:@"li"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"li")) {
         if (![self elementInListItemScopeWithTagName:@"li"]) {
             [self addParseError:@"Not closing unknown 'li' element in <body>"];
             return;
         }
         [self generateImpliedEndTagsExceptForTagsNamed:@"li"];
-        if (![self.currentNode.tagName isEqualToString:@"li"]) {
+        if (!TagNameIsAnyOf(self.currentNode.tagName, @"li")) {
             [self addParseError:@"Misnested end tag 'li' in <body>"];
         }
-        while (![self.currentNode.tagName isEqualToString:@"li"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"li")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
-    } else if ([token.tagName isEqualToString:@"dd"] || [token.tagName isEqualToString:@"dt"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"dd") || TagNameIsAnyOf(token.tagName, @"dt")) {
         if (![self elementInScopeWithTagName:token.tagName]) {
             [self addParseError:@"Not closing unknown '%@' element in <body>", token.tagName];
             return;
@@ -1061,7 +1442,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
         if (![self elementInScopeWithTagNameInArray:@[ @"h1", @"h2", @"h3", @"h4", @"h5", @"h6" ]]) {
             [self addParseError:@"Not closing unknown '%@' element in <body>", token.tagName];
             return;
@@ -1070,16 +1451,16 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         if (![self.currentNode.tagName isEqualToString:token.tagName]) {
             [self addParseError:@"Misnested end tag '%@' in <body>", token.tagName];
         }
-        while (!StringIsEqualToAnyOf(self.currentNode.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"h1", @"h2", @"h3", @"h4", @"h5", @"h6")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"a", @"b", @"big", @"code", @"em", @"font", @"i", @"nobr", @"s", @"small", @"strike", @"strong", @"tt", @"u")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"a", @"b", @"big", @"code", @"em", @"font", @"i", @"nobr", @"s", @"small", @"strike", @"strong", @"tt", @"u")) {
         if (![self runAdoptionAgencyAlgorithmForTagName:token.tagName]) {
             [self inBodyInsertionModeHandleAnyOtherEndTagToken:token];
             return;
         }
-    } else if (StringIsEqualToAnyOf(token.tagName, @"applet", @"marquee", @"object")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"applet", @"marquee", @"object")) {
         if (![self elementInScopeWithTagName:token.tagName]) {
             [self addParseError:@"Not closing unknown '%@' element in <body>", token.tagName];
             return;
@@ -1093,7 +1474,7 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
         }
         [_stackOfOpenElements removeLastObject];
         [self clearActiveFormattingElementsUpToLastMarker];
-    } else if ([token.tagName isEqualToString:@"br"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"br")) {
         [self addParseError:@"'br' element cannot have an end tag"];
         [self inBodyInsertionModeHandleStartTagToken:
          [[HTMLStartTagToken alloc] initWithTagName:@"br"]];
@@ -1127,10 +1508,10 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 - (void)closePElement
 {
     [self generateImpliedEndTagsExceptForTagsNamed:@"p"];
-    if (![self.currentNode.tagName isEqualToString:@"p"]) {
+    if (!TagNameIsAnyOf(self.currentNode.tagName, @"p")) {
         [self addParseError:@"Closing 'p' element that isn't current"];
     }
-    while (![self.currentNode.tagName isEqualToString:@"p"]) {
+    while (!TagNameIsAnyOf(self.currentNode.tagName, @"p")) {
         [_stackOfOpenElements removeLastObject];
     }
     [_stackOfOpenElements removeLastObject];
@@ -1190,6 +1571,9 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             }
             if ([node isEqual:formattingElement]) break;
             HTMLElement *clone = [node copy];
+            if (_didCreateElement) {
+                _didCreateElement(clone);
+            }
             [_activeFormattingElements replaceObjectAtIndex:[_activeFormattingElements indexOfObject:node]
                                                  withObject:clone];
             [_stackOfOpenElements replaceObjectAtIndex:[_stackOfOpenElements indexOfObject:node]
@@ -1198,13 +1582,16 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
             if ([lastNode isEqual:furthestBlock]) {
                 bookmark = [_activeFormattingElements indexOfObject:node] + 1;
             }
-            [[node mutableChildren] addObject:lastNode];
+            [node addChild:lastNode];
             lastNode = node;
         }
         [self insertNode:lastNode atAppropriatePlaceWithOverrideTarget:commonAncestor];
         HTMLElement *formattingClone = [formattingElement copy];
-        [[formattingClone mutableChildren] addObjectsFromArray:furthestBlock.children.array];
-        [[furthestBlock mutableChildren] addObject:formattingClone];
+        if (_didCreateElement) {
+            _didCreateElement(formattingClone);
+        }
+        [formattingClone addChildrenOfNode:furthestBlock];
+        [furthestBlock addChild:formattingClone];
         if ([_activeFormattingElements indexOfObject:formattingElement] < bookmark) {
             bookmark--;
         }
@@ -1220,11 +1607,11 @@ typedef NS_ENUM(NSInteger, HTMLInsertionMode)
 static BOOL IsSpecialElement(HTMLElement *element)
 {
     if (element.htmlNamespace == HTMLNamespaceHTML) {
-        return StringIsEqualToAnyOf(element.tagName, @"address", @"applet", @"area", @"article", @"aside", @"base", @"basefont", @"bgsound", @"blockquote", @"body", @"br", @"button", @"caption", @"center", @"col", @"colgroup", @"dd", @"details", @"dir", @"div", @"dl", @"dt", @"embed", @"fieldset", @"figcaption", @"figure", @"footer", @"form", @"frame", @"frameset", @"h1", @"h2", @"h3", @"h4", @"h5", @"h6", @"head", @"header", @"hgroup", @"hr", @"html", @"iframe", @"img", @"input", @"isindex", @"li", @"link", @"listing", @"main", @"marquee", @"menu", @"menuitem", @"meta", @"nav", @"noembed", @"noframes", @"noscript", @"object", @"ol", @"p", @"param", @"plaintext", @"pre", @"script", @"section", @"select", @"source", @"style", @"summary", @"table", @"tbody", @"td", @"template", @"textarea", @"tfoot", @"th", @"thead", @"title", @"tr", @"track", @"ul", @"wbr", @"xmp");
+        return TagNameIsAnyOf(element.tagName, @"address", @"applet", @"area", @"article", @"aside", @"base", @"basefont", @"bgsound", @"blockquote", @"body", @"br", @"button", @"caption", @"center", @"col", @"colgroup", @"dd", @"details", @"dir", @"div", @"dl", @"dt", @"embed", @"fieldset", @"figcaption", @"figure", @"footer", @"form", @"frame", @"frameset", @"h1", @"h2", @"h3", @"h4", @"h5", @"h6", @"head", @"header", @"hgroup", @"hr", @"html", @"iframe", @"img", @"input", @"isindex", @"li", @"link", @"listing", @"main", @"marquee", @"menu", @"menuitem", @"meta", @"nav", @"noembed", @"noframes", @"noscript", @"object", @"ol", @"p", @"param", @"plaintext", @"pre", @"script", @"section", @"select", @"source", @"style", @"summary", @"table", @"tbody", @"td", @"template", @"textarea", @"tfoot", @"th", @"thead", @"title", @"tr", @"track", @"ul", @"wbr", @"xmp");
     } else if (element.htmlNamespace == HTMLNamespaceMathML) {
-        return StringIsEqualToAnyOf(element.tagName, @"mi", @"mo", @"mn", @"ms", @"mtext", @"annotation-xml");
+        return TagNameIsAnyOf(element.tagName, @"mi", @"mo", @"mn", @"ms", @"mtext", @"annotation-xml");
     } else if (element.htmlNamespace == HTMLNamespaceSVG) {
-        return StringIsEqualToAnyOf(element.tagName, @"foreignObject", @"desc", @"title");
+        return TagNameIsAnyOf(element.tagName, @"foreignObject", @"desc", @"title");
     } else {
         return NO;
     }
@@ -1255,7 +1642,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inTableInsertionModeHandleCharacterToken:(HTMLCharacterToken *)token
 {
-    if (StringIsEqualToAnyOf(self.currentNode.tagName, @"table", @"tbody", @"tfoot", @"thead", @"tr")) {
+    if (TagNameIsAnyOf(self.currentNode.tagName, @"table", @"tbody", @"tfoot", @"thead", @"tr")) {
         _pendingTableCharacters = [NSMutableString new];
         [self switchInsertionMode:HTMLInTableTextInsertionMode];
         [self reprocessToken:token];
@@ -1276,43 +1663,43 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inTableInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"caption"]) {
+    if (TagNameIsAnyOf(token.tagName, @"caption")) {
         [self clearStackBackToATableContext];
         [self pushMarkerOnToListOfActiveFormattingElements];
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInCaptionInsertionMode];
-    } else if ([token.tagName isEqualToString:@"colgroup"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"colgroup")) {
         [self clearStackBackToATableContext];
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInColumnGroupInsertionMode];
-    } else if ([token.tagName isEqualToString:@"col"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"col")) {
         [self clearStackBackToATableContext];
         [self insertElementForToken:[[HTMLStartTagToken alloc] initWithTagName:@"colgroup"]];
         [self switchInsertionMode:HTMLInColumnGroupInsertionMode];
         [self reprocessToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"tbody", @"tfoot", @"thead")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"tbody", @"tfoot", @"thead")) {
         [self clearStackBackToATableContext];
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInTableBodyInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"td", @"th", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"td", @"th", @"tr")) {
         [self clearStackBackToATableContext];
         [self insertElementForToken:[[HTMLStartTagToken alloc] initWithTagName:@"tbody"]];
         [self switchInsertionMode:HTMLInTableBodyInsertionMode];
         [self reprocessToken:token];
-    } else if ([token.tagName isEqualToString:@"table"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"table")) {
         [self addParseError:@"'table' start tag in <table>"];
         if (![self elementInTableScopeWithTagName:@"table"]) {
             return;
         }
-        while (![self.currentNode.tagName isEqualToString:@"table"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"table")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
         [self resetInsertionModeAppropriately];
         [self reprocessToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"style", @"script")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"style", @"script")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
-    } else if ([token.tagName isEqualToString:@"input"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"input")) {
         NSString *type = token.attributes[@"type"];
         if (!type || [type caseInsensitiveCompare:@"hidden"] != NSOrderedSame) {
             [self inTableInsertionModeHandleAnythingElse:token];
@@ -1321,7 +1708,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
         [self addParseError:@"Non-hidden 'input' start tag in <table>"];
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
-    } else if ([token.tagName isEqualToString:@"form"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"form")) {
         [self addParseError:@"'form' start tag in <table>"];
         if (_formElementPointer) return;
         HTMLElement *form = [self insertElementForToken:token];
@@ -1334,17 +1721,17 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inTableInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"table"]) {
+    if (TagNameIsAnyOf(token.tagName, @"table")) {
         if (![self elementInTableScopeWithTagName:@"table"]) {
             [self addParseError:@"End tag 'table' for unknown table element in <table>"];
             return;
         }
-        while (![self.currentNode.tagName isEqualToString:@"table"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"table")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
         [self resetInsertionModeAppropriately];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
         [self addParseError:@"End tag '%@' in <table>", token.tagName];
     } else {
         [self inTableInsertionModeHandleAnythingElse:token];
@@ -1366,7 +1753,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)clearStackBackToATableContext
 {
-    while (!StringIsEqualToAnyOf(self.currentNode.tagName, @"table", @"html")) {
+    while (!TagNameIsAnyOf(self.currentNode.tagName, @"table", @"html")) {
         [_stackOfOpenElements removeLastObject];
     }
 }
@@ -1400,24 +1787,24 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inCaptionInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"caption"]) {
+    if (TagNameIsAnyOf(token.tagName, @"caption")) {
         if (![self elementInTableScopeWithTagName:@"caption"]) {
             [self addParseError:@"End tag 'caption' for unknown caption element in <caption>"];
             return;
         }
         [self generateImpliedEndTags];
-        if (![self.currentNode.tagName isEqualToString:@"caption"]) {
+        if (!TagNameIsAnyOf(self.currentNode.tagName, @"caption")) {
             [self addParseError:@"Misnested end tag 'caption' in <caption>"];
         }
-        while (![self.currentNode.tagName isEqualToString:@"caption"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"caption")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
         [self clearActiveFormattingElementsUpToLastMarker];
         [self switchInsertionMode:HTMLInTableInsertionMode];
-    } else if ([token.tagName isEqualToString:@"table"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"table")) {
         [self inCaptionInsertionModeHandleTableCaptionStartTagOrTableEndTagToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"body", @"col", @"colgroup", @"html", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body", @"col", @"colgroup", @"html", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
         [self addParseError:@"End tag '%@' in <caption>", token.tagName];
     } else {
         [self inCaptionInsertionModeHandleAnythingElse:token];
@@ -1426,7 +1813,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inCaptionInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"caption", @"col", @"colgorup", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
+    if (TagNameIsAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
         [self inCaptionInsertionModeHandleTableCaptionStartTagOrTableEndTagToken:token];
     } else {
         [self inCaptionInsertionModeHandleAnythingElse:token];
@@ -1440,7 +1827,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
     if (![self elementInTableScopeWithTagName:@"caption"]) {
         return;
     }
-    while (![self.currentNode.tagName isEqualToString:@"caption"]) {
+    while (!TagNameIsAnyOf(self.currentNode.tagName, @"caption")) {
         [_stackOfOpenElements removeLastObject];
     }
     [_stackOfOpenElements removeLastObject];
@@ -1480,9 +1867,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inColumnGroupInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"col"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"col")) {
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
     } else {
@@ -1492,14 +1879,14 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inColumnGroupInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"colgroup"]) {
-        if (![self.currentNode.tagName isEqualToString:@"colgroup"]) {
+    if (TagNameIsAnyOf(token.tagName, @"colgroup")) {
+        if (!TagNameIsAnyOf(self.currentNode.tagName, @"colgroup")) {
             [self addParseError:@"End tag 'colgroup' for unknown colgroup element in <colgroup>"];
             return;
         }
         [_stackOfOpenElements removeLastObject];
         [self switchInsertionMode:HTMLInTableInsertionMode];
-    } else if ([token.tagName isEqualToString:@"col"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"col")) {
         [self addParseError:@"End tag 'col' in <colgroup>"];
     } else {
         [self inColumnGroupInsertionModeHandleAnythingElse:token];
@@ -1513,7 +1900,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inColumnGroupInsertionModeHandleAnythingElse:(id)token
 {
-    if (![self.currentNode.tagName isEqualToString:@"colgroup"]) {
+    if (!TagNameIsAnyOf(self.currentNode.tagName, @"colgroup")) {
         [self addParseError:@"Unexpected token in <colgroup>"];
         return;
     }
@@ -1526,17 +1913,17 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inTableBodyInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"tr"]) {
+    if (TagNameIsAnyOf(token.tagName, @"tr")) {
         [self clearStackBackToATableBodyContext];
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInRowInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"th", @"td")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"th", @"td")) {
         [self addParseError:@"Start tag '%@' in <table> body", token.tagName];
         [self clearStackBackToATableBodyContext];
         [self insertElementForToken:[[HTMLStartTagToken alloc] initWithTagName:@"tr"]];
         [self switchInsertionMode:HTMLInRowInsertionMode];
         [self reprocessToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"tfoot", @"thead")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"tfoot", @"thead")) {
         [self inTableBodyInsertionModeHandleTableCaptionStartTagOrTableEndTagToken:token];
     } else {
         [self inTableBodyInsertionModeHandleAnythingElse:token];
@@ -1545,7 +1932,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inTableBodyInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"tbody", @"tfoot", @"thead")) {
+    if (TagNameIsAnyOf(token.tagName, @"tbody", @"tfoot", @"thead")) {
         if (![self elementInTableScopeWithTagName:token.tagName]) {
             [self addParseError:@"End tag '%@' for unknown element in <table> body", token.tagName];
             return;
@@ -1553,9 +1940,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
         [self clearStackBackToATableBodyContext];
         [_stackOfOpenElements removeLastObject];
         [self switchInsertionMode:HTMLInTableInsertionMode];
-    } else if ([token.tagName isEqualToString:@"table"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"table")) {
         [self inTableBodyInsertionModeHandleTableCaptionStartTagOrTableEndTagToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html", @"td", @"th", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html", @"td", @"th", @"tr")) {
         [self addParseError:@"End tag '%@' in <table> body", token.tagName];
     } else {
         [self inTableBodyInsertionModeHandleAnythingElse:token];
@@ -1582,7 +1969,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)clearStackBackToATableBodyContext
 {
-    while (!StringIsEqualToAnyOf(self.currentNode.tagName, @"tbody", @"tfoot", @"thead", @"html")) {
+    while (!TagNameIsAnyOf(self.currentNode.tagName, @"tbody", @"tfoot", @"thead", @"html")) {
         [_stackOfOpenElements removeLastObject];
     }
 }
@@ -1591,12 +1978,12 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inRowInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"th", @"td")) {
+    if (TagNameIsAnyOf(token.tagName, @"th", @"td")) {
         [self clearStackBackToATableRowContext];
         [self insertElementForToken:token];
         [self switchInsertionMode:HTMLInCellInsertionMode];
         [self pushMarkerOnToListOfActiveFormattingElements];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"tfoot", @"thead", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"tfoot", @"thead", @"tr")) {
         [self inRowInsertionModeHandleTableCaptionStartTagOrTableEndTagToken:token];
     } else {
         [self inRowInsertionModeHandleAnythingElse:token];
@@ -1605,7 +1992,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inRowInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"tr"]) {
+    if (TagNameIsAnyOf(token.tagName, @"tr")) {
         if (![self elementInTableScopeWithTagName:@"tr"]) {
             [self addParseError:@"End tag 'tr' for unknown element in <tr>"];
             return;
@@ -1613,9 +2000,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
         [self clearStackBackToATableRowContext];
         [_stackOfOpenElements removeLastObject];
         [self switchInsertionMode:HTMLInTableBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"table"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"table")) {
         [self inRowInsertionModeHandleTableCaptionStartTagOrTableEndTagToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"tbody", @"tfoot", @"thead")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"tbody", @"tfoot", @"thead")) {
         if (![self elementInTableScopeWithTagName:token.tagName]) {
             [self addParseError:@"End tag '%@' for unknown element in <tr>", token.tagName];
             return;
@@ -1627,7 +2014,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
         [_stackOfOpenElements removeLastObject];
         [self switchInsertionMode:HTMLInTableBodyInsertionMode];
         [self reprocessToken:token];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html", @"td", @"th")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html", @"td", @"th")) {
         [self addParseError:@"End tag '%@' in <tr>", token.tagName];
     } else {
         [self inRowInsertionModeHandleAnythingElse:token];
@@ -1654,7 +2041,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)clearStackBackToATableRowContext
 {
-    while (!StringIsEqualToAnyOf(self.currentNode.tagName, @"tr", @"html")) {
+    while (!TagNameIsAnyOf(self.currentNode.tagName, @"tr", @"html")) {
         [_stackOfOpenElements removeLastObject];
     }
 }
@@ -1663,7 +2050,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inCellInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
+    if (TagNameIsAnyOf(token.tagName, @"caption", @"col", @"colgroup", @"tbody", @"td", @"tfoot", @"th", @"thead", @"tr")) {
         if (![self elementInTableScopeWithTagNameInArray:@[ @"td", @"th" ]]) {
             [self addParseError:@"Start tag '%@' outside cell in cell", token.tagName];
             return;
@@ -1677,7 +2064,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inCellInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"td", @"th")) {
+    if (TagNameIsAnyOf(token.tagName, @"td", @"th")) {
         if (![self elementInTableScopeWithTagName:token.tagName]) {
             [self addParseError:@"End tag '%@' outside cell in cell", token.tagName];
             return;
@@ -1692,9 +2079,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
         [_stackOfOpenElements removeLastObject];
         [self clearActiveFormattingElementsUpToLastMarker];
         [self switchInsertionMode:HTMLInRowInsertionMode];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"body", @"caption", @"col", @"colgroup", @"html")) {
         [self addParseError:@"End tag '%@' in cell", token.tagName];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"table", @"tbody", @"tfoot", @"thead", @"tr")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"table", @"tbody", @"tfoot", @"thead", @"tr")) {
         if (![self elementInTableScopeWithTagName:token.tagName]) {
             [self addParseError:@"End tag '%@' for unknown element in cell", token.tagName];
             return;
@@ -1714,10 +2101,10 @@ static BOOL IsSpecialElement(HTMLElement *element)
 - (void)closeTheCell
 {
     [self generateImpliedEndTags];
-    if (!StringIsEqualToAnyOf(self.currentNode.tagName, @"td", @"th")) {
+    if (!TagNameIsAnyOf(self.currentNode.tagName, @"td", @"th")) {
         [self addParseError:@"Closing misnested cell"];
     }
-    while (!StringIsEqualToAnyOf(self.currentNode.tagName, @"td", @"th")) {
+    while (!TagNameIsAnyOf(self.currentNode.tagName, @"td", @"th")) {
         [_stackOfOpenElements removeLastObject];
     }
     [_stackOfOpenElements removeLastObject];
@@ -1751,40 +2138,40 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inSelectInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"option"]) {
-        if ([self.currentNode.tagName isEqualToString:@"option"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"option")) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"option")) {
             [_stackOfOpenElements removeLastObject];
         }
         [self insertElementForToken:token];
-    } else if ([token.tagName isEqualToString:@"optgroup"]) {
-        if ([self.currentNode.tagName isEqualToString:@"option"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"optgroup")) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"option")) {
             [_stackOfOpenElements removeLastObject];
         }
-        if ([self.currentNode.tagName isEqualToString:@"optgroup"]) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"optgroup")) {
             [_stackOfOpenElements removeLastObject];
         }
         [self insertElementForToken:token];
-    } else if ([token.tagName isEqualToString:@"select"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"select")) {
         [self addParseError:@"Nested start tag 'select' in <select>"];
-        while (![self.currentNode.tagName isEqualToString:@"select"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"select")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
         [self resetInsertionModeAppropriately];
-    } else if (StringIsEqualToAnyOf(token.tagName, @"input", @"keygen", @"textarea")) {
+    } else if (TagNameIsAnyOf(token.tagName, @"input", @"keygen", @"textarea")) {
         [self addParseError:@"Start tag '%@' in <select>", token.tagName];
         if (![self selectElementInSelectScope]) {
             return;
         }
-        while (![self.currentNode.tagName isEqualToString:@"select"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"select")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
         [self resetInsertionModeAppropriately];
         [self reprocessToken:token];
-    } else if ([token.tagName isEqualToString:@"script"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"script")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
     } else {
         [self inSelectInsertionModeHandleAnythingElse:token];
@@ -1793,33 +2180,33 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inSelectInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"optgroup"]) {
+    if (TagNameIsAnyOf(token.tagName, @"optgroup")) {
         HTMLElement *currentNode = self.currentNode;
         HTMLElement *beforeIt = _stackOfOpenElements[_stackOfOpenElements.count - 2];
-        if ([currentNode.tagName isEqualToString:@"option"] &&
-            [beforeIt.tagName isEqualToString:@"optgroup"])
+        if (TagNameIsAnyOf(currentNode.tagName, @"option") &&
+            TagNameIsAnyOf(beforeIt.tagName, @"optgroup"))
         {
             [_stackOfOpenElements removeLastObject];
         }
-        if ([self.currentNode.tagName isEqualToString:@"optgroup"]) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"optgroup")) {
             [_stackOfOpenElements removeLastObject];
         } else {
             [self addParseError:@"Misnested end tag 'optgroup' in <select>"];
             return;
         }
-    } else if ([token.tagName isEqualToString:@"option"]) {
-        if ([self.currentNode.tagName isEqualToString:@"option"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"option")) {
+        if (TagNameIsAnyOf(self.currentNode.tagName, @"option")) {
             [_stackOfOpenElements removeLastObject];
         } else {
             [self addParseError:@"Misnested end tag 'option' in <select>"];
             return;
         }
-    } else if ([token.tagName isEqualToString:@"select"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"select")) {
         if (![self selectElementInSelectScope]) {
             [self addParseError:@"End tag 'select' for unknown element in <select>"];
             return;
         }
-        while (![self.currentNode.tagName isEqualToString:@"select"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"select")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
@@ -1843,9 +2230,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inSelectInTableInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"caption", @"table", @"tbody", @"tfoot", @"thead", @"tr", @"td", @"th")) {
+    if (TagNameIsAnyOf(token.tagName, @"caption", @"table", @"tbody", @"tfoot", @"thead", @"tr", @"td", @"th")) {
         [self addParseError:@"Start tag '%@' in <select> in <table>", token.tagName];
-        while (![self.currentNode.tagName isEqualToString:@"select"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"select")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
@@ -1858,12 +2245,12 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inSelectInTableInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"caption", @"table", @"tbody", @"tfoot", @"thead", @"tr", @"td", @"th")) {
+    if (TagNameIsAnyOf(token.tagName, @"caption", @"table", @"tbody", @"tfoot", @"thead", @"tr", @"td", @"th")) {
         [self addParseError:@"End tag '%@' in <select> in <table>", token.tagName];
         if (![self elementInTableScopeWithTagName:token.tagName]) {
             return;
         }
-        while (![self.currentNode.tagName isEqualToString:@"select"]) {
+        while (!TagNameIsAnyOf(self.currentNode.tagName, @"select")) {
             [_stackOfOpenElements removeLastObject];
         }
         [_stackOfOpenElements removeLastObject];
@@ -1905,7 +2292,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)afterBodyInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
     } else {
         [self afterBodyInsertionModeHandleAnythingElse:token];
@@ -1914,7 +2301,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)afterBodyInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         if (_fragmentParsingAlgorithm) {
             [self addParseError:@"End tag 'html' parsing fragment after body"];
             return;
@@ -1962,14 +2349,14 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inFramesetInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"frameset"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"frameset")) {
         [self insertElementForToken:token];
-    } else if ([token.tagName isEqualToString:@"frame"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"frame")) {
         [self insertElementForToken:token];
         [_stackOfOpenElements removeLastObject];
-    } else if ([token.tagName isEqualToString:@"noframes"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"noframes")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
     } else {
         [self inFramesetInsertionModeHandleAnythingElse:token];
@@ -1978,15 +2365,15 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inFramesetInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"frameset"]) {
+    if (TagNameIsAnyOf(token.tagName, @"frameset")) {
         if (_stackOfOpenElements.count == 1 &&
-            [self.currentNode.tagName isEqualToString:@"html"])
+            TagNameIsAnyOf(self.currentNode.tagName, @"html"))
         {
             [self addParseError:@"Misnested end tag 'frameset' in <frameset>"];
             return;
         }
         [_stackOfOpenElements removeLastObject];
-        if (!_fragmentParsingAlgorithm && ![self.currentNode.tagName isEqualToString:@"frameset"]) {
+        if (!_fragmentParsingAlgorithm && !TagNameIsAnyOf(self.currentNode.tagName, @"frameset")) {
             [self switchInsertionMode:HTMLAfterFramesetInsertionMode];
         }
     } else {
@@ -1996,7 +2383,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)inFramesetInsertionModeHandleEOFToken:(HTMLEOFToken *)token
 {
-    if (!([self.currentNode.tagName isEqualToString:@"html"] &&
+    if (!(TagNameIsAnyOf(self.currentNode.tagName, @"html") &&
         _stackOfOpenElements.count == 1))
     {
         [self addParseError:@"Unexpected EOF in <frameset>"];
@@ -2034,9 +2421,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)afterFramesetInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"noframes"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"noframes")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
     } else {
         [self afterFramesetInsertionModeHandleAnythingElse:token];
@@ -2045,7 +2432,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)afterFramesetInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self switchInsertionMode:HTMLAfterAfterFramesetInsertionMode];
     } else {
         [self afterFramesetInsertionModeHandleAnythingElse:token];
@@ -2088,7 +2475,7 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)afterAfterBodyInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
     } else {
         [self afterAfterBodyInsertionModeHandleAnythingElse:token];
@@ -2133,9 +2520,9 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)afterAfterFramesetInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if ([token.tagName isEqualToString:@"html"]) {
+    if (TagNameIsAnyOf(token.tagName, @"html")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInBodyInsertionMode];
-    } else if ([token.tagName isEqualToString:@"noframes"]) {
+    } else if (TagNameIsAnyOf(token.tagName, @"noframes")) {
         [self processToken:token usingRulesForInsertionMode:HTMLInHeadInsertionMode];
     } else {
         [self afterAfterFramesetInsertionModeHandleAnythingElse:token];
@@ -2182,8 +2569,8 @@ static BOOL IsSpecialElement(HTMLElement *element)
 
 - (void)foreignContentInsertionModeHandleStartTagToken:(HTMLStartTagToken *)token
 {
-    if (StringIsEqualToAnyOf(token.tagName, @"b", @"big", @"blockquote", @"body", @"br", @"center", @"code", @"dd", @"div", @"dl",  @"dt", @"em", @"embed", @"h1", @"h2", @"h3", @"h4", @"h5", @"h6", @"head", @"hr", @"i",  @"img", @"li", @"listing", @"menu", @"meta", @"nobr", @"ol", @"p", @"pre", @"ruby", @"s",  @"small", @"span", @"strong", @"strike", @"sub", @"sup", @"table", @"tt", @"u", @"ul",  @"var") ||
-        ([token.tagName isEqualToString:@"font"] && (token.attributes[@"color"] || token.attributes[@"face"] || token.attributes[@"size"]))) {
+    if (TagNameIsAnyOf(token.tagName, @"b", @"big", @"blockquote", @"body", @"br", @"center", @"code", @"dd", @"div", @"dl",  @"dt", @"em", @"embed", @"h1", @"h2", @"h3", @"h4", @"h5", @"h6", @"head", @"hr", @"i",  @"img", @"li", @"listing", @"menu", @"meta", @"nobr", @"ol", @"p", @"pre", @"ruby", @"s",  @"small", @"span", @"strong", @"strike", @"sub", @"sup", @"table", @"tt", @"u", @"ul",  @"var") ||
+        (TagNameIsAnyOf(token.tagName, @"font") && (token.attributes[@"color"] || token.attributes[@"face"] || token.attributes[@"size"]))) {
         [self addParseError:@"Unexpected HTML start tag token in foreign content"];
         if (_fragmentParsingAlgorithm) {
             [self foreignContentInsertionModeHandleAnyOtherStartTagToken:token];
@@ -2347,16 +2734,32 @@ static void AdjustForeignAttributesForToken(HTMLStartTagToken *token)
     // no-op; we really don't care about attribute namespace
 }
 
+// Compares an element's tag name, which might have mixed case (e.g. "foreignObject"), to a tokenizer's already-lowercase tag name without allocating a lowercase copy.
+static BOOL TagNameMatchesLowercaseName(NSString *tagName, NSString *lowercaseName)
+{
+    if (tagName == lowercaseName) return YES;
+    NSUInteger length = tagName.length;
+    if (length != lowercaseName.length) return NO;
+    for (NSUInteger i = 0; i < length; i++) {
+        unichar c = [tagName characterAtIndex:i];
+        if (c >= 'A' && c <= 'Z') {
+            c += 0x20;
+        }
+        if (c != [lowercaseName characterAtIndex:i]) return NO;
+    }
+    return YES;
+}
+
 - (void)foreignContentInsertionModeHandleEndTagToken:(HTMLEndTagToken *)token
 {
     HTMLElement *node = self.currentNode;
-    if (![node.tagName.lowercaseString isEqualToString:token.tagName]) {
+    if (!TagNameMatchesLowercaseName(node.tagName, token.tagName)) {
         [self addParseError:@"Misnested end tag '%@' in foreign content", token.tagName];
     }
     for (;;) {
         NSUInteger nodeIndex = [_stackOfOpenElements indexOfObject:node];
         if (nodeIndex == 0) return;
-        if ([node.tagName.lowercaseString isEqualToString:token.tagName]) {
+        if (TagNameMatchesLowercaseName(node.tagName, token.tagName)) {
             while (![self.currentNode isEqual:node]) {
                 [_stackOfOpenElements removeLastObject];
             }
@@ -2378,7 +2781,7 @@ static void AdjustForeignAttributesForToken(HTMLStartTagToken *token)
         if (node.htmlNamespace == HTMLNamespaceHTML) return YES;
         if (IsMathMLTextIntegrationPoint(node)) {
             if ([token isKindOfClass:[HTMLStartTagToken class]] &&
-                !StringIsEqualToAnyOf([token tagName], @"mglyph", @"malignmark"))
+                !TagNameIsAnyOf([token tagName], @"mglyph", @"malignmark"))
             {
                 return YES;
             }
@@ -2387,9 +2790,9 @@ static void AdjustForeignAttributesForToken(HTMLStartTagToken *token)
             }
         }
         if (node.htmlNamespace == HTMLNamespaceMathML &&
-            [node.tagName isEqualToString:@"annotation-xml"] &&
+            TagNameIsAnyOf(node.tagName, @"annotation-xml") &&
             [token isKindOfClass:[HTMLStartTagToken class]] &&
-            [[token tagName] isEqualToString:@"svg"])
+            TagNameIsAnyOf([token tagName], @"svg"))
         {
             return YES;
         }
@@ -2411,18 +2814,18 @@ static void AdjustForeignAttributesForToken(HTMLStartTagToken *token)
 static BOOL IsMathMLTextIntegrationPoint(HTMLElement *node)
 {
     if (node.htmlNamespace != HTMLNamespaceMathML) return NO;
-    return StringIsEqualToAnyOf(node.tagName, @"mi", @"mo", @"mn", @"ms", @"mtext");
+    return TagNameIsAnyOf(node.tagName, @"mi", @"mo", @"mn", @"ms", @"mtext");
 }
 
 static BOOL IsHTMLIntegrationPoint(HTMLElement *node)
 {
-    if (node.htmlNamespace == HTMLNamespaceMathML && [node.tagName isEqualToString:@"annotation-xml"]) {
+    if (node.htmlNamespace == HTMLNamespaceMathML && TagNameIsAnyOf(node.tagName, @"annotation-xml")) {
         
         // SPEC We're told that "an annotation-xml element in the MathML namespace whose *start tag
         //      token* had an attribute with the name 'encoding'..." (emphasis mine) is an HTML
         //      integration point. Here we're examining the element node's attributes instead. This
         //      seems like a distinction without a difference.
-        NSString *encoding = node.attributes[@"encoding"];
+        NSString *encoding = node[@"encoding"];
         if (encoding) {
             if ([encoding caseInsensitiveCompare:@"text/html"] == NSOrderedSame) {
                 return YES;
@@ -2431,7 +2834,7 @@ static BOOL IsHTMLIntegrationPoint(HTMLElement *node)
             }
         }
     } else if (node.htmlNamespace == HTMLNamespaceSVG) {
-        return StringIsEqualToAnyOf(node.tagName, @"foreignObject", @"desc", @"title");
+        return TagNameIsAnyOf(node.tagName, @"foreignObject", @"desc", @"title");
     }
     return NO;
 }
@@ -2439,7 +2842,7 @@ static BOOL IsHTMLIntegrationPoint(HTMLElement *node)
 - (void)processToken:(id)token usingRulesForInsertionMode:(HTMLInsertionMode)insertionMode
 {
     if ([token isKindOfClass:[HTMLParseErrorToken class]]) {
-        [self addParseError:@"Tokenizer: %@", [token error]];
+        [self addTokenizerError:token];
         return;
     }
     if (_ignoreNextTokenIfLineFeed) {
@@ -2773,6 +3176,11 @@ static BOOL IsHTMLIntegrationPoint(HTMLElement *node)
 
 #pragma mark Stack of open elements
 
+- (NSArray *)stackOfOpenElements
+{
+    return _stackOfOpenElements;
+}
+
 - (HTMLElement *)currentNode
 {
     return _stackOfOpenElements.lastObject;
@@ -2803,31 +3211,27 @@ static BOOL IsHTMLIntegrationPoint(HTMLElement *node)
                            additionalElementTypes:@[ @"button" ]];
 }
 
-- (HTMLElement *)elementInScopeWithTagNameInArray:(NSArray *)tagNames
-                               additionalElementTypes:(NSArray *)additionalElementTypes
+// Returns YES if the element bounds the default scope, or the scope extended by additional HTML element names (e.g. "button" for button scope).
+static BOOL IsScopeBoundary(HTMLElement *node, NSArray *additionalHTMLElements)
 {
-    NSDictionary *elementTypes = ElementTypesForSpecificScope(additionalElementTypes);
-    return [self elementInSpecificScopeWithTagNameInArray:tagNames elementTypes:elementTypes];
-}
-
-static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTMLElements)
-{
-    if (!additionalHTMLElements) additionalHTMLElements = @[];
-    NSArray *html = [@[ @"applet", @"caption", @"html", @"table", @"td", @"th",
-                     @"marquee", @"object" ] arrayByAddingObjectsFromArray:additionalHTMLElements];
-    return @{
-        @(HTMLNamespaceHTML): html,
-        @(HTMLNamespaceMathML): @[ @"mi", @"mo", @"mn", @"ms", @"mtext", @"annotation-xml" ],
-        @(HTMLNamespaceSVG): @[ @"foreignObject", @"desc", @"title" ],
-    };
+    if (node.htmlNamespace == HTMLNamespaceHTML) {
+        return (TagNameIsAnyOf(node.tagName, @"applet", @"caption", @"html", @"table", @"td", @"th", @"marquee", @"object") ||
+                [additionalHTMLElements containsObject:node.tagName]);
+    } else if (node.htmlNamespace == HTMLNamespaceMathML) {
+        return TagNameIsAnyOf(node.tagName, @"mi", @"mo", @"mn", @"ms", @"mtext", @"annotation-xml");
+    } else if (node.htmlNamespace == HTMLNamespaceSVG) {
+        return TagNameIsAnyOf(node.tagName, @"foreignObject", @"desc", @"title");
+    } else {
+        return NO;
+    }
 }
 
-- (HTMLElement *)elementInSpecificScopeWithTagNameInArray:(NSArray *)tagNames
-                                                 elementTypes:(NSDictionary *)elementTypes
+- (HTMLElement *)elementInScopeWithTagNameInArray:(NSArray *)tagNames
+                               additionalElementTypes:(NSArray *)additionalElementTypes
 {
     for (HTMLElement *node in _stackOfOpenElements.reverseObjectEnumerator) {
         if ([tagNames containsObject:node.tagName]) return node;
-        if ([elementTypes[@(node.htmlNamespace)] containsObject:node.tagName]) return nil;
+        if (IsScopeBoundary(node, additionalElementTypes)) return nil;
     }
     return nil;
 }
@@ -2839,8 +3243,11 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 
 - (HTMLElement *)elementInTableScopeWithTagNameInArray:(NSArray *)tagNames
 {
-    NSDictionary *elementTypes = @{ @(HTMLNamespaceHTML): @[ @"html", @"table" ] };
-    return [self elementInSpecificScopeWithTagNameInArray:tagNames elementTypes:elementTypes];
+    for (HTMLElement *node in _stackOfOpenElements.reverseObjectEnumerator) {
+        if ([tagNames containsObject:node.tagName]) return node;
+        if (node.htmlNamespace == HTMLNamespaceHTML && TagNameIsAnyOf(node.tagName, @"html", @"table")) return nil;
+    }
+    return nil;
 }
 
 - (HTMLElement *)elementInListItemScopeWithTagName:(NSString *)tagName
@@ -2852,8 +3259,8 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 - (HTMLElement *)selectElementInSelectScope
 {
     for (HTMLElement *node in _stackOfOpenElements.reverseObjectEnumerator) {
-        if ([node.tagName isEqualToString:@"select"]) return node;
-        if (!(node.htmlNamespace == HTMLNamespaceHTML && StringIsEqualToAnyOf(node.tagName, @"optgroup", @"option"))) {
+        if (TagNameIsAnyOf(node.tagName, @"select")) return node;
+        if (!(node.htmlNamespace == HTMLNamespaceHTML && TagNameIsAnyOf(node.tagName, @"optgroup", @"option"))) {
             return nil;
         }
     }
@@ -2862,10 +3269,9 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 
 - (BOOL)isElementInScope:(HTMLElement *)element
 {
-    NSDictionary *elementTypes = ElementTypesForSpecificScope(nil);
     for (HTMLElement *node in _stackOfOpenElements.reverseObjectEnumerator) {
         if ([node isEqual:element]) return YES;
-        if ([elementTypes[@(node.htmlNamespace)] containsObject:node.tagName]) return NO;
+        if (IsScopeBoundary(node, nil)) return NO;
     }
     return NO;
 }
@@ -2886,7 +3292,7 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
         node = [self appropriatePlaceForInsertingANodeIndex:&index];
     }
     HTMLComment *comment = [[HTMLComment alloc] initWithData:data];
-    [[node mutableChildren] insertObject:comment atIndex:index];
+    [node insertChild:comment atIndex:index];
 }
 
 - (HTMLNode *)appropriatePlaceForInsertingANodeIndex:(out NSUInteger *)index
@@ -2898,10 +3304,10 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
                                                             index:(out NSUInteger *)index
 {
     HTMLElement *target = overrideTarget ?: self.currentNode;
-    if (_fosterParenting && StringIsEqualToAnyOf(target.tagName, @"table", @"tbody", @"tfoot", @"thead", @"tr")) {
+    if (_fosterParenting && TagNameIsAnyOf(target.tagName, @"table", @"tbody", @"tfoot", @"thead", @"tr")) {
         HTMLElement *lastTable;
         for (HTMLElement *element in _stackOfOpenElements.reverseObjectEnumerator) {
-            if ([element.tagName isEqualToString:@"table"]) {
+            if (TagNameIsAnyOf(element.tagName, @"table")) {
                 lastTable = element;
                 break;
             }
@@ -2912,7 +3318,7 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
             return html;
         }
         if (lastTable.parentElement) {
-            *index = [lastTable.parentElement.children indexOfObject:lastTable];
+            *index = [lastTable.parentElement indexOfChild:lastTable];
             return lastTable.parentElement;
         }
         NSUInteger indexOfLastTable = [_stackOfOpenElements indexOfObject:lastTable];
@@ -2942,6 +3348,9 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 {
     HTMLElement *element = [[HTMLElement alloc] initWithTagName:token.tagName attributes:token.attributes];
     element.htmlNamespace = namespace;
+    if (_didCreateElement) {
+        _didCreateElement(element);
+    }
     return element;
 }
 
@@ -2956,7 +3365,7 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 {
     NSUInteger index;
     HTMLNode *adjustedInsertionLocation = [self appropriatePlaceForInsertingANodeIndex:&index];
-    [[adjustedInsertionLocation mutableChildren] insertObject:element atIndex:index];
+    [adjustedInsertionLocation insertChild:element atIndex:index];
     [_stackOfOpenElements addObject:element];
 }
 
@@ -2973,13 +3382,13 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 {
     NSUInteger i;
     HTMLNode *parent = [self appropriatePlaceForInsertingANodeWithOverrideTarget:overrideTarget index:&i];
-    [[parent mutableChildren] insertObject:node atIndex:i];
+    [parent insertChild:node atIndex:i];
 }
 
 - (void)insertForeignElementForToken:(id)token inNamespace:(HTMLNamespace)namespace
 {
     HTMLElement *element = [self createElementForToken:token inNamespace:namespace];
-    [[self.currentNode mutableChildren] addObject:element];
+    [self.currentNode addChild:element];
     [_stackOfOpenElements addObject:element];
 }
 
@@ -2992,13 +3401,13 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
             last = YES;
             node = _context;
         }
-        if ([node.tagName isEqualToString:@"select"]) {
+        if (TagNameIsAnyOf(node.tagName, @"select")) {
             HTMLElement *ancestor = node;
             for (;;) {
                 if (last) break;
                 if ([_stackOfOpenElements[0] isEqual:ancestor]) break;
                 ancestor = _stackOfOpenElements[[_stackOfOpenElements indexOfObject:ancestor] - 1];
-                if ([ancestor.tagName isEqualToString:@"table"]) {
+                if (TagNameIsAnyOf(ancestor.tagName, @"table")) {
                     [self switchInsertionMode:HTMLInSelectInTableInsertionMode];
                     return;
                 }
@@ -3006,43 +3415,43 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
             [self switchInsertionMode:HTMLInSelectInsertionMode];
             return;
         }
-        if (!last && StringIsEqualToAnyOf(node.tagName, @"td", @"th")) {
+        if (!last && TagNameIsAnyOf(node.tagName, @"td", @"th")) {
             [self switchInsertionMode:HTMLInCellInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"tr"]) {
+        if (TagNameIsAnyOf(node.tagName, @"tr")) {
             [self switchInsertionMode:HTMLInRowInsertionMode];
             return;
         }
-        if (StringIsEqualToAnyOf(node.tagName, @"tbody", @"thead", @"tfoot")) {
+        if (TagNameIsAnyOf(node.tagName, @"tbody", @"thead", @"tfoot")) {
             [self switchInsertionMode:HTMLInTableBodyInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"caption"]) {
+        if (TagNameIsAnyOf(node.tagName, @"caption")) {
             [self switchInsertionMode:HTMLInCaptionInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"colgroup"]) {
+        if (TagNameIsAnyOf(node.tagName, @"colgroup")) {
             [self switchInsertionMode:HTMLInColumnGroupInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"table"]) {
+        if (TagNameIsAnyOf(node.tagName, @"table")) {
             [self switchInsertionMode:HTMLInTableInsertionMode];
             return;
         }
-        if (!last && [node.tagName isEqualToString:@"head"]) {
+        if (!last && TagNameIsAnyOf(node.tagName, @"head")) {
             [self switchInsertionMode:HTMLInHeadInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"body"]) {
+        if (TagNameIsAnyOf(node.tagName, @"body")) {
             [self switchInsertionMode:HTMLInBodyInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"frameset"]) {
+        if (TagNameIsAnyOf(node.tagName, @"frameset")) {
             [self switchInsertionMode:HTMLInFramesetInsertionMode];
             return;
         }
-        if ([node.tagName isEqualToString:@"html"]) {
+        if (TagNameIsAnyOf(node.tagName, @"html")) {
             [self switchInsertionMode:HTMLBeforeHeadInsertionMode];
             return;
         }
@@ -3056,13 +3465,24 @@ static inline NSDictionary * ElementTypesForSpecificScope(NSArray *additionalHTM
 
 #pragma mark List of active formatting elements
 
+static BOOL AttributesAreEqual(HTMLElement *element, HTMLElement *other)
+{
+    const HTMLAttributeStorage *attributes = HTMLElementAttributeStorage(element);
+    const HTMLAttributeStorage *otherAttributes = HTMLElementAttributeStorage(other);
+    if (attributes && otherAttributes) {
+        return HTMLAttributeStorageEqual(attributes, otherAttributes);
+    } else {
+        return [element.attributes isEqual:other.attributes];
+    }
+}
+
 - (void)pushElementOnToListOfActiveFormattingElements:(HTMLElement *)element
 {
     NSInteger alreadyPresent = 0;
     for (HTMLElement *node in _activeFormattingElements.reverseObjectEnumerator.allObjects) {
         if ([node isEqual:[HTMLMarker marker]]) break;
         if (![node.tagName isEqualToString:element.tagName]) continue;
-        if (![node.attributes isEqual:element.attributes]) continue;
+        if (!AttributesAreEqual(node, element)) continue;
         alreadyPresent += 1;
         if (alreadyPresent == 3) {
             [_activeFormattingElements removeObject:node];
@@ -3101,7 +3521,10 @@ advance:
 create:;
     HTMLElement *entry = _activeFormattingElements[entryIndex];
     HTMLStartTagToken *token = [[HTMLStartTagToken alloc] initWithTagName:entry.tagName];
-    [token.attributes addEntriesFromDictionary:entry.attributes];
+    HTMLAttributeStorage *attributes = HTMLOrderedDictionaryStorage(token.attributes);
+    HTMLElementEnumerateAttributes(entry, ^(NSString *name, NSString *value, BOOL *stop) {
+        HTMLAttributeStorageAdd(attributes, name, value);
+    });
     HTMLElement *newElement = [self insertElementForToken:token];
     [_activeFormattingElements replaceObjectAtIndex:entryIndex withObject:newElement];
     if (entryIndex + 1 != _activeFormattingElements.count) {
@@ -3156,12 +3579,28 @@ create:;
 
 #pragma mark Parse errors
 
+// The reason isn't formatted unless it's going to be kept, so most callers can pass whatever arguments they like.
 - (void)addParseError:(NSString *)errorString, ... NS_FORMAT_FUNCTION(1, 2)
 {
+    if (_errorReporting == HTMLParseErrorReportingOff) return;
+    _numberOfErrors++;
+    if (_errorReporting == HTMLParseErrorReportingCount) return;
+    
     va_list args;
     va_start(args, errorString);
-    [_errors addObject:[[NSString alloc] initWithFormat:errorString arguments:args]];
+    NSString *reason = [[NSString alloc] initWithFormat:errorString arguments:args];
     va_end(args);
+    NSUInteger line, column;
+    [_tokenizer getLine:&line column:&column];
+    [_errors addObject:[[HTMLParseError alloc] initWithReason:reason line:line column:column]];
+}
+
+- (void)addTokenizerError:(HTMLParseErrorToken *)token
+{
+    if (_errorReporting != HTMLParseErrorReportingFull) return;
+    _numberOfErrors++;
+    NSString *reason = [@"Tokenizer: " stringByAppendingString:token.error ?: @""];
+    [_errors addObject:[[HTMLParseError alloc] initWithReason:reason line:token.line column:token.column]];
 }
 
 @end
@@ -3212,14 +3651,19 @@ static HTMLMarker *instance = nil;
 @end
 
 HTMLParser * ParserWithDataAndContentType(NSData *data, NSString *contentType)
+{
+    return ParserWithDataContentTypeAndErrorReporting(data, contentType, HTMLParseErrorReportingFull);
+}
+
+HTMLParser * ParserWithDataContentTypeAndErrorReporting(NSData *data, NSString *contentType, HTMLParseErrorReporting errorReporting)
 {
     HTMLStringEncoding initialEncoding = DeterminedStringEncodingForData(data, contentType);
-    NSString *initialString = [[NSString alloc] initWithData:data encoding:initialEncoding.encoding];
-    HTMLParser *initialParser = [[HTMLParser alloc] initWithString:initialString encoding:initialEncoding context:nil];
+    HTMLParser *initialParser = [[HTMLParser alloc] initWithData:data encoding:initialEncoding context:nil];
+    initialParser.errorReporting = errorReporting;
     __block HTMLParser *parser = initialParser;
     initialParser.changeEncoding = ^(HTMLStringEncoding newEncoding) {
-        NSString *correctedString = [[NSString alloc] initWithData:data encoding:newEncoding.encoding];
-        parser = [[HTMLParser alloc] initWithString:correctedString encoding:newEncoding context:nil];
+        parser = [[HTMLParser alloc] initWithData:data encoding:newEncoding context:nil];
+        parser.errorReporting = errorReporting;
     };
     [initialParser document];
     return parser;
@@ -18,9 +18,57 @@
 /// Initializes a stream.
 - (instancetype)initWithString:(NSString *)string NS_DESIGNATED_INITIALIZER;
 
-/// The string backing an input stream.
+/**
+    Initializes a stream that reads UTF-8 straight from some bytes, skipping any byte order mark. Only the characters that get consumed into strings are ever decoded, and malformed sequences become U+FFFD REPLACEMENT CHARACTER.
+ */
+- (instancetype)initWithUTF8Data:(NSData *)data NS_DESIGNATED_INITIALIZER;
+
+/// The string backing an input stream. For streams initialized with UTF-8 data, the string is decoded on each call.
 @property (readonly, copy, nonatomic) NSString *string;
 
+/**
+    Adds characters to the end of the stream.
+ 
+    Only streams that are open should have characters appended.
+ */
+- (void)appendString:(NSString *)string;
+
+/**
+    Adds UTF-8 encoded characters to the end of the stream. The data may end partway through a character.
+ 
+    Only streams that are open should have characters appended.
+ */
+- (void)appendUTF8Data:(NSData *)data;
+
+/**
+    YES if more characters may be appended to the stream, or NO if the stream's string is complete. The default is NO.
+ 
+    An open stream does not treat the end of its characters as the end of the input. Instead, any attempt to look at characters that have yet to be appended sets starved to YES.
+ */
+@property (assign, nonatomic, getter=isOpen) BOOL open;
+
+/// YES if, since last set to NO, the stream was asked about characters that have not yet been appended.
+@property (assign, nonatomic, getter=isStarved) BOOL starved;
+
+/// YES if the stream is open and every character appended so far has been consumed.
+@property (readonly, assign, nonatomic) BOOL awaitingInput;
+
+/// Remembers the stream's current position, to be restored later by -rewindToMark.
+- (void)mark;
+
+/// Restores the stream to the position saved by the most recent call to -mark.
+- (void)rewindToMark;
+
+/**
+    Notes that the input consumed so far cannot make progress until a particular ASCII character is appended, such as the closing quote of an attribute value or the > that ends a tag or comment.
+ 
+    Only characters appended after this call are searched, so a long construct arriving in many small pieces costs one scan of each piece rather than one scan of everything so far.
+ */
+- (void)awaitCharacter:(char)character;
+
+/// NO if a character passed to -awaitCharacter: has yet to be appended, otherwise YES.
+@property (readonly, assign, nonatomic) BOOL awaitedCharacterHasArrived;
+
 /**
     Consumes matching input characters.
  
@@ -40,6 +88,15 @@
  */
 - (NSString *)consumeCharactersUpToFirstPassingTest:(BOOL(^)(UTF32Char character))test;
 
+/**
+    Continually consumes characters until a certain character is encountered, skipping quickly over runs of plain text.
+ 
+    @param predicate A block that is called with each consumed character that isn't plain text, i.e. with anything other than printable ASCII (excluding '<' and '&'), tab, and line feed. When the block returns YES, character consumption stops.
+ 
+    @return A string of the characters consumed, or nil if the stream is fully consumed before the block returns YES.
+ */
+- (NSString *)consumeTextUpToFirstPassingTest:(BOOL(^)(UTF32Char character))test;
+
 /**
     Consumes characters matching hexadecimal digits.
  
@@ -62,16 +119,17 @@
 @property (readonly, assign, nonatomic) UTF32Char nextInputCharacter;
 
 /**
-    Returns a string of characters from the stream's current position. The characters are not preprocessed for carriage returns, and no parse errors are emitted.
+    Consumes the longest named character reference at the stream's current position. No parse errors are emitted.
  
-    @param length The maximum length of the returned string.
+    @param nameLength On return, the number of characters in the reference's name.
+    @param semicolon On return, YES if the reference's name ends with a semicolon.
  
-    @return A string, or nil if the stream has no characters remaining.
+    @return The reference's replacement, or nil if no named character reference starts here (in which case nothing is consumed).
  */
-- (NSString *)nextUnprocessedCharactersWithMaximumLength:(NSUInteger)length;
+- (NSString *)consumeNamedCharacterReferenceWithNameLength:(out NSUInteger *)nameLength semicolon:(out BOOL *)semicolon;
 
-/// Returns a scanner for the stream's unprocessed characters whose scan location is set to the stream's current location.
-- (NSScanner *)unprocessedScanner;
+/// Returns YES if, starting at the stream's current position, there are one or more ASCII alphanumeric characters followed by a semicolon. Nothing is consumed and no parse errors are emitted.
+- (BOOL)nextCharactersAreAlphanumericFollowedBySemicolon;
 
 /// Returns the next input character and moves scanLocation ahead, emitting parse errors as appropriate. If a stream is fully consumed, returns EOF.
 - (UTF32Char)consumeNextInputCharacter;
@@ -79,9 +137,16 @@
 /// Set the next input character to the current input character. This method is idempotent.
 - (void)reconsumeCurrentInputCharacter;
 
-/// Rewinds the stream.
+/// Rewinds the stream. Only suitable for unconsuming ASCII characters.
 - (void)unconsumeInputCharacters:(NSUInteger)numberOfCharactersToUnconsume;
 
+/**
+    Gets the position of the most recently consumed character, counting lines and columns from 1. A carriage return, a line feed, or the two together end a line.
+ 
+    Positions are worked out on demand from wherever the previous call left off, so asking after every parse error costs about one extra pass over the input.
+ */
+- (void)getLine:(out NSUInteger *)line column:(out NSUInteger *)column;
+
 /**
     A block called whenever a parse error occurs. The block has no return value and takes as parameters:
  
@@ -3,8 +3,15 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLPreprocessedInputStream.h"
+#import "HTMLEntities.h"
 #import "HTMLString.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 // http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
 @interface HTMLPreprocessedInputStream ()
 - (instancetype)init NS_DESIGNATED_INITIALIZER;
@@ -12,10 +19,32 @@
 
 @implementation HTMLPreprocessedInputStream
 {
-    NSUInteger _scanLocation;
+    // UTF-16 streams keep their characters in a string, while UTF-8 streams keep their bytes in data. Locations and lengths count code units of whichever encoding is in use.
+    BOOL _UTF8;
+    NSString *_characters;
+    NSMutableString *_appendedCharacters;
     CFStringInlineBuffer _buffer;
+    const UniChar *_unichars;
+    NSData *_data;
+    NSMutableData *_appendedData;
+    const uint8_t *_bytes;
+    
+    NSUInteger _length;
+    NSUInteger _scanLocation;
     BOOL _reconsume;
     UTF32Char _currentInputCharacter;
+    NSUInteger _markedScanLocation;
+    BOOL _markedReconsume;
+    UTF32Char _markedCurrentInputCharacter;
+    
+    // Set by -awaitCharacter:, along with how far the search for that character has got.
+    char _awaitedCharacter;
+    NSUInteger _awaitedSearchLocation;
+    
+    // Where -getLine:column: got to last time, so it needn't start over from the beginning.
+    NSUInteger _positionLocation;
+    NSUInteger _positionLine;
+    NSUInteger _positionColumn;
 }
 
 // http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
@@ -24,79 +53,475 @@
 - (instancetype)initWithString:(NSString *)string
 {
     if ((self = [super init])) {
-        _string = [string copy];
-        CFStringInitInlineBuffer((__bridge CFStringRef)_string, &_buffer, CFRangeMake(0, _string.length));
+        _characters = [string copy] ?: @"";
+        _length = _characters.length;
+        CFStringInitInlineBuffer((__bridge CFStringRef)_characters, &_buffer, CFRangeMake(0, _length));
+        _unichars = CFStringGetCharactersPtr((__bridge CFStringRef)_characters);
+    }
+    return self;
+}
+
+- (instancetype)initWithUTF8Data:(NSData *)data
+{
+    if ((self = [super init])) {
+        _UTF8 = YES;
+        _data = [data copy] ?: [NSData new];
+        _length = _data.length;
+        _bytes = _data.bytes;
+        
+        // Byte order mark.
+        if (_length >= 3 && _bytes[0] == 0xEF && _bytes[1] == 0xBB && _bytes[2] == 0xBF) {
+            _scanLocation = 3;
+        }
     }
     return self;
 }
 
+- (NSString *)string
+{
+    if (_UTF8) {
+        return [[NSString alloc] initWithBytes:_bytes length:_length encoding:NSUTF8StringEncoding];
+    } else {
+        return [_characters copy];
+    }
+}
+
+- (void)appendString:(NSString *)string
+{
+    if (string.length == 0) return;
+    if (_UTF8) {
+        [self appendUTF8Data:[string dataUsingEncoding:NSUTF8StringEncoding]];
+        return;
+    }
+    if (!_appendedCharacters) {
+        _appendedCharacters = [_characters mutableCopy];
+        _characters = _appendedCharacters;
+    }
+    [_appendedCharacters appendString:string];
+    _length = _appendedCharacters.length;
+    
+    // The inline buffer may point directly at the string's old storage, so it needs a fresh start.
+    CFStringInitInlineBuffer((__bridge CFStringRef)_characters, &_buffer, CFRangeMake(0, _length));
+    _unichars = CFStringGetCharactersPtr((__bridge CFStringRef)_characters);
+}
+
+- (void)appendUTF8Data:(NSData *)data
+{
+    if (data.length == 0) return;
+    if (!_UTF8) {
+        [self appendString:[[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]];
+        return;
+    }
+    if (!_appendedData) {
+        _appendedData = [_data mutableCopy];
+        _data = _appendedData;
+    }
+    [_appendedData appendData:data];
+    _length = _appendedData.length;
+    _bytes = _appendedData.bytes;
+    
+    // An appended byte order mark only counts at the very start.
+    if (_scanLocation == 0 && _length >= 3 && _bytes[0] == 0xEF && _bytes[1] == 0xBB && _bytes[2] == 0xBF) {
+        _scanLocation = 3;
+    }
+}
+
+- (BOOL)awaitingInput
+{
+    return _open && !_reconsume && _scanLocation >= _length;
+}
+
+- (void)mark
+{
+    _markedScanLocation = _scanLocation;
+    _markedReconsume = _reconsume;
+    _markedCurrentInputCharacter = _currentInputCharacter;
+}
+
+- (void)rewindToMark
+{
+    _scanLocation = _markedScanLocation;
+    _reconsume = _markedReconsume;
+    _currentInputCharacter = _markedCurrentInputCharacter;
+}
+
+#pragma mark Code units
+
+// Returns the code unit at a location, or 0 if the location is past the end. ASCII characters are a single code unit in both UTF-8 and UTF-16, so this is a quick way to match ASCII.
+static inline UTF32Char CodeUnitAtLocation(HTMLPreprocessedInputStream *self, NSUInteger location)
+{
+    if (location >= self->_length) {
+        return 0;
+    } else if (self->_UTF8) {
+        return self->_bytes[location];
+    } else {
+        return CFStringGetCharacterFromInlineBuffer(&self->_buffer, location);
+    }
+}
+
+static inline UTF32Char ASCIILowercase(UTF32Char c)
+{
+    return c >= 'A' && c <= 'Z' ? c + 32 : c;
+}
+
+static inline BOOL is_ascii_alphanumeric(UTF32Char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+static inline int HexDigitValue(UTF32Char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else {
+        return -1;
+    }
+}
+
+/**
+    Decodes one character's worth of UTF-8 as specified by the WHATWG Encoding Standard.
+ 
+    @param consumed   On return, the number of bytes that make up the character. Malformed sequences are consumed up to the first byte that can't belong to them.
+    @param incomplete On return, YES if the bytes ran out partway through a character.
+ 
+    @return The decoded character, or U+FFFD REPLACEMENT CHARACTER if the sequence is malformed or incomplete.
+ 
+    For more information, see https://encoding.spec.whatwg.org/#utf-8-decoder
+ */
+static UTF32Char DecodeUTF8(const uint8_t *bytes, NSUInteger length, NSUInteger *consumed, BOOL *incomplete)
+{
+    *incomplete = NO;
+    uint8_t lead = bytes[0];
+    if (lead < 0x80) {
+        *consumed = 1;
+        return lead;
+    }
+    
+    NSUInteger needed;
+    UTF32Char c;
+    uint8_t lowerBoundary = 0x80, upperBoundary = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        needed = 1;
+        c = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        if (lead == 0xE0) lowerBoundary = 0xA0;
+        if (lead == 0xED) upperBoundary = 0x9F;
+        needed = 2;
+        c = lead & 0xF;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        if (lead == 0xF0) lowerBoundary = 0x90;
+        if (lead == 0xF4) upperBoundary = 0x8F;
+        needed = 3;
+        c = lead & 0x7;
+    } else {
+        *consumed = 1;
+        return 0xFFFD;
+    }
+    
+    for (NSUInteger i = 1; i <= needed; i++) {
+        if (i >= length) {
+            *consumed = i;
+            *incomplete = YES;
+            return 0xFFFD;
+        }
+        uint8_t byte = bytes[i];
+        if (byte < lowerBoundary || byte > upperBoundary) {
+            *consumed = i;
+            return 0xFFFD;
+        }
+        lowerBoundary = 0x80;
+        upperBoundary = 0xBF;
+        c = (c << 6) | (byte & 0x3F);
+    }
+    *consumed = needed + 1;
+    return c;
+}
+
+// YES if the bytes are U+FFFD REPLACEMENT CHARACTER itself, as opposed to a malformed sequence that decoded to U+FFFD.
+static inline BOOL IsEncodedReplacementCharacter(const uint8_t *bytes, NSUInteger length)
+{
+    return length == 3 && bytes[0] == 0xEF && bytes[1] == 0xBF && bytes[2] == 0xBD;
+}
+
+#pragma mark Plain text
+
+/*
+    Plain text needs no preprocessing, is never a parse error, and never stops the tokenizer in any of its character data states. That's printable ASCII other than '<' and '&', along with tab and line feed. Everything else goes through the usual character-at-a-time path, which is plenty fast when it's only occasional.
+ 
+    Looking for the end of a run of plain text is most of the tokenizer's work on text-heavy documents, so we look at 16 bytes at a time where the vector instructions are part of the baseline architecture (SSE2 on x86-64, NEON on arm64).
+ */
+static inline BOOL IsPlainText(UTF32Char c)
+{
+    return (c >= 0x20 && c < 0x7F && c != '<' && c != '&') || c == '\t' || c == '\n';
+}
+
+// Returns the number of plain text bytes at the start of some UTF-8.
+static NSUInteger PlainUTF8Length(const uint8_t *bytes, NSUInteger length)
+{
+    NSUInteger i = 0;
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(0x20), deleteCharacter = _mm_set1_epi8(0x7F), lessThan = _mm_set1_epi8('<'), ampersand = _mm_set1_epi8('&'), tab = _mm_set1_epi8('\t'), lineFeed = _mm_set1_epi8('\n');
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(bytes + i));
+        
+        // The comparison is signed, so non-ASCII bytes count as less than a space.
+        __m128i stop = _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, deleteCharacter));
+        stop = _mm_or_si128(stop, _mm_or_si128(_mm_cmpeq_epi8(v, lessThan), _mm_cmpeq_epi8(v, ampersand)));
+        stop = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi8(v, tab), _mm_cmpeq_epi8(v, lineFeed)), stop);
+        int mask = _mm_movemask_epi8(stop);
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t space = vdupq_n_u8(0x20), deleteCharacter = vdupq_n_u8(0x7F), lessThan = vdupq_n_u8('<'), ampersand = vdupq_n_u8('&'), tab = vdupq_n_u8('\t'), lineFeed = vdupq_n_u8('\n');
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(bytes + i);
+        uint8x16_t stop = vorrq_u8(vcltq_u8(v, space), vcgeq_u8(v, deleteCharacter));
+        stop = vorrq_u8(stop, vorrq_u8(vceqq_u8(v, lessThan), vceqq_u8(v, ampersand)));
+        stop = vbicq_u8(stop, vorrq_u8(vceqq_u8(v, tab), vceqq_u8(v, lineFeed)));
+        
+        // NEON has no cheap way to find the first set lane, so let the scalar loop pin it down.
+        if (vmaxvq_u8(stop)) break;
+    }
+#endif
+    while (i < length && IsPlainText(bytes[i])) {
+        i++;
+    }
+    return i;
+}
+
+// Returns the number of plain text code units at the start of some UTF-16.
+static NSUInteger PlainUTF16Length(const UniChar *units, NSUInteger length)
+{
+    NSUInteger i = 0;
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi16(0x20), tilde = _mm_set1_epi16('~'), lessThan = _mm_set1_epi16('<'), ampersand = _mm_set1_epi16('&'), tab = _mm_set1_epi16('\t'), lineFeed = _mm_set1_epi16('\n');
+    for (; i + 8 <= length; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(units + i));
+        
+        // The comparisons are signed, so code units from U+8000 up count as less than a space.
+        __m128i stop = _mm_or_si128(_mm_cmplt_epi16(v, space), _mm_cmpgt_epi16(v, tilde));
+        stop = _mm_or_si128(stop, _mm_or_si128(_mm_cmpeq_epi16(v, lessThan), _mm_cmpeq_epi16(v, ampersand)));
+        stop = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi16(v, tab), _mm_cmpeq_epi16(v, lineFeed)), stop);
+        int mask = _mm_movemask_epi8(stop);
+        if (mask) {
+            return i + __builtin_ctz(mask) / 2;
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint16x8_t space = vdupq_n_u16(0x20), tilde = vdupq_n_u16('~'), lessThan = vdupq_n_u16('<'), ampersand = vdupq_n_u16('&'), tab = vdupq_n_u16('\t'), lineFeed = vdupq_n_u16('\n');
+    for (; i + 8 <= length; i += 8) {
+        uint16x8_t v = vld1q_u16(units + i);
+        uint16x8_t stop = vorrq_u16(vcltq_u16(v, space), vcgtq_u16(v, tilde));
+        stop = vorrq_u16(stop, vorrq_u16(vceqq_u16(v, lessThan), vceqq_u16(v, ampersand)));
+        stop = vbicq_u16(stop, vorrq_u16(vceqq_u16(v, tab), vceqq_u16(v, lineFeed)));
+        if (vmaxvq_u16(stop)) break;
+    }
+#endif
+    while (i < length && IsPlainText(units[i])) {
+        i++;
+    }
+    return i;
+}
+
+// Returns the number of plain text code units starting at a location.
+static NSUInteger PlainTextLength(HTMLPreprocessedInputStream *self, NSUInteger location)
+{
+    if (location >= self->_length) {
+        return 0;
+    } else if (self->_UTF8) {
+        return PlainUTF8Length(self->_bytes + location, self->_length - location);
+    } else if (self->_unichars) {
+        return PlainUTF16Length(self->_unichars + location, self->_length - location);
+    }
+    
+    // Strings that don't keep their characters as contiguous UTF-16 get copied out a chunk at a time.
+    UniChar chunk[256];
+    NSUInteger total = 0;
+    while (location + total < self->_length) {
+        NSUInteger chunkLength = MIN(sizeof(chunk) / sizeof(chunk[0]), self->_length - location - total);
+        CFStringGetCharacters((__bridge CFStringRef)self->_characters, CFRangeMake(location + total, chunkLength), chunk);
+        NSUInteger plainLength = PlainUTF16Length(chunk, chunkLength);
+        total += plainLength;
+        if (plainLength < chunkLength) break;
+    }
+    return total;
+}
+
+#pragma mark Awaiting input
+
+- (void)awaitCharacter:(char)character
+{
+    _awaitedCharacter = character;
+    _awaitedSearchLocation = _length;
+}
+
+- (BOOL)awaitedCharacterHasArrived
+{
+    if (_awaitedCharacter == 0) return YES;
+    for (; _awaitedSearchLocation < _length; _awaitedSearchLocation++) {
+        if (CodeUnitAtLocation(self, _awaitedSearchLocation) == (UTF32Char)_awaitedCharacter) {
+            _awaitedCharacter = 0;
+            return YES;
+        }
+    }
+    return NO;
+}
+
+#pragma mark Consuming
+
 - (BOOL)consumeString:(NSString *)string matchingCase:(BOOL)caseSensitive
 {
-    NSScanner *scanner = [self unprocessedScanner];
-    scanner.caseSensitive = caseSensitive;
-    BOOL ok = [scanner scanString:string intoString:nil];
-    if (ok) {
-        _scanLocation = scanner.scanLocation;
+    // Only ever called with ASCII strings, so we can compare code units.
+    NSUInteger length = string.length;
+    if (_length - _scanLocation < length) {
+        if (_open) {
+            _starved = YES;
+        }
+        return NO;
     }
-    return ok;
+    for (NSUInteger i = 0; i < length; i++) {
+        UTF32Char expected = [string characterAtIndex:i];
+        UTF32Char actual = CodeUnitAtLocation(self, _scanLocation + i);
+        if (!caseSensitive) {
+            expected = ASCIILowercase(expected);
+            actual = ASCIILowercase(actual);
+        }
+        if (expected != actual) {
+            return NO;
+        }
+    }
+    _scanLocation += length;
+    return YES;
 }
 
 - (NSString *)consumeCharactersUpToFirstPassingTest:(BOOL(^)(UTF32Char character))test
 {
-    NSMutableString *consumed = [NSMutableString new];
+    return [self consumeCharactersUpToFirstPassingTest:test skippingPlainText:NO];
+}
+
+- (NSString *)consumeTextUpToFirstPassingTest:(BOOL(^)(UTF32Char character))test
+{
+    return [self consumeCharactersUpToFirstPassingTest:test skippingPlainText:YES];
+}
+
+// Most runs of characters can be copied in one go, straight from the underlying string or bytes. Only when preprocessing changes something (i.e. a carriage return or a malformed UTF-8 sequence) do we need to build up the string one character at a time.
+- (NSString *)consumeCharactersUpToFirstPassingTest:(BOOL(^)(UTF32Char character))test skippingPlainText:(BOOL)skipPlainText
+{
+    NSString *reconsumed;
+    if (_reconsume) {
+        UTF32Char c = [self consumeNextInputCharacter];
+        if (c == (UTF32Char)EOF) return nil;
+        if (test(c)) {
+            [self reconsumeCurrentInputCharacter];
+            return nil;
+        }
+        reconsumed = StringWithLongCharacter(c);
+    }
+    NSMutableString *consumed;
+    NSUInteger runStart = _scanLocation;
+    NSUInteger end = runStart;
     for (;;) {
+        if (skipPlainText) {
+            _scanLocation += PlainTextLength(self, _scanLocation);
+            end = _scanLocation;
+        }
+        if (self.awaitingInput) break;
+        NSUInteger location = _scanLocation;
         UTF32Char c = [self consumeNextInputCharacter];
         if (c == (UTF32Char)EOF) break;
         if (test(c)) {
             [self reconsumeCurrentInputCharacter];
             break;
         }
-        AppendLongCharacter(consumed, c);
+        if (CodeUnitAtLocation(self, location) == '\r' || (_UTF8 && c == 0xFFFD && !IsEncodedReplacementCharacter(_bytes + location, _scanLocation - location))) {
+            if (!consumed) {
+                consumed = [NSMutableString new];
+            }
+            [consumed appendString:[self codeUnitsAsStringInRange:NSMakeRange(runStart, location - runStart)]];
+            AppendLongCharacter(consumed, c);
+            runStart = _scanLocation;
+        }
+        end = _scanLocation;
     }
-    if (consumed.length > 0) {
-        return consumed;
+    NSString *run = [self codeUnitsAsStringInRange:NSMakeRange(runStart, end - runStart)];
+    if (consumed) {
+        [consumed appendString:run];
+        run = consumed;
+    }
+    if (reconsumed) {
+        run = [reconsumed stringByAppendingString:run];
+    }
+    return run.length > 0 ? run : nil;
+}
+
+// Only call with ranges that hold whole, well-formed characters.
+- (NSString *)codeUnitsAsStringInRange:(NSRange)range
+{
+    if (range.length == 0) {
+        return @"";
+    } else if (_UTF8) {
+        return [[NSString alloc] initWithBytes:_bytes + range.location length:range.length encoding:NSUTF8StringEncoding] ?: @"";
     } else {
-        return nil;
+        return [_characters substringWithRange:range];
     }
 }
 
 - (BOOL)consumeHexInt:(out unsigned int *)number
 {
-    // NSScanner's -scanHexInt: allows for a leading "0x" or "0X", while the HTML spec does not.
-    NSCharacterSet *hexSet = [NSCharacterSet characterSetWithCharactersInString:@"0123456789ABCDEFabcdef"];
-    BOOL justHexDigits = [[self unprocessedScanner] scanCharactersFromSet:hexSet intoString:nil];
-    if (!justHexDigits) return NO;
-    NSScanner *scanner = [self unprocessedScanner];
-    BOOL ok = [scanner scanHexInt:number];
-    if (ok) {
-        _scanLocation = scanner.scanLocation;
+    NSUInteger location = _scanLocation;
+    unsigned long long value = 0;
+    int digit;
+    while ((digit = HexDigitValue(CodeUnitAtLocation(self, location))) >= 0) {
+        value = MIN(value * 16 + digit, (unsigned long long)UINT_MAX + 1);
+        location++;
     }
-    return ok;
+    if (_open && location >= _length) {
+        _starved = YES;
+    }
+    if (location == _scanLocation) return NO;
+    _scanLocation = location;
+    if (number) {
+        *number = (unsigned int)MIN(value, UINT_MAX);
+    }
+    return YES;
 }
 
-- (BOOL)consumeUnsignedInt:(out unsigned int *)outNumber
+- (BOOL)consumeUnsignedInt:(out unsigned int *)number
 {
-    NSScanner *scanner = [self unprocessedScanner];
-    long long number;
-    BOOL ok = [scanner scanLongLong:&number];
-    if (!ok || number < 0) return NO;
-    _scanLocation = scanner.scanLocation;
-    if (outNumber) {
-        if (number > (long long)UINT_MAX) {
-            *outNumber = UINT_MAX;
-        } else {
-            *outNumber = (unsigned int)number;
-        }
+    NSUInteger location = _scanLocation;
+    unsigned long long value = 0;
+    UTF32Char c;
+    while ((c = CodeUnitAtLocation(self, location)) >= '0' && c <= '9') {
+        value = MIN(value * 10 + (c - '0'), (unsigned long long)UINT_MAX + 1);
+        location++;
+    }
+    if (_open && location >= _length) {
+        _starved = YES;
+    }
+    if (location == _scanLocation) return NO;
+    _scanLocation = location;
+    if (number) {
+        *number = (unsigned int)MIN(value, UINT_MAX);
     }
-    return ok;
+    return YES;
 }
 
-- (NSScanner *)unprocessedScanner
+- (BOOL)nextCharactersAreAlphanumericFollowedBySemicolon
 {
-    NSScanner *scanner = [NSScanner scannerWithString:_string];
-    scanner.charactersToBeSkipped = nil;
-    scanner.scanLocation = _scanLocation;
-    return scanner;
+    NSUInteger location = _scanLocation;
+    while (is_ascii_alphanumeric(CodeUnitAtLocation(self, location))) {
+        location++;
+    }
+    if (_open && location >= _length) {
+        _starved = YES;
+    }
+    return location > _scanLocation && CodeUnitAtLocation(self, location) == ';';
 }
 
 - (UTF32Char)nextInputCharacter
@@ -117,37 +542,67 @@
         }
         return _currentInputCharacter;
     }
+    
+    // Errors are for consumed characters, so peeking is quiet.
+    void (^errorBlock)(NSString *) = consume ? self.errorBlock : nil;
+    
     NSUInteger advance = 0;
-    UTF32Char c = CFStringGetCharacterFromInlineBuffer(&_buffer, _scanLocation + advance);
-    if (c == 0 && _scanLocation + advance >= _string.length) {
+    UTF32Char c;
+    if (_scanLocation >= _length) {
         c = EOF;
+        if (_open) {
+            _starved = YES;
+        }
+    } else if (_UTF8) {
+        BOOL incomplete;
+        c = DecodeUTF8(_bytes + _scanLocation, _length - _scanLocation, &advance, &incomplete);
+        
+        // Multibyte characters might be split across appended data. (Surrogates are malformed UTF-8 and come out as U+FFFD.)
+        if (incomplete && _open) {
+            _starved = YES;
+        }
     } else {
+        c = CFStringGetCharacterFromInlineBuffer(&_buffer, _scanLocation);
         advance++;
-    }
-    if (CFStringIsSurrogateHighCharacter(c)) {
-        unichar low = CFStringGetCharacterFromInlineBuffer(&_buffer, _scanLocation + advance);
-        if (CFStringIsSurrogateLowCharacter(low)) {
-            advance++;
-            unichar high = c;
-            c = CFStringGetLongCharacterForSurrogatePair(high, low);
-        } else {
-            if (self.errorBlock) {
-                self.errorBlock(@"Isolated lead surrogate");
-            }
+        
+        // Surrogate pairs might be split across appended strings.
+        if (_open && _scanLocation + advance >= _length && CFStringIsSurrogateHighCharacter(c)) {
+            _starved = YES;
         }
-    } else if (CFStringIsSurrogateLowCharacter(c)) {
-        if (self.errorBlock) {
-            self.errorBlock(@"Isloated trail surrogate");
+        
+        if (CFStringIsSurrogateHighCharacter(c)) {
+            unichar low = CFStringGetCharacterFromInlineBuffer(&_buffer, _scanLocation + advance);
+            if (CFStringIsSurrogateLowCharacter(low)) {
+                advance++;
+                unichar high = c;
+                c = CFStringGetLongCharacterForSurrogatePair(high, low);
+            } else {
+                if (errorBlock) {
+                    errorBlock(@"Isolated lead surrogate");
+                }
+            }
+        } else if (CFStringIsSurrogateLowCharacter(c)) {
+            if (errorBlock) {
+                errorBlock(@"Isloated trail surrogate");
+            }
         }
-    } else if (c == '\r') {
+    }
+    
+    if (c == '\r') {
         c = '\n';
-        if (CFStringGetCharacterFromInlineBuffer(&_buffer, _scanLocation + advance) == '\n') {
+        
+        // CRLF sequences might be split across appended input.
+        if (_open && _scanLocation + advance >= _length) {
+            _starved = YES;
+        }
+        
+        if (CodeUnitAtLocation(self, _scanLocation + advance) == '\n') {
             advance++;
         }
     }
     if (is_undefined_or_disallowed(c)) {
-        if (self.errorBlock) {
-            self.errorBlock(@"Noncharacter or disallowed control character");
+        if (errorBlock) {
+            errorBlock(@"Noncharacter or disallowed control character");
         }
     }
     if (consume) {
@@ -157,17 +612,40 @@
     return c;
 }
 
-- (NSString *)nextUnprocessedCharactersWithMaximumLength:(NSUInteger)length
+- (NSString *)consumeNamedCharacterReferenceWithNameLength:(out NSUInteger *)nameLength semicolon:(out BOOL *)semicolon
 {
-    NSRange range = NSMakeRange(_scanLocation, length);
-    if (NSMaxRange(range) > _string.length) {
-        range.length = _string.length - range.location;
+    // Names are ASCII, so code units go straight into the trie.
+    NSUInteger location = _scanLocation;
+    NSUInteger node = 0;
+    NSString *replacement;
+    NSUInteger length = 0;
+    for (;;) {
+        if (location >= _length) {
+            // A longer name might continue in appended input.
+            if (_open) {
+                _starved = YES;
+            }
+            break;
+        }
+        node = NextNamedEntityNode(node, CodeUnitAtLocation(self, location));
+        if (!node) break;
+        location++;
+        NSString *candidate = NamedEntityReplacementAtNode(node);
+        if (candidate) {
+            replacement = candidate;
+            length = location - _scanLocation;
+        }
     }
-    if (range.length > 0) {
-        return [_string substringWithRange:range];
-    } else {
-        return nil;
+    if (!replacement) return nil;
+    
+    if (semicolon) {
+        *semicolon = CodeUnitAtLocation(self, _scanLocation + length - 1) == ';';
     }
+    if (nameLength) {
+        *nameLength = length;
+    }
+    _scanLocation += length;
+    return replacement;
 }
 
 - (void)reconsumeCurrentInputCharacter
@@ -184,4 +662,44 @@
     _scanLocation -= numberOfCharactersToUnconsume;
 }
 
+#pragma mark Position
+
+- (void)getLine:(out NSUInteger *)line column:(out NSUInteger *)column
+{
+    if (_positionLine == 0 || _scanLocation < _positionLocation) {
+        _positionLocation = 0;
+        _positionLine = 1;
+        _positionColumn = 0;
+    }
+    
+    NSUInteger end = MIN(_scanLocation, _length);
+    for (NSUInteger location = _positionLocation; location < end; location++) {
+        UTF32Char c = CodeUnitAtLocation(self, location);
+        if (c == '\n') {
+            _positionLine++;
+            _positionColumn = 0;
+        } else if (c == '\r') {
+            // A CRLF pair ends its line at the line feed. A carriage return at the end of what's been appended so far waits to see what follows.
+            if (location + 1 >= _length) {
+                end = location;
+                break;
+            } else if (CodeUnitAtLocation(self, location + 1) != '\n') {
+                _positionLine++;
+                _positionColumn = 0;
+            }
+        } else if (_UTF8 ? (c & 0xC0) != 0x80 : !CFStringIsSurrogateLowCharacter(c)) {
+            // Only the first code unit of a character moves the column along.
+            _positionColumn++;
+        }
+    }
+    _positionLocation = end;
+    
+    if (line) {
+        *line = _positionLine;
+    }
+    if (column) {
+        *column = MAX(_positionColumn, (NSUInteger)1);
+    }
+}
+
 @end
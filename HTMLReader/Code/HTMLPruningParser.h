@@ -0,0 +1,52 @@
+//  HTMLPruningParser.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+#import "HTMLDocument.h"
+#import "HTMLParseError.h"
+#import "HTMLSelector.h"
+
+/**
+    An HTMLPruningParser builds only the parts of a document that match a selector, for when all that's wanted from a big page is a table or two.
+ 
+    Tree construction runs in full, so implied tags, foster parenting, and the rest all work out just like they do for HTMLDocument. But once an element is closed, whatever it holds is thrown away unless it is, or leads to, an element that matched the keep selector. The resulting document has each match with its whole subtree, along with the chain of ancestors leading down to it. Everything else is gone.
+ 
+    Elements are matched as soon as the parser inserts them, which is before their contents or any later siblings have been parsed. Earlier siblings have been emptied by then, but are still around for combinators and pseudo-classes that look at them. Selectors that look ahead, such as :last-child or :empty, only see what's been parsed so far. Elements within a match are kept without being matched themselves.
+ */
+@interface HTMLPruningParser : NSObject
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes a pruning parser with a string of HTML.
+- (instancetype)initWithString:(NSString *)string keepSelector:(HTMLSelector *)keepSelector;
+
+/**
+    Initializes a pruning parser with some data of an unknown string encoding.
+ 
+    The encoding is determined up front, the same way as +[HTMLDocument documentWithData:contentTypeHeader:]. A <meta> tag that would change the encoding partway through is reported as a parse error instead.
+ 
+    @param contentType The value of the HTTP Content-Type header associated with the data, if any.
+ */
+- (instancetype)initWithData:(NSData *)data contentTypeHeader:(NSString *)contentType keepSelector:(HTMLSelector *)keepSelector;
+
+/// The selector that decides which elements are kept.
+@property (readonly, strong, nonatomic) HTMLSelector *keepSelector;
+
+/// YES if parsing stops once the first matching element is closed, leaving the rest of the input unread. The default is NO. Set this before parsing starts.
+@property (assign, nonatomic) BOOL stopsAfterFirstMatch;
+
+/// How much to record about parse errors. The default is HTMLParseErrorReportingOff. Set this before parsing starts.
+@property (assign, nonatomic) HTMLParseErrorReporting errorReporting;
+
+/// The pruned document. Parsing happens on first access.
+@property (readonly, strong, nonatomic) HTMLDocument *document;
+
+/// Instances of HTMLElement that matched the keep selector, in the order they were inserted. Accessing this parses the document if needed.
+@property (readonly, copy, nonatomic) NSArray *matchingElements;
+
+/// Instances of HTMLParseError representing the errors encountered while parsing the document. Empty unless errorReporting is HTMLParseErrorReportingFull.
+@property (readonly, copy, nonatomic) NSArray *parseErrors;
+
+@end
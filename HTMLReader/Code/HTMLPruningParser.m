@@ -0,0 +1,207 @@
+//  HTMLPruningParser.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLPruningParser.h"
+#import "HTMLEncoding.h"
+#import "HTMLNode+Private.h"
+#import "HTMLParser.h"
+
+@interface HTMLParser ()
+
+@property (readonly, strong, nonatomic) NSArray *stackOfOpenElements;
+@property (copy, nonatomic) void (^didProcessToken)(void);
+@property (copy, nonatomic) void (^didCreateElement)(HTMLElement *element);
+
+- (void)stopParsing;
+
+@end
+
+@interface HTMLPruningParser ()
+
+- (instancetype)initWithParser:(HTMLParser *)parser keepSelector:(HTMLSelector *)keepSelector NS_DESIGNATED_INITIALIZER;
+
+@end
+
+// Recently inserted elements are at the top of the stack, so that's where to look first.
+static BOOL IsOpen(NSArray *stackOfOpenElements, HTMLElement *element)
+{
+    for (NSUInteger i = stackOfOpenElements.count; i > 0; i--) {
+        if (stackOfOpenElements[i - 1] == element) return YES;
+    }
+    return NO;
+}
+
+@implementation HTMLPruningParser
+{
+    HTMLParser *_parser;
+    BOOL _parsed;
+    NSMutableArray *_matchingElements;
+    NSHashTable *_keptElements;
+    
+    // Elements created while processing the current token.
+    NSMutableArray *_createdElements;
+    
+    // The stack of open elements as it was after the previous token.
+    NSMutableArray *_openElements;
+    
+    BOOL _firstMatchClosed;
+    BOOL _stopped;
+}
+
+- (instancetype)initWithString:(NSString *)string keepSelector:(HTMLSelector *)keepSelector
+{
+    HTMLStringEncoding encoding = (HTMLStringEncoding){
+        .encoding = NSUTF8StringEncoding,
+        .confidence = Tentative
+    };
+    return [self initWithParser:[[HTMLParser alloc] initWithString:string encoding:encoding context:nil] keepSelector:keepSelector];
+}
+
+- (instancetype)initWithData:(NSData *)data contentTypeHeader:(NSString *)contentType keepSelector:(HTMLSelector *)keepSelector
+{
+    HTMLStringEncoding encoding = DeterminedStringEncodingForData(data, contentType);
+    return [self initWithParser:[[HTMLParser alloc] initWithData:data encoding:encoding context:nil] keepSelector:keepSelector];
+}
+
+- (instancetype)initWithParser:(HTMLParser *)parser keepSelector:(HTMLSelector *)keepSelector
+{
+    NSParameterAssert(keepSelector);
+    if ((self = [super init])) {
+        _parser = parser;
+        _parser.errorReporting = HTMLParseErrorReportingOff;
+        _keepSelector = keepSelector;
+        _matchingElements = [NSMutableArray new];
+        _keptElements = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+        _createdElements = [NSMutableArray new];
+        _openElements = [NSMutableArray new];
+    }
+    return self;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (HTMLParseErrorReporting)errorReporting
+{
+    return _parser.errorReporting;
+}
+
+- (void)setErrorReporting:(HTMLParseErrorReporting)errorReporting
+{
+    _parser.errorReporting = errorReporting;
+}
+
+- (HTMLDocument *)document
+{
+    if (!_parsed) {
+        _parsed = YES;
+        NSMutableArray *createdElements = _createdElements;
+        _parser.didCreateElement = ^(HTMLElement *element) {
+            [createdElements addObject:element];
+        };
+        __weak __typeof__(self) weakSelf = self;
+        _parser.didProcessToken = ^{
+            [weakSelf pruneClosedElements];
+        };
+        [_parser document];
+        _parser.didCreateElement = nil;
+        _parser.didProcessToken = nil;
+        [_createdElements removeAllObjects];
+        [_openElements removeAllObjects];
+    }
+    return _parser.document;
+}
+
+- (NSArray *)matchingElements
+{
+    [self document];
+    return [_matchingElements copy];
+}
+
+- (NSArray *)parseErrors
+{
+    return _parser.parseErrors;
+}
+
+#pragma mark Pruning
+
+- (BOOL)isWithinKeptElement:(HTMLNode *)node
+{
+    if (_keptElements.count == 0) return NO;
+    for (HTMLNode *ancestor = node; ancestor; ancestor = ancestor.parentNode) {
+        if ([_keptElements containsObject:ancestor]) return YES;
+    }
+    return NO;
+}
+
+/**
+    Called after each token. New elements are matched, then any elements that have been closed since the previous token are emptied of everything that isn't kept.
+ 
+    Elements are closed innermost first, so by the time an element is closed its children have already been dealt with: each child is either empty, and can go, or leads to something kept.
+ */
+- (void)pruneClosedElements
+{
+    NSArray *stackOfOpenElements = _parser.stackOfOpenElements;
+    
+    for (HTMLElement *element in _createdElements) {
+        if (!element.parentNode || [self isWithinKeptElement:element.parentNode]) continue;
+        if ([_keepSelector matchesElement:element]) {
+            [_matchingElements addObject:element];
+            [_keptElements addObject:element];
+        }
+    }
+    
+    // Elements that are closed as soon as they're inserted, like <br>, never make it onto the stack.
+    for (HTMLElement *element in _createdElements.reverseObjectEnumerator) {
+        if (!IsOpen(stackOfOpenElements, element)) {
+            [self elementDidClose:element stackOfOpenElements:stackOfOpenElements];
+        }
+    }
+    [_createdElements removeAllObjects];
+    
+    // Usually the stack only changes at the top.
+    NSUInteger unchanged = 0;
+    NSUInteger count = MIN(_openElements.count, stackOfOpenElements.count);
+    while (unchanged < count && _openElements[unchanged] == stackOfOpenElements[unchanged]) {
+        unchanged++;
+    }
+    for (NSUInteger i = _openElements.count; i > unchanged; i--) {
+        HTMLElement *element = _openElements[i - 1];
+        if (!IsOpen(stackOfOpenElements, element)) {
+            [self elementDidClose:element stackOfOpenElements:stackOfOpenElements];
+        }
+    }
+    [_openElements setArray:stackOfOpenElements];
+    
+    // Stopping closes every open element, so they get pruned too.
+    if (_firstMatchClosed && !_stopped) {
+        _stopped = YES;
+        [_parser stopParsing];
+        [self pruneClosedElements];
+    }
+}
+
+- (void)elementDidClose:(HTMLElement *)element stackOfOpenElements:(NSArray *)stackOfOpenElements
+{
+    if ([_keptElements containsObject:element]) {
+        if (_stopsAfterFirstMatch) {
+            _firstMatchClosed = YES;
+        }
+        return;
+    }
+    if ([self isWithinKeptElement:element]) return;
+    
+    for (NSUInteger i = element.numberOfChildren; i > 0; i--) {
+        HTMLNode *child = [element childAtIndex:i - 1];
+        if ([child isKindOfClass:[HTMLElement class]]) {
+            HTMLElement *childElement = (HTMLElement *)child;
+            if (childElement.numberOfChildren > 0 || [_keptElements containsObject:childElement] || IsOpen(stackOfOpenElements, childElement)) {
+                continue;
+            }
+        }
+        [element removeChild:child];
+    }
+}
+
+@end
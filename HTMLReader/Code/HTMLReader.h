@@ -2,7 +2,13 @@
 //
 //  Public domain. https://github.com/nolanw/HTMLReader
 
+#import "HTMLCompactDocument.h"
 #import "HTMLDocument.h"
+#import "HTMLFragmentParser.h"
+#import "HTMLMemoryFootprint.h"
+#import "HTMLParseError.h"
+#import "HTMLPruningParser.h"
 #import "HTMLSelector.h"
 #import "HTMLSerialization.h"
+#import "HTMLStreamingParser.h"
 #import "NSString+HTMLEntities.h"
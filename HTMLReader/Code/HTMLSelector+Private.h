@@ -0,0 +1,18 @@
+//  HTMLSelector+Private.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLSelector.h"
+
+@interface HTMLSelector (Private)
+
+/**
+    Returns NO if an element with the tag name and attributes cannot match, going by the tag, ID, class, and attribute tests that the selector makes of the matched element itself. Returns YES if the element might match, in which case it still needs to be matched in full with -matchesElement:.
+ 
+    Lets nodes that aren't kept as HTMLElement objects (like those of an HTMLCompactDocument) skip creating one for every element.
+ 
+    @param attributeValue Returns the value of the element's attribute with the given name, or nil if the element has no such attribute. Known names are passed as atoms.
+ */
+- (BOOL)mightMatchElementWithTagName:(NSString *)tagName attributeValue:(NSString * (^)(NSString *attributeName))attributeValue;
+
+@end
@@ -15,7 +15,7 @@
     @li Pseudo-elements (including ::first-line, ::first-leter, ::before, ::after) are not supported.
     @li The :not() pseudo-class supports any selector. (The spec only supports a simple selector.)
  
-    Once initialized, an HTMLSelector is fully parsed. Feel free to cache it for future use with -nodesMatchingParsedSelector: or -firstNodeMatchingParsedSelector:.
+    Once initialized, an HTMLSelector is fully parsed and compiled. Feel free to cache it for future use with -nodesMatchingParsedSelector: or -firstNodeMatchingParsedSelector:.
  */
 @interface HTMLSelector : NSObject
 
@@ -28,6 +28,23 @@
 /// Initializes a new selector by parsing a string representation.
 - (instancetype)initWithString:(NSString *)selectorString NS_DESIGNATED_INITIALIZER;
 
+/**
+    Returns a selector for the string, reusing a recently parsed one when possible. -nodesMatchingSelector: and -firstNodeMatchingSelector: go through this cache.
+ 
+    Safe to call from any thread.
+ */
++ (HTMLSelector *)cachedSelectorForString:(NSString *)selectorString;
+
+/// The most selectors kept in the cache, after which the least recently used are dropped. The default is 128, and 0 turns off the cache.
++ (NSUInteger)cacheCapacity;
++ (void)setCacheCapacity:(NSUInteger)cacheCapacity;
+
+/// The number of times the cache had the requested selector since the program started.
++ (NSUInteger)cacheHitCount;
+
+/// The number of times the cache had to parse the requested selector since the program started.
++ (NSUInteger)cacheMissCount;
+
 /// A string representation of the selector.
 @property (readonly, copy, nonatomic) NSString *string;
 
@@ -39,6 +56,24 @@
 
 @end
 
+/**
+    An HTMLSelectorSet matches several selectors at once, visiting each element only once.
+ 
+    Selectors that start the same way share the work of matching those compounds against each element's ancestors. For example, "#content .post h2" and "#content .post p" test each ancestor against "#content .post" just once.
+ */
+@interface HTMLSelectorSet : NSObject
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes a selector set with an array of HTMLSelector instances, none of which may have an error.
+- (instancetype)initWithSelectors:(NSArray *)selectors NS_DESIGNATED_INITIALIZER;
+
+/// The selectors in the set.
+@property (readonly, copy, nonatomic) NSArray *selectors;
+
+@end
+
 /// Returns a character set containing all CSS whitespace characters. This is not necessarily identical to `+[NSCharacterSet whitespaceCharacterSet]` or `+[NSCharacterSet whitespaceAndNewlineCharacterSet]`.
 extern NSCharacterSet * HTMLSelectorWhitespaceCharacterSet(void);
 
@@ -66,6 +101,9 @@ extern NSString * const HTMLSelectorLocationErrorKey;
 /// Returns the first node matched by selector, or nil if there is no such node.
 - (HTMLElement *)firstNodeMatchingParsedSelector:(HTMLSelector *)selector;
 
+/// Returns an array with, for each selector in the set, an array of the nodes it matches. Equivalent to calling -nodesMatchingParsedSelector: with each selector, but only walks the tree once.
+- (NSArray *)nodesMatchingSelectorSet:(HTMLSelectorSet *)selectorSet;
+
 @end
 
 /// HTMLNthExpression represents the expression in an :nth-child (or similar) pseudo-class.
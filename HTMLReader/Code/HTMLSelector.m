@@ -4,13 +4,85 @@
 
 // Implements CSS Selectors Level 3 http://www.w3.org/TR/css3-selectors/
 
-#import "HTMLSelector.h"
+#import "HTMLSelector+Private.h"
+#import "HTMLAtom.h"
+#import "HTMLDocument+Private.h"
+#import "HTMLNode+Private.h"
 #import "HTMLTextNode.h"
+#import <pthread.h>
 
 typedef BOOL (^HTMLSelectorPredicate)(HTMLElement *node);
 typedef HTMLSelectorPredicate HTMLSelectorPredicateGen;
 
-static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString, NSError **error);
+/**
+    A selector is compiled to a flat array of instructions, one compound selector after another, starting with the rightmost (the one that describes the matched elements). Each compound is a run of tests, cheapest first, followed by a combinator that moves on to the element described by the next compound. The last compound ends with a match instruction.
+ */
+typedef NS_ENUM(uint8_t, HTMLSelectorOpcode) {
+    // Tests. The current element fails the compound as soon as one of its tests fails.
+    HTMLSelectorOpcodeTag,
+    HTMLSelectorOpcodeID,
+    HTMLSelectorOpcodeHasAttribute,
+    HTMLSelectorOpcodeAttributeEquals,
+    HTMLSelectorOpcodeClass,
+    HTMLSelectorOpcodePredicate,
+    
+    // Combinators, each of which ends a compound.
+    HTMLSelectorOpcodeChild,
+    HTMLSelectorOpcodeDescendant,
+    HTMLSelectorOpcodeAdjacentSibling,
+    HTMLSelectorOpcodeGeneralSibling,
+    HTMLSelectorOpcodeMatch,
+};
+
+typedef struct {
+    HTMLSelectorOpcode opcode;
+    
+    // The index of the compound that the instruction belongs to, counting from the rightmost.
+    NSUInteger compound;
+    
+    // A name or predicate, and for some tests a value. Kept alive by the program.
+    __unsafe_unretained id operand;
+    __unsafe_unretained NSString *value;
+} HTMLSelectorInstruction;
+
+/// The kinds of names hashed into the ancestor bloom filter.
+typedef NS_OPTIONS(uint8_t, HTMLSelectorHashKind) {
+    HTMLSelectorHashTag = 1 << 0,
+    HTMLSelectorHashID = 1 << 1,
+    HTMLSelectorHashClass = 1 << 2,
+};
+
+/// An HTMLSelectorProgram collects instructions while a selector is parsed, then lays them out for matching.
+@interface HTMLSelectorProgram : NSObject
+
+/// Adds a test to the compound being parsed. The operand is retained by the program.
+- (void)addTest:(HTMLSelectorOpcode)opcode operand:(id)operand value:(NSString *)value;
+
+/// Adds a predicate test to the compound being parsed. Does nothing if the predicate is nil.
+- (void)addPredicate:(HTMLSelectorPredicate)predicate;
+
+/// Ends the compound being parsed and starts the next one.
+- (void)addCombinator:(HTMLSelectorOpcode)combinator;
+
+/// Lays out the instructions, rightmost compound first. Call once, after parsing succeeds.
+- (void)finish;
+
+@property (readonly, assign, nonatomic) const HTMLSelectorInstruction *instructions;
+@property (readonly, assign, nonatomic) NSUInteger numberOfInstructions;
+@property (readonly, assign, nonatomic) NSUInteger numberOfCompounds;
+
+/// Hashes of tag names, IDs, and classes that the ancestors of any matching element must have between them.
+@property (readonly, assign, nonatomic) const uint32_t *bloomHashes;
+@property (readonly, assign, nonatomic) NSUInteger numberOfBloomHashes;
+@property (readonly, assign, nonatomic) HTMLSelectorHashKind hashKinds;
+
+/// An ID, class, or tag test from the rightmost compound that a document's index can look up, or HTMLSelectorOpcodeMatch if there is none.
+@property (readonly, assign, nonatomic) HTMLSelectorOpcode seedOpcode;
+@property (readonly, strong, nonatomic) NSString *seedName;
+
+@end
+
+static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString, HTMLSelectorProgram *program, NSError **error);
 
 static NSError * ParseError(NSString *reason, NSString *string, NSUInteger position)
 {
@@ -96,8 +168,13 @@ HTMLSelectorPredicateGen isTagTypePredicate(NSString *tagType)
             return YES;
         };
 	} else {
+        // Most elements have a known, lowercase tag name, which is matched by pointer. Mixed-case names (e.g. "foreignObject") still need a proper comparison, but only when the lengths match.
+        NSString *atom = HTMLKnownAtom(tagType.lowercaseString);
+        NSUInteger length = tagType.length;
 		return ^BOOL(HTMLElement *node) {
-			return [node.tagName compare:tagType options:NSCaseInsensitiveSearch] == NSOrderedSame;
+            NSString *tagName = node.tagName;
+            if (atom && tagName == atom) return YES;
+            return tagName.length == length && [tagName compare:tagType options:NSCaseInsensitiveSearch] == NSOrderedSame;
 		};
 	}
 }
@@ -147,54 +224,71 @@ HTMLSelectorPredicateGen isEmptyPredicate(void)
 
 #pragma mark - Attribute Predicates
 
+// Known attribute names are found by pointer once they're atoms.
+static NSString * AttributeNameAtom(NSString *attributeName)
+{
+    return HTMLKnownAtom(attributeName) ?: attributeName;
+}
+
 HTMLSelectorPredicateGen hasAttributePredicate(NSString *attributeName)
 {
+    attributeName = AttributeNameAtom(attributeName);
 	return ^BOOL(HTMLElement *node) {
-		return !!node[attributeName];
+		return !!HTMLElementAttributeValue(node, attributeName);
 	};
 }
 
 HTMLSelectorPredicateGen attributeIsExactlyPredicate(NSString *attributeName, NSString *attributeValue)
 {
+    attributeName = AttributeNameAtom(attributeName);
 	return ^(HTMLElement *node) {
-		return [node[attributeName] isEqualToString:attributeValue];
+		return [HTMLElementAttributeValue(node, attributeName) isEqualToString:attributeValue];
 	};
 }
 
 NSCharacterSet * HTMLSelectorWhitespaceCharacterSet(void)
 {
-    // http://www.w3.org/TR/css3-selectors/#whitespace
-    return [NSCharacterSet characterSetWithCharactersInString:@" \t\n\r\f"];
+    static NSCharacterSet *whitespace;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // http://www.w3.org/TR/css3-selectors/#whitespace
+        whitespace = [NSCharacterSet characterSetWithCharactersInString:@" \t\n\r\f"];
+    });
+    return whitespace;
 }
 
 HTMLSelectorPredicateGen attributeContainsExactWhitespaceSeparatedValuePredicate(NSString *attributeName, NSString *attributeValue)
 {
+    attributeName = AttributeNameAtom(attributeName);
     NSCharacterSet *whitespace = HTMLSelectorWhitespaceCharacterSet();
     return ^(HTMLElement *node) {
-        NSArray *items = [node[attributeName] componentsSeparatedByCharactersInSet:whitespace];
+        NSArray *items = [HTMLElementAttributeValue(node, attributeName) componentsSeparatedByCharactersInSet:whitespace];
         return [items containsObject:attributeValue];
     };
 }
 
 HTMLSelectorPredicateGen attributeStartsWithPredicate(NSString *attributeName, NSString *attributeValue)
 {
+    attributeName = AttributeNameAtom(attributeName);
 	return ^(HTMLElement *node) {
-		return [node[attributeName] hasPrefix:attributeValue];
+		return [HTMLElementAttributeValue(node, attributeName) hasPrefix:attributeValue];
 	};
 }
 
 HTMLSelectorPredicateGen attributeContainsPredicate(NSString *attributeName, NSString *attributeValue)
 {
+    attributeName = AttributeNameAtom(attributeName);
 	return ^BOOL(HTMLElement *node) {
-        NSString *value = node[attributeName];
+        NSString *value = HTMLElementAttributeValue(node, attributeName);
 		return value && [value rangeOfString:attributeValue].location != NSNotFound;
 	};
 }
 
 HTMLSelectorPredicateGen attributeEndsWithPredicate(NSString *attributeName, NSString *attributeValue)
 {
+    attributeName = AttributeNameAtom(attributeName);
 	return ^(HTMLElement *node) {
-		return [node[attributeName] hasSuffix:attributeValue];
+		return [HTMLElementAttributeValue(node, attributeName) hasSuffix:attributeValue];
 	};
 }
 
@@ -218,14 +312,34 @@ HTMLSelectorPredicateGen attributeStartsWithAnyOf(NSString *attributeName, NSArr
 
 #pragma mark Sibling Predicates
 
+static HTMLElement * PreviousElementSibling(HTMLNode *node)
+{
+    for (HTMLNode *sibling = node.previousSibling; sibling; sibling = sibling.previousSibling) {
+        if ([sibling isKindOfClass:[HTMLElement class]]) {
+            return (HTMLElement *)sibling;
+        }
+    }
+    return nil;
+}
+
+static HTMLElement * NextElementSibling(HTMLNode *node)
+{
+    for (HTMLNode *sibling = node.nextSibling; sibling; sibling = sibling.nextSibling) {
+        if ([sibling isKindOfClass:[HTMLElement class]]) {
+            return (HTMLElement *)sibling;
+        }
+    }
+    return nil;
+}
+
 HTMLSelectorPredicateGen adjacentSiblingPredicate(HTMLSelectorPredicate siblingTest)
 {
 	if (!siblingTest) return nil;
 	
 	return ^BOOL(HTMLElement *node) {
-		NSArray *parentChildren = node.parentElement.childElementNodes;
-		NSUInteger nodeIndex = [parentChildren indexOfObject:node];
-		return nodeIndex != 0 && siblingTest([parentChildren objectAtIndex:nodeIndex - 1]);
+        if (!node.parentElement) return NO;
+        HTMLElement *sibling = PreviousElementSibling(node);
+		return sibling && siblingTest(sibling);
 	};
 }
 
@@ -234,11 +348,9 @@ HTMLSelectorPredicateGen generalSiblingPredicate(HTMLSelectorPredicate siblingTe
 	if (!siblingTest) return nil;
 	
 	return ^(HTMLElement *node) {
-		for (HTMLElement *sibling in node.parentElement.childElementNodes) {
-			if ([sibling isEqual:node]) {
-				break;
-			}
-			if (siblingTest(node)) {
+        if (!node.parentElement) return NO;
+        for (HTMLElement *sibling = PreviousElementSibling(node); sibling; sibling = PreviousElementSibling(sibling)) {
+			if (siblingTest(sibling)) {
 				return YES;
 			}
 		}
@@ -251,14 +363,19 @@ HTMLSelectorPredicateGen generalSiblingPredicate(HTMLSelectorPredicate siblingTe
 HTMLSelectorPredicateGen isNthChildPredicate(HTMLNthExpression nth, BOOL fromLast)
 {
 	return ^BOOL(HTMLNode *node) {
-		NSArray *parentElements = node.parentElement.childElementNodes;
 		// Index relative to start/end
 		NSInteger nthPosition;
-		if (fromLast) {
-			nthPosition = parentElements.count - [parentElements indexOfObject:node];
-		} else {
-			nthPosition = [parentElements indexOfObject:node] + 1;
-		}
+        if (!node.parentElement) {
+            nthPosition = fromLast ? 0 : 1;
+        } else {
+            nthPosition = 1;
+            for (HTMLElement *sibling = fromLast ? NextElementSibling(node) : PreviousElementSibling(node);
+                 sibling;
+                 sibling = fromLast ? NextElementSibling(sibling) : PreviousElementSibling(sibling))
+            {
+                nthPosition++;
+            }
+        }
         if (nth.n > 0) {
             return (nthPosition - nth.c) % nth.n == 0;
         } else {
@@ -272,24 +389,25 @@ HTMLSelectorPredicateGen isNthChildOfTypePredicate(HTMLNthExpression nth, HTMLSe
 	if (!typePredicate) return nil;
 	
 	return ^BOOL(HTMLElement *node) {
-		id <NSFastEnumeration> enumerator = (fromLast
-                                             ? node.parentElement.childElementNodes.reverseObjectEnumerator
-                                             : node.parentElement.childElementNodes);
-		NSInteger count = 0;
-		for (HTMLElement *currentNode in enumerator) {
-			if (typePredicate(currentNode)) {
-				count++;
-			}
-			if ([currentNode isEqual:node]) {
-				// check if the current node is the nth element of its type based on the current count
-				if (nth.n > 0) {
-					return (count - nth.c) % nth.n == 0;
-				} else {
-					return (count - nth.c) == 0;
-				}
-			}
-		}
-		return NO;
+        if (!node.parentElement) return NO;
+        
+        // Count the node itself only if it's of the type.
+		NSInteger count = typePredicate(node) ? 1 : 0;
+        for (HTMLElement *sibling = fromLast ? NextElementSibling(node) : PreviousElementSibling(node);
+             sibling;
+             sibling = fromLast ? NextElementSibling(sibling) : PreviousElementSibling(sibling))
+        {
+            if (typePredicate(sibling)) {
+                count++;
+            }
+        }
+        
+        // check if the current node is the nth element of its type based on the current count
+        if (nth.n > 0) {
+            return (count - nth.c) % nth.n == 0;
+        } else {
+            return (count - nth.c) == 0;
+        }
 	};
 }
 
@@ -407,7 +525,7 @@ HTMLSelectorPredicateGen isCheckedPredicate(void)
 HTMLSelectorPredicateGen isOnlyChildPredicate(void)
 {
 	return ^BOOL(HTMLNode *node) {
-		return [node.parentElement childElementNodes].count == 1;
+		return node.parentElement && !PreviousElementSibling(node) && !NextElementSibling(node);
 	};
 }
 
@@ -540,7 +658,7 @@ static HTMLSelectorPredicateGen scanPredicateFromPseudoClass(NSScanner *scanner,
 	}
 	else if ([pseudo isEqualToString:@"not"]) {
 		NSString *toNegateString = scanFunctionInterior(scanner, error);
-		HTMLSelectorPredicate toNegate = SelectorFunctionForString(toNegateString, error);
+		HTMLSelectorPredicate toNegate = SelectorFunctionForString(toNegateString, nil, error);
 		return negatePredicate(toNegate);
 	}
 	
@@ -605,7 +723,35 @@ NSString *scanCombinator(NSScanner *scanner,  NSError **error)
 	return operator;
 }
 
-HTMLSelectorPredicate scanAttributePredicate(NSScanner *scanner, NSError **error)
+// Whether the value can be matched as one word of a whitespace-separated list.
+static BOOL IsClassName(NSString *value)
+{
+    return value.length > 0 && [value rangeOfCharacterFromSet:HTMLSelectorWhitespaceCharacterSet()].location == NSNotFound;
+}
+
+// Adds a dedicated test for the common attribute selectors. Returns NO if the selector needs its predicate instead.
+static BOOL AddAttributeTest(HTMLSelectorProgram *program, NSString *attributeName, NSString *operator, NSString *attributeValue)
+{
+    if (!attributeName) return NO;
+    
+    if (operator.length == 0) {
+        [program addTest:HTMLSelectorOpcodeHasAttribute operand:AttributeNameAtom(attributeName) value:nil];
+        return YES;
+    } else if ([operator isEqualToString:@"="] && attributeValue) {
+        if ([attributeName isEqualToString:@"id"]) {
+            [program addTest:HTMLSelectorOpcodeID operand:attributeValue value:nil];
+        } else {
+            [program addTest:HTMLSelectorOpcodeAttributeEquals operand:AttributeNameAtom(attributeName) value:attributeValue];
+        }
+        return YES;
+    } else if ([operator isEqualToString:@"~"] && [attributeName isEqualToString:@"class"] && IsClassName(attributeValue)) {
+        [program addTest:HTMLSelectorOpcodeClass operand:attributeValue value:nil];
+        return YES;
+    }
+    return NO;
+}
+
+HTMLSelectorPredicate scanAttributePredicate(NSScanner *scanner, HTMLSelectorProgram *program, NSError **error)
 {
     NSCAssert([scanner.string characterAtIndex:scanner.scanLocation - 1] == '[', nil);
     
@@ -644,31 +790,38 @@ HTMLSelectorPredicate scanAttributePredicate(NSScanner *scanner, NSError **error
 		return nil;
 	}
 	
+	HTMLSelectorPredicate predicate;
 	if ([operator length] == 0) {
-		return hasAttributePredicate(attributeName);
+		predicate = hasAttributePredicate(attributeName);
 	} else if ([operator isEqualToString:@"="]) {
-		return attributeIsExactlyPredicate(attributeName, attributeValue);
+		predicate = attributeIsExactlyPredicate(attributeName, attributeValue);
 	} else if ([operator isEqualToString:@"~"]) {
-        return attributeContainsExactWhitespaceSeparatedValuePredicate(attributeName, attributeValue);
+        predicate = attributeContainsExactWhitespaceSeparatedValuePredicate(attributeName, attributeValue);
 	} else if ([operator isEqualToString:@"^"]) {
-		return attributeStartsWithPredicate(attributeName, attributeValue);
+		predicate = attributeStartsWithPredicate(attributeName, attributeValue);
 	} else if ([operator isEqualToString:@"$"]) {
-		return attributeEndsWithPredicate(attributeName, attributeValue);
+		predicate = attributeEndsWithPredicate(attributeName, attributeValue);
 	} else if ([operator isEqualToString:@"*"]) {
-		return attributeContainsPredicate(attributeName, attributeValue);
+		predicate = attributeContainsPredicate(attributeName, attributeValue);
 	} else if ([operator isEqualToString:@"|"]) {
-		return orCombinatorPredicate(@[attributeIsExactlyPredicate(attributeName, attributeValue),
-                                       attributeStartsWithPredicate(attributeName, [attributeValue stringByAppendingString:@"-"])]);
+		predicate = orCombinatorPredicate(@[attributeIsExactlyPredicate(attributeName, attributeValue),
+                                            attributeStartsWithPredicate(attributeName, [attributeValue stringByAppendingString:@"-"])]);
 	} else {
 		*error = ParseError(@"Unexpected operator", scanner.string, scanner.scanLocation - operator.length);
 		return nil;
 	}
+    
+    if (!AddAttributeTest(program, attributeName, operator, attributeValue)) {
+        [program addPredicate:predicate];
+    }
+    return predicate;
 }
 
-HTMLSelectorPredicateGen scanTagPredicate(NSScanner *scanner, NSError **error)
+HTMLSelectorPredicateGen scanTagPredicate(NSScanner *scanner, HTMLSelectorProgram *program, NSError **error)
 {
 	NSString *identifier = scanIdentifier(scanner, error);
 	if (identifier) {
+        [program addTest:HTMLSelectorOpcodeTag operand:identifier value:HTMLKnownAtom(identifier.lowercaseString)];
         return isTagTypePredicate(identifier);
     } else {
         [scanner scanString:@"*" intoString:nil];
@@ -677,9 +830,9 @@ HTMLSelectorPredicateGen scanTagPredicate(NSScanner *scanner, NSError **error)
 }
 
 
-HTMLSelectorPredicateGen scanPredicate(NSScanner *scanner, HTMLSelectorPredicate inputPredicate, NSError **error)
+HTMLSelectorPredicateGen scanPredicate(NSScanner *scanner, HTMLSelectorPredicate inputPredicate, HTMLSelectorProgram *program, NSError **error)
 {
-	HTMLSelectorPredicate tagPredicate = scanTagPredicate(scanner, error);
+	HTMLSelectorPredicate tagPredicate = scanTagPredicate(scanner, program, error);
 	
 	inputPredicate = inputPredicate ? bothCombinatorPredicate(tagPredicate, inputPredicate) : tagPredicate;
 	
@@ -693,23 +846,34 @@ HTMLSelectorPredicateGen scanPredicate(NSScanner *scanner, HTMLSelectorPredicate
 		
 		// Pseudo and attribute
 		if ([modifier isEqualToString:@":"]) {
-			inputPredicate = bothCombinatorPredicate(inputPredicate,
-													 scanPredicateFromPseudoClass(scanner, inputPredicate, error));
+            HTMLSelectorPredicate pseudoPredicate = scanPredicateFromPseudoClass(scanner, inputPredicate, error);
+            [program addPredicate:pseudoPredicate];
+			inputPredicate = bothCombinatorPredicate(inputPredicate, pseudoPredicate);
 		} else if ([modifier isEqualToString:@"::"]) {
 			// We don't support *any* pseudo-elements.
 			*error = ParseError(@"Pseudo elements unsupported", scanner.string, scanner.scanLocation - modifier.length);
 			return nil;
 		} else if ([modifier isEqualToString:@"["]) {
 			inputPredicate = bothCombinatorPredicate(inputPredicate,
-													 scanAttributePredicate(scanner, error));
+													 scanAttributePredicate(scanner, program, error));
 		} else if ([modifier isEqualToString:@"."]) {
 			NSString *className = scanIdentifier(scanner, error);
-			inputPredicate =  bothCombinatorPredicate(inputPredicate,
-                                                      isKindOfClassPredicate(className));
+            HTMLSelectorPredicate classPredicate = isKindOfClassPredicate(className);
+            if (IsClassName(className)) {
+                [program addTest:HTMLSelectorOpcodeClass operand:className value:nil];
+            } else {
+                [program addPredicate:classPredicate];
+            }
+			inputPredicate =  bothCombinatorPredicate(inputPredicate, classPredicate);
 		} else if ([modifier isEqualToString:@"#"]) {
 			NSString *idName = scanIdentifier(scanner, error);
-			inputPredicate =  bothCombinatorPredicate(inputPredicate,
-                                                      hasIDPredicate(idName));
+            HTMLSelectorPredicate idPredicate = hasIDPredicate(idName);
+            if (idName) {
+                [program addTest:HTMLSelectorOpcodeID operand:idName value:nil];
+            } else {
+                [program addPredicate:idPredicate];
+            }
+			inputPredicate =  bothCombinatorPredicate(inputPredicate, idPredicate);
 		} else if (modifier != nil) {
 			*error = ParseError(@"Unexpected modifier", scanner.string, scanner.scanLocation - modifier.length);
 			return nil;
@@ -727,12 +891,16 @@ HTMLSelectorPredicateGen scanPredicate(NSScanner *scanner, HTMLSelectorPredicate
 	
 	if ([combinator isEqualToString:@""]) {
 		// Whitespace combinator: y descendant of an x
+        [program addCombinator:HTMLSelectorOpcodeDescendant];
 		return descendantOfPredicate(inputPredicate);
 	} else if ([combinator isEqualToString:@">"]) {
+        [program addCombinator:HTMLSelectorOpcodeChild];
 		return childOfOtherPredicatePredicate(inputPredicate);
 	} else if ([combinator isEqualToString:@"+"]) {
+        [program addCombinator:HTMLSelectorOpcodeAdjacentSibling];
 		return adjacentSiblingPredicate(inputPredicate);
 	} else if ([combinator isEqualToString:@"~"]) {
+        [program addCombinator:HTMLSelectorOpcodeGeneralSibling];
 		return generalSiblingPredicate(inputPredicate);
 	}
     
@@ -745,7 +913,7 @@ HTMLSelectorPredicateGen scanPredicate(NSScanner *scanner, HTMLSelectorPredicate
 	}
 }
 
-static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString, NSError **error)
+static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString, HTMLSelectorProgram *program, NSError **error)
 {
 	// Trim non-functional whitespace
 	selectorString = [selectorString stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
@@ -764,7 +932,7 @@ static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString,
 	HTMLSelectorPredicate lastPredicate = nil;
 	
 	do {
-		lastPredicate = scanPredicate(scanner, lastPredicate, error);
+		lastPredicate = scanPredicate(scanner, lastPredicate, program, error);
 	} while (lastPredicate && ![scanner isAtEnd] && !*error);
 	
 	NSCAssert(lastPredicate || *error, @"Need either a predicate or error at this point");
@@ -772,11 +940,647 @@ static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString,
 	return lastPredicate;
 }
 
+#pragma mark - Matching
+
+enum {
+    MaximumBloomHashes = 8,
+    
+    // The bloom filter has a counter for each of 2^12 slots, and each name counts in two of them.
+    BloomFilterSize = 1 << 12,
+    BloomFilterMask = BloomFilterSize - 1,
+};
+
+static inline BOOL IsSelectorWhitespace(unichar c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+// FNV-1a, seeded differently for each kind of name so that e.g. a class and a tag of the same name don't collide.
+static inline uint32_t HashSeed(HTMLSelectorHashKind kind)
+{
+    return 2166136261u ^ (kind * 0x9E3779B9u);
+}
+
+static inline uint32_t HashCharacter(uint32_t hash, unichar c)
+{
+    return (hash ^ c) * 16777619u;
+}
+
+// Tag names are hashed case-insensitively, as they're matched that way.
+static uint32_t HashString(NSString *string, HTMLSelectorHashKind kind)
+{
+    CFStringInlineBuffer buffer;
+    CFIndex length = CFStringGetLength((__bridge CFStringRef)string);
+    CFStringInitInlineBuffer((__bridge CFStringRef)string, &buffer, CFRangeMake(0, length));
+    uint32_t hash = HashSeed(kind);
+    for (CFIndex i = 0; i < length; i++) {
+        unichar c = CFStringGetCharacterFromInlineBuffer(&buffer, i);
+        if (kind == HTMLSelectorHashTag && c >= 'A' && c <= 'Z') {
+            c += 'a' - 'A';
+        }
+        hash = HashCharacter(hash, c);
+    }
+    return hash;
+}
+
+@implementation HTMLSelectorProgram
+{
+    // While parsing: the tests of each compound, leftmost first, and the combinators between them.
+    NSMutableArray *_compoundTests;
+    NSMutableData *_combinators;
+    
+    // Keeps the instructions' operands alive.
+    NSMutableArray *_operands;
+    
+    HTMLSelectorInstruction *_instructions;
+    uint32_t _bloomHashes[MaximumBloomHashes];
+}
+
+- (instancetype)init
+{
+    if ((self = [super init])) {
+        _compoundTests = [NSMutableArray arrayWithObject:[NSMutableData new]];
+        _combinators = [NSMutableData new];
+        _operands = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_instructions);
+}
+
+- (void)addTest:(HTMLSelectorOpcode)opcode operand:(id)operand value:(NSString *)value
+{
+    [_operands addObject:operand];
+    if (value) {
+        [_operands addObject:value];
+    }
+    HTMLSelectorInstruction test = {
+        .opcode = opcode,
+        .operand = operand,
+        .value = value,
+    };
+    [_compoundTests.lastObject appendBytes:&test length:sizeof(test)];
+}
+
+- (void)addPredicate:(HTMLSelectorPredicate)predicate
+{
+    if (!predicate) return;
+    [self addTest:HTMLSelectorOpcodePredicate operand:[predicate copy] value:nil];
+}
+
+- (void)addCombinator:(HTMLSelectorOpcode)combinator
+{
+    [_combinators appendBytes:&combinator length:sizeof(combinator)];
+    [_compoundTests addObject:[NSMutableData new]];
+}
+
+- (void)finish
+{
+    NSAssert(!_instructions, @"A selector program can only be finished once");
+    
+    NSUInteger count = _compoundTests.count;
+    NSUInteger length = count;
+    for (NSData *tests in _compoundTests) {
+        length += tests.length / sizeof(HTMLSelectorInstruction);
+    }
+    _instructions = calloc(length, sizeof(*_instructions));
+    _numberOfInstructions = length;
+    _numberOfCompounds = count;
+    
+    const HTMLSelectorOpcode *combinators = _combinators.bytes;
+    HTMLSelectorInstruction *next = _instructions;
+    for (NSUInteger i = 0; i < count; i++) {
+        NSData *data = _compoundTests[count - 1 - i];
+        const HTMLSelectorInstruction *tests = data.bytes;
+        NSUInteger numberOfTests = data.length / sizeof(*tests);
+        
+        // Opcodes are ordered so the cheaper tests go first.
+        for (HTMLSelectorOpcode opcode = 0; opcode < HTMLSelectorOpcodeChild; opcode++) {
+            for (NSUInteger j = 0; j < numberOfTests; j++) {
+                if (tests[j].opcode == opcode) {
+                    *next = tests[j];
+                    next->compound = i;
+                    next++;
+                }
+            }
+        }
+        
+        next->opcode = i + 1 < count ? combinators[count - 2 - i] : HTMLSelectorOpcodeMatch;
+        next->compound = i;
+        next++;
+        
+        // A compound left of a child or descendant combinator describes an ancestor of the matched element (even past a sibling combinator, as siblings share ancestors), so its names must be in the ancestor bloom filter.
+        if (i > 0) {
+            HTMLSelectorOpcode combinator = combinators[count - 1 - i];
+            if (combinator != HTMLSelectorOpcodeChild && combinator != HTMLSelectorOpcodeDescendant) continue;
+            for (NSUInteger j = 0; j < numberOfTests && _numberOfBloomHashes < MaximumBloomHashes; j++) {
+                HTMLSelectorHashKind kind;
+                switch (tests[j].opcode) {
+                    case HTMLSelectorOpcodeTag: kind = HTMLSelectorHashTag; break;
+                    case HTMLSelectorOpcodeID: kind = HTMLSelectorHashID; break;
+                    case HTMLSelectorOpcodeClass: kind = HTMLSelectorHashClass; break;
+                    default: continue;
+                }
+                _bloomHashes[_numberOfBloomHashes++] = HashString(tests[j].operand, kind);
+                _hashKinds |= kind;
+            }
+        }
+    }
+    
+    // IDs are the most selective, then classes, then tag names.
+    _seedOpcode = HTMLSelectorOpcodeMatch;
+    for (const HTMLSelectorInstruction *test = _instructions; test->opcode < HTMLSelectorOpcodeChild; test++) {
+        if (test->opcode == HTMLSelectorOpcodeID) {
+            _seedOpcode = test->opcode;
+            _seedName = test->operand;
+            break;
+        } else if (test->opcode == HTMLSelectorOpcodeClass ||
+                   (test->opcode == HTMLSelectorOpcodeTag && _seedOpcode == HTMLSelectorOpcodeMatch))
+        {
+            _seedOpcode = test->opcode;
+            _seedName = test->operand;
+        }
+    }
+    
+    _compoundTests = nil;
+    _combinators = nil;
+}
+
+- (const HTMLSelectorInstruction *)instructions
+{
+    return _instructions;
+}
+
+- (const uint32_t *)bloomHashes
+{
+    return _bloomHashes;
+}
+
+@end
+
+/**
+    State kept while matching a selector against each element of a subtree.
+ 
+    The bloom filter counts hashes of the names on the current element's ancestors, so most elements whose ancestors can't match are rejected without walking up the tree. The cache remembers whether each ancestor matched each compound, so elements that share ancestors don't test them again.
+ */
+typedef struct {
+    uint8_t bloomFilter[BloomFilterSize];
+    HTMLSelectorHashKind hashKinds;
+    const uint32_t *bloomHashes;
+    NSUInteger numberOfBloomHashes;
+    
+    // The number of ancestors of the element being matched, and for each the index at which the traversal resumes in its parent.
+    NSUInteger depth;
+    NSUInteger capacity;
+    NSUInteger *childIndexes;
+    
+    // For each ancestor, a result per compound: 1 if it matched, -1 if not, or 0 if it hasn't been tested.
+    int8_t *cache;
+    NSUInteger numberOfCompounds;
+} HTMLSelectorMatchContext;
+
+static void UpdateBloomFilter(uint8_t *bloomFilter, uint32_t hash, BOOL add)
+{
+    uint32_t slots[] = { hash & BloomFilterMask, (hash >> 12) & BloomFilterMask };
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++) {
+        uint8_t *counter = &bloomFilter[slots[i]];
+        
+        // A counter that overflowed has lost track, so it stays full rather than risk a false negative.
+        if (*counter == UINT8_MAX) continue;
+        
+        if (add) {
+            (*counter)++;
+        } else {
+            (*counter)--;
+        }
+    }
+}
+
+static BOOL BloomFilterMightContain(const uint8_t *bloomFilter, uint32_t hash)
+{
+    return bloomFilter[hash & BloomFilterMask] && bloomFilter[(hash >> 12) & BloomFilterMask];
+}
+
+static void UpdateBloomFilterWithElement(HTMLSelectorMatchContext *context, HTMLElement *element, BOOL add)
+{
+    HTMLSelectorHashKind kinds = context->hashKinds;
+    if (kinds & HTMLSelectorHashTag) {
+        UpdateBloomFilter(context->bloomFilter, HashString(element.tagName, HTMLSelectorHashTag), add);
+    }
+    if (kinds & HTMLSelectorHashID) {
+        NSString *elementID = HTMLElementAttributeValue(element, HTMLAtomForLiteral(@"id"));
+        if (elementID) {
+            UpdateBloomFilter(context->bloomFilter, HashString(elementID, HTMLSelectorHashID), add);
+        }
+    }
+    if (kinds & HTMLSelectorHashClass) {
+        NSString *classes = HTMLElementAttributeValue(element, HTMLAtomForLiteral(@"class")) ?: @"";
+        CFIndex length = CFStringGetLength((__bridge CFStringRef)classes);
+        CFStringInlineBuffer buffer;
+        CFStringInitInlineBuffer((__bridge CFStringRef)classes, &buffer, CFRangeMake(0, length));
+        uint32_t hash = HashSeed(HTMLSelectorHashClass);
+        BOOL inClassName = NO;
+        for (CFIndex i = 0; i <= length; i++) {
+            unichar c = i < length ? CFStringGetCharacterFromInlineBuffer(&buffer, i) : ' ';
+            if (IsSelectorWhitespace(c)) {
+                if (inClassName) {
+                    UpdateBloomFilter(context->bloomFilter, hash, add);
+                }
+                hash = HashSeed(HTMLSelectorHashClass);
+                inClassName = NO;
+            } else {
+                hash = HashCharacter(hash, c);
+                inClassName = YES;
+            }
+        }
+    }
+}
+
+static void InitializeMatchContext(HTMLSelectorMatchContext *context, HTMLSelectorHashKind hashKinds, NSUInteger numberOfCompounds)
+{
+    memset(context, 0, sizeof(*context));
+    context->hashKinds = hashKinds;
+    context->numberOfCompounds = numberOfCompounds;
+}
+
+static void DestroyMatchContext(HTMLSelectorMatchContext *context)
+{
+    free(context->childIndexes);
+    free(context->cache);
+}
+
+static void PushAncestor(HTMLSelectorMatchContext *context, HTMLElement *element, NSUInteger childIndex)
+{
+    NSUInteger depth = context->depth;
+    if (depth == context->capacity) {
+        context->capacity = MAX(context->capacity * 2, 32);
+        context->childIndexes = reallocf(context->childIndexes, context->capacity * sizeof(*context->childIndexes));
+        
+        // The rightmost compound is never tested on an ancestor, so a single compound needs no cache.
+        if (context->numberOfCompounds > 1) {
+            context->cache = reallocf(context->cache, context->capacity * context->numberOfCompounds);
+        }
+    }
+    context->childIndexes[depth] = childIndex;
+    if (context->cache) {
+        memset(&context->cache[depth * context->numberOfCompounds], 0, context->numberOfCompounds);
+    }
+    UpdateBloomFilterWithElement(context, element, YES);
+    context->depth++;
+}
+
+// Returns the child index that was pushed with the element.
+static NSUInteger PopAncestor(HTMLSelectorMatchContext *context, HTMLElement *element)
+{
+    context->depth--;
+    UpdateBloomFilterWithElement(context, element, NO);
+    return context->childIndexes[context->depth];
+}
+
+static BOOL ContainsClassName(NSString *classes, NSString *className)
+{
+    NSUInteger length = classes.length;
+    NSRange searchRange = NSMakeRange(0, length);
+    for (;;) {
+        NSRange range = [classes rangeOfString:className options:NSLiteralSearch range:searchRange];
+        if (range.location == NSNotFound) return NO;
+        NSUInteger end = NSMaxRange(range);
+        if ((range.location == 0 || IsSelectorWhitespace([classes characterAtIndex:range.location - 1])) &&
+            (end == length || IsSelectorWhitespace([classes characterAtIndex:end])))
+        {
+            return YES;
+        }
+        searchRange = NSMakeRange(range.location + 1, length - range.location - 1);
+    }
+}
+
+static BOOL MatchesTagName(const HTMLSelectorInstruction *test, NSString *tagName)
+{
+    // As with isTagTypePredicate, known names are matched by pointer.
+    if (test->value && tagName == test->value) return YES;
+    NSString *name = test->operand;
+    return tagName.length == name.length && [tagName compare:name options:NSCaseInsensitiveSearch] == NSOrderedSame;
+}
+
+// The attribute looked at by an ID, attribute, or class test.
+static NSString * TestedAttributeName(const HTMLSelectorInstruction *test)
+{
+    switch (test->opcode) {
+        case HTMLSelectorOpcodeID: return HTMLAtomForLiteral(@"id");
+        case HTMLSelectorOpcodeClass: return HTMLAtomForLiteral(@"class");
+        default: return test->operand;
+    }
+}
+
+// Whether the value of the tested attribute (nil if the element lacks it) passes an ID, attribute, or class test.
+static BOOL MatchesAttributeValue(const HTMLSelectorInstruction *test, NSString *value)
+{
+    switch (test->opcode) {
+        case HTMLSelectorOpcodeID:
+            return [value isEqualToString:test->operand];
+        case HTMLSelectorOpcodeHasAttribute:
+            return value != nil;
+        case HTMLSelectorOpcodeAttributeEquals:
+            return [value isEqualToString:test->value];
+        case HTMLSelectorOpcodeClass:
+            return value && ContainsClassName(value, test->operand);
+        default:
+            return YES;
+    }
+}
+
+static BOOL MatchesTest(const HTMLSelectorInstruction *test, HTMLElement *element)
+{
+    switch (test->opcode) {
+        case HTMLSelectorOpcodeTag:
+            return MatchesTagName(test, element.tagName);
+        case HTMLSelectorOpcodeID:
+        case HTMLSelectorOpcodeHasAttribute:
+        case HTMLSelectorOpcodeAttributeEquals:
+        case HTMLSelectorOpcodeClass:
+            return MatchesAttributeValue(test, HTMLElementAttributeValue(element, TestedAttributeName(test)));
+        case HTMLSelectorOpcodePredicate: {
+            __unsafe_unretained HTMLSelectorPredicate predicate = test->operand;
+            return predicate(element);
+        }
+        default:
+            return YES;
+    }
+}
+
+static BOOL MatchesCombinator(const HTMLSelectorInstruction *combinator, HTMLElement *element, NSInteger depth, HTMLSelectorMatchContext *context);
+
+/**
+    Returns whether the element matches the compound at pc and everything to its left.
+ 
+    @param depth The element's number of ancestors.
+    @param isAncestor YES if the element is an ancestor of the element being matched, in which case its result can be cached.
+ */
+static BOOL MatchesCompound(const HTMLSelectorInstruction *pc, HTMLElement *element, NSInteger depth, BOOL isAncestor, HTMLSelectorMatchContext *context)
+{
+    int8_t *cached = NULL;
+    if (isAncestor && context && context->cache && depth >= 0) {
+        cached = &context->cache[depth * context->numberOfCompounds + pc->compound];
+        if (*cached) return *cached > 0;
+    }
+    
+    BOOL matches = YES;
+    for (; pc->opcode < HTMLSelectorOpcodeChild; pc++) {
+        if (!MatchesTest(pc, element)) {
+            matches = NO;
+            break;
+        }
+    }
+    if (matches) {
+        matches = MatchesCombinator(pc, element, depth, context);
+    }
+    
+    if (cached) {
+        *cached = matches ? 1 : -1;
+    }
+    return matches;
+}
+
+static BOOL MatchesCombinator(const HTMLSelectorInstruction *combinator, HTMLElement *element, NSInteger depth, HTMLSelectorMatchContext *context)
+{
+    const HTMLSelectorInstruction *next = combinator + 1;
+    switch (combinator->opcode) {
+        case HTMLSelectorOpcodeChild: {
+            HTMLElement *parent = element.parentElement;
+            return parent && MatchesCompound(next, parent, depth - 1, YES, context);
+        }
+        case HTMLSelectorOpcodeDescendant:
+            for (HTMLElement *ancestor = element.parentElement; ancestor; ancestor = ancestor.parentElement) {
+                depth--;
+                if (MatchesCompound(next, ancestor, depth, YES, context)) return YES;
+            }
+            return NO;
+        case HTMLSelectorOpcodeAdjacentSibling: {
+            if (!element.parentElement) return NO;
+            HTMLElement *sibling = PreviousElementSibling(element);
+            return sibling && MatchesCompound(next, sibling, depth, NO, context);
+        }
+        case HTMLSelectorOpcodeGeneralSibling:
+            if (!element.parentElement) return NO;
+            for (HTMLElement *sibling = PreviousElementSibling(element); sibling; sibling = PreviousElementSibling(sibling)) {
+                if (MatchesCompound(next, sibling, depth, NO, context)) return YES;
+            }
+            return NO;
+        default:
+            return YES;
+    }
+}
+
+/**
+    Returns whether the element matches the whole selector.
+ 
+    @param context The traversal state, in which case the element's ancestors must be the ones pushed; or NULL.
+ */
+static BOOL MatchesProgram(const HTMLSelectorInstruction *instructions, HTMLElement *element, HTMLSelectorMatchContext *context)
+{
+    if (!instructions) return NO;
+    
+    const HTMLSelectorInstruction *pc = instructions;
+    for (; pc->opcode < HTMLSelectorOpcodeChild; pc++) {
+        if (!MatchesTest(pc, element)) return NO;
+    }
+    if (pc->opcode == HTMLSelectorOpcodeMatch) return YES;
+    
+    if (context) {
+        for (NSUInteger i = 0; i < context->numberOfBloomHashes; i++) {
+            if (!BloomFilterMightContain(context->bloomFilter, context->bloomHashes[i])) return NO;
+        }
+    }
+    return MatchesCombinator(pc, element, context ? (NSInteger)context->depth : 0, context);
+}
+
+/**
+    Returns the elements in the root's document that might match the program, in tree order, or nil if the whole subtree should be walked instead.
+ 
+    Class and tag name candidates can be most of the document, so they're only used when the subtree is about as big. An ID usually picks out one element wherever the subtree is.
+ */
+static NSArray * IndexedCandidates(HTMLNode *root, HTMLSelectorProgram *program)
+{
+    HTMLSelectorOpcode opcode = program.seedOpcode;
+    if (opcode == HTMLSelectorOpcodeMatch) return nil;
+    HTMLDocument *document = [root isKindOfClass:[HTMLDocument class]] ? (HTMLDocument *)root : root.document;
+    if (!document) return nil;
+    if (opcode != HTMLSelectorOpcodeID && root != document && root.parentNode != document) return nil;
+    
+    NSString *name = program.seedName;
+    NSArray *candidates;
+    switch (opcode) {
+        case HTMLSelectorOpcodeID: candidates = [document indexedElementsWithID:name]; break;
+        case HTMLSelectorOpcodeClass: candidates = [document indexedElementsWithClassName:name]; break;
+        default: candidates = [document indexedElementsWithTagName:name]; break;
+    }
+    return candidates ?: @[];
+}
+
+static BOOL IsInclusiveAncestor(HTMLNode *ancestor, HTMLNode *node)
+{
+    for (; node; node = node.parentNode) {
+        if (node == ancestor) return YES;
+    }
+    return NO;
+}
+
+/**
+    Calls the block with each element in the subtree rooted at the node (including the node itself), in tree order.
+ 
+    When the block is called, the element's ancestors (including any outside the subtree) are the ones pushed onto the context.
+ */
+static void WalkSubtree(HTMLNode *root, HTMLSelectorMatchContext *context, void (^block)(HTMLElement *element, BOOL *stop))
+{
+    // Ancestors outside the subtree can still match.
+    NSMutableArray *ancestors = [NSMutableArray new];
+    for (HTMLElement *ancestor = root.parentElement; ancestor; ancestor = ancestor.parentElement) {
+        [ancestors addObject:ancestor];
+    }
+    for (HTMLElement *ancestor in ancestors.reverseObjectEnumerator) {
+        PushAncestor(context, ancestor, 0);
+    }
+    
+    BOOL stop = NO;
+    if ([root isKindOfClass:[HTMLElement class]]) {
+        HTMLElement *element = (HTMLElement *)root;
+        block(element, &stop);
+        PushAncestor(context, element, 0);
+    }
+    
+    HTMLNode *parent = root;
+    NSUInteger index = 0;
+    while (!stop) {
+        if (index < parent.numberOfChildren) {
+            HTMLNode *child = [parent childAtIndex:index];
+            if ([child isKindOfClass:[HTMLElement class]]) {
+                HTMLElement *element = (HTMLElement *)child;
+                block(element, &stop);
+                if (element.numberOfChildren > 0) {
+                    PushAncestor(context, element, index);
+                    parent = element;
+                    index = 0;
+                    continue;
+                }
+            }
+            index++;
+        } else if (parent == root) {
+            break;
+        } else {
+            HTMLElement *element = (HTMLElement *)parent;
+            index = PopAncestor(context, element) + 1;
+            parent = element.parentNode;
+        }
+    }
+}
+
+/// Calls the block with each element in the subtree rooted at the node (including the node itself) that matches the program, in tree order.
+static void EnumerateMatchingElements(HTMLNode *root, HTMLSelectorProgram *program, void (^block)(HTMLElement *element, BOOL *stop))
+{
+    const HTMLSelectorInstruction *instructions = program.instructions;
+    if (!instructions) return;
+    
+    NSArray *candidates = IndexedCandidates(root, program);
+    if (candidates) {
+        BOOL checkAncestry = ![root isKindOfClass:[HTMLDocument class]];
+        BOOL stop = NO;
+        for (HTMLElement *element in candidates) {
+            if (checkAncestry && !IsInclusiveAncestor(root, element)) continue;
+            if (MatchesProgram(instructions, element, NULL)) {
+                block(element, &stop);
+                if (stop) break;
+            }
+        }
+        return;
+    }
+    
+    HTMLSelectorMatchContext context;
+    InitializeMatchContext(&context, program.hashKinds, program.numberOfCompounds);
+    context.bloomHashes = program.bloomHashes;
+    context.numberOfBloomHashes = program.numberOfBloomHashes;
+    
+    // Blocks copy captured structs, so capture a pointer instead.
+    HTMLSelectorMatchContext *contextPointer = &context;
+    WalkSubtree(root, contextPointer, ^(HTMLElement *element, BOOL *stop) {
+        if (MatchesProgram(instructions, element, contextPointer)) {
+            block(element, stop);
+        }
+    });
+    
+    DestroyMatchContext(&context);
+}
+
+#pragma mark - Cache
+
+/// An entry in the cache of parsed selectors, linked from most to least recently used.
+@interface HTMLSelectorCacheEntry : NSObject
+{
+    @public
+    HTMLSelector *_selector;
+    
+    // Entries are kept alive by the cache's dictionary.
+    __unsafe_unretained HTMLSelectorCacheEntry *_previous;
+    __unsafe_unretained HTMLSelectorCacheEntry *_next;
+}
+
+@end
+
+@implementation HTMLSelectorCacheEntry
+
+@end
+
+// Everything below is guarded by the mutex.
+static pthread_mutex_t CacheMutex = PTHREAD_MUTEX_INITIALIZER;
+static NSMutableDictionary *CacheEntries;
+static __unsafe_unretained HTMLSelectorCacheEntry *MostRecentEntry;
+static __unsafe_unretained HTMLSelectorCacheEntry *LeastRecentEntry;
+static NSUInteger CacheCapacity = 128;
+static NSUInteger CacheHitCount;
+static NSUInteger CacheMissCount;
+
+static void UnlinkCacheEntry(HTMLSelectorCacheEntry *entry)
+{
+    if (entry->_previous) {
+        entry->_previous->_next = entry->_next;
+    } else {
+        MostRecentEntry = entry->_next;
+    }
+    if (entry->_next) {
+        entry->_next->_previous = entry->_previous;
+    } else {
+        LeastRecentEntry = entry->_previous;
+    }
+    entry->_previous = entry->_next = nil;
+}
+
+static void LinkMostRecentCacheEntry(HTMLSelectorCacheEntry *entry)
+{
+    entry->_next = MostRecentEntry;
+    if (MostRecentEntry) {
+        MostRecentEntry->_previous = entry;
+    } else {
+        LeastRecentEntry = entry;
+    }
+    MostRecentEntry = entry;
+}
+
+static void TrimCache(void)
+{
+    while (CacheEntries.count > CacheCapacity) {
+        HTMLSelectorCacheEntry *entry = LeastRecentEntry;
+        UnlinkCacheEntry(entry);
+        [CacheEntries removeObjectForKey:entry->_selector.string];
+    }
+}
+
 @interface HTMLSelector ()
 
 @property (copy, nonatomic) NSString *string;
 @property (strong, nonatomic) NSError *error;
-@property (copy, nonatomic) HTMLSelectorPredicate predicate;
+@property (strong, nonatomic) HTMLSelectorProgram *program;
 
 // http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
 - (instancetype) init NS_DESIGNATED_INITIALIZER;
@@ -797,15 +1601,111 @@ static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString,
     if ((self = [super init])) {
         _string = [selectorString copy];
         NSError *error;
-        _predicate = SelectorFunctionForString(selectorString, &error);
+        HTMLSelectorProgram *program = [HTMLSelectorProgram new];
+        if (SelectorFunctionForString(selectorString, program, &error)) {
+            [program finish];
+            _program = program;
+        }
         _error = error;
     }
     return self;
 }
 
++ (HTMLSelector *)cachedSelectorForString:(NSString *)selectorString
+{
+    pthread_mutex_lock(&CacheMutex);
+    HTMLSelectorCacheEntry *entry = selectorString ? CacheEntries[selectorString] : nil;
+    if (entry) {
+        CacheHitCount++;
+        if (entry != MostRecentEntry) {
+            UnlinkCacheEntry(entry);
+            LinkMostRecentCacheEntry(entry);
+        }
+        HTMLSelector *selector = entry->_selector;
+        pthread_mutex_unlock(&CacheMutex);
+        return selector;
+    }
+    CacheMissCount++;
+    pthread_mutex_unlock(&CacheMutex);
+    
+    // Other threads can use the cache while this one parses.
+    HTMLSelector *selector = [[HTMLSelector alloc] initWithString:selectorString];
+    NSString *key = selector.string;
+    if (!key) return selector;
+    
+    pthread_mutex_lock(&CacheMutex);
+    entry = CacheEntries[key];
+    if (entry) {
+        // Another thread parsed the same string in the meantime.
+        selector = entry->_selector;
+    } else if (CacheCapacity > 0) {
+        if (!CacheEntries) {
+            CacheEntries = [NSMutableDictionary new];
+        }
+        entry = [HTMLSelectorCacheEntry new];
+        entry->_selector = selector;
+        CacheEntries[key] = entry;
+        LinkMostRecentCacheEntry(entry);
+        TrimCache();
+    }
+    pthread_mutex_unlock(&CacheMutex);
+    return selector;
+}
+
++ (NSUInteger)cacheCapacity
+{
+    pthread_mutex_lock(&CacheMutex);
+    NSUInteger capacity = CacheCapacity;
+    pthread_mutex_unlock(&CacheMutex);
+    return capacity;
+}
+
++ (void)setCacheCapacity:(NSUInteger)cacheCapacity
+{
+    pthread_mutex_lock(&CacheMutex);
+    CacheCapacity = cacheCapacity;
+    TrimCache();
+    pthread_mutex_unlock(&CacheMutex);
+}
+
++ (NSUInteger)cacheHitCount
+{
+    pthread_mutex_lock(&CacheMutex);
+    NSUInteger count = CacheHitCount;
+    pthread_mutex_unlock(&CacheMutex);
+    return count;
+}
+
++ (NSUInteger)cacheMissCount
+{
+    pthread_mutex_lock(&CacheMutex);
+    NSUInteger count = CacheMissCount;
+    pthread_mutex_unlock(&CacheMutex);
+    return count;
+}
+
 - (BOOL)matchesElement:(HTMLElement *)element
 {
-    return self.predicate(element);
+    return MatchesProgram(_program.instructions, element, NULL);
+}
+
+- (BOOL)mightMatchElementWithTagName:(NSString *)tagName attributeValue:(NSString * (^)(NSString *attributeName))attributeValue
+{
+    const HTMLSelectorInstruction *test = _program.instructions;
+    if (!test) return NO;
+    for (; test->opcode < HTMLSelectorOpcodeChild; test++) {
+        switch (test->opcode) {
+            case HTMLSelectorOpcodeTag:
+                if (!MatchesTagName(test, tagName)) return NO;
+                break;
+            case HTMLSelectorOpcodePredicate:
+                break;
+            default:
+                if (!MatchesAttributeValue(test, attributeValue(TestedAttributeName(test)))) return NO;
+                break;
+        }
+    }
+    return YES;
 }
 
 - (NSString *)description
@@ -819,6 +1719,126 @@ static HTMLSelectorPredicate SelectorFunctionForString(NSString *selectorString,
 
 @end
 
+/// A selector's program, as laid out in a selector set.
+typedef struct {
+    HTMLSelectorInstruction *instructions;
+    const uint32_t *bloomHashes;
+    NSUInteger numberOfBloomHashes;
+} HTMLSelectorSetEntry;
+
+@interface HTMLSelectorSet ()
+
+- (NSArray *)nodesMatchingInSubtree:(HTMLNode *)root;
+
+@end
+
+@implementation HTMLSelectorSet
+{
+    // One per selector. Compounds are renumbered so that selectors sharing a compound (and everything to its left) share its place in the match cache.
+    HTMLSelectorSetEntry *_entries;
+    NSUInteger _numberOfCompounds;
+    HTMLSelectorHashKind _hashKinds;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (instancetype)initWithSelectors:(NSArray *)selectors
+{
+    if ((self = [super init])) {
+        _selectors = [selectors copy];
+        _entries = calloc(_selectors.count, sizeof(*_entries));
+        
+        NSMutableDictionary *compoundNumbers = [NSMutableDictionary new];
+        for (NSUInteger i = 0; i < _selectors.count; i++) {
+            HTMLSelector *selector = _selectors[i];
+            NSAssert(!selector.error, @"Attempted to use selector with error: %@", selector.error);
+            HTMLSelectorProgram *program = selector.program;
+            if (!program) continue;
+            
+            NSUInteger numberOfInstructions = program.numberOfInstructions;
+            HTMLSelectorInstruction *instructions = malloc(numberOfInstructions * sizeof(*instructions));
+            memcpy(instructions, program.instructions, numberOfInstructions * sizeof(*instructions));
+            _entries[i] = (HTMLSelectorSetEntry){
+                .instructions = instructions,
+                .bloomHashes = program.bloomHashes,
+                .numberOfBloomHashes = program.numberOfBloomHashes,
+            };
+            _hashKinds |= program.hashKinds;
+            
+            // Compounds are laid out rightmost first, so go backwards to key each one by the compound to its left.
+            id leftKey = [NSNull null];
+            NSUInteger end = numberOfInstructions;
+            while (end > 0) {
+                NSUInteger start = end - 1;
+                while (start > 0 && instructions[start - 1].opcode < HTMLSelectorOpcodeChild) {
+                    start--;
+                }
+                NSMutableArray *key = [NSMutableArray arrayWithObject:leftKey];
+                for (NSUInteger j = start; j < end; j++) {
+                    [key addObject:@(instructions[j].opcode)];
+                    [key addObject:instructions[j].operand ?: [NSNull null]];
+                    [key addObject:instructions[j].value ?: [NSNull null]];
+                }
+                NSNumber *number = compoundNumbers[key];
+                if (!number) {
+                    number = @(compoundNumbers.count);
+                    compoundNumbers[key] = number;
+                }
+                for (NSUInteger j = start; j < end; j++) {
+                    instructions[j].compound = number.unsignedIntegerValue;
+                }
+                leftKey = number;
+                end = start;
+            }
+        }
+        _numberOfCompounds = compoundNumbers.count;
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _selectors.count; i++) {
+        free(_entries[i].instructions);
+    }
+    free(_entries);
+}
+
+- (NSArray *)nodesMatchingInSubtree:(HTMLNode *)root
+{
+    NSUInteger count = _selectors.count;
+    NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [results addObject:[NSMutableArray new]];
+    }
+    
+    HTMLSelectorMatchContext context;
+    InitializeMatchContext(&context, _hashKinds, _numberOfCompounds);
+    HTMLSelectorMatchContext *contextPointer = &context;
+    const HTMLSelectorSetEntry *entries = _entries;
+    WalkSubtree(root, contextPointer, ^(HTMLElement *element, BOOL *stop) {
+        for (NSUInteger i = 0; i < count; i++) {
+            // The bloom filter is shared, but each selector has its own hashes to look for.
+            contextPointer->bloomHashes = entries[i].bloomHashes;
+            contextPointer->numberOfBloomHashes = entries[i].numberOfBloomHashes;
+            if (MatchesProgram(entries[i].instructions, element, contextPointer)) {
+                [results[i] addObject:element];
+            }
+        }
+    });
+    DestroyMatchContext(&context);
+    
+    return results;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p %@>", self.class, self, [_selectors valueForKey:@"string"]];
+}
+
+@end
+
 NSString * const HTMLSelectorErrorDomain = @"HTMLSelectorErrorDomain";
 
 NSString * const HTMLSelectorInputStringErrorKey = @"HTMLSelectorInputString";
@@ -829,12 +1849,12 @@ NSString * const HTMLSelectorLocationErrorKey = @"HTMLSelectorLocation";
 
 - (NSArray *)nodesMatchingSelector:(NSString *)selectorString
 {
-	return [self nodesMatchingParsedSelector:[HTMLSelector selectorForString:selectorString]];
+	return [self nodesMatchingParsedSelector:[HTMLSelector cachedSelectorForString:selectorString]];
 }
 
 - (HTMLElement *)firstNodeMatchingSelector:(NSString *)selectorString
 {
-    return [self firstNodeMatchingParsedSelector:[HTMLSelector selectorForString:selectorString]];
+    return [self firstNodeMatchingParsedSelector:[HTMLSelector cachedSelectorForString:selectorString]];
 }
 
 - (NSArray *)nodesMatchingParsedSelector:(HTMLSelector *)selector
@@ -842,11 +1862,9 @@ NSString * const HTMLSelectorLocationErrorKey = @"HTMLSelectorLocation";
 	NSAssert(!selector.error, @"Attempted to use selector with error: %@", selector.error);
     
 	NSMutableArray *ret = [NSMutableArray new];
-	for (HTMLElement *node in self.treeEnumerator) {
-		if ([node isKindOfClass:[HTMLElement class]] && [selector matchesElement:node]) {
-			[ret addObject:node];
-		}
-	}
+    EnumerateMatchingElements(self, selector.program, ^(HTMLElement *element, BOOL *stop) {
+        [ret addObject:element];
+    });
 	return ret;
 }
 
@@ -854,12 +1872,17 @@ NSString * const HTMLSelectorLocationErrorKey = @"HTMLSelectorLocation";
 {
     NSAssert(!selector.error, @"Attempted to use selector with error: %@", selector.error);
     
-    for (HTMLElement *node in self.treeEnumerator) {
-        if ([node isKindOfClass:[HTMLElement class]] && [selector matchesElement:node]) {
-            return node;
-        }
-    }
-    return nil;
+    __block HTMLElement *first;
+    EnumerateMatchingElements(self, selector.program, ^(HTMLElement *element, BOOL *stop) {
+        first = element;
+        *stop = YES;
+    });
+    return first;
+}
+
+- (NSArray *)nodesMatchingSelectorSet:(HTMLSelectorSet *)selectorSet
+{
+    return [selectorSet nodesMatchingInSubtree:self];
 }
 
 @end
@@ -21,7 +21,27 @@
     Returns the serialized HTML fragment of this node.
  
     This is effectively outerHTML. (See http://www.w3.org/TR/DOM-Parsing/#widl-Element-outerHTML, though no exception will be thrown by -serializedFragment.)
+ 
+    Subclasses may override this method. An overriding node's output is used as is whenever it is serialized as part of an ancestor, including by -innerHTML and the -write… methods.
  */
 @property (readonly, copy, nonatomic) NSString *serializedFragment;
 
+/**
+    Appends the serialized HTML fragment of this node to some data, encoded as UTF-8.
+ 
+    The tree is walked without recursion and written straight into the data, so deeply nested documents serialize in linear time. -serializedFragment and -innerHTML are built on this.
+ */
+- (void)writeSerializedFragmentToData:(NSMutableData *)data;
+
+/**
+    Writes the serialized HTML fragment of this node to an open stream, encoded as UTF-8.
+ 
+    Output is written a few kilobytes at a time, so the whole fragment is never held in memory.
+ 
+    @param error If the stream fails, set to the stream's error.
+ 
+    @return YES if the whole fragment was written, or NO if the stream failed.
+ */
+- (BOOL)writeSerializedFragmentToStream:(NSOutputStream *)stream error:(NSError * __autoreleasing *)error;
+
 @end
@@ -3,13 +3,277 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLSerialization.h"
+#import "HTMLAtom.h"
 #import "HTMLComment.h"
 #import "HTMLDocument.h"
 #import "HTMLDocumentType.h"
 #import "HTMLElement.h"
+#import "HTMLNode+Private.h"
 #import "HTMLString.h"
 #import "HTMLTextNode.h"
 
+/**
+    Collects serialized UTF-8 in a small buffer, then hands it off in chunks to either a data or a stream.
+ 
+    The data or stream is retained by whoever set up the sink.
+ */
+typedef struct {
+    __unsafe_unretained NSMutableData *data;
+    __unsafe_unretained NSOutputStream *stream;
+    uint8_t buffer[4096];
+    NSUInteger length;
+    BOOL failed;
+} HTMLSerializationSink;
+
+static void FlushSink(HTMLSerializationSink *sink)
+{
+    if (sink->data) {
+        [sink->data appendBytes:sink->buffer length:sink->length];
+    } else {
+        NSUInteger written = 0;
+        while (written < sink->length && !sink->failed) {
+            NSInteger result = [sink->stream write:sink->buffer + written maxLength:sink->length - written];
+            if (result <= 0) {
+                sink->failed = YES;
+            } else {
+                written += result;
+            }
+        }
+    }
+    sink->length = 0;
+}
+
+// The longest thing written in one go is an escaped character, such as "&nbsp;".
+static inline void ReserveSinkSpace(HTMLSerializationSink *sink)
+{
+    if (sink->length + 8 > sizeof(sink->buffer)) {
+        FlushSink(sink);
+    }
+}
+
+static void WriteASCII(HTMLSerializationSink *sink, const char *string)
+{
+    for (; *string; string++) {
+        ReserveSinkSpace(sink);
+        sink->buffer[sink->length++] = (uint8_t)*string;
+    }
+}
+
+typedef NS_ENUM(NSInteger, HTMLEscapeMode) {
+    HTMLEscapeNothing,
+    HTMLEscapeText,
+    HTMLEscapeAttribute,
+};
+
+/**
+    Writes a string as UTF-8, escaping it as needed.
+ 
+    For more information, see https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+ */
+static void WriteString(HTMLSerializationSink *sink, NSString *string, HTMLEscapeMode escapeMode)
+{
+    if (!string) return;
+    CFStringRef cfstring = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfstring);
+    CFStringInlineBuffer inlineBuffer;
+    CFStringInitInlineBuffer(cfstring, &inlineBuffer, CFRangeMake(0, length));
+    for (CFIndex i = 0; i < length; i++) {
+        ReserveSinkSpace(sink);
+        uint8_t *out = sink->buffer + sink->length;
+        UTF32Char c = CFStringGetCharacterFromInlineBuffer(&inlineBuffer, i);
+        if (c < 0x80) {
+            const char *escaped = NULL;
+            if (escapeMode != HTMLEscapeNothing) {
+                if (c == '&') {
+                    escaped = "&amp;";
+                } else if (c == '"' && escapeMode == HTMLEscapeAttribute) {
+                    escaped = "&quot;";
+                } else if (c == '<' && escapeMode == HTMLEscapeText) {
+                    escaped = "&lt;";
+                } else if (c == '>' && escapeMode == HTMLEscapeText) {
+                    escaped = "&gt;";
+                }
+            }
+            if (escaped) {
+                size_t escapedLength = strlen(escaped);
+                memcpy(out, escaped, escapedLength);
+                sink->length += escapedLength;
+            } else {
+                out[0] = (uint8_t)c;
+                sink->length++;
+            }
+            continue;
+        }
+        
+        if (c == 0x00A0 && escapeMode != HTMLEscapeNothing) {
+            memcpy(out, "&nbsp;", 6);
+            sink->length += 6;
+            continue;
+        }
+        
+        if (CFStringIsSurrogateHighCharacter(c) && i + 1 < length) {
+            UniChar low = CFStringGetCharacterFromInlineBuffer(&inlineBuffer, i + 1);
+            if (CFStringIsSurrogateLowCharacter(low)) {
+                c = CFStringGetLongCharacterForSurrogatePair((UniChar)c, low);
+                i++;
+            }
+        }
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            // Unpaired surrogates can't be encoded.
+            c = 0xFFFD;
+        }
+        if (c < 0x800) {
+            out[0] = (uint8_t)(0xC0 | (c >> 6));
+            out[1] = (uint8_t)(0x80 | (c & 0x3F));
+            sink->length += 2;
+        } else if (c < 0x10000) {
+            out[0] = (uint8_t)(0xE0 | (c >> 12));
+            out[1] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+            out[2] = (uint8_t)(0x80 | (c & 0x3F));
+            sink->length += 3;
+        } else {
+            out[0] = (uint8_t)(0xF0 | (c >> 18));
+            out[1] = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+            out[2] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+            out[3] = (uint8_t)(0x80 | (c & 0x3F));
+            sink->length += 4;
+        }
+    }
+}
+
+/// YES if the node's class has its own -serializedFragment. Its output is then written in place of the node and its descendants.
+static BOOL OverridesSerializedFragment(HTMLNode *node)
+{
+    static IMP DefaultImplementation;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        DefaultImplementation = [HTMLNode instanceMethodForSelector:@selector(serializedFragment)];
+    });
+    return [node methodForSelector:@selector(serializedFragment)] != DefaultImplementation;
+}
+
+/**
+    Writes everything that comes before a node's children: an element's start tag, or the whole of any other kind of node.
+ 
+    @param parent The node's parent, which decides whether text is escaped.
+ 
+    @return YES if the node's children should be written next, or NO if the node is done.
+ */
+static BOOL WriteNodeStart(HTMLNode *node, HTMLNode *parent, HTMLSerializationSink *sink)
+{
+    if ([node isKindOfClass:[HTMLElement class]]) {
+        HTMLElement *element = (HTMLElement *)node;
+        NSString *tagName = element.tagName;
+        WriteASCII(sink, "<");
+        WriteString(sink, tagName, HTMLEscapeNothing);
+        HTMLElementEnumerateAttributes(element, ^(NSString *name, NSString *value, BOOL *stop) {
+            if ([name isEqualToString:@"xmlns:xmlns"]) {
+                name = @"xmlns";
+            }
+            if (![value isKindOfClass:[NSString class]]) {
+                value = value.description;
+            }
+            WriteASCII(sink, " ");
+            WriteString(sink, name, HTMLEscapeNothing);
+            WriteASCII(sink, "=\"");
+            WriteString(sink, value, HTMLEscapeAttribute);
+            WriteASCII(sink, "\"");
+        });
+        WriteASCII(sink, ">");
+        
+        if (TagNameIsAnyOf(tagName, @"area", @"base", @"basefont", @"bgsound", @"br", @"col", @"embed", @"frame", @"hr", @"img", @"input", @"keygen", @"link", @"menuitem", @"meta", @"param", @"source", @"track", @"wbr")) {
+            return NO;
+        }
+        
+        if (TagNameIsAnyOf(tagName, @"pre", @"textarea", @"listing")) {
+            HTMLNode *firstChild = element.numberOfChildren > 0 ? [element childAtIndex:0] : nil;
+            if ([firstChild isKindOfClass:[HTMLTextNode class]] && [((HTMLTextNode *)firstChild).data hasPrefix:@"\n"]) {
+                WriteASCII(sink, "\n");
+            }
+        }
+        return YES;
+    } else if ([node isKindOfClass:[HTMLTextNode class]]) {
+        NSString *parentTagName = [parent isKindOfClass:[HTMLElement class]] ? ((HTMLElement *)parent).tagName : nil;
+        if (TagNameIsAnyOf(parentTagName, @"style", @"script", @"xmp", @"iframe", @"noembed", @"noframes", @"plaintext", @"noscript")) {
+            WriteString(sink, ((HTMLTextNode *)node).data, HTMLEscapeNothing);
+        } else {
+            WriteString(sink, ((HTMLTextNode *)node).data, HTMLEscapeText);
+        }
+        return NO;
+    } else if ([node isKindOfClass:[HTMLComment class]]) {
+        WriteASCII(sink, "<!--");
+        WriteString(sink, ((HTMLComment *)node).data, HTMLEscapeNothing);
+        WriteASCII(sink, "-->");
+        return NO;
+    } else if ([node isKindOfClass:[HTMLDocumentType class]]) {
+        WriteASCII(sink, "<!DOCTYPE ");
+        WriteString(sink, ((HTMLDocumentType *)node).name ?: @"(null)", HTMLEscapeNothing);
+        WriteASCII(sink, ">");
+        return NO;
+    } else if ([node isKindOfClass:[HTMLDocument class]]) {
+        return YES;
+    } else if (OverridesSerializedFragment(node)) {
+        WriteString(sink, node.serializedFragment, HTMLEscapeNothing);
+        return NO;
+    } else {
+        [node doesNotRecognizeSelector:@selector(serializedFragment)];
+        return NO;
+    }
+}
+
+typedef struct {
+    // Retained, as nodes in an HTMLCompactDocument are only kept alive by whoever's using them.
+    CFTypeRef node;
+    
+    NSUInteger nextChildIndex;
+} HTMLSerializationFrame;
+
+/**
+    Serializes a subtree without recursing, so that deeply nested nodes neither grow the call stack nor get copied into intermediate strings.
+ 
+    @param includeRoot NO to write only the root's children (i.e. its inner HTML).
+ */
+static void WriteSubtree(HTMLNode *root, HTMLSerializationSink *sink, BOOL includeRoot)
+{
+    if (includeRoot && !WriteNodeStart(root, root.parentNode, sink)) return;
+    
+    NSUInteger capacity = 32;
+    NSUInteger count = 0;
+    HTMLSerializationFrame *stack = malloc(capacity * sizeof(*stack));
+    stack[count++] = (HTMLSerializationFrame){ .node = CFBridgingRetain(root) };
+    while (count > 0 && !sink->failed) {
+        HTMLNode *node = (__bridge HTMLNode *)stack[count - 1].node;
+        NSUInteger index = stack[count - 1].nextChildIndex;
+        if (index < node.numberOfChildren) {
+            stack[count - 1].nextChildIndex++;
+            HTMLNode *child = [node childAtIndex:index];
+            
+            // Only descendants get checked for an override. An override calling super ends up back here with its node as the root.
+            if (OverridesSerializedFragment(child)) {
+                WriteString(sink, child.serializedFragment, HTMLEscapeNothing);
+            } else if (WriteNodeStart(child, node, sink)) {
+                if (count == capacity) {
+                    capacity *= 2;
+                    stack = reallocf(stack, capacity * sizeof(*stack));
+                }
+                stack[count++] = (HTMLSerializationFrame){ .node = CFBridgingRetain(child) };
+            }
+        } else {
+            count--;
+            CFRelease(stack[count].node);
+            if ((count > 0 || includeRoot) && [node isKindOfClass:[HTMLElement class]]) {
+                WriteASCII(sink, "</");
+                WriteString(sink, ((HTMLElement *)node).tagName, HTMLEscapeNothing);
+                WriteASCII(sink, ">");
+            }
+        }
+    }
+    while (count > 0) {
+        CFRelease(stack[--count].node);
+    }
+    free(stack);
+}
+
 @implementation HTMLNode (Serialization)
 
 - (NSString *)recursiveDescription
@@ -34,14 +298,36 @@ static void RecursiveDescriptionHelper(HTMLNode *self, NSMutableString *string,
 
 - (NSString *)innerHTML
 {
-    NSArray *fragments = [self.children.array valueForKey:@"serializedFragment"];
-    return [fragments componentsJoinedByString:@""];
+    NSMutableData *data = [NSMutableData new];
+    HTMLSerializationSink sink = { .data = data };
+    WriteSubtree(self, &sink, NO);
+    FlushSink(&sink);
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
 }
 
 - (NSString *)serializedFragment
 {
-    [self doesNotRecognizeSelector:_cmd];
-    return nil;
+    NSMutableData *data = [NSMutableData new];
+    [self writeSerializedFragmentToData:data];
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+- (void)writeSerializedFragmentToData:(NSMutableData *)data
+{
+    HTMLSerializationSink sink = { .data = data };
+    WriteSubtree(self, &sink, YES);
+    FlushSink(&sink);
+}
+
+- (BOOL)writeSerializedFragmentToStream:(NSOutputStream *)stream error:(NSError * __autoreleasing *)error
+{
+    HTMLSerializationSink sink = { .stream = stream };
+    WriteSubtree(self, &sink, YES);
+    FlushSink(&sink);
+    if (sink.failed && error) {
+        *error = stream.streamError ?: [NSError errorWithDomain:NSPOSIXErrorDomain code:EIO userInfo:nil];
+    }
+    return !sink.failed;
 }
 
 @end
@@ -57,20 +343,6 @@ static void RecursiveDescriptionHelper(HTMLNode *self, NSMutableString *string,
     return [NSString stringWithFormat:@"<%@: %p <!-- %@ --> >", self.class, self, truncatedData];
 }
 
-- (NSString *)serializedFragment
-{
-    return [NSString stringWithFormat:@"<!--%@-->", self.data];
-}
-
-@end
-
-@implementation HTMLDocument (Serialization)
-
-- (NSString *)serializedFragment
-{
-    return self.innerHTML;
-}
-
 @end
 
 @implementation HTMLDocumentType (Serialization)
@@ -95,11 +367,6 @@ static void RecursiveDescriptionHelper(HTMLNode *self, NSMutableString *string,
     return description;
 }
 
-- (NSString *)serializedFragment
-{
-    return [NSString stringWithFormat:@"<!DOCTYPE %@>", self.name];
-}
-
 @end
 
 @implementation HTMLElement (Serialization)
@@ -130,49 +397,6 @@ static void RecursiveDescriptionHelper(HTMLNode *self, NSMutableString *string,
     return description;
 }
 
-- (NSString *)serializedFragment
-{
-    NSMutableString *fragment = [NSMutableString new];
-    [fragment appendFormat:@"<%@", self.tagName];
-    
-    [self.attributes enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *value, BOOL *stop) {
-        if ([name isEqualToString:@"xmlns:xmlns"]) {
-            name = @"xmlns";
-        }
-        if (![value isKindOfClass:[NSString class]]) {
-            value = value.description;
-        }
-        NSMutableString *escapedValue = [value mutableCopy];
-        void (^replace)(id, id) = ^(NSString *search, NSString *replace) {
-            NSRange range = NSMakeRange(0, escapedValue.length);
-            [escapedValue replaceOccurrencesOfString:search withString:replace options:0 range:range];
-        };
-        replace(@"&", @"&amp;");
-        replace(@"\u00A0", @"&nbsp;");
-        replace(@"\"", @"&quot;");
-        [fragment appendFormat:@" %@=\"%@\"", name, escapedValue];
-    }];
-
-    [fragment appendString:@">"];
-    
-    if (StringIsEqualToAnyOf(self.tagName, @"area", @"base", @"basefont", @"bgsound", @"br", @"col", @"embed", @"frame", @"hr", @"img", @"input", @"keygen", @"link", @"menuitem", @"meta", @"param", @"source", @"track", @"wbr")) {
-        return fragment;
-    }
-    
-    if (StringIsEqualToAnyOf(self.tagName, @"pre", @"textarea", @"listing")) {
-        if ([self.children.firstObject isKindOfClass:[HTMLTextNode class]]) {
-            HTMLTextNode *textNode = self.children.firstObject;
-            if ([textNode.data hasPrefix:@"\n"]) {
-                [fragment appendString:@"\n"];
-            }
-        }
-    }
-    
-    [fragment appendString:self.innerHTML];
-    [fragment appendFormat:@"</%@>", self.tagName];
-    return fragment;
-}
-
 @end
 
 @implementation HTMLTextNode (Serialization)
@@ -186,18 +410,4 @@ static void RecursiveDescriptionHelper(HTMLNode *self, NSMutableString *string,
     return [NSString stringWithFormat:@"<%@: %p '%@'>", self.class, self, truncatedData];
 }
 
-- (NSString *)serializedFragment
-{
-    NSString *parentTagName = self.parentElement.tagName;
-    if (StringIsEqualToAnyOf(parentTagName, @"style", @"script", @"xmp", @"iframe", @"noembed", @"noframes", @"plaintext", @"noscript")) {
-        return self.data;
-    } else {
-        NSString *escaped = [self.data stringByReplacingOccurrencesOfString:@"&" withString:@"&amp;"];
-        escaped = [escaped stringByReplacingOccurrencesOfString:@"\u00A0" withString:@"&nbsp;"];
-        escaped = [escaped stringByReplacingOccurrencesOfString:@"<" withString:@"&lt;"];
-        escaped = [escaped stringByReplacingOccurrencesOfString:@">" withString:@"&gt;"];
-        return escaped;
-    }
-}
-
 @end
@@ -0,0 +1,63 @@
+//  HTMLStreamingParser.h
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <Foundation/Foundation.h>
+#import "HTMLElement.h"
+#import "HTMLParseError.h"
+
+/**
+    An HTMLStreamingParser reports the contents of a document as a series of events, instead of building the whole document.
+ 
+    Parsing follows the same tree construction rules as HTMLParser, so implied end tags, foster parenting, and the rest all apply. Nodes are reported once the token that inserts them has been processed, and are then discarded. Only the elements that are still open are kept around, so memory use depends on how deeply the document nests rather than on how big it is.
+ 
+    Each event includes the node's depth (the number of elements it is inside) and the tag names of those elements, outermost first. For well-formed documents, events nest exactly like the parsed document. When the parser fixes misnested markup, events describe each node where it was inserted: text moved in front of a table is reported inside the table's parent after the table has started, and elements already reported are not reported again if they later move.
+ 
+    For more information, see http://www.whatwg.org/specs/web-apps/current-work/multipage/tree-construction.html
+ */
+@interface HTMLStreamingParser : NSObject
+
+/// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes a streaming parser with a string of HTML.
+- (instancetype)initWithString:(NSString *)string;
+
+/**
+    Initializes a streaming parser with some data of an unknown string encoding.
+ 
+    The encoding is determined up front, the same way as +[HTMLDocument documentWithData:contentTypeHeader:]. Events can't be taken back, so a <meta> tag that would change the encoding partway through is reported as a parse error instead.
+ 
+    @param contentType The value of the HTTP Content-Type header associated with the data, if any.
+ */
+- (instancetype)initWithData:(NSData *)data contentTypeHeader:(NSString *)contentType;
+
+/**
+    A block called when an element starts.
+ 
+    The element has its tag name, namespace, and attributes, but its children are reported separately. The ancestor names array is only valid until the block returns.
+ */
+@property (copy, nonatomic) void (^didStartElement)(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames);
+
+/// A block called when an element ends, with the same depth and ancestors it started with (unless the parser moved it in the meantime).
+@property (copy, nonatomic) void (^didEndElement)(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames);
+
+/// A block called with text. Adjacent text may be split over several calls.
+@property (copy, nonatomic) void (^foundText)(NSString *text, NSUInteger depth, NSArray *ancestorNames);
+
+/// A block called with a comment's data.
+@property (copy, nonatomic) void (^foundComment)(NSString *comment, NSUInteger depth, NSArray *ancestorNames);
+
+/// Parses the whole document, calling the blocks along the way. Only the first call does anything.
+- (void)parse;
+
+/// How much to record about parse errors. The default is HTMLParseErrorReportingFull. Set this before calling -parse.
+@property (assign, nonatomic) HTMLParseErrorReporting errorReporting;
+
+/// The number of parse errors encountered so far. Always zero when errorReporting is HTMLParseErrorReportingOff.
+@property (readonly, assign, nonatomic) NSUInteger numberOfErrors;
+
+/// Instances of NSString representing the errors encountered while parsing the document. Empty unless errorReporting is HTMLParseErrorReportingFull.
+@property (readonly, copy, nonatomic) NSArray *errors;
+
+@end
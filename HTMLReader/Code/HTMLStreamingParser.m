@@ -0,0 +1,230 @@
+//  HTMLStreamingParser.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import "HTMLStreamingParser.h"
+#import "HTMLComment.h"
+#import "HTMLEncoding.h"
+#import "HTMLNode+Private.h"
+#import "HTMLParser.h"
+#import "HTMLTextNode.h"
+
+@interface HTMLParser ()
+
+@property (readonly, strong, nonatomic) NSArray *stackOfOpenElements;
+@property (readonly, strong, nonatomic) HTMLElement *headElementPointer;
+@property (copy, nonatomic) void (^didProcessToken)(void);
+
+@end
+
+@interface HTMLStreamingParser ()
+
+- (instancetype)initWithParser:(HTMLParser *)parser NS_DESIGNATED_INITIALIZER;
+
+@end
+
+static BOOL IsOpen(NSArray *stackOfOpenElements, HTMLElement *element, NSUInteger depth)
+{
+    // Usually the path down the tree and the stack of open elements are one and the same.
+    if (depth < stackOfOpenElements.count && stackOfOpenElements[depth] == element) return YES;
+    return [stackOfOpenElements indexOfObjectIdenticalTo:element] != NSNotFound;
+}
+
+@implementation HTMLStreamingParser
+{
+    HTMLParser *_parser;
+    BOOL _parsed;
+    
+    // Elements that were reported as started and are still open.
+    NSHashTable *_startedElements;
+    
+    // Elements that were reported as ended but are kept in the tree, either because they still have children (which misnested markup can cause) or because the parser may insert more into them (the head element).
+    NSHashTable *_endedElements;
+    
+    // The path from the document to the node being reported.
+    NSMutableArray *_ancestorNames;
+    NSUInteger *_childIndexes;
+    NSUInteger _childIndexCapacity;
+}
+
+- (instancetype)initWithString:(NSString *)string
+{
+    HTMLStringEncoding encoding = (HTMLStringEncoding){
+        .encoding = NSUTF8StringEncoding,
+        .confidence = Tentative
+    };
+    return [self initWithParser:[[HTMLParser alloc] initWithString:string encoding:encoding context:nil]];
+}
+
+- (instancetype)initWithData:(NSData *)data contentTypeHeader:(NSString *)contentType
+{
+    HTMLStringEncoding encoding = DeterminedStringEncodingForData(data, contentType);
+    return [self initWithParser:[[HTMLParser alloc] initWithData:data encoding:encoding context:nil]];
+}
+
+- (instancetype)initWithParser:(HTMLParser *)parser
+{
+    if ((self = [super init])) {
+        _parser = parser;
+        _startedElements = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+        _endedElements = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+        _ancestorNames = [NSMutableArray new];
+    }
+    return self;
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (void)dealloc
+{
+    free(_childIndexes);
+}
+
+- (void)parse
+{
+    if (_parsed) return;
+    _parsed = YES;
+    __weak __typeof__(self) weakSelf = self;
+    _parser.didProcessToken = ^{
+        [weakSelf reportFinishedNodes];
+    };
+    [_parser document];
+    _parser.didProcessToken = nil;
+}
+
+- (HTMLParseErrorReporting)errorReporting
+{
+    return _parser.errorReporting;
+}
+
+- (void)setErrorReporting:(HTMLParseErrorReporting)errorReporting
+{
+    _parser.errorReporting = errorReporting;
+}
+
+- (NSUInteger)numberOfErrors
+{
+    return _parser.numberOfErrors;
+}
+
+- (NSArray *)errors
+{
+    return _parser.errors;
+}
+
+#pragma mark Reporting
+
+/**
+    Walks the parser's tree in order, reporting new nodes and discarding the ones that are finished.
+ 
+    Finished nodes are removed as they're reported, so what remains between tokens is the open elements plus anything just inserted. The walk only has to visit those.
+ */
+- (void)reportFinishedNodes
+{
+    HTMLDocument *document = _parser.document;
+    NSArray *stackOfOpenElements = _parser.stackOfOpenElements;
+    HTMLElement *head = _parser.headElementPointer;
+    NSUInteger startedElementsVisited = 0;
+    
+    HTMLNode *parent = document;
+    NSUInteger index = 0;
+    for (;;) {
+        if (index < parent.numberOfChildren) {
+            HTMLNode *child = [parent childAtIndex:index];
+            if ([child isKindOfClass:[HTMLElement class]]) {
+                HTMLElement *element = (HTMLElement *)child;
+                if ([_startedElements containsObject:element]) {
+                    startedElementsVisited++;
+                } else if (![_endedElements containsObject:element]) {
+                    if (_didStartElement) {
+                        _didStartElement(element, _ancestorNames.count, _ancestorNames);
+                    }
+                    if (IsOpen(stackOfOpenElements, element, _ancestorNames.count)) {
+                        [_startedElements addObject:element];
+                    }
+                }
+                [self pushAncestor:element index:index];
+                parent = element;
+                index = 0;
+            } else {
+                if ([child isKindOfClass:[HTMLTextNode class]]) {
+                    if (_foundText) {
+                        _foundText(((HTMLTextNode *)child).data, _ancestorNames.count, _ancestorNames);
+                    }
+                } else if ([child isKindOfClass:[HTMLComment class]]) {
+                    if (_foundComment) {
+                        _foundComment(((HTMLComment *)child).data, _ancestorNames.count, _ancestorNames);
+                    }
+                }
+                [parent removeChild:child];
+            }
+        } else if (parent == document) {
+            break;
+        } else {
+            HTMLElement *element = (HTMLElement *)parent;
+            index = [self popAncestor];
+            parent = element.parentNode;
+            if (IsOpen(stackOfOpenElements, element, _ancestorNames.count)) {
+                index++;
+                continue;
+            }
+            if ([_startedElements containsObject:element]) {
+                [_startedElements removeObject:element];
+                startedElementsVisited--;
+            }
+            if (![_endedElements containsObject:element]) {
+                if (_didEndElement) {
+                    _didEndElement(element, _ancestorNames.count, _ancestorNames);
+                }
+            }
+            if (element.numberOfChildren == 0 && element != head) {
+                [_endedElements removeObject:element];
+                [parent removeChild:element];
+            } else {
+                [_endedElements addObject:element];
+                index++;
+            }
+        }
+    }
+    
+    if (startedElementsVisited < _startedElements.count) {
+        [self reportDetachedElementsFromDocument:document];
+    }
+}
+
+// Open elements can be taken out of the document altogether (e.g. the body, when a frameset replaces it). They're as good as ended.
+- (void)reportDetachedElementsFromDocument:(HTMLDocument *)document
+{
+    for (HTMLElement *element in _startedElements.allObjects) {
+        if (element.document == document) continue;
+        [_startedElements removeObject:element];
+        if (_didEndElement) {
+            NSMutableArray *ancestorNames = [NSMutableArray new];
+            for (HTMLElement *ancestor = element.parentElement; ancestor; ancestor = ancestor.parentElement) {
+                [ancestorNames insertObject:ancestor.tagName atIndex:0];
+            }
+            _didEndElement(element, ancestorNames.count, ancestorNames);
+        }
+    }
+}
+
+- (void)pushAncestor:(HTMLElement *)element index:(NSUInteger)index
+{
+    NSUInteger depth = _ancestorNames.count;
+    if (depth == _childIndexCapacity) {
+        _childIndexCapacity = MAX(_childIndexCapacity * 2, 16);
+        _childIndexes = reallocf(_childIndexes, _childIndexCapacity * sizeof(*_childIndexes));
+    }
+    _childIndexes[depth] = index;
+    [_ancestorNames addObject:element.tagName];
+}
+
+// Returns the element's index in its parent, as it was when the element was pushed.
+- (NSUInteger)popAncestor
+{
+    [_ancestorNames removeLastObject];
+    return _childIndexes[_ancestorNames.count];
+}
+
+@end
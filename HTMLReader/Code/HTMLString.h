@@ -25,6 +25,16 @@ extern void EnumerateLongCharacters(NSString *self, void (^block)(UTF32Char char
 /// Returns a string consisting solely of the character.
 extern NSString * StringWithLongCharacter(UTF32Char character);
 
+/**
+    Returns the index of the first code unit that is in a set, or length if none of them are.
+ 
+    Looks at 8 code units at a time where the vector instructions are part of the baseline architecture (SSE2 on x86-64, NEON on arm64).
+ 
+    @param set The code units to look for.
+    @param setCount The number of code units in the set, at most 8.
+ */
+extern NSUInteger IndexOfFirstCodeUnitInSet(const UniChar *units, NSUInteger length, const UniChar *set, NSUInteger setCount);
+
 /**
     Whether or not the character is a whitespace character.
  
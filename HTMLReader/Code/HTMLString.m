@@ -4,6 +4,12 @@
 
 #import "HTMLString.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 void AppendLongCharacter(NSMutableString *self, UTF32Char character)
 {
     unichar surrogates[2];
@@ -46,6 +52,50 @@ NSString * StringWithLongCharacter(UTF32Char character)
     }
 }
 
+NSUInteger IndexOfFirstCodeUnitInSet(const UniChar *units, NSUInteger length, const UniChar *set, NSUInteger setCount)
+{
+    NSCParameterAssert(setCount <= 8);
+    NSUInteger i = 0;
+#if defined(__SSE2__)
+    __m128i targets[8];
+    for (NSUInteger j = 0; j < setCount; j++) {
+        targets[j] = _mm_set1_epi16((short)set[j]);
+    }
+    for (; i + 8 <= length; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(units + i));
+        __m128i found = _mm_setzero_si128();
+        for (NSUInteger j = 0; j < setCount; j++) {
+            found = _mm_or_si128(found, _mm_cmpeq_epi16(v, targets[j]));
+        }
+        int mask = _mm_movemask_epi8(found);
+        if (mask) {
+            return i + __builtin_ctz(mask) / 2;
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    uint16x8_t targets[8];
+    for (NSUInteger j = 0; j < setCount; j++) {
+        targets[j] = vdupq_n_u16(set[j]);
+    }
+    for (; i + 8 <= length; i += 8) {
+        uint16x8_t v = vld1q_u16(units + i);
+        uint16x8_t found = vdupq_n_u16(0);
+        for (NSUInteger j = 0; j < setCount; j++) {
+            found = vorrq_u16(found, vceqq_u16(v, targets[j]));
+        }
+        
+        // NEON has no cheap way to find the first set lane, so let the scalar loop pin it down.
+        if (vmaxvq_u16(found)) break;
+    }
+#endif
+    for (; i < length; i++) {
+        for (NSUInteger j = 0; j < setCount; j++) {
+            if (units[i] == set[j]) return i;
+        }
+    }
+    return length;
+}
+
 BOOL is_whitespace(UTF32Char c)
 {
     return c == '\t' || c == '\n' || c == '\f' || c == ' ';
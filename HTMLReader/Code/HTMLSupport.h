@@ -22,6 +22,9 @@
 #ifndef NS_ENUM
 #   define NS_ENUM(_type, _name) _type _name; enum
 #endif
+#ifndef NS_OPTIONS
+#   define NS_OPTIONS(_type, _name) _type _name; enum
+#endif
 
 // -[NSArray firstObject] was only publicly exposed in iOS 7 and OS X 10.9, but it was implemented much earlier.
 #if (__IPHONE_OS_VERSION_MIN_REQUIRED >= 40000 && __IPHONE_OS_VERSION_MIN_REQUIRED < 70000) || \
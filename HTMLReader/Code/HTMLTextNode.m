@@ -3,6 +3,7 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLTextNode.h"
+#import "HTMLNode+Private.h"
 
 @implementation HTMLTextNode
 {
@@ -25,6 +26,7 @@
 - (void)appendString:(NSString *)string
 {
     [_data appendString:string];
+    HTMLNodeTextDidChange(self);
 }
 
 - (NSString *)data
@@ -32,6 +34,18 @@
     return [_data copy];
 }
 
+- (NSString *)uncopiedData
+{
+    return _data;
+}
+
+- (void)addToMemoryTally:(HTMLMemoryTally *)tally
+{
+    [super addToMemoryTally:tally];
+    tally->numberOfTextNodes++;
+    tally->textBytes += HTMLEstimatedStringSize(_data);
+}
+
 #pragma mark NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
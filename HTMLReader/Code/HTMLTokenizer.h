@@ -5,6 +5,7 @@
 #import <Foundation/Foundation.h>
 #import "HTMLOrderedDictionary.h"
 #import "HTMLParser.h"
+#import "HTMLPreprocessedInputStream.h"
 #import "HTMLTokenizerState.h"
 
 /**
@@ -18,17 +19,52 @@
 - (instancetype)init NS_UNAVAILABLE;
 
 /// Initializes a tokenizer.
-- (instancetype)initWithString:(NSString *)string NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithString:(NSString *)string;
+
+/// Initializes a tokenizer that takes its characters from an input stream, such as one reading UTF-8 data.
+- (instancetype)initWithInputStream:(HTMLPreprocessedInputStream *)inputStream NS_DESIGNATED_INITIALIZER;
 
 /// The string where tokens come from.
 @property (readonly, copy, nonatomic) NSString *string;
 
+/// Starts over from the beginning of another input stream, in the data state. Pooled tokens and interned names are kept, so tokenizing lots of short strings in a row doesn't set them up each time.
+- (void)resetWithInputStream:(HTMLPreprocessedInputStream *)inputStream;
+
+/**
+    YES if more of the string may be added by -appendString:, or NO if the string is complete. The default is NO.
+ 
+    While open, the tokenizer only emits tokens it knows are complete. When it runs out of input, -nextObject returns nil, and tokenizing resumes where it left off once more of the string is appended or the tokenizer is closed.
+ */
+@property (assign, nonatomic, getter=isOpen) BOOL open;
+
+/// Adds to the end of the string, when the tokenizer is open.
+- (void)appendString:(NSString *)string;
+
+/// Adds UTF-8 encoded characters to the end of the string, when the tokenizer is open. The data may end partway through a character.
+- (void)appendUTF8Data:(NSData *)data;
+
 /// The current state of the tokenizer. Sometimes the parser needs to change this.
 @property (assign, nonatomic) HTMLTokenizerState state;
 
 /// The parser that is consuming the tokenizer's tokens. Sometimes the tokenizer needs to know the parser's state.
 @property (weak, nonatomic) HTMLParser *parser;
 
+/// How much to record about parse errors. HTMLParseErrorToken instances are only emitted when this is HTMLParseErrorReportingFull, which is the default.
+@property (assign, nonatomic) HTMLParseErrorReporting errorReporting;
+
+/// The number of parse errors encountered so far. Always zero when errorReporting is HTMLParseErrorReportingOff.
+@property (readonly, assign, nonatomic) NSUInteger numberOfErrors;
+
+/// Gets how far the tokenizer has got through its input, counting lines and columns from 1.
+- (void)getLine:(out NSUInteger *)line column:(out NSUInteger *)column;
+
+/**
+    Gives a token back to the tokenizer once it's no longer needed, so it can be reused instead of allocating another.
+ 
+    Only recycle a token that came from this tokenizer and that nothing else refers to. The tokenizer may change it and emit it again.
+ */
+- (void)recycleToken:(id)token;
+
 @end
 
 /// An HTMLDOCTYPEToken represents a `<!DOCTYPE>` tag.
@@ -120,11 +156,24 @@
 @interface HTMLParseErrorToken : NSObject
 
 /// @param error The reason for the parse error.
-- (instancetype)initWithError:(NSString *)error NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithError:(NSString *)error;
+
+/**
+    @param error  The reason for the parse error.
+    @param line   The line where the error happened, counting from 1, or 0 if unknown.
+    @param column The column where the error happened, counting from 1, or 0 if unknown.
+ */
+- (instancetype)initWithError:(NSString *)error line:(NSUInteger)line column:(NSUInteger)column NS_DESIGNATED_INITIALIZER;
 
 /// The reason for the parse error.
 @property (readonly, copy, nonatomic) NSString *error;
 
+/// The line where the error happened, counting from 1, or 0 if unknown.
+@property (readonly, assign, nonatomic) NSUInteger line;
+
+/// The column where the error happened, counting from 1, or 0 if unknown.
+@property (readonly, assign, nonatomic) NSUInteger column;
+
 @end
 
 /// A single HTMLEOFToken is emitted when the end of the file is parsed and no further tokens will be emitted.
@@ -3,6 +3,8 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLTokenizer.h"
+#import "HTMLAtom.h"
+#import "HTMLAttributeStorage.h"
 #import "HTMLEntities.h"
 #import "HTMLParser.h"
 #import "HTMLPreprocessedInputStream.h"
@@ -12,6 +14,12 @@
 
 - (void)appendLongCharacterToTagName:(UTF32Char)character;
 
+/// Replaces any appended characters with an atom from the table.
+- (void)internTagNameUsingTable:(HTMLAtomTable *)atoms;
+
+/// Empties the tag name and attributes so the token can be emitted again.
+- (void)prepareForReuse;
+
 @end
 
 @interface HTMLDOCTYPEToken ()
@@ -29,6 +37,29 @@
 
 @end
 
+@interface HTMLCharacterToken ()
+
+- (void)appendString:(NSString *)string;
+- (void)appendLongCharacter:(UTF32Char)character;
+
+/// Replaces the token's characters so it can be emitted again.
+- (void)resetWithString:(NSString *)string;
+
+@end
+
+@interface HTMLParseErrorToken ()
+
+/// Replaces the token's error so it can be emitted again.
+- (void)resetWithError:(NSString *)error line:(NSUInteger)line column:(NSUInteger)column;
+
+@end
+
+// Emitted tokens wait in a ring buffer until they're handed over. It only grows if a single step emits more tokens than fit, which is rare.
+static const NSUInteger InitialTokenCapacity = 16;
+
+// The parser usually recycles each token right after it's processed, so a handful of spares per class is plenty.
+static const NSUInteger MaximumPooledTokenCount = 8;
+
 @interface HTMLParser ()
 
 @property (readonly, strong, nonatomic) HTMLElement *adjustedCurrentNode;
@@ -39,7 +70,14 @@
 {
     HTMLPreprocessedInputStream *_inputStream;
     HTMLTokenizerState _state;
-    NSMutableArray *_tokenQueue;
+    __strong id *_tokens;
+    NSUInteger _tokenCapacity;
+    NSUInteger _firstToken;
+    NSUInteger _tokenCount;
+    NSMutableArray *_characterTokenPool;
+    NSMutableArray *_parseErrorTokenPool;
+    NSMutableArray *_startTagTokenPool;
+    NSMutableArray *_endTagTokenPool;
     NSMutableString *_characterBuffer;
     id _currentToken;
     HTMLTokenizerState _sourceAttributeValueState;
@@ -49,23 +87,75 @@
     UTF32Char _additionalAllowedCharacter;
     NSString *_mostRecentEmittedStartTagName;
     BOOL _done;
+    HTMLTokenizerState _checkpointState;
+    NSString *_checkpointMostRecentEmittedStartTagName;
+    NSUInteger _checkpointTokenCount;
+    NSUInteger _checkpointNumberOfErrors;
+    HTMLAtomTable *_atoms;
+    HTMLParseErrorReporting _errorReporting;
+    NSUInteger _numberOfErrors;
 }
 
 - (id)initWithString:(NSString *)string
+{
+    return [self initWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithString:string]];
+}
+
+- (id)initWithInputStream:(HTMLPreprocessedInputStream *)inputStream
 {
     self = [super init];
     if (!self) return nil;
     
-    _inputStream = [[HTMLPreprocessedInputStream alloc] initWithString:string];
+    [self setInputStream:inputStream];
+    self.state = HTMLDataTokenizerState;
+    _errorReporting = HTMLParseErrorReportingFull;
+    _tokenCapacity = InitialTokenCapacity;
+    _tokens = (__strong id *)calloc(_tokenCapacity, sizeof(id));
+    _characterTokenPool = [NSMutableArray new];
+    _parseErrorTokenPool = [NSMutableArray new];
+    _startTagTokenPool = [NSMutableArray new];
+    _endTagTokenPool = [NSMutableArray new];
+    _characterBuffer = [NSMutableString new];
+    _atoms = [HTMLAtomTable new];
+    
+    return self;
+}
+
+- (void)setInputStream:(HTMLPreprocessedInputStream *)inputStream
+{
+    _inputStream = inputStream;
     __weak __typeof__(self) weakSelf = self;
     [_inputStream setErrorBlock:^(NSString *error) {
         [weakSelf emitParseError:@"%@", error];
     }];
+}
+
+- (void)resetWithInputStream:(HTMLPreprocessedInputStream *)inputStream
+{
+    [self setInputStream:inputStream];
     self.state = HTMLDataTokenizerState;
-    _tokenQueue = [NSMutableArray new];
-    _characterBuffer = [NSMutableString new];
-    
-    return self;
+    while (_tokenCount > 0) {
+        [self dequeueToken];
+    }
+    _firstToken = 0;
+    _currentToken = nil;
+    _currentAttributeName = nil;
+    _currentAttributeValue = nil;
+    _temporaryBuffer = nil;
+    _mostRecentEmittedStartTagName = nil;
+    _done = NO;
+    _checkpointMostRecentEmittedStartTagName = nil;
+    _checkpointTokenCount = 0;
+    _checkpointNumberOfErrors = 0;
+    _numberOfErrors = 0;
+}
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _tokenCapacity; i++) {
+        _tokens[i] = nil;
+    }
+    free(_tokens);
 }
 
 - (NSString *)string
@@ -73,6 +163,26 @@
     return _inputStream.string;
 }
 
+- (BOOL)isOpen
+{
+    return _inputStream.open;
+}
+
+- (void)setOpen:(BOOL)open
+{
+    _inputStream.open = open;
+}
+
+- (void)appendString:(NSString *)string
+{
+    [_inputStream appendString:string];
+}
+
+- (void)appendUTF8Data:(NSData *)data
+{
+    [_inputStream appendUTF8Data:data];
+}
+
 - (void)setLastStartTag:(NSString *)tagName
 {
     _mostRecentEmittedStartTagName = [tagName copy];
@@ -80,13 +190,14 @@
 
 - (void)dataState
 {
-    NSString *string = [self consumeCharactersUpToFirstPassingTest:^BOOL(UTF32Char c) {
+    NSString *string = [self consumeTextUpToFirstPassingTest:^BOOL(UTF32Char c) {
         if (c == '\0') {
             [self emitParseError:@"U+0000 NULL in data state"];
         }
         return c == '&' || c == '<';
     }];
     [self emitCharacterTokenWithString:string];
+    if (_inputStream.awaitingInput) return;
     switch ([self consumeNextInputCharacter]) {
         case '&':
             return [self switchToState:HTMLCharacterReferenceInDataTokenizerState];
@@ -112,13 +223,14 @@
 
 - (void)RCDATAState
 {
-    NSString *string = [self consumeCharactersUpToFirstPassingTest:^BOOL(UTF32Char c) {
+    NSString *string = [self consumeTextUpToFirstPassingTest:^BOOL(UTF32Char c) {
         if (c == '\0') {
             [self emitParseError:@"U+0000 NULL in RCDATA state"];
         }
         return c == '&' || c == '<';
     }];
     [self emitCharacterTokenWithString:[string stringByReplacingOccurrencesOfString:@"\0" withString:@"\uFFFD"]];
+    if (_inputStream.awaitingInput) return;
     switch ([self consumeNextInputCharacter]) {
         case '&':
             return [self switchToState:HTMLCharacterReferenceInRCDATATokenizerState];
@@ -144,13 +256,14 @@
 
 - (void)RAWTEXTState
 {
-    NSString *string = [self consumeCharactersUpToFirstPassingTest:^BOOL(UTF32Char c) {
+    NSString *string = [self consumeTextUpToFirstPassingTest:^BOOL(UTF32Char c) {
         if (c == '\0') {
             [self emitParseError:@"U+0000 NULL in RAWTEXT state"];
         }
         return c == '<';
     }];
     [self emitCharacterTokenWithString:[string stringByReplacingOccurrencesOfString:@"\0" withString:@"\uFFFD"]];
+    if (_inputStream.awaitingInput) return;
     switch ([self consumeNextInputCharacter]) {
         case '<':
             return [self switchToState:HTMLRAWTEXTLessThanSignTokenizerState];
@@ -162,13 +275,14 @@
 
 - (void)scriptDataState
 {
-    NSString *string = [self consumeCharactersUpToFirstPassingTest:^BOOL(UTF32Char c) {
+    NSString *string = [self consumeTextUpToFirstPassingTest:^BOOL(UTF32Char c) {
         if (c == '\0') {
             [self emitParseError:@"U+0000 NULL in script data state"];
         }
         return c == '<';
     }];
     [self emitCharacterTokenWithString:[string stringByReplacingOccurrencesOfString:@"\0" withString:@"\uFFFD"]];
+    if (_inputStream.awaitingInput) return;
     switch ([self consumeNextInputCharacter]) {
         case '<':
             return [self switchToState:HTMLScriptDataLessThanSignTokenizerState];
@@ -180,13 +294,14 @@
 
 - (void)PLAINTEXTState
 {
-    NSString *string = [self consumeCharactersUpToFirstPassingTest:^BOOL(UTF32Char c) {
+    NSString *string = [self consumeTextUpToFirstPassingTest:^BOOL(UTF32Char c) {
         if (c == '\0') {
             [self emitParseError:@"U+0000 NULL in PLAINTEXT state"];
         }
         return NO;
     }];
     [self emitCharacterTokenWithString:[string stringByReplacingOccurrencesOfString:@"\0" withString:@"\uFFFD"]];
+    if (_inputStream.awaitingInput) return;
     _done = YES;
 }
 
@@ -218,7 +333,7 @@ static inline BOOL is_lower(NSInteger c)
             break;
         default:
             if (is_upper(c) || is_lower(c)) {
-                _currentToken = [HTMLStartTagToken new];
+                _currentToken = [self newStartTagToken];
                 unichar toAppend = c + (is_upper(c) ? 0x0020 : 0);
                 [_currentToken appendLongCharacterToTagName:toAppend];
                 [self switchToState:HTMLTagNameTokenizerState];
@@ -248,7 +363,7 @@ static inline BOOL is_lower(NSInteger c)
             break;
         default:
             if (is_upper(c) || is_lower(c)) {
-                _currentToken = [HTMLEndTagToken new];
+                _currentToken = [self newEndTagToken];
                 unichar toAppend = c + (is_upper(c) ? 0x0020 : 0);
                 [_currentToken appendLongCharacterToTagName:toAppend];
                 [self switchToState:HTMLTagNameTokenizerState];
@@ -314,12 +429,12 @@ static inline BOOL is_lower(NSInteger c)
 {
     UTF32Char c = [self consumeNextInputCharacter];
     if (is_upper(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c + 0x0020];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLRCDATAEndTagNameTokenizerState];
     } else if (is_lower(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLRCDATAEndTagNameTokenizerState];
@@ -388,12 +503,12 @@ static inline BOOL is_lower(NSInteger c)
 {
     UTF32Char c = [self consumeNextInputCharacter];
     if (is_upper(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c + 0x0020];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLRAWTEXTEndTagNameTokenizerState];
     } else if (is_lower(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLRAWTEXTEndTagNameTokenizerState];
@@ -469,12 +584,12 @@ static inline BOOL is_lower(NSInteger c)
 {
     UTF32Char c = [self consumeNextInputCharacter];
     if (is_upper(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c + 0x0020];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLScriptDataEndTagNameTokenizerState];
     } else if (is_lower(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLScriptDataEndTagNameTokenizerState];
@@ -667,12 +782,12 @@ static inline BOOL is_lower(NSInteger c)
 {
     UTF32Char c = [self consumeNextInputCharacter];
     if (is_upper(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c + 0x0020];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLScriptDataEscapedEndTagNameTokenizerState];
     } else if (is_lower(c)) {
-        _currentToken = [HTMLEndTagToken new];
+        _currentToken = [self newEndTagToken];
         [_currentToken appendLongCharacterToTagName:(UTF32Char)c];
         AppendLongCharacter(_temporaryBuffer, (UTF32Char)c);
         [self switchToState:HTMLScriptDataEscapedEndTagNameTokenizerState];
@@ -2165,6 +2280,11 @@ static inline BOOL is_lower(NSInteger c)
     return [_inputStream consumeCharactersUpToFirstPassingTest:test];
 }
 
+- (NSString *)consumeTextUpToFirstPassingTest:(BOOL(^)(UTF32Char c))test
+{
+    return [_inputStream consumeTextUpToFirstPassingTest:test];
+}
+
 - (void)switchToState:(HTMLTokenizerState)state
 {
     self.state = state;
@@ -2177,6 +2297,9 @@ static inline BOOL is_lower(NSInteger c)
 
 - (void)emit:(id)token
 {
+    if ([token isKindOfClass:[HTMLTagToken class]]) {
+        [token internTagNameUsingTable:_atoms];
+    }
     if ([token isKindOfClass:[HTMLStartTagToken class]]) {
         _mostRecentEmittedStartTagName = [token tagName];
     }
@@ -2191,27 +2314,115 @@ static inline BOOL is_lower(NSInteger c)
 
 - (void)emitCore:(id)token
 {
-    [_tokenQueue addObject:token];
+    if (_tokenCount == _tokenCapacity) {
+        NSUInteger capacity = _tokenCapacity * 2;
+        __strong id *tokens = (__strong id *)calloc(capacity, sizeof(id));
+        for (NSUInteger i = 0; i < _tokenCount; i++) {
+            NSUInteger slot = (_firstToken + i) & (_tokenCapacity - 1);
+            tokens[i] = _tokens[slot];
+            _tokens[slot] = nil;
+        }
+        free(_tokens);
+        _tokens = tokens;
+        _tokenCapacity = capacity;
+        _firstToken = 0;
+    }
+    _tokens[(_firstToken + _tokenCount) & (_tokenCapacity - 1)] = token;
+    _tokenCount++;
 }
 
+- (void)getLine:(out NSUInteger *)line column:(out NSUInteger *)column
+{
+    [_inputStream getLine:line column:column];
+}
+
+// Nothing is formatted or allocated unless errors are fully reported.
 - (void)emitParseError:(NSString *)format, ... NS_FORMAT_FUNCTION(1, 2)
 {
+    if (_errorReporting == HTMLParseErrorReportingOff) return;
+    _numberOfErrors++;
+    if (_errorReporting == HTMLParseErrorReportingCount) return;
+    
     va_list args;
     va_start(args, format);
     NSString *error = [[NSString alloc] initWithFormat:format arguments:args];
     va_end(args);
-    [self emit:[[HTMLParseErrorToken alloc] initWithError:error]];
+    NSUInteger line, column;
+    [_inputStream getLine:&line column:&column];
+    HTMLParseErrorToken *token = [_parseErrorTokenPool lastObject];
+    if (token) {
+        [_parseErrorTokenPool removeLastObject];
+        [token resetWithError:error line:line column:column];
+    } else {
+        token = [[HTMLParseErrorToken alloc] initWithError:error line:line column:column];
+    }
+    [self emit:token];
 }
 
 - (void)emitCharacterToken:(UTF32Char)character
 {
-    [self emit:[[HTMLCharacterToken alloc] initWithString:StringWithLongCharacter(character)]];
+    HTMLCharacterToken *token = [self characterTokenToExtend];
+    if (token) {
+        [token appendLongCharacter:character];
+    } else {
+        [self emitNewCharacterTokenWithString:StringWithLongCharacter(character)];
+    }
 }
 
 - (void)emitCharacterTokenWithString:(NSString *)string
 {
-    if (string.length > 0) {
-        [self emit:[[HTMLCharacterToken alloc] initWithString:string]];
+    if (string.length == 0) return;
+    HTMLCharacterToken *token = [self characterTokenToExtend];
+    if (token) {
+        [token appendString:string];
+    } else {
+        [self emitNewCharacterTokenWithString:string];
+    }
+}
+
+- (void)emitNewCharacterTokenWithString:(NSString *)string
+{
+    HTMLCharacterToken *token = [_characterTokenPool lastObject];
+    if (token) {
+        [_characterTokenPool removeLastObject];
+        [token resetWithString:string];
+    } else {
+        token = [[HTMLCharacterToken alloc] initWithString:string];
+    }
+    [self emit:token];
+}
+
+// Adjacent character data goes into one token, so long as that token hasn't been handed over or passed a checkpoint.
+- (HTMLCharacterToken *)characterTokenToExtend
+{
+    if (_tokenCount <= _checkpointTokenCount) return nil;
+    id token = _tokens[(_firstToken + _tokenCount - 1) & (_tokenCapacity - 1)];
+    if ([token isKindOfClass:[HTMLCharacterToken class]]) {
+        return token;
+    } else {
+        return nil;
+    }
+}
+
+- (HTMLStartTagToken *)newStartTagToken
+{
+    HTMLStartTagToken *token = [_startTagTokenPool lastObject];
+    if (token) {
+        [_startTagTokenPool removeLastObject];
+        return token;
+    } else {
+        return [HTMLStartTagToken new];
+    }
+}
+
+- (HTMLEndTagToken *)newEndTagToken
+{
+    HTMLEndTagToken *token = [_endTagTokenPool lastObject];
+    if (token) {
+        [_endTagTokenPool removeLastObject];
+        return token;
+    } else {
+        return [HTMLEndTagToken new];
     }
 }
 
@@ -2231,10 +2442,9 @@ static inline BOOL is_lower(NSInteger c)
 - (void)addCurrentAttributeToCurrentToken
 {
     HTMLTagToken *token = _currentToken;
-    if (token.attributes[_currentAttributeName]) {
+    NSString *name = [_atoms atomForName:_currentAttributeName];
+    if (!HTMLAttributeStorageAdd(HTMLOrderedDictionaryStorage(token.attributes), name, _currentAttributeValue ?: @"")) {
         [self emitParseError:@"Duplicate attribute"];
-    } else {
-        token.attributes[_currentAttributeName] = _currentAttributeValue ?: @"";
     }
     _currentAttributeName = nil;
     _currentAttributeValue = nil;
@@ -2301,29 +2511,26 @@ static inline BOOL is_lower(NSInteger c)
             return StringWithLongCharacter(number);
         }
         default: {
-            NSString *substring = [_inputStream nextUnprocessedCharactersWithMaximumLength:LongestEntityNameLength];
-            NSString *parsedName;
-            NSString *replacement = StringForNamedEntity(substring, &parsedName);
+            NSUInteger nameLength;
+            BOOL semicolon;
+            NSString *replacement = [_inputStream consumeNamedCharacterReferenceWithNameLength:&nameLength semicolon:&semicolon];
             if (!replacement) {
-                NSScanner *scanner = [_inputStream unprocessedScanner];
-                NSCharacterSet *alphanumeric = [NSCharacterSet alphanumericCharacterSet];
-                if ([scanner scanCharactersFromSet:alphanumeric intoString:nil] && [scanner scanString:@";" intoString:nil]) {
+                if ([_inputStream nextCharactersAreAlphanumericFollowedBySemicolon]) {
                     [self emitParseError:@"Unknown named entity with semicolon"];
                 }
                 return nil;
             }
-            [_inputStream consumeString:parsedName matchingCase:YES];
-            if (![parsedName hasSuffix:@";"] && partOfAnAttribute) {
+            if (!semicolon && partOfAnAttribute) {
                 UTF32Char next = _inputStream.nextInputCharacter;
                 if (next == '=' || [[NSCharacterSet alphanumericCharacterSet] characterIsMember:next]) {
-                    [_inputStream unconsumeInputCharacters:parsedName.length];
+                    [_inputStream unconsumeInputCharacters:nameLength];
                     if (next == '=') {
                         [self emitParseError:@"Named entity in attribute ending with ="];
                     }
                     return nil;
                 }
             }
-            if (![parsedName hasSuffix:@";"]) {
+            if (!semicolon) {
                 [self emitParseError:@"Named entity missing semicolon"];
             }
             return replacement;
@@ -2335,15 +2542,183 @@ static inline BOOL is_lower(NSInteger c)
 
 - (id)nextObject
 {
-    while (!_done && _tokenQueue.count == 0) {
+    if (!_inputStream.open) {
+        _checkpointTokenCount = 0;
+        while (!_done && (_tokenCount == 0 || [self shouldContinueCharacterRun])) {
+            [self resume];
+        }
+        return [self dequeueToken];
+    }
+    
+    for (;;) {
+        if ([self canCheckpoint]) {
+            [self checkpoint];
+        }
+        if (_checkpointTokenCount > 0) {
+            _checkpointTokenCount--;
+            return [self dequeueToken];
+        }
+        if (_done || (_inputStream.awaitingInput && [self canCheckpoint]) || !_inputStream.awaitedCharacterHasArrived) {
+            return nil;
+        }
         [self resume];
+        if (_inputStream.starved) {
+            char awaitedCharacter = [self characterNeededToFinishToken];
+            [self rewindToCheckpoint];
+            if (awaitedCharacter) {
+                [_inputStream awaitCharacter:awaitedCharacter];
+            }
+            return nil;
+        }
     }
-    if (_tokenQueue.count == 0) return nil;
-    id token = _tokenQueue[0];
-    [_tokenQueue removeObjectAtIndex:0];
+}
+
+- (id)dequeueToken
+{
+    if (_tokenCount == 0) return nil;
+    id token = _tokens[_firstToken];
+    _tokens[_firstToken] = nil;
+    _firstToken = (_firstToken + 1) & (_tokenCapacity - 1);
+    _tokenCount--;
     return token;
 }
 
+/**
+    Returns YES if the most recently emitted token holds character data that the next step will add to.
+ 
+    Only text and character references keep going. Anything that starts at a `<` might lead to a tag that changes the parser's state (and, in turn, ours), so the characters so far get handed over first.
+ */
+- (BOOL)shouldContinueCharacterRun
+{
+    if (![self characterTokenToExtend]) return NO;
+    switch (_state) {
+        case HTMLDataTokenizerState:
+        case HTMLCharacterReferenceInDataTokenizerState:
+        case HTMLRCDATATokenizerState:
+        case HTMLCharacterReferenceInRCDATATokenizerState:
+        case HTMLRAWTEXTTokenizerState:
+        case HTMLScriptDataTokenizerState:
+        case HTMLPLAINTEXTTokenizerState: {
+            UTF32Char next = _inputStream.nextInputCharacter;
+            return next != '<' && next != (UTF32Char)EOF;
+        }
+        default:
+            return NO;
+    }
+}
+
+- (void)recycleToken:(id)token
+{
+    Class class = [token class];
+    NSMutableArray *pool;
+    if (class == [HTMLCharacterToken class]) {
+        pool = _characterTokenPool;
+    } else if (class == [HTMLParseErrorToken class]) {
+        pool = _parseErrorTokenPool;
+    } else if (class == [HTMLStartTagToken class]) {
+        pool = _startTagTokenPool;
+        [token prepareForReuse];
+    } else if (class == [HTMLEndTagToken class]) {
+        pool = _endTagTokenPool;
+        [token prepareForReuse];
+    }
+    if (pool.count < MaximumPooledTokenCount) {
+        [pool addObject:token];
+    }
+}
+
+#pragma mark Incremental input
+
+// While the tokenizer is open, it can safely stop and wait for more input whenever it's between tokens in one of these states. Everything else is either part of a token-in-progress or remembered by the input stream.
+- (BOOL)canCheckpoint
+{
+    switch (_state) {
+        case HTMLDataTokenizerState:
+        case HTMLRCDATATokenizerState:
+        case HTMLRAWTEXTTokenizerState:
+        case HTMLScriptDataTokenizerState:
+        case HTMLPLAINTEXTTokenizerState:
+            return !_done;
+        default:
+            return NO;
+    }
+}
+
+// Tokens emitted before a checkpoint are complete and can be handed over to the parser. Checkpoints are taken again after each token is handed over, as the parser may have changed our state in the meantime.
+- (void)checkpoint
+{
+    [_inputStream mark];
+    _checkpointState = _state;
+    _checkpointMostRecentEmittedStartTagName = _mostRecentEmittedStartTagName;
+    _checkpointTokenCount = _tokenCount;
+    _checkpointNumberOfErrors = _numberOfErrors;
+}
+
+// Returns a character that must appear in the input before the token-in-progress can be finished, or 0 if there's no telling. Until that character arrives there's no point starting over from the last checkpoint, and doing so for every bit of input that arrives in the middle of a long comment or attribute value adds up quickly.
+- (char)characterNeededToFinishToken
+{
+    switch (_state) {
+        case HTMLAttributeValueDoubleQuotedTokenizerState:
+            return '"';
+        case HTMLAttributeValueSingleQuotedTokenizerState:
+            return '\'';
+        case HTMLTagNameTokenizerState:
+        case HTMLBeforeAttributeNameTokenizerState:
+        case HTMLAttributeNameTokenizerState:
+        case HTMLAfterAttributeNameTokenizerState:
+        case HTMLBeforeAttributeValueTokenizerState:
+        case HTMLAttributeValueUnquotedTokenizerState:
+        case HTMLCharacterReferenceInAttributeValueTokenizerState:
+        case HTMLAfterAttributeValueQuotedTokenizerState:
+        case HTMLSelfClosingStartTagTokenizerState:
+        case HTMLBogusCommentTokenizerState:
+        case HTMLCommentStartTokenizerState:
+        case HTMLCommentStartDashTokenizerState:
+        case HTMLCommentTokenizerState:
+        case HTMLCommentEndDashTokenizerState:
+        case HTMLCommentEndTokenizerState:
+        case HTMLCommentEndBangTokenizerState:
+        case HTMLDOCTYPETokenizerState:
+        case HTMLBeforeDOCTYPENameTokenizerState:
+        case HTMLDOCTYPENameTokenizerState:
+        case HTMLAfterDOCTYPENameTokenizerState:
+        case HTMLAfterDOCTYPEPublicKeywordTokenizerState:
+        case HTMLBeforeDOCTYPEPublicIdentifierTokenizerState:
+        case HTMLDOCTYPEPublicIdentifierDoubleQuotedTokenizerState:
+        case HTMLDOCTYPEPublicIdentifierSingleQuotedTokenizerState:
+        case HTMLAfterDOCTYPEPublicIdentifierTokenizerState:
+        case HTMLBetweenDOCTYPEPublicAndSystemIdentifiersTokenizerState:
+        case HTMLAfterDOCTYPESystemKeywordTokenizerState:
+        case HTMLBeforeDOCTYPESystemIdentifierTokenizerState:
+        case HTMLDOCTYPESystemIdentifierDoubleQuotedTokenizerState:
+        case HTMLDOCTYPESystemIdentifierSingleQuotedTokenizerState:
+        case HTMLAfterDOCTYPESystemIdentifierTokenizerState:
+        case HTMLBogusDOCTYPETokenizerState:
+        case HTMLCDATASectionTokenizerState:
+            return '>';
+        default:
+            return 0;
+    }
+}
+
+// Something ran off the end of the input, so throw away everything since the last checkpoint and try again once there's more input.
+- (void)rewindToCheckpoint
+{
+    [_inputStream rewindToMark];
+    _inputStream.starved = NO;
+    _state = _checkpointState;
+    _mostRecentEmittedStartTagName = _checkpointMostRecentEmittedStartTagName;
+    _numberOfErrors = _checkpointNumberOfErrors;
+    _currentToken = nil;
+    _currentAttributeName = nil;
+    _currentAttributeValue = nil;
+    _done = NO;
+    while (_tokenCount > _checkpointTokenCount) {
+        _tokenCount--;
+        _tokens[(_firstToken + _tokenCount) & (_tokenCapacity - 1)] = nil;
+    }
+}
+
 #pragma mark NSObject
 
 - (id)init
@@ -2426,14 +2801,15 @@ static inline BOOL is_lower(NSInteger c)
 
 @implementation HTMLTagToken
 {
-    NSMutableString *_tagName;
+    NSString *_tagName;
+    NSMutableString *_tagNameBuffer;
     BOOL _selfClosingFlag;
 }
 
 - (instancetype)initWithTagName:(NSString *)tagName
 {
     if ((self = [super init])) {
-        _tagName = [NSMutableString stringWithString:tagName];
+        _tagName = HTMLKnownAtom(tagName) ?: [tagName copy];
         _attributes = [HTMLOrderedDictionary new];
     }
     return self;
@@ -2446,12 +2822,19 @@ static inline BOOL is_lower(NSInteger c)
 
 - (NSString *)tagName
 {
-    return [_tagName copy];
+    if (_tagNameBuffer) {
+        _tagName = HTMLKnownAtom(_tagNameBuffer) ?: [_tagNameBuffer copy];
+        _tagNameBuffer = nil;
+    }
+    return _tagName;
 }
 
 - (void)setTagName:(NSString *)tagName
 {
-    [_tagName setString:tagName];
+    _tagNameBuffer = nil;
+    if (tagName != _tagName) {
+        _tagName = HTMLKnownAtom(tagName) ?: [tagName copy];
+    }
 }
 
 - (BOOL)selfClosingFlag
@@ -2466,7 +2849,28 @@ static inline BOOL is_lower(NSInteger c)
 
 - (void)appendLongCharacterToTagName:(UTF32Char)character
 {
-    AppendLongCharacter(_tagName, character);
+    if (!_tagNameBuffer) {
+        _tagNameBuffer = [_tagName mutableCopy];
+    }
+    AppendLongCharacter(_tagNameBuffer, character);
+}
+
+- (void)internTagNameUsingTable:(HTMLAtomTable *)atoms
+{
+    if (_tagNameBuffer) {
+        _tagName = [atoms atomForName:_tagNameBuffer];
+        _tagNameBuffer = nil;
+    }
+}
+
+- (void)prepareForReuse
+{
+    _tagName = @"";
+    _tagNameBuffer = nil;
+    _selfClosingFlag = NO;
+    if (_attributes.count > 0) {
+        [_attributes removeAllObjects];
+    }
 }
 
 #pragma mark NSObject
@@ -2599,6 +3003,10 @@ static inline BOOL is_lower(NSInteger c)
 @end
 
 @implementation HTMLCharacterToken
+{
+    NSString *_string;
+    NSMutableString *_buffer;
+}
 
 // http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
 - (instancetype)init { @throw nil; }
@@ -2611,6 +3019,43 @@ static inline BOOL is_lower(NSInteger c)
     return self;
 }
 
+// Appended characters go into a buffer, which is kept around between reuses. The string is only copied out when someone asks for it.
+- (NSString *)string
+{
+    if (!_string) {
+        _string = [_buffer copy];
+    }
+    return _string;
+}
+
+- (void)appendString:(NSString *)string
+{
+    [self moveStringToBuffer];
+    [_buffer appendString:string];
+}
+
+- (void)appendLongCharacter:(UTF32Char)character
+{
+    [self moveStringToBuffer];
+    AppendLongCharacter(_buffer, character);
+}
+
+- (void)moveStringToBuffer
+{
+    if (!_string) return;
+    if (_buffer) {
+        [_buffer setString:_string];
+    } else {
+        _buffer = [_string mutableCopy];
+    }
+    _string = nil;
+}
+
+- (void)resetWithString:(NSString *)string
+{
+    _string = [string copy];
+}
+
 - (instancetype)leadingWhitespaceToken
 {
     CFRange range = CFRangeMake(0, self.string.length);
@@ -2636,6 +3081,7 @@ static inline BOOL is_lower(NSInteger c)
     CFStringInitInlineBuffer((__bridge CFStringRef)self.string, &buffer, range);
     for (CFIndex i = 0; i < range.length; i++) {
         if (!is_whitespace(CFStringGetCharacterFromInlineBuffer(&buffer, i))) {
+            if (i == 0) return self;
             NSString *afterLeadingWhitespace = [self.string substringFromIndex:i];
             return [[[self class] alloc] initWithString:afterLeadingWhitespace];
         }
@@ -2664,19 +3110,33 @@ static inline BOOL is_lower(NSInteger c)
 
 @implementation HTMLParseErrorToken
 
-- (instancetype)initWithError:(NSString *)error
+- (instancetype)initWithError:(NSString *)error line:(NSUInteger)line column:(NSUInteger)column
 {
     if ((self = [super init])) {
         _error = [error copy];
+        _line = line;
+        _column = column;
     }
     return self;
 }
 
+- (instancetype)initWithError:(NSString *)error
+{
+    return [self initWithError:error line:0 column:0];
+}
+
 - (instancetype)init
 {
     return [self initWithError:nil];
 }
 
+- (void)resetWithError:(NSString *)error line:(NSUInteger)line column:(NSUInteger)column
+{
+    _error = [error copy];
+    _line = line;
+    _column = column;
+}
+
 #pragma mark NSObject
 
 - (BOOL)isEqual:(id)other
@@ -6,13 +6,24 @@
 @class HTMLNode;
 #import "HTMLSupport.h"
 
-/// An HTMLTreeEnumerator emits HTMLNode instances in tree order (preorder, depth-first) or reverse tree order (preorder, depth-first starting with the last child).
+/**
+    An HTMLTreeEnumerator emits HTMLNode instances in tree order (preorder, depth-first) or reverse tree order (preorder, depth-first starting with the last child).
+ 
+    Fast enumeration (for...in) hands out nodes in batches, which is quicker than repeatedly calling -nextObject. Either way, the tree must not change during enumeration.
+ */
 @interface HTMLTreeEnumerator : NSEnumerator
 
 /// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
 - (instancetype)init NS_UNAVAILABLE;
 
-/// Initializes an enumerator rooted at a particular node.
-- (instancetype)initWithNode:(HTMLNode *)node reversed:(BOOL)reversed NS_DESIGNATED_INITIALIZER;
+/// Initializes an enumerator rooted at a particular node that emits every node.
+- (instancetype)initWithNode:(HTMLNode *)node reversed:(BOOL)reversed;
+
+/**
+    Initializes an enumerator rooted at a particular node.
+ 
+    @param elementsOnly If YES, only instances of HTMLElement are emitted. Other nodes are still walked, so the children of a document are found.
+ */
+- (instancetype)initWithNode:(HTMLNode *)node reversed:(BOOL)reversed elementsOnly:(BOOL)elementsOnly NS_DESIGNATED_INITIALIZER;
 
 @end
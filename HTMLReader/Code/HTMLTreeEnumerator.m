@@ -3,10 +3,12 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLTreeEnumerator.h"
-#import "HTMLNode.h"
+#import "HTMLElement.h"
+#import "HTMLNode+Private.h"
 
-// For performance we'll cache the number of nodes at each level of the tree.
+// For performance we'll cache the number of nodes at each level of the tree, along with the node they're children of, so walking back up doesn't need -parentNode.
 typedef struct {
+    CFTypeRef parent;
     NSUInteger i;
     NSUInteger count;
 } Row;
@@ -15,82 +17,181 @@ typedef struct {
     Row *path;
     NSUInteger length;
     NSUInteger capacity;
-} IndexPath;
-
-// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
-@interface HTMLTreeEnumerator ()
-- (instancetype)init NS_DESIGNATED_INITIALIZER;
-@end
+    
+    // The node most recently walked to, or NULL once the walk is over. It and each row's parent are retained, as nodes in an HTMLCompactDocument are only kept alive by whoever's using them.
+    CFTypeRef current;
+    
+    BOOL started;
+    BOOL reversed;
+} TreeWalk;
 
-@implementation HTMLTreeEnumerator
+static void StartWalk(TreeWalk *walk, HTMLNode *root, BOOL reversed)
 {
-    HTMLNode *_nextNode;
-	BOOL _reversed;
-    IndexPath _indexPath;
+    *walk = (TreeWalk){ .current = root ? CFBridgingRetain(root) : NULL, .reversed = reversed };
 }
 
-// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
-- (instancetype)init { @throw nil; }
+static void FinishWalk(TreeWalk *walk)
+{
+    for (NSUInteger i = 0; i < walk->length; i++) {
+        CFRelease(walk->path[i].parent);
+    }
+    free(walk->path);
+    if (walk->current) {
+        CFRelease(walk->current);
+    }
+    *walk = (TreeWalk){0};
+}
 
-- (void)dealloc
+// Going straight to the children array saves a couple of message sends per node.
+static inline NSUInteger NumberOfChildren(HTMLNode *node)
 {
-    free(_indexPath.path);
+    CFArrayRef children = HTMLNodeChildrenArray(node);
+    return children ? (NSUInteger)CFArrayGetCount(children) : node.numberOfChildren;
 }
 
-- (instancetype)initWithNode:(HTMLNode *)node reversed:(BOOL)reversed
+static inline HTMLNode * ChildAtIndex(HTMLNode *node, NSUInteger i)
 {
-    if ((self = [super init])) {
-        _nextNode = node;
-        _reversed = reversed;
-    }
-    return self;
+    CFArrayRef children = HTMLNodeChildrenArray(node);
+    return children ? (__bridge HTMLNode *)CFArrayGetValueAtIndex(children, i) : [node childAtIndex:i];
 }
 
-- (id)nextObject
+/// Returns the next node in tree order (or reverse tree order), or nil if there are no more. The first call returns the root. If descend is NO, the descendants of the previously returned node are skipped.
+static HTMLNode * AdvanceWalk(TreeWalk *walk, BOOL descend)
 {
-    // This enumerator works by storing the *next* node we intend to emit, and the index path that points to that next node.
-    HTMLNode *currentNode = _nextNode;
-    
-    NSUInteger numberOfChildren = currentNode.numberOfChildren;
+    HTMLNode *current = (__bridge HTMLNode *)walk->current;
+    if (!current) return nil;
+    if (!walk->started) {
+        walk->started = YES;
+        return current;
+    }
     
+    HTMLNode *next = nil;
+    NSUInteger numberOfChildren = descend ? NumberOfChildren(current) : 0;
     if (numberOfChildren > 0) {
         
-        // Depth-first means the next node we'll emit is the current node's first child.
-        if (_indexPath.length == _indexPath.capacity) {
-            _indexPath.capacity += 16;
-            _indexPath.path = reallocf(_indexPath.path, sizeof(_indexPath.path[0]) * _indexPath.capacity);
+        // Depth-first means the next node is the current node's first child.
+        if (walk->length == walk->capacity) {
+            walk->capacity += 16;
+            walk->path = reallocf(walk->path, sizeof(walk->path[0]) * walk->capacity);
         }
-        Row *row = _indexPath.path + _indexPath.length;
-        _indexPath.length++;
+        Row *row = walk->path + walk->length;
+        walk->length++;
+        row->parent = CFBridgingRetain(current);
         row->count = numberOfChildren;
-        row->i = _reversed ? numberOfChildren - 1 : 0;
-        _nextNode = [currentNode childAtIndex:row->i];
+        row->i = walk->reversed ? numberOfChildren - 1 : 0;
+        next = ChildAtIndex(current, row->i);
         
     } else {
         
-        // We're out of children on this row, so walk back up the tree until we find a level with spare children.
-        HTMLNode *parentNode = currentNode.parentNode;
-        while (_indexPath.length > 0) {
-            Row *row = _indexPath.path + _indexPath.length - 1;
-            if (_reversed && row->i > 0) {
+        // We're out of children on this row, so walk back up the tree until we find a level with spare children. No more spare children means we're done.
+        while (walk->length > 0) {
+            Row *row = walk->path + walk->length - 1;
+            if (walk->reversed && row->i > 0) {
                 row->i--;
-            } else if (!_reversed && row->i + 1 < row->count) {
+            } else if (!walk->reversed && row->i + 1 < row->count) {
                 row->i++;
             } else {
-                _indexPath.length--;
-                parentNode = parentNode.parentNode;
+                walk->length--;
+                CFRelease(row->parent);
                 continue;
             }
-            _nextNode = [parentNode childAtIndex:row->i];
+            next = ChildAtIndex((__bridge HTMLNode *)row->parent, row->i);
             break;
         }
+    }
+    
+    CFRelease(walk->current);
+    walk->current = next ? CFBridgingRetain(next) : NULL;
+    return next;
+}
+
+static HTMLNode * NextNode(TreeWalk *walk, BOOL elementsOnly)
+{
+    HTMLNode *node;
+    do {
+        node = AdvanceWalk(walk, YES);
+    } while (node && elementsOnly && ![node isKindOfClass:[HTMLElement class]]);
+    return node;
+}
+
+void HTMLVisitTree(HTMLNode *root, BOOL elementsOnly, HTMLTreeVisitor visitor, void *context)
+{
+    TreeWalk walk;
+    StartWalk(&walk, root, NO);
+    BOOL descend = YES;
+    HTMLNode *node;
+    while ((node = AdvanceWalk(&walk, descend))) {
+        descend = YES;
+        if (elementsOnly && ![node isKindOfClass:[HTMLElement class]]) continue;
         
-        // No more spare children means we're done.
-        if (_indexPath.length == 0) {
-            _nextNode = nil;
-        }
+        HTMLTreeVisitorResult result = visitor(node, context);
+        if (result == HTMLTreeVisitorStop) break;
+        descend = result != HTMLTreeVisitorSkipChildren;
+    }
+    FinishWalk(&walk);
+}
+
+// Big enough that the per-batch overhead disappears, small enough to sit comfortably in the enumerator.
+enum { BatchSize = 64 };
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+@interface HTMLTreeEnumerator ()
+- (instancetype)init NS_DESIGNATED_INITIALIZER;
+@end
+
+@implementation HTMLTreeEnumerator
+{
+    TreeWalk _walk;
+    BOOL _elementsOnly;
+    
+    // Fast enumeration hands out unretained pointers, so the current batch is held here until the next one.
+    HTMLNode *_batch[BatchSize];
+}
+
+// http://stackoverflow.com/questions/32741123/objective-c-warning-method-override-for-the-designated-initializer-of-the-superc
+- (instancetype)init { @throw nil; }
+
+- (void)dealloc
+{
+    FinishWalk(&_walk);
+}
+
+- (instancetype)initWithNode:(HTMLNode *)node reversed:(BOOL)reversed
+{
+    return [self initWithNode:node reversed:reversed elementsOnly:NO];
+}
+
+- (instancetype)initWithNode:(HTMLNode *)node reversed:(BOOL)reversed elementsOnly:(BOOL)elementsOnly
+{
+    if ((self = [super init])) {
+        StartWalk(&_walk, node, reversed);
+        _elementsOnly = elementsOnly;
     }
-    return currentNode;
+    return self;
+}
+
+- (id)nextObject
+{
+    return NextNode(&_walk, _elementsOnly);
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)len
+{
+    NSUInteger count = 0;
+    HTMLNode *node;
+    while (count < BatchSize && (node = NextNode(&_walk, _elementsOnly))) {
+        _batch[count++] = node;
+    }
+    for (NSUInteger i = count; i < BatchSize && _batch[i]; i++) {
+        _batch[i] = nil;
+    }
+    
+    state->state = 1;
+    state->itemsPtr = (__unsafe_unretained id *)(void *)_batch;
+    
+    // Changing the tree during enumeration isn't detected, so mutations point at something that never changes.
+    state->mutationsPtr = &state->extra[0];
+    return count;
 }
 
 @end
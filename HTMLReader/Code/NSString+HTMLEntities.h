@@ -10,6 +10,8 @@
     Returns a copy of the string with the necessary characters escaped for HTML.
  
     For more information, see http://www.whatwg.org/specs/web-apps/current-work/multipage/the-end.html#escapingString (the algorithm is not invoked in the "attribute mode").
+ 
+    If no escaping is necessary, the same instance may be returned.
  */
 @property (readonly, copy, nonatomic) NSString *html_stringByEscapingForHTML;
 
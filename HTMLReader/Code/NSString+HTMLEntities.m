@@ -6,113 +6,190 @@
 #import "HTMLEntities.h"
 #import "HTMLString.h"
 
+/// Characters that are escaped for HTML (outside of attribute mode).
+static const UniChar EscapedCharacters[] = { '&', 0x00A0, '"', '<', '>' };
+
+/**
+    Returns a pointer to the string's UTF-16 code units, which is either the string's own storage or a buffer that must be passed to free().
+ 
+    @param buffer Set to the buffer that needs freeing, or NULL if the string's storage was used.
+ */
+static const UniChar * CodeUnitsOfString(NSString *string, UniChar **buffer)
+{
+    const UniChar *units = CFStringGetCharactersPtr((__bridge CFStringRef)string);
+    if (units) {
+        *buffer = NULL;
+        return units;
+    }
+    *buffer = malloc(MAX(string.length, 1) * sizeof(UniChar));
+    [string getCharacters:*buffer range:NSMakeRange(0, string.length)];
+    return *buffer;
+}
+
+/// Appends code units to a growable buffer, enlarging it as needed.
+static void AppendCodeUnits(UniChar **output, NSUInteger *length, NSUInteger *capacity, const UniChar *units, NSUInteger count)
+{
+    if (*length + count > *capacity) {
+        *capacity = MAX(*capacity * 2, *length + count);
+        *output = reallocf(*output, *capacity * sizeof(UniChar));
+    }
+    memcpy(*output + *length, units, count * sizeof(UniChar));
+    *length += count;
+}
+
 @implementation NSString (HTMLEntities)
 
 - (NSString *)html_stringByEscapingForHTML
 {
-    NSMutableString *escaped = [self mutableCopy];
-    void (^replace)(NSString *, NSString *) = ^(NSString *find, NSString *replace) {
-        [escaped replaceOccurrencesOfString:find withString:replace options:0 range:NSMakeRange(0, escaped.length)];
-    };
-    replace(@"&", @"&amp;");
-    replace(@"\u00A0", @"&nbsp;");
-    replace(@"\"", @"&quot;");
-    replace(@"<", @"&lt;");
-    replace(@">", @"&gt;");
-    return escaped;
+    NSUInteger length = self.length;
+    UniChar *buffer;
+    const UniChar *units = CodeUnitsOfString(self, &buffer);
+    const NSUInteger escapedCount = sizeof(EscapedCharacters) / sizeof(EscapedCharacters[0]);
+    NSUInteger next = IndexOfFirstCodeUnitInSet(units, length, EscapedCharacters, escapedCount);
+    if (next == length) {
+        free(buffer);
+        return [self copy];
+    }
+    
+    // Most text needs few escapes, so a quarter again as long is usually enough to avoid growing the output.
+    NSUInteger capacity = length + length / 4 + 8;
+    NSUInteger outputLength = 0;
+    UniChar *output = malloc(capacity * sizeof(UniChar));
+    NSUInteger i = 0;
+    while (i < length) {
+        AppendCodeUnits(&output, &outputLength, &capacity, units + i, next - i);
+        if (next == length) break;
+        
+        static const UniChar amp[] = {'&', 'a', 'm', 'p', ';'};
+        static const UniChar nbsp[] = {'&', 'n', 'b', 's', 'p', ';'};
+        static const UniChar quot[] = {'&', 'q', 'u', 'o', 't', ';'};
+        static const UniChar lt[] = {'&', 'l', 't', ';'};
+        static const UniChar gt[] = {'&', 'g', 't', ';'};
+        switch (units[next]) {
+            case '&': AppendCodeUnits(&output, &outputLength, &capacity, amp, sizeof(amp) / sizeof(UniChar)); break;
+            case 0x00A0: AppendCodeUnits(&output, &outputLength, &capacity, nbsp, sizeof(nbsp) / sizeof(UniChar)); break;
+            case '"': AppendCodeUnits(&output, &outputLength, &capacity, quot, sizeof(quot) / sizeof(UniChar)); break;
+            case '<': AppendCodeUnits(&output, &outputLength, &capacity, lt, sizeof(lt) / sizeof(UniChar)); break;
+            case '>': AppendCodeUnits(&output, &outputLength, &capacity, gt, sizeof(gt) / sizeof(UniChar)); break;
+        }
+        i = next + 1;
+        next = i + IndexOfFirstCodeUnitInSet(units + i, length - i, EscapedCharacters, escapedCount);
+    }
+    free(buffer);
+    return [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
 }
 
 - (NSString *)html_stringByUnescapingHTML
 {
-    NSRange ampersand = [self rangeOfString:@"&" options:NSBackwardsSearch];
-    if (ampersand.location == NSNotFound || NSMaxRange(ampersand) == self.length) return self;
-    
-    // These are expensive to create, so we'll lazily create them once per unescaping operation.
-    NSCharacterSet *decimalDigitCharacterSet;
-    NSCharacterSet *hexadecimalDigitCharacterSet;
+    NSUInteger length = self.length;
+    UniChar *buffer;
+    const UniChar *units = CodeUnitsOfString(self, &buffer);
+    static const UniChar ampersand = '&';
+    NSUInteger next = IndexOfFirstCodeUnitInSet(units, length, &ampersand, 1);
+    if (next == length) {
+        free(buffer);
+        return [self copy];
+    }
     
-    NSRange searchRange = NSMakeRange(0, self.length);
-    NSScanner *scanner = [NSScanner scannerWithString:self];
-    NSMutableString *unescaped = [self mutableCopy];
-    do {
-        searchRange.length = ampersand.location;
+    // No replacement is longer than the reference it replaces, so the output never outgrows the input.
+    UniChar *output = malloc(length * sizeof(UniChar));
+    NSUInteger outputLength = 0;
+    BOOL replacedAny = NO;
+    NSUInteger i = 0;
+    while (i < length) {
+        memcpy(output + outputLength, units + i, (next - i) * sizeof(UniChar));
+        outputLength += next - i;
+        if (next == length) break;
         
-        NSString *replacement;
+        // Copy the ampersand now; a replacement overwrites it.
+        output[outputLength] = '&';
+        i = next + 1;
         
         // Numeric entity.
-        scanner.scanLocation = NSMaxRange(ampersand);
-        if ([scanner scanString:@"#" intoString:nil]) {
-            
-            UInt32 entity;
-            
-            // Hex number.
-            if ([scanner scanString:@"x" intoString:nil]) {
-                if (!hexadecimalDigitCharacterSet) {
-                    hexadecimalDigitCharacterSet = [NSCharacterSet characterSetWithCharactersInString:@"0123456789ABCDEFabcdef"];
-                }
-                NSString *entityString;
-                if ([scanner scanCharactersFromSet:hexadecimalDigitCharacterSet intoString:&entityString]) {
-                    NSScanner *hexScanner = [NSScanner scannerWithString:entityString];
-                    unsigned int hex;
-                    [hexScanner scanHexInt:&hex];
-                    entity = hex;
+        if (i < length && units[i] == '#') {
+            NSUInteger j = i + 1;
+            BOOL hex = j < length && (units[j] == 'x' || units[j] == 'X');
+            if (hex) j++;
+            NSUInteger digitsStart = j;
+            UInt32 entity = 0;
+            for (; j < length; j++) {
+                UniChar c = units[j];
+                UInt32 digit;
+                if (c >= '0' && c <= '9') {
+                    digit = c - '0';
+                } else if (hex && c >= 'a' && c <= 'f') {
+                    digit = c - 'a' + 10;
+                } else if (hex && c >= 'A' && c <= 'F') {
+                    digit = c - 'A' + 10;
                 } else {
-                    continue;
+                    break;
                 }
+                
+                // Anything past the last code point is replaced the same way, so stop counting there.
+                entity = MIN(entity * (hex ? 16 : 10) + digit, 0x110000);
             }
-            
-            // Decimal number.
-            else {
-                if (!decimalDigitCharacterSet) {
-                    decimalDigitCharacterSet = [NSCharacterSet characterSetWithCharactersInString:@"0123456789"];
+            if (j > digitsStart) {
+                UTF32Char win1252Replacement = ReplacementForNumericEntity(entity);
+                if (win1252Replacement) {
+                    entity = win1252Replacement;
+                }
+                
+                if ((entity >= 0xD800 && entity <= 0xDFFF) || entity > 0x10FFFF) {
+                    entity = 0xFFFD;
                 }
-                NSString *entityString;
-                if ([scanner scanCharactersFromSet:decimalDigitCharacterSet intoString:&entityString]) {
-                    NSInteger decimal = entityString.integerValue;
-                    if (decimal > 0x10FFFF) {
-                        entity = UINT32_MAX;
-                    } else {
-                        entity = (UInt32)decimal;
-                    }
+                
+                if (entity > 0xFFFF) {
+                    CFStringGetSurrogatePairForLongCharacter(entity, output + outputLength);
+                    outputLength += 2;
                 } else {
-                    continue;
+                    output[outputLength++] = (UniChar)entity;
                 }
+                
+                // Optional semicolon.
+                if (j < length && units[j] == ';') j++;
+                
+                i = j;
+                replacedAny = YES;
+                next = i + IndexOfFirstCodeUnitInSet(units + i, length - i, &ampersand, 1);
+                continue;
             }
-            
-            UTF32Char win1252Replacement = ReplacementForNumericEntity(entity);
-            if (win1252Replacement) {
-                entity = win1252Replacement;
-            }
-            
-            if ((entity >= 0xD800 && entity <= 0xDFFF) || entity > 0x10FFFF) {
-                entity = 0xFFFD;
-            }
-            
-            replacement = StringWithLongCharacter(entity);
-            
-            // Optional semicolon.
-            [scanner scanString:@";" intoString:nil];
         }
         
         // Named entity.
         else {
-            NSRange nameRange = NSMakeRange(NSMaxRange(ampersand), LongestEntityNameLength);
-            if (NSMaxRange(nameRange) > self.length) {
-                nameRange.length = self.length - nameRange.location;
+            NSUInteger node = 0;
+            NSString *replacement;
+            NSUInteger nameEnd = i;
+            for (NSUInteger j = i; j < length && j - i < LongestEntityNameLength; j++) {
+                node = NextNamedEntityNode(node, units[j]);
+                if (node == 0) break;
+                NSString *replacementSoFar = NamedEntityReplacementAtNode(node);
+                if (replacementSoFar) {
+                    replacement = replacementSoFar;
+                    nameEnd = j + 1;
+                }
             }
-            NSString *nameString = [self substringWithRange:nameRange];
-            NSString *parsedEntity;
-            replacement = StringForNamedEntity(nameString, &parsedEntity);
             if (replacement) {
-                [scanner scanString:parsedEntity intoString:nil];
-            } else {
+                NSUInteger replacementLength = replacement.length;
+                [replacement getCharacters:output + outputLength range:NSMakeRange(0, replacementLength)];
+                outputLength += replacementLength;
+                i = nameEnd;
+                replacedAny = YES;
+                next = i + IndexOfFirstCodeUnitInSet(units + i, length - i, &ampersand, 1);
                 continue;
             }
         }
         
-        [unescaped replaceCharactersInRange:NSMakeRange(ampersand.location, scanner.scanLocation - ampersand.location) withString:replacement];
-    } while ((ampersand = [self rangeOfString:@"&" options:NSBackwardsSearch range:searchRange]).location != NSNotFound);
-    return unescaped;
+        // Not a character reference after all, so keep the ampersand.
+        outputLength++;
+        next = i + IndexOfFirstCodeUnitInSet(units + i, length - i, &ampersand, 1);
+    }
+    free(buffer);
+    if (!replacedAny) {
+        free(output);
+        return [self copy];
+    }
+    return [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
 }
 
 @end
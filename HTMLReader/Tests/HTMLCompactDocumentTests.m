@@ -0,0 +1,163 @@
+//  HTMLCompactDocumentTests.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <XCTest/XCTest.h>
+#import "HTMLCompactDocument.h"
+#import "HTMLComment.h"
+#import "HTMLSelector.h"
+#import "HTMLSerialization.h"
+#import "HTMLTextNode.h"
+
+@interface HTMLCompactDocumentTests : XCTestCase
+
+@end
+
+@implementation HTMLCompactDocumentTests
+{
+    HTMLDocument *_document;
+    HTMLCompactDocument *_compactDocument;
+}
+
+- (void)setUp
+{
+    [super setUp];
+    NSString *string = (@"<!DOCTYPE html PUBLIC \"-//W3C//DTD HTML 4.01//EN\" \"http://www.w3.org/TR/html4/strict.dtd\">"
+                        @"<title>Hi &amp; bye</title>"
+                        @"<!-- a comment -->"
+                        @"<div id=main class=\"one two\"><p>First <b>bold</b> paragraph</p><p lang=en>Second</p></div>"
+                        @"<ul><li>1<li>2<li>3</ul>"
+                        @"<svg viewBox=\"0 0 1 1\"><foreignObject><p>in svg</p></foreignObject></svg>");
+    _document = [HTMLDocument documentWithString:string];
+    _compactDocument = [[HTMLCompactDocument alloc] initWithDocument:_document];
+}
+
+- (void)testTreeEnumeration
+{
+    NSArray *regular = [_document.treeEnumerator allObjects];
+    NSMutableArray *compact = [NSMutableArray new];
+    for (HTMLNode *node in _compactDocument.documentNode.treeEnumerator) {
+        [compact addObject:node];
+    }
+    XCTAssertEqual(compact.count, regular.count);
+    XCTAssertEqualObjects([compact valueForKey:@"textContent"], [regular valueForKey:@"textContent"]);
+    
+    NSArray *elements = [_compactDocument.documentNode.elementTreeEnumerator allObjects];
+    XCTAssertEqualObjects([elements valueForKey:@"tagName"], [[_document.elementTreeEnumerator allObjects] valueForKey:@"tagName"]);
+}
+
+- (void)testSerialization
+{
+    XCTAssertEqualObjects(_compactDocument.documentNode.serializedFragment, _document.serializedFragment);
+    XCTAssertEqualObjects([_compactDocument document].serializedFragment, _document.serializedFragment);
+}
+
+- (void)testStructure
+{
+    XCTAssertEqual(_compactDocument.numberOfNodes, (NSUInteger)[_document.treeEnumerator allObjects].count);
+    HTMLDocument *documentNode = _compactDocument.documentNode;
+    XCTAssertEqual([_compactDocument indexOfNode:documentNode], (NSUInteger)0);
+    XCTAssertEqual([_compactDocument parentIndexOfNodeAtIndex:0], (NSUInteger)NSNotFound);
+    XCTAssertEqual(documentNode.quirksMode, _document.quirksMode);
+    XCTAssertEqualObjects(documentNode.documentType.publicIdentifier, @"-//W3C//DTD HTML 4.01//EN");
+    XCTAssertEqualObjects(documentNode.documentType.systemIdentifier, @"http://www.w3.org/TR/html4/strict.dtd");
+    
+    HTMLElement *div = [documentNode firstNodeMatchingSelector:@"div"];
+    XCTAssertEqualObjects(div[@"id"], @"main");
+    XCTAssertEqualObjects(div.attributes, (@{ @"id": @"main", @"class": @"one two" }));
+    XCTAssertTrue([div hasClass:@"two"]);
+    XCTAssertEqual(div.parentElement, [documentNode firstNodeMatchingSelector:@"body"]);
+    XCTAssertEqual(div.document, documentNode);
+    XCTAssertEqual(div.numberOfChildren, (NSUInteger)2);
+    HTMLElement *second = [div childAtIndex:1];
+    XCTAssertEqualObjects(second[@"lang"], @"en");
+    XCTAssertEqual([div indexOfChild:second], (NSUInteger)1);
+    XCTAssertEqual([div indexOfChild:div], (NSUInteger)NSNotFound);
+    XCTAssertEqualObjects([div.children.array valueForKey:@"tagName"], (@[ @"p", @"p" ]));
+    
+    NSUInteger index = [_compactDocument indexOfNode:second];
+    XCTAssertEqualObjects([_compactDocument tagNameOfNodeAtIndex:index], @"p");
+    XCTAssertEqualObjects([_compactDocument valueOfAttribute:@"lang" ofNodeAtIndex:index], @"en");
+    XCTAssertNil([_compactDocument valueOfAttribute:@"id" ofNodeAtIndex:index]);
+    XCTAssertEqual([_compactDocument nodeAtIndex:[_compactDocument parentIndexOfNodeAtIndex:index]], div);
+    
+    HTMLElement *svg = [documentNode firstNodeMatchingSelector:@"svg"];
+    XCTAssertEqual(svg.htmlNamespace, HTMLNamespaceSVG);
+    XCTAssertEqualObjects(svg[@"viewBox"], @"0 0 1 1");
+    XCTAssertEqualObjects([svg.childElementNodes valueForKey:@"tagName"], @[ @"foreignObject" ]);
+    
+    XCTAssertThrows([_compactDocument nodeAtIndex:_compactDocument.numberOfNodes]);
+    XCTAssertEqual([_compactDocument indexOfNode:[HTMLElement new]], (NSUInteger)NSNotFound);
+}
+
+- (void)testTextContent
+{
+    XCTAssertEqualObjects(_compactDocument.textContent, _document.textContent);
+    XCTAssertEqualObjects(_compactDocument.documentNode.textContent, _document.textContent);
+    HTMLElement *div = [_compactDocument.documentNode firstNodeMatchingSelector:@"div"];
+    XCTAssertEqualObjects(div.textContent, @"First bold paragraphSecond");
+    
+    HTMLElement *head = [_compactDocument.documentNode firstNodeMatchingSelector:@"head"];
+    HTMLComment *comment = head.children.lastObject;
+    XCTAssertTrue([comment isKindOfClass:[HTMLComment class]]);
+    XCTAssertEqualObjects(comment.textContent, @" a comment ");
+    HTMLTextNode *text = [[head childAtIndex:0] childAtIndex:0];
+    XCTAssertEqualObjects(text.data, @"Hi & bye");
+}
+
+- (void)testSelectors
+{
+    NSArray *selectors = @[ @"p", @"div > p", @"#main p:first-child", @".one", @"li:nth-child(2n+1)", @"title + *", @"b ~ *", @"[lang|=en]", @"foreignObject p", @"*", @"P", @"#main", @".two", @"div.one.two", @"[lang]", @"p[lang=en]", @"svg[viewBox]", @".missing", @"li:not(:first-child)" ];
+    for (NSString *selector in selectors) {
+        NSArray *expected = [_document nodesMatchingSelector:selector];
+        NSArray *compact = [_compactDocument nodesMatchingSelector:selector];
+        XCTAssertEqual(compact.count, expected.count, @"%@", selector);
+        XCTAssertEqualObjects([compact valueForKey:@"serializedFragment"], [expected valueForKey:@"serializedFragment"], @"%@", selector);
+    }
+}
+
+- (void)testNodesAreReused
+{
+    HTMLElement *div = [_compactDocument.documentNode firstNodeMatchingSelector:@"div"];
+    NSUInteger index = [_compactDocument indexOfNode:div];
+    XCTAssertEqual([_compactDocument nodeAtIndex:index], div);
+}
+
+- (void)testNodesAreReadOnly
+{
+    HTMLElement *div = [_compactDocument.documentNode firstNodeMatchingSelector:@"div"];
+    XCTAssertThrows(div[@"id"] = @"other");
+    XCTAssertThrows([div removeAttributeWithName:@"id"]);
+    XCTAssertThrows([div.mutableChildren removeAllObjects]);
+    XCTAssertThrows(div.textContent = @"replaced");
+    XCTAssertThrows([div removeFromParentNode]);
+    XCTAssertEqualObjects(div[@"id"], @"main");
+}
+
+- (void)testCopiesAreMutable
+{
+    HTMLElement *div = [_compactDocument.documentNode firstNodeMatchingSelector:@"div"];
+    HTMLElement *copy = [div copy];
+    XCTAssertEqualObjects(copy.tagName, @"div");
+    XCTAssertEqualObjects(copy.attributes, div.attributes);
+    copy[@"id"] = @"other";
+    XCTAssertEqualObjects(copy[@"id"], @"other");
+    XCTAssertEqualObjects(div[@"id"], @"main");
+    
+    HTMLDocument *document = [_compactDocument document];
+    HTMLElement *body = [document firstNodeMatchingSelector:@"body"];
+    [body.mutableChildren removeAllObjects];
+    XCTAssertEqual(body.numberOfChildren, (NSUInteger)0);
+    XCTAssertEqual([_compactDocument.documentNode firstNodeMatchingSelector:@"body"].numberOfChildren, (NSUInteger)3);
+}
+
+- (void)testEmptyDocument
+{
+    HTMLCompactDocument *compactDocument = [[HTMLCompactDocument alloc] initWithDocument:[HTMLDocument new]];
+    XCTAssertEqual(compactDocument.numberOfNodes, (NSUInteger)1);
+    XCTAssertEqualObjects(compactDocument.textContent, @"");
+    XCTAssertEqual(compactDocument.documentNode.numberOfChildren, (NSUInteger)0);
+    XCTAssertEqualObjects([compactDocument nodesMatchingSelector:@"*"], @[]);
+}
+
+@end
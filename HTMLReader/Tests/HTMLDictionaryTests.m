@@ -64,6 +64,27 @@ static NSArray *fixtureKeys;
     XCTAssertEqualObjects(_dictionary.allKeys, keys);
 }
 
+- (void)testManyKeys
+{
+    for (NSUInteger i = 0; i < 20; i++) {
+        _dictionary[@(i)] = @(i * 2);
+    }
+    [_dictionary removeObjectForKey:@5];
+    [_dictionary insertObject:@"new" forKey:@"new" atIndex:2];
+    XCTAssertEqual(_dictionary.count, (NSUInteger)20);
+    XCTAssertEqualObjects(_dictionary[@19], @38);
+    XCTAssertNil(_dictionary[@5]);
+    XCTAssertEqual([_dictionary indexOfKey:@"new"], (NSUInteger)2);
+    XCTAssertEqual([_dictionary indexOfKey:@6], (NSUInteger)6);
+    
+    NSMutableArray *keys = [NSMutableArray new];
+    for (id key in _dictionary) {
+        [keys addObject:key];
+    }
+    XCTAssertEqualObjects(keys, _dictionary.allKeys);
+    XCTAssertEqualObjects([_dictionary copy], _dictionary);
+}
+
 - (void)testIndexedSubscript
 {
     XCTAssertThrows(_dictionary[0]);
@@ -0,0 +1,46 @@
+//  HTMLDocumentTests.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <XCTest/XCTest.h>
+#import "HTMLDocument.h"
+
+@interface HTMLDocumentTests : XCTestCase
+
+@end
+
+@implementation HTMLDocumentTests
+
+- (void)testParsingDocumentsInParallel
+{
+    NSMutableArray *dataArray = [NSMutableArray new];
+    NSMutableArray *contentTypes = [NSMutableArray new];
+    NSMutableArray *expectedTexts = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 300; i++) {
+        NSString *text = [NSString stringWithFormat:@"café %tu", i];
+        NSString *markup = [NSString stringWithFormat:@"<title>%tu</title><p>%@", i, text];
+        switch (i % 3) {
+            case 0:
+                [dataArray addObject:[markup dataUsingEncoding:NSUTF8StringEncoding]];
+                [contentTypes addObject:@"text/html; charset=utf-8"];
+                break;
+            case 1:
+                [dataArray addObject:[markup dataUsingEncoding:NSISOLatin1StringEncoding]];
+                [contentTypes addObject:@"text/html; charset=iso-8859-1"];
+                break;
+            default:
+                text = [NSString stringWithFormat:@"cafe %tu", i];
+                markup = [NSString stringWithFormat:@"<title>%tu</title><p>%@", i, text];
+                [dataArray addObject:[markup dataUsingEncoding:NSASCIIStringEncoding]];
+                [contentTypes addObject:[NSNull null]];
+                break;
+        }
+        [expectedTexts addObject:[NSString stringWithFormat:@"%tu%@", i, text]];
+    }
+    
+    NSArray *documents = [HTMLDocument documentsWithDataArray:dataArray contentTypes:contentTypes];
+    XCTAssertEqualObjects([documents valueForKey:@"textContent"], expectedTexts);
+    XCTAssertEqual([HTMLDocument documentsWithDataArray:@[] contentTypes:nil].count, (NSUInteger)0);
+}
+
+@end
@@ -122,17 +122,12 @@
     for (NSURL *fileURL in TestFileURLs()) {
         NSString *testName = [fileURL.lastPathComponent stringByDeletingPathExtension];
         [TestsInFileAtURL(fileURL) enumerateObjectsUsingBlock:^(HTMLEncodingTest *test, NSUInteger i, BOOL *stop) {
-            // tests1.dat has four tests that require implementations HTMLReader doesn't have, so we'll skip those.
+            // tests1.dat has three tests that require implementations HTMLReader doesn't have, so we'll skip those.
             if ([fileURL.lastPathComponent isEqualToString:@"tests1.dat"]) {
                 // These three tests require scripting support, which HTMLReader does not.
                 if (i == 54 || i == 55 || i == 56) {
                     return;
                 }
-                
-                // This test passes successfully if one prescans the byte stream, which HTMLReader does not.
-                if (i == 57) {
-                    return;
-                }
             }
             
             HTMLParser *parser = ParserWithDataAndContentType(test.testData, nil);
@@ -145,6 +140,38 @@
     }
 }
 
+- (void)testPrescanningForMetaCharset
+{
+    HTMLStringEncoding (^determine)(NSString *) = ^(NSString *markup) {
+        return DeterminedStringEncodingForData([markup dataUsingEncoding:NSISOLatin1StringEncoding], nil);
+    };
+    XCTAssertEqual(determine(@"<!doctype html><META CHARSET='Shift_JIS'>").encoding, CFStringConvertEncodingToNSStringEncoding(kCFStringEncodingShiftJIS));
+    XCTAssertEqual(determine(@"<!-- <meta charset=big5> --><meta charset=koi8-r>").encoding, CFStringConvertEncodingToNSStringEncoding(kCFStringEncodingKOI8_R));
+    XCTAssertEqual(determine(@"<meta http-equiv=content-type content=\"text/html; charset=euc-jp\">").encoding, NSJapaneseEUCStringEncoding);
+    XCTAssertEqual(determine(@"<meta content=\"text/html; charset=euc-jp\">").encoding, NSWindowsCP1252StringEncoding);
+    XCTAssertEqual(determine(@"<meta http-equiv=content-type content=\"text/html; charset=euc-jp\" charset=koi8-r>").encoding, NSJapaneseEUCStringEncoding);
+    XCTAssertEqual(determine(@"<p title='<meta charset=big5>'><meta charset=utf-16le>").encoding, NSUTF8StringEncoding);
+    XCTAssertEqual(determine(@"<meta charset=utf-8").encoding, NSWindowsCP1252StringEncoding);
+    XCTAssertEqual(determine(@"<meta charset=utf-8>").confidence, Tentative);
+    
+    NSString *padding = [@"" stringByPaddingToLength:PrescanByteCount withString:@" " startingAtIndex:0];
+    XCTAssertEqual(determine([padding stringByAppendingString:@"<meta charset=utf-8>"]).encoding, NSWindowsCP1252StringEncoding);
+    
+    XCTAssertEqual(StringEncodingForLabel(@" UTF8\n"), NSUTF8StringEncoding);
+    XCTAssertEqual(StringEncodingForLabel(@"x-mac-ukrainian"), CFStringConvertEncodingToNSStringEncoding(kCFStringEncodingMacCyrillic));
+    XCTAssertEqual(StringEncodingForLabel(@"utf-9"), InvalidStringEncoding());
+    XCTAssertEqual(StringEncodingForLabel(@"\u00FCtf-8"), InvalidStringEncoding());
+}
+
+- (void)testMetaCharsetFoundBeforeParsing
+{
+    NSString *markup = @"<meta charset=utf-8><p>caf\u00E9";
+    HTMLParser *parser = ParserWithDataAndContentType([markup dataUsingEncoding:NSUTF8StringEncoding], nil);
+    XCTAssertEqual(parser.encoding.encoding, NSUTF8StringEncoding);
+    XCTAssertEqual(parser.encoding.confidence, Certain);
+    XCTAssertEqualObjects(parser.document.textContent, @"caf\u00E9");
+}
+
 static NSArray * TestFileURLs(void)
 {
     NSURL *directory = [[NSURL URLWithString:html5libTestPath()] URLByAppendingPathComponent:@"encoding"];
@@ -35,6 +35,28 @@
     XCTAssertEqualObjects([@"" html_stringByUnescapingHTML], @"");
 }
 
+- (void)testUnescapingLongestNamedEntity
+{
+    XCTAssertEqualObjects([@"&notin;" html_stringByUnescapingHTML], @"\u2209");
+    XCTAssertEqualObjects([@"&notit;" html_stringByUnescapingHTML], @"\u00ACit;");
+    XCTAssertEqualObjects([@"&ampx &amp;x" html_stringByUnescapingHTML], @"&x &x");
+    XCTAssertEqualObjects([@"&ThickSpace;" html_stringByUnescapingHTML], @"\u205F\u200A");
+    XCTAssertEqualObjects([@"&CounterClockwiseContourIntegral;&CounterClockwise" html_stringByUnescapingHTML], @"\u2233&CounterClockwise");
+}
+
+- (void)testSinglePassEdgeCases
+{
+    XCTAssertEqualObjects([@"&amp; &" html_stringByUnescapingHTML], @"& &");
+    XCTAssertEqualObjects([@"&#128512;&#x110000;&#xD800;&#128;" html_stringByUnescapingHTML], @"\U0001F600\uFFFD\uFFFD\u20AC");
+    XCTAssertEqualObjects([@"caf\u00E9 &eacute; \U0001F600" html_stringByUnescapingHTML], @"caf\u00E9 \u00E9 \U0001F600");
+    XCTAssertEqualObjects([@"a long run of plain text before \"quotes\" & more" html_stringByEscapingForHTML], @"a long run of plain text before &quot;quotes&quot; &amp; more");
+    
+    NSString *plain = @"nothing to see here, just a long enough string to scan in chunks";
+    XCTAssertEqual([plain html_stringByEscapingForHTML], plain);
+    XCTAssertEqual([plain html_stringByUnescapingHTML], plain);
+    XCTAssertEqualObjects([@"&Nope; &# &#x;" html_stringByUnescapingHTML], @"&Nope; &# &#x;");
+}
+
 - (void)testRoundTrip
 {
     NSString *s = @"<hello & howdy>";
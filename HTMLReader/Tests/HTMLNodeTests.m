@@ -5,6 +5,8 @@
 #import <XCTest/XCTest.h>
 #import "HTMLComment.h"
 #import "HTMLDocument.h"
+#import "HTMLMemoryFootprint.h"
+#import "HTMLSelector.h"
 #import "HTMLTextNode.h"
 
 @interface HTMLNodeTests : XCTestCase
@@ -76,6 +78,43 @@ static NSArray *nodeChildClasses;
     XCTAssertEqualObjects(element.attributes.allKeys[0], @"id");
 }
 
+- (void)testManyAttributes
+{
+    NSMutableString *html = [NSMutableString stringWithString:@"<p"];
+    NSMutableArray *names = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 12; i++) {
+        [html appendFormat:@" data-%@=%@", @(i), @(i)];
+        [names addObject:[NSString stringWithFormat:@"data-%@", @(i)]];
+    }
+    [html appendString:@" data-3=dupe class=x>"];
+    HTMLDocument *document = [HTMLDocument documentWithString:html];
+    HTMLElement *p = [document firstNodeMatchingSelector:@"p"];
+    [names addObject:@"class"];
+    XCTAssertEqualObjects(p.attributes.allKeys, names);
+    XCTAssertEqualObjects(p[@"data-3"], @"3");
+    XCTAssertEqualObjects(p[[NSMutableString stringWithString:@"data-11"]], @"11");
+    XCTAssertEqualObjects([document firstNodeMatchingSelector:@"[data-7='7']"], p);
+    XCTAssertEqualObjects([document firstNodeMatchingSelector:@"[data-7^='7']"], p);
+    
+    [p removeAttributeWithName:@"data-0"];
+    [names removeObjectAtIndex:0];
+    XCTAssertEqualObjects(p.attributes.allKeys, names);
+    XCTAssertNil(p[@"data-0"]);
+    XCTAssertEqualObjects(p[@"class"], @"x");
+    XCTAssertTrue([p.serializedFragment hasPrefix:@"<p data-1=\"1\" data-2=\"2\""]);
+    
+    HTMLElement *copy = [p copy];
+    XCTAssertEqualObjects(copy.attributes, p.attributes);
+    copy[@"data-1"] = @"one";
+    XCTAssertEqualObjects(p[@"data-1"], @"1");
+    XCTAssertEqualObjects(copy.attributes.allKeys, names);
+    
+    copy[@"class"] = nil;
+    XCTAssertNil(copy[@"class"]);
+    XCTAssertEqual(copy.attributes.count, names.count - 1);
+    XCTAssertEqualObjects(p[@"class"], @"x");
+}
+
 - (void)testNode
 {
     HTMLComment *comment = [HTMLComment new];
@@ -113,6 +152,53 @@ static NSArray *nodeChildClasses;
     XCTAssertNil(h1.parentNode);
 }
 
+- (void)testChildIndexesAndSiblings
+{
+    HTMLElement *parent = [[HTMLElement alloc] initWithTagName:@"ol" attributes:nil];
+    NSMutableArray *items = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 5; i++) {
+        HTMLElement *item = [[HTMLElement alloc] initWithTagName:@"li" attributes:nil];
+        [items addObject:item];
+        [[parent mutableChildren] addObject:item];
+    }
+    for (NSUInteger i = 0; i < items.count; i++) {
+        XCTAssertEqual([parent indexOfChild:items[i]], i);
+    }
+    HTMLElement *first = items[0], *second = items[1], *third = items[2], *fourth = items[3], *fifth = items[4];
+    XCTAssertNil(first.previousSibling);
+    XCTAssertEqual(first.nextSibling, second);
+    XCTAssertEqual(fifth.previousSibling, fourth);
+    XCTAssertNil(fifth.nextSibling);
+    
+    HTMLComment *comment = [HTMLComment new];
+    [[parent mutableChildren] insertObject:comment atIndex:1];
+    XCTAssertEqual([parent indexOfChild:comment], (NSUInteger)1);
+    XCTAssertEqual([parent indexOfChild:second], (NSUInteger)2);
+    XCTAssertEqual([parent indexOfChild:fifth], (NSUInteger)5);
+    XCTAssertEqual(second.previousSibling, comment);
+    
+    [[parent mutableChildren] removeObject:first];
+    XCTAssertEqual([parent indexOfChild:first], (NSUInteger)NSNotFound);
+    XCTAssertNil(first.nextSibling);
+    XCTAssertEqual([parent indexOfChild:comment], (NSUInteger)0);
+    XCTAssertEqual([parent indexOfChild:fifth], (NSUInteger)4);
+    XCTAssertEqual([[parent mutableChildren] indexOfObject:third], (NSUInteger)2);
+    
+    // Already a child, so nothing happens.
+    [[parent mutableChildren] addObject:comment];
+    XCTAssertEqual(parent.numberOfChildren, (NSUInteger)5);
+    XCTAssertEqual([parent indexOfChild:comment], (NSUInteger)0);
+    
+    // Moving a node to a new parent takes it out of the old one.
+    HTMLElement *otherParent = [[HTMLElement alloc] initWithTagName:@"ul" attributes:nil];
+    [[otherParent mutableChildren] addObject:third];
+    XCTAssertEqual(third.parentNode, otherParent);
+    XCTAssertEqual([parent indexOfChild:third], (NSUInteger)NSNotFound);
+    XCTAssertEqualObjects(parent.children.array, (@[ comment, second, fourth, fifth ]));
+    XCTAssertEqual(fourth.previousSibling, second);
+    XCTAssertEqual([otherParent indexOfChild:nil], (NSUInteger)NSNotFound);
+}
+
 - (void)testTextContent
 {
     HTMLElement *root = [[HTMLElement alloc] initWithTagName:@"body" attributes:nil];
@@ -138,6 +224,46 @@ static NSArray *nodeChildClasses;
     XCTAssertNil(comment.parentNode);
 }
 
+- (void)testTextContentWithOptions
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<title> Bus\n times </title><script>var x;</script><style>p {}</style><div>  Stop   <b>1</b></div><p>next<br>line</p><table><tr><td> A </td><td>B</td></tr><tr><td>C</td></tr></table>"];
+    HTMLElement *body = [document firstNodeMatchingSelector:@"body"];
+    XCTAssertEqualObjects([body textContentWithOptions:0], body.textContent);
+    XCTAssertEqualObjects([document textContentWithOptions:HTMLTextContentSkipScriptAndStyle], @" Bus\n times   Stop   1nextline A BC");
+    XCTAssertEqualObjects([body textContentWithOptions:HTMLTextContentCollapseWhitespace], @"Stop 1nextline A BC");
+    
+    HTMLTextContentOptions tidy = HTMLTextContentCollapseWhitespace | HTMLTextContentSkipScriptAndStyle | HTMLTextContentBlockSeparators;
+    XCTAssertEqualObjects([document textContentWithOptions:tidy], @"Bus times\nStop 1\nnext\nline\nA\tB\nC");
+    XCTAssertEqualObjects([[document firstNodeMatchingSelector:@"td"] textContentWithOptions:tidy], @"A");
+}
+
+- (void)testCachedTextContentChangesWithSubtree
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<table><tr><td>1</td><td>2</td></tr></table>"];
+    HTMLElement *table = [document firstNodeMatchingSelector:@"table"];
+    HTMLElement *cell = [document firstNodeMatchingSelector:@"td"];
+    NSString *cellText = [cell textContentWithOptions:HTMLTextContentCollapseWhitespace];
+    XCTAssertEqualObjects(cellText, @"1");
+    XCTAssertEqual([cell textContentWithOptions:HTMLTextContentCollapseWhitespace], cellText);
+    XCTAssertEqualObjects(table.textContent, @"12");
+    
+    [(HTMLTextNode *)[cell childAtIndex:0] appendString:@"0"];
+    XCTAssertEqualObjects([cell textContentWithOptions:HTMLTextContentCollapseWhitespace], @"10");
+    XCTAssertEqualObjects(table.textContent, @"102");
+    
+    [[cell mutableChildren] addObject:[[HTMLElement alloc] initWithTagName:@"br" attributes:nil]];
+    [[cell mutableChildren] addObject:[[HTMLTextNode alloc] initWithData:@"!"]];
+    XCTAssertEqualObjects(table.textContent, @"10!2");
+    [(HTMLTextNode *)cell.children.lastObject appendString:@"?"];
+    XCTAssertEqualObjects(table.textContent, @"10!?2");
+    
+    [cell removeFromParentNode];
+    XCTAssertEqualObjects(table.textContent, @"2");
+    
+    table.textContent = @"gone";
+    XCTAssertEqualObjects(document.textContent, @"gone");
+}
+
 - (void)testClassAttribute
 {
     HTMLElement *p = [[HTMLElement alloc] initWithTagName:@"p" attributes:@{ @"class": @"unboring" }];
@@ -166,4 +292,30 @@ static NSArray *nodeChildClasses;
     XCTAssertNil(weakP);
 }
 
+- (void)testMemoryFootprint
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<!doctype html><p id=a class='x y'>Hello<!-- hi --><custom-tag data-z=1>there</custom-tag>"];
+    HTMLMemoryFootprint *footprint = document.memoryFootprint;
+    XCTAssertEqual(footprint.numberOfNodes, (NSUInteger)10);
+    XCTAssertEqual(footprint.numberOfElements, (NSUInteger)5);
+    XCTAssertEqual(footprint.numberOfTextNodes, (NSUInteger)2);
+    XCTAssertEqual(footprint.numberOfComments, (NSUInteger)1);
+    XCTAssertEqual(footprint.numberOfOtherNodes, (NSUInteger)2);
+    XCTAssertEqual(footprint.numberOfAttributes, (NSUInteger)3);
+    XCTAssertGreaterThan(footprint.textBytes, (NSUInteger)0);
+    XCTAssertGreaterThan(footprint.attributeBytes, (NSUInteger)0);
+    XCTAssertGreaterThan(footprint.childContainerBytes, (NSUInteger)0);
+    XCTAssertEqual(footprint.cacheBytes, (NSUInteger)0);
+    XCTAssertEqual(footprint.estimatedBytes, footprint.nodeBytes + footprint.textBytes + footprint.attributeBytes + footprint.childContainerBytes + footprint.attributeContainerBytes);
+    XCTAssertEqualObjects(footprint.dictionaryRepresentation[@"numberOfElements"], @5);
+    
+    HTMLElement *p = [document firstNodeMatchingSelector:@".x"];
+    XCTAssertEqual(p.memoryFootprint.numberOfNodes, (NSUInteger)5);
+    
+    (void)p.textContent;
+    HTMLMemoryFootprint *cached = document.memoryFootprint;
+    XCTAssertGreaterThan(cached.cacheBytes, (NSUInteger)0);
+    XCTAssertEqual(cached.estimatedBytes - cached.cacheBytes, footprint.estimatedBytes);
+}
+
 @end
@@ -0,0 +1,91 @@
+//  HTMLPruningParserTests.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <XCTest/XCTest.h>
+#import "HTMLDocument.h"
+#import "HTMLPruningParser.h"
+#import "HTMLSerialization.h"
+
+@interface HTMLPruningParserTests : XCTestCase
+
+@end
+
+@implementation HTMLPruningParserTests
+
+static NSString * const Page = (@"<!doctype html><title>Stops</title>"
+                                @"<p>Intro <b>text<p>more"
+                                @"<h2>Weekdays</h2><table class=times><tr><td>9:00<td>9:30<tr><td>10:00</table>"
+                                @"<ul><li>one<li class=x>two<li>three</ul>"
+                                @"<h2>Weekends</h2><table class=times>oops<tr><td>11:00</table>"
+                                @"<div><span>unrelated<br></span></div>");
+
+- (void)testMatchesAgreeWithFullParse
+{
+    HTMLDocument *fullDocument = [HTMLDocument documentWithString:Page];
+    for (NSString *selectorString in @[ @"table.times", @"h2 + table", @"li:nth-child(2)", @"li.x ~ li", @"td", @"b", @"title", @"br" ]) {
+        HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithString:Page keepSelector:[HTMLSelector selectorForString:selectorString]];
+        NSArray *expected = [[fullDocument nodesMatchingSelector:selectorString] valueForKey:@"serializedFragment"];
+        XCTAssertEqualObjects([parser.matchingElements valueForKey:@"serializedFragment"], expected, @"%@", selectorString);
+        XCTAssertEqualObjects([[parser.document nodesMatchingSelector:selectorString] valueForKey:@"serializedFragment"], expected, @"%@", selectorString);
+    }
+}
+
+- (void)testKeepsOnlyMatchesAndTheirAncestors
+{
+    HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithString:Page keepSelector:[HTMLSelector selectorForString:@"table"]];
+    HTMLDocument *document = parser.document;
+    XCTAssertEqual([document nodesMatchingSelector:@"table"].count, (NSUInteger)2);
+    XCTAssertEqual([document nodesMatchingSelector:@"td"].count, (NSUInteger)4);
+    XCTAssertNil([document firstNodeMatchingSelector:@"head"]);
+    XCTAssertNil([document firstNodeMatchingSelector:@"p"]);
+    XCTAssertNil([document firstNodeMatchingSelector:@"ul"]);
+    XCTAssertNil([document firstNodeMatchingSelector:@"div"]);
+    
+    // Foster-parented text ends up in front of the table, outside of it.
+    XCTAssertEqualObjects([document firstNodeMatchingSelector:@"body"].textContent, @"9:009:3010:0011:00");
+}
+
+- (void)testNoMatches
+{
+    HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithString:Page keepSelector:[HTMLSelector selectorForString:@"video"]];
+    XCTAssertEqual(parser.matchingElements.count, (NSUInteger)0);
+    XCTAssertEqual(parser.document.rootElement.numberOfChildren, (NSUInteger)0);
+}
+
+- (void)testStopsAfterFirstMatch
+{
+    HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithString:Page keepSelector:[HTMLSelector selectorForString:@"table"]];
+    parser.stopsAfterFirstMatch = YES;
+    parser.errorReporting = HTMLParseErrorReportingFull;
+    NSArray *matchingElements = parser.matchingElements;
+    XCTAssertEqual(matchingElements.count, (NSUInteger)1);
+    XCTAssertEqualObjects([matchingElements.firstObject textContent], @"9:009:3010:00");
+    XCTAssertEqual([parser.document nodesMatchingSelector:@"table"].count, (NSUInteger)1);
+    
+    // The foster-parented "oops" in the second table would have been a parse error.
+    NSUInteger fosterParentingErrors = [[parser.parseErrors valueForKey:@"reason"] indexesOfObjectsPassingTest:^BOOL(NSString *reason, NSUInteger i, BOOL *stop) {
+        return [reason rangeOfString:@"table" options:NSCaseInsensitiveSearch].location != NSNotFound;
+    }].count;
+    XCTAssertEqual(fosterParentingErrors, (NSUInteger)0);
+}
+
+- (void)testStopsAfterFirstMatchInHead
+{
+    HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithString:Page keepSelector:[HTMLSelector selectorForString:@"title"]];
+    parser.stopsAfterFirstMatch = YES;
+    parser.errorReporting = HTMLParseErrorReportingFull;
+    XCTAssertEqualObjects([parser.matchingElements valueForKey:@"textContent"], @[ @"Stops" ]);
+    XCTAssertEqualObjects(parser.document.serializedFragment, @"<!DOCTYPE html><html><head><title>Stops</title></head></html>");
+    XCTAssertEqual(parser.parseErrors.count, (NSUInteger)0);
+}
+
+- (void)testUTF8Data
+{
+    NSData *data = [@"<p>café</p><p class=keep>crème</p>" dataUsingEncoding:NSUTF8StringEncoding];
+    HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithData:data contentTypeHeader:@"text/html; charset=utf-8" keepSelector:[HTMLSelector selectorForString:@".keep"]];
+    XCTAssertEqualObjects([parser.matchingElements.firstObject textContent], @"crème");
+    XCTAssertEqual([parser.document nodesMatchingSelector:@"p"].count, (NSUInteger)1);
+}
+
+@end
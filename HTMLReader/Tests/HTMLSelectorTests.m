@@ -121,6 +121,8 @@
 - (void)testGeneralSiblingCombinator
 {
     TestMatchedElementIDs(@"elem~elem", (@[ @"child3" ]));
+    TestMatchedElementIDs(@"other~elem", (@[ @"child3" ]));
+    TestMatchedElementIDs(@"other~other", (@[]));
 }
 
 - (void)testIDSelector
@@ -192,6 +194,150 @@
 	TestMatchedElementIDs(@"input#input-disabled-by-fieldset + legend input", (@[ @"input-enabled-by-legend" ]));
 }
 
+- (void)testMatchingSubtreeAgreesWithMatchingEachElement
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:
+                              @"<div id=a class='x y'>"
+                              @"  <div class=x><p>1<p class=y>2</div>"
+                              @"  <section><div><p id=b>3</div></section>"
+                              @"</div>"
+                              @"<ul><li><p>4<li class=x><p>5</ul>"
+                              @"<p>6"];
+    NSArray *selectorStrings = @[ @"div p", @"div > p", @".x p", @"#a .x > p", @"div div p", @".x ~ section p",
+                                  @"li + li p", @"ul .x p", @"#a p.y", @"section div > p", @"body > p", @"[id=a] p",
+                                  @"div:first-child p", @"* > p" ];
+    for (NSString *selectorString in selectorStrings) {
+        HTMLSelector *selector = [HTMLSelector selectorForString:selectorString];
+        NSMutableArray *expected = [NSMutableArray new];
+        for (HTMLElement *element in document.treeEnumerator) {
+            if ([element isKindOfClass:[HTMLElement class]] && [selector matchesElement:element]) {
+                [expected addObject:element];
+            }
+        }
+        XCTAssertEqualObjects([document nodesMatchingParsedSelector:selector], expected, @"%@", selectorString);
+    }
+    XCTAssertEqual([document nodesMatchingSelector:@"div p"].count, (NSUInteger)3);
+    XCTAssertEqual([document nodesMatchingSelector:@".x ~ section p"].count, (NSUInteger)1);
+}
+
+- (void)testAncestorsOutsideSubtree
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<div class=outer><section><p id=inner></section></div>"];
+    HTMLElement *section = [document firstNodeMatchingSelector:@"section"];
+    XCTAssertEqualObjects([section firstNodeMatchingSelector:@".outer p"][@"id"], @"inner");
+    XCTAssertEqualObjects([section firstNodeMatchingSelector:@"div > section"], section);
+    XCTAssertNil([section firstNodeMatchingSelector:@".other p"]);
+}
+
+- (void)testIndexedQueriesAfterMutation
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<div id=x class=c><p class='c d'>one</p><P>two</P></div>"];
+    HTMLElement *div = [document firstNodeMatchingSelector:@"div"];
+    XCTAssertEqualObjects([document nodesMatchingSelector:@"#x"], @[ div ]);
+    XCTAssertEqual([document nodesMatchingSelector:@".c"].count, (NSUInteger)2);
+    XCTAssertEqual([document nodesMatchingSelector:@"p"].count, (NSUInteger)2);
+    
+    div[@"id"] = @"y";
+    XCTAssertEqual([document nodesMatchingSelector:@"#x"].count, (NSUInteger)0);
+    XCTAssertEqualObjects([document nodesMatchingSelector:@"#y"], @[ div ]);
+    
+    [div removeAttributeWithName:@"class"];
+    XCTAssertEqual([document nodesMatchingSelector:@".c"].count, (NSUInteger)1);
+    [div toggleClass:@"e"];
+    XCTAssertEqualObjects([document nodesMatchingSelector:@".e"], @[ div ]);
+    HTMLElement *p = [document firstNodeMatchingSelector:@"p"];
+    [p toggleClass:@"c"];
+    XCTAssertEqual([document nodesMatchingSelector:@".c"].count, (NSUInteger)0);
+    XCTAssertEqualObjects([document nodesMatchingSelector:@"div > .d"], @[ p ]);
+    
+    HTMLElement *added = [[HTMLElement alloc] initWithTagName:@"p" attributes:@{ @"id": @"x", @"class": @"c" }];
+    added.parentNode = div;
+    XCTAssertEqualObjects([document nodesMatchingSelector:@"#x"], @[ added ]);
+    XCTAssertEqualObjects([document nodesMatchingSelector:@".c"], @[ added ]);
+    XCTAssertEqual([document nodesMatchingSelector:@"p"].count, (NSUInteger)3);
+    XCTAssertEqualObjects([div nodesMatchingSelector:@"#x"], @[ added ]);
+    XCTAssertEqual([p nodesMatchingSelector:@"#x"].count, (NSUInteger)0);
+    added[@"id"] = @"z";
+    XCTAssertEqualObjects([document nodesMatchingSelector:@"#z"], @[ added ]);
+    
+    [p removeFromParentNode];
+    XCTAssertEqual([document nodesMatchingSelector:@"p"].count, (NSUInteger)2);
+    XCTAssertEqual([document nodesMatchingSelector:@".d"].count, (NSUInteger)0);
+    
+    div.textContent = @"gone";
+    XCTAssertEqual([document nodesMatchingSelector:@"#x"].count, (NSUInteger)0);
+    XCTAssertEqual([document nodesMatchingSelector:@"p"].count, (NSUInteger)0);
+}
+
+- (void)testSelectorSet
+{
+    NSArray *selectorStrings = @[ @"div p", @"div span", @"div > p", @"div.a p", @"div.a span", @"div p",
+                                  @"p + p", @"section ~ div p", @"#last", @":not(p)", @"nothing" ];
+    NSMutableArray *selectors = [NSMutableArray new];
+    for (NSString *selectorString in selectorStrings) {
+        [selectors addObject:[HTMLSelector selectorForString:selectorString]];
+    }
+    HTMLSelectorSet *selectorSet = [[HTMLSelectorSet alloc] initWithSelectors:selectors];
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<section></section><div class=a><p><span></span></p><p id=last></p></div><div><p></p></div>"];
+    HTMLElement *div = [document firstNodeMatchingSelector:@"div"];
+    for (HTMLNode *root in @[ document, div ]) {
+        NSArray *results = [root nodesMatchingSelectorSet:selectorSet];
+        XCTAssertEqual(results.count, selectors.count);
+        [selectors enumerateObjectsUsingBlock:^(HTMLSelector *selector, NSUInteger i, BOOL *stop) {
+            XCTAssertEqualObjects(results[i], [root nodesMatchingParsedSelector:selector], @"%@", selector.string);
+        }];
+    }
+    XCTAssertEqual([[document nodesMatchingSelectorSet:selectorSet][3] count], (NSUInteger)2);
+}
+
+- (void)testSelectorCache
+{
+    NSUInteger oldCapacity = [HTMLSelector cacheCapacity];
+    [HTMLSelector setCacheCapacity:2];
+    NSString *a = @"p.cache-a";
+    NSString *b = @"p.cache-b";
+    NSString *c = @"p.cache-c";
+    
+    NSUInteger hits = [HTMLSelector cacheHitCount];
+    NSUInteger misses = [HTMLSelector cacheMissCount];
+    HTMLSelector *selectorA = [HTMLSelector cachedSelectorForString:a];
+    HTMLSelector *selectorB = [HTMLSelector cachedSelectorForString:b];
+    XCTAssertEqual([HTMLSelector cachedSelectorForString:[a mutableCopy]], selectorA);
+    XCTAssertEqual([HTMLSelector cacheHitCount] - hits, (NSUInteger)1);
+    XCTAssertEqual([HTMLSelector cacheMissCount] - misses, (NSUInteger)2);
+    
+    // b is now the least recently used, so it goes first.
+    [HTMLSelector cachedSelectorForString:c];
+    XCTAssertEqual([HTMLSelector cachedSelectorForString:a], selectorA);
+    XCTAssertNotEqual([HTMLSelector cachedSelectorForString:b], selectorB);
+    
+    [HTMLSelector setCacheCapacity:0];
+    XCTAssertNotEqual([HTMLSelector cachedSelectorForString:a], selectorA);
+    XCTAssertNotEqual([HTMLSelector cachedSelectorForString:a], [HTMLSelector cachedSelectorForString:a]);
+    [HTMLSelector setCacheCapacity:oldCapacity];
+}
+
+- (void)testSelectorCacheFromManyThreads
+{
+    NSUInteger oldCapacity = [HTMLSelector cacheCapacity];
+    [HTMLSelector setCacheCapacity:4];
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<div><p class=a>1<p class=b>2<p class=c>3</div>"];
+    NSArray *selectorStrings = @[ @"p", @"div p", @".a", @".b", @".c", @"div > .c", @"p + p", @"p ~ .c" ];
+    NSArray *counts = @[ @3, @3, @1, @1, @1, @1, @2, @1 ];
+    __block NSUInteger failures = 0;
+    dispatch_apply(1000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+        NSUInteger j = i % selectorStrings.count;
+        HTMLSelector *selector = [HTMLSelector cachedSelectorForString:selectorStrings[j]];
+        if (![selector.string isEqualToString:selectorStrings[j]] || [document nodesMatchingParsedSelector:selector].count != [counts[j] unsignedIntegerValue]) {
+            @synchronized (selectorStrings) {
+                failures++;
+            }
+        }
+    });
+    XCTAssertEqual(failures, (NSUInteger)0);
+    [HTMLSelector setCacheCapacity:oldCapacity];
+}
+
 #define ExpectError(selectorString) XCTAssertNotNil([HTMLSelector selectorForString:selectorString].error)
 
 - (void)testBadInput
@@ -12,6 +12,19 @@
 
 @end
 
+@interface HTMLShoutingElement : HTMLElement
+
+@end
+
+@implementation HTMLShoutingElement
+
+- (NSString *)serializedFragment
+{
+    return [super serializedFragment].uppercaseString;
+}
+
+@end
+
 @implementation HTMLSerializerTests
 
 - (void)testBareElement
@@ -77,4 +90,58 @@
     XCTAssertEqualObjects(node.serializedFragment, @"<p num=\"1\"></p>");
 }
 
+- (void)testWritingToData
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<!doctype html><p title='café \U0001F68C'>a &amp; b<!-- c --><pre>\n\nd</pre>"];
+    NSMutableData *data = [NSMutableData dataWithBytes:"x" length:1];
+    [document writeSerializedFragmentToData:data];
+    NSString *expected = [@"x" stringByAppendingString:document.serializedFragment];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding], expected);
+    XCTAssertEqualObjects(document.serializedFragment, @"<!DOCTYPE html><html><head></head><body><p title=\"café \U0001F68C\">a &amp; b<!-- c --></p><pre>\n\nd</pre></body></html>");
+    XCTAssertEqualObjects([document firstNodeMatchingSelector:@"p"].innerHTML, @"a &amp; b<!-- c -->");
+}
+
+- (void)testWritingToStream
+{
+    HTMLDocument *document = [HTMLDocument documentWithString:@"<p>Stop &amp; go</p>"];
+    NSOutputStream *stream = [NSOutputStream outputStreamToMemory];
+    [stream open];
+    NSError *error;
+    XCTAssertTrue([document writeSerializedFragmentToStream:stream error:&error], @"%@", error);
+    [stream close];
+    NSData *data = [stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding], document.serializedFragment);
+}
+
+- (void)testDeeplyNestedElements
+{
+    HTMLElement *root = [[HTMLElement alloc] initWithTagName:@"div" attributes:nil];
+    HTMLElement *parent = root;
+    for (NSUInteger i = 0; i < 5000; i++) {
+        HTMLElement *child = [[HTMLElement alloc] initWithTagName:@"span" attributes:nil];
+        [[parent mutableChildren] addObject:child];
+        parent = child;
+    }
+    NSString *fragment = root.serializedFragment;
+    XCTAssertEqual(fragment.length, (NSUInteger)(strlen("<div></div>") + 5000 * strlen("<span></span>")));
+    XCTAssertTrue([fragment hasPrefix:@"<div><span><span>"]);
+    XCTAssertTrue([fragment hasSuffix:@"</span></span></div>"]);
+}
+
+- (void)testSubclassOverridingSerializedFragment
+{
+    HTMLElement *parent = [[HTMLElement alloc] initWithTagName:@"p" attributes:nil];
+    HTMLElement *shouting = [[HTMLShoutingElement alloc] initWithTagName:@"b" attributes:@{ @"class": @"loud" }];
+    [[shouting mutableChildren] addObject:[[HTMLTextNode alloc] initWithData:@"hey"]];
+    [[parent mutableChildren] addObject:[[HTMLTextNode alloc] initWithData:@"well "]];
+    [[parent mutableChildren] addObject:shouting];
+    XCTAssertEqualObjects(shouting.serializedFragment, @"<B CLASS=\"LOUD\">HEY</B>");
+    XCTAssertEqualObjects(parent.serializedFragment, @"<p>well <B CLASS=\"LOUD\">HEY</B></p>");
+    XCTAssertEqualObjects(parent.innerHTML, @"well <B CLASS=\"LOUD\">HEY</B>");
+    
+    NSMutableData *data = [NSMutableData new];
+    [parent writeSerializedFragmentToData:data];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding], parent.serializedFragment);
+}
+
 @end
@@ -0,0 +1,120 @@
+//  HTMLStreamingParserTests.m
+//
+//  Public domain. https://github.com/nolanw/HTMLReader
+
+#import <XCTest/XCTest.h>
+#import "HTMLComment.h"
+#import "HTMLDocument.h"
+#import "HTMLStreamingParser.h"
+#import "HTMLTextNode.h"
+
+@interface HTMLStreamingParserTests : XCTestCase
+
+@end
+
+@implementation HTMLStreamingParserTests
+
+- (void)testEventsMatchDocument
+{
+    NSArray *strings = @[ @"<!doctype html><title>Hi</title><p class=a>One <b>two</b><!-- three --><ul><li>1<li>2</ul>",
+                          @"<p>implied<p>end tags<div>and <i>more</div>",
+                          @"<table><tr><td>1<td>2<tr><td>3</table>after",
+                          @"<svg><circle r=1 /></svg><math><mi>x</mi></math>" ];
+    for (NSString *string in strings) {
+        NSString *streamed = [self eventsForString:string];
+        NSMutableString *expected = [NSMutableString new];
+        [self appendEventsForChildrenOfNode:[HTMLDocument documentWithString:string] toString:expected];
+        XCTAssertEqualObjects(streamed, expected, @"%@", string);
+    }
+}
+
+- (void)testDepthAndAncestors
+{
+    HTMLStreamingParser *parser = [[HTMLStreamingParser alloc] initWithString:@"<table><tr><td>cell</td></tr></table>"];
+    __block NSArray *cellAncestors;
+    __block NSUInteger cellDepth = NSNotFound;
+    parser.foundText = ^(NSString *text, NSUInteger depth, NSArray *ancestorNames) {
+        if ([text isEqualToString:@"cell"]) {
+            cellAncestors = [ancestorNames copy];
+            cellDepth = depth;
+        }
+    };
+    __block NSInteger openElements = 0;
+    __block NSInteger mostOpenElements = 0;
+    parser.didStartElement = ^(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames) {
+        XCTAssertEqual(depth, (NSUInteger)openElements);
+        openElements++;
+        mostOpenElements = MAX(openElements, mostOpenElements);
+    };
+    parser.didEndElement = ^(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames) {
+        openElements--;
+        XCTAssertEqual(depth, (NSUInteger)openElements);
+    };
+    [parser parse];
+    XCTAssertEqualObjects(cellAncestors, (@[ @"html", @"body", @"table", @"tbody", @"tr", @"td" ]));
+    XCTAssertEqual(cellDepth, (NSUInteger)6);
+    XCTAssertEqual(openElements, (NSInteger)0);
+    XCTAssertEqual(mostOpenElements, (NSInteger)6);
+}
+
+- (void)testFosterParenting
+{
+    HTMLStreamingParser *parser = [[HTMLStreamingParser alloc] initWithString:@"<table><tr><td>1</td></tr>oops<tr><td>2</td></tr></table>"];
+    NSMutableArray *texts = [NSMutableArray new];
+    parser.foundText = ^(NSString *text, NSUInteger depth, NSArray *ancestorNames) {
+        [texts addObject:[NSString stringWithFormat:@"%@ in %@", text, ancestorNames.lastObject]];
+    };
+    [parser parse];
+    XCTAssertEqualObjects(texts, (@[ @"1 in td", @"oops in body", @"2 in td" ]));
+    XCTAssertTrue(parser.errors.count > 0);
+}
+
+- (void)testUTF8Data
+{
+    NSString *string = @"<p>café</p>";
+    HTMLStreamingParser *parser = [[HTMLStreamingParser alloc] initWithData:[string dataUsingEncoding:NSUTF8StringEncoding] contentTypeHeader:@"text/html; charset=utf-8"];
+    NSMutableString *text = [NSMutableString new];
+    parser.foundText = ^(NSString *piece, NSUInteger depth, NSArray *ancestorNames) {
+        [text appendString:piece];
+    };
+    [parser parse];
+    XCTAssertEqualObjects(text, @"café");
+}
+
+- (NSString *)eventsForString:(NSString *)string
+{
+    HTMLStreamingParser *parser = [[HTMLStreamingParser alloc] initWithString:string];
+    NSMutableString *events = [NSMutableString new];
+    parser.didStartElement = ^(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames) {
+        [events appendFormat:@"<%@%@>", element.tagName, [element.attributes.allKeys componentsJoinedByString:@","]];
+    };
+    parser.didEndElement = ^(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames) {
+        [events appendFormat:@"</%@>", element.tagName];
+    };
+    parser.foundText = ^(NSString *text, NSUInteger depth, NSArray *ancestorNames) {
+        [events appendString:text];
+    };
+    parser.foundComment = ^(NSString *comment, NSUInteger depth, NSArray *ancestorNames) {
+        [events appendFormat:@"<!--%@-->", comment];
+    };
+    [parser parse];
+    return events;
+}
+
+- (void)appendEventsForChildrenOfNode:(HTMLNode *)node toString:(NSMutableString *)events
+{
+    for (HTMLNode *child in node.children) {
+        if ([child isKindOfClass:[HTMLElement class]]) {
+            HTMLElement *element = (HTMLElement *)child;
+            [events appendFormat:@"<%@%@>", element.tagName, [element.attributes.allKeys componentsJoinedByString:@","]];
+            [self appendEventsForChildrenOfNode:element toString:events];
+            [events appendFormat:@"</%@>", element.tagName];
+        } else if ([child isKindOfClass:[HTMLTextNode class]]) {
+            [events appendString:((HTMLTextNode *)child).data];
+        } else if ([child isKindOfClass:[HTMLComment class]]) {
+            [events appendFormat:@"<!--%@-->", ((HTMLComment *)child).data];
+        }
+    }
+}
+
+@end
@@ -3,6 +3,7 @@
 //  Public domain. https://github.com/nolanw/HTMLReader
 
 #import "HTMLTestUtilities.h"
+#import "HTMLAtom.h"
 #import "HTMLString.h"
 #import "HTMLTokenizer.h"
 
@@ -97,6 +98,16 @@
         tokenizer.state = state;
         [tokenizer setLastStartTag:_dictionary[@"lastStartTag"]];
         [tokenizers addObject:tokenizer];
+        
+        // Tokenizing straight from UTF-8 should give the same results, at least for input that survives the trip through UTF-8 (i.e. no isolated surrogates).
+        NSData *UTF8Input = [input dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:NO];
+        if (UTF8Input) {
+            HTMLPreprocessedInputStream *inputStream = [[HTMLPreprocessedInputStream alloc] initWithUTF8Data:UTF8Input];
+            HTMLTokenizer *UTF8Tokenizer = [[HTMLTokenizer alloc] initWithInputStream:inputStream];
+            UTF8Tokenizer.state = state;
+            [UTF8Tokenizer setLastStartTag:_dictionary[@"lastStartTag"]];
+            [tokenizers addObject:UTF8Tokenizer];
+        }
     }
     _tokenizers = tokenizers;
     
@@ -184,6 +195,116 @@ static NSString * UnDoubleEscape(NSString *input)
     }
 }
 
+- (void)testMalformedUTF8
+{
+    NSData *data = [NSData dataWithBytes:"\xEF\xBB\xBF" "a\r\nb\xFF\xE2\x82" "c\xF0\x9F\x9A\x8C\xED\xA0\x80" length:18];
+    HTMLTokenizer *tokenizer = [[HTMLTokenizer alloc] initWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithUTF8Data:data]];
+    NSArray *tokens = [self concatenateCharacterTokens:tokenizer.allObjects];
+    HTMLCharacterToken *expected = [[HTMLCharacterToken alloc] initWithString:@"a\nb\uFFFD\uFFFDc\U0001F68C\uFFFD\uFFFD\uFFFD"];
+    XCTAssertEqualObjects(tokens, @[ expected ]);
+}
+
+- (void)testLongTextRuns
+{
+    NSString *string = @"0123456789abcdef\tghijklmnopq\r\nrstuvwxyz\x01" "ABCDEFGHIJKLMNOP\u00E9QRSTUVWXYZ0123456789";
+    HTMLCharacterToken *expected = [[HTMLCharacterToken alloc] initWithString:@"0123456789abcdef\tghijklmnopq\nrstuvwxyz\x01" "ABCDEFGHIJKLMNOP\u00E9QRSTUVWXYZ0123456789"];
+    HTMLTokenizer *stringTokenizer = [[HTMLTokenizer alloc] initWithString:string];
+    XCTAssertEqualObjects(stringTokenizer.allObjects, @[ expected ]);
+    HTMLTokenizer *UTF8Tokenizer = [[HTMLTokenizer alloc] initWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithUTF8Data:[string dataUsingEncoding:NSUTF8StringEncoding]]];
+    XCTAssertEqualObjects(UTF8Tokenizer.allObjects, @[ expected ]);
+    
+    NSString *withMarkup = @"0123456789abcdefghijklmnopqrstu<b>vwxyz0123456789abcdefghij&amp;klmnopqrstuvwxyz";
+    NSArray *expectedTokens = @[ [[HTMLCharacterToken alloc] initWithString:@"0123456789abcdefghijklmnopqrstu"],
+                                 [[HTMLStartTagToken alloc] initWithTagName:@"b"],
+                                 [[HTMLCharacterToken alloc] initWithString:@"vwxyz0123456789abcdefghij&klmnopqrstuvwxyz"] ];
+    stringTokenizer = [[HTMLTokenizer alloc] initWithString:withMarkup];
+    XCTAssertEqualObjects([self concatenateCharacterTokens:stringTokenizer.allObjects], expectedTokens);
+    UTF8Tokenizer = [[HTMLTokenizer alloc] initWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithUTF8Data:[withMarkup dataUsingEncoding:NSUTF8StringEncoding]]];
+    XCTAssertEqualObjects([self concatenateCharacterTokens:UTF8Tokenizer.allObjects], expectedTokens);
+}
+
+- (void)testAdjacentCharactersAreCoalesced
+{
+    NSArray *tokens = [[HTMLTokenizer alloc] initWithString:@"a &amp; b &lt; c<p>d&#x41;e"].allObjects;
+    NSArray *expectedTokens = @[ [[HTMLCharacterToken alloc] initWithString:@"a & b < c"],
+                                 [[HTMLStartTagToken alloc] initWithTagName:@"p"],
+                                 [[HTMLCharacterToken alloc] initWithString:@"dAe"] ];
+    XCTAssertEqualObjects(tokens, expectedTokens);
+    
+    HTMLTokenizer *tokenizer = [[HTMLTokenizer alloc] initWithString:@"<textarea><b>&amp;</textarea>"];
+    XCTAssertEqualObjects([tokenizer nextObject], [[HTMLStartTagToken alloc] initWithTagName:@"textarea"]);
+    tokenizer.state = HTMLRCDATATokenizerState;
+    expectedTokens = @[ [[HTMLCharacterToken alloc] initWithString:@"<b>&"],
+                        [[HTMLEndTagToken alloc] initWithTagName:@"textarea"] ];
+    XCTAssertEqualObjects(tokenizer.allObjects, expectedTokens);
+}
+
+- (void)testErrorReporting
+{
+    NSString *string = @"<p a a>\n</p x>";
+    NSArray *tokens = [[HTMLTokenizer alloc] initWithString:string].allObjects;
+    NSArray *parseErrors = [tokens filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(id token, NSDictionary *bindings) {
+        return [token isKindOfClass:[HTMLParseErrorToken class]];
+    }]];
+    XCTAssertEqual(parseErrors.count, (NSUInteger)2);
+    XCTAssertEqual([parseErrors[0] line], (NSUInteger)1);
+    XCTAssertEqual([parseErrors[1] line], (NSUInteger)2);
+    
+    HTMLTokenizer *counter = [[HTMLTokenizer alloc] initWithString:string];
+    counter.errorReporting = HTMLParseErrorReportingCount;
+    NSArray *countedTokens = counter.allObjects;
+    XCTAssertEqual(countedTokens.count, tokens.count - parseErrors.count);
+    XCTAssertEqual(counter.numberOfErrors, parseErrors.count);
+    
+    HTMLTokenizer *quiet = [[HTMLTokenizer alloc] initWithString:string];
+    quiet.errorReporting = HTMLParseErrorReportingOff;
+    XCTAssertEqualObjects(quiet.allObjects, countedTokens);
+    XCTAssertEqual(quiet.numberOfErrors, (NSUInteger)0);
+}
+
+- (void)testPeekingDoesNotReportErrors
+{
+    unichar loneSurrogate[] = { 'a', '&', 'b', 0xD800, 'c' };
+    NSArray *strings = @[ @"a&amp;\x01" "b",
+                          @"a&\x01" "b",
+                          [NSString stringWithCharacters:loneSurrogate length:sizeof(loneSurrogate) / sizeof(*loneSurrogate)] ];
+    for (NSString *string in strings) {
+        HTMLTokenizer *counter = [[HTMLTokenizer alloc] initWithString:string];
+        counter.errorReporting = HTMLParseErrorReportingCount;
+        (void)counter.allObjects;
+        XCTAssertEqual(counter.numberOfErrors, (NSUInteger)1, @"%@", string);
+    }
+}
+
+- (void)testRecycledTokens
+{
+    NSString *string = @"<a href=x>one</a><!-- two --><b>three</b><i class=y>four</i>";
+    NSArray *expectedTokens = [[HTMLTokenizer alloc] initWithString:string].allObjects;
+    HTMLTokenizer *tokenizer = [[HTMLTokenizer alloc] initWithString:string];
+    NSUInteger i = 0;
+    for (id token in tokenizer) {
+        XCTAssertEqualObjects(token, expectedTokens[i]);
+        i++;
+        [tokenizer recycleToken:token];
+    }
+    XCTAssertEqual(i, expectedTokens.count);
+}
+
+- (void)testTagNamesAreAtoms
+{
+    NSArray *tokens = [[HTMLTokenizer alloc] initWithString:@"<div class=a><x-widget class=b></x-widget></DIV>"].allObjects;
+    XCTAssertEqual(tokens.count, (NSUInteger)4);
+    XCTAssertEqual([tokens[0] tagName], HTMLKnownAtom(@"div"));
+    XCTAssertEqual([tokens[3] tagName], HTMLKnownAtom(@"div"));
+    XCTAssertNil(HTMLKnownAtom(@"x-widget"));
+    XCTAssertEqual([tokens[1] tagName], [tokens[2] tagName]);
+    XCTAssertEqual([[tokens[0] attributes] keyEnumerator].nextObject, HTMLKnownAtom(@"class"));
+    XCTAssertEqual([[tokens[1] attributes] keyEnumerator].nextObject, HTMLKnownAtom(@"class"));
+    
+    HTMLElement *element = [[HTMLElement alloc] initWithTagName:[@"di" stringByAppendingString:@"v"] attributes:nil];
+    XCTAssertEqual(element.tagName, HTMLKnownAtom(@"div"));
+}
+
 - (NSArray *)concatenateCharacterTokens:(NSArray *)separateTokens
 {
     NSMutableArray *tokens = [NSMutableArray new];
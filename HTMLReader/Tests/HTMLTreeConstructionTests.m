@@ -215,21 +215,7 @@ static id NodeOrAttributeNameValuePairFromString(NSString *s)
             HTMLParser *parser;
             HTMLStringEncoding defaultEncoding = (HTMLStringEncoding){ .encoding = NSUTF8StringEncoding, .confidence = Certain };
             if (test.documentFragment) {
-                HTMLElement *context;
-                NSScanner *scanner = [NSScanner scannerWithString:test.documentFragment];
-                scanner.charactersToBeSkipped = nil;
-                scanner.caseSensitive = YES;
-                if ([scanner scanString:@"math " intoString:nil]) {
-                    NSString *tagName = [scanner.string substringFromIndex:scanner.scanLocation];
-                    context = [[HTMLElement alloc] initWithTagName:tagName attributes:nil];
-                    context.htmlNamespace = HTMLNamespaceMathML;
-                } else if ([scanner scanString:@"svg " intoString:nil]) {
-                    NSString *tagName = [scanner.string substringFromIndex:scanner.scanLocation];
-                    context = [[HTMLElement alloc] initWithTagName:tagName attributes:nil];
-                    context.htmlNamespace = HTMLNamespaceSVG;
-                } else {
-                    context = [[HTMLElement alloc] initWithTagName:scanner.string attributes:nil];
-                }
+                HTMLElement *context = ContextElementForFragment(test.documentFragment);
                 parser = [[HTMLParser alloc] initWithString:test.data encoding:defaultEncoding context:context];
             } else {
                 parser = [[HTMLParser alloc] initWithString:test.data encoding:defaultEncoding context:nil];
@@ -254,6 +240,219 @@ static id NodeOrAttributeNameValuePairFromString(NSString *s)
     }
 }
 
+static HTMLElement * ContextElementForFragment(NSString *documentFragment)
+{
+    NSScanner *scanner = [NSScanner scannerWithString:documentFragment];
+    scanner.charactersToBeSkipped = nil;
+    scanner.caseSensitive = YES;
+    if ([scanner scanString:@"math " intoString:nil]) {
+        NSString *tagName = [scanner.string substringFromIndex:scanner.scanLocation];
+        HTMLElement *context = [[HTMLElement alloc] initWithTagName:tagName attributes:nil];
+        context.htmlNamespace = HTMLNamespaceMathML;
+        return context;
+    } else if ([scanner scanString:@"svg " intoString:nil]) {
+        NSString *tagName = [scanner.string substringFromIndex:scanner.scanLocation];
+        HTMLElement *context = [[HTMLElement alloc] initWithTagName:tagName attributes:nil];
+        context.htmlNamespace = HTMLNamespaceSVG;
+        return context;
+    } else {
+        return [[HTMLElement alloc] initWithTagName:scanner.string attributes:nil];
+    }
+}
+
+- (void)testFragmentParser
+{
+    // One fragment parser per context, used for every fixture with that context (and each fixture twice), shows that nothing leaks from one fragment into the next.
+    NSMutableDictionary *fragmentParsers = [NSMutableDictionary new];
+    for (NSURL *testFileURL in [[self class] testFileURLs]) {
+        NSString *testName = [[testFileURL lastPathComponent] stringByDeletingPathExtension];
+        id <NSFastEnumeration> testStrings = [self singleTestStringsWithFileURL:testFileURL];
+        NSUInteger i = 0;
+        for (NSString *singleTestString in testStrings) {
+            i++;
+            HTMLTreeConstructionTest *test = [self testWithSingleTestString:singleTestString];
+            if (!test.documentFragment) continue;
+            
+            HTMLFragmentParser *fragmentParser = fragmentParsers[test.documentFragment];
+            if (!fragmentParser) {
+                fragmentParser = [[HTMLFragmentParser alloc] initWithContextElement:ContextElementForFragment(test.documentFragment)];
+                fragmentParsers[test.documentFragment] = fragmentParser;
+            }
+            for (NSUInteger pass = 1; pass <= 2; pass++) {
+                NSArray *nodes = [fragmentParser nodesWithString:test.data];
+                NSString *description = [NSString stringWithFormat:@"%@ test%tu parsed by fragment parser (pass %tu): %@\nfixture:\n%@",
+                                         testName,
+                                         i,
+                                         pass,
+                                         [[nodes valueForKey:@"recursiveDescription"] componentsJoinedByString:@"\n"],
+                                         [[test.expectedRootNodes valueForKey:@"recursiveDescription"] componentsJoinedByString:@"\n"]];
+                XCTAssert(TreesAreTestEquivalent(nodes, test.expectedRootNodes), @"%@", description);
+                for (HTMLNode *node in nodes) {
+                    XCTAssertNil(node.parentNode, @"%@", description);
+                }
+            }
+        }
+    }
+}
+
+- (void)testFragmentParserErrors
+{
+    HTMLElement *table = [[HTMLElement alloc] initWithTagName:@"table" attributes:nil];
+    HTMLFragmentParser *fragmentParser = [[HTMLFragmentParser alloc] initWithContextElement:table];
+    NSArray *nodes = [fragmentParser nodesWithString:@"<tr><td>1<td>2"];
+    XCTAssertEqual(nodes.count, (NSUInteger)1);
+    XCTAssertEqualObjects([nodes.firstObject tagName], @"tbody");
+    XCTAssertEqual(fragmentParser.numberOfErrors, (NSUInteger)0);
+    
+    fragmentParser.errorReporting = HTMLParseErrorReportingFull;
+    [fragmentParser nodesWithString:@"oops"];
+    XCTAssertTrue(fragmentParser.parseErrors.count > 0);
+    XCTAssertEqual(fragmentParser.numberOfErrors, fragmentParser.parseErrors.count);
+    
+    nodes = [fragmentParser nodesWithUTF8Data:[@"<tr><td>caf\u00E9" dataUsingEncoding:NSUTF8StringEncoding]];
+    XCTAssertEqual(fragmentParser.parseErrors.count, (NSUInteger)0);
+    XCTAssertEqualObjects([nodes.firstObject textContent], @"caf\u00E9");
+}
+
+- (void)testIncrementalParsing
+{
+    for (NSURL *testFileURL in [[self class] testFileURLs]) {
+        NSString *testName = [[testFileURL lastPathComponent] stringByDeletingPathExtension];
+        id <NSFastEnumeration> testStrings = [self singleTestStringsWithFileURL:testFileURL];
+        NSUInteger i = 0;
+        for (NSString *singleTestString in testStrings) {
+            i++;
+            HTMLTreeConstructionTest *test = [self testWithSingleTestString:singleTestString];
+            if (!test || test.documentFragment) continue;
+            
+            // One byte at a time splits every character, character reference, and tag that can be split.
+            HTMLParser *parser = [[HTMLParser alloc] initWithContentType:@"text/html; charset=utf-8"];
+            NSData *data = [test.data dataUsingEncoding:NSUTF8StringEncoding];
+            for (NSUInteger j = 0; j < data.length; j++) {
+                [parser appendData:[data subdataWithRange:NSMakeRange(j, 1)]];
+            }
+            [parser finish];
+            
+            NSString *description = [NSString stringWithFormat:@"%@ test%tu parsed incrementally: %@\nfixture:\n%@",
+                                     testName,
+                                     i,
+                                     parser.document.recursiveDescription,
+                                     [[test.expectedRootNodes valueForKey:@"recursiveDescription"] componentsJoinedByString:@"\n"]];
+            XCTAssert(TreesAreTestEquivalent(parser.document.children.array, test.expectedRootNodes), @"%@", description);
+        }
+    }
+}
+
+- (void)testIncrementalParsingAcrossChunks
+{
+    HTMLParser *parser = [[HTMLParser alloc] initWithContentType:nil];
+    NSString *HTML = @"<p class=\"bus\">Stop &amp; go \U0001F68C\r\n&notit; &#x3c;</p><!-- done -->";
+    NSData *data = [HTML dataUsingEncoding:NSUTF16LittleEndianStringEncoding];
+    NSMutableData *withBOM = [NSMutableData dataWithBytes:"\xFF\xFE" length:2];
+    [withBOM appendData:data];
+    for (NSUInteger i = 0; i < withBOM.length; i += 3) {
+        [parser appendData:[withBOM subdataWithRange:NSMakeRange(i, MIN(3, withBOM.length - i))]];
+    }
+    XCTAssertEqual(parser.encoding.encoding, NSUTF16LittleEndianStringEncoding);
+    XCTAssertEqualObjects([parser.document firstNodeMatchingSelector:@"p"][@"class"], @"bus");
+    [parser finish];
+    HTMLElement *p = [parser.document firstNodeMatchingSelector:@"p"];
+    XCTAssertEqualObjects(p.textContent, @"Stop & go \U0001F68C\n\u00ACit; <");
+    XCTAssertEqualObjects([[parser.document firstNodeMatchingSelector:@"body"].children.lastObject data], @" done ");
+}
+
+- (void)testIncrementalParsingOfLongTokens
+{
+    HTMLParser *parser = [[HTMLParser alloc] initWithContentType:@"text/html; charset=utf-8"];
+    [parser appendData:[@"<p title=\"a" dataUsingEncoding:NSUTF8StringEncoding]];
+    for (NSUInteger i = 0; i < 1000; i++) {
+        [parser appendData:[@" > b" dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    [parser appendData:[@"\">x<!--" dataUsingEncoding:NSUTF8StringEncoding]];
+    for (NSUInteger i = 0; i < 1000; i++) {
+        [parser appendData:[@" - c" dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    XCTAssertEqual([parser.document firstNodeMatchingSelector:@"p"][@"title"].length, (NSUInteger)4001);
+    [parser appendData:[@" -->y" dataUsingEncoding:NSUTF8StringEncoding]];
+    [parser finish];
+    HTMLElement *p = [parser.document firstNodeMatchingSelector:@"p"];
+    XCTAssertEqualObjects(p.textContent, @"xy");
+    XCTAssertEqual([p.children[1] data].length, (NSUInteger)4001);
+}
+
+- (void)testIncrementalParsingWithChangedEncoding
+{
+    HTMLParser *parser = [[HTMLParser alloc] initWithContentType:nil];
+    [parser appendData:[@"<meta charset=utf-8><p>caf" dataUsingEncoding:NSUTF8StringEncoding]];
+    [parser appendData:[NSData dataWithBytes:"\xC3" length:1]];
+    [parser appendData:[NSData dataWithBytes:"\xA9</p>" length:5]];
+    [parser finish];
+    XCTAssertEqual(parser.encoding.encoding, NSUTF8StringEncoding);
+    XCTAssertEqualObjects([parser.document firstNodeMatchingSelector:@"p"].textContent, @"caf\u00E9");
+}
+
+- (void)testIncrementalParsingWithUndecodableBytes
+{
+    HTMLParser *parser = [[HTMLParser alloc] initWithContentType:@"text/html; charset=windows-1252"];
+    [parser appendData:[NSData dataWithBytes:"<p>caf\xE9 \x81\x8D" length:10]];
+    [parser appendData:[NSData dataWithBytes:" and more</p><p>after" length:21]];
+    XCTAssertEqual([parser.document nodesMatchingSelector:@"p"].count, 2U);
+    [parser finish];
+    NSString *text = [parser.document firstNodeMatchingSelector:@"p"].textContent;
+    XCTAssertTrue([text hasPrefix:@"caf\u00E9 "], @"%@", text);
+    XCTAssertTrue([text hasSuffix:@" and more"], @"%@", text);
+    XCTAssertEqualObjects([parser.document firstNodeMatchingSelector:@"p:nth-of-type(2)"].textContent, @"after");
+    
+    parser = [[HTMLParser alloc] initWithContentType:@"text/html; charset=shift_jis"];
+    [parser appendData:[NSData dataWithBytes:"<p>\x82\xA0\x82</p>" length:10]];
+    [parser appendData:[NSData dataWithBytes:"<p>after" length:8]];
+    XCTAssertEqual([parser.document nodesMatchingSelector:@"p"].count, 2U);
+    [parser finish];
+    XCTAssertEqualObjects([parser.document firstNodeMatchingSelector:@"p"].textContent, @"\u3042\uFFFD");
+    XCTAssertEqualObjects([parser.document firstNodeMatchingSelector:@"p:nth-of-type(2)"].textContent, @"after");
+}
+
+- (void)testErrorReporting
+{
+    NSData *data = [@"<p>one\r\n<p a=1 a=2>two" dataUsingEncoding:NSUTF8StringEncoding];
+    
+    HTMLParser *parser = ParserWithDataContentTypeAndErrorReporting(data, nil, HTMLParseErrorReportingFull);
+    XCTAssertEqualObjects([parser.document firstNodeMatchingSelector:@"p:nth-of-type(2)"][@"a"], @"1");
+    NSArray *parseErrors = parser.parseErrors;
+    XCTAssertEqual(parser.numberOfErrors, parseErrors.count);
+    XCTAssertEqualObjects(parser.errors, [parseErrors valueForKey:@"reason"]);
+    HTMLParseError *missingDoctype = parseErrors.firstObject;
+    XCTAssertEqual(missingDoctype.line, (NSUInteger)1);
+    NSUInteger i = [parseErrors indexOfObjectPassingTest:^BOOL(HTMLParseError *error, NSUInteger i, BOOL *stop) {
+        return [error.reason hasSuffix:@"Duplicate attribute"];
+    }];
+    XCTAssertNotEqual(i, (NSUInteger)NSNotFound);
+    if (i != NSNotFound) {
+        HTMLParseError *duplicate = parseErrors[i];
+        XCTAssertEqual(duplicate.line, (NSUInteger)2);
+        XCTAssertEqual(duplicate.column, (NSUInteger)11);
+    }
+    
+    HTMLParser *counter = ParserWithDataContentTypeAndErrorReporting(data, nil, HTMLParseErrorReportingCount);
+    XCTAssertEqualObjects(counter.document.serializedFragment, parser.document.serializedFragment);
+    XCTAssertEqual(counter.numberOfErrors, parseErrors.count);
+    XCTAssertEqual(counter.errors.count, (NSUInteger)0);
+    
+    // Errors in a token that gets tokenized again once more data arrives are only counted once.
+    HTMLParser *incrementalCounter = [[HTMLParser alloc] initWithContentType:@"text/html; charset=utf-8"];
+    incrementalCounter.errorReporting = HTMLParseErrorReportingCount;
+    for (NSUInteger j = 0; j < data.length; j++) {
+        [incrementalCounter appendData:[data subdataWithRange:NSMakeRange(j, 1)]];
+    }
+    [incrementalCounter finish];
+    XCTAssertEqual(incrementalCounter.numberOfErrors, parseErrors.count);
+    
+    HTMLParser *quiet = ParserWithDataContentTypeAndErrorReporting(data, nil, HTMLParseErrorReportingOff);
+    XCTAssertEqualObjects(quiet.document.serializedFragment, parser.document.serializedFragment);
+    XCTAssertEqual(quiet.numberOfErrors, (NSUInteger)0);
+    XCTAssertEqual(quiet.parseErrors.count, (NSUInteger)0);
+}
+
 BOOL TreesAreTestEquivalent(id aThing, id bThing)
 {
     BOOL (^arrayLike)(id) = ^BOOL(id maybe) {
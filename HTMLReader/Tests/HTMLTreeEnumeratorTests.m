@@ -39,6 +39,45 @@
     XCTAssertEqualObjects([nodes valueForKey:@"tagName"], (@[ @"a", @"b", @"c", @"b", @"c", @"d", @"c" ]));
 }
 
+- (void)testFastEnumerationMatchesNextObject
+{
+    NSMutableString *string = [NSMutableString stringWithString:@"<a>"];
+    for (NSUInteger i = 0; i < 300; i++) {
+        [string appendFormat:@"<b>%tu<c></c></b>", i];
+    }
+    HTMLNode *root = [self rootNodeWithString:string];
+    for (NSNumber *reversed in @[ @NO, @YES ]) {
+        NSEnumerator *enumerator = reversed.boolValue ? root.reversedTreeEnumerator : root.treeEnumerator;
+        NSMutableArray *oneAtATime = [NSMutableArray new];
+        for (HTMLNode *node; (node = enumerator.nextObject); ) {
+            [oneAtATime addObject:node];
+        }
+        XCTAssertEqual(oneAtATime.count, (NSUInteger)901);
+        
+        NSMutableArray *batched = [NSMutableArray new];
+        for (HTMLNode *node in (reversed.boolValue ? root.reversedTreeEnumerator : root.treeEnumerator)) {
+            [batched addObject:node];
+        }
+        XCTAssertEqualObjects(batched, oneAtATime);
+    }
+}
+
+- (void)testElementsOnly
+{
+    HTMLNode *root = [self rootNodeWithString:@"<a>one<b>two</b><!-- three --><c>four</c>"];
+    NSMutableArray *tagNames = [NSMutableArray new];
+    for (HTMLElement *element in root.elementTreeEnumerator) {
+        [tagNames addObject:element.tagName];
+    }
+    XCTAssertEqualObjects(tagNames, (@[ @"a", @"b", @"c" ]));
+    
+    HTMLNode *text = root.children.firstObject;
+    XCTAssertEqualObjects([text.elementTreeEnumerator allObjects], @[]);
+    
+    HTMLDocument *document = root.document;
+    XCTAssertEqualObjects([document.elementTreeEnumerator nextObject], document.rootElement);
+}
+
 - (HTMLNode *)rootNodeWithString:(NSString *)string
 {
     HTMLStringEncoding encoding = (HTMLStringEncoding){ .encoding = NSUTF8StringEncoding, .confidence = Certain };
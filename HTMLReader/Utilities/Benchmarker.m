@@ -2,76 +2,668 @@
 //
 //  Public domain. https://github.com/nolanw/HTMLReader
 
+#import "HTMLParser.h"
 #import "HTMLReader.h"
-#import <mach/mach_time.h>
+#import "HTMLTokenizer.h"
+#import <math.h>
+#import <stdatomic.h>
+#import <stdio.h>
+#import <time.h>
 
-static NSTimeInterval Time(NSUInteger reps, void (^block)(void))
+/*
+    Usage: Benchmarker [options] [filter ...]
+
+    Runs each benchmark whose name contains any of the filters (or every benchmark, if there are no filters), then prints a summary. Benchmarks are named for a workload and a fixture, like "parse/article.html".
+
+    Options:
+        --fixtures <directory>   Where to find fixtures. Defaults to the Fixtures directory next to this file. Every .html file in there is a fixture, so drop in a copy of the single-page HTML specification as html5.html for a really big one.
+        --warmup <n>             Untimed runs before sampling. Defaults to 3.
+        --runs <n>               Timed samples per benchmark. Defaults to 20.
+        --min-sample-ms <ms>     Each sample repeats the workload until it takes at least this long. Defaults to 10.
+        --json <path>            Writes the results as JSON, or to standard output if the path is "-".
+        --baseline <path>        Compares against JSON written earlier by --json. Exits with status 1 if anything regressed.
+        --threshold <percent>    How much slower a median can get before it's a regression. Defaults to 10.
+        --list                   Prints the names of the benchmarks without running them.
+ */
+
+#pragma mark - Timing
+
+// CLOCK_MONOTONIC is available on Linux as well as Darwin, unlike mach_absolute_time().
+static uint64_t Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+#pragma mark - Counting allocations
+
+static atomic_ullong AllocationCount;
+
+#if defined(__APPLE__)
+
+// libmalloc calls malloc_logger, when set, for every allocation and free in every zone. It's how malloc debugging tools keep track.
+typedef void (MallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip);
+extern MallocLogger *malloc_logger;
+static const uint32_t MallocLogTypeAllocate = 2;
+
+static void CountAllocation(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip)
+{
+    if (type & MallocLogTypeAllocate) {
+        atomic_fetch_add_explicit(&AllocationCount, 1, memory_order_relaxed);
+    }
+}
+
+static const BOOL CanCountAllocations = YES;
+
+static void SetCountingAllocations(BOOL counting)
+{
+    malloc_logger = counting ? CountAllocation : NULL;
+}
+
+#elif defined(__GLIBC__)
+
+// glibc lets a program replace malloc and friends, and still exports the originals under other names. The replacements catch allocations made by Foundation and the Objective-C runtime too.
+extern void * __libc_malloc(size_t size);
+extern void * __libc_calloc(size_t count, size_t size);
+extern void * __libc_realloc(void *pointer, size_t size);
+
+static atomic_bool CountingAllocations;
+
+static inline void CountAllocation(void)
 {
-    static mach_timebase_info_data_t timebaseInfo;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        mach_timebase_info(&timebaseInfo);
+    if (atomic_load_explicit(&CountingAllocations, memory_order_relaxed)) {
+        atomic_fetch_add_explicit(&AllocationCount, 1, memory_order_relaxed);
+    }
+}
+
+void * malloc(size_t size)
+{
+    CountAllocation();
+    return __libc_malloc(size);
+}
+
+void * calloc(size_t count, size_t size)
+{
+    CountAllocation();
+    return __libc_calloc(count, size);
+}
+
+void * realloc(void *pointer, size_t size)
+{
+    CountAllocation();
+    return __libc_realloc(pointer, size);
+}
+
+static const BOOL CanCountAllocations = YES;
+
+static void SetCountingAllocations(BOOL counting)
+{
+    atomic_store_explicit(&CountingAllocations, counting, memory_order_relaxed);
+}
+
+#else
+
+static const BOOL CanCountAllocations = NO;
+
+static void SetCountingAllocations(__unused BOOL counting)
+{
+}
+
+#endif
+
+#pragma mark - Benchmarks
+
+typedef void (^Workload)(void);
+
+/// A named workload. Preparing the workload (loading a fixture, parsing a document to select from) isn't timed.
+@interface Benchmark : NSObject
+
+@property (copy, nonatomic) NSString *name;
+@property (copy, nonatomic) Workload (^prepare)(void);
+
+/// Anything else worth reporting about the workload, filled in while preparing it.
+@property (readonly, strong, nonatomic) NSMutableDictionary *details;
+
+@end
+
+@implementation Benchmark
+
+- (instancetype)init
+{
+    if ((self = [super init])) {
+        _details = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+@end
+
+static Benchmark * AddBenchmark(NSMutableArray *benchmarks, NSString *workload, NSString *fixture, Workload (^prepare)(void))
+{
+    Benchmark *benchmark = [Benchmark new];
+    benchmark.name = [NSString stringWithFormat:@"%@/%@", workload, fixture];
+    benchmark.prepare = prepare;
+    [benchmarks addObject:benchmark];
+    return benchmark;
+}
+
+// Fixtures are UTF-8. Most also say so in a <meta>, which parse-data finds by prescanning.
+static NSString * StringForFixture(NSString *path)
+{
+    return [[NSString alloc] initWithData:[NSData dataWithContentsOfFile:path] encoding:NSUTF8StringEncoding];
+}
+
+static NSArray * CommonSelectors(void)
+{
+    return @[ @"a[href]", @"div p", @"div > p", @"h2 + p", @"li:nth-child(odd)", @"table td", @"p a", @"p em", @".comment .meta", @"#content", @"*" ];
+}
+
+static NSArray * BenchmarksForFixture(NSString *path)
+{
+    NSString *fixture = path.lastPathComponent;
+    NSMutableArray *benchmarks = [NSMutableArray new];
+    
+    AddBenchmark(benchmarks, @"tokenize", fixture, ^Workload{
+        NSString *string = StringForFixture(path);
+        return ^{
+            for (__unused id token in [[HTMLTokenizer alloc] initWithString:string]);
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"tokenize-utf8", fixture, ^Workload{
+        NSData *data = [NSData dataWithContentsOfFile:path];
+        return ^{
+            HTMLTokenizer *tokenizer = [[HTMLTokenizer alloc] initWithInputStream:[[HTMLPreprocessedInputStream alloc] initWithUTF8Data:data]];
+            for (__unused id token in tokenizer);
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"parse", fixture, ^Workload{
+        NSString *string = StringForFixture(path);
+        return ^{
+            [HTMLDocument documentWithString:string];
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"parse-data", fixture, ^Workload{
+        NSData *data = [NSData dataWithContentsOfFile:path];
+        return ^{
+            [HTMLDocument documentWithData:data contentTypeHeader:nil];
+        };
+    });
+    
+    // Packets arriving over a slow connection.
+    AddBenchmark(benchmarks, @"parse-chunked", fixture, ^Workload{
+        NSData *data = [NSData dataWithContentsOfFile:path];
+        const NSUInteger chunkSize = 1400;
+        NSMutableArray *chunks = [NSMutableArray new];
+        for (NSUInteger i = 0; i < data.length; i += chunkSize) {
+            [chunks addObject:[data subdataWithRange:NSMakeRange(i, MIN(chunkSize, data.length - i))]];
+        }
+        return ^{
+            HTMLParser *parser = [[HTMLParser alloc] initWithContentType:@"text/html; charset=utf-8"];
+            for (NSData *chunk in chunks) {
+                [parser appendData:chunk];
+            }
+            [parser finish];
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"parse-parallel", fixture, ^Workload{
+        NSData *data = [NSData dataWithContentsOfFile:path];
+        NSMutableArray *dataArray = [NSMutableArray new];
+        NSMutableArray *contentTypes = [NSMutableArray new];
+        for (NSUInteger i = 0; i < 8; i++) {
+            [dataArray addObject:data];
+            [contentTypes addObject:@"text/html; charset=utf-8"];
+        }
+        return ^{
+            [HTMLDocument documentsWithDataArray:dataArray contentTypes:contentTypes];
+        };
+    });
+    
+    // The same documents as parse-parallel, one after another.
+    AddBenchmark(benchmarks, @"parse-serial", fixture, ^Workload{
+        NSData *data = [NSData dataWithContentsOfFile:path];
+        return ^{
+            for (NSUInteger i = 0; i < 8; i++) {
+                [HTMLDocument documentWithData:data contentTypeHeader:@"text/html; charset=utf-8"];
+            }
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"stream", fixture, ^Workload{
+        NSString *string = StringForFixture(path);
+        return ^{
+            __block NSUInteger linkCount = 0;
+            HTMLStreamingParser *parser = [[HTMLStreamingParser alloc] initWithString:string];
+            parser.didStartElement = ^(HTMLElement *element, NSUInteger depth, NSArray *ancestorNames) {
+                if ([element.tagName isEqualToString:@"a"] && element[@"href"]) {
+                    linkCount++;
+                }
+            };
+            [parser parse];
+        };
+    });
+    
+    // Pulling the first table out of a page, which a full parse would follow with -firstNodeMatchingSelector:.
+    AddBenchmark(benchmarks, @"prune-first", fixture, ^Workload{
+        NSString *string = StringForFixture(path);
+        HTMLSelector *selector = [HTMLSelector selectorForString:@"table"];
+        return ^{
+            HTMLPruningParser *parser = [[HTMLPruningParser alloc] initWithString:string keepSelector:selector];
+            parser.stopsAfterFirstMatch = YES;
+            (void)parser.matchingElements;
+        };
+    });
+    
+    // Re-parsing every table cell, as when scraped tables are rendered cell by cell. Fixtures without tables fall back to paragraphs.
+    AddBenchmark(benchmarks, @"fragments", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        NSArray *cells = [document nodesMatchingSelector:@"td, th"];
+        if (cells.count == 0) {
+            cells = [document nodesMatchingSelector:@"p"];
+        }
+        NSArray *fragments = [cells valueForKey:@"innerHTML"];
+        HTMLFragmentParser *fragmentParser = [[HTMLFragmentParser alloc] initWithContextElement:cells.firstObject ?: [document firstNodeMatchingSelector:@"body"]];
+        return ^{
+            for (NSString *fragment in fragments) {
+                [fragmentParser nodesWithString:fragment];
+            }
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"compact", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        return ^{
+            (void)[[HTMLCompactDocument alloc] initWithDocument:document];
+        };
+    });
+    
+    Benchmark *footprint = AddBenchmark(benchmarks, @"footprint", fixture, nil);
+    NSMutableDictionary *footprintDetails = footprint.details;
+    footprint.prepare = ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        footprintDetails[@"footprint"] = document.memoryFootprint.dictionaryRepresentation;
+        return ^{
+            (void)document.memoryFootprint;
+        };
+    };
+    
+    AddBenchmark(benchmarks, @"enumerate", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        return ^{
+            for (__unused HTMLNode *node in document.treeEnumerator);
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"select", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        NSArray *selectors = CommonSelectors();
+        return ^{
+            for (NSString *selector in selectors) {
+                [document nodesMatchingSelector:selector];
+            }
+        };
+    });
+    
+    // The same selectors as select, parsed ahead of time. The difference from select is the cost of looking up the selector cache.
+    AddBenchmark(benchmarks, @"select-parsed", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        NSMutableArray *selectors = [NSMutableArray new];
+        for (NSString *selectorString in CommonSelectors()) {
+            [selectors addObject:[HTMLSelector selectorForString:selectorString]];
+        }
+        return ^{
+            for (HTMLSelector *selector in selectors) {
+                [document nodesMatchingParsedSelector:selector];
+            }
+        };
     });
+    
+    // The same selectors as select, parsed anew every time, as they were before the selector cache.
+    AddBenchmark(benchmarks, @"select-uncached", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        NSArray *selectorStrings = CommonSelectors();
+        return ^{
+            for (NSString *selectorString in selectorStrings) {
+                [document nodesMatchingParsedSelector:[HTMLSelector selectorForString:selectorString]];
+            }
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"select-set", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        NSMutableArray *selectors = [NSMutableArray new];
+        for (NSString *selectorString in CommonSelectors()) {
+            [selectors addObject:[HTMLSelector selectorForString:selectorString]];
+        }
+        HTMLSelectorSet *selectorSet = [[HTMLSelectorSet alloc] initWithSelectors:selectors];
+        return ^{
+            [document nodesMatchingSelectorSet:selectorSet];
+        };
+    });
+    
+    // A fixture can come with a plist of selector suites, like the WebKit QuerySelector.html performance test that query-selector.html was copied from.
+    NSString *suitesPath = [path.stringByDeletingPathExtension stringByAppendingPathExtension:@"plist"];
+    if ([[NSFileManager defaultManager] fileExistsAtPath:suitesPath]) {
+        AddBenchmark(benchmarks, @"select-suite", fixture, ^Workload{
+            HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+            NSArray *suites = [NSArray arrayWithContentsOfFile:suitesPath];
+            return ^{
+                for (NSDictionary *suite in suites) {
+                    NSInteger count = [suite[@"fraction"] integerValue];
+                    for (NSInteger i = 0; i < count; i++) {
+                        for (NSString *selector in suite[@"selectors"]) {
+                            [document nodesMatchingSelector:selector];
+                        }
+                    }
+                }
+            };
+        });
+    }
+    
+    // Text content is cached until the subtree changes, so alternate between two sets of options to extract it anew each time.
+    AddBenchmark(benchmarks, @"text", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        return ^{
+            [document textContentWithOptions:0];
+            [document textContentWithOptions:HTMLTextContentCollapseWhitespace | HTMLTextContentSkipScriptAndStyle | HTMLTextContentBlockSeparators];
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"serialize", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        return ^{
+            (void)document.serializedFragment;
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"serialize-data", fixture, ^Workload{
+        HTMLDocument *document = [HTMLDocument documentWithString:StringForFixture(path)];
+        return ^{
+            [document writeSerializedFragmentToData:[NSMutableData new]];
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"escape", fixture, ^Workload{
+        NSString *string = StringForFixture(path);
+        return ^{
+            (void)[string html_stringByEscapingForHTML];
+        };
+    });
+    
+    AddBenchmark(benchmarks, @"unescape", fixture, ^Workload{
+        NSString *string = StringForFixture(path);
+        return ^{
+            (void)[string html_stringByUnescapingHTML];
+        };
+    });
+    
+    return benchmarks;
+}
+
+#pragma mark - Running
 
-    uint64_t elapsed = 0;
-    for (NSUInteger i = 0; i < reps; i++) {
-        uint64_t start = mach_absolute_time();
-        block();
-        uint64_t end = mach_absolute_time();
-        elapsed += (end - start);
+typedef struct {
+    NSUInteger warmup;
+    NSUInteger runs;
+    uint64_t minimumSampleTime;
+} RunOptions;
+
+static uint64_t TimeIterations(Workload workload, NSUInteger iterations)
+{
+    uint64_t start = Now();
+    for (NSUInteger i = 0; i < iterations; i++) {
+        @autoreleasepool {
+            workload();
+        }
+    }
+    return Now() - start;
+}
+
+static int CompareDoubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/// Returns the result of running the benchmark, with times in nanoseconds per iteration of the workload.
+static NSDictionary * RunBenchmark(Benchmark *benchmark, RunOptions options)
+{
+    Workload workload;
+    @autoreleasepool {
+        workload = benchmark.prepare();
+    }
+    
+    // Warming up fills caches (ours and the processor's), and tells us how many iterations make a sample long enough to time reliably.
+    NSUInteger warmupRuns = MAX(options.warmup, (NSUInteger)1);
+    uint64_t iterationTime = MAX(TimeIterations(workload, warmupRuns) / warmupRuns, (uint64_t)1);
+    NSUInteger iterations = (NSUInteger)MAX((options.minimumSampleTime + iterationTime - 1) / iterationTime, (uint64_t)1);
+    
+    NSUInteger runs = options.runs;
+    double *samples = calloc(runs, sizeof(samples[0]));
+    double total = 0;
+    for (NSUInteger i = 0; i < runs; i++) {
+        samples[i] = (double)TimeIterations(workload, iterations) / iterations;
+        total += samples[i];
+    }
+    qsort(samples, runs, sizeof(samples[0]), CompareDoubles);
+    double median = runs % 2 ? samples[runs / 2] : (samples[runs / 2 - 1] + samples[runs / 2]) / 2;
+    
+    // Nearest-rank percentile, so it's always a time that was actually measured.
+    double p95 = samples[(NSUInteger)ceil(0.95 * runs) - 1];
+    double fastest = samples[0];
+    free(samples);
+    
+    // Counting slows down allocation, so it gets a run of its own.
+    id allocations = [NSNull null];
+    if (CanCountAllocations) {
+        @autoreleasepool {
+            atomic_store_explicit(&AllocationCount, 0, memory_order_relaxed);
+            SetCountingAllocations(YES);
+            workload();
+            SetCountingAllocations(NO);
+        }
+        allocations = @(atomic_load_explicit(&AllocationCount, memory_order_relaxed));
+    }
+    
+    NSMutableDictionary *result = [@{ @"name": benchmark.name,
+                                      @"iterations": @(iterations),
+                                      @"runs": @(runs),
+                                      @"median_ns": @(median),
+                                      @"p95_ns": @(p95),
+                                      @"min_ns": @(fastest),
+                                      @"mean_ns": @(total / runs),
+                                      @"allocations": allocations } mutableCopy];
+    [result addEntriesFromDictionary:benchmark.details];
+    return result;
+}
+
+static NSString * FormatDuration(double nanoseconds)
+{
+    if (nanoseconds < 1e3) return [NSString stringWithFormat:@"%.0f ns", nanoseconds];
+    if (nanoseconds < 1e6) return [NSString stringWithFormat:@"%.2f us", nanoseconds / 1e3];
+    if (nanoseconds < 1e9) return [NSString stringWithFormat:@"%.2f ms", nanoseconds / 1e6];
+    return [NSString stringWithFormat:@"%.2f s", nanoseconds / 1e9];
+}
+
+/// Describes how a result compares to its baseline, setting *regressed if it got worse.
+static NSString * CompareToBaseline(NSDictionary *result, NSDictionary *baseline, double threshold, BOOL *regressed)
+{
+    if (!baseline) return @"new";
+    
+    double change = [result[@"median_ns"] doubleValue] / [baseline[@"median_ns"] doubleValue] - 1;
+    NSMutableString *description = [NSMutableString stringWithFormat:@"%+.1f%%", change * 100];
+    if (change > threshold) {
+        [description appendString:@" SLOWER"];
+        *regressed = YES;
+    }
+    
+    id allocations = result[@"allocations"];
+    id baselineAllocations = baseline[@"allocations"];
+    if ([allocations isKindOfClass:[NSNumber class]] && [baselineAllocations isKindOfClass:[NSNumber class]]) {
+        unsigned long long now = [allocations unsignedLongLongValue];
+        unsigned long long before = [baselineAllocations unsignedLongLongValue];
+        
+        // Allocation counts barely wobble from run to run, so more than 1% extra is real.
+        if (now > before + before / 100) {
+            [description appendFormat:@" +%llu allocations", now - before];
+            *regressed = YES;
+        }
     }
     
-    return (NSTimeInterval)elapsed * timebaseInfo.numer / timebaseInfo.denom / 1e9;
+    // Footprints are worked out rather than measured, so any growth past rounding is a change in layout.
+    NSNumber *bytes = result[@"footprint"][@"estimatedBytes"];
+    NSNumber *baselineBytes = baseline[@"footprint"][@"estimatedBytes"];
+    if (bytes && baselineBytes) {
+        NSUInteger now = bytes.unsignedIntegerValue;
+        NSUInteger before = baselineBytes.unsignedIntegerValue;
+        if (now > before + before / 100) {
+            [description appendFormat:@" +%lu bytes", (unsigned long)(now - before)];
+            *regressed = YES;
+        }
+    }
+    return description;
 }
 
-static NSString * PathForFixture(NSString *fixture)
+static NSString * DefaultFixturesDirectory(void)
 {
-    return [[[@(__FILE__) stringByDeletingLastPathComponent] stringByAppendingPathComponent:@"Fixtures"] stringByAppendingPathComponent:fixture];
+    return [[@(__FILE__) stringByDeletingLastPathComponent] stringByAppendingPathComponent:@"Fixtures"];
 }
 
 int main(void) { @autoreleasepool {
     NSArray *arguments = [[NSProcessInfo processInfo] arguments];
-    arguments = [arguments subarrayWithRange:NSMakeRange(1, arguments.count - 1)];
-    if (arguments.count == 0) arguments = @[ @"large", @"selector" ];
+    NSString *fixturesDirectory = DefaultFixturesDirectory();
+    RunOptions options = { .warmup = 3, .runs = 20, .minimumSampleTime = 10 * 1000000 };
+    NSString *JSONPath;
+    NSString *baselinePath;
+    double threshold = 0.1;
+    BOOL listOnly = NO;
+    NSMutableArray *filters = [NSMutableArray new];
+    for (NSUInteger i = 1; i < arguments.count; i++) {
+        NSString *argument = arguments[i];
+        if (![argument hasPrefix:@"--"]) {
+            [filters addObject:argument];
+            continue;
+        }
+        if ([argument isEqualToString:@"--list"]) {
+            listOnly = YES;
+            continue;
+        }
+        if (i + 1 == arguments.count) {
+            fprintf(stderr, "%s needs a value\n", argument.UTF8String);
+            return 2;
+        }
+        NSString *value = arguments[++i];
+        if ([argument isEqualToString:@"--fixtures"]) {
+            fixturesDirectory = value;
+        } else if ([argument isEqualToString:@"--warmup"]) {
+            options.warmup = (NSUInteger)MAX(value.integerValue, 0);
+        } else if ([argument isEqualToString:@"--runs"]) {
+            options.runs = (NSUInteger)MAX(value.integerValue, 1);
+        } else if ([argument isEqualToString:@"--min-sample-ms"]) {
+            options.minimumSampleTime = (uint64_t)(MAX(value.doubleValue, 0) * 1000000);
+        } else if ([argument isEqualToString:@"--json"]) {
+            JSONPath = value;
+        } else if ([argument isEqualToString:@"--baseline"]) {
+            baselinePath = value;
+        } else if ([argument isEqualToString:@"--threshold"]) {
+            threshold = value.doubleValue / 100;
+        } else {
+            fprintf(stderr, "unknown option %s\n", argument.UTF8String);
+            return 2;
+        }
+    }
     
-    if ([arguments containsObject:@"large"]) {
-        NSString *large = [NSString stringWithContentsOfFile:PathForFixture(@"html5.html") usedEncoding:nil error:nil];
-        NSTimeInterval largeParseTime = Time(1, ^{
-            [HTMLDocument documentWithString:large];
-        });
-        NSLog(@"Time for parsing fixture: %gs", largeParseTime);
-    }
-    
-    if ([arguments containsObject:@"selector"]) {
-        HTMLDocument *selectorsDocument = [HTMLDocument documentWithString:[NSString stringWithContentsOfFile:PathForFixture(@"query-selector.html") usedEncoding:nil error:nil]];
-        NSArray *selectorSuites = [NSArray arrayWithContentsOfFile:PathForFixture(@"query-selector.plist")];
-        NSUInteger reps = 5;
-        NSTimeInterval selectorTime = Time(reps, ^{
-            for (NSDictionary *suite in selectorSuites) {
-                NSInteger count = [suite[@"fraction"] integerValue];
-                for (NSInteger i = 0; i < count; i++) {
-                    NSArray *selectors = suite[@"selectors"];
-                    for (NSString *selector in selectors) {
-                        [selectorsDocument nodesMatchingSelector:selector];
-                    }
+    NSError *error;
+    NSArray *filenames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:fixturesDirectory error:&error];
+    if (!filenames) {
+        fprintf(stderr, "could not list fixtures in %s: %s\n", fixturesDirectory.UTF8String, error.localizedDescription.UTF8String);
+        return 2;
+    }
+    NSMutableArray *benchmarks = [NSMutableArray new];
+    for (NSString *filename in [filenames sortedArrayUsingSelector:@selector(compare:)]) {
+        if (![filename.pathExtension isEqualToString:@"html"]) continue;
+        
+        for (Benchmark *benchmark in BenchmarksForFixture([fixturesDirectory stringByAppendingPathComponent:filename])) {
+            BOOL wanted = filters.count == 0;
+            for (NSString *filter in filters) {
+                if ([benchmark.name rangeOfString:filter].location != NSNotFound) {
+                    wanted = YES;
+                    break;
                 }
             }
-        });
-        NSLog(@"Time for selecting nodes: %gs (mean)", selectorTime / reps);
+            if (wanted) {
+                [benchmarks addObject:benchmark];
+            }
+        }
     }
     
-    if ([arguments containsObject:@"escape"]) {
-        NSString *large = [NSString stringWithContentsOfFile:PathForFixture(@"html5.html") usedEncoding:nil error:nil];
-        NSTimeInterval escapeTime = Time(1, ^{
-            [large html_stringByEscapingForHTML];
-        });
-        NSLog(@"Time for escaping fixture: %gs", escapeTime);
-        
-        NSTimeInterval unescapeTime = Time(1, ^{
-            [large html_stringByUnescapingHTML];
-        });
-        NSLog(@"Time for unescaping fixture: %gs", unescapeTime);
+    if (listOnly) {
+        for (Benchmark *benchmark in benchmarks) {
+            printf("%s\n", benchmark.name.UTF8String);
+        }
+        return 0;
+    }
+    
+    NSMutableDictionary *baselines;
+    if (baselinePath) {
+        NSData *data = [NSData dataWithContentsOfFile:baselinePath];
+        NSDictionary *baseline = data ? [NSJSONSerialization JSONObjectWithData:data options:0 error:&error] : nil;
+        if (![baseline isKindOfClass:[NSDictionary class]]) {
+            fprintf(stderr, "could not read baseline %s\n", baselinePath.UTF8String);
+            return 2;
+        }
+        baselines = [NSMutableDictionary new];
+        for (NSDictionary *result in baseline[@"benchmarks"]) {
+            baselines[result[@"name"]] = result;
+        }
+    }
+    
+    // JSON on standard output shouldn't get mixed up with the summary.
+    FILE *summary = [JSONPath isEqualToString:@"-"] ? stderr : stdout;
+    fprintf(summary, "%-32s %12s %12s %12s%s\n", "benchmark", "median", "p95", "allocations", baselines ? "   vs baseline" : "");
+    
+    NSMutableArray *results = [NSMutableArray new];
+    BOOL regressed = NO;
+    for (Benchmark *benchmark in benchmarks) {
+        @autoreleasepool {
+            NSDictionary *result = RunBenchmark(benchmark, options);
+            [results addObject:result];
+            
+            id allocations = result[@"allocations"];
+            NSString *allocationsDescription = [allocations isKindOfClass:[NSNumber class]] ? [allocations stringValue] : @"?";
+            NSString *comparison = baselines ? [@"   " stringByAppendingString:CompareToBaseline(result, baselines[benchmark.name], threshold, &regressed)] : @"";
+            fprintf(summary, "%-32s %12s %12s %12s%s\n", benchmark.name.UTF8String, FormatDuration([result[@"median_ns"] doubleValue]).UTF8String, FormatDuration([result[@"p95_ns"] doubleValue]).UTF8String, allocationsDescription.UTF8String, comparison.UTF8String);
+            NSDictionary *footprint = result[@"footprint"];
+            if (footprint) {
+                fprintf(summary, "%-32s about %lu KB in %lu nodes\n", "", [footprint[@"estimatedBytes"] unsignedLongValue] / 1024, [footprint[@"numberOfNodes"] unsignedLongValue]);
+            }
+            fflush(summary);
+        }
     }
     
+    if (JSONPath) {
+        NSDictionary *report = @{ @"version": @1,
+                                  @"warmup": @(options.warmup),
+                                  @"runs": @(options.runs),
+                                  @"min_sample_ns": @(options.minimumSampleTime),
+                                  @"benchmarks": results };
+        NSData *JSON = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+        if ([JSONPath isEqualToString:@"-"]) {
+            fwrite(JSON.bytes, 1, JSON.length, stdout);
+            fputc('\n', stdout);
+        } else if (![JSON writeToFile:JSONPath options:NSDataWritingAtomic error:&error]) {
+            fprintf(stderr, "could not write %s: %s\n", JSONPath.UTF8String, error.localizedDescription.UTF8String);
+            return 2;
+        }
+    }
+    
+    if (regressed) {
+        fprintf(summary, "Regressed by more than %g%% compared to %s\n", threshold * 100, baselinePath.UTF8String);
+        return 1;
+    }
     return 0;
 }}
@@ -0,0 +1,22 @@
+# Builds Benchmarker against GNUstep, so the benchmarks run on Linux too:
+#
+#     make -f Utilities/Benchmarker.mk
+#     ./Benchmarker --json baseline.json
+#
+# Needs clang, libobjc2, gnustep-base, gnustep-corebase (for CoreFoundation), and libdispatch.
+
+HERE := $(dir $(lastword $(MAKEFILE_LIST)))
+CODE := $(HERE)../Code
+
+CC = clang
+SOURCES = $(HERE)Benchmarker.m $(wildcard $(CODE)/*.m)
+OBJCFLAGS = $(shell gnustep-config --objc-flags) -fobjc-arc -fblocks -O2 -I$(CODE)
+LIBS = $(shell gnustep-config --base-libs) -lgnustep-corebase -ldispatch -lm
+
+Benchmarker: $(SOURCES) $(wildcard $(CODE)/*.h)
+	$(CC) $(OBJCFLAGS) -o $@ $(SOURCES) $(LIBS)
+
+clean:
+	rm -f Benchmarker
+
+.PHONY: clean
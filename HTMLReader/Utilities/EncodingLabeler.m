@@ -4,6 +4,26 @@
 
 #import <Foundation/Foundation.h>
 
+enum {
+    NumberOfSeeds = 64,
+    NumberOfSlots = 256,
+};
+
+// Must match HashEncodingLabel() in HTMLEncoding.m.
+static uint32_t HashEncodingLabel(NSString *label, uint32_t seed)
+{
+    const char *bytes = label.UTF8String;
+    uint32_t hash = 2166136261U ^ seed;
+    for (NSUInteger i = 0; bytes[i]; i++) {
+        hash ^= (uint8_t)bytes[i];
+        hash *= 16777619U;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    return hash;
+}
+
 int main(void) { @autoreleasepool
 {
     static NSString * const EncodingLabelsURL = @"https://encoding.spec.whatwg.org/encodings.json";
@@ -30,14 +50,6 @@ int main(void) { @autoreleasepool
         }
     }
     
-    printf("static const EncodingLabelMap EncodingLabels[] = {\n");
-    NSArray *sortedLabels = [labelsToNames.allKeys sortedArrayUsingSelector:@selector(compare:)];
-    for (NSString *label in sortedLabels) {
-        NSString *name = labelsToNames[label];
-        printf("    { @\"%s\", @\"%s\" },\n", label.UTF8String, name.UTF8String);
-    }
-    printf("};\n\n");
-    
     // Check that we're using valid constants, then stringify them.
     #define cfencoding(name) ({ \
         __unused CFStringEncoding encoding = name; \
@@ -88,24 +100,83 @@ int main(void) { @autoreleasepool
         @"windows-1257": cfencoding(kCFStringEncodingWindowsBalticRim),
         @"windows-1258": cfencoding(kCFStringEncodingWindowsVietnamese),
         @"x-mac-cyrillic": cfencoding(kCFStringEncodingMacCyrillic),
-        // Assume that the HTML parser correctly handles x-user-defined, we should never be asked about it.
-        @"x-user-defined": cfencoding(kCFStringEncodingInvalidId),
+        // SPEC: The HTML standard unilaterally changes x-user-defined to windows-1252, so let's just define it so.
+        @"x-user-defined": cfencoding(kCFStringEncodingWindowsLatin1),
     };
     
     #undef cfencoding
     
-    printf("static const NameCFEncodingMap StringEncodings[] = {\n");
-    NSArray *uniqueNames = [NSSet setWithArray:labelsToNames.allValues].allObjects;
-    NSArray *sortedNames = [uniqueNames sortedArrayUsingSelector:@selector(compare:)];
-    for (NSString *name in sortedNames) {
-        NSString *kEncoding = namesToStringEncodings[name];
-        
-        if (!kEncoding) {
+    for (NSString *name in [NSSet setWithArray:labelsToNames.allValues]) {
+        if (!namesToStringEncodings[name]) {
             NSLog(@"missing CFStringEncoding for encoding named %@", name);
             return 1;
         }
-        
-        printf("    { @\"%s\", %s },\n", name.UTF8String, kEncoding.UTF8String);
+    }
+    
+    // Labels are split into buckets by their unseeded hash, then each bucket (biggest first) gets the first seed that puts all of its labels into empty slots.
+    NSArray *sortedLabels = [labelsToNames.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    NSMutableArray *buckets = [NSMutableArray new];
+    for (NSUInteger i = 0; i < NumberOfSeeds; i++) {
+        [buckets addObject:[NSMutableArray new]];
+    }
+    NSUInteger longestLabelLength = 0;
+    for (NSString *label in sortedLabels) {
+        [buckets[HashEncodingLabel(label, 0) % NumberOfSeeds] addObject:label];
+        longestLabelLength = MAX(longestLabelLength, label.length);
+    }
+    NSMutableArray *nonemptyBucketIndexes = [NSMutableArray new];
+    for (NSUInteger i = 0; i < NumberOfSeeds; i++) {
+        if ([buckets[i] count] > 0) {
+            [nonemptyBucketIndexes addObject:@(i)];
+        }
+    }
+    NSArray *bucketIndexes = [nonemptyBucketIndexes sortedArrayUsingComparator:^NSComparisonResult(NSNumber *a, NSNumber *b) {
+        NSUInteger aCount = [buckets[a.unsignedIntegerValue] count], bCount = [buckets[b.unsignedIntegerValue] count];
+        if (aCount != bCount) return aCount > bCount ? NSOrderedAscending : NSOrderedDescending;
+        return [a compare:b];
+    }];
+    
+    uint8_t seeds[NumberOfSeeds] = {0};
+    NSMutableDictionary *slotsToLabels = [NSMutableDictionary new];
+    for (NSNumber *bucketIndex in bucketIndexes) {
+        NSArray *bucket = buckets[bucketIndex.unsignedIntegerValue];
+        BOOL placed = NO;
+        for (uint32_t seed = 1; seed <= UINT8_MAX && !placed; seed++) {
+            NSMutableDictionary *slots = [NSMutableDictionary new];
+            for (NSString *label in bucket) {
+                NSNumber *slot = @(HashEncodingLabel(label, seed) % NumberOfSlots);
+                if (slotsToLabels[slot] || slots[slot]) break;
+                slots[slot] = label;
+            }
+            if (slots.count == bucket.count) {
+                [slotsToLabels addEntriesFromDictionary:slots];
+                seeds[bucketIndex.unsignedIntegerValue] = (uint8_t)seed;
+                placed = YES;
+            }
+        }
+        if (!placed) {
+            NSLog(@"could not find a seed for labels %@; try more slots", bucket);
+            return 1;
+        }
+    }
+    
+    printf("enum { LongestEncodingLabelLength = %tu };\n\n", longestLabelLength);
+    
+    printf("static const uint8_t EncodingLabelSeeds[] = {\n");
+    for (NSUInteger i = 0; i < NumberOfSeeds; i += 16) {
+        printf("   ");
+        for (NSUInteger j = i; j < i + 16 && j < NumberOfSeeds; j++) {
+            printf(" %u,", seeds[j]);
+        }
+        printf("\n");
+    }
+    printf("};\n\n");
+    
+    printf("static const EncodingLabelMap EncodingLabels[%d] = {\n", NumberOfSlots);
+    for (NSNumber *slot in [slotsToLabels.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        NSString *label = slotsToLabels[slot];
+        NSString *kEncoding = namesToStringEncodings[labelsToNames[label]];
+        printf("    [%tu] = { \"%s\", %s },\n", slot.unsignedIntegerValue, label.UTF8String, kEncoding.UTF8String);
     }
     printf("};\n\n");
     
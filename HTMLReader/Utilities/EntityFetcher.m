@@ -9,14 +9,17 @@
 @property (copy, nonatomic) NSString *name;
 @property (copy, nonatomic) NSArray *codepoints;
 
+/// The replacement characters as an Objective-C string literal.
+@property (readonly, copy, nonatomic) NSString *replacementLiteral;
+
 @end
 
 @implementation Entity
 
-- (NSString *)description
+- (NSString *)replacementLiteral
 {
     NSMutableString *description = [NSMutableString new];
-    [description appendFormat:@"{ @\"%@\", @\"", [self.name substringFromIndex:1]];
+    [description appendString:@"@\""];
     for (NSNumber *codepoint in self.codepoints) {
         unsigned int c = codepoint.unsignedIntValue;
         switch (c) {
@@ -41,7 +44,7 @@
                 break;
         }
     }
-    [description appendString:@"\" },"];
+    [description appendString:@"\""];
     return description;
 }
 
@@ -53,6 +56,31 @@ static inline BOOL is_universal(unsigned int c)
 
 @end
 
+/// A node in the trie of entity names.
+@interface TrieNode : NSObject
+
+@property (assign, nonatomic) unichar character;
+@property (readonly, strong, nonatomic) NSMutableDictionary *children;
+@property (strong, nonatomic) Entity *entity;
+
+// Filled in once the trie is laid out.
+@property (assign, nonatomic) NSUInteger firstChild;
+@property (assign, nonatomic) NSUInteger replacement;
+
+@end
+
+@implementation TrieNode
+
+- (instancetype)init
+{
+    if ((self = [super init])) {
+        _children = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+@end
+
 int main(void) { @autoreleasepool
 {
     static NSString * const EntitiesURL = @"http://www.whatwg.org/specs/web-apps/current-work/multipage/entities.json";
@@ -67,8 +95,7 @@ int main(void) { @autoreleasepool
         NSLog(@"could not decode entities JSON: %@", error);
         return 1;
     }
-    NSMutableArray *entities = [NSMutableArray new];
-    NSMutableArray *semicolonlessEntities = [NSMutableArray new];
+    TrieNode *root = [TrieNode new];
     NSUInteger longestLength = 0;
     for (NSString *name in entitiesJSON) {
         if (name.length > longestLength) {
@@ -78,31 +105,64 @@ int main(void) { @autoreleasepool
         entity.name = name;
         NSDictionary *replacement = entitiesJSON[name];
         entity.codepoints = replacement[@"codepoints"];
-        if ([name hasSuffix:@";"]) {
-            [entities addObject:entity];
-        } else {
-            [semicolonlessEntities addObject:entity];
+        
+        // Skip the ampersand.
+        TrieNode *node = root;
+        for (NSUInteger i = 1; i < name.length; i++) {
+            unichar c = [name characterAtIndex:i];
+            TrieNode *child = node.children[@(c)];
+            if (!child) {
+                child = [TrieNode new];
+                child.character = c;
+                node.children[@(c)] = child;
+            }
+            node = child;
         }
+        node.entity = entity;
     }
-    static NSComparator comparator = ^(Entity *a, Entity *b) {
-        return [a.name compare:b.name];
-    };
-    [entities sortUsingComparator:comparator];
-    [semicolonlessEntities sortUsingComparator:comparator];
     
-    printf("static const NamedReferenceMap NamedReferences[] = {\n");
-    for (Entity *entity in entities) {
-        printf("    %s\n", entity.description.UTF8String);
+    // Lay out the nodes breadth first, so each node's children end up next to each other.
+    NSMutableArray *nodes = [NSMutableArray arrayWithObject:root];
+    for (NSUInteger i = 0; i < nodes.count; i++) {
+        TrieNode *node = nodes[i];
+        node.firstChild = node.children.count > 0 ? nodes.count : 0;
+        for (NSNumber *character in [node.children.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+            [nodes addObject:node.children[character]];
+        }
+    }
+    
+    // Many entities share replacements (e.g. "amp" and "amp;"), so each replacement is listed once.
+    NSMutableArray *replacements = [NSMutableArray new];
+    NSMutableDictionary *replacementIndexes = [NSMutableDictionary new];
+    for (TrieNode *node in nodes) {
+        if (!node.entity) continue;
+        NSString *literal = node.entity.replacementLiteral;
+        NSNumber *index = replacementIndexes[literal];
+        if (!index) {
+            [replacements addObject:literal];
+            index = @(replacements.count);
+            replacementIndexes[literal] = index;
+        }
+        node.replacement = index.unsignedIntegerValue;
+    }
+    
+    printf("static __unsafe_unretained NSString * const NamedReferenceReplacements[] = {\n");
+    for (NSString *literal in replacements) {
+        printf("    %s,\n", literal.UTF8String);
     }
     printf("};\n\n");
     
-    printf("static const NamedReferenceMap NamedSemicolonlessReferences[] = {\n");
-    for (Entity *entity in semicolonlessEntities) {
-        printf("    %s\n", entity.description.UTF8String);
+    printf("static const NamedReferenceNode NamedReferenceNodes[] = {\n");
+    for (TrieNode *node in nodes) {
+        if (node == root) {
+            printf("    { '\\0', %tu, %tu, %tu },\n", node.children.count, node.firstChild, node.replacement);
+        } else {
+            printf("    { '%c', %tu, %tu, %tu },\n", (char)node.character, node.children.count, node.firstChild, node.replacement);
+        }
     }
     printf("};\n\n");
     
     // -1 for the ampersand we ignore.
-    printf("static const NSUInteger LongestReferenceNameLength = %tu;\n", longestLength - 1);
+    printf("const NSUInteger LongestEntityNameLength = %tu;\n", longestLength - 1);
     return 0;
 } }